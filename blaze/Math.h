@@ -44,6 +44,10 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/Batch.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/ChunkedMatrix.h>
+#include <blaze/math/CompactMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
@@ -62,8 +66,12 @@
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
+#include <blaze/math/MappedCompressedMatrix.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/PackedFlag.h>
+#include <blaze/math/PackedMatrix.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/SellMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
@@ -159,7 +159,10 @@
 // Furthermore, for computing the determinant of a dense matrix and for the dense matrix inversion
 // \b Blaze requires <a href="https://en.wikipedia.org/wiki/LAPACK">LAPACK</a>. When either of
 // these features is used it is necessary to link the LAPACK library to the final executable. If
-// no LAPACK library is available the use of these features will result in a linker error.
+// no LAPACK library is available the use of these features will result in a linker error. The
+// dense matrix inversion and the LU, Cholesky and QR decompositions can alternatively be computed
+// by native \b Blaze kernels by disabling the LAPACK mode in the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file.
 //
 //
 // \n \section step_1_installation Step 1: Installation
@@ -216,6 +219,10 @@
 //    instance dense matrix multiplications). In case no BLAS library is used, all linear algebra
 //    functions use the default implementations of the \b Blaze library and therefore BLAS is not a
 //    requirement for the compilation process. However, please note that performance may be limited.
+//  - <b><tt>./blaze/config/LAPACK.h</tt></b>: Via this configuration file it is possible to select
+//    whether the dense matrix inversion and the LU, Cholesky and QR decompositions are computed by
+//    means of a LAPACK library (default) or by the native, blocked \b Blaze implementations, which
+//    don't require LAPACK and which are parallelized via the \b Blaze matrix multiplication kernels.
 //  - <b><tt>./blaze/config/CacheSize.h</tt></b>: This file contains the hardware specific cache
 //    settings. \b Blaze uses this information to optimize its cache usage. For maximum performance
 //    it is recommended to adapt these setting to a specific target architecture.
@@ -1505,6 +1512,49 @@
    max( a - b - c );  // Returns 11, i.e. the largest value of the resulting vector
    \endcode
 
+// \n \subsection vector_operations_argmin_argmax argmin() / argmax()
+//
+// The \c argmin() and the \c argmax() functions return the index of the smallest and largest
+// element of the given dense vector, respectively. In case several elements compare equal, the
+// index of the first of these elements is returned:
+
+   \code
+   blaze::StaticVector<int,4UL,rowVector> a{ -5, 2, 7, 7 };
+
+   argmin( a );  // Returns 0
+   argmax( a );  // Returns 2
+   \endcode
+
+// In case the vector currently has a size of 0, both functions return 0.
+//
+//
+// \n \subsection vector_operations_reduce reduce() / sum() / prod()
+//
+// The \c sum() and \c prod() functions reduce the elements of the given dense vector by means of
+// addition and multiplication, respectively:
+
+   \code
+   blaze::StaticVector<int,4UL,rowVector> a{ 1, 2, 3, 4 };
+
+   sum( a );   // Returns 10
+   prod( a );  // Returns 24
+   \endcode
+
+// The \c reduce() function performs a reduction with an arbitrary binary operation:
+
+   \code
+   reduce( a, blaze::Add() );                        // Returns 10
+   reduce( a, []( int x, int y ){ return x * y; } );  // Returns 24
+   \endcode
+
+// All reductions work directly on vector expressions (as for instance \c sum( a + b )) without
+// creating an intermediate temporary. In case the given operation provides a \c load() function
+// for SIMD vectors (as the blaze::Add, blaze::Mult, blaze::Minimum, and blaze::Maximum functors
+// do), the reduction is vectorized, and for large vectors the reduction is executed in parallel.
+// Note that the order of evaluation is unspecified, i.e. the operation should be associative and
+// commutative. In case the vector currently has a size of 0, the reduction returns 0.
+//
+
 // \n \subsection vector_operators_abs abs()
 //
 // The \c abs() function can be used to compute the absolute values of each element of a vector.
@@ -1773,6 +1823,31 @@
 // Note that both functions can only be used for vectors with built-in or complex element type!
 //
 //
+// \n \subsection vector_operations_norms l1Norm() / l2Norm() / linfNorm() / lpNorm()
+//
+// The \c l1Norm(), \c l2Norm(), and \c linfNorm() functions compute the L1 norm, the Euclidean
+// norm, and the infinity norm of the given dense or sparse vector, respectively. The \c lpNorm()
+// function computes the Lp norm for a compile time norm parameter \a P, \c sqrNorm() computes
+// the squared L2 norm:
+
+   \code
+   blaze::DynamicVector<double> a{ 3.0, -4.0 }, b{ 1.0, 1.0 };
+
+   l1Norm( a );            // Returns 7
+   l2Norm( a );            // Returns 5
+   linfNorm( a );          // Returns 4
+   blaze::lpNorm<3>( a );  // Returns 4.49794
+   sqrNorm( a );           // Returns 25
+   l2Norm( a - b );        // Returns 5.38516
+   \endcode
+
+// For dense vectors the norms are computed by means of vectorized and parallel reductions that
+// directly work on vector expressions, i.e. in the last example no temporary vector is created
+// for the difference \c a-b. Note that in order to call \c lpNorm() with an explicit norm
+// parameter the function has to be qualified with the \c blaze namespace or be made visible
+// via a \c using declaration.
+//
+//
 // \n \subsection vector_operations_vector_transpose trans()
 //
 // As already mentioned, vectors can either be column vectors (blaze::columnVector) or row vectors
@@ -1857,8 +1932,12 @@
 //
 // The \b Blaze library currently offers four dense matrix types (\ref matrix_types_static_matrix,
 // \ref matrix_types_dynamic_matrix, \ref matrix_types_hybrid_matrix, and \ref matrix_types_custom_matrix)
-// and one sparse matrix type (\ref matrix_types_compressed_matrix). All matrices can either be
-// stored as row-major matrices or column-major matrices:
+// and two sparse matrix types (\ref matrix_types_compressed_matrix and \ref matrix_types_compact_matrix).
+// All matrices can either be stored as row-major matrices or column-major matrices. Additionally,
+// the read-only \ref matrix_types_sell_matrix type provides a row-major sparse storage format that
+// is tuned for vectorized sparse matrix/vector multiplications, the \ref
+// matrix_types_block_compressed_matrix type stores sparse matrices with a dense block structure,
+// and the \ref matrix_types_packed_matrix type stores structured square matrices in packed format:
 
    \code
    using blaze::DynamicMatrix;
@@ -2312,6 +2391,60 @@
 // \c std::invalid_argument exception is thrown.
 //
 //
+// \n \section matrix_types_packed_matrix PackedMatrix
+// <hr>
+//
+// The blaze::PackedMatrix class template is the representation of a square symmetric, Hermitian,
+// lower, upper, or diagonal dense matrix in packed storage. In contrast to the adaptors (see
+// \ref adaptors), which are based on a full \f$ N \times N \f$ matrix, a PackedMatrix only
+// stores the \f$ N(N+1)/2 \f$ elements of one triangular part (or the \f$ N \f$ diagonal
+// elements in case of a diagonal matrix) and thus requires roughly half the memory. It can be
+// included via the header file
+
+   \code
+   #include <blaze/math/PackedMatrix.h>
+   \endcode
+
+// The type of the elements, the structure, and the storage order of the matrix can be specified
+// via the three template parameters:
+
+   \code
+   template< typename Type, PackedFlag PF, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//             non-cv-qualified, non-reference, non-pointer element type.
+//  - \c PF  : specifies the structure of the matrix (blaze::packedSymmetric, blaze::packedHermitian,
+//             blaze::packedLower, blaze::packedUpper, or blaze::packedDiagonal).
+//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//             The default value is blaze::rowMajor.
+//
+// The column-major packed matrices use the packed formats of LAPACK (\c 'U' for symmetric,
+// Hermitian, and upper matrices, \c 'L' for lower matrices). As the adaptors, a PackedMatrix
+// guarantees that its structure is never violated and throws a \c std::invalid_argument
+// exception in case of an invalid assignment:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::columnMajor;
+
+   PackedMatrix<double,packedSymmetric,columnMajor> A( 1000UL );  // 500500 stored elements
+   PackedMatrix<double,packedLower> L{ { 1.0 }, { 2.0, 3.0 } };
+
+   A(0,1) = 2.0;  // Also sets A(1,0)
+   L(0,1) = 4.0;  // Invalid assignment to restricted element; results in an exception!
+   \endcode
+
+// The multiplication of a PackedMatrix with a dense vector is evaluated by dedicated kernels,
+// which traverse the packed storage exactly once. For symmetric and Hermitian matrices the
+// contributions of both triangular parts are computed in the same sweep (SPMV). All other
+// operations are evaluated via the according adaptor of a blaze::DynamicMatrix, which is also
+// the result type of all operations.
+//
+//
 // \n \section matrix_types_compressed_matrix CompressedMatrix
 // <hr>
 //
@@ -2349,6 +2482,155 @@
    blaze::CompressedMatrix<double,blaze::columnMajor> C;
    \endcode
 
+// \n \section matrix_types_compact_matrix CompactMatrix
+// <hr>
+//
+// The blaze::CompactMatrix class template is a sparse matrix with the same interface as
+// blaze::CompressedMatrix, but with a memory layout tuned for memory-bound kernels such as the
+// sparse matrix/vector multiplication. Instead of storing value/index pairs it stores the values
+// and the indices in two separate arrays and uses a configurable (per default 32-bit) index type.
+// It can be included via the header file
+
+   \code
+   #include <blaze/math/CompactMatrix.h>
+   \endcode
+
+// The type of the elements, the storage order and the index type of the matrix can be specified
+// via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CompactMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. CompactMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//             The default value is blaze::rowMajor.
+//  - \c IT  : specifies the unsigned integral type of the stored indices. The default value is
+//             \c uint32_t.
+//
+// For a double precision matrix with 32-bit indices each non-zero element occupies 12 instead
+// of 16 bytes. The price is that the number of columns of a row-major matrix (the number of rows
+// of a column-major matrix) is limited by the index type. Any attempt to create or resize a
+// matrix beyond this limit results in a \c std::invalid_argument exception:
+
+   \code
+   // Definition of a 3x4 double precision row-major matrix with 32-bit indices
+   blaze::CompactMatrix<double> A( 3UL, 4UL );
+
+   // Definition of a column-major matrix with 16-bit row indices
+   blaze::CompactMatrix<float,blaze::columnMajor,uint16_t> B( 1000UL, 100000UL );
+
+   // Throws std::invalid_argument: 70000 columns don't fit into 16-bit indices
+   blaze::CompactMatrix<float,blaze::rowMajor,uint16_t> C( 10UL, 70000UL );
+   \endcode
+
+
+// \n \section matrix_types_sell_matrix SellMatrix
+// <hr>
+//
+// The blaze::SellMatrix class template is a read-only, row-major sparse matrix in the
+// SELL-C-sigma format. The rows are grouped into slices of \c C consecutive rows, where \c C
+// is the number of elements per SIMD register, and the elements of each slice are stored
+// column by column, padded to the length of the longest row of the slice. This layout allows
+// the sparse matrix/dense vector multiplication to process \c C rows at once by means of SIMD
+// gather instructions. It can be included via the header file
+
+   \code
+   #include <blaze/math/SellMatrix.h>
+   \endcode
+
+// The type of the elements and the index type of the matrix can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class SellMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. SellMatrix can be used with any
+//             non-cv-qualified, non-reference, non-pointer element type.
+//  - \c IT  : specifies the unsigned integral type of the stored column indices. The default
+//             value is \c uint32_t.
+//
+// A SellMatrix is created from any other matrix. The optional second constructor argument
+// specifies the sorting window \c sigma: within each window of \c sigma consecutive rows the
+// rows are sorted by their number of non-zero elements in order to reduce the padding. The
+// default value of 1 preserves the original row order:
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );
+   // ... Initialization of A
+
+   blaze::SellMatrix<double> S( A, 64UL );  // Conversion with a sorting window of 64 rows
+
+   blaze::DynamicVector<double> x( 10000UL ), y;
+
+   y = S * x;           // Vectorized and parallelized sparse matrix/dense vector multiplication
+   y = trans( S ) * x;  // Multiplication with the transpose
+   \endcode
+
+// The elements of a SellMatrix cannot be modified individually. Instead, the entire matrix is
+// rebuilt by assigning another matrix. Since the conversion is comparatively expensive, the
+// SellMatrix pays off whenever the same matrix is multiplied many times, as for instance in
+// iterative solvers.
+
+
+// \n \section matrix_types_block_compressed_matrix BlockCompressedMatrix
+// <hr>
+//
+// The blaze::BlockCompressedMatrix class template is a sparse matrix in the block compressed
+// row (BCSR) or block compressed column (BCSC) format. Instead of individual elements it stores
+// dense \c B x \c B blocks, i.e. a single index per block instead of one index per element.
+// This format is well suited for matrices with a natural block structure, as for instance the
+// matrices arising from finite element discretizations with several degrees of freedom per node.
+// It can be included via the header file
+
+   \code
+   #include <blaze/math/BlockCompressedMatrix.h>
+   \endcode
+
+// The type of the elements, the block size, and the storage order of the matrix can be specified
+// via the three template parameters:
+
+   \code
+   template< typename Type, size_t B, bool SO >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c B   : specifies the number of rows and columns of the dense blocks.
+//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//             The default value is blaze::rowMajor.
+//
+// The number of rows and columns of the matrix must be multiples of \c B. The blocks are stored
+// as blaze::StaticMatrix instances and a BlockCompressedMatrix is filled block by block via the
+// reserve(), append(), and finalize() functions or converted from any other matrix:
+
+   \code
+   typedef blaze::BlockCompressedMatrix<double,3UL>  BCSR;
+
+   BCSR A( 3000UL, 3000UL );
+   A.reserve( 5000UL );  // Reserving space for 5000 blocks
+
+   BCSR::BlockType K{ { 4.0, -1.0, 0.0 }, { -1.0, 4.0, -1.0 }, { 0.0, -1.0, 4.0 } };
+   A.append( 0UL, 0UL, K );  // Appending the block K to block row 0, block column 0
+   A.append( 0UL, 1UL, K );  // Appending the block K to block row 0, block column 1
+   A.finalize( 0UL );         // Finalizing block row 0
+   // ...
+
+   blaze::DynamicVector<double> x( 3000UL ), y;
+   blaze::DynamicMatrix<double> X( 3000UL, 8UL ), Y;
+
+   y = A * x;  // Blocked sparse matrix/dense vector multiplication
+   Y = A * X;  // Blocked sparse matrix/dense matrix multiplication
+   \endcode
+
+// Within a stored block all \c B x \c B elements are accessible, including explicit zeros, and
+// can be modified via the iterators, but the sparsity pattern can only be changed block-wise.
+
 // \n Previous: \ref matrices &nbsp; &nbsp; Next: \ref matrix_operations
 */
 //*************************************************************************************************
@@ -3204,6 +3486,63 @@
    max( A - B - C );  // Returns 11, i.e. the largest value of the resulting matrix
    \endcode
 
+// \n \subsection matrix_operations_argmin_argmax argmin() / argmax()
+//
+// The \c argmin() and the \c argmax() functions return the position (i.e. the row and column
+// index) of the smallest and largest element of the given dense matrix, respectively. In case
+// several elements compare equal, the position of the first of these elements with respect to
+// the storage order of the matrix is returned:
+
+   \code
+   blaze::StaticMatrix<int,2UL,3UL,rowMajor> A{ { -5, 2, 7 },
+                                                {  4, 0, 1 } };
+
+   argmin( A );  // Returns std::pair<size_t,size_t>( 0, 0 )
+   argmax( A );  // Returns std::pair<size_t,size_t>( 0, 2 )
+   \endcode
+
+// In case the matrix currently has 0 rows or 0 columns, both functions return (0,0).
+//
+//
+// \n \subsection matrix_operations_reduce reduce() / sum() / prod()
+//
+// The \c sum() and \c prod() functions reduce the elements of the given dense matrix by means of
+// addition and multiplication, respectively. The \c reduce() function performs a reduction with
+// an arbitrary binary operation:
+
+   \code
+   blaze::StaticMatrix<int,2UL,2UL,rowMajor> A{ { 1, 2 },
+                                                { 3, 4 } };
+
+   sum( A );                                          // Returns 10
+   prod( A );                                         // Returns 24
+   reduce( A, []( int x, int y ){ return x + y; } );  // Returns 10
+   \endcode
+
+// As for vectors, the reductions work directly on matrix expressions, are vectorized for the
+// blaze::Add, blaze::Mult, blaze::Minimum, and blaze::Maximum functors, and are executed in
+// parallel for large matrices. In case the matrix currently has 0 rows or 0 columns, the
+// reduction returns 0.
+//
+//
+// \n \subsection matrix_operations_frobenius_norm frobeniusNorm()
+//
+// The \c frobeniusNorm() function computes the Frobenius norm of the given dense or sparse matrix
+// (i.e. the square root of the sum of the squared absolute values of all elements), \c sqrNorm()
+// computes the squared Frobenius norm:
+
+   \code
+   blaze::DynamicMatrix<double> A{ { 1.0, 2.0 }, { 2.0, 4.0 } }, B{ { 1.0, 1.0 }, { 1.0, 1.0 } };
+
+   frobeniusNorm( A );      // Returns 5
+   sqrNorm( A );            // Returns 25
+   frobeniusNorm( A - B );  // Returns 3.31662
+   \endcode
+
+// For dense matrices the computation is vectorized and executed in parallel for large matrices,
+// and it directly works on matrix expressions without creating a temporary matrix.
+//
+
 // \n \subsection matrix_operators_abs abs()
 //
 // The \c abs() function can be used to compute the absolute values of each element of a matrix.
@@ -3670,6 +4009,45 @@
 // exception is thrown the matrix may already have been modified.
 //
 //
+// \n \section matrix_operations_linear_systems Linear Systems
+// <hr>
+//
+// Linear systems of equations \f$ A*x=b \f$ or \f$ A*X=B \f$ with a square dense system matrix
+// should not be solved via the explicit inverse of the system matrix (i.e. via \c inv(A)*b),
+// but by means of the \c solve() function:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A, X, B;
+   blaze::DynamicVector<double,blaze::columnVector> x, b;
+   // ... Resizing and initialization
+   x = solve( A, b );  // Solution of A*x=b
+   X = solve( A, B );  // Solution of A*X=B for all columns of B
+   solve( A, x, b );   // Equivalent function call
+   \endcode
+
+// Analogous to the matrix inversion, the most suited decomposition is automatically selected
+// depending on the type of the system matrix: Triangular and diagonal matrices are solved by a
+// single substitution, symmetric and Hermitian matrices are solved by means of a Cholesky
+// decomposition (with a fallback to a Bunch-Kaufman decomposition for indefinite matrices), and
+// all other matrices are solved by means of an LU decomposition. In case the same system matrix
+// is used for several linear systems, the decomposition can be computed once via the \c factorize()
+// function and reused for any number of right-hand sides:
+
+   \code
+   const blaze::Factorization< blaze::DynamicMatrix<double> > F( factorize( A ) );
+
+   solve( F, x, b );  // Forward and back substitution only
+   \endcode
+
+// In case the system matrix is not a square matrix or the size of the right-hand side does not
+// match, a \c std::invalid_argument exception is thrown. In case the system matrix is singular,
+// a \c std::runtime_error exception is thrown.
+//
+// \note The solution of linear systems can only be used for dense matrices with \c float,
+// \c double, \c complex<float> or \c complex<double> element type. Unless the LAPACK mode is
+// disabled, the fitting LAPACK library has to be linked to the executable.
+//
+//
 // \n \section matrix_operations_decomposition Matrix Decomposition
 // <hr>
 //
@@ -3888,6 +4266,46 @@
    lq( A, L, Q );  // LQ decomposition of A
    \endcode
 
+// \n \section matrix_operations_eigenvalues Eigenvalues and Singular Values
+// <hr>
+//
+// The eigenvalues and eigenvectors of a dense Hermitian (or real symmetric) matrix can be computed
+// via the \c eigen() function. The real eigenvalues are returned in ascending order and the
+// columns of \c V contain the according orthonormal eigenvectors:
+
+   \code
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > A;
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::DynamicMatrix<double,blaze::rowMajor> V;
+
+   eigen( A, w );     // Computing only the eigenvalues of A
+   eigen( A, w, V );  // Computing the eigenvalues and eigenvectors of A
+   \endcode
+
+// In case the given matrix is neither a SymmetricMatrix nor a HermitianMatrix adaptor and is not
+// symmetric (or Hermitian) at runtime, a \c std::invalid_argument exception is thrown. The
+// singular value decomposition of a general m-by-n dense matrix can be computed via the \c svd()
+// function. With \c k=min(m,n), the \c k singular values are returned in descending order, the
+// m-by-k matrix \c U contains the left singular vectors and the k-by-n matrix \c V contains the
+// (conjugate transposed) right singular vectors:
+
+   \code
+   blaze::DynamicMatrix<complex<double>,blaze::columnMajor> A, U, V;
+   blaze::DynamicVector<double,blaze::columnVector> s;
+   // ... Resizing and initialization
+
+   svd( A, s );        // Computing only the singular values of A
+   svd( A, U, s, V );  // Computing the singular value decomposition A = U * diag(s) * V
+   \endcode
+
+// Large matrices are handled by the divide and conquer LAPACK kernels \c syevd(), \c heevd() and
+// \c gesdd(). Fixed size matrices of up to 6x6 elements (as for instance the 3x3 covariance
+// matrices of a principal component analysis or the Kabsch algorithm) are handled by native Jacobi
+// kernels, which don't require any dynamic memory allocation. In case the LAPACK mode is disabled,
+// the Jacobi kernels are used for all matrices and LAPACK is not a requirement.
+//
 // \n Previous: \ref matrix_types &nbsp; &nbsp; Next: \ref adaptors
 */
 //*************************************************************************************************
@@ -8313,6 +8731,10 @@
 // order to achieve the maximum possible performance, it is imperative to initialize the memory
 // according to the later use of the data structures.
 //
+// Alternatively, the first-touch policy can be selected in the <tt>./blaze/config/NUMA.h</tt>
+// configuration file (see \ref numa_policy), in which case \b Blaze performs the first
+// initialization of dense vectors and matrices in parallel.
+//
 //
 // \n \section openmp_limitations Limitations of the OpenMP Parallelization
 // <hr>
@@ -8484,6 +8906,44 @@
 // threads.
 //
 //
+// \n \section cpp_threads_affinity C++11 Thread Affinity
+// <hr>
+//
+// By default, the operating system is free to migrate the threads between cores, which may
+// destroy the cache locality between subsequent operations. Therefore it is possible to pin
+// the threads to specific cores, either via the environment variable \c BLAZE_THREAD_AFFINITY
+
+   \code
+   export BLAZE_THREAD_AFFINITY=compact  // Consecutive threads on neighboring cores
+   export BLAZE_THREAD_AFFINITY=scatter  // Threads distributed across all sockets and cores
+   export BLAZE_THREAD_AFFINITY=0,2,4-7  // Explicit list of cores
+   \endcode
+
+// or alternatively via the \c setThreadAffinity() function:
+
+   \code
+   blaze::setThreadAffinity( "scatter" );
+   blaze::setThreadAffinity( std::vector<int>{ 0, 2, 4, 6 } );
+   \endcode
+
+// In both cases the i-th thread is pinned to the (i%n)-th of the n specified cores, which also
+// applies to threads added later on via \c setNumThreads(). The \c compact policy places
+// consecutive threads on the hardware threads and cores sharing the largest part of the cache
+// hierarchy, the \c scatter policy distributes the threads round-robin across all sockets and
+// physical cores and uses additional hardware threads only in case all physical cores are in
+// use. The policy \c none (or an empty list of cores) removes the pinning. The current placement
+// of the threads can be queried via the \c getThreadAffinity() function:
+
+   \code
+   const std::vector<int> cores = blaze::getThreadAffinity();  // -1 for threads not pinned
+   \endcode
+
+// Please note that thread pinning is currently only supported on Linux systems. On all other
+// systems the affinity settings have no effect. Also note that an invalid setting of the
+// environment variable is ignored, whereas the \c setThreadAffinity() function throws a
+// \c std::invalid_argument exception in case of an invalid policy or core.
+//
+//
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
 //
@@ -8588,7 +9048,8 @@
    \endcode
 
 // In the context of Boost threads, the function will return the previously specified number of
-// threads.
+// threads. The Boost threads can be pinned to specific cores in the same way as the C++11
+// threads (see \ref cpp_threads_affinity).
 //
 //
 // \n \section boost_threads_configuration Boost Thread Configuration
@@ -10404,6 +10865,25 @@
 // thread-based parallelization, are contained within the configuration file
 // <tt>./blaze/config/Thresholds.h</tt>.
 //
+// By default, all thresholds are compile time constants. In case the
+// \c BLAZE_USE_RUNTIME_THRESHOLDS switch in the configuration file is activated, the settings
+// in the configuration file only represent the defaults of the thresholds. In this case all
+// thresholds can be adapted at runtime via a threshold profile, via environment variables, or
+// programmatically:
+
+   \code
+   export BLAZE_THRESHOLD_PROFILE=thresholds.txt   // Loading a threshold profile at startup
+   export BLAZE_SMP_DVECASSIGN_THRESHOLD=50000     // Setting an individual threshold
+   \endcode
+
+   \code
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 50000UL );
+   blaze::loadThresholds( "thresholds.txt" );
+   \endcode
+
+// A threshold profile for the target platform can be generated by the \c autotune tool of
+// the \b Blaze benchmark suite (see the blaze::Threshold class for more details).
+//
 //
 // \n \section padding Padding
 // <hr>
@@ -10447,6 +10927,27 @@
 // whether streaming is beneficial or hurtful for performance.
 //
 //
+// \n \section numa_policy NUMA Placement
+// <hr>
+//
+// On ccNUMA architectures the operating system maps every memory page into the locality domain
+// (LD) of the thread that first writes to it. By default, dense vectors and matrices are
+// initialized by the allocating thread, and therefore all their memory pages are mapped into a
+// single LD (see \ref openmp_first_touch). The configuration file <tt>./blaze/config/NUMA.h</tt>
+// provides a compile time switch to select a different placement policy:
+
+   \code
+   #define BLAZE_NUMA_POLICY 0
+   \endcode
+
+// In case the policy is set to 1 (first-touch) and one of the shared memory parallelizations
+// is active, DynamicVector and DynamicMatrix of built-in data type initialize their elements
+// in parallel, using the same partitioning and the same threads as the parallel assignment
+// kernels. In case the policy is set to 2 (interleave), the memory pages of all large dense
+// arrays are distributed round-robin across all available LDs (Linux only). The default (0)
+// does not perform any NUMA specific placement.
+//
+//
 // \n Previous: \ref lapack_functions &nbsp; &nbsp; Next: \ref block_vectors_and_matrices \n
 */
 //*************************************************************************************************
@@ -48,4 +48,30 @@ namespace blaze {
 constexpr size_t cacheSize = 3145728UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Size of the level 1 data cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the level 1 data cache (per core) in Byte of the used target
+// architecture. It is used in combination with the level 2 cache size and the general cache size
+// to determine the blocking of cache-aware kernels (as for instance the dense matrix/dense matrix
+// multiplication). In case the cache sizes can be queried at runtime, the queried values take
+// precedence over this setting.
+*/
+constexpr size_t l1CacheSize = 32768UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of the level 2 cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the level 2 cache (per core) in Byte of the used target
+// architecture. In case the cache sizes can be queried at runtime, the queried value takes
+// precedence over this setting.
+*/
+constexpr size_t l2CacheSize = 262144UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -0,0 +1,73 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/NUMA.h
+//  \brief Configuration of the NUMA policy
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA policy.
+// \ingroup config
+//
+// This compilation switch selects the placement policy for the memory of dense vectors and
+// matrices (see the DynamicVector and DynamicMatrix class templates) on systems with non-uniform
+// memory access (NUMA), i.e. on systems with several sockets. By default, the elements of a
+// vector or matrix are initialized by the thread that creates the vector or matrix. Since most
+// operating systems place a memory page on the NUMA node of the thread that first writes to it,
+// all elements end up on a single node and all threads running on other sockets access remote
+// memory during the subsequent SMP assignments. The following policies are available:
+//
+//  - Default    : \b 0 (default) All elements are initialized by the creating thread.
+//  - First-touch: \b 1 The elements are initialized in parallel, using the same partitioning
+//                      of the elements among the threads as the SMP assignments. Additionally,
+//                      each partition is always processed by the same thread, i.e. the OpenMP
+//                      assignments use a static schedule and the C++11/Boost thread pool assigns
+//                      the i-th partition to the i-th thread. In combination with thread pinning
+//                      (e.g. via \c OMP_PROC_BIND or the thread affinity of the thread pool),
+//                      every thread predominantly works on memory local to its socket. Note
+//                      that this policy only takes effect in case a shared memory
+//                      parallelization is active.
+//  - Interleave : \b 2 The memory pages of large arrays are distributed round-robin among all
+//                      NUMA nodes available to the process. This policy does not depend on the
+//                      partitioning and is the preferred choice in case the same vectors or
+//                      matrices are used with varying thread counts or from several threads.
+//                      Note that this policy is only available on Linux and has no effect on
+//                      other systems.
+//
+// Note that changing the setting of the NUMA policy requires a recompilation of all code using
+// the Blaze library. Alternatively, the policy can be set via the command line of the compiler
+// (for instance \c -DBLAZE_NUMA_POLICY=1), in which case the setting in this file is ignored.
+*/
+#ifndef BLAZE_NUMA_POLICY
+#define BLAZE_NUMA_POLICY 0
+#endif
+//*************************************************************************************************
@@ -1214,9 +1214,13 @@ constexpr size_t SMP_TSMATTDMATMULT_USER_THRESHOLD = 4356UL;
 // \ingroup config
 //
 // This threshold specifies when a row-major sparse matrix/row-major sparse matrix multiplication
-// can be executed in parallel. In case the number of elements of the target matrix is larger
-// or equal to this threshold, the operation is executed in parallel. If the number of elements
-// is below this threshold the operation is executed single-threaded.
+// can be executed in parallel. The threshold is checked twice: In case the number of elements
+// of the target matrix is larger or equal to this threshold, the operands are evaluated for
+// a parallel execution. Subsequently, the estimated number of scalar multiplications of the
+// product (i.e. the sum of the number of non-zero elements of all rows of the right-hand side
+// operand that are referenced by the non-zero elements of the left-hand side operand) is
+// compared to this threshold. Only in case both values are larger or equal to this threshold,
+// the operation is executed in parallel. Otherwise the operation is executed single-threaded.
 //
 // Please note that this threshold is highly sensitiv to the used system architecture and the
 // shared memory parallelization technique. Therefore the default value cannot guarantee maximum
@@ -1226,8 +1230,8 @@ constexpr size_t SMP_TSMATTDMATMULT_USER_THRESHOLD = 4356UL;
 // and Boost thread parallelization.
 //
 // The default setting for this threshold is 22500 (which corresponds to a matrix size of
-// \f$ 150 \times 150 \f$). In case the threshold is set to 0, the operation is unconditionally
-// executed in parallel.
+// \f$ 150 \times 150 \f$ and to for instance 150 rows with 150 scalar multiplications each).
+// In case the threshold is set to 0, the operation is unconditionally executed in parallel.
 */
 constexpr size_t SMP_SMATSMATMULT_USER_THRESHOLD = 22500UL;
 //*************************************************************************************************
@@ -1328,4 +1332,112 @@ constexpr size_t SMP_TSMATTSMATMULT_USER_THRESHOLD = 22500UL;
 constexpr size_t SMP_DVECTDVECMULT_USER_THRESHOLD = 84100UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the reduction of a dense vector (as for instance performed by
+// the \c sum(), \c prod(), \c min(), and \c max() functions) can be executed in parallel. In
+// case the number of elements of the dense vector is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_DVECREDUCE_USER_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the reduction of a dense matrix (as for instance performed by
+// the \c sum(), \c prod(), \c min(), and \c max() functions) can be executed in parallel. In
+// case the number of elements of the dense matrix is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 48400 (which corresponds to a matrix size of
+// \f$ 220 \times 220 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+*/
+constexpr size_t SMP_DMATREDUCE_USER_THRESHOLD = 48400UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batch operation threshold.
+// \ingroup config
+//
+// This threshold specifies when a batched operation on many small matrices and vectors (as for
+// instance performed by the \c batchMult() function) can be executed in parallel. In case the
+// number of matrices or vectors of the batch is larger or equal to this threshold, the operation
+// is executed in parallel. If the number of matrices or vectors is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 4096. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+constexpr size_t SMP_BATCH_USER_THRESHOLD = 4096UL;
+//*************************************************************************************************
+
 } // namespace blaze
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for runtime adjustable thresholds.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime adjustment of all thresholds. By default,
+// all thresholds are compile time constants that are set via this configuration file, which
+// enables the compiler to fold all threshold comparisons for small, fixed-size operands. In
+// case the switch is set to 1, all thresholds are represented by blaze::Threshold handles, whose
+// values can be changed at runtime via threshold profiles, via environment variables, or via
+// the blaze::setThreshold() and blaze::loadThresholds() functions (see the blaze::Threshold
+// class for more details). Note that in this case every threshold comparison requires a load
+// of the current value of the threshold. Also note that the switch has to be set consistently
+// for all translation units of a program.
+//
+// Possible settings for the runtime threshold switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// Alternatively, the switch can be set via the command line of the compiler (for instance
+// \c -DBLAZE_USE_RUNTIME_THRESHOLDS=1), in which case the setting in this file is ignored.
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
@@ -52,3 +52,33 @@
 */
 #define BLAZE_USE_VECTORIZATION 1
 //*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch of SIMD kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime dispatch of several performance critical
+// kernels. By default, the SIMD instruction set used by the Blaze library is fixed at compile
+// time (see \c BLAZE_USE_VECTORIZATION). In case the switch is set to 1, additional versions
+// of the dense vector assignment kernels, the dense matrix/dense vector multiplication kernels
+// and the small dense matrix/dense matrix multiplication kernels are compiled for the AVX2 and
+// AVX-512 instruction sets. The best version for the executing CPU is selected once at program
+// startup. This allows to build a single executable for the lowest common instruction set of
+// all target machines, which still makes use of the widest SIMD units on each machine. The
+// selected instruction set can be queried via the blaze::getInstructionSet() function. Note
+// that the runtime dispatch is only available for the GNU and Clang compilers on x86 platforms
+// and only affects single and double precision floating point operations.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// Alternatively, the switch can be set via the command line of the compiler (for instance
+// \c -DBLAZE_USE_RUNTIME_DISPATCH=1), in which case the setting in this file is ignored.
+*/
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#define BLAZE_USE_RUNTIME_DISPATCH 0
+#endif
+//*************************************************************************************************
@@ -41,22 +41,30 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/Eigen.h>
+#include <blaze/math/dense/Factorization.h>
 #include <blaze/math/dense/Inversion.h>
 #include <blaze/math/dense/LLH.h>
 #include <blaze/math/dense/LQ.h>
+#include <blaze/math/dense/LSE.h>
 #include <blaze/math/dense/LU.h>
 #include <blaze/math/dense/QL.h>
 #include <blaze/math/dense/QR.h>
 #include <blaze/math/dense/RQ.h>
+#include <blaze/math/dense/SVD.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DMatDetExpr.h>
 #include <blaze/math/expressions/DMatDMatAddExpr.h>
 #include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/math/expressions/DMatDMatSolveExpr.h>
 #include <blaze/math/expressions/DMatDMatSubExpr.h>
 #include <blaze/math/expressions/DMatDVecMultExpr.h>
+#include <blaze/math/expressions/DMatDVecSolveExpr.h>
 #include <blaze/math/expressions/DMatEvalExpr.h>
 #include <blaze/math/expressions/DMatForEachExpr.h>
 #include <blaze/math/expressions/DMatInvExpr.h>
+#include <blaze/math/expressions/DMatNormExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/DMatScalarDivExpr.h>
 #include <blaze/math/expressions/DMatScalarMultExpr.h>
 #include <blaze/math/expressions/DMatSerialExpr.h>
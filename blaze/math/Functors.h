@@ -43,6 +43,7 @@
 #include <blaze/math/functors/Abs.h>
 #include <blaze/math/functors/Acos.h>
 #include <blaze/math/functors/Acosh.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Asin.h>
 #include <blaze/math/functors/Asinh.h>
 #include <blaze/math/functors/Atan.h>
@@ -65,11 +66,15 @@
 #include <blaze/math/functors/InvSqrt.h>
 #include <blaze/math/functors/Log.h>
 #include <blaze/math/functors/Log10.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/functors/Pow.h>
 #include <blaze/math/functors/Real.h>
 #include <blaze/math/functors/Serial.h>
 #include <blaze/math/functors/Sin.h>
 #include <blaze/math/functors/Sinh.h>
+#include <blaze/math/functors/SqrAbs.h>
 #include <blaze/math/functors/Sqrt.h>
 #include <blaze/math/functors/Tan.h>
 #include <blaze/math/functors/Tanh.h>
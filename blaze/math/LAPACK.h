@@ -45,10 +45,12 @@
 #include <blaze/math/lapack/geqp3.h>
 #include <blaze/math/lapack/geqrf.h>
 #include <blaze/math/lapack/gerqf.h>
+#include <blaze/math/lapack/gesdd.h>
 #include <blaze/math/lapack/gesv.h>
 #include <blaze/math/lapack/getrf.h>
 #include <blaze/math/lapack/getri.h>
 #include <blaze/math/lapack/getrs.h>
+#include <blaze/math/lapack/heevd.h>
 #include <blaze/math/lapack/hesv.h>
 #include <blaze/math/lapack/hetrf.h>
 #include <blaze/math/lapack/hetri.h>
@@ -65,6 +67,7 @@
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/lapack/potri.h>
 #include <blaze/math/lapack/potrs.h>
+#include <blaze/math/lapack/syevd.h>
 #include <blaze/math/lapack/sysv.h>
 #include <blaze/math/lapack/sytrf.h>
 #include <blaze/math/lapack/sytri.h>
@@ -0,0 +1,80 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedFlag.h
+//  \brief Header file for the packed matrix storage flags
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKEDFLAG_H_
+#define _BLAZE_MATH_PACKEDFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED STORAGE FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Packed storage flag.
+// \ingroup dense_matrix
+//
+// The PackedFlag type enumeration represents the different kinds of structured square matrices
+// that can be stored in packed format by the PackedMatrix class template. The flag determines
+// which elements are stored explicitly and how the remaining elements are represented:
+//
+//  - \c packedSymmetric: The matrix is symmetric (\f$ A = A^T \f$). Only the diagonal and one
+//          triangular part of the matrix are stored; the elements of the other triangular part
+//          refer to the same values.
+//  - \c packedHermitian: The matrix is Hermitian (\f$ A = \overline{A^T} \f$). Only the diagonal
+//          and one triangular part of the matrix are stored; the elements of the other triangular
+//          part represent the complex conjugates of the stored values.
+//  - \c packedLower: The matrix is lower triangular. Only the diagonal and the lower part of the
+//          matrix are stored, the upper part is restricted to zero.
+//  - \c packedUpper: The matrix is upper triangular. Only the diagonal and the upper part of the
+//          matrix are stored, the lower part is restricted to zero.
+//  - \c packedDiagonal: The matrix is diagonal. Only the diagonal elements are stored, all
+//          other elements are restricted to zero.
+*/
+enum PackedFlag
+{
+   packedSymmetric = 0,  //!< Flag for packed symmetric matrices.
+   packedHermitian = 1,  //!< Flag for packed Hermitian matrices.
+   packedLower     = 2,  //!< Flag for packed lower triangular matrices.
+   packedUpper     = 3,  //!< Flag for packed upper triangular matrices.
+   packedDiagonal  = 4   //!< Flag for packed diagonal matrices.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,660 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedMatrix.h
+//  \brief Header file for the complete PackedMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKEDMATRIX_H_
+#define _BLAZE_MATH_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/dense/PackedMult.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/SparseVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for PackedMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of PackedMatrix. The random
+// matrices are created as instances of the according adaptor (SymmetricMatrix, HermitianMatrix,
+// LowerMatrix, UpperMatrix, or DiagonalMatrix) and converted afterwards.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO >      // Storage order
+class Rand< PackedMatrix<Type,PF,SO> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const PackedMatrix<Type,PF,SO> generate( size_t n ) const;
+
+   template< typename Arg >
+   inline const PackedMatrix<Type,PF,SO> generate( size_t n, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( PackedMatrix<Type,PF,SO>& matrix ) const;
+
+   template< typename Arg >
+   inline void randomize( PackedMatrix<Type,PF,SO>& matrix, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef ResultType_< PackedMatrix<Type,PF,SO> >  RT;  //!< Adaptor type of the random matrices.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PackedMatrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO >      // Storage order
+inline const PackedMatrix<Type,PF,SO>
+   Rand< PackedMatrix<Type,PF,SO> >::generate( size_t n ) const
+{
+   return PackedMatrix<Type,PF,SO>( blaze::rand<RT>( n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PackedMatrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , PackedFlag PF   // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename Arg >  // Min/max argument type
+inline const PackedMatrix<Type,PF,SO>
+   Rand< PackedMatrix<Type,PF,SO> >::generate( size_t n, const Arg& min, const Arg& max ) const
+{
+   return PackedMatrix<Type,PF,SO>( blaze::rand<RT>( n, min, max ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PackedMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO >      // Storage order
+inline void Rand< PackedMatrix<Type,PF,SO> >::randomize( PackedMatrix<Type,PF,SO>& matrix ) const
+{
+   matrix = blaze::rand<RT>( matrix.rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PackedMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , PackedFlag PF   // Structure of the matrix
+        , bool SO >       // Storage order
+template< typename Arg >  // Min/max argument type
+inline void Rand< PackedMatrix<Type,PF,SO> >::randomize( PackedMatrix<Type,PF,SO>& matrix,
+                                                         const Arg& min, const Arg& max ) const
+{
+   matrix = blaze::rand<RT>( matrix.rows(), min, max );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given value can be stored at the given position of a packed matrix.
+// \ingroup packed_matrix
+//
+// \param value The value to be checked.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the value preserves the structure of the matrix, \a false if not.
+*/
+template< PackedFlag PF  // Structure of the matrix
+        , typename T >   // Type of the value
+inline bool isPackedAssignable( const T& value, size_t i, size_t j )
+{
+   switch( PF ) {
+      case packedSymmetric: return true;
+      case packedHermitian: return ( i != j || isReal( value ) );
+      case packedLower    : return ( i >= j || isDefault( value ) );
+      case packedUpper    : return ( i <= j || isDefault( value ) );
+      case packedDiagonal : return ( i == j || isDefault( value ) );
+      default: BLAZE_INTERNAL_ASSERT( false, "Unhandled packed matrix structure" );
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the assignment of a dense vector to a packed matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side dense vector to be assigned.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO        // Storage order
+        , typename VT    // Type of the right-hand side dense vector
+        , bool TF >      // Transpose flag of the right-hand side dense vector
+inline bool tryAssign( const PackedMatrix<Type,PF,SO>& lhs,
+                       const DenseVector<VT,TF>& rhs, size_t row, size_t column )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+
+   BLAZE_INTERNAL_ASSERT( row <= lhs.rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( column <= lhs.columns(), "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( TF || (~rhs).size() <= lhs.rows() - row, "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( !TF || (~rhs).size() <= lhs.columns() - column, "Invalid number of columns" );
+
+   UNUSED_PARAMETER( lhs );
+
+   if( PF == packedSymmetric )
+      return true;
+
+   for( size_t k=0UL; k<(~rhs).size(); ++k ) {
+      if( !isPackedAssignable<PF>( (~rhs)[k], ( TF )?( row ):( row+k ), ( TF )?( column+k ):( column ) ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the assignment of a sparse vector to a packed matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side sparse vector to be assigned.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO        // Storage order
+        , typename VT    // Type of the right-hand side sparse vector
+        , bool TF >      // Transpose flag of the right-hand side sparse vector
+inline bool tryAssign( const PackedMatrix<Type,PF,SO>& lhs,
+                       const SparseVector<VT,TF>& rhs, size_t row, size_t column )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+
+   BLAZE_INTERNAL_ASSERT( row <= lhs.rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( column <= lhs.columns(), "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( TF || (~rhs).size() <= lhs.rows() - row, "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( !TF || (~rhs).size() <= lhs.columns() - column, "Invalid number of columns" );
+
+   UNUSED_PARAMETER( lhs );
+
+   typedef ConstIterator_<VT>  RhsIterator;
+
+   if( PF == packedSymmetric )
+      return true;
+
+   for( RhsIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element ) {
+      const size_t k( element->index() );
+      if( !isPackedAssignable<PF>( element->value(), ( TF )?( row ):( row+k ), ( TF )?( column+k ):( column ) ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the assignment of a dense matrix to a packed matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO1       // Storage order of the left-hand side packed matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline bool tryAssign( const PackedMatrix<Type,PF,SO1>& lhs,
+                       const DenseMatrix<MT,SO2>& rhs, size_t row, size_t column )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
+
+   BLAZE_INTERNAL_ASSERT( row <= lhs.rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( column <= lhs.columns(), "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() <= lhs.rows() - row, "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( (~rhs).columns() <= lhs.columns() - column, "Invalid number of columns" );
+
+   UNUSED_PARAMETER( lhs );
+
+   const size_t M( (~rhs).rows()    );
+   const size_t N( (~rhs).columns() );
+
+   if( PF == packedSymmetric || PF == packedHermitian )
+   {
+      if( ( row + M <= column ) || ( column + N <= row ) )
+         return true;
+
+      const bool   lower( row > column );
+      const size_t size ( min( row + M, column + N ) - ( lower ? row : column ) );
+
+      if( size < 2UL )
+         return PF == packedSymmetric || isReal( (~rhs)( lower ? 0UL : column - row, lower ? row - column : 0UL ) );
+
+      const size_t subrow( lower ? 0UL : column - row );
+      const size_t subcol( lower ? row - column : 0UL );
+
+      if( PF == packedSymmetric )
+         return isSymmetric( submatrix( ~rhs, subrow, subcol, size, size ) );
+      else
+         return isHermitian( submatrix( ~rhs, subrow, subcol, size, size ) );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( !isPackedAssignable<PF>( (~rhs)(i,j), row+i, column+j ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the assignment of a sparse matrix to a packed matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO1       // Storage order of the left-hand side packed matrix
+        , typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline bool tryAssign( const PackedMatrix<Type,PF,SO1>& lhs,
+                       const SparseMatrix<MT,SO2>& rhs, size_t row, size_t column )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
+
+   BLAZE_INTERNAL_ASSERT( row <= lhs.rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( column <= lhs.columns(), "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() <= lhs.rows() - row, "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( (~rhs).columns() <= lhs.columns() - column, "Invalid number of columns" );
+
+   UNUSED_PARAMETER( lhs );
+
+   typedef ConstIterator_<MT>  RhsIterator;
+
+   const size_t M( (~rhs).rows()    );
+   const size_t N( (~rhs).columns() );
+
+   if( PF == packedSymmetric || PF == packedHermitian )
+   {
+      if( ( row + M <= column ) || ( column + N <= row ) )
+         return true;
+
+      const bool   lower( row > column );
+      const size_t size ( min( row + M, column + N ) - ( lower ? row : column ) );
+
+      if( size < 2UL )
+         return PF == packedSymmetric || isReal( (~rhs)( lower ? 0UL : column - row, lower ? row - column : 0UL ) );
+
+      const size_t subrow( lower ? 0UL : column - row );
+      const size_t subcol( lower ? row - column : 0UL );
+
+      if( PF == packedSymmetric )
+         return isSymmetric( submatrix( ~rhs, subrow, subcol, size, size ) );
+      else
+         return isHermitian( submatrix( ~rhs, subrow, subcol, size, size ) );
+   }
+
+   for( size_t k=0UL; k<( SO2 ? N : M ); ++k ) {
+      for( RhsIterator element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         if( !isPackedAssignable<PF>( element->value(), row+i, column+j ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the addition assignment of a vector to a packed matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side vector to be added.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO        // Storage order
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+inline bool tryAddAssign( const PackedMatrix<Type,PF,SO>& lhs,
+                          const Vector<VT,TF>& rhs, size_t row, size_t column )
+{
+   return tryAssign( lhs, ~rhs, row, column );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the addition assignment of a matrix to a packed matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side matrix to be added.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO1       // Storage order of the left-hand side packed matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline bool tryAddAssign( const PackedMatrix<Type,PF,SO1>& lhs,
+                          const Matrix<MT,SO2>& rhs, size_t row, size_t column )
+{
+   return tryAssign( lhs, ~rhs, row, column );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the subtraction assignment of a vector to a packed
+//        matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side vector to be subtracted.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO        // Storage order
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+inline bool trySubAssign( const PackedMatrix<Type,PF,SO>& lhs,
+                          const Vector<VT,TF>& rhs, size_t row, size_t column )
+{
+   return tryAssign( lhs, ~rhs, row, column );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the subtraction assignment of a matrix to a packed
+//        matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO1       // Storage order of the left-hand side packed matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline bool trySubAssign( const PackedMatrix<Type,PF,SO1>& lhs,
+                          const Matrix<MT,SO2>& rhs, size_t row, size_t column )
+{
+   return tryAssign( lhs, ~rhs, row, column );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the multiplication assignment of a vector to a packed
+//        matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side vector to be multiplied.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Since restricted elements of a triangular or diagonal packed matrix are
+// zero, only the diagonal of a Hermitian packed matrix can be violated by the multiplication.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO        // Storage order
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+inline bool tryMultAssign( const PackedMatrix<Type,PF,SO>& lhs,
+                           const Vector<VT,TF>& rhs, size_t row, size_t column )
+{
+   return PF != packedHermitian || tryAssign( lhs, ~rhs, row, column );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Predict invariant violations by the division assignment of a vector to a packed matrix.
+// \ingroup packed_matrix
+//
+// \param lhs The target left-hand side packed matrix.
+// \param rhs The right-hand side vector divisor.
+// \param row The row index of the first element to be modified.
+// \param column The column index of the first element to be modified.
+// \return \a true in case the assignment would be successful, \a false if not.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Structure of the matrix
+        , bool SO        // Storage order
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+inline bool tryDivAssign( const PackedMatrix<Type,PF,SO>& lhs,
+                          const Vector<VT,TF>& rhs, size_t row, size_t column )
+{
+   return PF != packedHermitian || tryAssign( lhs, ~rhs, row, column );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,275 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SellMatrix.h
+//  \brief Header file for the complete SellMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SELLMATRIX_H_
+#define _BLAZE_MATH_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SellMatrix.h>
+#include <blaze/math/sparse/SellMult.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for SellMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of SellMatrix. Since the
+// SellMatrix cannot be modified, the random matrices are created as CompressedMatrix instances
+// and converted afterwards, retaining the size of the sorting window of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+class Rand< SellMatrix<Type,IT> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const SellMatrix<Type,IT> generate( size_t m, size_t n ) const;
+   inline const SellMatrix<Type,IT> generate( size_t m, size_t n, size_t nonzeros ) const;
+
+   template< typename Arg >
+   inline const SellMatrix<Type,IT> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline const SellMatrix<Type,IT> generate( size_t m, size_t n, size_t nonzeros,
+                                              const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( SellMatrix<Type,IT>& matrix ) const;
+   inline void randomize( SellMatrix<Type,IT>& matrix, size_t nonzeros ) const;
+
+   template< typename Arg >
+   inline void randomize( SellMatrix<Type,IT>& matrix, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline void randomize( SellMatrix<Type,IT>& matrix, size_t nonzeros,
+                          const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SellMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline const SellMatrix<Type,IT>
+   Rand< SellMatrix<Type,IT> >::generate( size_t m, size_t n ) const
+{
+   return SellMatrix<Type,IT>( blaze::rand< CompressedMatrix<Type,false> >( m, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SellMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \return The generated random matrix.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline const SellMatrix<Type,IT>
+   Rand< SellMatrix<Type,IT> >::generate( size_t m, size_t n, size_t nonzeros ) const
+{
+   return SellMatrix<Type,IT>( blaze::rand< CompressedMatrix<Type,false> >( m, n, nonzeros ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SellMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename IT >   // Index type
+template< typename Arg >  // Min/max argument type
+inline const SellMatrix<Type,IT>
+   Rand< SellMatrix<Type,IT> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+{
+   return SellMatrix<Type,IT>( blaze::rand< CompressedMatrix<Type,false> >( m, n, min, max ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random SellMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type   // Data type of the matrix
+        , typename IT >   // Index type
+template< typename Arg >  // Min/max argument type
+inline const SellMatrix<Type,IT>
+   Rand< SellMatrix<Type,IT> >::generate( size_t m, size_t n, size_t nonzeros,
+                                          const Arg& min, const Arg& max ) const
+{
+   return SellMatrix<Type,IT>( blaze::rand< CompressedMatrix<Type,false> >( m, n, nonzeros, min, max ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SellMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void Rand< SellMatrix<Type,IT> >::randomize( SellMatrix<Type,IT>& matrix ) const
+{
+   matrix = blaze::rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SellMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void Rand< SellMatrix<Type,IT> >::randomize( SellMatrix<Type,IT>& matrix, size_t nonzeros ) const
+{
+   matrix = blaze::rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns(), nonzeros );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SellMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename IT >   // Index type
+template< typename Arg >  // Min/max argument type
+inline void Rand< SellMatrix<Type,IT> >::randomize( SellMatrix<Type,IT>& matrix,
+                                                    const Arg& min, const Arg& max ) const
+{
+   matrix = blaze::rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns(), min, max );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a SellMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero elements.
+*/
+template< typename Type   // Data type of the matrix
+        , typename IT >   // Index type
+template< typename Arg >  // Min/max argument type
+inline void Rand< SellMatrix<Type,IT> >::randomize( SellMatrix<Type,IT>& matrix, size_t nonzeros,
+                                                    const Arg& min, const Arg& max ) const
+{
+   matrix = blaze::rand< CompressedMatrix<Type,false> >( matrix.rows(), matrix.columns(), nonzeros, min, max );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
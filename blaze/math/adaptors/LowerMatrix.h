@@ -1208,6 +1208,18 @@ struct AddTrait< CompressedMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
    using Type = AddTrait_< CompressedMatrix<T,SO1>, MT >;
 };
 
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename IT >
+struct AddTrait< LowerMatrix<MT,SO1,DF>, CompactMatrix<T,SO2,IT> >
+{
+   using Type = AddTrait_< MT, CompactMatrix<T,SO2,IT> >;
+};
+
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename IT >
+struct AddTrait< CompactMatrix<T,SO1,IT>, LowerMatrix<MT,SO2,DF> >
+{
+   using Type = AddTrait_< CompactMatrix<T,SO1,IT>, MT >;
+};
+
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
 struct AddTrait< LowerMatrix<MT1,SO1,DF1>, SymmetricMatrix<MT2,SO2,DF2,NF> >
 {
@@ -1311,6 +1323,18 @@ struct SubTrait< CompressedMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
    using Type = SubTrait_< CompressedMatrix<T,SO1>, MT >;
 };
 
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename IT >
+struct SubTrait< LowerMatrix<MT,SO1,DF>, CompactMatrix<T,SO2,IT> >
+{
+   using Type = SubTrait_< MT, CompactMatrix<T,SO2,IT> >;
+};
+
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename IT >
+struct SubTrait< CompactMatrix<T,SO1,IT>, LowerMatrix<MT,SO2,DF> >
+{
+   using Type = SubTrait_< CompactMatrix<T,SO1,IT>, MT >;
+};
+
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
 struct SubTrait< LowerMatrix<MT1,SO1,DF1>, SymmetricMatrix<MT2,SO2,DF2,NF> >
 {
@@ -1486,6 +1510,18 @@ struct MultTrait< CompressedMatrix<T,SO1>, LowerMatrix<MT,SO2,DF> >
    using Type = MultTrait_< CompressedMatrix<T,SO1>, MT >;
 };
 
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename IT >
+struct MultTrait< LowerMatrix<MT,SO1,DF>, CompactMatrix<T,SO2,IT> >
+{
+   using Type = MultTrait_< MT, CompactMatrix<T,SO2,IT> >;
+};
+
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename IT >
+struct MultTrait< CompactMatrix<T,SO1,IT>, LowerMatrix<MT,SO2,DF> >
+{
+   using Type = MultTrait_< CompactMatrix<T,SO1,IT>, MT >;
+};
+
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
 struct MultTrait< LowerMatrix<MT1,SO1,DF1>, SymmetricMatrix<MT2,SO2,DF2,NF> >
 {
@@ -0,0 +1,1905 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchInversion.h
+//  \brief Header file for the batched inversion of small, fixed-size matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_BATCHINVERSION_H_
+#define _BLAZE_MATH_DENSE_BATCHINVERSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BatchMult.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/MatrixBatch.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/dense/VectorBatch.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLOSED-FORM KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the adjugate of a \f$ 2 \times 2 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \param B The resulting adjugate matrix.
+// \return void
+//
+// This function computes the adjugate of the given \f$ 2 \times 2 \f$ matrix. The element type
+// \a VT is either a scalar or a SIMD type. In the latter case each SIMD lane holds an element
+// of a different matrix, i.e. the adjugates of several matrices are computed at once.
+*/
+template< typename VT >  // Type of the matrix elements
+inline void batchAdjugate( const VT (&A)[2][2], VT (&B)[2][2] )
+{
+   B[0][0] = A[1][1];
+   B[0][1] = VT() - A[0][1];
+   B[1][0] = VT() - A[1][0];
+   B[1][1] = A[0][0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the adjugate of a \f$ 3 \times 3 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \param B The resulting adjugate matrix.
+// \return void
+//
+// This function computes the adjugate of the given \f$ 3 \times 3 \f$ matrix via the same rule
+// of Sarrus as the invert() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline void batchAdjugate( const VT (&A)[3][3], VT (&B)[3][3] )
+{
+   B[0][0] = A[1][1]*A[2][2] - A[1][2]*A[2][1];
+   B[1][0] = A[1][2]*A[2][0] - A[1][0]*A[2][2];
+   B[2][0] = A[1][0]*A[2][1] - A[1][1]*A[2][0];
+
+   B[0][1] = A[0][2]*A[2][1] - A[0][1]*A[2][2];
+   B[1][1] = A[0][0]*A[2][2] - A[0][2]*A[2][0];
+   B[2][1] = A[0][1]*A[2][0] - A[0][0]*A[2][1];
+   B[0][2] = A[0][1]*A[1][2] - A[0][2]*A[1][1];
+   B[1][2] = A[0][2]*A[1][0] - A[0][0]*A[1][2];
+   B[2][2] = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the adjugate of a \f$ 4 \times 4 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \param B The resulting adjugate matrix.
+// \return void
+//
+// This function computes the adjugate of the given \f$ 4 \times 4 \f$ matrix via the same rule
+// of Sarrus as the invert() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline void batchAdjugate( const VT (&A)[4][4], VT (&B)[4][4] )
+{
+   VT tmp1( A[2][2]*A[3][3] - A[2][3]*A[3][2] );
+   VT tmp2( A[2][1]*A[3][3] - A[2][3]*A[3][1] );
+   VT tmp3( A[2][1]*A[3][2] - A[2][2]*A[3][1] );
+
+   B[0][0] = A[1][1]*tmp1 - A[1][2]*tmp2 + A[1][3]*tmp3;
+   B[0][1] = A[0][2]*tmp2 - A[0][1]*tmp1 - A[0][3]*tmp3;
+
+   VT tmp4( A[2][0]*A[3][3] - A[2][3]*A[3][0] );
+   VT tmp5( A[2][0]*A[3][2] - A[2][2]*A[3][0] );
+
+   B[1][0] = A[1][2]*tmp4 - A[1][0]*tmp1 - A[1][3]*tmp5;
+   B[1][1] = A[0][0]*tmp1 - A[0][2]*tmp4 + A[0][3]*tmp5;
+
+   tmp1 = A[2][0]*A[3][1] - A[2][1]*A[3][0];
+
+   B[2][0] = A[1][0]*tmp2 - A[1][1]*tmp4 + A[1][3]*tmp1;
+   B[2][1] = A[0][1]*tmp4 - A[0][0]*tmp2 - A[0][3]*tmp1;
+   B[3][0] = A[1][1]*tmp5 - A[1][0]*tmp3 - A[1][2]*tmp1;
+   B[3][1] = A[0][0]*tmp3 - A[0][1]*tmp5 + A[0][2]*tmp1;
+
+   tmp1 = A[0][2]*A[1][3] - A[0][3]*A[1][2];
+   tmp2 = A[0][1]*A[1][3] - A[0][3]*A[1][1];
+   tmp3 = A[0][1]*A[1][2] - A[0][2]*A[1][1];
+
+   B[0][2] = A[3][1]*tmp1 - A[3][2]*tmp2 + A[3][3]*tmp3;
+   B[0][3] = A[2][2]*tmp2 - A[2][1]*tmp1 - A[2][3]*tmp3;
+
+   tmp4 = A[0][0]*A[1][3] - A[0][3]*A[1][0];
+   tmp5 = A[0][0]*A[1][2] - A[0][2]*A[1][0];
+
+   B[1][2] = A[3][2]*tmp4 - A[3][0]*tmp1 - A[3][3]*tmp5;
+   B[1][3] = A[2][0]*tmp1 - A[2][2]*tmp4 + A[2][3]*tmp5;
+
+   tmp1 = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+
+   B[2][2] = A[3][0]*tmp2 - A[3][1]*tmp4 + A[3][3]*tmp1;
+   B[2][3] = A[2][1]*tmp4 - A[2][0]*tmp2 - A[2][3]*tmp1;
+   B[3][2] = A[3][1]*tmp5 - A[3][0]*tmp3 - A[3][2]*tmp1;
+   B[3][3] = A[2][0]*tmp3 - A[2][1]*tmp5 + A[2][2]*tmp1;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the adjugate of a \f$ 5 \times 5 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \param B The resulting adjugate matrix.
+// \return void
+//
+// This function computes the adjugate of the given \f$ 5 \times 5 \f$ matrix via the same rule
+// of Sarrus as the invert() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline void batchAdjugate( const VT (&A)[5][5], VT (&B)[5][5] )
+{
+   VT tmp1 ( A[3][3]*A[4][4] - A[3][4]*A[4][3] );
+   VT tmp2 ( A[3][2]*A[4][4] - A[3][4]*A[4][2] );
+   VT tmp3 ( A[3][2]*A[4][3] - A[3][3]*A[4][2] );
+   VT tmp4 ( A[3][1]*A[4][4] - A[3][4]*A[4][1] );
+   VT tmp5 ( A[3][1]*A[4][3] - A[3][3]*A[4][1] );
+   VT tmp6 ( A[3][1]*A[4][2] - A[3][2]*A[4][1] );
+   VT tmp7 ( A[3][0]*A[4][4] - A[3][4]*A[4][0] );
+   VT tmp8 ( A[3][0]*A[4][3] - A[3][3]*A[4][0] );
+   VT tmp9 ( A[3][0]*A[4][2] - A[3][2]*A[4][0] );
+   VT tmp10( A[3][0]*A[4][1] - A[3][1]*A[4][0] );
+
+   VT tmp11( A[2][2]*tmp1 - A[2][3]*tmp2 + A[2][4]*tmp3  );
+   VT tmp12( A[2][1]*tmp1 - A[2][3]*tmp4 + A[2][4]*tmp5  );
+   VT tmp13( A[2][1]*tmp2 - A[2][2]*tmp4 + A[2][4]*tmp6  );
+   VT tmp14( A[2][1]*tmp3 - A[2][2]*tmp5 + A[2][3]*tmp6  );
+   VT tmp15( A[2][0]*tmp1 - A[2][3]*tmp7 + A[2][4]*tmp8  );
+   VT tmp16( A[2][0]*tmp2 - A[2][2]*tmp7 + A[2][4]*tmp9  );
+   VT tmp17( A[2][0]*tmp3 - A[2][2]*tmp8 + A[2][3]*tmp9  );
+
+   B[0][0] = A[1][1]*tmp11 - A[1][2]*tmp12 + A[1][3]*tmp13 - A[1][4]*tmp14;
+   B[0][1] = A[0][2]*tmp12 - A[0][1]*tmp11 - A[0][3]*tmp13 + A[0][4]*tmp14;
+   B[1][0] = A[1][2]*tmp15 - A[1][0]*tmp11 - A[1][3]*tmp16 + A[1][4]*tmp17;
+   B[1][1] = A[0][0]*tmp11 - A[0][2]*tmp15 + A[0][3]*tmp16 - A[0][4]*tmp17;
+
+   VT tmp18( A[2][0]*tmp4 - A[2][1]*tmp7 + A[2][4]*tmp10 );
+   VT tmp19( A[2][0]*tmp5 - A[2][1]*tmp8 + A[2][3]*tmp10 );
+   VT tmp20( A[2][0]*tmp6 - A[2][1]*tmp9 + A[2][2]*tmp10 );
+
+   B[2][0] = A[1][0]*tmp12 - A[1][1]*tmp15 + A[1][3]*tmp18 - A[1][4]*tmp19;
+   B[2][1] = A[0][1]*tmp15 - A[0][0]*tmp12 - A[0][3]*tmp18 + A[0][4]*tmp19;
+   B[3][0] = A[1][1]*tmp16 - A[1][0]*tmp13 - A[1][2]*tmp18 + A[1][4]*tmp20;
+   B[3][1] = A[0][0]*tmp13 - A[0][1]*tmp16 + A[0][2]*tmp18 - A[0][4]*tmp20;
+   B[4][0] = A[1][0]*tmp14 - A[1][1]*tmp17 + A[1][2]*tmp19 - A[1][3]*tmp20;
+   B[4][1] = A[0][1]*tmp17 - A[0][0]*tmp14 - A[0][2]*tmp19 + A[0][3]*tmp20;
+
+   tmp11 = A[1][2]*tmp1 - A[1][3]*tmp2 + A[1][4]*tmp3;
+   tmp12 = A[1][1]*tmp1 - A[1][3]*tmp4 + A[1][4]*tmp5;
+   tmp13 = A[1][1]*tmp2 - A[1][2]*tmp4 + A[1][4]*tmp6;
+   tmp14 = A[1][1]*tmp3 - A[1][2]*tmp5 + A[1][3]*tmp6;
+   tmp15 = A[1][0]*tmp1 - A[1][3]*tmp7 + A[1][4]*tmp8;
+   tmp16 = A[1][0]*tmp2 - A[1][2]*tmp7 + A[1][4]*tmp9;
+   tmp17 = A[1][0]*tmp3 - A[1][2]*tmp8 + A[1][3]*tmp9;
+   tmp18 = A[1][0]*tmp4 - A[1][1]*tmp7 + A[1][4]*tmp10;
+   tmp19 = A[1][0]*tmp5 - A[1][1]*tmp8 + A[1][3]*tmp10;
+
+   B[0][2] = A[0][1]*tmp11 - A[0][2]*tmp12 + A[0][3]*tmp13 - A[0][4]*tmp14;
+   B[1][2] = A[0][2]*tmp15 - A[0][0]*tmp11 - A[0][3]*tmp16 + A[0][4]*tmp17;
+   B[2][2] = A[0][0]*tmp12 - A[0][1]*tmp15 + A[0][3]*tmp18 - A[0][4]*tmp19;
+
+   tmp1  = A[0][2]*A[1][3] - A[0][3]*A[1][2];
+   tmp2  = A[0][1]*A[1][3] - A[0][3]*A[1][1];
+   tmp3  = A[0][1]*A[1][2] - A[0][2]*A[1][1];
+   tmp4  = A[0][0]*A[1][3] - A[0][3]*A[1][0];
+   tmp5  = A[0][0]*A[1][2] - A[0][2]*A[1][0];
+   tmp6  = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+   tmp7  = A[0][2]*A[1][4] - A[0][4]*A[1][2];
+   tmp8  = A[0][1]*A[1][4] - A[0][4]*A[1][1];
+   tmp9  = A[0][0]*A[1][4] - A[0][4]*A[1][0];
+   tmp10 = A[0][3]*A[1][4] - A[0][4]*A[1][3];
+
+   tmp11 = A[2][2]*tmp10 - A[2][3]*tmp7 + A[2][4]*tmp1;
+   tmp12 = A[2][1]*tmp10 - A[2][3]*tmp8 + A[2][4]*tmp2;
+   tmp13 = A[2][1]*tmp7  - A[2][2]*tmp8 + A[2][4]*tmp3;
+   tmp14 = A[2][1]*tmp1  - A[2][2]*tmp2 + A[2][3]*tmp3;
+   tmp15 = A[2][0]*tmp10 - A[2][3]*tmp9 + A[2][4]*tmp4;
+   tmp16 = A[2][0]*tmp7  - A[2][2]*tmp9 + A[2][4]*tmp5;
+   tmp17 = A[2][0]*tmp1  - A[2][2]*tmp4 + A[2][3]*tmp5;
+
+   B[0][3] = A[4][1]*tmp11 - A[4][2]*tmp12 + A[4][3]*tmp13 - A[4][4]*tmp14;
+   B[0][4] = A[3][2]*tmp12 - A[3][1]*tmp11 - A[3][3]*tmp13 + A[3][4]*tmp14;
+   B[1][3] = A[4][2]*tmp15 - A[4][0]*tmp11 - A[4][3]*tmp16 + A[4][4]*tmp17;
+   B[1][4] = A[3][0]*tmp11 - A[3][2]*tmp15 + A[3][3]*tmp16 - A[3][4]*tmp17;
+
+   tmp18 = A[2][0]*tmp8  - A[2][1]*tmp9 + A[2][4]*tmp6;
+   tmp19 = A[2][0]*tmp2  - A[2][1]*tmp4 + A[2][3]*tmp6;
+   tmp20 = A[2][0]*tmp3  - A[2][1]*tmp5 + A[2][2]*tmp6;
+
+   B[2][3] = A[4][0]*tmp12 - A[4][1]*tmp15 + A[4][3]*tmp18 - A[4][4]*tmp19;
+   B[2][4] = A[3][1]*tmp15 - A[3][0]*tmp12 - A[3][3]*tmp18 + A[3][4]*tmp19;
+   B[3][3] = A[4][1]*tmp16 - A[4][0]*tmp13 - A[4][2]*tmp18 + A[4][4]*tmp20;
+   B[3][4] = A[3][0]*tmp13 - A[3][1]*tmp16 + A[3][2]*tmp18 - A[3][4]*tmp20;
+   B[4][3] = A[4][0]*tmp14 - A[4][1]*tmp17 + A[4][2]*tmp19 - A[4][3]*tmp20;
+   B[4][4] = A[3][1]*tmp17 - A[3][0]*tmp14 - A[3][2]*tmp19 + A[3][3]*tmp20;
+
+   tmp11 = A[3][1]*tmp7  - A[3][2]*tmp8 + A[3][4]*tmp3;
+   tmp12 = A[3][0]*tmp7  - A[3][2]*tmp9 + A[3][4]*tmp5;
+   tmp13 = A[3][0]*tmp8  - A[3][1]*tmp9 + A[3][4]*tmp6;
+   tmp14 = A[3][0]*tmp3  - A[3][1]*tmp5 + A[3][2]*tmp6;
+
+   tmp15 = A[3][1]*tmp1  - A[3][2]*tmp2 + A[3][3]*tmp3;
+   tmp16 = A[3][0]*tmp1  - A[3][2]*tmp4 + A[3][3]*tmp5;
+   tmp17 = A[3][0]*tmp2  - A[3][1]*tmp4 + A[3][3]*tmp6;
+
+   B[3][2] = A[4][0]*tmp11 - A[4][1]*tmp12 + A[4][2]*tmp13 - A[4][4]*tmp14;
+   B[4][2] = A[4][1]*tmp16 - A[4][0]*tmp15 - A[4][2]*tmp17 + A[4][3]*tmp14;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the adjugate of a \f$ 6 \times 6 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \param B The resulting adjugate matrix.
+// \return void
+//
+// This function computes the adjugate of the given \f$ 6 \times 6 \f$ matrix via the same rule
+// of Sarrus as the invert() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline void batchAdjugate( const VT (&A)[6][6], VT (&B)[6][6] )
+{
+   VT tmp1 ( A[4][4]*A[5][5] - A[4][5]*A[5][4] );
+   VT tmp2 ( A[4][3]*A[5][5] - A[4][5]*A[5][3] );
+   VT tmp3 ( A[4][3]*A[5][4] - A[4][4]*A[5][3] );
+   VT tmp4 ( A[4][2]*A[5][5] - A[4][5]*A[5][2] );
+   VT tmp5 ( A[4][2]*A[5][4] - A[4][4]*A[5][2] );
+   VT tmp6 ( A[4][2]*A[5][3] - A[4][3]*A[5][2] );
+   VT tmp7 ( A[4][1]*A[5][5] - A[4][5]*A[5][1] );
+   VT tmp8 ( A[4][1]*A[5][4] - A[4][4]*A[5][1] );
+   VT tmp9 ( A[4][1]*A[5][3] - A[4][3]*A[5][1] );
+   VT tmp10( A[4][1]*A[5][2] - A[4][2]*A[5][1] );
+   VT tmp11( A[4][0]*A[5][5] - A[4][5]*A[5][0] );
+   VT tmp12( A[4][0]*A[5][4] - A[4][4]*A[5][0] );
+   VT tmp13( A[4][0]*A[5][3] - A[4][3]*A[5][0] );
+   VT tmp14( A[4][0]*A[5][2] - A[4][2]*A[5][0] );
+   VT tmp15( A[4][0]*A[5][1] - A[4][1]*A[5][0] );
+
+   VT tmp16( A[3][3]*tmp1  - A[3][4]*tmp2  + A[3][5]*tmp3  );
+   VT tmp17( A[3][2]*tmp1  - A[3][4]*tmp4  + A[3][5]*tmp5  );
+   VT tmp18( A[3][2]*tmp2  - A[3][3]*tmp4  + A[3][5]*tmp6  );
+   VT tmp19( A[3][2]*tmp3  - A[3][3]*tmp5  + A[3][4]*tmp6  );
+   VT tmp20( A[3][1]*tmp1  - A[3][4]*tmp7  + A[3][5]*tmp8  );
+   VT tmp21( A[3][1]*tmp2  - A[3][3]*tmp7  + A[3][5]*tmp9  );
+   VT tmp22( A[3][1]*tmp3  - A[3][3]*tmp8  + A[3][4]*tmp9  );
+   VT tmp23( A[3][1]*tmp4  - A[3][2]*tmp7  + A[3][5]*tmp10 );
+   VT tmp24( A[3][1]*tmp5  - A[3][2]*tmp8  + A[3][4]*tmp10 );
+   VT tmp25( A[3][1]*tmp6  - A[3][2]*tmp9  + A[3][3]*tmp10 );
+   VT tmp26( A[3][0]*tmp1  - A[3][4]*tmp11 + A[3][5]*tmp12 );
+   VT tmp27( A[3][0]*tmp2  - A[3][3]*tmp11 + A[3][5]*tmp13 );
+   VT tmp28( A[3][0]*tmp3  - A[3][3]*tmp12 + A[3][4]*tmp13 );
+   VT tmp29( A[3][0]*tmp4  - A[3][2]*tmp11 + A[3][5]*tmp14 );
+   VT tmp30( A[3][0]*tmp5  - A[3][2]*tmp12 + A[3][4]*tmp14 );
+   VT tmp31( A[3][0]*tmp6  - A[3][2]*tmp13 + A[3][3]*tmp14 );
+   VT tmp32( A[3][0]*tmp7  - A[3][1]*tmp11 + A[3][5]*tmp15 );
+   VT tmp33( A[3][0]*tmp8  - A[3][1]*tmp12 + A[3][4]*tmp15 );
+   VT tmp34( A[3][0]*tmp9  - A[3][1]*tmp13 + A[3][3]*tmp15 );
+   VT tmp35( A[3][0]*tmp10 - A[3][1]*tmp14 + A[3][2]*tmp15 );
+
+   VT tmp36( A[2][2]*tmp16 - A[2][3]*tmp17 + A[2][4]*tmp18 - A[2][5]*tmp19 );
+   VT tmp37( A[2][1]*tmp16 - A[2][3]*tmp20 + A[2][4]*tmp21 - A[2][5]*tmp22 );
+   VT tmp38( A[2][1]*tmp17 - A[2][2]*tmp20 + A[2][4]*tmp23 - A[2][5]*tmp24 );
+   VT tmp39( A[2][1]*tmp18 - A[2][2]*tmp21 + A[2][3]*tmp23 - A[2][5]*tmp25 );
+   VT tmp40( A[2][1]*tmp19 - A[2][2]*tmp22 + A[2][3]*tmp24 - A[2][4]*tmp25 );
+   VT tmp41( A[2][0]*tmp16 - A[2][3]*tmp26 + A[2][4]*tmp27 - A[2][5]*tmp28 );
+   VT tmp42( A[2][0]*tmp17 - A[2][2]*tmp26 + A[2][4]*tmp29 - A[2][5]*tmp30 );
+   VT tmp43( A[2][0]*tmp18 - A[2][2]*tmp27 + A[2][3]*tmp29 - A[2][5]*tmp31 );
+   VT tmp44( A[2][0]*tmp19 - A[2][2]*tmp28 + A[2][3]*tmp30 - A[2][4]*tmp31 );
+
+   B[0][0] = A[1][1]*tmp36 - A[1][2]*tmp37 + A[1][3]*tmp38 - A[1][4]*tmp39 + A[1][5]*tmp40;
+   B[0][1] = A[0][2]*tmp37 - A[0][1]*tmp36 - A[0][3]*tmp38 + A[0][4]*tmp39 - A[0][5]*tmp40;
+   B[1][0] = A[1][2]*tmp41 - A[1][0]*tmp36 - A[1][3]*tmp42 + A[1][4]*tmp43 - A[1][5]*tmp44;
+   B[1][1] = A[0][0]*tmp36 - A[0][2]*tmp41 + A[0][3]*tmp42 - A[0][4]*tmp43 + A[0][5]*tmp44;
+
+   VT tmp45( A[2][0]*tmp20 - A[2][1]*tmp26 + A[2][4]*tmp32 - A[2][5]*tmp33 );
+   VT tmp46( A[2][0]*tmp21 - A[2][1]*tmp27 + A[2][3]*tmp32 - A[2][5]*tmp34 );
+   VT tmp47( A[2][0]*tmp22 - A[2][1]*tmp28 + A[2][3]*tmp33 - A[2][4]*tmp34 );
+   VT tmp48( A[2][0]*tmp23 - A[2][1]*tmp29 + A[2][2]*tmp32 - A[2][5]*tmp35 );
+   VT tmp49( A[2][0]*tmp24 - A[2][1]*tmp30 + A[2][2]*tmp33 - A[2][4]*tmp35 );
+
+   B[2][0] = A[1][0]*tmp37 - A[1][1]*tmp41 + A[1][3]*tmp45 - A[1][4]*tmp46 + A[1][5]*tmp47;
+   B[2][1] = A[0][1]*tmp41 - A[0][0]*tmp37 - A[0][3]*tmp45 + A[0][4]*tmp46 - A[0][5]*tmp47;
+   B[3][0] = A[1][1]*tmp42 - A[1][0]*tmp38 - A[1][2]*tmp45 + A[1][4]*tmp48 - A[1][5]*tmp49;
+   B[3][1] = A[0][0]*tmp38 - A[0][1]*tmp42 + A[0][2]*tmp45 - A[0][4]*tmp48 + A[0][5]*tmp49;
+
+   VT tmp50( A[2][0]*tmp25 - A[2][1]*tmp31 + A[2][2]*tmp34 - A[2][3]*tmp35 );
+
+   B[4][0] = A[1][0]*tmp39 - A[1][1]*tmp43 + A[1][2]*tmp46 - A[1][3]*tmp48 + A[1][5]*tmp50;
+   B[4][1] = A[0][1]*tmp43 - A[0][0]*tmp39 - A[0][2]*tmp46 + A[0][3]*tmp48 - A[0][5]*tmp50;
+   B[5][0] = A[1][1]*tmp44 - A[1][0]*tmp40 - A[1][2]*tmp47 + A[1][3]*tmp49 - A[1][4]*tmp50;
+   B[5][1] = A[0][0]*tmp40 - A[0][1]*tmp44 + A[0][2]*tmp47 - A[0][3]*tmp49 + A[0][4]*tmp50;
+
+   tmp36 = A[1][2]*tmp16 - A[1][3]*tmp17 + A[1][4]*tmp18 - A[1][5]*tmp19;
+   tmp37 = A[1][1]*tmp16 - A[1][3]*tmp20 + A[1][4]*tmp21 - A[1][5]*tmp22;
+   tmp38 = A[1][1]*tmp17 - A[1][2]*tmp20 + A[1][4]*tmp23 - A[1][5]*tmp24;
+   tmp39 = A[1][1]*tmp18 - A[1][2]*tmp21 + A[1][3]*tmp23 - A[1][5]*tmp25;
+   tmp40 = A[1][1]*tmp19 - A[1][2]*tmp22 + A[1][3]*tmp24 - A[1][4]*tmp25;
+   tmp41 = A[1][0]*tmp16 - A[1][3]*tmp26 + A[1][4]*tmp27 - A[1][5]*tmp28;
+   tmp42 = A[1][0]*tmp17 - A[1][2]*tmp26 + A[1][4]*tmp29 - A[1][5]*tmp30;
+   tmp43 = A[1][0]*tmp18 - A[1][2]*tmp27 + A[1][3]*tmp29 - A[1][5]*tmp31;
+   tmp44 = A[1][0]*tmp19 - A[1][2]*tmp28 + A[1][3]*tmp30 - A[1][4]*tmp31;
+   tmp45 = A[1][0]*tmp20 - A[1][1]*tmp26 + A[1][4]*tmp32 - A[1][5]*tmp33;
+   tmp46 = A[1][0]*tmp21 - A[1][1]*tmp27 + A[1][3]*tmp32 - A[1][5]*tmp34;
+   tmp47 = A[1][0]*tmp22 - A[1][1]*tmp28 + A[1][3]*tmp33 - A[1][4]*tmp34;
+   tmp48 = A[1][0]*tmp23 - A[1][1]*tmp29 + A[1][2]*tmp32 - A[1][5]*tmp35;
+   tmp49 = A[1][0]*tmp24 - A[1][1]*tmp30 + A[1][2]*tmp33 - A[1][4]*tmp35;
+   tmp50 = A[1][0]*tmp25 - A[1][1]*tmp31 + A[1][2]*tmp34 - A[1][3]*tmp35;
+
+   B[0][2] = A[0][1]*tmp36 - A[0][2]*tmp37 + A[0][3]*tmp38 - A[0][4]*tmp39 + A[0][5]*tmp40;
+   B[1][2] = A[0][2]*tmp41 - A[0][0]*tmp36 - A[0][3]*tmp42 + A[0][4]*tmp43 - A[0][5]*tmp44;
+   B[2][2] = A[0][0]*tmp37 - A[0][1]*tmp41 + A[0][3]*tmp45 - A[0][4]*tmp46 + A[0][5]*tmp47;
+   B[3][2] = A[0][1]*tmp42 - A[0][0]*tmp38 - A[0][2]*tmp45 + A[0][4]*tmp48 - A[0][5]*tmp49;
+   B[4][2] = A[0][0]*tmp39 - A[0][1]*tmp43 + A[0][2]*tmp46 - A[0][3]*tmp48 + A[0][5]*tmp50;
+   B[5][2] = A[0][1]*tmp44 - A[0][0]*tmp40 - A[0][2]*tmp47 + A[0][3]*tmp49 - A[0][4]*tmp50;
+
+   tmp1  = A[0][3]*A[1][4] - A[0][4]*A[1][3];
+   tmp2  = A[0][2]*A[1][4] - A[0][4]*A[1][2];
+   tmp3  = A[0][2]*A[1][3] - A[0][3]*A[1][2];
+   tmp4  = A[0][1]*A[1][4] - A[0][4]*A[1][1];
+   tmp5  = A[0][1]*A[1][3] - A[0][3]*A[1][1];
+   tmp6  = A[0][1]*A[1][2] - A[0][2]*A[1][1];
+   tmp7  = A[0][0]*A[1][4] - A[0][4]*A[1][0];
+   tmp8  = A[0][0]*A[1][3] - A[0][3]*A[1][0];
+   tmp9  = A[0][0]*A[1][2] - A[0][2]*A[1][0];
+   tmp10 = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+   tmp11 = A[0][3]*A[1][5] - A[0][5]*A[1][3];
+   tmp12 = A[0][2]*A[1][5] - A[0][5]*A[1][2];
+   tmp13 = A[0][1]*A[1][5] - A[0][5]*A[1][1];
+   tmp14 = A[0][0]*A[1][5] - A[0][5]*A[1][0];
+   tmp15 = A[0][4]*A[1][5] - A[0][5]*A[1][4];
+
+   tmp16 = A[2][3]*tmp15 - A[2][4]*tmp11 + A[2][5]*tmp1;
+   tmp17 = A[2][2]*tmp15 - A[2][4]*tmp12 + A[2][5]*tmp2;
+   tmp18 = A[2][2]*tmp11 - A[2][3]*tmp12 + A[2][5]*tmp3;
+   tmp19 = A[2][2]*tmp1  - A[2][3]*tmp2  + A[2][4]*tmp3;
+   tmp20 = A[2][1]*tmp15 - A[2][4]*tmp13 + A[2][5]*tmp4;
+   tmp21 = A[2][1]*tmp11 - A[2][3]*tmp13 + A[2][5]*tmp5;
+   tmp22 = A[2][1]*tmp1  - A[2][3]*tmp4  + A[2][4]*tmp5;
+   tmp23 = A[2][1]*tmp12 - A[2][2]*tmp13 + A[2][5]*tmp6;
+   tmp24 = A[2][1]*tmp2  - A[2][2]*tmp4  + A[2][4]*tmp6;
+   tmp25 = A[2][1]*tmp3  - A[2][2]*tmp5  + A[2][3]*tmp6;
+   tmp26 = A[2][0]*tmp15 - A[2][4]*tmp14 + A[2][5]*tmp7;
+   tmp27 = A[2][0]*tmp11 - A[2][3]*tmp14 + A[2][5]*tmp8;
+   tmp28 = A[2][0]*tmp1  - A[2][3]*tmp7  + A[2][4]*tmp8;
+   tmp29 = A[2][0]*tmp12 - A[2][2]*tmp14 + A[2][5]*tmp9;
+   tmp30 = A[2][0]*tmp2  - A[2][2]*tmp7  + A[2][4]*tmp9;
+   tmp31 = A[2][0]*tmp3  - A[2][2]*tmp8  + A[2][3]*tmp9;
+   tmp32 = A[2][0]*tmp13 - A[2][1]*tmp14 + A[2][5]*tmp10;
+   tmp33 = A[2][0]*tmp4  - A[2][1]*tmp7  + A[2][4]*tmp10;
+   tmp34 = A[2][0]*tmp5  - A[2][1]*tmp8  + A[2][3]*tmp10;
+   tmp35 = A[2][0]*tmp6  - A[2][1]*tmp9  + A[2][2]*tmp10;
+
+   tmp36 = A[3][2]*tmp16 - A[3][3]*tmp17 + A[3][4]*tmp18 - A[3][5]*tmp19;
+   tmp37 = A[3][1]*tmp16 - A[3][3]*tmp20 + A[3][4]*tmp21 - A[3][5]*tmp22;
+   tmp38 = A[3][1]*tmp17 - A[3][2]*tmp20 + A[3][4]*tmp23 - A[3][5]*tmp24;
+   tmp39 = A[3][1]*tmp18 - A[3][2]*tmp21 + A[3][3]*tmp23 - A[3][5]*tmp25;
+   tmp40 = A[3][1]*tmp19 - A[3][2]*tmp22 + A[3][3]*tmp24 - A[3][4]*tmp25;
+   tmp41 = A[3][0]*tmp16 - A[3][3]*tmp26 + A[3][4]*tmp27 - A[3][5]*tmp28;
+   tmp42 = A[3][0]*tmp17 - A[3][2]*tmp26 + A[3][4]*tmp29 - A[3][5]*tmp30;
+   tmp43 = A[3][0]*tmp18 - A[3][2]*tmp27 + A[3][3]*tmp29 - A[3][5]*tmp31;
+   tmp44 = A[3][0]*tmp19 - A[3][2]*tmp28 + A[3][3]*tmp30 - A[3][4]*tmp31;
+
+   B[0][4] = A[5][2]*tmp37 - A[5][1]*tmp36 - A[5][3]*tmp38 + A[5][4]*tmp39 - A[5][5]*tmp40;
+   B[0][5] = A[4][1]*tmp36 - A[4][2]*tmp37 + A[4][3]*tmp38 - A[4][4]*tmp39 + A[4][5]*tmp40;
+   B[1][4] = A[5][0]*tmp36 - A[5][2]*tmp41 + A[5][3]*tmp42 - A[5][4]*tmp43 + A[5][5]*tmp44;
+   B[1][5] = A[4][2]*tmp41 - A[4][0]*tmp36 - A[4][3]*tmp42 + A[4][4]*tmp43 - A[4][5]*tmp44;
+
+   tmp45 = A[3][0]*tmp20 - A[3][1]*tmp26 + A[3][4]*tmp32 - A[3][5]*tmp33;
+   tmp46 = A[3][0]*tmp21 - A[3][1]*tmp27 + A[3][3]*tmp32 - A[3][5]*tmp34;
+   tmp47 = A[3][0]*tmp22 - A[3][1]*tmp28 + A[3][3]*tmp33 - A[3][4]*tmp34;
+   tmp48 = A[3][0]*tmp23 - A[3][1]*tmp29 + A[3][2]*tmp32 - A[3][5]*tmp35;
+   tmp49 = A[3][0]*tmp24 - A[3][1]*tmp30 + A[3][2]*tmp33 - A[3][4]*tmp35;
+
+   B[2][4] = A[5][1]*tmp41 - A[5][0]*tmp37 - A[5][3]*tmp45 + A[5][4]*tmp46 - A[5][5]*tmp47;
+   B[2][5] = A[4][0]*tmp37 - A[4][1]*tmp41 + A[4][3]*tmp45 - A[4][4]*tmp46 + A[4][5]*tmp47;
+   B[3][4] = A[5][0]*tmp38 - A[5][1]*tmp42 + A[5][2]*tmp45 - A[5][4]*tmp48 + A[5][5]*tmp49;
+   B[3][5] = A[4][1]*tmp42 - A[4][0]*tmp38 - A[4][2]*tmp45 + A[4][4]*tmp48 - A[4][5]*tmp49;
+
+   tmp50 = A[3][0]*tmp25 - A[3][1]*tmp31 + A[3][2]*tmp34 - A[3][3]*tmp35;
+
+   B[4][4] = A[5][1]*tmp43 - A[5][0]*tmp39 - A[5][2]*tmp46 + A[5][3]*tmp48 - A[5][5]*tmp50;
+   B[4][5] = A[4][0]*tmp39 - A[4][1]*tmp43 + A[4][2]*tmp46 - A[4][3]*tmp48 + A[4][5]*tmp50;
+   B[5][4] = A[5][0]*tmp40 - A[5][1]*tmp44 + A[5][2]*tmp47 - A[5][3]*tmp49 + A[5][4]*tmp50;
+   B[5][5] = A[4][1]*tmp44 - A[4][0]*tmp40 - A[4][2]*tmp47 + A[4][3]*tmp49 - A[4][4]*tmp50;
+
+   tmp36 = A[4][2]*tmp16 - A[4][3]*tmp17 + A[4][4]*tmp18 - A[4][5]*tmp19;
+   tmp37 = A[4][1]*tmp16 - A[4][3]*tmp20 + A[4][4]*tmp21 - A[4][5]*tmp22;
+   tmp38 = A[4][1]*tmp17 - A[4][2]*tmp20 + A[4][4]*tmp23 - A[4][5]*tmp24;
+   tmp39 = A[4][1]*tmp18 - A[4][2]*tmp21 + A[4][3]*tmp23 - A[4][5]*tmp25;
+   tmp40 = A[4][1]*tmp19 - A[4][2]*tmp22 + A[4][3]*tmp24 - A[4][4]*tmp25;
+   tmp41 = A[4][0]*tmp16 - A[4][3]*tmp26 + A[4][4]*tmp27 - A[4][5]*tmp28;
+   tmp42 = A[4][0]*tmp17 - A[4][2]*tmp26 + A[4][4]*tmp29 - A[4][5]*tmp30;
+   tmp43 = A[4][0]*tmp18 - A[4][2]*tmp27 + A[4][3]*tmp29 - A[4][5]*tmp31;
+   tmp44 = A[4][0]*tmp19 - A[4][2]*tmp28 + A[4][3]*tmp30 - A[4][4]*tmp31;
+   tmp45 = A[4][0]*tmp20 - A[4][1]*tmp26 + A[4][4]*tmp32 - A[4][5]*tmp33;
+   tmp46 = A[4][0]*tmp21 - A[4][1]*tmp27 + A[4][3]*tmp32 - A[4][5]*tmp34;
+   tmp47 = A[4][0]*tmp22 - A[4][1]*tmp28 + A[4][3]*tmp33 - A[4][4]*tmp34;
+   tmp48 = A[4][0]*tmp23 - A[4][1]*tmp29 + A[4][2]*tmp32 - A[4][5]*tmp35;
+   tmp49 = A[4][0]*tmp24 - A[4][1]*tmp30 + A[4][2]*tmp33 - A[4][4]*tmp35;
+   tmp50 = A[4][0]*tmp25 - A[4][1]*tmp31 + A[4][2]*tmp34 - A[4][3]*tmp35;
+
+   B[0][3] = A[5][1]*tmp36 - A[5][2]*tmp37 + A[5][3]*tmp38 - A[5][4]*tmp39 + A[5][5]*tmp40;
+   B[1][3] = A[5][2]*tmp41 - A[5][0]*tmp36 - A[5][3]*tmp42 + A[5][4]*tmp43 - A[5][5]*tmp44;
+   B[2][3] = A[5][0]*tmp37 - A[5][1]*tmp41 + A[5][3]*tmp45 - A[5][4]*tmp46 + A[5][5]*tmp47;
+   B[3][3] = A[5][1]*tmp42 - A[5][0]*tmp38 - A[5][2]*tmp45 + A[5][4]*tmp48 - A[5][5]*tmp49;
+   B[4][3] = A[5][0]*tmp39 - A[5][1]*tmp43 + A[5][2]*tmp46 - A[5][3]*tmp48 + A[5][5]*tmp50;
+   B[5][3] = A[5][1]*tmp44 - A[5][0]*tmp40 - A[5][2]*tmp47 + A[5][3]*tmp49 - A[5][4]*tmp50;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a \f$ 2 \times 2 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 2 \times 2 \f$ matrix. The element
+// type \a VT is either a scalar or a SIMD type. In the latter case each SIMD lane holds an
+// element of a different matrix, i.e. the determinants of several matrices are computed at once.
+*/
+template< typename VT >  // Type of the matrix elements
+inline VT batchDeterminant( const VT (&A)[2][2] )
+{
+   return A[0][0]*A[1][1] - A[0][1]*A[1][0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a \f$ 3 \times 3 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 3 \times 3 \f$ matrix via the same
+// rule of Sarrus as the det() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline VT batchDeterminant( const VT (&A)[3][3] )
+{
+   return A[0][0] * ( A[1][1]*A[2][2] - A[1][2]*A[2][1] ) +
+          A[0][1] * ( A[1][2]*A[2][0] - A[1][0]*A[2][2] ) +
+          A[0][2] * ( A[1][0]*A[2][1] - A[1][1]*A[2][0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a \f$ 4 \times 4 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 4 \times 4 \f$ matrix via the same
+// rule of Sarrus as the det() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline VT batchDeterminant( const VT (&A)[4][4] )
+{
+   const VT tmp1( A[2][2]*A[3][3] - A[2][3]*A[3][2] );
+   const VT tmp2( A[2][1]*A[3][3] - A[2][3]*A[3][1] );
+   const VT tmp3( A[2][1]*A[3][2] - A[2][2]*A[3][1] );
+   const VT tmp4( A[2][0]*A[3][3] - A[2][3]*A[3][0] );
+   const VT tmp5( A[2][0]*A[3][2] - A[2][2]*A[3][0] );
+   const VT tmp6( A[2][0]*A[3][1] - A[2][1]*A[3][0] );
+
+   return A[0][0] * ( A[1][1] * tmp1 - A[1][2] * tmp2 + A[1][3] * tmp3 ) -
+          A[0][1] * ( A[1][0] * tmp1 - A[1][2] * tmp4 + A[1][3] * tmp5 ) +
+          A[0][2] * ( A[1][0] * tmp2 - A[1][1] * tmp4 + A[1][3] * tmp6 ) -
+          A[0][3] * ( A[1][0] * tmp3 - A[1][1] * tmp5 + A[1][2] * tmp6 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a \f$ 5 \times 5 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 5 \times 5 \f$ matrix via the same
+// rule of Sarrus as the det() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline VT batchDeterminant( const VT (&A)[5][5] )
+{
+   const VT tmp1 ( A[3][3]*A[4][4] - A[3][4]*A[4][3] );
+   const VT tmp2 ( A[3][2]*A[4][4] - A[3][4]*A[4][2] );
+   const VT tmp3 ( A[3][2]*A[4][3] - A[3][3]*A[4][2] );
+   const VT tmp4 ( A[3][1]*A[4][4] - A[3][4]*A[4][1] );
+   const VT tmp5 ( A[3][1]*A[4][3] - A[3][3]*A[4][1] );
+   const VT tmp6 ( A[3][1]*A[4][2] - A[3][2]*A[4][1] );
+   const VT tmp7 ( A[3][0]*A[4][4] - A[3][4]*A[4][0] );
+   const VT tmp8 ( A[3][0]*A[4][3] - A[3][3]*A[4][0] );
+   const VT tmp9 ( A[3][0]*A[4][2] - A[3][2]*A[4][0] );
+   const VT tmp10( A[3][0]*A[4][1] - A[3][1]*A[4][0] );
+
+   const VT tmp11( A[2][2]*tmp1 - A[2][3]*tmp2 + A[2][4]*tmp3 );
+   const VT tmp12( A[2][1]*tmp1 - A[2][3]*tmp4 + A[2][4]*tmp5 );
+   const VT tmp13( A[2][1]*tmp2 - A[2][2]*tmp4 + A[2][4]*tmp6 );
+   const VT tmp14( A[2][1]*tmp3 - A[2][2]*tmp5 + A[2][3]*tmp6 );
+   const VT tmp15( A[2][0]*tmp1 - A[2][3]*tmp7 + A[2][4]*tmp8 );
+   const VT tmp16( A[2][0]*tmp2 - A[2][2]*tmp7 + A[2][4]*tmp9 );
+   const VT tmp17( A[2][0]*tmp3 - A[2][2]*tmp8 + A[2][3]*tmp9 );
+   const VT tmp18( A[2][0]*tmp4 - A[2][1]*tmp7 + A[2][4]*tmp10 );
+   const VT tmp19( A[2][0]*tmp5 - A[2][1]*tmp8 + A[2][3]*tmp10 );
+   const VT tmp20( A[2][0]*tmp6 - A[2][1]*tmp9 + A[2][2]*tmp10 );
+
+   return A[0][0] * ( A[1][1]*tmp11 - A[1][2]*tmp12 + A[1][3]*tmp13 - A[1][4]*tmp14 ) -
+          A[0][1] * ( A[1][0]*tmp11 - A[1][2]*tmp15 + A[1][3]*tmp16 - A[1][4]*tmp17 ) +
+          A[0][2] * ( A[1][0]*tmp12 - A[1][1]*tmp15 + A[1][3]*tmp18 - A[1][4]*tmp19 ) -
+          A[0][3] * ( A[1][0]*tmp13 - A[1][1]*tmp16 + A[1][2]*tmp18 - A[1][4]*tmp20 ) +
+          A[0][4] * ( A[1][0]*tmp14 - A[1][1]*tmp17 + A[1][2]*tmp19 - A[1][3]*tmp20 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a \f$ 6 \times 6 \f$ matrix.
+// \ingroup dense
+//
+// \param A The given matrix.
+// \return The determinant of the given matrix.
+//
+// This function computes the determinant of the given \f$ 6 \times 6 \f$ matrix via the same
+// rule of Sarrus as the det() function. The element type \a VT is either a scalar or a SIMD type.
+*/
+template< typename VT >  // Type of the matrix elements
+inline VT batchDeterminant( const VT (&A)[6][6] )
+{
+   const VT tmp1 ( A[4][4]*A[5][5] - A[4][5]*A[5][4] );
+   const VT tmp2 ( A[4][3]*A[5][5] - A[4][5]*A[5][3] );
+   const VT tmp3 ( A[4][3]*A[5][4] - A[4][4]*A[5][3] );
+   const VT tmp4 ( A[4][2]*A[5][5] - A[4][5]*A[5][2] );
+   const VT tmp5 ( A[4][2]*A[5][4] - A[4][4]*A[5][2] );
+   const VT tmp6 ( A[4][2]*A[5][3] - A[4][3]*A[5][2] );
+   const VT tmp7 ( A[4][1]*A[5][5] - A[4][5]*A[5][1] );
+   const VT tmp8 ( A[4][1]*A[5][4] - A[4][4]*A[5][1] );
+   const VT tmp9 ( A[4][1]*A[5][3] - A[4][3]*A[5][1] );
+   const VT tmp10( A[4][1]*A[5][2] - A[4][2]*A[5][1] );
+   const VT tmp11( A[4][0]*A[5][5] - A[4][5]*A[5][0] );
+   const VT tmp12( A[4][0]*A[5][4] - A[4][4]*A[5][0] );
+   const VT tmp13( A[4][0]*A[5][3] - A[4][3]*A[5][0] );
+   const VT tmp14( A[4][0]*A[5][2] - A[4][2]*A[5][0] );
+   const VT tmp15( A[4][0]*A[5][1] - A[4][1]*A[5][0] );
+
+   const VT tmp16( A[3][3]*tmp1 - A[3][4]*tmp2 + A[3][5]*tmp3 );
+   const VT tmp17( A[3][2]*tmp1 - A[3][4]*tmp4 + A[3][5]*tmp5 );
+   const VT tmp18( A[3][2]*tmp2 - A[3][3]*tmp4 + A[3][5]*tmp6 );
+   const VT tmp19( A[3][2]*tmp3 - A[3][3]*tmp5 + A[3][4]*tmp6 );
+   const VT tmp20( A[3][1]*tmp1 - A[3][4]*tmp7 + A[3][5]*tmp8 );
+   const VT tmp21( A[3][1]*tmp2 - A[3][3]*tmp7 + A[3][5]*tmp9 );
+   const VT tmp22( A[3][1]*tmp3 - A[3][3]*tmp8 + A[3][4]*tmp9 );
+   const VT tmp23( A[3][1]*tmp4 - A[3][2]*tmp7 + A[3][5]*tmp10 );
+   const VT tmp24( A[3][1]*tmp5 - A[3][2]*tmp8 + A[3][4]*tmp10 );
+   const VT tmp25( A[3][1]*tmp6 - A[3][2]*tmp9 + A[3][3]*tmp10 );
+   const VT tmp26( A[3][0]*tmp1 - A[3][4]*tmp11 + A[3][5]*tmp12 );
+   const VT tmp27( A[3][0]*tmp2 - A[3][3]*tmp11 + A[3][5]*tmp13 );
+   const VT tmp28( A[3][0]*tmp3 - A[3][3]*tmp12 + A[3][4]*tmp13 );
+   const VT tmp29( A[3][0]*tmp4 - A[3][2]*tmp11 + A[3][5]*tmp14 );
+   const VT tmp30( A[3][0]*tmp5 - A[3][2]*tmp12 + A[3][4]*tmp14 );
+   const VT tmp31( A[3][0]*tmp6 - A[3][2]*tmp13 + A[3][3]*tmp14 );
+   const VT tmp32( A[3][0]*tmp7 - A[3][1]*tmp11 + A[3][5]*tmp15 );
+   const VT tmp33( A[3][0]*tmp8 - A[3][1]*tmp12 + A[3][4]*tmp15 );
+   const VT tmp34( A[3][0]*tmp9 - A[3][1]*tmp13 + A[3][3]*tmp15 );
+   const VT tmp35( A[3][0]*tmp10 - A[3][1]*tmp14 + A[3][2]*tmp15 );
+
+   const VT tmp36( A[2][2]*tmp16 - A[2][3]*tmp17 + A[2][4]*tmp18 - A[2][5]*tmp19 );
+   const VT tmp37( A[2][1]*tmp16 - A[2][3]*tmp20 + A[2][4]*tmp21 - A[2][5]*tmp22 );
+   const VT tmp38( A[2][1]*tmp17 - A[2][2]*tmp20 + A[2][4]*tmp23 - A[2][5]*tmp24 );
+   const VT tmp39( A[2][1]*tmp18 - A[2][2]*tmp21 + A[2][3]*tmp23 - A[2][5]*tmp25 );
+   const VT tmp40( A[2][1]*tmp19 - A[2][2]*tmp22 + A[2][3]*tmp24 - A[2][4]*tmp25 );
+   const VT tmp41( A[2][0]*tmp16 - A[2][3]*tmp26 + A[2][4]*tmp27 - A[2][5]*tmp28 );
+   const VT tmp42( A[2][0]*tmp17 - A[2][2]*tmp26 + A[2][4]*tmp29 - A[2][5]*tmp30 );
+   const VT tmp43( A[2][0]*tmp18 - A[2][2]*tmp27 + A[2][3]*tmp29 - A[2][5]*tmp31 );
+   const VT tmp44( A[2][0]*tmp19 - A[2][2]*tmp28 + A[2][3]*tmp30 - A[2][4]*tmp31 );
+   const VT tmp45( A[2][0]*tmp20 - A[2][1]*tmp26 + A[2][4]*tmp32 - A[2][5]*tmp33 );
+   const VT tmp46( A[2][0]*tmp21 - A[2][1]*tmp27 + A[2][3]*tmp32 - A[2][5]*tmp34 );
+   const VT tmp47( A[2][0]*tmp22 - A[2][1]*tmp28 + A[2][3]*tmp33 - A[2][4]*tmp34 );
+   const VT tmp48( A[2][0]*tmp23 - A[2][1]*tmp29 + A[2][2]*tmp32 - A[2][5]*tmp35 );
+   const VT tmp49( A[2][0]*tmp24 - A[2][1]*tmp30 + A[2][2]*tmp33 - A[2][4]*tmp35 );
+   const VT tmp50( A[2][0]*tmp25 - A[2][1]*tmp31 + A[2][2]*tmp34 - A[2][3]*tmp35 );
+
+   return A[0][0] * ( A[1][1]*tmp36 - A[1][2]*tmp37 + A[1][3]*tmp38 - A[1][4]*tmp39 + A[1][5]*tmp40 ) -
+          A[0][1] * ( A[1][0]*tmp36 - A[1][2]*tmp41 + A[1][3]*tmp42 - A[1][4]*tmp43 + A[1][5]*tmp44 ) +
+          A[0][2] * ( A[1][0]*tmp37 - A[1][1]*tmp41 + A[1][3]*tmp45 - A[1][4]*tmp46 + A[1][5]*tmp47 ) -
+          A[0][3] * ( A[1][0]*tmp38 - A[1][1]*tmp42 + A[1][2]*tmp45 - A[1][4]*tmp48 + A[1][5]*tmp49 ) +
+          A[0][4] * ( A[1][0]*tmp39 - A[1][1]*tmp43 + A[1][2]*tmp46 - A[1][3]*tmp48 + A[1][5]*tmp50 ) -
+          A[0][5] * ( A[1][0]*tmp40 - A[1][1]*tmp44 + A[1][2]*tmp47 - A[1][3]*tmp49 + A[1][4]*tmp50 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the batched determinant kernels.
+// \ingroup dense
+//
+// In case the given element type is suited for a vectorized batched computation of determinants,
+// where each SIMD lane processes one matrix of the batch, the nested \a value will be set to 1,
+// otherwise it will be 0.
+*/
+template< typename T >  // Element type
+struct UseVectorizedBatchDetKernel
+   : public And< UseVectorizedBatchKernel<T>
+               , HasSIMDSub<T,T> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the batched inversion and solution kernels.
+// \ingroup dense
+//
+// In case the given element type is suited for a vectorized batched inversion, where each SIMD
+// lane processes one matrix of the batch, the nested \a value will be set to 1, otherwise it
+// will be 0.
+*/
+template< typename T >  // Element type
+struct UseVectorizedBatchInversionKernel
+   : public And< UseVectorizedBatchKernel<T>
+               , HasSIMDSub<T,T>
+               , HasSIMDDiv<T,T> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks all lanes of the given SIMD value for being valid divisors.
+// \ingroup dense
+//
+// \param value The given SIMD value.
+// \return \a true in case all lanes are valid divisors, \a false if not.
+*/
+template< typename T          // Element type
+        , typename SIMDType >  // SIMD type of the given value
+BLAZE_ALWAYS_INLINE bool batchIsDivisor( const SIMDType& value )
+{
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   AlignedArray<T,SIMDSIZE> tmp;
+   storea( tmp.data(), value );
+
+   for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+      if( !isDivisor( tmp[k] ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a single matrix of a batch.
+// \ingroup dense
+//
+// \param A Pointer to the matrix within the first plane.
+// \param lda The spacing between two planes of the matrices.
+// \return The determinant of the matrix.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+inline T batchDetLane( const T* A, size_t lda )
+{
+   T a[N][N];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = A[(i*N+j)*lda];
+
+   return batchDeterminant( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a single matrix of a batch.
+// \ingroup dense
+//
+// \param A Pointer to the matrix within the first plane.
+// \param lda The spacing between two planes of the matrices.
+// \return \a true in case the inversion succeeded, \a false if the matrix is singular.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+inline bool batchInvertLane( T* A, size_t lda )
+{
+   T a[N][N], b[N][N];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = A[(i*N+j)*lda];
+
+   batchAdjugate( a, b );
+
+   T det( a[0UL][0UL] * b[0UL][0UL] );
+   for( size_t j=1UL; j<N; ++j )
+      det += a[0UL][j] * b[j][0UL];
+
+   if( !isDivisor( det ) )
+      return false;
+
+   const T idet( T(1) / det );
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         A[(i*N+j)*lda] = b[i][j] * idet;
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a single linear system of a batch.
+// \ingroup dense
+//
+// \param x Pointer to the solution vector within the first plane.
+// \param ldx The spacing between two planes of the solution vectors.
+// \param A Pointer to the system matrix within the first plane.
+// \param lda The spacing between two planes of the system matrices.
+// \param b Pointer to the right-hand side vector within the first plane.
+// \param ldb The spacing between two planes of the right-hand side vectors.
+// \return \a true in case the solution succeeded, \a false if the matrix is singular.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+inline bool batchSolveLane( T* x, size_t ldx, const T* A, size_t lda, const T* b, size_t ldb )
+{
+   T a[N][N], adj[N][N], v[N];
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = A[(i*N+j)*lda];
+      v[i] = b[i*ldb];
+   }
+
+   batchAdjugate( a, adj );
+
+   T det( a[0UL][0UL] * adj[0UL][0UL] );
+   for( size_t j=1UL; j<N; ++j )
+      det += a[0UL][j] * adj[j][0UL];
+
+   if( !isDivisor( det ) )
+      return false;
+
+   const T idet( T(1) / det );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      T tmp( adj[i][0UL] * v[0UL] );
+      for( size_t j=1UL; j<N; ++j )
+         tmp += adj[i][j] * v[j];
+      x[i*ldx] = tmp * idet;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the batched computation of determinants.
+// \ingroup dense
+//
+// \param d Pointer to the first target determinant.
+// \param A Pointer to the first plane of the matrices.
+// \param lda The spacing between two planes of the matrices.
+// \param n The number of matrices.
+// \return void
+//
+// This function computes the determinants of \a n matrices stored in the plane (structure-of-
+// arrays) layout of the MatrixBatch class template.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE DisableIf_< UseVectorizedBatchDetKernel<T> >
+   batchDetKernel( T* d, const T* A, size_t lda, size_t n )
+{
+   for( size_t l=0UL; l<n; ++l )
+      d[l] = batchDetLane<N>( A+l, lda );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the batched computation of determinants.
+// \ingroup dense
+//
+// \param d Pointer to the first target determinant.
+// \param A Pointer to the first plane of the matrices.
+// \param lda The spacing between two planes of the matrices.
+// \param n The number of matrices.
+// \return void
+//
+// This function computes the determinants of \a n matrices stored in the plane (structure-of-
+// arrays) layout of the MatrixBatch class template. Each SIMD lane computes the determinant of
+// a different matrix, the remaining matrices that don't fill an entire SIMD vector are handled
+// individually. Both the planes and the target array have to be properly aligned.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE EnableIf_< UseVectorizedBatchDetKernel<T> >
+   batchDetKernel( T* d, const T* A, size_t lda, size_t n )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   BLAZE_INTERNAL_ASSERT( lda % SIMDSIZE == 0UL, "Invalid spacing of the matrix planes" );
+
+   size_t l( 0UL );
+
+   for( ; (l+SIMDSIZE) <= n; l+=SIMDSIZE )
+   {
+      SIMDType a[N][N];
+
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            a[i][j] = loada( A+(i*N+j)*lda+l );
+
+      storea( d+l, batchDeterminant( a ) );
+   }
+
+   for( ; l<n; ++l )
+      d[l] = batchDetLane<N>( A+l, lda );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the batched in-place inversion of small matrices.
+// \ingroup dense
+//
+// \param A Pointer to the first plane of the matrices.
+// \param lda The spacing between two planes of the matrices.
+// \param n The number of matrices.
+// \return \a true in case all inversions succeeded, \a false if a singular matrix is detected.
+//
+// This function inverts \a n matrices stored in the plane (structure-of-arrays) layout of the
+// MatrixBatch class template.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE DisableIf_< UseVectorizedBatchInversionKernel<T>, bool >
+   batchInvertKernel( T* A, size_t lda, size_t n )
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      if( !batchInvertLane<N>( A+l, lda ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the batched in-place inversion of small matrices.
+// \ingroup dense
+//
+// \param A Pointer to the first plane of the matrices.
+// \param lda The spacing between two planes of the matrices.
+// \param n The number of matrices.
+// \return \a true in case all inversions succeeded, \a false if a singular matrix is detected.
+//
+// This function inverts \a n matrices stored in the plane (structure-of-arrays) layout of the
+// MatrixBatch class template. Each SIMD lane inverts a different matrix, the remaining matrices
+// that don't fill an entire SIMD vector are inverted individually. All planes have to be
+// properly aligned.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE EnableIf_< UseVectorizedBatchInversionKernel<T>, bool >
+   batchInvertKernel( T* A, size_t lda, size_t n )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   BLAZE_INTERNAL_ASSERT( lda % SIMDSIZE == 0UL, "Invalid spacing of the matrix planes" );
+
+   const SIMDType one( set( T(1) ) );
+
+   size_t l( 0UL );
+
+   for( ; (l+SIMDSIZE) <= n; l+=SIMDSIZE )
+   {
+      SIMDType a[N][N], b[N][N];
+
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            a[i][j] = loada( A+(i*N+j)*lda+l );
+
+      batchAdjugate( a, b );
+
+      SIMDType det( a[0UL][0UL] * b[0UL][0UL] );
+      for( size_t j=1UL; j<N; ++j )
+         det = det + a[0UL][j] * b[j][0UL];
+
+      if( !batchIsDivisor<T>( det ) )
+         return false;
+
+      const SIMDType idet( one / det );
+
+      for( size_t i=0UL; i<N; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            storea( A+(i*N+j)*lda+l, b[i][j] * idet );
+   }
+
+   for( ; l<n; ++l ) {
+      if( !batchInvertLane<N>( A+l, lda ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the batched solution of small linear systems
+//        (\f$ A_k*\vec{x}_k=\vec{b}_k \f$).
+// \ingroup dense
+//
+// \param x Pointer to the first plane of the solution vectors.
+// \param ldx The spacing between two planes of the solution vectors.
+// \param A Pointer to the first plane of the system matrices.
+// \param lda The spacing between two planes of the system matrices.
+// \param b Pointer to the first plane of the right-hand side vectors.
+// \param ldb The spacing between two planes of the right-hand side vectors.
+// \param n The number of linear systems.
+// \return \a true in case all systems were solved, \a false if a singular matrix is detected.
+//
+// This function solves \a n linear systems stored in the plane (structure-of-arrays) layout of
+// the MatrixBatch and VectorBatch class templates.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE DisableIf_< UseVectorizedBatchInversionKernel<T>, bool >
+   batchSolveKernel( T* x, size_t ldx, const T* A, size_t lda, const T* b, size_t ldb, size_t n )
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      if( !batchSolveLane<N>( x+l, ldx, A+l, lda, b+l, ldb ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the batched solution of small linear systems
+//        (\f$ A_k*\vec{x}_k=\vec{b}_k \f$).
+// \ingroup dense
+//
+// \param x Pointer to the first plane of the solution vectors.
+// \param ldx The spacing between two planes of the solution vectors.
+// \param A Pointer to the first plane of the system matrices.
+// \param lda The spacing between two planes of the system matrices.
+// \param b Pointer to the first plane of the right-hand side vectors.
+// \param ldb The spacing between two planes of the right-hand side vectors.
+// \param n The number of linear systems.
+// \return \a true in case all systems were solved, \a false if a singular matrix is detected.
+//
+// This function solves \a n linear systems stored in the plane (structure-of-arrays) layout of
+// the MatrixBatch and VectorBatch class templates. Each SIMD lane solves a different system,
+// the remaining systems that don't fill an entire SIMD vector are solved individually. All
+// planes have to be properly aligned. The solution and right-hand side planes may coincide.
+*/
+template< size_t N      // Number of rows and columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE EnableIf_< UseVectorizedBatchInversionKernel<T>, bool >
+   batchSolveKernel( T* x, size_t ldx, const T* A, size_t lda, const T* b, size_t ldb, size_t n )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   BLAZE_INTERNAL_ASSERT( ldx % SIMDSIZE == 0UL, "Invalid spacing of the solution planes"        );
+   BLAZE_INTERNAL_ASSERT( lda % SIMDSIZE == 0UL, "Invalid spacing of the matrix planes"          );
+   BLAZE_INTERNAL_ASSERT( ldb % SIMDSIZE == 0UL, "Invalid spacing of the right-hand side planes" );
+
+   const SIMDType one( set( T(1) ) );
+
+   size_t l( 0UL );
+
+   for( ; (l+SIMDSIZE) <= n; l+=SIMDSIZE )
+   {
+      SIMDType a[N][N], adj[N][N], v[N];
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<N; ++j )
+            a[i][j] = loada( A+(i*N+j)*lda+l );
+         v[i] = loada( b+i*ldb+l );
+      }
+
+      batchAdjugate( a, adj );
+
+      SIMDType det( a[0UL][0UL] * adj[0UL][0UL] );
+      for( size_t j=1UL; j<N; ++j )
+         det = det + a[0UL][j] * adj[j][0UL];
+
+      if( !batchIsDivisor<T>( det ) )
+         return false;
+
+      const SIMDType idet( one / det );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         SIMDType tmp( adj[i][0UL] * v[0UL] );
+         for( size_t j=1UL; j<N; ++j )
+            tmp = tmp + adj[i][j] * v[j];
+         storea( x+i*ldx+l, tmp * idet );
+      }
+   }
+
+   for( ; l<n; ++l ) {
+      if( !batchSolveLane<N>( x+l, ldx, A+l, lda, b+l, ldb ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the computation of the determinants of the matrices of a batch.
+// \ingroup dense
+//
+// This functor computes the determinants of a block of the matrices of a matrix batch. It is
+// used in combination with the smpBatch() function.
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of rows and columns of the matrices
+struct MatrixBatchDet
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MatrixBatchDet class template.
+   //
+   // \param d Pointer to the first target determinant.
+   // \param A The matrix batch.
+   */
+   explicit inline MatrixBatchDet( T* d, const MatrixBatch<T,N,N>& A )
+      : d_( d )  // Pointer to the first target determinant
+      , A_( A )  // The matrix batch
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the determinants of the given block of matrices.
+   //
+   // \param index The index of the first matrix of the block.
+   // \param n The number of matrices of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      batchDetKernel<N>( d_+index, A_.data()+index, A_.spacing(), n );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T*                        d_;  //!< Pointer to the first target determinant.
+   const MatrixBatch<T,N,N>& A_;  //!< The matrix batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the in-place inversion of the matrices of a batch.
+// \ingroup dense
+//
+// This functor inverts a block of the matrices of a matrix batch. It is used in combination
+// with the smpBatch() function.
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of rows and columns of the matrices
+struct MatrixBatchInversion
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MatrixBatchInversion class template.
+   //
+   // \param A The matrix batch.
+   // \param singular Flag to be set in case a singular matrix is detected.
+   */
+   explicit inline MatrixBatchInversion( MatrixBatch<T,N,N>& A, std::atomic<bool>& singular )
+      : A_       ( A        )  // The matrix batch
+      , singular_( singular )  // Flag to be set in case a singular matrix is detected
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Inverts the given block of matrices.
+   //
+   // \param index The index of the first matrix of the block.
+   // \param n The number of matrices of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      if( !batchInvertKernel<N>( A_.data()+index, A_.spacing(), n ) )
+         singular_ = true;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MatrixBatch<T,N,N>& A_;         //!< The matrix batch.
+   std::atomic<bool>&  singular_;  //!< Flag to be set in case a singular matrix is detected.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the solution of the linear systems of a matrix and a vector batch.
+// \ingroup dense
+//
+// This functor solves a block of the linear systems given by a matrix batch and a vector batch.
+// It is used in combination with the smpBatch() function.
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of rows and columns of the matrices
+struct VectorBatchSolve
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the VectorBatchSolve class template.
+   //
+   // \param x The solution vector batch.
+   // \param A The matrix batch.
+   // \param b The right-hand side vector batch.
+   // \param singular Flag to be set in case a singular matrix is detected.
+   */
+   explicit inline VectorBatchSolve( VectorBatch<T,N>& x, const MatrixBatch<T,N,N>& A,
+                                     const VectorBatch<T,N>& b, std::atomic<bool>& singular )
+      : x_       ( x        )  // The solution vector batch
+      , A_       ( A        )  // The matrix batch
+      , b_       ( b        )  // The right-hand side vector batch
+      , singular_( singular )  // Flag to be set in case a singular matrix is detected
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Solves the given block of linear systems.
+   //
+   // \param index The index of the first linear system of the block.
+   // \param n The number of linear systems of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      if( !batchSolveKernel<N>( x_.data()+index, x_.spacing(), A_.data()+index, A_.spacing(),
+                                b_.data()+index, b_.spacing(), n ) )
+         singular_ = true;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VectorBatch<T,N>&         x_;         //!< The solution vector batch.
+   const MatrixBatch<T,N,N>& A_;         //!< The matrix batch.
+   const VectorBatch<T,N>&   b_;         //!< The right-hand side vector batch.
+   std::atomic<bool>&        singular_;  //!< Flag to be set in case a singular matrix is detected.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the computation of the determinants of an array of static matrices.
+// \ingroup dense
+//
+// This functor computes the determinants of a block of the elements of an array of StaticMatrix
+// instances. It is used in combination with the smpBatch() function. The matrices are processed
+// in tiles of one matrix per SIMD lane, which are transposed into the plane layout of the
+// MatrixBatch class template on the fly.
+*/
+template< typename T  // Element type
+        , size_t N    // Number of rows and columns of the matrices
+        , bool SO >   // Storage order of the matrices
+struct StaticMatrixBatchDet
+{
+   //**Type definitions****************************************************************************
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the StaticMatrixBatchDet class template.
+   //
+   // \param d Pointer to the first target determinant.
+   // \param A Pointer to the first matrix.
+   */
+   explicit inline StaticMatrixBatchDet( T* d, const StaticMatrix<T,N,N,SO>* A )
+      : d_( d )  // Pointer to the first target determinant
+      , A_( A )  // Pointer to the first matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the determinants of the given block of matrices.
+   //
+   // \param index The index of the first matrix of the block.
+   // \param n The number of matrices of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const
+   {
+      AlignedArray<T,N*N*SIMDSIZE> tile;
+      AlignedArray<T,SIMDSIZE> det;
+
+      for( size_t l=index; l<index+n; l+=SIMDSIZE )
+      {
+         const size_t m( min( SIMDSIZE, index+n-l ) );
+
+         for( size_t k=0UL; k<m; ++k )
+            for( size_t i=0UL; i<N; ++i )
+               for( size_t j=0UL; j<N; ++j )
+                  tile[(i*N+j)*SIMDSIZE+k] = A_[l+k](i,j);
+
+         batchDetKernel<N>( det.data(), tile.data(), SIMDSIZE, m );
+
+         for( size_t k=0UL; k<m; ++k )
+            d_[l+k] = det[k];
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T*                            d_;  //!< Pointer to the first target determinant.
+   const StaticMatrix<T,N,N,SO>* A_;  //!< Pointer to the first matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the in-place inversion of the elements of an array of static
+//        matrices.
+// \ingroup dense
+//
+// This functor inverts a block of the elements of an array of StaticMatrix instances. It is
+// used in combination with the smpBatch() function. The matrices are processed in tiles of
+// one matrix per SIMD lane, which are transposed into the plane layout of the MatrixBatch
+// class template on the fly.
+*/
+template< typename T  // Element type
+        , size_t N    // Number of rows and columns of the matrices
+        , bool SO >   // Storage order of the matrices
+struct StaticMatrixBatchInversion
+{
+   //**Type definitions****************************************************************************
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the StaticMatrixBatchInversion class template.
+   //
+   // \param A Pointer to the first matrix.
+   // \param singular Flag to be set in case a singular matrix is detected.
+   */
+   explicit inline StaticMatrixBatchInversion( StaticMatrix<T,N,N,SO>* A,
+                                               std::atomic<bool>& singular )
+      : A_       ( A        )  // Pointer to the first matrix
+      , singular_( singular )  // Flag to be set in case a singular matrix is detected
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Inverts the given block of matrices.
+   //
+   // \param index The index of the first matrix of the block.
+   // \param n The number of matrices of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const
+   {
+      AlignedArray<T,N*N*SIMDSIZE> tile;
+
+      for( size_t l=index; l<index+n; l+=SIMDSIZE )
+      {
+         const size_t m( min( SIMDSIZE, index+n-l ) );
+
+         for( size_t k=0UL; k<m; ++k )
+            for( size_t i=0UL; i<N; ++i )
+               for( size_t j=0UL; j<N; ++j )
+                  tile[(i*N+j)*SIMDSIZE+k] = A_[l+k](i,j);
+
+         if( !batchInvertKernel<N>( tile.data(), SIMDSIZE, m ) ) {
+            singular_ = true;
+            return;
+         }
+
+         for( size_t k=0UL; k<m; ++k )
+            for( size_t i=0UL; i<N; ++i )
+               for( size_t j=0UL; j<N; ++j )
+                  A_[l+k](i,j) = tile[(i*N+j)*SIMDSIZE+k];
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   StaticMatrix<T,N,N,SO>* A_;         //!< Pointer to the first matrix.
+   std::atomic<bool>&      singular_;  //!< Flag to be set in case a singular matrix is detected.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the solution of the linear systems given by arrays of static
+//        matrices and vectors.
+// \ingroup dense
+//
+// This functor solves a block of the linear systems given by an array of StaticMatrix instances
+// and an array of StaticVector instances. It is used in combination with the smpBatch()
+// function. The systems are processed in tiles of one system per SIMD lane, which are
+// transposed into the plane layout of the MatrixBatch and VectorBatch class templates on the
+// fly.
+*/
+template< typename T  // Element type
+        , size_t N    // Number of rows and columns of the matrices
+        , bool SO >   // Storage order of the matrices
+struct StaticVectorBatchSolve
+{
+   //**Type definitions****************************************************************************
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the StaticVectorBatchSolve class template.
+   //
+   // \param x Pointer to the first solution vector.
+   // \param A Pointer to the first matrix.
+   // \param b Pointer to the first right-hand side vector.
+   // \param singular Flag to be set in case a singular matrix is detected.
+   */
+   explicit inline StaticVectorBatchSolve( StaticVector<T,N,columnVector>* x,
+                                           const StaticMatrix<T,N,N,SO>* A,
+                                           const StaticVector<T,N,columnVector>* b,
+                                           std::atomic<bool>& singular )
+      : x_       ( x        )  // Pointer to the first solution vector
+      , A_       ( A        )  // Pointer to the first matrix
+      , b_       ( b        )  // Pointer to the first right-hand side vector
+      , singular_( singular )  // Flag to be set in case a singular matrix is detected
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Solves the given block of linear systems.
+   //
+   // \param index The index of the first linear system of the block.
+   // \param n The number of linear systems of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const
+   {
+      AlignedArray<T,N*N*SIMDSIZE> tile;
+      AlignedArray<T,N*SIMDSIZE> vec;
+
+      for( size_t l=index; l<index+n; l+=SIMDSIZE )
+      {
+         const size_t m( min( SIMDSIZE, index+n-l ) );
+
+         for( size_t k=0UL; k<m; ++k ) {
+            for( size_t i=0UL; i<N; ++i ) {
+               for( size_t j=0UL; j<N; ++j )
+                  tile[(i*N+j)*SIMDSIZE+k] = A_[l+k](i,j);
+               vec[i*SIMDSIZE+k] = b_[l+k][i];
+            }
+         }
+
+         if( !batchSolveKernel<N>( vec.data(), SIMDSIZE, tile.data(), SIMDSIZE,
+                                   vec.data(), SIMDSIZE, m ) ) {
+            singular_ = true;
+            return;
+         }
+
+         for( size_t k=0UL; k<m; ++k )
+            for( size_t i=0UL; i<N; ++i )
+               x_[l+k][i] = vec[i*SIMDSIZE+k];
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   StaticVector<T,N,columnVector>*       x_;         //!< Pointer to the first solution vector.
+   const StaticMatrix<T,N,N,SO>*         A_;         //!< Pointer to the first matrix.
+   const StaticVector<T,N,columnVector>* b_;         //!< Pointer to the first right-hand side.
+   std::atomic<bool>&                    singular_;  //!< Singularity flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batch inversion functions */
+//@{
+template< typename T, size_t N, bool TF >
+void batchDet( DynamicVector<T,TF>& d, const MatrixBatch<T,N,N>& A );
+
+template< typename T, size_t N, bool SO >
+void batchDet( T* d, const StaticMatrix<T,N,N,SO>* A, size_t n );
+
+template< typename T, size_t N >
+void batchInvert( MatrixBatch<T,N,N>& A );
+
+template< typename T, size_t N, bool SO >
+void batchInvert( StaticMatrix<T,N,N,SO>* A, size_t n );
+
+template< typename T, size_t N >
+void batchSolve( VectorBatch<T,N>& x, const MatrixBatch<T,N,N>& A, const VectorBatch<T,N>& b );
+
+template< typename T, size_t N, bool SO >
+void batchSolve( StaticVector<T,N,columnVector>* x, const StaticMatrix<T,N,N,SO>* A,
+                 const StaticVector<T,N,columnVector>* b, size_t n );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched computation of the determinants of the matrices of a matrix batch.
+// \ingroup dense
+//
+// \param d The target vector for the determinants.
+// \param A The matrix batch.
+// \return void
+//
+// This function computes the determinants \f$ d_k=det(A_k) \f$ of all matrices of the given
+// batch via the same closed-form expressions as the det() function. The target vector is
+// resized to the size of the batch. In case the element type of the batch is vectorizable,
+// the determinants are computed via SIMD operations, where each SIMD lane computes one
+// determinant. In case the batch is large enough (see the blaze::SMP_BATCH_THRESHOLD), the
+// batch is split across all available threads.
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 10000UL );
+   blaze::DynamicVector<double> d;
+   // ... Initialization of A
+
+   blaze::batchDet( d, A );
+   \endcode
+
+// \note The batched computation of determinants is restricted to matrices of size
+// \f$ 2 \times 2 \f$ up to \f$ 6 \times 6 \f$.
+*/
+template< typename T  // Element type
+        , size_t N    // Number of rows and columns of the matrices
+        , bool TF >   // Transpose flag of the target vector
+void batchDet( DynamicVector<T,TF>& d, const MatrixBatch<T,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && N <= 6UL, "Invalid matrix size for batched determinants" );
+
+   d.resize( A.size(), false );
+
+   smpBatch( A.size(), SIMDTrait<T>::size, MatrixBatchDet<T,N>( d.data(), A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched computation of the determinants of the elements of an array of static matrices.
+// \ingroup dense
+//
+// \param d Pointer to the first element of the target array for the determinants.
+// \param A Pointer to the first element of the array of matrices.
+// \param n The number of matrices.
+// \return void
+//
+// This function computes the determinants \f$ d_k=det(A_k) \f$ for \f$ k \in [0..n-1] \f$ for
+// a contiguous array of StaticMatrix instances. The matrices are vectorized across the batch,
+// i.e. each SIMD lane computes the determinant of a different matrix. For that purpose, tiles of
+// matrices are transposed into a structure-of-arrays layout on the fly. In case the array is
+// large enough (see the blaze::SMP_BATCH_THRESHOLD), it is split across all available threads.
+
+   \code
+   typedef blaze::StaticMatrix<double,3UL,3UL>  M3x3;
+
+   std::vector<M3x3> A( 10000UL );
+   std::vector<double> d( 10000UL );
+   // ... Initialization of A
+
+   blaze::batchDet( d.data(), A.data(), A.size() );
+   \endcode
+
+// Note that the target array has to be sized appropriately by the caller.
+//
+// \note The batched computation of determinants is restricted to matrices of size
+// \f$ 2 \times 2 \f$ up to \f$ 6 \times 6 \f$.
+*/
+template< typename T  // Element type
+        , size_t N    // Number of rows and columns of the matrices
+        , bool SO >   // Storage order of the matrices
+void batchDet( T* d, const StaticMatrix<T,N,N,SO>* A, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && N <= 6UL, "Invalid matrix size for batched determinants" );
+
+   smpBatch( n, SIMDTrait<T>::size, StaticMatrixBatchDet<T,N,SO>( d, A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of all matrices of a matrix batch.
+// \ingroup dense
+//
+// \param A The matrix batch to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all matrices of the given batch via the same closed-form expressions
+// as the invert() function. In case the element type of the batch is vectorizable, the
+// inversions are computed via SIMD operations, where each SIMD lane inverts one matrix. In
+// case the batch is large enough (see the blaze::SMP_BATCH_THRESHOLD), the batch is split
+// across all available threads.
+
+   \code
+   blaze::MatrixBatch<double,6UL,6UL> A( 10000UL );
+   // ... Initialization of A
+
+   blaze::batchInvert( A );
+   \endcode
+
+// In case any of the matrices is singular, a \a std::runtime_error exception is thrown. In
+// this case the content of the batch is unspecified.
+//
+// \note The batched inversion is restricted to matrices of size \f$ 2 \times 2 \f$ up to
+// \f$ 6 \times 6 \f$ with \c float, \c double, \c complex<float> or \c complex<double> element
+// type. The attempt to call the function with matrices of any other element type results in a
+// compile time error!
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of rows and columns of the matrices
+void batchInvert( MatrixBatch<T,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( T );
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && N <= 6UL, "Invalid matrix size for batched inversion" );
+
+   std::atomic<bool> singular( false );
+
+   smpBatch( A.size(), SIMDTrait<T>::size, MatrixBatchInversion<T,N>( A, singular ) );
+
+   if( singular ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the elements of an array of static matrices.
+// \ingroup dense
+//
+// \param A Pointer to the first element of the array of matrices to be inverted.
+// \param n The number of matrices.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the matrices \f$ A_k \f$ for \f$ k \in [0..n-1] \f$ of a contiguous
+// array of StaticMatrix instances. The matrices are vectorized across the batch, i.e. each SIMD
+// lane inverts a different matrix. For that purpose, tiles of matrices are transposed into a
+// structure-of-arrays layout on the fly. In case the array is large enough (see the
+// blaze::SMP_BATCH_THRESHOLD), it is split across all available threads.
+
+   \code
+   typedef blaze::StaticMatrix<double,4UL,4UL>  M4x4;
+
+   std::vector<M4x4> A( 10000UL );
+   // ... Initialization of A
+
+   blaze::batchInvert( A.data(), A.size() );
+   \endcode
+
+// In case any of the matrices is singular, a \a std::runtime_error exception is thrown. In
+// this case the content of the array is unspecified.
+//
+// \note The batched inversion is restricted to matrices of size \f$ 2 \times 2 \f$ up to
+// \f$ 6 \times 6 \f$ with \c float, \c double, \c complex<float> or \c complex<double> element
+// type. The attempt to call the function with matrices of any other element type results in a
+// compile time error!
+*/
+template< typename T  // Element type
+        , size_t N    // Number of rows and columns of the matrices
+        , bool SO >   // Storage order of the matrices
+void batchInvert( StaticMatrix<T,N,N,SO>* A, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( T );
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && N <= 6UL, "Invalid matrix size for batched inversion" );
+
+   std::atomic<bool> singular( false );
+
+   smpBatch( n, SIMDTrait<T>::size, StaticMatrixBatchInversion<T,N,SO>( A, singular ) );
+
+   if( singular ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched solution of the linear systems given by a matrix batch and a vector batch
+//        (\f$ A_k*\vec{x}_k=\vec{b}_k \f$).
+// \ingroup dense
+//
+// \param x The solution vector batch.
+// \param A The matrix batch.
+// \param b The right-hand side vector batch.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the linear systems \f$ A_k*\vec{x}_k=\vec{b}_k \f$ of all matrices and
+// vectors of the two given batches via the closed-form inverses of the matrices. The solution
+// batch is resized to the size of the operand batches and may be the same batch as \a b. In
+// case the element type of the batches is vectorizable, the systems are solved via SIMD
+// operations, where each SIMD lane solves one system. In case the batches are large enough
+// (see the blaze::SMP_BATCH_THRESHOLD), the batch is split across all available threads.
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 10000UL );
+   blaze::VectorBatch<double,3UL> b( 10000UL ), x;
+   // ... Initialization of A and b
+
+   blaze::batchSolve( x, A, b );
+   \endcode
+
+// In case the sizes of the two operand batches don't match, a \a std::invalid_argument
+// exception is thrown. In case any of the matrices is singular, a \a std::runtime_error
+// exception is thrown and the content of the solution batch is unspecified.
+//
+// \note The batched solution is restricted to matrices of size \f$ 2 \times 2 \f$ up to
+// \f$ 6 \times 6 \f$ with \c float, \c double, \c complex<float> or \c complex<double> element
+// type. The attempt to call the function with matrices of any other element type results in a
+// compile time error!
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of rows and columns of the matrices
+void batchSolve( VectorBatch<T,N>& x, const MatrixBatch<T,N,N>& A, const VectorBatch<T,N>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( T );
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && N <= 6UL, "Invalid matrix size for batched solution" );
+
+   if( A.size() != b.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   x.resize( A.size(), false );
+
+   std::atomic<bool> singular( false );
+
+   smpBatch( A.size(), SIMDTrait<T>::size, VectorBatchSolve<T,N>( x, A, b, singular ) );
+
+   if( singular ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched solution of the linear systems given by arrays of static matrices and vectors
+//        (\f$ A_k*\vec{x}_k=\vec{b}_k \f$).
+// \ingroup dense
+//
+// \param x Pointer to the first element of the array of solution vectors.
+// \param A Pointer to the first element of the array of matrices.
+// \param b Pointer to the first element of the array of right-hand side vectors.
+// \param n The number of linear systems.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the linear systems \f$ A_k*\vec{x}_k=\vec{b}_k \f$ for \f$ k \in
+// [0..n-1] \f$ given by contiguous arrays of StaticMatrix and StaticVector instances. The
+// systems are vectorized across the batch, i.e. each SIMD lane solves a different system. For
+// that purpose, tiles of matrices and vectors are transposed into a structure-of-arrays layout
+// on the fly. In case the arrays are large enough (see the blaze::SMP_BATCH_THRESHOLD), they
+// are split across all available threads.
+
+   \code
+   typedef blaze::StaticMatrix<double,6UL,6UL>  M6x6;
+   typedef blaze::StaticVector<double,6UL>      V6;
+
+   std::vector<M6x6> A( 10000UL );
+   std::vector<V6> x( 10000UL ), b( 10000UL );
+   // ... Initialization of A and b
+
+   blaze::batchSolve( x.data(), A.data(), b.data(), x.size() );
+   \endcode
+
+// Note that the arrays have to be sized appropriately by the caller. It is allowed to pass
+// the same array as solution and as right-hand side. In case any of the matrices is singular,
+// a \a std::runtime_error exception is thrown and the content of the solution array is
+// unspecified.
+//
+// \note The batched solution is restricted to matrices of size \f$ 2 \times 2 \f$ up to
+// \f$ 6 \times 6 \f$ with \c float, \c double, \c complex<float> or \c complex<double> element
+// type. The attempt to call the function with matrices of any other element type results in a
+// compile time error!
+*/
+template< typename T  // Element type
+        , size_t N    // Number of rows and columns of the matrices
+        , bool SO >   // Storage order of the matrices
+void batchSolve( StaticVector<T,N,columnVector>* x, const StaticMatrix<T,N,N,SO>* A,
+                 const StaticVector<T,N,columnVector>* b, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( T );
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && N <= 6UL, "Invalid matrix size for batched solution" );
+
+   std::atomic<bool> singular( false );
+
+   smpBatch( n, SIMDTrait<T>::size, StaticVectorBatchSolve<T,N,SO>( x, A, b, singular ) );
+
+   if( singular ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
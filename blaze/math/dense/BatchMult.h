@@ -0,0 +1,749 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchMult.h
+//  \brief Header file for the batched multiplication of small, fixed-size matrices and vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_BATCHMULT_H_
+#define _BLAZE_MATH_DENSE_BATCHMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/dense/MatrixBatch.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/dense/VectorBatch.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the batched multiplication kernels.
+// \ingroup dense
+//
+// In case the given element type is suited for a vectorized batched multiplication, where each
+// SIMD lane processes one matrix of the batch, the nested \a value will be set to 1, otherwise
+// it will be 0.
+*/
+template< typename T >  // Element type
+struct UseVectorizedBatchKernel
+   : public And< Bool< useOptimizedKernels >
+               , IsVectorizable<T>
+               , HasSIMDAdd<T,T>
+               , HasSIMDMult<T,T> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the batched multiplication of small matrices (\f$ C_k=A_k*B_k \f$).
+// \ingroup dense
+//
+// \param C Pointer to the first plane of the target matrices.
+// \param ldc The spacing between two planes of the target matrices.
+// \param A Pointer to the first plane of the left-hand side matrices.
+// \param lda The spacing between two planes of the left-hand side matrices.
+// \param B Pointer to the first plane of the right-hand side matrices.
+// \param ldb The spacing between two planes of the right-hand side matrices.
+// \param n The number of matrix products.
+// \return void
+//
+// This function computes the \a n products \f$ C_k=A_k*B_k \f$ of matrices stored in the plane
+// (structure-of-arrays) layout of the MatrixBatch class template.
+*/
+template< size_t M     // Number of rows of the left-hand side matrices
+        , size_t K     // Number of columns of the left-hand side matrices
+        , size_t N     // Number of columns of the right-hand side matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE DisableIf_< UseVectorizedBatchKernel<T> >
+   batchMultKernel( T* C, size_t ldc, const T* A, size_t lda, const T* B, size_t ldb, size_t n )
+{
+   for( size_t l=0UL; l<n; ++l ) {
+      for( size_t i=0UL; i<M; ++i )
+      {
+         T a[K];
+
+         for( size_t k=0UL; k<K; ++k )
+            a[k] = A[(i*K+k)*lda+l];
+
+         for( size_t j=0UL; j<N; ++j ) {
+            T c( a[0UL] * B[j*ldb+l] );
+            for( size_t k=1UL; k<K; ++k )
+               c += a[k] * B[(k*N+j)*ldb+l];
+            C[(i*N+j)*ldc+l] = c;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the batched multiplication of small matrices (\f$ C_k=A_k*B_k \f$).
+// \ingroup dense
+//
+// \param C Pointer to the first plane of the target matrices.
+// \param ldc The spacing between two planes of the target matrices.
+// \param A Pointer to the first plane of the left-hand side matrices.
+// \param lda The spacing between two planes of the left-hand side matrices.
+// \param B Pointer to the first plane of the right-hand side matrices.
+// \param ldb The spacing between two planes of the right-hand side matrices.
+// \param n The number of matrix products.
+// \return void
+//
+// This function computes the \a n products \f$ C_k=A_k*B_k \f$ of matrices stored in the plane
+// (structure-of-arrays) layout of the MatrixBatch class template. Each SIMD lane computes the
+// product of a different pair of matrices. All planes have to be properly aligned and padded,
+// i.e. the planes have to be readable and writable up to the next multiple of the SIMD width.
+*/
+template< size_t M     // Number of rows of the left-hand side matrices
+        , size_t K     // Number of columns of the left-hand side matrices
+        , size_t N     // Number of columns of the right-hand side matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE EnableIf_< UseVectorizedBatchKernel<T> >
+   batchMultKernel( T* C, size_t ldc, const T* A, size_t lda, const T* B, size_t ldb, size_t n )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   BLAZE_INTERNAL_ASSERT( ldc % SIMDSIZE == 0UL, "Invalid spacing of the target planes"          );
+   BLAZE_INTERNAL_ASSERT( lda % SIMDSIZE == 0UL, "Invalid spacing of the left-hand side planes"  );
+   BLAZE_INTERNAL_ASSERT( ldb % SIMDSIZE == 0UL, "Invalid spacing of the right-hand side planes" );
+
+   for( size_t l=0UL; l<n; l+=SIMDSIZE ) {
+      for( size_t i=0UL; i<M; ++i )
+      {
+         SIMDType a[K];
+
+         for( size_t k=0UL; k<K; ++k )
+            a[k] = loada( A+(i*K+k)*lda+l );
+
+         for( size_t j=0UL; j<N; ++j ) {
+            SIMDType c;
+            for( size_t k=0UL; k<K; ++k )
+               c = c + a[k] * loada( B+(k*N+j)*ldb+l );
+            storea( C+(i*N+j)*ldc+l, c );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the batched multiplication of small matrices and vectors
+//        (\f$ \vec{y}_k=A_k*\vec{x}_k \f$).
+// \ingroup dense
+//
+// \param y Pointer to the first plane of the target vectors.
+// \param ldy The spacing between two planes of the target vectors.
+// \param A Pointer to the first plane of the matrices.
+// \param lda The spacing between two planes of the matrices.
+// \param x Pointer to the first plane of the right-hand side vectors.
+// \param ldx The spacing between two planes of the right-hand side vectors.
+// \param n The number of matrix/vector products.
+// \return void
+//
+// This function computes the \a n products \f$ \vec{y}_k=A_k*\vec{x}_k \f$ of matrices and
+// vectors stored in the plane (structure-of-arrays) layout of the MatrixBatch and VectorBatch
+// class templates.
+*/
+template< size_t M     // Number of rows of the matrices
+        , size_t N     // Number of columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE DisableIf_< UseVectorizedBatchKernel<T> >
+   batchMultKernel( T* y, size_t ldy, const T* A, size_t lda, const T* x, size_t ldx, size_t n )
+{
+   for( size_t l=0UL; l<n; ++l )
+   {
+      T b[N], c[M];
+
+      for( size_t j=0UL; j<N; ++j )
+         b[j] = x[j*ldx+l];
+
+      for( size_t i=0UL; i<M; ++i ) {
+         c[i] = A[i*N*lda+l] * b[0UL];
+         for( size_t j=1UL; j<N; ++j )
+            c[i] += A[(i*N+j)*lda+l] * b[j];
+      }
+
+      for( size_t i=0UL; i<M; ++i )
+         y[i*ldy+l] = c[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the batched multiplication of small matrices and vectors
+//        (\f$ \vec{y}_k=A_k*\vec{x}_k \f$).
+// \ingroup dense
+//
+// \param y Pointer to the first plane of the target vectors.
+// \param ldy The spacing between two planes of the target vectors.
+// \param A Pointer to the first plane of the matrices.
+// \param lda The spacing between two planes of the matrices.
+// \param x Pointer to the first plane of the right-hand side vectors.
+// \param ldx The spacing between two planes of the right-hand side vectors.
+// \param n The number of matrix/vector products.
+// \return void
+//
+// This function computes the \a n products \f$ \vec{y}_k=A_k*\vec{x}_k \f$ of matrices and
+// vectors stored in the plane (structure-of-arrays) layout of the MatrixBatch and VectorBatch
+// class templates. Each SIMD lane computes the product of a different matrix/vector pair. All
+// planes have to be properly aligned and padded, i.e. the planes have to be readable and
+// writable up to the next multiple of the SIMD width.
+*/
+template< size_t M     // Number of rows of the matrices
+        , size_t N     // Number of columns of the matrices
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE EnableIf_< UseVectorizedBatchKernel<T> >
+   batchMultKernel( T* y, size_t ldy, const T* A, size_t lda, const T* x, size_t ldx, size_t n )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   BLAZE_INTERNAL_ASSERT( ldy % SIMDSIZE == 0UL, "Invalid spacing of the target planes"          );
+   BLAZE_INTERNAL_ASSERT( lda % SIMDSIZE == 0UL, "Invalid spacing of the matrix planes"          );
+   BLAZE_INTERNAL_ASSERT( ldx % SIMDSIZE == 0UL, "Invalid spacing of the right-hand side planes" );
+
+   for( size_t l=0UL; l<n; l+=SIMDSIZE )
+   {
+      SIMDType b[N], c[M];
+
+      for( size_t j=0UL; j<N; ++j )
+         b[j] = loada( x+j*ldx+l );
+
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            c[i] = c[i] + loada( A+(i*N+j)*lda+l ) * b[j];
+
+      for( size_t i=0UL; i<M; ++i )
+         storea( y+i*ldy+l, c[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the multiplication of the matrices of two matrix batches.
+// \ingroup dense
+//
+// This functor computes the products of a block of the matrices of two matrix batches. It is
+// used in combination with the smpBatch() function.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the left-hand side matrices
+        , size_t K    // Number of columns of the left-hand side matrices
+        , size_t N >  // Number of columns of the right-hand side matrices
+struct MatrixBatchMult
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MatrixBatchMult class template.
+   //
+   // \param C The target matrix batch.
+   // \param A The left-hand side matrix batch.
+   // \param B The right-hand side matrix batch.
+   */
+   explicit inline MatrixBatchMult( MatrixBatch<T,M,N>& C, const MatrixBatch<T,M,K>& A,
+                                    const MatrixBatch<T,K,N>& B )
+      : C_( C )  // The target matrix batch
+      , A_( A )  // The left-hand side matrix batch
+      , B_( B )  // The right-hand side matrix batch
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the products of the given block of matrices.
+   //
+   // \param index The index of the first matrix of the block.
+   // \param n The number of matrices of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      batchMultKernel<M,K,N>( C_.data()+index, C_.spacing(), A_.data()+index, A_.spacing(),
+                              B_.data()+index, B_.spacing(), n );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MatrixBatch<T,M,N>&       C_;  //!< The target matrix batch.
+   const MatrixBatch<T,M,K>& A_;  //!< The left-hand side matrix batch.
+   const MatrixBatch<T,K,N>& B_;  //!< The right-hand side matrix batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the multiplication of the matrices and vectors of two batches.
+// \ingroup dense
+//
+// This functor computes the products of a block of the matrices and vectors of a matrix batch
+// and a vector batch. It is used in combination with the smpBatch() function.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the matrices
+        , size_t N >  // Number of columns of the matrices
+struct VectorBatchMult
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the VectorBatchMult class template.
+   //
+   // \param y The target vector batch.
+   // \param A The matrix batch.
+   // \param x The right-hand side vector batch.
+   */
+   explicit inline VectorBatchMult( VectorBatch<T,M>& y, const MatrixBatch<T,M,N>& A,
+                                    const VectorBatch<T,N>& x )
+      : y_( y )  // The target vector batch
+      , A_( A )  // The matrix batch
+      , x_( x )  // The right-hand side vector batch
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the products of the given block of matrices and vectors.
+   //
+   // \param index The index of the first matrix and vector of the block.
+   // \param n The number of matrices and vectors of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      batchMultKernel<M,N>( y_.data()+index, y_.spacing(), A_.data()+index, A_.spacing(),
+                            x_.data()+index, x_.spacing(), n );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VectorBatch<T,M>&         y_;  //!< The target vector batch.
+   const MatrixBatch<T,M,N>& A_;  //!< The matrix batch.
+   const VectorBatch<T,N>&   x_;  //!< The right-hand side vector batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the multiplication of the elements of two arrays of static matrices.
+// \ingroup dense
+//
+// This functor computes the products of a block of the elements of two arrays of StaticMatrix
+// instances. It is used in combination with the smpBatch() function.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the left-hand side matrices
+        , size_t K    // Number of columns of the left-hand side matrices
+        , size_t N    // Number of columns of the right-hand side matrices
+        , bool SO1    // Storage order of the target matrices
+        , bool SO2    // Storage order of the left-hand side matrices
+        , bool SO3 >  // Storage order of the right-hand side matrices
+struct StaticMatrixBatchMult
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the StaticMatrixBatchMult class template.
+   //
+   // \param C Pointer to the first target matrix.
+   // \param A Pointer to the first left-hand side matrix.
+   // \param B Pointer to the first right-hand side matrix.
+   */
+   explicit inline StaticMatrixBatchMult( StaticMatrix<T,M,N,SO1>* C,
+                                          const StaticMatrix<T,M,K,SO2>* A,
+                                          const StaticMatrix<T,K,N,SO3>* B )
+      : C_( C )  // Pointer to the first target matrix
+      , A_( A )  // Pointer to the first left-hand side matrix
+      , B_( B )  // Pointer to the first right-hand side matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the products of the given block of matrices.
+   //
+   // \param index The index of the first matrix of the block.
+   // \param n The number of matrices of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      for( size_t l=index; l<index+n; ++l )
+         C_[l] = A_[l] * B_[l];
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   StaticMatrix<T,M,N,SO1>*       C_;  //!< Pointer to the first target matrix.
+   const StaticMatrix<T,M,K,SO2>* A_;  //!< Pointer to the first left-hand side matrix.
+   const StaticMatrix<T,K,N,SO3>* B_;  //!< Pointer to the first right-hand side matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the multiplication of the elements of arrays of static matrices
+//        and vectors.
+// \ingroup dense
+//
+// This functor computes the products of a block of the elements of an array of StaticMatrix
+// instances and an array of StaticVector instances. It is used in combination with the
+// smpBatch() function.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the matrices
+        , size_t N    // Number of columns of the matrices
+        , bool SO >   // Storage order of the matrices
+struct StaticVectorBatchMult
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the StaticVectorBatchMult class template.
+   //
+   // \param y Pointer to the first target vector.
+   // \param A Pointer to the first matrix.
+   // \param x Pointer to the first right-hand side vector.
+   */
+   explicit inline StaticVectorBatchMult( StaticVector<T,M,columnVector>* y,
+                                          const StaticMatrix<T,M,N,SO>* A,
+                                          const StaticVector<T,N,columnVector>* x )
+      : y_( y )  // Pointer to the first target vector
+      , A_( A )  // Pointer to the first matrix
+      , x_( x )  // Pointer to the first right-hand side vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the products of the given block of matrices and vectors.
+   //
+   // \param index The index of the first matrix and vector of the block.
+   // \param n The number of matrices and vectors of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      for( size_t l=index; l<index+n; ++l )
+         y_[l] = A_[l] * x_[l];
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   StaticVector<T,M,columnVector>*       y_;  //!< Pointer to the first target vector.
+   const StaticMatrix<T,M,N,SO>*         A_;  //!< Pointer to the first matrix.
+   const StaticVector<T,N,columnVector>* x_;  //!< Pointer to the first right-hand side vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batch multiplication functions */
+//@{
+template< typename T, size_t M, size_t K, size_t N >
+void batchMult( MatrixBatch<T,M,N>& C, const MatrixBatch<T,M,K>& A,
+                const MatrixBatch<T,K,N>& B );
+
+template< typename T, size_t M, size_t N >
+void batchMult( VectorBatch<T,M>& y, const MatrixBatch<T,M,N>& A, const VectorBatch<T,N>& x );
+
+template< typename T, size_t M, size_t K, size_t N, bool SO1, bool SO2, bool SO3 >
+void batchMult( StaticMatrix<T,M,N,SO1>* C, const StaticMatrix<T,M,K,SO2>* A,
+                const StaticMatrix<T,K,N,SO3>* B, size_t n );
+
+template< typename T, size_t M, size_t N, bool SO >
+void batchMult( StaticVector<T,M,columnVector>* y, const StaticMatrix<T,M,N,SO>* A,
+                const StaticVector<T,N,columnVector>* x, size_t n );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of the matrices of two matrix batches (\f$ C_k=A_k*B_k \f$).
+// \ingroup dense
+//
+// \param C The target matrix batch.
+// \param A The left-hand side matrix batch.
+// \param B The right-hand side matrix batch.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products \f$ C_k=A_k*B_k \f$ of all matrices of the two given
+// batches. The target batch is resized to the size of the operand batches. In case the element
+// type of the batches is vectorizable, the products are computed via SIMD operations, where
+// each SIMD lane computes one product. In case the batches are large enough (see the
+// blaze::SMP_BATCH_THRESHOLD), the batch is split across all available threads.
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 10000UL ), B( 10000UL ), C;
+   // ... Initialization of A and B
+
+   blaze::batchMult( C, A, B );
+   \endcode
+
+// In case the sizes of the two operand batches don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the left-hand side matrices
+        , size_t K    // Number of columns of the left-hand side matrices
+        , size_t N >  // Number of columns of the right-hand side matrices
+void batchMult( MatrixBatch<T,M,N>& C, const MatrixBatch<T,M,K>& A,
+                const MatrixBatch<T,K,N>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &B ) ) {
+      MatrixBatch<T,M,N> tmp( A.size() );
+      batchMult( tmp, A, B );
+      C.swap( tmp );
+      return;
+   }
+
+   C.resize( A.size(), false );
+
+   smpBatch( A.size(), SIMDTrait<T>::size, MatrixBatchMult<T,M,K,N>( C, A, B ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of the matrices and vectors of a matrix batch and a vector
+//        batch (\f$ \vec{y}_k=A_k*\vec{x}_k \f$).
+// \ingroup dense
+//
+// \param y The target vector batch.
+// \param A The matrix batch.
+// \param x The right-hand side vector batch.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products \f$ \vec{y}_k=A_k*\vec{x}_k \f$ of all matrices and
+// vectors of the two given batches. The target batch is resized to the size of the operand
+// batches. In case the element type of the batches is vectorizable, the products are computed
+// via SIMD operations, where each SIMD lane computes one product. In case the batches are
+// large enough (see the blaze::SMP_BATCH_THRESHOLD), the batch is split across all available
+// threads.
+
+   \code
+   blaze::MatrixBatch<double,6UL,6UL> A( 10000UL );
+   blaze::VectorBatch<double,6UL> x( 10000UL ), y;
+   // ... Initialization of A and x
+
+   blaze::batchMult( y, A, x );
+   \endcode
+
+// In case the sizes of the two operand batches don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the matrices
+        , size_t N >  // Number of columns of the matrices
+void batchMult( VectorBatch<T,M>& y, const MatrixBatch<T,M,N>& A, const VectorBatch<T,N>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.size() != x.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   y.resize( A.size(), false );
+
+   smpBatch( A.size(), SIMDTrait<T>::size, VectorBatchMult<T,M,N>( y, A, x ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of the elements of two arrays of static matrices
+//        (\f$ C_k=A_k*B_k \f$).
+// \ingroup dense
+//
+// \param C Pointer to the first element of the array of target matrices.
+// \param A Pointer to the first element of the array of left-hand side matrices.
+// \param B Pointer to the first element of the array of right-hand side matrices.
+// \param n The number of matrix products.
+// \return void
+//
+// This function computes the products \f$ C_k=A_k*B_k \f$ for \f$ k \in [0..n-1] \f$ for
+// contiguous arrays of StaticMatrix instances. In case the arrays are large enough (see the
+// blaze::SMP_BATCH_THRESHOLD), they are split across all available threads. Note that each
+// product is vectorized individually. For a vectorization across the batch, where each SIMD
+// lane computes one product, the MatrixBatch class template should be preferred.
+
+   \code
+   typedef blaze::StaticMatrix<double,3UL,3UL>  M3x3;
+
+   std::vector< M3x3, blaze::AlignedAllocator<M3x3> > A( 10000UL ), B( 10000UL ), C( 10000UL );
+   // ... Initialization of A and B
+
+   blaze::batchMult( C.data(), A.data(), B.data(), C.size() );
+   \endcode
+
+// Note that the StaticMatrix class template is over-aligned for the according SIMD instruction
+// set. Therefore the arrays have to be allocated via an aligned allocator (as for instance the
+// blaze::AlignedAllocator). Also note that in contrast to the MatrixBatch version of the
+// batchMult() function, the arrays have to be sized appropriately by the caller. It is allowed
+// to pass the same array as target and as operand.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the left-hand side matrices
+        , size_t K    // Number of columns of the left-hand side matrices
+        , size_t N    // Number of columns of the right-hand side matrices
+        , bool SO1    // Storage order of the target matrices
+        , bool SO2    // Storage order of the left-hand side matrices
+        , bool SO3 >  // Storage order of the right-hand side matrices
+void batchMult( StaticMatrix<T,M,N,SO1>* C, const StaticMatrix<T,M,K,SO2>* A,
+                const StaticMatrix<T,K,N,SO3>* B, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef StaticMatrixBatchMult<T,M,K,N,SO1,SO2,SO3>  BatchOp;
+
+   smpBatch( n, 1UL, BatchOp( C, A, B ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of the elements of arrays of static matrices and vectors
+//        (\f$ \vec{y}_k=A_k*\vec{x}_k \f$).
+// \ingroup dense
+//
+// \param y Pointer to the first element of the array of target vectors.
+// \param A Pointer to the first element of the array of matrices.
+// \param x Pointer to the first element of the array of right-hand side vectors.
+// \param n The number of matrix/vector products.
+// \return void
+//
+// This function computes the products \f$ \vec{y}_k=A_k*\vec{x}_k \f$ for \f$ k \in [0..n-1]
+// \f$ for contiguous arrays of StaticMatrix and StaticVector instances. In case the arrays are
+// large enough (see the blaze::SMP_BATCH_THRESHOLD), they are split across all available
+// threads. Note that each product is vectorized individually. For a vectorization across the
+// batch, where each SIMD lane computes one product, the MatrixBatch and VectorBatch class
+// templates should be preferred.
+
+   \code
+   typedef blaze::StaticMatrix<double,6UL,6UL>  M6x6;
+   typedef blaze::StaticVector<double,6UL>      V6;
+
+   std::vector< M6x6, blaze::AlignedAllocator<M6x6> > A( 10000UL );
+   std::vector< V6, blaze::AlignedAllocator<V6> > x( 10000UL ), y( 10000UL );
+   // ... Initialization of A and x
+
+   blaze::batchMult( y.data(), A.data(), x.data(), y.size() );
+   \endcode
+
+// Note that the StaticMatrix and StaticVector class templates are over-aligned for the according
+// SIMD instruction set. Therefore the arrays have to be allocated via an aligned allocator (as
+// for instance the blaze::AlignedAllocator). Also note that in contrast to the VectorBatch
+// version of the batchMult() function, the arrays have to be sized appropriately by the caller.
+// It is allowed to pass the same array as target and as operand.
+*/
+template< typename T  // Element type
+        , size_t M    // Number of rows of the matrices
+        , size_t N    // Number of columns of the matrices
+        , bool SO >   // Storage order of the matrices
+void batchMult( StaticVector<T,M,columnVector>* y, const StaticMatrix<T,M,N,SO>* A,
+                const StaticVector<T,N,columnVector>* x, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef StaticVectorBatchMult<T,M,N,SO>  BatchOp;
+
+   smpBatch( n, 1UL, BatchOp( y, A, x ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,521 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/ChunkedMatrix.h
+//  \brief Header file for the implementation of a row-major dense matrix stored in a file
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_CHUNKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_CHUNKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/serialization/MappedFile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup chunked_matrix ChunkedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Read-only row-major dense matrix stored in a file.
+// \ingroup chunked_matrix
+//
+// The ChunkedMatrix class template represents a read-only, row-major dense matrix, whose elements
+// remain in a file on disk (see the saveMapped() and loadMapped() functions). In contrast to a
+// CustomMatrix bound to a memory mapped file, a ChunkedMatrix is not accessed as a whole, but is
+// processed panel by panel, where each panel consists of a contiguous range of rows and is
+// represented by an aligned and padded CustomMatrix. Therefore the ChunkedMatrix is suited for
+// matrices that are considerably larger than the available main memory (e.g. tall and skinny
+// design matrices):
+
+   \code
+   using blaze::ChunkedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   ChunkedMatrix<double> A;
+   loadMapped( "matrix.blzm", A );  // Binding the matrix to the file without reading it
+
+   DynamicVector<double> x( A.columns(), 1.0 ), y, z;
+   DynamicMatrix<double> G;
+
+   chunkedMult     ( y, A, x );  // Out-of-core computation of y = A * x
+   chunkedTransMult( z, A, y );  // Out-of-core computation of z = trans(A) * y
+   chunkedGram     ( G, A );     // Out-of-core computation of G = trans(A) * A
+   \endcode
+
+// The panels are processed by means of the stream() function, which passes all panels in order
+// to the given operation. While the operation computes on the current panel, the next panel is
+// read in the background, and after the operation the memory of the current panel is released.
+// Therefore at most two panels are kept in main memory at any time and for sufficiently large
+// panels the throughput is bounded by the bandwidth of the disk instead of the size of the main
+// memory. The number of rows per panel can be adapted by means of the setPanelRows() function;
+// by default each panel comprises approximately 64 MiB:
+
+   \code
+   A.setPanelRows( 100000UL );
+
+   A.stream( [&]( size_t row, const ChunkedMatrix<double>::PanelType& P ) {
+      // ... Processing of the rows [row..row+P.rows()) of A
+   } );
+   \endcode
+
+// Note that the panels refer to private, read-only pages of the file. Modifications of a panel
+// are neither written back to the file nor persistent, since the memory of the panel is released
+// as soon as the operation returns.
+*/
+template< typename Type >  // Data type of the matrix
+class ChunkedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef ChunkedMatrix<Type>                          This;         //!< Type of this ChunkedMatrix instance.
+   typedef CustomMatrix<Type,aligned,padded,rowMajor>  PanelType;    //!< Type of a single panel.
+   typedef Type                                         ElementType;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Enumerations********************************************************************************
+   //! The default size of a panel in bytes.
+   enum : size_t { panelBytes = 67108864UL };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ChunkedMatrix() noexcept;
+   explicit inline ChunkedMatrix( std::shared_ptr<const MappedFile> file, size_t offset,
+                                  size_t m, size_t n, size_t nn ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t          rows() const noexcept;
+   inline size_t          columns() const noexcept;
+   inline size_t          spacing() const noexcept;
+   inline size_t          panelRows() const noexcept;
+   inline void            setPanelRows( size_t rows ) noexcept;
+   inline size_t          panels() const noexcept;
+   inline const PanelType panel( size_t k ) const;
+   inline void            prefetch( size_t k ) const noexcept;
+   inline void            evict( size_t k ) const noexcept;
+   template< typename OP >
+   inline void            stream( OP op ) const;
+   inline void            swap( ChunkedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t defaultPanelRows() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<const MappedFile> file_;  //!< The memory mapped file.
+   size_t offset_;     //!< The offset of the first element within the file in bytes.
+   size_t m_;          //!< The current number of rows of the matrix.
+   size_t n_;          //!< The current number of columns of the matrix.
+   size_t nn_;         //!< The number of elements between two rows.
+   size_t panelRows_;  //!< The number of rows per panel.
+   Type* v_;           //!< Pointer to the first element of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ChunkedMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline ChunkedMatrix<Type>::ChunkedMatrix() noexcept
+   : file_     ()           // The memory mapped file
+   , offset_   ( 0UL )      // The offset of the first element within the file in bytes
+   , m_        ( 0UL )      // The current number of rows of the matrix
+   , n_        ( 0UL )      // The current number of columns of the matrix
+   , nn_       ( 0UL )      // The number of elements between two rows
+   , panelRows_( 0UL )      // The number of rows per panel
+   , v_        ( nullptr )  // Pointer to the first element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ M \times N \f$ matrix stored in the given mapped file.
+//
+// \param file The memory mapped file containing the elements.
+// \param offset The offset of the first element within the file in bytes.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nn The total number of elements between two rows of the matrix \f$[N..\infty)\f$.
+//
+// This constructor binds the matrix to the \a m rows of \a nn elements, which are stored in the
+// given file starting at the given offset. The offset and the size of a row in bytes have to be
+// multiples of the alignment of the elements and the padding elements have to be zero (which is
+// guaranteed for all files written by the saveMapped() function). Usually the matrix is bound to
+// a file by means of the loadMapped() function instead of this constructor.
+*/
+template< typename Type >  // Data type of the matrix
+inline ChunkedMatrix<Type>::ChunkedMatrix( std::shared_ptr<const MappedFile> file, size_t offset,
+                                           size_t m, size_t n, size_t nn ) noexcept
+   : file_     ( std::move( file ) )  // The memory mapped file
+   , offset_   ( offset )             // The offset of the first element within the file in bytes
+   , m_        ( m )                  // The current number of rows of the matrix
+   , n_        ( n )                  // The current number of columns of the matrix
+   , nn_       ( nn )                 // The number of elements between two rows
+   , panelRows_( 0UL )                // The number of rows per panel
+   , v_        ( nullptr )            // Pointer to the first element of the matrix
+{
+   BLAZE_INTERNAL_ASSERT( file_ != nullptr, "Invalid mapped file detected" );
+   BLAZE_INTERNAL_ASSERT( n_ <= nn_, "Invalid spacing detected" );
+   BLAZE_INTERNAL_ASSERT( offset_ + m_*nn_*sizeof( Type ) <= file_->size(), "Invalid matrix size detected" );
+
+   v_ = reinterpret_cast<Type*>( const_cast<byte_t*>( file_->data() ) + offset_ );
+   panelRows_ = defaultPanelRows();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t ChunkedMatrix<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t ChunkedMatrix<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t ChunkedMatrix<Type>::spacing() const noexcept
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows per panel.
+//
+// \return The number of rows per panel.
+//
+// Note that the last panel of the matrix may contain less rows.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t ChunkedMatrix<Type>::panelRows() const noexcept
+{
+   return panelRows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the number of rows per panel.
+//
+// \param rows The new number of rows per panel.
+// \return void
+//
+// This function sets the number of rows per panel. In case \a rows is 0, the default number of
+// rows is restored, which results in panels of approximately 64 MiB. Note that at most two
+// panels are kept in main memory at any time.
+*/
+template< typename Type >  // Data type of the matrix
+inline void ChunkedMatrix<Type>::setPanelRows( size_t rows ) noexcept
+{
+   panelRows_ = ( rows != 0UL )?( rows ):( defaultPanelRows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of panels of the matrix.
+//
+// \return The number of panels of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t ChunkedMatrix<Type>::panels() const noexcept
+{
+   return ( panelRows_ != 0UL )?( ( m_ + panelRows_ - 1UL ) / panelRows_ ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the \a k-th panel of the matrix.
+//
+// \param k The index of the panel \f$[0..panels())\f$.
+// \return The \a k-th panel of the matrix.
+// \exception std::invalid_argument Invalid panel access index.
+//
+// This function returns an aligned and padded CustomMatrix representing the rows
+// \f$ [k*panelRows()..min((k+1)*panelRows(),rows())) \f$ of the matrix. Accessing the elements
+// of the panel reads them from the file on demand.
+*/
+template< typename Type >  // Data type of the matrix
+inline const typename ChunkedMatrix<Type>::PanelType ChunkedMatrix<Type>::panel( size_t k ) const
+{
+   if( k >= panels() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid panel access index" );
+   }
+
+   const size_t row( k*panelRows_ );
+   const size_t m  ( ( panelRows_ < m_ - row )?( panelRows_ ):( m_ - row ) );
+
+   return PanelType( v_ + row*nn_, m, n_, nn_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requests the asynchronous read of the \a k-th panel of the matrix.
+//
+// \param k The index of the panel.
+// \return void
+//
+// This function starts reading the \a k-th panel of the matrix in the background and returns
+// immediately (see MappedFile::prefetch()). In case \a k is not a valid panel index, the
+// function has no effect.
+*/
+template< typename Type >  // Data type of the matrix
+inline void ChunkedMatrix<Type>::prefetch( size_t k ) const noexcept
+{
+   if( k < panels() ) {
+      const size_t bytes( panelRows_*nn_*sizeof( Type ) );
+      file_->prefetch( offset_ + k*bytes, bytes );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the memory of the \a k-th panel of the matrix.
+//
+// \param k The index of the panel.
+// \return void
+//
+// This function releases the main memory occupied by the \a k-th panel of the matrix (see
+// MappedFile::evict()). A subsequent access to the panel reads it again from the file. In case
+// \a k is not a valid panel index, the function has no effect.
+*/
+template< typename Type >  // Data type of the matrix
+inline void ChunkedMatrix<Type>::evict( size_t k ) const noexcept
+{
+   if( k < panels() ) {
+      const size_t bytes( panelRows_*nn_*sizeof( Type ) );
+      file_->evict( offset_ + k*bytes, bytes );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the given operation to all panels of the matrix.
+//
+// \param op The operation to be applied.
+// \return void
+//
+// This function calls the given operation for all panels of the matrix in order. The operation
+// is passed the index of the first row of the panel and the panel itself:
+
+   \code
+   op( size_t row, const PanelType& panel );
+   \endcode
+
+// While the operation processes panel \a k, panel \a k+1 is read in the background. After the
+// operation returns, the memory of panel \a k is released. Therefore reading the matrix from
+// the file overlaps with the computation and the memory footprint is bounded by two panels.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename OP >    // Type of the operation
+inline void ChunkedMatrix<Type>::stream( OP op ) const
+{
+   const size_t np( panels() );
+
+   prefetch( 0UL );
+
+   for( size_t k=0UL; k<np; ++k ) {
+      prefetch( k+1UL );
+      const PanelType P( panel( k ) );
+      op( k*panelRows_, P );
+      evict( k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two chunked matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void ChunkedMatrix<Type>::swap( ChunkedMatrix& m ) noexcept
+{
+   file_.swap( m.file_ );
+   std::swap( offset_, m.offset_ );
+   std::swap( m_, m.m_ );
+   std::swap( n_, m.n_ );
+   std::swap( nn_, m.nn_ );
+   std::swap( panelRows_, m.panelRows_ );
+   std::swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the default number of rows per panel.
+//
+// \return The default number of rows per panel.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t ChunkedMatrix<Type>::defaultPanelRows() const noexcept
+{
+   const size_t rows( ( nn_ != 0UL )?( panelBytes / ( nn_*sizeof( Type ) ) ):( m_ ) );
+   return ( rows != 0UL )?( rows ):( 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHUNKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ChunkedMatrix operators */
+//@{
+template< typename Type >
+inline void swap( ChunkedMatrix<Type>& a, ChunkedMatrix<Type>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two chunked matrices.
+// \ingroup chunked_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void swap( ChunkedMatrix<Type>& a, ChunkedMatrix<Type>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/ChunkedMult.h
+//  \brief Header file for the out-of-core multiplication kernels of chunked matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_CHUNKEDMULT_H_
+#define _BLAZE_MATH_DENSE_CHUNKEDMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/ChunkedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  OUT-OF-CORE MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Out-of-core multiplication of a chunked matrix and a dense column vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup chunked_matrix
+//
+// \param y The target dense column vector.
+// \param A The left-hand side chunked matrix.
+// \param x The right-hand side dense column vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product \f$ \vec{y}=A*\vec{x} \f$ panel by panel (see the
+// ChunkedMatrix::stream() function), i.e. while the product of the current panel is computed
+// the next panel is read from the file. The target vector is resized to the number of rows of
+// \a A. In case the number of columns of \a A doesn't match the size of \a x, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1     // Type of the target vector
+        , typename Type    // Data type of the chunked matrix
+        , typename VT2 >   // Type of the right-hand side vector
+void chunkedMult( DenseVector<VT1,columnVector>& y, const ChunkedMatrix<Type>& A,
+                  const DenseVector<VT2,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename ChunkedMatrix<Type>::PanelType  PanelType;
+
+   if( A.columns() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( static_cast<const void*>( &~y ) == static_cast<const void*>( &~x ) ) {
+      ResultType_<VT1> tmp;
+      chunkedMult( tmp, A, x );
+      ~y = tmp;
+      return;
+   }
+
+   resize( ~y, A.rows(), false );
+
+   CompositeType_<VT2> xx( ~x );
+
+   A.stream( [&]( size_t row, const PanelType& P ) {
+      subvector( ~y, row, P.rows() ) = P * xx;
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core multiplication of a transpose chunked matrix and a dense column vector
+//        (\f$ \vec{y}=A^T*\vec{x} \f$).
+// \ingroup chunked_matrix
+//
+// \param y The target dense column vector.
+// \param A The chunked matrix.
+// \param x The right-hand side dense column vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product \f$ \vec{y}=A^T*\vec{x} \f$ panel by panel (see the
+// ChunkedMatrix::stream() function) by accumulating the contributions \f$ P^T*\vec{x}_P \f$ of
+// all panels \f$ P \f$, where \f$ \vec{x}_P \f$ is the according part of \a x. While the
+// contribution of the current panel is computed the next panel is read from the file. The target
+// vector is resized to the number of columns of \a A. In case the number of rows of \a A doesn't
+// match the size of \a x, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1     // Type of the target vector
+        , typename Type    // Data type of the chunked matrix
+        , typename VT2 >   // Type of the right-hand side vector
+void chunkedTransMult( DenseVector<VT1,columnVector>& y, const ChunkedMatrix<Type>& A,
+                       const DenseVector<VT2,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename ChunkedMatrix<Type>::PanelType  PanelType;
+
+   if( A.rows() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( static_cast<const void*>( &~y ) == static_cast<const void*>( &~x ) ) {
+      ResultType_<VT1> tmp;
+      chunkedTransMult( tmp, A, x );
+      ~y = tmp;
+      return;
+   }
+
+   resize( ~y, A.columns(), false );
+   reset( ~y );
+
+   CompositeType_<VT2> xx( ~x );
+
+   A.stream( [&]( size_t row, const PanelType& P ) {
+      ~y += trans( P ) * subvector( xx, row, P.rows() );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core computation of the Gram matrix of a chunked matrix (\f$ G=A^T*A \f$).
+// \ingroup chunked_matrix
+//
+// \param G The target dense matrix.
+// \param A The chunked matrix.
+// \return void
+//
+// This function computes the \f$ N \times N \f$ Gram matrix \f$ G=A^T*A \f$ of the given
+// \f$ M \times N \f$ matrix panel by panel (see the ChunkedMatrix::stream() function) by
+// accumulating the contributions \f$ P^T*P \f$ of all panels \f$ P \f$. While the contribution
+// of the current panel is computed the next panel is read from the file. The target matrix is
+// resized to \f$ N \times N \f$. For tall and skinny matrices this is the basis for an
+// out-of-core least squares solution via the normal equations:
+
+   \code
+   blaze::ChunkedMatrix<double> A;
+   blaze::loadMapped( "design.blzm", A );
+
+   blaze::DynamicVector<double> b, c, x;
+   // ... Initialization of the right-hand side b
+
+   blaze::DynamicMatrix<double> G;
+   blaze::chunkedGram( G, A );           // G = trans(A) * A
+   blaze::chunkedTransMult( c, A, b );   // c = trans(A) * b
+   x = solve( G, c );                    // Solution of the normal equations
+   \endcode
+*/
+template< typename MT      // Type of the target matrix
+        , bool SO          // Storage order of the target matrix
+        , typename Type >  // Data type of the chunked matrix
+void chunkedGram( DenseMatrix<MT,SO>& G, const ChunkedMatrix<Type>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename ChunkedMatrix<Type>::PanelType  PanelType;
+
+   resize( ~G, A.columns(), A.columns(), false );
+   reset( ~G );
+
+   A.stream( [&]( size_t, const PanelType& P ) {
+      ~G += trans( P ) * P;
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -70,6 +70,7 @@
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMaskedLoad.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsCustom.h>
@@ -98,7 +99,9 @@
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsClass.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/typetraits/RemoveConst.h>
 #include <blaze/util/Unused.h>
 
 
@@ -598,6 +601,18 @@ class CustomVector : public DenseVector< CustomVector<Type,AF,PF,TF>, TF >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT >
+   struct MaskedRemainder {
+      enum : bool { value = HasConstDataAccess<VT>::value &&
+                            HasSIMDMaskedLoad<Type>::value &&
+                            IsSame< Type, RemoveConst_< ElementType_<VT> > >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -689,6 +704,29 @@ class CustomVector : public DenseVector< CustomVector<Type,AF,PF,TF>, TF >
    //**********************************************************************************************
 
  private:
+   //**Remainder functions*************************************************************************
+   /*!\name Remainder functions */
+   //@{
+   template< typename VT >
+   inline DisableIf_<MaskedRemainder<VT> > assignRemainder( size_t index, const VT& rhs );
+
+   template< typename VT >
+   inline EnableIf_<MaskedRemainder<VT> > assignRemainder( size_t index, const VT& rhs );
+
+   template< typename VT >
+   inline DisableIf_<MaskedRemainder<VT> > addAssignRemainder( size_t index, const VT& rhs );
+
+   template< typename VT >
+   inline EnableIf_<MaskedRemainder<VT> > addAssignRemainder( size_t index, const VT& rhs );
+
+   template< typename VT >
+   inline DisableIf_<MaskedRemainder<VT> > subAssignRemainder( size_t index, const VT& rhs );
+
+   template< typename VT >
+   inline EnableIf_<MaskedRemainder<VT> > subAssignRemainder( size_t index, const VT& rhs );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -2252,9 +2290,7 @@ inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE Vectorized
       for( ; i<ipos; i+=SIMDSIZE ) {
          stream( i, (~rhs).load(i) );
       }
-      for( ; i<size_; ++i ) {
-         v_[i] = (~rhs)[i];
-      }
+      assignRemainder( i, ~rhs );
    }
    else
    {
@@ -2274,9 +2310,7 @@ inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE Vectorized
       for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
          store( i, it.load() );
       }
-      for( ; i<size_; ++i, ++it ) {
-         v_[i] = *it;
-      }
+      assignRemainder( i, ~rhs );
    }
 }
 //*************************************************************************************************
@@ -2384,9 +2418,7 @@ inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE Vectorized
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) + it.load() );
    }
-   for( ; i<size_; ++i, ++it ) {
-      v_[i] += *it;
-   }
+   addAssignRemainder( i, ~rhs );
 }
 //*************************************************************************************************
 
@@ -2493,9 +2525,7 @@ inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE Vectorized
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) - it.load() );
    }
-   for( ; i<size_; ++i, ++it ) {
-      v_[i] -= *it;
-   }
+   subAssignRemainder( i, ~rhs );
 }
 //*************************************************************************************************
 
@@ -2724,6 +2754,191 @@ inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE Vectorized
 
 
 
+//=================================================================================================
+//
+//  REMAINDER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of the remainder of a dense vector.
+//
+// \param index The index of the first remaining element.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function assigns the elements in the range \f$ [index..size) \f$ one by one. It is used
+// internally by the SIMD optimized kernels for all right-hand side operands that don't allow
+// a masked access of the remaining elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline DisableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE MaskedRemainder<VT> >
+   CustomVector<Type,AF,PF,TF>::assignRemainder( size_t index, const VT& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( index <= size_, "Invalid remainder index" );
+
+   for( size_t i=index; i<size_; ++i ) {
+      v_[i] = rhs[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of the remainder of a dense vector.
+//
+// \param index The index of the first remaining element.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function processes the less than \a SIMDSIZE elements in the range \f$ [index..size) \f$
+// by means of a single masked load and store. No element beyond the end of the two vectors is
+// accessed.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE MaskedRemainder<VT> >
+   CustomVector<Type,AF,PF,TF>::assignRemainder( size_t index, const VT& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( index <= size_ && size_ - index < SIMDSIZE, "Invalid remainder index" );
+
+   const size_t n( size_ - index );
+
+   storeu( v_.get()+index, loadu( rhs.data()+index, n ), n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of the remainder of a dense vector.
+//
+// \param index The index of the first remaining element.
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function adds the elements in the range \f$ [index..size) \f$ one by one. It is used
+// internally by the SIMD optimized kernels for all right-hand side operands that don't allow
+// a masked access of the remaining elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline DisableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE MaskedRemainder<VT> >
+   CustomVector<Type,AF,PF,TF>::addAssignRemainder( size_t index, const VT& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( index <= size_, "Invalid remainder index" );
+
+   for( size_t i=index; i<size_; ++i ) {
+      v_[i] += rhs[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the addition assignment of the remainder of a dense vector.
+//
+// \param index The index of the first remaining element.
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function processes the less than \a SIMDSIZE elements in the range \f$ [index..size) \f$
+// by means of a single masked load and store. No element beyond the end of the two vectors is
+// accessed.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE MaskedRemainder<VT> >
+   CustomVector<Type,AF,PF,TF>::addAssignRemainder( size_t index, const VT& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( index <= size_ && size_ - index < SIMDSIZE, "Invalid remainder index" );
+
+   const size_t n( size_ - index );
+
+   storeu( v_.get()+index, loadu( v_.get()+index, n ) + loadu( rhs.data()+index, n ), n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of the remainder of a dense vector.
+//
+// \param index The index of the first remaining element.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function subtracts the elements in the range \f$ [index..size) \f$ one by one. It is used
+// internally by the SIMD optimized kernels for all right-hand side operands that don't allow
+// a masked access of the remaining elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline DisableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE MaskedRemainder<VT> >
+   CustomVector<Type,AF,PF,TF>::subAssignRemainder( size_t index, const VT& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( index <= size_, "Invalid remainder index" );
+
+   for( size_t i=index; i<size_; ++i ) {
+      v_[i] -= rhs[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the subtraction assignment of the remainder of a dense vector.
+//
+// \param index The index of the first remaining element.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function processes the less than \a SIMDSIZE elements in the range \f$ [index..size) \f$
+// by means of a single masked load and store. No element beyond the end of the two vectors is
+// accessed.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline EnableIf_<typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE MaskedRemainder<VT> >
+   CustomVector<Type,AF,PF,TF>::subAssignRemainder( size_t index, const VT& rhs )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( index <= size_ && size_ - index < SIMDSIZE, "Invalid remainder index" );
+
+   const size_t n( size_ - index );
+
+   storeu( v_.get()+index, loadu( v_.get()+index, n ) - loadu( rhs.data()+index, n ), n );
+}
+//*************************************************************************************************
+
+
+
+
 
 
 
@@ -43,6 +43,7 @@
 #include <cmath>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/shims/Equal.h>
@@ -50,7 +51,6 @@
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/Sqrt.h>
-#include <blaze/math/shims/Square.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -379,12 +379,6 @@ const ElementType_<VT> sqrLength( const DenseVector<VT,TF>& dv );
 
 template< typename VT, bool TF >
 inline auto length( const DenseVector<VT,TF>& dv ) -> decltype( sqrt( sqrLength( ~dv ) ) );
-
-template< typename VT, bool TF >
-const ElementType_<VT> min( const DenseVector<VT,TF>& dv );
-
-template< typename VT, bool TF >
-const ElementType_<VT> max( const DenseVector<VT,TF>& dv );
 //@}
 //*************************************************************************************************
 
@@ -520,14 +514,14 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const ElementType_<VT> sqrLength( const DenseVector<VT,TF>& dv )
 {
-   typedef ElementType_<VT>  ElementType;
+   typedef ElementType_<VT>    ElementType;
+   typedef CompositeType_<VT>  CT;
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   ElementType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return sum;
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   return sum( a * a );
 }
 //*************************************************************************************************
 
@@ -577,72 +571,6 @@ inline auto length( const DenseVector<VT,TF>& dv ) -> decltype( sqrt( sqrLength(
 }
 //*************************************************************************************************
 
-
-//*************************************************************************************************
-/*!\brief Returns the smallest element of the dense vector.
-// \ingroup dense_vector
-//
-// \param dv The given dense vector.
-// \return The smallest dense vector element.
-//
-// This function returns the smallest element of the given dense vector. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
-// of fundamental data types).
-*/
-template< typename VT  // Type of the dense vector
-        , bool TF >    // Transpose flag
-const ElementType_<VT> min( const DenseVector<VT,TF>& dv )
-{
-   using blaze::min;
-
-   typedef ElementType_<VT>    ET;
-   typedef CompositeType_<VT>  CT;
-
-   CT a( ~dv );  // Evaluation of the dense vector operand
-
-   if( a.size() == 0UL ) return ET();
-
-   ET minimum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      minimum = min( minimum, a[i] );
-   return minimum;
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Returns the largest element of the dense vector.
-// \ingroup dense_vector
-//
-// \param dv The given dense vector.
-// \return The largest dense vector element.
-//
-// This function returns the largest element of the given dense vector. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
-// of fundamental data types).
-*/
-template< typename VT  // Type of the dense vector
-        , bool TF >    // Transpose flag
-const ElementType_<VT> max( const DenseVector<VT,TF>& dv )
-{
-   using blaze::max;
-
-   typedef ElementType_<VT>    ET;
-   typedef CompositeType_<VT>  CT;
-
-   CT a( ~dv );  // Evaluation of the dense vector operand
-
-   if( a.size() == 0UL ) return ET();
-
-   ET maximum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      maximum = max( maximum, a[i] );
-   return maximum;
-}
-//*************************************************************************************************
-
 } // namespace blaze
 
 #endif
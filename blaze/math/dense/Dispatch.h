@@ -0,0 +1,866 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Dispatch.h
+//  \brief Header file for the runtime dispatched dense kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DISPATCH_H_
+#define _BLAZE_MATH_DENSE_DISPATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/ConstDataAccess.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/simd/InstructionSet.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+// The dispatch packs are only passed to and returned from always inlined functions. Therefore
+// the ABI of these functions is irrelevant and the according warnings are disabled.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+//=================================================================================================
+//
+//  DISPATCH PACKS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD pack for the runtime dispatched kernels.
+// \ingroup dense
+//
+// The DispatchPack class template provides a GNU vector type of \a N bytes for the element type
+// \a T. In contrast to the intrinsic SIMD types, the vector type is independent of the compiler
+// flags. The instructions used for the vector operations are determined by the target attribute
+// of the function the kernel is instantiated in.
+*/
+template< typename T  // Element type
+        , size_t N >  // Size of the pack in bytes
+struct DispatchPack
+{
+   typedef T Type __attribute__(( vector_size( N ) ));
+
+   enum : size_t { size = N / sizeof(T) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a dispatch pack.
+// \ingroup dense
+//
+// \param address The first value to be loaded.
+// \return The loaded pack.
+*/
+template< typename PT    // Type of the pack
+        , typename T >   // Element type
+__attribute__(( always_inline )) inline PT dispatchLoad( const T* address ) noexcept
+{
+   PT value;
+   std::memcpy( &value, address, sizeof( PT ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a dispatch pack.
+// \ingroup dense
+//
+// \param address The target address.
+// \param value The pack to be stored.
+// \return void
+*/
+template< typename PT    // Type of the pack
+        , typename T >   // Element type
+__attribute__(( always_inline )) inline void dispatchStore( T* address, const PT& value ) noexcept
+{
+   std::memcpy( address, &value, sizeof( PT ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal sum of the elements of a dispatch pack.
+// \ingroup dense
+//
+// \param value The pack to be reduced.
+// \return The sum of all elements of the pack.
+*/
+template< size_t SIZE    // Number of elements of the pack
+        , typename PT >  // Type of the pack
+__attribute__(( always_inline )) inline auto dispatchSum( const PT& value ) noexcept
+   -> decltype( value[0] + value[0] )
+{
+   decltype( value[0] + value[0] ) sum( value[0] );
+   for( size_t k=1UL; k<SIZE; ++k ) {
+      sum += value[k];
+   }
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GENERIC DISPATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the scaled vector addition
+//        (\f$ \vec{y}=\alpha*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense
+//
+// \param n The number of elements.
+// \param alpha The scaling factor for \f$ \vec{x} \f$.
+// \param x Pointer to the first element of vector \a x.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of vector \a y.
+// \return void
+//
+// The kernel is always inlined into the instruction set specific wrapper functions. In case
+// \a beta is 0, the target vector is not read.
+*/
+template< size_t N      // Size of the packs in bytes
+        , typename T >  // Element type
+__attribute__(( always_inline )) inline
+   void dispatchAxpbyKernel( size_t n, T alpha, const T* x, T beta, T* y ) noexcept
+{
+   typedef typename DispatchPack<T,N>::Type  PT;
+   enum : size_t { SIZE = DispatchPack<T,N>::size };
+
+   const PT a( PT() + alpha );
+   const PT b( PT() + beta  );
+
+   size_t i( 0UL );
+
+   if( beta == T(0) ) {
+      for( ; (i+SIZE) <= n; i+=SIZE ) {
+         dispatchStore( y+i, a * dispatchLoad<PT>( x+i ) );
+      }
+      for( ; i<n; ++i ) {
+         y[i] = alpha * x[i];
+      }
+   }
+   else {
+      for( ; (i+SIZE) <= n; i+=SIZE ) {
+         dispatchStore( y+i, a * dispatchLoad<PT>( x+i ) + b * dispatchLoad<PT>( y+i ) );
+      }
+      for( ; i<n; ++i ) {
+         y[i] = alpha * x[i] + beta * y[i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the row-major matrix/vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense
+//
+// \param m The number of rows of matrix \a A.
+// \param n The number of columns of matrix \a A.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the row-major matrix \a A.
+// \param lda The total number of elements between two rows of matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of vector \a y.
+// \return void
+//
+// The kernel computes four dot products at a time in order to reuse the loaded elements of
+// vector \a x. In case \a beta is 0, the target vector is not read.
+*/
+template< size_t N      // Size of the packs in bytes
+        , typename T >  // Element type
+__attribute__(( always_inline )) inline
+   void dispatchGemvKernel( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                            const T* x, T beta, T* y ) noexcept
+{
+   typedef typename DispatchPack<T,N>::Type  PT;
+   enum : size_t { SIZE = DispatchPack<T,N>::size };
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + (i    )*lda );
+      const T* a2( A + (i+1UL)*lda );
+      const T* a3( A + (i+2UL)*lda );
+      const T* a4( A + (i+3UL)*lda );
+
+      PT xmm1 = PT(), xmm2 = PT(), xmm3 = PT(), xmm4 = PT();
+      size_t j( 0UL );
+
+      for( ; (j+SIZE) <= n; j+=SIZE ) {
+         const PT x1( dispatchLoad<PT>( x+j ) );
+         xmm1 += dispatchLoad<PT>( a1+j ) * x1;
+         xmm2 += dispatchLoad<PT>( a2+j ) * x1;
+         xmm3 += dispatchLoad<PT>( a3+j ) * x1;
+         xmm4 += dispatchLoad<PT>( a4+j ) * x1;
+      }
+
+      T value1( dispatchSum<SIZE>( xmm1 ) );
+      T value2( dispatchSum<SIZE>( xmm2 ) );
+      T value3( dispatchSum<SIZE>( xmm3 ) );
+      T value4( dispatchSum<SIZE>( xmm4 ) );
+
+      for( ; j<n; ++j ) {
+         value1 += a1[j] * x[j];
+         value2 += a2[j] * x[j];
+         value3 += a3[j] * x[j];
+         value4 += a4[j] * x[j];
+      }
+
+      if( beta == T(0) ) {
+         y[i    ] = alpha * value1;
+         y[i+1UL] = alpha * value2;
+         y[i+2UL] = alpha * value3;
+         y[i+3UL] = alpha * value4;
+      }
+      else {
+         y[i    ] = alpha * value1 + beta * y[i    ];
+         y[i+1UL] = alpha * value2 + beta * y[i+1UL];
+         y[i+2UL] = alpha * value3 + beta * y[i+2UL];
+         y[i+3UL] = alpha * value4 + beta * y[i+3UL];
+      }
+   }
+
+   for( ; i<m; ++i )
+   {
+      const T* a1( A + i*lda );
+
+      PT xmm1 = PT();
+      size_t j( 0UL );
+
+      for( ; (j+SIZE) <= n; j+=SIZE ) {
+         xmm1 += dispatchLoad<PT>( a1+j ) * dispatchLoad<PT>( x+j );
+      }
+
+      T value( dispatchSum<SIZE>( xmm1 ) );
+
+      for( ; j<n; ++j ) {
+         value += a1[j] * x[j];
+      }
+
+      y[i] = ( beta == T(0) )?( alpha * value ):( alpha * value + beta * y[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the column-major matrix/vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense
+//
+// \param m The number of rows of matrix \a A.
+// \param n The number of columns of matrix \a A.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the column-major matrix \a A.
+// \param lda The total number of elements between two columns of matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of vector \a y.
+// \return void
+//
+// The kernel adds four scaled columns at a time to the target vector in order to reduce the
+// number of loads and stores of vector \a y. In case \a beta is 0, the target vector is not
+// read.
+*/
+template< size_t N      // Size of the packs in bytes
+        , typename T >  // Element type
+__attribute__(( always_inline )) inline
+   void dispatchTGemvKernel( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                             const T* x, T beta, T* y ) noexcept
+{
+   typedef typename DispatchPack<T,N>::Type  PT;
+   enum : size_t { SIZE = DispatchPack<T,N>::size };
+
+   if( beta == T(0) ) {
+      for( size_t i=0UL; i<m; ++i )
+         y[i] = T(0);
+   }
+   else if( beta != T(1) ) {
+      for( size_t i=0UL; i<m; ++i )
+         y[i] *= beta;
+   }
+
+   size_t j( 0UL );
+
+   for( ; (j+4UL) <= n; j+=4UL )
+   {
+      const T* a1( A + (j    )*lda );
+      const T* a2( A + (j+1UL)*lda );
+      const T* a3( A + (j+2UL)*lda );
+      const T* a4( A + (j+3UL)*lda );
+
+      const T x1( alpha * x[j    ] );
+      const T x2( alpha * x[j+1UL] );
+      const T x3( alpha * x[j+2UL] );
+      const T x4( alpha * x[j+3UL] );
+
+      const PT xmm1( PT() + x1 );
+      const PT xmm2( PT() + x2 );
+      const PT xmm3( PT() + x3 );
+      const PT xmm4( PT() + x4 );
+
+      size_t i( 0UL );
+
+      for( ; (i+SIZE) <= m; i+=SIZE ) {
+         dispatchStore( y+i, dispatchLoad<PT>( y+i ) + dispatchLoad<PT>( a1+i ) * xmm1
+                                                    + dispatchLoad<PT>( a2+i ) * xmm2
+                                                    + dispatchLoad<PT>( a3+i ) * xmm3
+                                                    + dispatchLoad<PT>( a4+i ) * xmm4 );
+      }
+      for( ; i<m; ++i ) {
+         y[i] += a1[i] * x1 + a2[i] * x2 + a3[i] * x3 + a4[i] * x4;
+      }
+   }
+
+   for( ; j<n; ++j )
+   {
+      const T* a1( A + j*lda );
+
+      const T x1( alpha * x[j] );
+      const PT xmm1( PT() + x1 );
+
+      size_t i( 0UL );
+
+      for( ; (i+SIZE) <= m; i+=SIZE ) {
+         dispatchStore( y+i, dispatchLoad<PT>( y+i ) + dispatchLoad<PT>( a1+i ) * xmm1 );
+      }
+      for( ; i<m; ++i ) {
+         y[i] += a1[i] * x1;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the row-major matrix/matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense
+//
+// \param m The number of rows of matrix \a A and \a C.
+// \param n The number of columns of matrix \a B and \a C.
+// \param k The number of columns of matrix \a A and rows of matrix \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of the row-major matrix \a A.
+// \param lda The total number of elements between two rows of matrix \a A.
+// \param B Pointer to the first element of the row-major matrix \a B.
+// \param ldb The total number of elements between two rows of matrix \a B.
+// \param beta The scaling factor for \f$ C \f$.
+// \param C Pointer to the first element of the row-major matrix \a C.
+// \param ldc The total number of elements between two rows of matrix \a C.
+// \return void
+//
+// The kernel is optimized for small matrices that fit into the cache and therefore doesn't
+// perform any packing of the operands. Each row of \a C is computed in blocks of four packs.
+// In case \a beta is 0, the target matrix is not read.
+*/
+template< size_t N      // Size of the packs in bytes
+        , typename T >  // Element type
+__attribute__(( always_inline )) inline
+   void dispatchGemmKernel( size_t m, size_t n, size_t k, T alpha, const T* A, size_t lda,
+                            const T* B, size_t ldb, T beta, T* C, size_t ldc ) noexcept
+{
+   typedef typename DispatchPack<T,N>::Type  PT;
+   enum : size_t { SIZE = DispatchPack<T,N>::size };
+
+   const PT a( PT() + alpha );
+   const PT b( PT() + beta  );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const T* ai( A + i*lda );
+      T* ci( C + i*ldc );
+
+      size_t j( 0UL );
+
+      for( ; (j+SIZE*4UL) <= n; j+=SIZE*4UL )
+      {
+         PT xmm1 = PT(), xmm2 = PT(), xmm3 = PT(), xmm4 = PT();
+
+         for( size_t l=0UL; l<k; ++l ) {
+            const PT a1( PT() + ai[l] );
+            const T* bl( B + l*ldb + j );
+            xmm1 += a1 * dispatchLoad<PT>( bl            );
+            xmm2 += a1 * dispatchLoad<PT>( bl+SIZE       );
+            xmm3 += a1 * dispatchLoad<PT>( bl+SIZE*2UL   );
+            xmm4 += a1 * dispatchLoad<PT>( bl+SIZE*3UL   );
+         }
+
+         if( beta == T(0) ) {
+            dispatchStore( ci+j           , a * xmm1 );
+            dispatchStore( ci+j+SIZE      , a * xmm2 );
+            dispatchStore( ci+j+SIZE*2UL  , a * xmm3 );
+            dispatchStore( ci+j+SIZE*3UL  , a * xmm4 );
+         }
+         else {
+            dispatchStore( ci+j           , a * xmm1 + b * dispatchLoad<PT>( ci+j           ) );
+            dispatchStore( ci+j+SIZE      , a * xmm2 + b * dispatchLoad<PT>( ci+j+SIZE      ) );
+            dispatchStore( ci+j+SIZE*2UL  , a * xmm3 + b * dispatchLoad<PT>( ci+j+SIZE*2UL  ) );
+            dispatchStore( ci+j+SIZE*3UL  , a * xmm4 + b * dispatchLoad<PT>( ci+j+SIZE*3UL  ) );
+         }
+      }
+
+      for( ; (j+SIZE) <= n; j+=SIZE )
+      {
+         PT xmm1 = PT();
+
+         for( size_t l=0UL; l<k; ++l ) {
+            xmm1 += ( PT() + ai[l] ) * dispatchLoad<PT>( B + l*ldb + j );
+         }
+
+         if( beta == T(0) )
+            dispatchStore( ci+j, a * xmm1 );
+         else
+            dispatchStore( ci+j, a * xmm1 + b * dispatchLoad<PT>( ci+j ) );
+      }
+
+      for( ; j<n; ++j )
+      {
+         T value( 0 );
+
+         for( size_t l=0UL; l<k; ++l ) {
+            value += ai[l] * B[l*ldb+j];
+         }
+
+         ci[j] = ( beta == T(0) )?( alpha * value ):( alpha * value + beta * ci[j] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET SPECIFIC KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Instruction set specific instantiations of the generic dispatch kernels.
+// \ingroup dense
+//
+// Each kernel is instantiated once with the compile time SIMD width and once for each of the
+// AVX2 and AVX-512 instruction sets. The target attribute enables the according instructions
+// for the single function, independent of the compiler flags of the translation unit.
+*/
+template< typename T >
+void dispatchAxpbyDefault( size_t n, T alpha, const T* x, T beta, T* y )
+{
+   dispatchAxpbyKernel< SIMDTrait<T>::size*sizeof(T) >( n, alpha, x, beta, y );
+}
+
+template< typename T >
+__attribute__(( target( "avx2,fma" ) ))
+void dispatchAxpbyAVX2( size_t n, T alpha, const T* x, T beta, T* y )
+{
+   dispatchAxpbyKernel<32UL>( n, alpha, x, beta, y );
+}
+
+template< typename T >
+__attribute__(( target( "avx512f" ) ))
+void dispatchAxpbyAVX512( size_t n, T alpha, const T* x, T beta, T* y )
+{
+   dispatchAxpbyKernel<64UL>( n, alpha, x, beta, y );
+}
+
+template< typename T >
+void dispatchGemvDefault( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                          const T* x, T beta, T* y )
+{
+   dispatchGemvKernel< SIMDTrait<T>::size*sizeof(T) >( m, n, alpha, A, lda, x, beta, y );
+}
+
+template< typename T >
+__attribute__(( target( "avx2,fma" ) ))
+void dispatchGemvAVX2( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                       const T* x, T beta, T* y )
+{
+   dispatchGemvKernel<32UL>( m, n, alpha, A, lda, x, beta, y );
+}
+
+template< typename T >
+__attribute__(( target( "avx512f" ) ))
+void dispatchGemvAVX512( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                         const T* x, T beta, T* y )
+{
+   dispatchGemvKernel<64UL>( m, n, alpha, A, lda, x, beta, y );
+}
+
+template< typename T >
+void dispatchTGemvDefault( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                           const T* x, T beta, T* y )
+{
+   dispatchTGemvKernel< SIMDTrait<T>::size*sizeof(T) >( m, n, alpha, A, lda, x, beta, y );
+}
+
+template< typename T >
+__attribute__(( target( "avx2,fma" ) ))
+void dispatchTGemvAVX2( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                        const T* x, T beta, T* y )
+{
+   dispatchTGemvKernel<32UL>( m, n, alpha, A, lda, x, beta, y );
+}
+
+template< typename T >
+__attribute__(( target( "avx512f" ) ))
+void dispatchTGemvAVX512( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                          const T* x, T beta, T* y )
+{
+   dispatchTGemvKernel<64UL>( m, n, alpha, A, lda, x, beta, y );
+}
+
+template< typename T >
+void dispatchGemmDefault( size_t m, size_t n, size_t k, T alpha, const T* A, size_t lda,
+                          const T* B, size_t ldb, T beta, T* C, size_t ldc )
+{
+   dispatchGemmKernel< SIMDTrait<T>::size*sizeof(T) >( m, n, k, alpha, A, lda, B, ldb,
+                                                       beta, C, ldc );
+}
+
+template< typename T >
+__attribute__(( target( "avx2,fma" ) ))
+void dispatchGemmAVX2( size_t m, size_t n, size_t k, T alpha, const T* A, size_t lda,
+                       const T* B, size_t ldb, T beta, T* C, size_t ldc )
+{
+   dispatchGemmKernel<32UL>( m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+template< typename T >
+__attribute__(( target( "avx512f" ) ))
+void dispatchGemmAVX512( size_t m, size_t n, size_t k, T alpha, const T* A, size_t lda,
+                         const T* B, size_t ldb, T beta, T* C, size_t ldc )
+{
+   dispatchGemmKernel<64UL>( m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCH TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of the runtime dispatched kernels for the element type \a T.
+// \ingroup dense
+*/
+template< typename T >  // Element type
+struct DispatchKernels
+{
+   //! Scaled vector addition.
+   void (*axpby)( size_t, T, const T*, T, T* );
+
+   //! Row-major dense matrix/dense vector multiplication.
+   void (*gemv)( size_t, size_t, T, const T*, size_t, const T*, T, T* );
+
+   //! Column-major dense matrix/dense vector multiplication.
+   void (*tgemv)( size_t, size_t, T, const T*, size_t, const T*, T, T* );
+
+   //! Row-major dense matrix/dense matrix multiplication.
+   void (*gemm)( size_t, size_t, size_t, T, const T*, size_t, const T*, size_t, T, T*, size_t );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the table of runtime dispatched kernels for the given instruction set.
+// \ingroup dense
+//
+// \param set The selected SIMD instruction set.
+// \return The according table of kernels.
+*/
+template< typename T >  // Element type
+DispatchKernels<T> createDispatchKernels( SIMDInstructionSet set ) noexcept
+{
+   switch( set ) {
+      case avx512:
+         return { &dispatchAxpbyAVX512<T>, &dispatchGemvAVX512<T>,
+                  &dispatchTGemvAVX512<T>, &dispatchGemmAVX512<T> };
+      case avx2:
+         return { &dispatchAxpbyAVX2<T>, &dispatchGemvAVX2<T>,
+                  &dispatchTGemvAVX2<T>, &dispatchGemmAVX2<T> };
+      default:
+         return { &dispatchAxpbyDefault<T>, &dispatchGemvDefault<T>,
+                  &dispatchTGemvDefault<T>, &dispatchGemmDefault<T> };
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the table of runtime dispatched kernels for the element type \a T.
+// \ingroup dense
+//
+// \return Reference to the table of kernels.
+//
+// The table is set up once, on the first call of the function, based on the instruction set
+// returned by the getInstructionSet() function.
+*/
+template< typename T >  // Element type
+inline const DispatchKernels<T>& getDispatchKernels() noexcept
+{
+   static const DispatchKernels<T> kernels( createDispatchKernels<T>( getInstructionSet() ) );
+   return kernels;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime dispatch functions */
+//@{
+template< typename VT1, bool TF, typename VT2, typename ST >
+inline void dispatchAxpby( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x,
+                           ST alpha, ST beta );
+
+template< typename VT1, typename MT1, bool SO, typename VT2, typename ST >
+inline void dispatchGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                          const DenseVector<VT2,false>& x, ST alpha, ST beta );
+
+template< typename MT1, typename MT2, typename MT3, typename ST >
+inline void dispatchGemm( DenseMatrix<MT1,false>& C, const DenseMatrix<MT2,false>& A,
+                          const DenseMatrix<MT3,false>& B, ST alpha, ST beta );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched scaled vector addition (\f$ \vec{y}=\alpha*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ \vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// This function performs the scaled vector addition by means of the kernel for the instruction
+// set selected at runtime. Note that the function only works for vectors with \c float or
+// \c double element type. The attempt to call the function with vectors of any other element
+// type results in a compile time error.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF        // Transpose flag
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scalar factors
+inline void dispatchAxpby( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& x,
+                           ST alpha, ST beta )
+{
+   typedef ElementType_<VT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsFloat<ET>::value || IsDouble<ET>::value );
+   BLAZE_STATIC_ASSERT( ( IsSame< ET, ElementType_<VT2> >::value ) );
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~x).size(), "Invalid vector sizes" );
+
+   getDispatchKernels<ET>().axpby( (~x).size(), ET( alpha ), (~x).data(), ET( beta ), (~y).data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return void
+//
+// This function performs the dense matrix/dense vector multiplication by means of the kernel
+// for the instruction set selected at runtime. Note that the function only works for vectors
+// and matrices with \c float or \c double element type. The attempt to call the function with
+// vectors and matrices of any other element type results in a compile time error.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , bool SO        // Storage order of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scalar factors
+inline void dispatchGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,SO>& A,
+                          const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   typedef ElementType_<VT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsFloat<ET>::value || IsDouble<ET>::value );
+   BLAZE_STATIC_ASSERT( ( IsSame< ET, ElementType_<MT1> >::value ) );
+   BLAZE_STATIC_ASSERT( ( IsSame< ET, ElementType_<VT2> >::value ) );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~y).size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~x).size(), "Invalid vector size" );
+
+   const DispatchKernels<ET>& kernels( getDispatchKernels<ET>() );
+
+   ( SO ? kernels.tgemv : kernels.gemv )( (~A).rows(), (~A).columns(), ET( alpha ), (~A).data(),
+                                          (~A).spacing(), (~x).data(), ET( beta ), (~y).data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The left-hand side row-major dense matrix operand.
+// \param B The right-hand side row-major dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function performs the dense matrix/dense matrix multiplication by means of the kernel
+// for the instruction set selected at runtime. The kernel does not pack the operands and is
+// therefore meant for small matrices. Note that the function only works for matrices with
+// \c float or \c double element type. The attempt to call the function with matrices of any
+// other element type results in a compile time error.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scalar factors
+inline void dispatchGemm( DenseMatrix<MT1,false>& C, const DenseMatrix<MT2,false>& A,
+                          const DenseMatrix<MT3,false>& B, ST alpha, ST beta )
+{
+   typedef ElementType_<MT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT3 );
+
+   BLAZE_STATIC_ASSERT( IsFloat<ET>::value || IsDouble<ET>::value );
+   BLAZE_STATIC_ASSERT( ( IsSame< ET, ElementType_<MT2> >::value ) );
+   BLAZE_STATIC_ASSERT( ( IsSame< ET, ElementType_<MT3> >::value ) );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).columns() == (~C).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   getDispatchKernels<ET>().gemm( (~C).rows(), (~C).columns(), (~A).columns(), ET( alpha ),
+                                  (~A).data(), (~A).spacing(), (~B).data(), (~B).spacing(),
+                                  ET( beta ), (~C).data(), (~C).spacing() );
+}
+//*************************************************************************************************
+
+#pragma GCC diagnostic pop
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -86,6 +87,7 @@
 #include <blaze/system/Blocking.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
 #include <blaze/system/StorageOrder.h>
@@ -105,6 +107,7 @@
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -335,8 +338,8 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
                                      void           resize ( size_t m, size_t n, bool preserve=true );
                               inline void           extend ( size_t m, size_t n, bool preserve=true );
                               inline void           reserve( size_t elements );
-                              inline DynamicMatrix& transpose();
-                              inline DynamicMatrix& ctranspose();
+                              inline DynamicMatrix& transpose ( bool inplace=false );
+                              inline DynamicMatrix& ctranspose( bool inplace=false );
    template< typename Other > inline DynamicMatrix& scale( const Other& scalar );
                               inline void           swap( DynamicMatrix& m ) noexcept;
    //@}
@@ -451,6 +454,8 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    /*!\name Utility functions */
    //@{
    inline size_t adjustColumns( size_t minColumns ) const noexcept;
+   inline void   firstTouch( const Type& init );
+   inline void   firstTouch( const DynamicMatrix& rhs );
    //@}
    //**********************************************************************************************
 
@@ -527,7 +532,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -558,13 +566,18 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( init );
+   }
+   else {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n_; ++j )
+            v_[i*nn_+j] = init;
 
-      if( IsVectorizable<Type>::value ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
+         if( IsVectorizable<Type>::value ) {
+            for( size_t j=n_; j<nn_; ++j )
+               v_[i*nn_+j] = Type();
+         }
       }
    }
 
@@ -729,8 +742,13 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( m );
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = m.v_[i];
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -776,10 +794,15 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
-                  j<( IsVectorizable<Type>::value ? nn_ : n_ ); ++j ) {
-         v_[i*nn_+j] = Type();
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( Type() );
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
+                     j<( IsVectorizable<Type>::value ? nn_ : n_ ); ++j ) {
+            v_[i*nn_+j] = Type();
+         }
       }
    }
 
@@ -1739,6 +1762,14 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       std::swap( v_, v );
       deallocate( v );
       capacity_ = m*nn;
+
+      if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+         m_  = m;
+         n_  = n;
+         nn_ = nn;
+         firstTouch( Type() );
+         return;
+      }
    }
 
    if( IsVectorizable<Type>::value ) {
@@ -1815,29 +1846,49 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 //*************************************************************************************************
 /*!\brief In-place transpose of the matrix.
 //
+// \param inplace \a true to transpose a non-square matrix without a temporary matrix.
 // \return Reference to the transposed matrix.
+// \exception std::bad_alloc Allocation failed.
+//
+// In case the matrix is square, the matrix is transposed in-place by a blocked, SIMD-tiled
+// exchange of the mirrored elements. By default, a non-square matrix is transposed into a
+// temporary matrix. In case \a inplace is set to \a true and the capacity of the matrix
+// suffices for the transposed matrix (including padding), a non-square matrix is transposed
+// within its own memory by following the cycles of the underlying permutation. This requires
+// only a single bit of additional memory per element and therefore avoids doubling the peak
+// memory requirement, but is considerably slower due to the scattered memory accesses:
+
+   \code
+   blaze::DynamicMatrix<double> A( 1000UL, 3000UL );
+   // ... Initialization
+
+   A.transpose( true );  // Transposition without a temporary 3000x1000 matrix
+   \endcode
+
+// In case the capacity does not suffice, the matrix is transposed into a temporary matrix.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
+inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose( bool inplace )
 {
-   using std::swap;
-
-   const size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t ii=0UL; ii<m_; ii+=block ) {
-         const size_t iend( min( ii+block, m_ ) );
-         for( size_t jj=0UL; jj<=ii; jj+=block ) {
-            for( size_t i=ii; i<iend; ++i ) {
-               const size_t jend( min( jj+block, n_, i ) );
-               for( size_t j=jj; j<jend; ++j ) {
-                  swap( v_[i*nn_+j], v_[j*nn_+i] );
-               }
-            }
-         }
+      transposeKernel( m_, v_, nn_ );
+   }
+   else if( inplace && n_*adjustColumns( m_ ) <= capacity_ )
+   {
+      const size_t mm( adjustColumns( m_ ) );
+
+      transposeCycles( m_, n_, v_, nn_, mm );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=0UL; i<n_; ++i )
+            for( size_t j=m_; j<mm; ++j )
+               v_[i*mm+j] = Type();
       }
+
+      std::swap( m_, n_ );
+      nn_ = mm;
    }
    else
    {
@@ -1853,11 +1904,15 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 //*************************************************************************************************
 /*!\brief In-place conjugate transpose of the matrix.
 //
+// \param inplace \a true to transpose a non-square matrix without a temporary matrix.
 // \return Reference to the transposed matrix.
+// \exception std::bad_alloc Allocation failed.
+//
+// See the transpose() function for the effect of the \a inplace flag.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
+inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose( bool inplace )
 {
    const size_t block( BLOCK_SIZE );
 
@@ -1883,8 +1938,11 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      swap( tmp );
+      transpose( inplace );
+
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            conjugate( v_[i*nn_+j] );
    }
 
    return *this;
@@ -1948,6 +2006,77 @@ inline size_t DynamicMatrix<Type,SO>::adjustColumns( size_t minColumns ) const n
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief First-touch initialization of all elements of the matrix.
+//
+// \param init The initial value of the matrix elements.
+// \return void
+//
+// This function initializes all matrix elements with the given value and all padding elements
+// with the default value. The matrix is partitioned in the same way as by the SMP assignment
+// (see the smpFirstTouch() function). In case the first-touch NUMA policy is selected (see the
+// \c BLAZE_NUMA_POLICY switch in the <tt>./blaze/config/NUMA.h</tt> configuration file), each
+// partition is initialized by the thread that processes it during SMP assignments, such that
+// the memory pages of the partition are placed on the NUMA node of this thread.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicMatrix<Type,SO>::firstTouch( const Type& init )
+{
+   // Capturing the members by value prevents the matrix from escaping into the thread backend
+   Type* const v( v_ );
+   const size_t columns( n_ );
+   const size_t spacing( nn_ );
+
+   smpFirstTouch( *this, [v,columns,spacing,&init]( size_t row, size_t column, size_t m, size_t n )
+   {
+      const size_t jend( ( column+n == columns )?( spacing ):( column+n ) );
+
+      for( size_t i=row; i<row+m; ++i ) {
+         for( size_t j=column; j<column+n; ++j )
+            v[i*spacing+j] = init;
+         for( size_t j=column+n; j<jend; ++j )
+            v[i*spacing+j] = Type();
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief First-touch initialization of the matrix as a copy of the given matrix.
+//
+// \param rhs The matrix to be copied.
+// \return void
+//
+// This function initializes all elements of the matrix, including the padding elements, with
+// the according elements of the given matrix of the same size. The elements are initialized
+// in the same way as by the firstTouch( const Type& ) function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicMatrix<Type,SO>::firstTouch( const DynamicMatrix& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == rhs.m_ && nn_ == rhs.nn_, "Invalid matrix sizes" );
+
+   Type* const v( v_ );
+   const Type* const w( rhs.v_ );
+   const size_t columns( n_ );
+   const size_t spacing( nn_ );
+
+   smpFirstTouch( *this, [v,w,columns,spacing]( size_t row, size_t column, size_t m, size_t n )
+   {
+      const size_t jend( ( column+n == columns )?( spacing ):( column+n ) );
+
+      for( size_t i=row; i<row+m; ++i ) {
+         for( size_t j=column; j<jend; ++j )
+            v[i*spacing+j] = w[i*spacing+j];
+      }
+   } );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -3084,8 +3213,8 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
                                      void           resize ( size_t m, size_t n, bool preserve=true );
                               inline void           extend ( size_t m, size_t n, bool preserve=true );
                               inline void           reserve( size_t elements );
-                              inline DynamicMatrix& transpose();
-                              inline DynamicMatrix& ctranspose();
+                              inline DynamicMatrix& transpose ( bool inplace=false );
+                              inline DynamicMatrix& ctranspose( bool inplace=false );
    template< typename Other > inline DynamicMatrix& scale( const Other& scalar );
                               inline void           swap( DynamicMatrix& m ) noexcept;
    //@}
@@ -3194,6 +3323,8 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    /*!\name Utility functions */
    //@{
    inline size_t adjustRows( size_t minRows ) const noexcept;
+   inline void   firstTouch( const Type& init );
+   inline void   firstTouch( const DynamicMatrix& rhs );
    //@}
    //**********************************************************************************************
 
@@ -3263,7 +3394,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3295,13 +3429,18 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( init );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i )
+            v_[i+j*mm_] = init;
 
-      if( IsVectorizable<Type>::value ) {
-         for( size_t i=m_; i<mm_; ++i )
-            v_[i+j*mm_] = Type();
+         if( IsVectorizable<Type>::value ) {
+            for( size_t i=m_; i<mm_; ++i )
+               v_[i+j*mm_] = Type();
+         }
       }
    }
 
@@ -3487,8 +3626,13 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( m );
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = m.v_[i];
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -3536,10 +3680,15 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
-                  i<( IsVectorizable<Type>::value ? mm_ : m_ ); ++i ) {
-         v_[i+j*mm_] = Type();
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( Type() );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
+                     i<( IsVectorizable<Type>::value ? mm_ : m_ ); ++i ) {
+            v_[i+j*mm_] = Type();
+         }
       }
    }
 
@@ -4499,6 +4648,14 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       std::swap( v_, v );
       deallocate( v );
       capacity_ = mm*n;
+
+      if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+         m_  = m;
+         mm_ = mm;
+         n_  = n;
+         firstTouch( Type() );
+         return;
+      }
    }
 
    if( IsVectorizable<Type>::value ) {
@@ -4579,28 +4736,31 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 /*! \cond BLAZE_INTERNAL */
 /*!\brief In-place transpose of the matrix.
 //
+// \param inplace \a true to transpose a non-square matrix without a temporary matrix.
 // \return Reference to the transposed matrix.
+// \exception std::bad_alloc Allocation failed.
 */
 template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
+inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose( bool inplace )
 {
-   using std::swap;
-
-   const size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t jj=0UL; jj<n_; jj+=block ) {
-         const size_t jend( min( jj+block, n_ ) );
-         for( size_t ii=0UL; ii<=jj; ii+=block ) {
-            for( size_t j=jj; j<jend; ++j ) {
-               const size_t iend( min( ii+block, m_, j ) );
-               for( size_t i=ii; i<iend; ++i ) {
-                  swap( v_[i+j*mm_], v_[j+i*mm_] );
-               }
-            }
-         }
+      transposeKernel( n_, v_, mm_ );
+   }
+   else if( inplace && m_*adjustRows( n_ ) <= capacity_ )
+   {
+      const size_t nn( adjustRows( n_ ) );
+
+      transposeCycles( n_, m_, v_, mm_, nn );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t j=0UL; j<m_; ++j )
+            for( size_t i=n_; i<nn; ++i )
+               v_[i+j*nn] = Type();
       }
+
+      std::swap( m_, n_ );
+      mm_ = nn;
    }
    else
    {
@@ -4618,10 +4778,14 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 /*! \cond BLAZE_INTERNAL */
 /*!\brief In-place conjugate transpose of the matrix.
 //
+// \param inplace \a true to transpose a non-square matrix without a temporary matrix.
 // \return Reference to the transposed matrix.
+// \exception std::bad_alloc Allocation failed.
+//
+// See the transpose() function for the effect of the \a inplace flag.
 */
 template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
+inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose( bool inplace )
 {
    const size_t block( BLOCK_SIZE );
 
@@ -4647,8 +4811,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      this->swap( tmp );
+      transpose( inplace );
+
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            conjugate( v_[i+j*mm_] );
    }
 
    return *this;
@@ -4716,6 +4883,79 @@ inline size_t DynamicMatrix<Type,true>::adjustRows( size_t minRows ) const noexc
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First-touch initialization of all elements of the matrix.
+//
+// \param init The initial value of the matrix elements.
+// \return void
+//
+// This function initializes all matrix elements with the given value and all padding elements
+// with the default value. The matrix is partitioned in the same way as by the SMP assignment
+// (see the smpFirstTouch() function). In case the first-touch NUMA policy is selected (see the
+// \c BLAZE_NUMA_POLICY switch in the <tt>./blaze/config/NUMA.h</tt> configuration file), each
+// partition is initialized by the thread that processes it during SMP assignments, such that
+// the memory pages of the partition are placed on the NUMA node of this thread.
+*/
+template< typename Type >  // Data type of the matrix
+inline void DynamicMatrix<Type,true>::firstTouch( const Type& init )
+{
+   // Capturing the members by value prevents the matrix from escaping into the thread backend
+   Type* const v( v_ );
+   const size_t rows( m_ );
+   const size_t spacing( mm_ );
+
+   smpFirstTouch( *this, [v,rows,spacing,&init]( size_t row, size_t column, size_t m, size_t n )
+   {
+      const size_t iend( ( row+m == rows )?( spacing ):( row+m ) );
+
+      for( size_t j=column; j<column+n; ++j ) {
+         for( size_t i=row; i<row+m; ++i )
+            v[i+j*spacing] = init;
+         for( size_t i=row+m; i<iend; ++i )
+            v[i+j*spacing] = Type();
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First-touch initialization of the matrix as a copy of the given matrix.
+//
+// \param rhs The matrix to be copied.
+// \return void
+//
+// This function initializes all elements of the matrix, including the padding elements, with
+// the according elements of the given matrix of the same size. The elements are initialized
+// in the same way as by the firstTouch( const Type& ) function.
+*/
+template< typename Type >  // Data type of the matrix
+inline void DynamicMatrix<Type,true>::firstTouch( const DynamicMatrix& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( mm_ == rhs.mm_ && n_ == rhs.n_, "Invalid matrix sizes" );
+
+   Type* const v( v_ );
+   const Type* const w( rhs.v_ );
+   const size_t rows( m_ );
+   const size_t spacing( mm_ );
+
+   smpFirstTouch( *this, [v,w,rows,spacing]( size_t row, size_t column, size_t m, size_t n )
+   {
+      const size_t iend( ( row+m == rows )?( spacing ):( row+m ) );
+
+      for( size_t j=column; j<column+n; ++j ) {
+         for( size_t i=row; i<iend; ++i )
+            v[i+j*spacing] = w[i+j*spacing];
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -45,6 +45,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Dispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -76,10 +77,12 @@
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Algorithm.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
@@ -94,8 +97,14 @@
 #include <blaze/util/Memory.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 
 
@@ -371,6 +380,23 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the runtime dispatch mode is active and the right-hand side vector provides direct
+       access to its single or double precision elements, the nested \a value will be set to 1,
+       otherwise it will be 0. */
+   template< typename VT >
+   struct DispatchedAssign {
+      enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                            VectorizedAssign<VT>::value &&
+                            HasConstDataAccess<VT>::value &&
+                            IsSame< Type, ElementType_<VT> >::value &&
+                            ( IsFloat<Type>::value || IsDouble<Type>::value ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -406,7 +432,11 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    inline DisableIf_<VectorizedAssign<VT> > assign( const DenseVector<VT,TF>& rhs );
 
    template< typename VT >
-   inline EnableIf_<VectorizedAssign<VT> > assign( const DenseVector<VT,TF>& rhs );
+   inline EnableIf_< And< VectorizedAssign<VT>, Not< DispatchedAssign<VT> > > >
+      assign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline EnableIf_<DispatchedAssign<VT> > assign( const DenseVector<VT,TF>& rhs );
 
    template< typename VT > inline void assign( const SparseVector<VT,TF>& rhs );
 
@@ -414,7 +444,11 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    inline DisableIf_<VectorizedAddAssign<VT> > addAssign( const DenseVector<VT,TF>& rhs );
 
    template< typename VT >
-   inline EnableIf_<VectorizedAddAssign<VT> > addAssign( const DenseVector<VT,TF>& rhs );
+   inline EnableIf_< And< VectorizedAddAssign<VT>, Not< DispatchedAssign<VT> > > >
+      addAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline EnableIf_<DispatchedAssign<VT> > addAssign( const DenseVector<VT,TF>& rhs );
 
    template< typename VT > inline void addAssign( const SparseVector<VT,TF>& rhs );
 
@@ -422,7 +456,11 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    inline DisableIf_<VectorizedSubAssign<VT> > subAssign( const DenseVector<VT,TF>& rhs );
 
    template< typename VT >
-   inline EnableIf_<VectorizedSubAssign<VT> > subAssign( const DenseVector<VT,TF>& rhs );
+   inline EnableIf_< And< VectorizedSubAssign<VT>, Not< DispatchedAssign<VT> > > >
+      subAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline EnableIf_<DispatchedAssign<VT> > subAssign( const DenseVector<VT,TF>& rhs );
 
    template< typename VT > inline void subAssign( const SparseVector<VT,TF>& rhs );
 
@@ -447,6 +485,8 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    /*!\name Utility functions */
    //@{
    inline size_t adjustCapacity( size_t minCapacity ) const noexcept;
+   inline void   firstTouch( const Type& init );
+   inline void   firstTouch( const DynamicVector& rhs );
    //@}
    //**********************************************************************************************
 
@@ -512,7 +552,10 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
    }
@@ -537,12 +580,17 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( init );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
 
-   if( IsVectorizable<Type>::value ) {
-      for( size_t i=size_; i<capacity_; ++i )
-         v_[i] = Type();
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=size_; i<capacity_; ++i )
+            v_[i] = Type();
+      }
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -676,8 +724,13 @@ inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = v.v_[i];
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( v );
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = v.v_[i];
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -716,9 +769,14 @@ inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
    , capacity_( adjustCapacity( size_ ) )      // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=( IsSparseVector<VT>::value   ? 0UL       : size_ );
-               i<( IsVectorizable<Type>::value ? capacity_ : size_ ); ++i ) {
-      v_[i] = Type();
+   if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value ) {
+      firstTouch( Type() );
+   }
+   else {
+      for( size_t i=( IsSparseVector<VT>::value   ? 0UL       : size_ );
+                  i<( IsVectorizable<Type>::value ? capacity_ : size_ ); ++i ) {
+         v_[i] = Type();
+      }
    }
 
    smpAssign( *this, ~v );
@@ -1443,6 +1501,16 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
       const size_t newCapacity( adjustCapacity( n ) );
       Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
 
+      // Initializing the new array in parallel in case the old values are not preserved
+      if( BLAZE_NUMA_FIRST_TOUCH && IsBuiltin<Type>::value && !preserve ) {
+         std::swap( v_, tmp );
+         deallocate( tmp );
+         capacity_ = newCapacity;
+         size_     = n;
+         firstTouch( Type() );
+         return;
+      }
+
       // Initializing the new array
       if( preserve ) {
          transfer( v_, v_+size_, tmp );
@@ -1578,6 +1646,73 @@ inline size_t DynamicVector<Type,TF>::adjustCapacity( size_t minCapacity ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief First-touch initialization of all elements of the vector.
+//
+// \param init The initial value of the vector elements.
+// \return void
+//
+// This function initializes all vector elements with the given value and all padding elements
+// with the default value. The vector is partitioned in the same way as by the SMP assignment
+// (see the smpFirstTouch() function). In case the first-touch NUMA policy is selected (see the
+// \c BLAZE_NUMA_POLICY switch in the <tt>./blaze/config/NUMA.h</tt> configuration file), each
+// partition is initialized by the thread that processes it during SMP assignments, such that
+// the memory pages of the partition are placed on the NUMA node of this thread.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void DynamicVector<Type,TF>::firstTouch( const Type& init )
+{
+   // Capturing the members by value prevents the vector from escaping into the thread backend
+   Type* const v( v_ );
+   const size_t size( size_ );
+   const size_t capacity( capacity_ );
+
+   smpFirstTouch( *this, [v,size,capacity,&init]( size_t index, size_t n )
+   {
+      const size_t iend( ( index+n == size )?( capacity ):( index+n ) );
+
+      for( size_t i=index; i<index+n; ++i )
+         v[i] = init;
+      for( size_t i=index+n; i<iend; ++i )
+         v[i] = Type();
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief First-touch initialization of the vector as a copy of the given vector.
+//
+// \param rhs The vector to be copied.
+// \return void
+//
+// This function initializes all elements of the vector, including the padding elements, with
+// the according elements of the given vector of the same size. The elements are initialized
+// in the same way as by the firstTouch( const Type& ) function.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void DynamicVector<Type,TF>::firstTouch( const DynamicVector& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == rhs.size_ && capacity_ <= rhs.capacity_, "Invalid vector sizes" );
+
+   Type* const v( v_ );
+   const Type* const w( rhs.v_ );
+   const size_t size( size_ );
+   const size_t capacity( capacity_ );
+
+   smpFirstTouch( *this, [v,w,size,capacity]( size_t index, size_t n )
+   {
+      const size_t iend( ( index+n == size )?( capacity ):( index+n ) );
+
+      for( size_t i=index; i<iend; ++i )
+         v[i] = w[i];
+   } );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1947,7 +2082,8 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssi
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >
+inline EnableIf_< And< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT>
+                    , Not< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE DispatchedAssign<VT> > > >
    DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -1991,6 +2127,30 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssig
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE DispatchedAssign<VT> >
+   DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   dispatchAxpby( *this, ~rhs, Type(1), Type(0) );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a sparse vector.
 //
@@ -2061,7 +2221,8 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddA
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >
+inline EnableIf_< And< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT>
+                    , Not< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE DispatchedAssign<VT> > > >
    DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2093,6 +2254,30 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE DispatchedAssign<VT> >
+   DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   dispatchAxpby( *this, ~rhs, Type(1), Type(1) );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a sparse vector.
 //
@@ -2163,7 +2348,8 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubA
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >
+inline EnableIf_< And< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT>
+                    , Not< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE DispatchedAssign<VT> > > >
    DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2195,6 +2381,30 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE DispatchedAssign<VT> >
+   DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   dispatchAxpby( *this, ~rhs, Type(-1), Type(1) );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the subtraction assignment of a sparse vector.
 //
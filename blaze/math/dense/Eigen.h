@@ -0,0 +1,513 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Eigen.h
+//  \brief Header file for the dense matrix eigenvalue functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_EIGEN_H_
+#define _BLAZE_MATH_DENSE_EIGEN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Jacobi.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/heevd.h>
+#include <blaze/math/lapack/syevd.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  EIGENVALUE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Eigenvalue functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the native Jacobi eigenvalue kernel.
+// \ingroup dense_matrix
+//
+// This helper evaluates to \a true in case the eigenvalues of the matrix type \a MT are computed
+// by the native Jacobi kernel, i.e. in case the LAPACK mode is disabled or in case \a MT is a
+// fixed size matrix of at most JACOBI_THRESHOLD rows and columns.
+*/
+template< typename MT >  // Type of the dense matrix
+struct UseJacobiEigen
+   : public BoolConstant< !BLAZE_LAPACK_MODE ||
+                          ( Rows< RemoveAdaptor_< ResultType_<MT> > >::value != 0UL &&
+                            Rows< RemoveAdaptor_< ResultType_<MT> > >::value <= JACOBI_THRESHOLD ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorting of the eigenvalues (and eigenvectors) in ascending order.
+// \ingroup dense_matrix
+//
+// \param w The vector of eigenvalues.
+// \param V The matrix of eigenvectors (only referenced if \a Vectors is \a true).
+// \return void
+*/
+template< bool Vectors  // Sort the eigenvectors
+        , typename VT   // Type of the eigenvalue vector
+        , typename MT > // Type of the eigenvector matrix
+void sortEigenpairs( VT& w, MT& V )
+{
+   using std::swap;
+
+   const size_t n( w.size() );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      size_t jmin( i );
+      for( size_t j=i+1UL; j<n; ++j ) {
+         if( w[j] < w[jmin] ) jmin = j;
+      }
+
+      if( jmin == i ) continue;
+
+      swap( w[i], w[jmin] );
+
+      if( Vectors ) {
+         for( size_t k=0UL; k<V.rows(); ++k ) {
+            swap( V(k,i), V(k,jmin) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK eigenvalue computation for real symmetric matrices.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the symmetric matrix
+        , typename VT >  // Type of the eigenvalue vector
+inline EnableIf_< IsBuiltin< ElementType_<MT> > >
+   lapackHeev( MT& A, VT& w, char jobz )
+{
+   syevd( A, w, jobz, 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK eigenvalue computation for complex Hermitian matrices.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the Hermitian matrix
+        , typename VT >  // Type of the eigenvalue vector
+inline EnableIf_< IsComplex< ElementType_<MT> > >
+   lapackHeev( MT& A, VT& w, char jobz )
+{
+   heevd( A, w, jobz, 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary type for the column-major temporaries of the native Jacobi eigenvalue kernel.
+// \ingroup dense_matrix
+//
+// In case the given matrix type \a MT is a fixed size matrix the temporary is a StaticMatrix,
+// which enables the computation without any dynamic memory allocation. Otherwise the temporary
+// is a DynamicMatrix.
+*/
+template< typename MT >  // Type of the dense matrix
+struct JacobiEigenTemporary
+{
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   typedef ElementType_<MT>                  ET;
+   typedef RemoveAdaptor_< ResultType_<MT> >  RT;
+
+   enum : size_t { N = Rows<RT>::value };
+
+   typedef If_< BoolConstant< N != 0UL >
+              , StaticMatrix<ET,N,N,columnMajor>
+              , DynamicMatrix<ET,columnMajor> >  Type;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the eigenvalue computation for matrices handled by the native Jacobi kernel.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \return void
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+*/
+template< typename MT  // Type of the Hermitian matrix
+        , typename VT >// Type of the eigenvalue vector
+EnableIf_< UseJacobiEigen<MT> > eigenBackend( const MT& A, VT& w )
+{
+   typename JacobiEigenTemporary<MT>::Type tmp( A );
+
+   if( !IsHermitian<MT>::value && !isHermitian( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-Hermitian matrix provided" );
+   }
+
+   const size_t n( tmp.rows() );
+
+   resize( w, n, false );
+
+   jacobiHeev( tmp );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      w[i] = real( tmp(i,i) );
+   }
+
+   sortEigenpairs<false>( w, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the eigenvalue computation for matrices handled by LAPACK.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \return void
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+*/
+template< typename MT  // Type of the Hermitian matrix
+        , typename VT >// Type of the eigenvalue vector
+DisableIf_< UseJacobiEigen<MT> > eigenBackend( const MT& A, VT& w )
+{
+   typedef ElementType_<MT>        ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   DynamicMatrix<ET,columnMajor> tmp( A );
+   DynamicVector<BT,columnVector> wtmp;
+
+   if( !IsHermitian<MT>::value && !isHermitian( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-Hermitian matrix provided" );
+   }
+
+   lapackHeev( tmp, wtmp, 'N' );
+
+   resize( w, wtmp.size(), false );
+   w = wtmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the eigendecomposition for matrices handled by the native Jacobi kernel.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \return void
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+*/
+template< typename MT1   // Type of the Hermitian matrix
+        , typename VT    // Type of the eigenvalue vector
+        , typename MT2 > // Type of the eigenvector matrix
+EnableIf_< UseJacobiEigen<MT1> > eigenBackend( const MT1& A, VT& w, MT2& V )
+{
+   typename JacobiEigenTemporary<MT1>::Type tmp( A );
+
+   if( !IsHermitian<MT1>::value && !isHermitian( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-Hermitian matrix provided" );
+   }
+
+   const size_t n( tmp.rows() );
+
+   resize( w, n, false );
+   resize( V, n, n, false );
+
+   typename JacobiEigenTemporary<MT1>::Type X( tmp );
+
+   jacobiHeev( tmp, X );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      w[i] = real( tmp(i,i) );
+   }
+
+   sortEigenpairs<true>( w, X );
+
+   V = X;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the eigendecomposition for matrices handled by LAPACK.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \return void
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+*/
+template< typename MT1   // Type of the Hermitian matrix
+        , typename VT    // Type of the eigenvalue vector
+        , typename MT2 > // Type of the eigenvector matrix
+DisableIf_< UseJacobiEigen<MT1> > eigenBackend( const MT1& A, VT& w, MT2& V )
+{
+   typedef ElementType_<MT1>       ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   DynamicMatrix<ET,columnMajor> tmp( A );
+   DynamicVector<BT,columnVector> wtmp;
+
+   if( !IsHermitian<MT1>::value && !isHermitian( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-Hermitian matrix provided" );
+   }
+
+   lapackHeev( tmp, wtmp, 'V' );
+
+   resize( w, wtmp.size(), false );
+   resize( V, tmp.rows(), tmp.columns(), false );
+
+   w = wtmp;
+   V = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Eigenvalue computation of the given dense Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian (or real symmetric) matrix.
+// \param w The resulting vector of eigenvalues.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the eigenvalues of the given Hermitian (or real symmetric) n-by-n matrix.
+// The real eigenvalues are returned in ascending order in the given vector \a w, which is resized
+// to the correct size (if possible and necessary).
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A is not a square matrix;
+//  - ... the given matrix \a A is not Hermitian (i.e. symmetric in case of a real matrix);
+//  - ... the given vector \a w is a fixed size vector and the size doesn't match;
+//  - ... the eigenvalue computation fails.
+//
+// The first three cases are reported via a \a std::invalid_argument exception, the last via a
+// \a std::runtime_error exception. In case \a A is a HermitianMatrix or SymmetricMatrix adaptor
+// the runtime check of the symmetry is skipped.
+//
+// Example:
+
+   \code
+   blaze::SymmetricMatrix< blaze::StaticMatrix<double,3UL,3UL> > A;
+   blaze::StaticVector<double,3UL> w;
+   // ... Initialization of A
+
+   eigen( A, w );  // Native Jacobi kernel without any dynamic memory allocation
+   \endcode
+
+// Fixed size matrices with at most six rows and columns (e.g. StaticMatrix) are diagonalized by
+// a native Jacobi kernel that works entirely on the stack. All other matrices are handled by the
+// LAPACK syevd() or heevd() functions, which use a divide and conquer algorithm. In case the
+// LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration file) the
+// Jacobi kernel is used for all matrices.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note Unless the matrix is handled by the native Jacobi kernel, this function can only be used
+// if the fitting LAPACK library is available and linked to the executable. Otherwise a call to
+// this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   eigenBackend( ~A, ~w );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Eigenvalue and eigenvector computation of the given dense Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian (or real symmetric) matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the eigenvalues and eigenvectors of the given Hermitian (or real
+// symmetric) n-by-n matrix. The resulting decomposition has the form
+
+                              \f[ A = V \cdot diag(w) \cdot V^{H}, \f]
+
+// where the real eigenvalues are returned in ascending order in the given vector \a w and the
+// columns of the unitary n-by-n matrix \a V contain the according orthonormal eigenvectors (i.e.
+// column \c i contains the eigenvector of the eigenvalue \c w[i]). Both \a w and \a V are resized
+// to the correct dimensions (if possible and necessary).
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A is not a square matrix;
+//  - ... the given matrix \a A is not Hermitian (i.e. symmetric in case of a real matrix);
+//  - ... the given vector \a w or matrix \a V are of fixed size and the sizes don't match;
+//  - ... the eigenvalue computation fails.
+//
+// The first three cases are reported via a \a std::invalid_argument exception, the last via a
+// \a std::runtime_error exception.
+//
+// Example:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL ), V;
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   // ... Initialization of A as symmetric matrix
+
+   eigen( A, w, V );  // LAPACK syevd() based eigendecomposition
+   \endcode
+
+// Fixed size matrices with at most six rows and columns (e.g. StaticMatrix) are diagonalized by
+// a native Jacobi kernel that works entirely on the stack. All other matrices are handled by the
+// LAPACK syevd() or heevd() functions, which use a divide and conquer algorithm. In case the
+// LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration file) the
+// Jacobi kernel is used for all matrices.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note Unless the matrix is handled by the native Jacobi kernel, this function can only be used
+// if the fitting LAPACK library is available and linked to the executable. Otherwise a call to
+// this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a w and \a V may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2 >    // Storage order of the matrix V
+void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   eigenBackend( ~A, ~w, ~V );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1062 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Factorization.h
+//  \brief Header file for the reusable factorization of dense system matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FACTORIZATION_H_
+#define _BLAZE_MATH_DENSE_FACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Getrf.h>
+#include <blaze/math/dense/Potrf.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/dense/Trsm.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/InversionFlag.h>
+#include <blaze/math/lapack/clapack/potrf.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <blaze/math/lapack/hetrf.h>
+#include <blaze/math/lapack/hetrs.h>
+#include <blaze/math/lapack/potrs.h>
+#include <blaze/math/lapack/sytrf.h>
+#include <blaze/math/lapack/sytrs.h>
+#include <blaze/math/lapack/trtrs.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUniLower.h>
+#include <blaze/math/typetraits/IsUniUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BUNCH-KAUFMAN HELPER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bunch-Kaufman decomposition of the lower part of a real Hermitian (i.e. symmetric) matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix to be decomposed.
+// \param ipiv The resulting pivot indices.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+inline EnableIf_< IsBuiltin< ElementType_<MT> > >
+   hetrfLower( DenseMatrix<MT,true>& A, int* ipiv )
+{
+   sytrf( ~A, 'L', ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bunch-Kaufman decomposition of the lower part of a complex Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix to be decomposed.
+// \param ipiv The resulting pivot indices.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+inline EnableIf_< IsComplex< ElementType_<MT> > >
+   hetrfLower( DenseMatrix<MT,true>& A, int* ipiv )
+{
+   hetrf( ~A, 'L', ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution step for a real Hermitian (i.e. symmetric) Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix decomposed by the hetrfLower() function.
+// \param B The column-major matrix of right-hand sides to be overwritten with the solution.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+*/
+template< typename MT1    // Type of the decomposed matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+inline EnableIf_< IsBuiltin< ElementType_<MT1> > >
+   hetrsLower( const DenseMatrix<MT1,true>& A, DenseMatrix<MT2,true>& B, const int* ipiv )
+{
+   sytrs( ~A, ~B, 'L', ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution step for a complex Hermitian Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix decomposed by the hetrfLower() function.
+// \param B The column-major matrix of right-hand sides to be overwritten with the solution.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+*/
+template< typename MT1    // Type of the decomposed matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+inline EnableIf_< IsComplex< ElementType_<MT1> > >
+   hetrsLower( const DenseMatrix<MT1,true>& A, DenseMatrix<MT2,true>& B, const int* ipiv )
+{
+   hetrs( ~A, ~B, 'L', ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reusable factorization of a dense square system matrix.
+// \ingroup dense_matrix
+//
+// The Factorization class template represents the factorization of a dense square matrix \f$ A \f$
+// that can be used to solve any number of linear systems of equations \f$ A*x=b \f$ (or
+// \f$ A*X=B \f$) with the same system matrix. Whereas the factorization requires
+// \f$ O(n^3) \f$ operations, every subsequent solve only requires \f$ O(n^2) \f$ operations per
+// right-hand side vector:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::Factorization;
+
+   DynamicMatrix<double> A( 500UL, 500UL );
+   DynamicVector<double> x, b( 500UL );
+   // ... Initialization of A and b
+
+   const Factorization< DynamicMatrix<double> > F( A );  // One LU decomposition of A
+
+   for( size_t step=0UL; step<100UL; ++step ) {
+      solve( F, x, b );  // Forward and back substitution only
+      // ... Update of b
+   }
+   \endcode
+
+// The template parameter \a MT specifies the type of the system matrix. The factorization
+// algorithm is selected depending on this type:
+//
+//  - diagonal matrices (see DiagonalMatrix) are not factorized at all;
+//  - lower and upper (uni-)triangular matrices (see LowerMatrix, UniLowerMatrix, UpperMatrix and
+//    UniUpperMatrix) are not factorized, but solved by a single triangular substitution;
+//  - symmetric matrices with built-in element type and Hermitian matrices (see SymmetricMatrix
+//    and HermitianMatrix) are factorized by a Cholesky decomposition. In case the matrix turns out
+//    not to be positive definite, a Bunch-Kaufman decomposition is used instead (or, in case the
+//    LAPACK mode is disabled, an LU decomposition);
+//  - complex symmetric matrices are directly factorized by a Bunch-Kaufman decomposition (or an
+//    LU decomposition in case the LAPACK mode is disabled);
+//  - all other matrices are factorized by an LU decomposition with partial pivoting.
+//
+// The algorithm that has been used can be queried via the algorithm() function. Note that the
+// factorization can only be used for dense matrices with \c float, \c double, \c complex<float>
+// or \c complex<double> element type. The attempt to use any other element type results in a
+// compile time error!
+//
+// \note Unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration
+// file), the factorization is computed by means of LAPACK and the fitting LAPACK library has to
+// be available and linked to the executable. Otherwise a linker error will be created.
+*/
+template< typename MT >  // Type of the system matrix
+class Factorization
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef RemoveAdaptor_< ResultType_<MT> >  RT;  //!< Non-adapted result type of the system matrix.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef Factorization<MT>  This;         //!< Type of this Factorization instance.
+   typedef ElementType_<MT>   ElementType;  //!< Type of the matrix elements.
+
+   //! Column-major type of the stored factors.
+   typedef If_< IsColumnMajorMatrix<RT>, RT, OppositeType_<RT> >  FactorType;
+
+   //! Type of the pivot indices of the factorization.
+   typedef If_< IsResizable<FactorType>
+              , DynamicVector<int>
+              , StaticVector<int,Rows<FactorType>::value> >  PivotType;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Factorization();
+
+   template< typename MT2, bool SO2 >
+   explicit inline Factorization( const DenseMatrix<MT2,SO2>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT2, bool SO2 >
+   inline void factorize( const DenseMatrix<MT2,SO2>& A );
+
+   inline size_t        rows()      const noexcept;
+   inline size_t        columns()   const noexcept;
+   inline InversionFlag algorithm() const noexcept;
+   inline const FactorType& factors() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void solve( DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b ) const;
+
+   template< typename MT2, bool SO2, typename MT3, bool SO3 >
+   inline void solve( DenseMatrix<MT2,SO2>& X, const DenseMatrix<MT3,SO3>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the factorization algorithm selected for the system matrix type \a MT.
+   //
+   // \return The factorization algorithm selected for the matrix type \a MT.
+   */
+   static constexpr InversionFlag getInversionFlag() noexcept {
+      if     ( IsDiagonal<MT>::value  ) return asDiagonal;
+      else if( IsUniUpper<MT>::value  ) return asUniUpper;
+      else if( IsUpper<MT>::value     ) return asUpper;
+      else if( IsUniLower<MT>::value  ) return asUniLower;
+      else if( IsLower<MT>::value     ) return asLower;
+      else if( IsSymmetric<MT>::value ) return asSymmetric;
+      else if( IsHermitian<MT>::value ) return asHermitian;
+      else                              return asGeneral;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Factorization functions*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   inline void decomposeLU();
+   inline bool decomposeLLH();
+   inline void decomposeLDL( InversionFlag flag );
+   inline void checkDiagonal() const;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Substitution functions**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename VT >
+   inline EnableIf_< HasMutableDataAccess<VT> > substitute( DenseVector<VT,false>& x ) const;
+
+   template< typename VT >
+   inline DisableIf_< HasMutableDataAccess<VT> > substitute( DenseVector<VT,false>& x ) const;
+
+   template< typename MT2, bool SO2 >
+   inline EnableIf_< And< HasMutableDataAccess<MT2>, IsColumnMajorMatrix<MT2> > >
+      substitute( DenseMatrix<MT2,SO2>& X ) const;
+
+   template< typename MT2, bool SO2 >
+   inline DisableIf_< And< HasMutableDataAccess<MT2>, IsColumnMajorMatrix<MT2> > >
+      substitute( DenseMatrix<MT2,SO2>& X ) const;
+
+   template< typename MT2 >
+   inline void substituteBackend( DenseMatrix<MT2,true>& X ) const;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType    factors_;    //!< The factors of the system matrix.
+   PivotType     ipiv_;       //!< The pivot indices of the LU and Bunch-Kaufman decompositions.
+   InversionFlag algorithm_;  //!< The factorization algorithm used for the system matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( FactorType );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType, ElementType_<FactorType> );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for Factorization.
+//
+// The default constructor creates the factorization of a 0x0 matrix.
+*/
+template< typename MT >  // Type of the system matrix
+inline Factorization<MT>::Factorization()
+   : factors_  ()                     // The factors of the system matrix
+   , ipiv_     ()                     // The pivot indices
+   , algorithm_( getInversionFlag() )  // The factorization algorithm
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Factorization of the given dense system matrix.
+//
+// \param A The system matrix to be factorized.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// This constructor factorizes the given square matrix. In case the matrix is not a square matrix
+// a \a std::invalid_argument exception is thrown, in case the matrix is singular a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the system matrix
+template< typename MT2   // Type of the given dense matrix
+        , bool SO2 >     // Storage order of the given dense matrix
+inline Factorization<MT>::Factorization( const DenseMatrix<MT2,SO2>& A )
+   : factors_  ()                     // The factors of the system matrix
+   , ipiv_     ()                     // The pivot indices
+   , algorithm_( getInversionFlag() )  // The factorization algorithm
+{
+   factorize( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief (Re-)Factorization of the given dense system matrix.
+//
+// \param A The system matrix to be factorized.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// This function replaces the current factorization by the factorization of the given square
+// matrix. In case the matrix is not a square matrix a \a std::invalid_argument exception is
+// thrown, in case the matrix is singular a \a std::runtime_error exception is thrown. In both
+// cases the factorization is left in an unspecified state and has to be recomputed before the
+// next solve.
+*/
+template< typename MT >  // Type of the system matrix
+template< typename MT2   // Type of the given dense matrix
+        , bool SO2 >     // Storage order of the given dense matrix
+inline void Factorization<MT>::factorize( const DenseMatrix<MT2,SO2>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   factors_   = ~A;
+   algorithm_ = getInversionFlag();
+
+   switch( algorithm_ )
+   {
+      case asDiagonal:
+      case asLower:
+      case asUpper:
+         checkDiagonal();
+         break;
+
+      case asUniLower:
+      case asUniUpper:
+         break;
+
+      case asHermitian:
+         if( decomposeLLH() ) break;
+         factors_ = ~A;
+         decomposeLDL( byLDLH );
+         break;
+
+      case asSymmetric:
+         if( IsBuiltin<ElementType>::value && decomposeLLH() ) break;
+         factors_ = ~A;
+         decomposeLDL( byLDLT );
+         break;
+
+      default:
+         decomposeLU();
+         break;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the factorized system matrix.
+//
+// \return The number of rows of the system matrix.
+*/
+template< typename MT >  // Type of the system matrix
+inline size_t Factorization<MT>::rows() const noexcept
+{
+   return factors_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the factorized system matrix.
+//
+// \return The number of columns of the system matrix.
+*/
+template< typename MT >  // Type of the system matrix
+inline size_t Factorization<MT>::columns() const noexcept
+{
+   return factors_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the algorithm used to factorize the system matrix.
+//
+// \return The factorization algorithm.
+//
+// This function returns \c byLU, \c byLLH, \c byLDLT, or \c byLDLH in case the system matrix has
+// been factorized by the according decomposition, and \c asDiagonal, \c asLower, \c asUniLower,
+// \c asUpper, or \c asUniUpper in case the system matrix is used as is.
+*/
+template< typename MT >  // Type of the system matrix
+inline InversionFlag Factorization<MT>::algorithm() const noexcept
+{
+   return algorithm_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the factors of the system matrix.
+//
+// \return The column-major matrix containing the factors.
+//
+// The layout of the factors depends on the factorization algorithm (see the algorithm() function)
+// and corresponds to the layout of the according LAPACK decomposition functions.
+*/
+template< typename MT >  // Type of the system matrix
+inline const typename Factorization<MT>::FactorType& Factorization<MT>::factors() const noexcept
+{
+   return factors_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*x=b \f$ with the factorized matrix \f$ A \f$.
+//
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the solution of the linear system \f$ A*x=b \f$ by means of the stored
+// factors. The solution vector \a x is resized to the size of \a b, if possible. Both vectors may
+// refer to the same vector. In case the size of \a b doesn't match the size of the system matrix
+// or in case \a x cannot be resized, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the system matrix
+template< typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+inline void Factorization<MT>::solve( DenseVector<VT1,false>& x,
+                                      const DenseVector<VT2,false>& b ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~b).size() != factors_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   resize( ~x, (~b).size(), false );
+   (~x) = ~b;
+
+   if( (~x).size() != 0UL ) {
+      substitute( ~x );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*X=B \f$ with the factorized matrix \f$ A \f$.
+//
+// \param X The resulting matrix of solution vectors.
+// \param B The matrix of right-hand side vectors.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the solution of the linear system \f$ A*X=B \f$ for all columns of
+// \a B by means of the stored factors. The solution matrix \a X is resized to the size of \a B,
+// if possible. Both matrices may refer to the same matrix. In case the number of rows of \a B
+// doesn't match the size of the system matrix or in case \a X cannot be resized, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the system matrix
+template< typename MT2   // Type of the solution matrix
+        , bool SO2       // Storage order of the solution matrix
+        , typename MT3   // Type of the right-hand side matrix
+        , bool SO3 >     // Storage order of the right-hand side matrix
+inline void Factorization<MT>::solve( DenseMatrix<MT2,SO2>& X,
+                                      const DenseMatrix<MT3,SO3>& B ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~B).rows() != factors_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   resize( ~X, (~B).rows(), (~B).columns(), false );
+   (~X) = ~B;
+
+   if( (~X).rows() != 0UL && (~X).columns() != 0UL ) {
+      substitute( ~X );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LU decomposition of the stored system matrix.
+//
+// \return void
+// \exception std::runtime_error Factorization of singular matrix failed.
+*/
+template< typename MT >  // Type of the system matrix
+inline void Factorization<MT>::decomposeLU()
+{
+   resize( ipiv_, factors_.rows(), false );
+   algorithm_ = byLU;
+
+#if BLAZE_LAPACK_MODE
+   getrf( factors_, ipiv_.data() );
+#else
+   blockedGetrf( factors_, ipiv_.data() );
+#endif
+
+   checkDiagonal();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cholesky decomposition of the stored system matrix.
+//
+// \return \a true if the system matrix is positive definite, \a false if not.
+//
+// In case the decomposition is successful, the lower part of the stored matrix contains the
+// Cholesky factor \f$ L \f$. In case the LAPACK mode is disabled, the upper part additionally
+// contains \f$ L^H \f$ for the subsequent back substitution. In case the system matrix is not
+// positive definite, the stored matrix is left in a partially decomposed state.
+*/
+template< typename MT >  // Type of the system matrix
+inline bool Factorization<MT>::decomposeLLH()
+{
+   const size_t n( factors_.rows() );
+
+#if BLAZE_LAPACK_MODE
+   using boost::numeric_cast;
+
+   int info( 0 );
+
+   if( n != 0UL ) {
+      potrf( 'L', numeric_cast<int>( n ), factors_.data(),
+             numeric_cast<int>( factors_.spacing() ), &info );
+   }
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for Cholesky decomposition" );
+
+   if( info > 0 ) {
+      return false;
+   }
+#else
+   if( !potrfLower( factors_, 0UL, n ) ) {
+      return false;
+   }
+
+   for( size_t j=1UL; j<n; ++j ) {
+      for( size_t i=0UL; i<j; ++i ) {
+         factors_(i,j) = conj( factors_(j,i) );
+      }
+   }
+#endif
+
+   algorithm_ = byLLH;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bunch-Kaufman decomposition of the stored symmetric or Hermitian system matrix.
+//
+// \param flag \c byLDLT for a symmetric matrix, \c byLDLH for a Hermitian matrix.
+// \return void
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// In case the LAPACK mode is disabled, the system matrix is factorized by an LU decomposition.
+*/
+template< typename MT >  // Type of the system matrix
+inline void Factorization<MT>::decomposeLDL( InversionFlag flag )
+{
+#if BLAZE_LAPACK_MODE
+   resize( ipiv_, factors_.rows(), false );
+   algorithm_ = flag;
+
+   if( flag == byLDLH ) {
+      hetrfLower( factors_, ipiv_.data() );
+   }
+   else {
+      sytrf( factors_, 'L', ipiv_.data() );
+   }
+
+   for( size_t i=0UL; i<factors_.rows(); ++i ) {
+      if( ipiv_[i] > 0 && !isDivisor( factors_(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Factorization of singular matrix failed" );
+      }
+   }
+#else
+   UNUSED_PARAMETER( flag );
+   decomposeLU();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the diagonal of the stored (triangular) factor for zero elements.
+//
+// \return void
+// \exception std::runtime_error Factorization of singular matrix failed.
+*/
+template< typename MT >  // Type of the system matrix
+inline void Factorization<MT>::checkDiagonal() const
+{
+   for( size_t i=0UL; i<factors_.rows(); ++i ) {
+      if( !isDivisor( factors_(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Factorization of singular matrix failed" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBSTITUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place substitution for a contiguous dense vector.
+//
+// \param x The right-hand side vector to be overwritten with the solution.
+// \return void
+//
+// The vector is treated as a column-major matrix with a single column.
+*/
+template< typename MT >  // Type of the system matrix
+template< typename VT >  // Type of the dense vector
+inline EnableIf_< HasMutableDataAccess<VT> >
+   Factorization<MT>::substitute( DenseVector<VT,false>& x ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType, ElementType_<VT> );
+
+   CustomMatrix<ElementType,unaligned,unpadded,columnMajor> X( (~x).data(), (~x).size(), 1UL );
+   substituteBackend( X );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place substitution for a dense vector without direct data access.
+//
+// \param x The right-hand side vector to be overwritten with the solution.
+// \return void
+*/
+template< typename MT >  // Type of the system matrix
+template< typename VT >  // Type of the dense vector
+inline DisableIf_< HasMutableDataAccess<VT> >
+   Factorization<MT>::substitute( DenseVector<VT,false>& x ) const
+{
+   DynamicVector<ElementType,columnVector> tmp( ~x );
+   substitute( tmp );
+   (~x) = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place substitution for a column-major dense matrix with direct data access.
+//
+// \param X The right-hand side matrix to be overwritten with the solution.
+// \return void
+*/
+template< typename MT >  // Type of the system matrix
+template< typename MT2   // Type of the dense matrix
+        , bool SO2 >     // Storage order of the dense matrix
+inline EnableIf_< And< HasMutableDataAccess<MT2>, IsColumnMajorMatrix<MT2> > >
+   Factorization<MT>::substitute( DenseMatrix<MT2,SO2>& X ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType, ElementType_<MT2> );
+
+   substituteBackend( ~X );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place substitution for a row-major dense matrix or a matrix without data access.
+//
+// \param X The right-hand side matrix to be overwritten with the solution.
+// \return void
+*/
+template< typename MT >  // Type of the system matrix
+template< typename MT2   // Type of the dense matrix
+        , bool SO2 >     // Storage order of the dense matrix
+inline DisableIf_< And< HasMutableDataAccess<MT2>, IsColumnMajorMatrix<MT2> > >
+   Factorization<MT>::substitute( DenseMatrix<MT2,SO2>& X ) const
+{
+   DynamicMatrix<ElementType,columnMajor> tmp( ~X );
+   substituteBackend( tmp );
+   (~X) = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the in-place forward and back substitution.
+//
+// \param X The column-major right-hand side matrix to be overwritten with the solution.
+// \return void
+*/
+template< typename MT >   // Type of the system matrix
+template< typename MT2 >  // Type of the dense matrix
+inline void Factorization<MT>::substituteBackend( DenseMatrix<MT2,true>& X ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~X).rows() == factors_.rows(), "Invalid number of rows" );
+
+   const size_t n( (~X).rows()    );
+   const size_t m( (~X).columns() );
+
+   switch( algorithm_ )
+   {
+      case asDiagonal:
+         for( size_t j=0UL; j<m; ++j ) {
+            for( size_t i=0UL; i<n; ++i ) {
+               (~X)(i,j) /= factors_(i,i);
+            }
+         }
+         break;
+
+#if BLAZE_LAPACK_MODE
+      case asLower   : trtrs( factors_, ~X, 'L', 'N', 'N' ); break;
+      case asUniLower: trtrs( factors_, ~X, 'L', 'N', 'U' ); break;
+      case asUpper   : trtrs( factors_, ~X, 'U', 'N', 'N' ); break;
+      case asUniUpper: trtrs( factors_, ~X, 'U', 'N', 'U' ); break;
+      case byLLH     : potrs( factors_, ~X, 'L' ); break;
+      case byLDLT    : sytrs( factors_, ~X, 'L', ipiv_.data() ); break;
+      case byLDLH    : hetrsLower( factors_, ~X, ipiv_.data() ); break;
+      case byLU      : getrs( factors_, ~X, 'N', ipiv_.data() ); break;
+#else
+      case asLower   : trsmLeftLower<false>( factors_, 0UL, n, ~X, 0UL, 0UL, m ); break;
+      case asUniLower: trsmLeftLower<true> ( factors_, 0UL, n, ~X, 0UL, 0UL, m ); break;
+      case asUpper   : trsmLeftUpper<false>( factors_, 0UL, n, ~X, 0UL, 0UL, m ); break;
+      case asUniUpper: trsmLeftUpper<true> ( factors_, 0UL, n, ~X, 0UL, 0UL, m ); break;
+
+      case byLLH:
+         trsmLeftLower<false>( factors_, 0UL, n, ~X, 0UL, 0UL, m );
+         trsmLeftUpper<false>( factors_, 0UL, n, ~X, 0UL, 0UL, m );
+         break;
+
+      case byLU:
+         getrfSwapRows( ~X, ipiv_.data(), 0UL, n, 0UL, m );
+         trsmLeftLower<true> ( factors_, 0UL, n, ~X, 0UL, 0UL, m );
+         trsmLeftUpper<false>( factors_, 0UL, n, ~X, 0UL, 0UL, m );
+         break;
+#endif
+
+      default: BLAZE_INTERNAL_ASSERT( false, "Unhandled case detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Factorization functions */
+//@{
+template< typename MT, bool SO >
+inline const Factorization< ResultType_<MT> > factorize( const DenseMatrix<MT,SO>& A );
+
+template< typename MT, typename VT1, typename VT2 >
+inline void solve( const Factorization<MT>& F, DenseVector<VT1,false>& x,
+                   const DenseVector<VT2,false>& b );
+
+template< typename MT, typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void solve( const Factorization<MT>& F, DenseMatrix<MT1,SO1>& X,
+                   const DenseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Factorization of the given dense square matrix.
+// \ingroup dense_matrix
+//
+// \param A The system matrix to be factorized.
+// \return The factorization of the system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// This function returns the factorization of the given square matrix, which can be used to
+// efficiently solve any number of linear systems of equations with the same system matrix (see
+// the Factorization class template). The factorization algorithm is selected depending on the
+// type of the matrix:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::SymmetricMatrix;
+
+   SymmetricMatrix< DynamicMatrix<double> > A( 100UL );
+   DynamicVector<double> x, b1( 100UL ), b2( 100UL );
+   // ... Initialization of A, b1, and b2
+
+   const auto F( factorize( A ) );  // Cholesky decomposition in case A is positive definite
+
+   solve( F, x, b1 );  // Solving A*x=b1
+   solve( F, x, b2 );  // Solving A*x=b2
+   \endcode
+
+// \note The factorization can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline const Factorization< ResultType_<MT> > factorize( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return Factorization< ResultType_<MT> >( ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*x=b \f$ with the factorized matrix \f$ A \f$.
+// \ingroup dense_matrix
+//
+// \param F The factorization of the system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the solution of the linear system \f$ A*x=b \f$ by means of the given
+// factorization of the system matrix \f$ A \f$, which only requires \f$ O(n^2) \f$ operations.
+// The solution vector \a x is resized to the size of \a b, if possible. In case the size of
+// \a b doesn't match the size of the system matrix or in case \a x cannot be resized, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT     // Type of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline void solve( const Factorization<MT>& F, DenseVector<VT1,false>& x,
+                   const DenseVector<VT2,false>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   F.solve( ~x, ~b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*X=B \f$ with the factorized matrix \f$ A \f$.
+// \ingroup dense_matrix
+//
+// \param F The factorization of the system matrix.
+// \param X The resulting matrix of solution vectors.
+// \param B The matrix of right-hand side vectors.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the solution of the linear system \f$ A*X=B \f$ for all columns of
+// \a B by means of the given factorization of the system matrix \f$ A \f$. The solution matrix
+// \a X is resized to the size of \a B, if possible. In case the number of rows of \a B doesn't
+// match the size of the system matrix or in case \a X cannot be resized, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT   // Type of the system matrix
+        , typename MT1  // Type of the solution matrix
+        , bool SO1      // Storage order of the solution matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void solve( const Factorization<MT>& F, DenseMatrix<MT1,SO1>& X,
+                   const DenseMatrix<MT2,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   F.solve( ~X, ~B );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/PackedFlag.h>
 #include <blaze/util/Types.h>
 
 
@@ -57,6 +58,7 @@ template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, PackedFlag, bool > class PackedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 
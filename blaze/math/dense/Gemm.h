@@ -0,0 +1,802 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Gemm.h
+//  \brief Header file for the packed dense matrix/dense matrix multiplication kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_GEMM_H_
+#define _BLAZE_MATH_DENSE_GEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <unistd.h>
+#endif
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/ConstDataAccess.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Debugging.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register blocking of the packed dense matrix/dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The GemmTraits class template specifies the size of the register block (micro tile) of the
+// packed matrix multiplication kernel for the element type \a T. Each micro tile consists of
+// \a MR rows and \a NR columns, where each row is held in \a NV SIMD registers. In case FMA
+// instructions are available (or in case the target provides 32 SIMD registers as with AVX-512)
+// three SIMD registers per row are used, else two SIMD registers per row are used to avoid
+// register spilling.
+*/
+template< typename T >  // Element type
+struct GemmTraits
+{
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+   enum : size_t { MR = 4UL };
+   enum : size_t { NV = ( BLAZE_FMA_MODE || BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )?( 3UL ):( 2UL ) };
+   enum : size_t { NR = NV * SIMDSIZE };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache blocking of the packed dense matrix/dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The GemmBlocking class represents the cache blocking of the packed matrix multiplication
+// kernel. The \a kc rows of a packed panel of the right-hand side operand are chosen such that
+// a micro panel fits into half of the level 1 cache, the \a mc rows of the packed block of the
+// left-hand side operand are chosen such that the block fits into half of the level 2 cache,
+// and the \a nc columns of the packed block of the right-hand side operand are chosen such that
+// the block fits into half of the last level cache (limited to 4096 columns, since the last
+// level cache is usually shared between several cores). Products with triangular operands are
+// split into blocks of \a tb rows/columns, which trades the multiplications with the zero
+// elements of the diagonal blocks against the efficiency of the packed kernel.
+*/
+struct GemmBlocking
+{
+   size_t mc;  //!< Number of rows of a packed block of the left-hand side operand.
+   size_t kc;  //!< Number of columns/rows of the packed blocks of both operands.
+   size_t nc;  //!< Number of columns of a packed block of the right-hand side operand.
+   size_t tb;  //!< Number of rows/columns of a block of a triangular operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CACHE BLOCKING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Queries the size of the given cache at runtime.
+// \ingroup dense_matrix
+//
+// \param name The system configuration name of the cache size.
+// \param fallback The configured cache size that is used in case the query is not possible.
+// \return The size of the cache in Byte.
+//
+// This function queries the size of a cache of the target architecture at runtime. In case
+// the query is not supported by the system or fails, the given configured value is returned.
+*/
+inline size_t queryCacheSize( int name, size_t fallback )
+{
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+   const long size( ::sysconf( name ) );
+   return ( size > 0L )?( static_cast<size_t>( size ) ):( fallback );
+#else
+   UNUSED_PARAMETER( name );
+   return fallback;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the cache blocking of the packed matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// \return The cache blocking for the element type \a T.
+//
+// This function computes the cache blocking of the packed matrix multiplication kernel for
+// the element type \a T based on the configured cache sizes (see blaze::l1CacheSize,
+// blaze::l2CacheSize, and blaze::cacheSize) or, if possible, the cache sizes queried at
+// runtime. In debug mode, small blocks are used to exercise the handling of partial blocks.
+*/
+template< typename T >  // Element type
+GemmBlocking computeGemmBlocking()
+{
+   enum : size_t { MR = GemmTraits<T>::MR };
+   enum : size_t { NR = GemmTraits<T>::NR };
+
+   GemmBlocking blocking;
+
+   if( BLAZE_DEBUG_MODE ) {
+      blocking.mc = 2UL*MR;
+      blocking.kc = 8UL;
+      blocking.nc = 2UL*NR;
+      blocking.tb = 2UL*MR;
+      return blocking;
+   }
+
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+   const size_t l1( queryCacheSize( _SC_LEVEL1_DCACHE_SIZE, l1CacheSize ) );
+   const size_t l2( queryCacheSize( _SC_LEVEL2_CACHE_SIZE , l2CacheSize ) );
+   const size_t l3( queryCacheSize( _SC_LEVEL3_CACHE_SIZE , cacheSize   ) );
+#else
+   const size_t l1( l1CacheSize );
+   const size_t l2( l2CacheSize );
+   const size_t l3( cacheSize   );
+#endif
+
+   const size_t kc( ( l1 / 2UL ) / ( NR*sizeof(T) ) );
+   blocking.kc = ( kc < 16UL )?( 16UL ):( kc & size_t(-8) );
+
+   const size_t mc( ( l2 / 2UL ) / ( blocking.kc*sizeof(T) ) );
+   blocking.mc = ( mc < MR )?( MR ):( mc - ( mc % MR ) );
+
+   const size_t nc( ( ( l3 > l2 ? l3 : l2 ) / 2UL ) / ( blocking.kc*sizeof(T) ) );
+   blocking.nc = ( nc < NR )?( NR ):( ( nc > 4096UL )?( 4096UL ):( nc ) );
+   blocking.nc -= blocking.nc % NR;
+
+   blocking.tb = ( blocking.mc < 128UL )?( blocking.mc ):( 128UL );
+
+   return blocking;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the cache blocking of the packed matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// \return The cache blocking for the element type \a T.
+//
+// The cache blocking is computed once on first use (see computeGemmBlocking()).
+*/
+template< typename T >  // Element type
+inline const GemmBlocking& gemmBlocking()
+{
+   static const GemmBlocking blocking( computeGemmBlocking<T>() );
+   return blocking;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the left-hand side operand into row panels.
+// \ingroup dense_matrix
+//
+// \param mc The number of rows of the block.
+// \param kc The number of columns of the block.
+// \param A Pointer to the first element of the block.
+// \param rsA The distance between two rows of the block.
+// \param csA The distance between two columns of the block.
+// \param Ap Pointer to the (aligned) packing buffer.
+// \return void
+//
+// This function copies the given block into consecutive panels of \a MR rows. Within a panel
+// the \a MR elements of a column are stored contiguously. Incomplete panels are padded with
+// zeros.
+*/
+template< typename T >  // Element type
+void packGemmA( size_t mc, size_t kc, const T* A, size_t rsA, size_t csA, T* BLAZE_RESTRICT Ap )
+{
+   enum : size_t { MR = GemmTraits<T>::MR };
+
+   for( size_t i=0UL; i<mc; i+=MR )
+   {
+      const size_t mr( ( mc - i < MR )?( mc - i ):( MR ) );
+
+      for( size_t k=0UL; k<kc; ++k ) {
+         const T* a( A + i*rsA + k*csA );
+         size_t r( 0UL );
+         for( ; r<mr; ++r ) {
+            Ap[r] = a[r*rsA];
+         }
+         for( ; r<MR; ++r ) {
+            reset( Ap[r] );
+         }
+         Ap += MR;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the right-hand side operand into column panels.
+// \ingroup dense_matrix
+//
+// \param kc The number of rows of the block.
+// \param nc The number of columns of the block.
+// \param B Pointer to the first element of the block.
+// \param rsB The distance between two rows of the block.
+// \param csB The distance between two columns of the block.
+// \param Bp Pointer to the (aligned) packing buffer.
+// \return void
+//
+// This function copies the given block into consecutive panels of \a NR columns. Within a
+// panel the \a NR elements of a row are stored contiguously. Incomplete panels are padded with
+// zeros.
+*/
+template< typename T >  // Element type
+void packGemmB( size_t kc, size_t nc, const T* B, size_t rsB, size_t csB, T* BLAZE_RESTRICT Bp )
+{
+   enum : size_t { SIMDSIZE = GemmTraits<T>::SIMDSIZE };
+   enum : size_t { NR = GemmTraits<T>::NR };
+
+   for( size_t j=0UL; j<nc; j+=NR )
+   {
+      const size_t nr( ( nc - j < NR )?( nc - j ):( NR ) );
+
+      if( csB == 1UL && nr == NR ) {
+         for( size_t k=0UL; k<kc; ++k ) {
+            const T* b( B + k*rsB + j );
+            for( size_t c=0UL; c<NR; c+=SIMDSIZE ) {
+               storea( Bp+c, loadu( b+c ) );
+            }
+            Bp += NR;
+         }
+      }
+      else {
+         for( size_t k=0UL; k<kc; ++k ) {
+            const T* b( B + k*rsB + j*csB );
+            size_t c( 0UL );
+            for( ; c<nr; ++c ) {
+               Bp[c] = b[c*csB];
+            }
+            for( ; c<NR; ++c ) {
+               reset( Bp[c] );
+            }
+            Bp += NR;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a micro tile of the target matrix.
+// \ingroup dense_matrix
+//
+// \param alpha The scaling factor for the computed micro tile.
+// \param beta The scaling factor for the target matrix.
+// \param tile Pointer to the (aligned) computed micro tile.
+// \param c Pointer to the first element of the micro tile of the target matrix.
+// \param ldc The distance between two rows of the target matrix.
+// \param mr The number of valid rows of the micro tile.
+// \param nr The number of valid columns of the micro tile.
+// \return void
+//
+// This function performs the update \f$ C=\alpha*tile+\beta*C \f$ for a partial micro tile at
+// the bottom or right border of the target matrix.
+*/
+template< typename T >  // Element type
+void updateGemmTile( T alpha, T beta, const T* tile, T* c, size_t ldc, size_t mr, size_t nr )
+{
+   enum : size_t { NR = GemmTraits<T>::NR };
+
+   for( size_t r=0UL; r<mr; ++r ) {
+      for( size_t j=0UL; j<nr; ++j ) {
+         if( isDefault( beta ) )
+            c[r*ldc+j] = alpha * tile[r*NR+j];
+         else
+            c[r*ldc+j] = alpha * tile[r*NR+j] + beta * c[r*ldc+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro kernel of the packed matrix multiplication for two SIMD registers per row.
+// \ingroup dense_matrix
+//
+// \param kc The number of columns/rows of the packed panels.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param a Pointer to the packed row panel of the left-hand side operand.
+// \param b Pointer to the packed column panel of the right-hand side operand.
+// \param beta The scaling factor for \f$ C \f$.
+// \param c Pointer to the first element of the micro tile of the target matrix.
+// \param ldc The distance between two rows of the target matrix.
+// \param mr The number of valid rows of the micro tile.
+// \param nr The number of valid columns of the micro tile.
+// \return void
+//
+// This function computes the \f$ 4 \times 2 \f$ SIMD register micro tile
+// \f$ C=\alpha*A*B+\beta*C \f$ for the given packed panels.
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE EnableIfTrue_< GemmTraits<T>::NV == 2UL >
+   gemmMicroKernel( size_t kc, T alpha, const T* BLAZE_RESTRICT a, const T* BLAZE_RESTRICT b,
+                    T beta, T* c, size_t ldc, size_t mr, size_t nr )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = GemmTraits<T>::SIMDSIZE };
+   enum : size_t { MR = GemmTraits<T>::MR };
+   enum : size_t { NR = GemmTraits<T>::NR };
+
+   SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+   for( size_t k=0UL; k<kc; ++k ) {
+      const SIMDType b1( loada( b          ) );
+      const SIMDType b2( loada( b+SIMDSIZE ) );
+      const SIMDType a1( set( a[0] ) );
+      const SIMDType a2( set( a[1] ) );
+      xmm1 = xmm1 + a1 * b1;
+      xmm2 = xmm2 + a1 * b2;
+      xmm3 = xmm3 + a2 * b1;
+      xmm4 = xmm4 + a2 * b2;
+      const SIMDType a3( set( a[2] ) );
+      const SIMDType a4( set( a[3] ) );
+      xmm5 = xmm5 + a3 * b1;
+      xmm6 = xmm6 + a3 * b2;
+      xmm7 = xmm7 + a4 * b1;
+      xmm8 = xmm8 + a4 * b2;
+      a += MR;
+      b += NR;
+   }
+
+   const SIMDType factor( set( alpha ) );
+
+   if( mr == MR && nr == NR )
+   {
+      T* c1( c         );
+      T* c2( c+ldc     );
+      T* c3( c+ldc*2UL );
+      T* c4( c+ldc*3UL );
+
+      if( isDefault( beta ) ) {
+         storeu( c1, xmm1*factor ); storeu( c1+SIMDSIZE, xmm2*factor );
+         storeu( c2, xmm3*factor ); storeu( c2+SIMDSIZE, xmm4*factor );
+         storeu( c3, xmm5*factor ); storeu( c3+SIMDSIZE, xmm6*factor );
+         storeu( c4, xmm7*factor ); storeu( c4+SIMDSIZE, xmm8*factor );
+      }
+      else {
+         const SIMDType scale( set( beta ) );
+         storeu( c1         , loadu( c1          )*scale + xmm1*factor );
+         storeu( c1+SIMDSIZE, loadu( c1+SIMDSIZE )*scale + xmm2*factor );
+         storeu( c2         , loadu( c2          )*scale + xmm3*factor );
+         storeu( c2+SIMDSIZE, loadu( c2+SIMDSIZE )*scale + xmm4*factor );
+         storeu( c3         , loadu( c3          )*scale + xmm5*factor );
+         storeu( c3+SIMDSIZE, loadu( c3+SIMDSIZE )*scale + xmm6*factor );
+         storeu( c4         , loadu( c4          )*scale + xmm7*factor );
+         storeu( c4+SIMDSIZE, loadu( c4+SIMDSIZE )*scale + xmm8*factor );
+      }
+   }
+   else
+   {
+      alignas( AlignmentOf<T>::value ) T tile[MR*NR];
+
+      storea( tile     , xmm1 ); storea( tile     +SIMDSIZE, xmm2 );
+      storea( tile+NR  , xmm3 ); storea( tile+NR  +SIMDSIZE, xmm4 );
+      storea( tile+NR*2, xmm5 ); storea( tile+NR*2+SIMDSIZE, xmm6 );
+      storea( tile+NR*3, xmm7 ); storea( tile+NR*3+SIMDSIZE, xmm8 );
+
+      updateGemmTile( alpha, beta, tile, c, ldc, mr, nr );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro kernel of the packed matrix multiplication for three SIMD registers per row.
+// \ingroup dense_matrix
+//
+// \param kc The number of columns/rows of the packed panels.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param a Pointer to the packed row panel of the left-hand side operand.
+// \param b Pointer to the packed column panel of the right-hand side operand.
+// \param beta The scaling factor for \f$ C \f$.
+// \param c Pointer to the first element of the micro tile of the target matrix.
+// \param ldc The distance between two rows of the target matrix.
+// \param mr The number of valid rows of the micro tile.
+// \param nr The number of valid columns of the micro tile.
+// \return void
+//
+// This function computes the \f$ 4 \times 3 \f$ SIMD register micro tile
+// \f$ C=\alpha*A*B+\beta*C \f$ for the given packed panels.
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE EnableIfTrue_< GemmTraits<T>::NV == 3UL >
+   gemmMicroKernel( size_t kc, T alpha, const T* BLAZE_RESTRICT a, const T* BLAZE_RESTRICT b,
+                    T beta, T* c, size_t ldc, size_t mr, size_t nr )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = GemmTraits<T>::SIMDSIZE };
+   enum : size_t { MR = GemmTraits<T>::MR };
+   enum : size_t { NR = GemmTraits<T>::NR };
+
+   SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11, xmm12;
+
+   for( size_t k=0UL; k<kc; ++k ) {
+      const SIMDType b1( loada( b              ) );
+      const SIMDType b2( loada( b+SIMDSIZE     ) );
+      const SIMDType b3( loada( b+SIMDSIZE*2UL ) );
+      const SIMDType a1( set( a[0] ) );
+      xmm1 = xmm1 + a1 * b1;
+      xmm2 = xmm2 + a1 * b2;
+      xmm3 = xmm3 + a1 * b3;
+      const SIMDType a2( set( a[1] ) );
+      xmm4 = xmm4 + a2 * b1;
+      xmm5 = xmm5 + a2 * b2;
+      xmm6 = xmm6 + a2 * b3;
+      const SIMDType a3( set( a[2] ) );
+      xmm7 = xmm7 + a3 * b1;
+      xmm8 = xmm8 + a3 * b2;
+      xmm9 = xmm9 + a3 * b3;
+      const SIMDType a4( set( a[3] ) );
+      xmm10 = xmm10 + a4 * b1;
+      xmm11 = xmm11 + a4 * b2;
+      xmm12 = xmm12 + a4 * b3;
+      a += MR;
+      b += NR;
+   }
+
+   const SIMDType factor( set( alpha ) );
+
+   if( mr == MR && nr == NR )
+   {
+      T* c1( c         );
+      T* c2( c+ldc     );
+      T* c3( c+ldc*2UL );
+      T* c4( c+ldc*3UL );
+
+      if( isDefault( beta ) ) {
+         storeu( c1, xmm1 *factor ); storeu( c1+SIMDSIZE, xmm2 *factor ); storeu( c1+SIMDSIZE*2UL, xmm3 *factor );
+         storeu( c2, xmm4 *factor ); storeu( c2+SIMDSIZE, xmm5 *factor ); storeu( c2+SIMDSIZE*2UL, xmm6 *factor );
+         storeu( c3, xmm7 *factor ); storeu( c3+SIMDSIZE, xmm8 *factor ); storeu( c3+SIMDSIZE*2UL, xmm9 *factor );
+         storeu( c4, xmm10*factor ); storeu( c4+SIMDSIZE, xmm11*factor ); storeu( c4+SIMDSIZE*2UL, xmm12*factor );
+      }
+      else {
+         const SIMDType scale( set( beta ) );
+         storeu( c1             , loadu( c1              )*scale + xmm1 *factor );
+         storeu( c1+SIMDSIZE    , loadu( c1+SIMDSIZE     )*scale + xmm2 *factor );
+         storeu( c1+SIMDSIZE*2UL, loadu( c1+SIMDSIZE*2UL )*scale + xmm3 *factor );
+         storeu( c2             , loadu( c2              )*scale + xmm4 *factor );
+         storeu( c2+SIMDSIZE    , loadu( c2+SIMDSIZE     )*scale + xmm5 *factor );
+         storeu( c2+SIMDSIZE*2UL, loadu( c2+SIMDSIZE*2UL )*scale + xmm6 *factor );
+         storeu( c3             , loadu( c3              )*scale + xmm7 *factor );
+         storeu( c3+SIMDSIZE    , loadu( c3+SIMDSIZE     )*scale + xmm8 *factor );
+         storeu( c3+SIMDSIZE*2UL, loadu( c3+SIMDSIZE*2UL )*scale + xmm9 *factor );
+         storeu( c4             , loadu( c4              )*scale + xmm10*factor );
+         storeu( c4+SIMDSIZE    , loadu( c4+SIMDSIZE     )*scale + xmm11*factor );
+         storeu( c4+SIMDSIZE*2UL, loadu( c4+SIMDSIZE*2UL )*scale + xmm12*factor );
+      }
+   }
+   else
+   {
+      alignas( AlignmentOf<T>::value ) T tile[MR*NR];
+
+      storea( tile     , xmm1  ); storea( tile     +SIMDSIZE, xmm2  ); storea( tile     +SIMDSIZE*2UL, xmm3  );
+      storea( tile+NR  , xmm4  ); storea( tile+NR  +SIMDSIZE, xmm5  ); storea( tile+NR  +SIMDSIZE*2UL, xmm6  );
+      storea( tile+NR*2, xmm7  ); storea( tile+NR*2+SIMDSIZE, xmm8  ); storea( tile+NR*2+SIMDSIZE*2UL, xmm9  );
+      storea( tile+NR*3, xmm10 ); storea( tile+NR*3+SIMDSIZE, xmm11 ); storea( tile+NR*3+SIMDSIZE*2UL, xmm12 );
+
+      updateGemmTile( alpha, beta, tile, c, ldc, mr, nr );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the packed dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param M The number of rows of \a A and \a C.
+// \param N The number of columns of \a B and \a C.
+// \param K The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of matrix \a A.
+// \param rsA The distance between two rows of matrix \a A.
+// \param csA The distance between two columns of matrix \a A.
+// \param lowerA \a true in case \a A is a lower triangular matrix.
+// \param upperA \a true in case \a A is an upper triangular matrix.
+// \param B Pointer to the first element of matrix \a B.
+// \param rsB The distance between two rows of matrix \a B.
+// \param csB The distance between two columns of matrix \a B.
+// \param lowerB \a true in case \a B is a lower triangular matrix.
+// \param upperB \a true in case \a B is an upper triangular matrix.
+// \param beta The scaling factor for \f$ C \f$.
+// \param C Pointer to the first element of the row-major matrix \a C.
+// \param ldc The distance between two rows of matrix \a C.
+// \return void
+//
+// This function implements a GotoBLAS-style matrix multiplication: For every block of \a nc
+// columns and \a kc rows of \a B a packed copy is created, and for every block of \a mc rows
+// and \a kc columns of \a A a packed copy is created. The packed blocks are multiplied by means
+// of register blocked SIMD micro kernels. Both operands can be stored in arbitrary order, the
+// target matrix \a C is required to be stored in row-major order. In case \a beta is 0, \a C
+// is not read.
+//
+// In case \a A and/or \a B are triangular, the product is computed TRMM-style: The blocks of
+// \a mc rows and/or \a nc columns are reduced to \a tb rows/columns and for every block of
+// \a C only the range of \a K that is not restricted to zero by the triangular structure of
+// both operands is packed and multiplied. Blocks of \a C that are zero due to the structure
+// of both operands (as for instance the upper part of a lower/lower product) are merely scaled
+// by \a beta. The packing buffers are allocated once and every block of \a B is packed only
+// once. Since the triangular operands are stored as full matrices, the zero elements inside
+// the diagonal blocks do not need special treatment.
+*/
+template< typename T >  // Element type
+void packedGemm_backend( size_t M, size_t N, size_t K, T alpha,
+                         const T* A, size_t rsA, size_t csA, bool lowerA, bool upperA,
+                         const T* B, size_t rsB, size_t csB, bool lowerB, bool upperB,
+                         T beta, T* C, size_t ldc )
+{
+   enum : size_t { MR = GemmTraits<T>::MR };
+   enum : size_t { NR = GemmTraits<T>::NR };
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   if( K == 0UL ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            if( isDefault( beta ) ) reset( C[i*ldc+j] );
+            else C[i*ldc+j] *= beta;
+         }
+      }
+      return;
+   }
+
+   const GemmBlocking& blocking( gemmBlocking<T>() );
+
+   const size_t TB( blocking.tb + ( NR - blocking.tb % NR ) % NR );
+
+   const size_t MB( ( lowerA || upperA )?( blocking.tb ):( blocking.mc ) );
+   const size_t NB( ( lowerB || upperB )?( TB ):( blocking.nc ) );
+
+   const size_t MC( ( M < MB )?( M + ( MR - M % MR ) % MR ):( MB ) );
+   const size_t KC( ( K < blocking.kc )?( K ):( blocking.kc ) );
+   const size_t NC( ( N < NB )?( N + ( NR - N % NR ) % NR ):( NB ) );
+
+   std::unique_ptr<T[],Deallocate> Ap( allocate<T>( MC*KC ) );
+   std::unique_ptr<T[],Deallocate> Bp( allocate<T>( KC*NC ) );
+
+   for( size_t jc=0UL; jc<N; jc+=NC )
+   {
+      const size_t nc( ( N - jc < NC )?( N - jc ):( NC ) );
+
+      for( size_t pc=0UL; pc<K; pc+=KC )
+      {
+         const size_t kc( ( K - pc < KC )?( K - pc ):( KC ) );
+
+         bool packed( false );
+
+         for( size_t ic=0UL; ic<M; ic+=MC )
+         {
+            const size_t mc( ( M - ic < MC )?( M - ic ):( MC ) );
+
+            const size_t kbegin( max( ( upperA )?( ic ):( 0UL ), ( lowerB )?( jc ):( 0UL ) ) );
+            const size_t kend  ( min( ( lowerA )?( ic+mc ):( K ), ( upperB )?( jc+nc ):( K ), K ) );
+
+            if( kbegin >= kend ) {
+               for( size_t i=ic; pc==0UL && i<ic+mc; ++i ) {
+                  for( size_t j=jc; j<jc+nc; ++j ) {
+                     if( isDefault( beta ) ) reset( C[i*ldc+j] );
+                     else C[i*ldc+j] *= beta;
+                  }
+               }
+               continue;
+            }
+
+            const size_t kb( max( pc, kbegin ) );
+            const size_t ke( min( pc+kc, kend ) );
+
+            if( kb >= ke )
+               continue;
+
+            if( !packed ) {
+               packGemmB( kc, nc, B + pc*rsB + jc*csB, rsB, csB, Bp.get() );
+               packed = true;
+            }
+
+            const size_t kk( ke - kb );
+            const T factor( ( kb == kbegin )?( beta ):( T(1) ) );
+
+            packGemmA( mc, kk, A + ic*rsA + kb*csA, rsA, csA, Ap.get() );
+
+            for( size_t jr=0UL; jr<nc; jr+=NR )
+            {
+               const size_t nr( ( nc - jr < NR )?( nc - jr ):( NR ) );
+
+               for( size_t ir=0UL; ir<mc; ir+=MR )
+               {
+                  const size_t mr( ( mc - ir < MR )?( mc - ir ):( MR ) );
+
+                  gemmMicroKernel( kk, alpha, Ap.get() + ir*kk, Bp.get() + jr*kc + ( kb-pc )*NR,
+                                   factor, C + ( ic+ir )*ldc + jc+jr, ldc, mr, nr );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function performs the dense matrix/dense matrix multiplication by means of the native
+// packed matrix multiplication kernel. It is used for large matrix multiplications in case no
+// BLAS library is used. All three matrices can be stored in arbitrary order: In case \a C is a
+// column-major matrix, the transposed product \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ is computed.
+// In case either of the two operands is a lower or upper triangular matrix, only the parts of
+// the product that are not restricted to zero by the triangular structure are computed (see
+// packedGemm_backend()). Note that the function requires all three matrices to provide data
+// access and to have the same floating point element type.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scalar factors
+void packedGemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                 const DenseMatrix<MT3,SO3>& B, ST alpha, ST beta )
+{
+   typedef ElementType_<MT1>  ET;
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ElementType_<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ElementType_<MT3> );
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).columns() == (~C).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   const size_t rsA( SO2 ? 1UL : (~A).spacing() );
+   const size_t csA( SO2 ? (~A).spacing() : 1UL );
+   const size_t rsB( SO3 ? 1UL : (~B).spacing() );
+   const size_t csB( SO3 ? (~B).spacing() : 1UL );
+
+   if( !SO1 ) {
+      packedGemm_backend<ET>( (~A).rows(), (~B).columns(), (~A).columns(), ET( alpha ),
+                              (~A).data(), rsA, csA, IsLower<MT2>::value, IsUpper<MT2>::value,
+                              (~B).data(), rsB, csB, IsLower<MT3>::value, IsUpper<MT3>::value,
+                              ET( beta ), (~C).data(), (~C).spacing() );
+   }
+   else {
+      packedGemm_backend<ET>( (~B).columns(), (~A).rows(), (~A).columns(), ET( alpha ),
+                              (~B).data(), csB, rsB, IsUpper<MT3>::value, IsLower<MT3>::value,
+                              (~A).data(), csA, rsA, IsUpper<MT2>::value, IsLower<MT2>::value,
+                              ET( beta ), (~C).data(), (~C).spacing() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
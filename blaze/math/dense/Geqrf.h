@@ -0,0 +1,361 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Geqrf.h
+//  \brief Header file for the native dense matrix QR decomposition
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_GEQRF_H_
+#define _BLAZE_MATH_DENSE_GEQRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatForEachExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE QR DECOMPOSITION FUNCTIONS (GEQRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native QR decomposition functions (geqrf) */
+//@{
+template< typename MT, bool SO >
+void blockedGeqrf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau );
+
+template< typename MT, bool SO >
+void blockedOrgqr( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked QR decomposition of a panel of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \param k The index of the first row/column of the panel.
+// \param kb The number of columns of the panel.
+// \return void
+//
+// This function computes the elementary reflectors \f$ H(j) = I - \tau_j v_j v_j^H \f$ for the
+// columns \a k to \a k+kb-1 and applies them to the remaining columns of the panel. The vector
+// \f$ v_j \f$ has a unit \a j-th element and is stored below the diagonal of \a A.
+*/
+template< typename MT >  // Type of the dense matrix
+void geqrfPanel( MT& A, ElementType_<MT>* tau, size_t k, size_t kb )
+{
+   typedef ElementType_<MT>          ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t m( A.rows() );
+
+   for( size_t j=k; j<k+kb; ++j )
+   {
+      const ET alpha( A(j,j) );
+
+      BT xnorm( 0 );
+      for( size_t i=j+1UL; i<m; ++i ) {
+         xnorm += real( A(i,j) * conj( A(i,j) ) );
+      }
+
+      if( xnorm == BT(0) && imag( alpha ) == BT(0) ) {
+         reset( tau[j] );
+         continue;
+      }
+
+      const BT absbeta( sqrt( real( alpha * conj( alpha ) ) + xnorm ) );
+      const BT beta( std::copysign( absbeta, -real( alpha ) ) );
+
+      tau[j] = ( ET( beta ) - alpha ) / ET( beta );
+
+      const ET scale( ET(1) / ( alpha - ET( beta ) ) );
+      for( size_t i=j+1UL; i<m; ++i ) {
+         A(i,j) *= scale;
+      }
+
+      A(j,j) = ET(1);
+
+      const ET ctau( conj( tau[j] ) );
+      for( size_t l=j+1UL; l<k+kb; ++l ) {
+         ET w( A(j,l) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            w += conj( A(i,j) ) * A(i,l);
+         }
+         w *= ctau;
+         A(j,l) -= w;
+         for( size_t i=j+1UL; i<m; ++i ) {
+            A(i,l) -= A(i,j) * w;
+         }
+      }
+
+      A(j,j) = beta;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the compact WY representation of a block of elementary reflectors.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing the elementary reflectors below its diagonal.
+// \param tau The scalar factors of the elementary reflectors.
+// \param k The index of the first row/column of the block of reflectors.
+// \param kb The number of reflectors in the block.
+// \param V The resulting (\a m-\a k)-by-\a kb unit lower trapezoidal matrix of reflectors.
+// \param T The resulting \a kb-by-\a kb upper triangular factor.
+// \return void
+//
+// This function sets up the matrices \a V and \a T such that
+// \f$ H(k) H(k+1) \cdots H(k+kb-1) = I - V T V^H \f$.
+*/
+template< typename MT     // Type of the dense matrix
+        , typename MTV    // Type of the reflector matrix
+        , typename MTT >  // Type of the triangular factor
+void geqrfFormT( const MT& A, const ElementType_<MT>* tau, size_t k, size_t kb, MTV& V, MTT& T )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( A.rows() );
+
+   V.resize( m-k, kb, false );
+   T.resize( kb, kb, false );
+   reset( V );
+   reset( T );
+
+   for( size_t j=0UL; j<kb; ++j ) {
+      V(j,j) = ET(1);
+      for( size_t i=j+1UL; i<m-k; ++i ) {
+         V(i,j) = A(k+i,k+j);
+      }
+   }
+
+   const MTT G( ctrans( V ) * V );
+
+   for( size_t j=0UL; j<kb; ++j ) {
+      T(j,j) = tau[k+j];
+      for( size_t i=0UL; i<j; ++i ) {
+         ET x{};
+         for( size_t l=i; l<j; ++l ) {
+            x += T(i,l) * G(l,j);
+         }
+         T(i,j) = -tau[k+j] * x;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the QR decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK geqrf() function (see blaze::geqrf())
+// and computes the QR decomposition of the given general \a m-by-\a n matrix without requiring
+// a LAPACK library. The resulting decomposition has the form
+
+                              \f[ A = Q \cdot R, \f]
+
+// where the \c Q is represented as a product of elementary reflectors
+
+               \f[ Q = H(1) H(2) . . . H(k) \texttt{, with k = min(m,n).} \f]
+
+// Each H(i) has the form
+
+                      \f[ H(i) = I - tau \cdot v \cdot v^H, \f]
+
+// where \c tau is a scalar, and \c v is a vector with <tt>v(0:i-1) = 0</tt> and
+// <tt>v(i) = 1</tt>. <tt>v(i+1:m)</tt> is stored on exit in <tt>A(i+1:m,i)</tt>, and \c tau
+// in \c tau(i). Thus on exit the elements on and above the diagonal of the matrix contain the
+// min(\a m,\a n)-by-\a n upper trapezoidal matrix \c R. In contrast to the LAPACK kernel, the
+// decomposition is computed for the logical matrix \a A independent of its storage order.
+//
+// The decomposition is computed panel by panel. The reflectors of each panel are aggregated to
+// the compact WY representation \f$ I - V T V^H \f$, such that the update of the trailing
+// submatrix is performed (and parallelized) by the Blaze dense matrix multiplication kernels.
+// The reflectors are only compatible to the blockedOrgqr() function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGeqrf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+   const size_t mindim( min( m, n ) );
+
+   DynamicMatrix<ET,columnMajor> V, T, W;
+
+   for( size_t k=0UL; k<mindim; k+=FACTORIZATION_BLOCK_SIZE )
+   {
+      const size_t kb  ( min( FACTORIZATION_BLOCK_SIZE, mindim-k ) );
+      const size_t kend( k + kb );
+
+      geqrfPanel( ~A, tau, k, kb );
+
+      if( kend < n ) {
+         geqrfFormT( ~A, tau, k, kb, V, T );
+
+         auto C( submatrix( ~A, k, kend, m-k, n-kend ) );
+         W = ctrans( V ) * C;
+         W = ctrans( T ) * W;
+         C -= V * W;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the reconstruction of the \c Q matrix from a QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The decomposed matrix.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK orgqr() and ungqr() functions (see
+// blaze::orgqr() and blaze::ungqr()). It reconstructs the \c Q matrix from a QR decomposition
+// computed by the blockedGeqrf() function. The \a m-by-min(\a m,\a n) \c Q matrix is stored
+// within the given matrix \a A. The reflectors are applied block by block in reverse order by
+// means of their compact WY representation.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedOrgqr( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+   const size_t k( min( m, (~A).columns() ) );
+
+   DynamicMatrix<ET,columnMajor> V, T, W;
+
+   for( size_t jend=k; jend>0UL; )
+   {
+      const size_t j ( ( ( jend - 1UL ) / FACTORIZATION_BLOCK_SIZE ) * FACTORIZATION_BLOCK_SIZE );
+      const size_t jb( jend - j );
+
+      if( jend < k ) {
+         geqrfFormT( ~A, tau, j, jb, V, T );
+
+         auto C( submatrix( ~A, j, jend, m-j, k-jend ) );
+         W = ctrans( V ) * C;
+         W = T * W;
+         C -= V * W;
+      }
+
+      for( size_t i=jend; i-- > j; )
+      {
+         if( i+1UL < jend ) {
+            (~A)(i,i) = ET(1);
+            for( size_t l=i+1UL; l<jend; ++l ) {
+               ET w( (~A)(i,l) );
+               for( size_t r=i+1UL; r<m; ++r ) {
+                  w += conj( (~A)(r,i) ) * (~A)(r,l);
+               }
+               w *= tau[i];
+               (~A)(i,l) -= w;
+               for( size_t r=i+1UL; r<m; ++r ) {
+                  (~A)(r,l) -= (~A)(r,i) * w;
+               }
+            }
+         }
+
+         for( size_t r=i+1UL; r<m; ++r ) {
+            (~A)(r,i) *= -tau[i];
+         }
+
+         (~A)(i,i) = ET(1) - tau[i];
+
+         for( size_t r=j; r<i; ++r ) {
+            reset( (~A)(r,i) );
+         }
+      }
+
+      for( size_t c=j; c<jend; ++c ) {
+         for( size_t r=0UL; r<j; ++r ) {
+            reset( (~A)(r,c) );
+         }
+      }
+
+      jend = j;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
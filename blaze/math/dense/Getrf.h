@@ -0,0 +1,422 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Getrf.h
+//  \brief Header file for the native dense matrix LU decomposition and LU-based inversion
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_GETRF_H_
+#define _BLAZE_MATH_DENSE_GETRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/Trsm.h>
+#include <blaze/math/dense/Trtri.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransposer.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU DECOMPOSITION FUNCTIONS (GETRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native LU decomposition functions (getrf) */
+//@{
+template< typename MT, bool SO >
+void blockedGetrf( DenseMatrix<MT,SO>& A, int* ipiv );
+
+template< typename MT, bool SO >
+void blockedGetri( DenseMatrix<MT,SO>& A, const int* ipiv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the row interchanges of a panel of an LU decomposition to a range of columns.
+// \ingroup dense_matrix
+//
+// \param A The column-major dense matrix.
+// \param ipiv The pivot indices (1-based, in LAPACK convention).
+// \param k The index of the first row interchange to be applied.
+// \param kend The index one past the last row interchange to be applied.
+// \param jbegin The index of the first column to be permuted.
+// \param jend The index one past the last column to be permuted.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void getrfSwapRows( DenseMatrix<MT,true>& A, const int* ipiv,
+                    size_t k, size_t kend, size_t jbegin, size_t jend )
+{
+   using std::swap;
+
+   for( size_t j=jbegin; j<jend; ++j ) {
+      for( size_t i=k; i<kend; ++i ) {
+         const size_t p( ipiv[i] - 1 );
+         if( p != i ) {
+            swap( (~A)(i,j), (~A)(p,j) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU decomposition of a panel of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major dense matrix.
+// \param ipiv The resulting pivot indices (1-based, in LAPACK convention).
+// \param k The index of the first row/column of the panel.
+// \param kb The number of columns of the panel.
+// \return void
+//
+// This function decomposes the columns \a k to \a k+kb-1 (starting from row \a k) by means of
+// partial pivoting with row interchanges. The row interchanges are only applied to the panel.
+*/
+template< typename MT >  // Type of the dense matrix
+void getrfPanel( DenseMatrix<MT,true>& A, int* ipiv, size_t k, size_t kb )
+{
+   using std::swap;
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t m( (~A).rows() );
+
+   for( size_t j=k; j<k+kb; ++j )
+   {
+      size_t p( j );
+      auto pmax( abs( (~A)(j,j) ) );
+
+      for( size_t i=j+1UL; i<m; ++i ) {
+         const auto tmp( abs( (~A)(i,j) ) );
+         if( tmp > pmax ) {
+            pmax = tmp;
+            p = i;
+         }
+      }
+
+      ipiv[j] = static_cast<int>( p+1UL );
+
+      if( !isDefault( (~A)(p,j) ) )
+      {
+         if( p != j ) {
+            for( size_t l=k; l<k+kb; ++l ) {
+               swap( (~A)(j,l), (~A)(p,l) );
+            }
+         }
+
+         const ET inv( ET(1) / (~A)(j,j) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            (~A)(i,j) *= inv;
+         }
+      }
+
+      for( size_t l=j+1UL; l<k+kb; ++l ) {
+         const ET x( (~A)(j,l) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            (~A)(i,l) -= (~A)(i,j) * x;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked right-looking LU decomposition of the given column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major dense matrix to be decomposed.
+// \param ipiv The resulting pivot indices (1-based, in LAPACK convention).
+// \return void
+//
+// This function decomposes the given column-major matrix panel by panel. After the decomposition
+// of a panel, the row interchanges are applied to the remaining columns, the block row of \a U
+// is computed by a triangular solve and the trailing submatrix is updated by a (parallel) dense
+// matrix multiplication.
+*/
+template< typename MT >  // Type of the dense matrix
+void getrf_backend( DenseMatrix<MT,true>& A, int* ipiv )
+{
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+   const size_t mindim( min( m, n ) );
+
+   for( size_t k=0UL; k<mindim; k+=FACTORIZATION_BLOCK_SIZE )
+   {
+      const size_t kb  ( min( FACTORIZATION_BLOCK_SIZE, mindim-k ) );
+      const size_t kend( k + kb );
+
+      getrfPanel( ~A, ipiv, k, kb );
+      getrfSwapRows( ~A, ipiv, k, kend, 0UL, k );
+      getrfSwapRows( ~A, ipiv, k, kend, kend, n );
+
+      if( kend < n ) {
+         trsmLeftLower<true>( ~A, k, kb, ~A, k, kend, n-kend );
+
+         if( kend < m ) {
+            submatrix( ~A, kend, kend, m-kend, n-kend ) -= submatrix( ~A, kend, k, m-kend, kb ) *
+                                                           submatrix( ~A, k, kend, kb, n-kend );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LU decomposition of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The row-major dense matrix to be decomposed.
+// \param ipiv The resulting pivot indices (1-based, in LAPACK convention).
+// \return void
+//
+// In accordance to the LAPACK kernel, the transpose of the row-major matrix is decomposed. The
+// decomposition works in-place on a column-major view of the matrix, i.e. without any copy.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void getrf_backend( DenseMatrix<MT,false>& A, int* ipiv )
+{
+   DMatTransposer<MT,true> AT( ~A );
+   getrf_backend( AT, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the LU decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK getrf() function (see blaze::getrf())
+// and computes the same decomposition with partial pivoting without requiring a LAPACK library.
+// In case of a column-major matrix, the resulting decomposition has the form
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// in case of a row-major matrix, the resulting decomposition has the form
+
+                          \f[ A = L \cdot U \cdot P. \f]
+
+// The pivot indices are stored in \a ipiv in LAPACK convention (i.e. 1-based). The decomposition
+// is computed by a blocked right-looking algorithm, which performs the major part of the work by
+// means of the Blaze dense matrix multiplication kernels and which is parallelized via the shared
+// memory parallelization of these kernels. Row-major matrices are decomposed in-place, without
+// the need for a transposed copy.
+//
+// \note The decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
+// a linear system of equations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGetrf( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   getrf_backend( ~A, ipiv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE LU-BASED INVERSION FUNCTIONS (GETRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked inversion of the given LU decomposed column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed column-major dense matrix.
+// \param ipiv The pivot indices of the LU decomposition (1-based, in LAPACK convention).
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function first inverts \a U and then solves the system \f$ A^{-1}*L=U^{-1} \f$ for
+// \f$ A^{-1} \f$ block column by block column, starting with the last block column. Finally
+// the column interchanges are applied in reverse order.
+*/
+template< typename MT >  // Type of the dense matrix
+void getri_backend( DenseMatrix<MT,true>& A, const int* ipiv )
+{
+   using std::swap;
+
+   typedef ElementType_<MT>  ET;
+
+   const size_t n( (~A).rows() );
+
+   DMatTransposer<MT,false> AT( ~A );
+   trtriLower<false>( AT, 0UL, n );
+
+   for( size_t jend=n; jend>0UL; )
+   {
+      const size_t j ( ( ( jend - 1UL ) / FACTORIZATION_BLOCK_SIZE ) * FACTORIZATION_BLOCK_SIZE );
+      const size_t jb( jend - j );
+
+      DynamicMatrix<ET,true> W( n-j, jb );
+
+      for( size_t c=0UL; c<jb; ++c ) {
+         for( size_t i=c+1UL; i<n-j; ++i ) {
+            W(i,c) = (~A)(j+i,j+c);
+            reset( (~A)(j+i,j+c) );
+         }
+      }
+
+      if( jend < n ) {
+         submatrix( ~A, 0UL, j, n, jb ) -= submatrix( ~A, 0UL, jend, n, n-jend ) *
+                                           submatrix( W, jb, 0UL, n-jend, jb );
+      }
+
+      for( size_t c=jb; c-- > 0UL; ) {
+         for( size_t r=c+1UL; r<jb; ++r ) {
+            const ET w( W(r,c) );
+            for( size_t i=0UL; i<n; ++i ) {
+               (~A)(i,j+c) -= (~A)(i,j+r) * w;
+            }
+         }
+      }
+
+      jend = j;
+   }
+
+   for( size_t j=n-1UL; j-- > 0UL; ) {
+      const size_t p( ipiv[j] - 1 );
+      if( p != j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            swap( (~A)(i,j), (~A)(i,p) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inversion of the given LU decomposed row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed row-major dense matrix.
+// \param ipiv The pivot indices of the LU decomposition (1-based, in LAPACK convention).
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void getri_backend( DenseMatrix<MT,false>& A, const int* ipiv )
+{
+   DMatTransposer<MT,true> AT( ~A );
+   getri_backend( AT, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the inversion of the given LU decomposed dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be inverted.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK getri() function (see blaze::getri())
+// for matrices that have already been factorized by the blockedGetrf() function.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGetri( DenseMatrix<MT,SO>& A, const int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() == 0UL ) {
+      return;
+   }
+
+   getri_backend( ~A, ipiv );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
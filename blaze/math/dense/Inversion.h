@@ -45,7 +45,10 @@
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/dense/Getrf.h>
+#include <blaze/math/dense/Potrf.h>
 #include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/Trtri.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
@@ -63,6 +66,7 @@
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/Real.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
@@ -3291,7 +3295,8 @@ inline void invert6x6( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3306,8 +3311,13 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
    const size_t n( min( (~dm).rows(), (~dm).columns() ) );
    const std::unique_ptr<int[]> ipiv( new int[n] );
 
+#if BLAZE_LAPACK_MODE
    getrf( ~dm, ipiv.get() );
    getri( ~dm, ipiv.get() );
+#else
+   blockedGetrf( ~dm, ipiv.get() );
+   blockedGetri( ~dm, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3336,7 +3346,8 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3350,11 +3361,15 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isSymmetric( ~dm ), "Invalid non-symmetric matrix detected" );
 
+#if BLAZE_LAPACK_MODE
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
 
    sytrf( ~dm, uplo, ipiv.get() );
    sytri( ~dm, uplo, ipiv.get() );
+#else
+   invertByLU( ~dm );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3398,7 +3413,8 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3437,7 +3453,8 @@ inline EnableIf_< IsBuiltin< ElementType_<MT> > >
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3452,11 +3469,15 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
 
    BLAZE_USER_ASSERT( isHermitian( ~dm ), "Invalid non-Hermitian matrix detected" );
 
+#if BLAZE_LAPACK_MODE
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
 
    hetrf( ~dm, uplo, ipiv.get() );
    hetri( ~dm, uplo, ipiv.get() );
+#else
+   invertByLU( ~dm );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3500,7 +3521,8 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3516,8 +3538,13 @@ inline void invertByLLH( DenseMatrix<MT,SO>& dm )
 
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
 
+#if BLAZE_LAPACK_MODE
    potrf( ~dm, uplo );
    potri( ~dm, uplo );
+#else
+   blockedPotrf( ~dm, uplo );
+   blockedPotri( ~dm, uplo );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3561,7 +3588,8 @@ inline void invertByLLH( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3573,7 +3601,11 @@ inline void invertLowerNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'L', 'N' );
+#else
+   blockedTrtri( ~dm, 'L', 'N' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3602,7 +3634,8 @@ inline void invertLowerNxN( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3614,7 +3647,11 @@ inline void invertUniLowerNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'L', 'U' );
+#else
+   blockedTrtri( ~dm, 'L', 'U' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3643,7 +3680,8 @@ inline void invertUniLowerNxN( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3655,7 +3693,11 @@ inline void invertUpperNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'U', 'N' );
+#else
+   blockedTrtri( ~dm, 'U', 'N' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3684,7 +3726,8 @@ inline void invertUpperNxN( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3696,7 +3739,11 @@ inline void invertUniUpperNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'U', 'U' );
+#else
+   blockedTrtri( ~dm, 'U', 'U' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3725,7 +3772,8 @@ inline void invertUniUpperNxN( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3768,7 +3816,8 @@ inline void invertDiagonalNxN( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3846,7 +3895,8 @@ inline void invert( DenseMatrix<MT,SO>& dm );
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3893,7 +3943,8 @@ inline void invert( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
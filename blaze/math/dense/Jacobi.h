@@ -0,0 +1,495 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Jacobi.h
+//  \brief Header file for the native Jacobi eigenvalue and singular value kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_JACOBI_H_
+#define _BLAZE_MATH_DENSE_JACOBI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE JACOBI EIGENVALUE AND SINGULAR VALUE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native Jacobi eigenvalue and singular value functions */
+//@{
+template< typename MT, bool SO >
+void jacobiHeev( DenseMatrix<MT,SO>& A );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void jacobiHeev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& V );
+
+template< typename MT, bool SO >
+void jacobiGesvd( DenseMatrix<MT,SO>& A );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void jacobiGesvd( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& V );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum number of sweeps of the cyclic Jacobi kernels.
+// \ingroup dense_matrix
+*/
+constexpr size_t JACOBI_MAX_SWEEPS = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum number of rows/columns of fixed size matrices handled by the Jacobi kernels.
+// \ingroup dense_matrix
+//
+// In case the LAPACK mode is enabled, the eigenvalues and singular values of fixed size matrices
+// up to this size are computed by the native Jacobi kernels on the stack, whereas all other
+// matrices are handed to LAPACK.
+*/
+constexpr size_t JACOBI_THRESHOLD = 6UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of a Jacobi rotation that annihilates the off-diagonal element of a 2x2
+//        Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param app The real diagonal element \f$ a_{pp} \f$.
+// \param aqq The real diagonal element \f$ a_{qq} \f$.
+// \param r The absolute value of the off-diagonal element \f$ |a_{pq}| \f$; must be non-zero.
+// \param c The resulting cosine of the rotation.
+// \param s The resulting sine of the rotation.
+// \return The tangent \f$ t = s/c \f$ of the rotation.
+//
+// The rotation is chosen according to Rutishauser such that the rotation angle satisfies
+// \f$ |\theta| \leq \pi/4 \f$, which results in the updated diagonal elements
+// \f$ a_{pp}-t \cdot r \f$ and \f$ a_{qq}+t \cdot r \f$.
+*/
+template< typename BT >  // Underlying builtin element type
+inline BT jacobiRotation( BT app, BT aqq, BT r, BT& c, BT& s )
+{
+   const BT h( aqq - app );
+   BT t;
+
+   if( abs( h ) + BT(100)*r == abs( h ) ) {
+      t = r / h;
+   }
+   else {
+      const BT theta( h / ( BT(2)*r ) );
+      t = BT(1) / ( abs( theta ) + sqrt( theta*theta + BT(1) ) );
+      if( theta < BT(0) ) t = -t;
+   }
+
+   c = BT(1) / sqrt( t*t + BT(1) );
+   s = t * c;
+
+   return t;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of a (complex) Jacobi rotation to two columns of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be updated.
+// \param p The index of the first column.
+// \param q The index of the second column.
+// \param c The cosine of the rotation.
+// \param s The sine of the rotation.
+// \param d The unit phase factor applied to column \a q.
+// \param begin The first row to be updated.
+// \param end The row past the last row to be updated.
+// \return void
+*/
+template< typename MT    // Type of the dense matrix
+        , typename BT    // Underlying builtin element type
+        , typename ET >  // Element type of the phase factor
+inline void jacobiRotateColumns( MT& A, size_t p, size_t q, BT c, BT s, const ET& d,
+                                 size_t begin, size_t end )
+{
+   for( size_t k=begin; k<end; ++k ) {
+      const ET akp( A(k,p) );
+      const ET akq( A(k,q) * d );
+      A(k,p) = c*akp - s*akq;
+      A(k,q) = s*akp + c*akq;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the cyclic Jacobi eigenvalue kernels.
+// \ingroup dense_matrix
+//
+// \param A The Hermitian matrix to be diagonalized.
+// \param V The resulting matrix of eigenvectors (only referenced if \a Vectors is \a true).
+// \return void
+//
+// This function diagonalizes the given Hermitian matrix by means of cyclic sweeps of complex
+// Jacobi rotations \f$ J = D \cdot R \f$, where \c D scales column \c q by the phase of the
+// off-diagonal element \f$ a_{pq} \f$ and \c R is a real plane rotation. Both the lower and the
+// upper part of \a A are updated, such that \a A stays Hermitian.
+*/
+template< bool Vectors   // Compute the eigenvectors
+        , typename MT1   // Type of the Hermitian matrix
+        , typename MT2 > // Type of the eigenvector matrix
+void jacobiHeevBackend( MT1& A, MT2& V )
+{
+   typedef ElementType_<MT1>       ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t n( A.rows() );
+   const BT eps( Limits<BT>::epsilon() );
+
+   if( Vectors ) {
+      reset( V );
+      for( size_t i=0UL; i<n; ++i ) {
+         V(i,i) = ET(1);
+      }
+   }
+
+   for( size_t sweep=0UL; sweep<JACOBI_MAX_SWEEPS; ++sweep )
+   {
+      BT diag( 0 ), off( 0 );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         diag += real( A(i,i) ) * real( A(i,i) );
+         for( size_t j=i+1UL; j<n; ++j ) {
+            off += real( A(i,j) * conj( A(i,j) ) );
+         }
+      }
+
+      if( !( off > eps*eps*diag ) ) {
+         break;
+      }
+
+      for( size_t p=0UL; p<n; ++p ) {
+         for( size_t q=p+1UL; q<n; ++q )
+         {
+            const ET apq( A(p,q) );
+            const BT r( abs( apq ) );
+
+            if( r == BT(0) ) {
+               continue;
+            }
+
+            const BT app( real( A(p,p) ) );
+            const BT aqq( real( A(q,q) ) );
+            const ET d( conj( apq ) / r );
+
+            BT c, s;
+            const BT t( jacobiRotation( app, aqq, r, c, s ) );
+
+            jacobiRotateColumns( A, p, q, c, s, d, 0UL, n );
+
+            for( size_t k=0UL; k<n; ++k ) {
+               A(p,k) = conj( A(k,p) );
+               A(q,k) = conj( A(k,q) );
+            }
+
+            A(p,p) = app - t*r;
+            A(q,q) = aqq + t*r;
+            A(p,q) = ET(0);
+            A(q,p) = ET(0);
+
+            if( Vectors ) {
+               jacobiRotateColumns( V, p, q, c, s, d, 0UL, n );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native Jacobi kernel for the eigenvalues of the given dense Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The Hermitian matrix to be diagonalized.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the eigenvalues of the given Hermitian (or real symmetric) n-by-n matrix
+// by means of the cyclic Jacobi method. On exit, the diagonal of \a A contains the (unsorted)
+// eigenvalues of the matrix and all off-diagonal elements are zero. The Jacobi method requires
+// no workspace and is very accurate, but requires \f$ O(n^3) \f$ operations per sweep. It is
+// therefore the method of choice for small matrices, whereas large matrices should be handled
+// by the LAPACK syevd() or heevd() functions.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void jacobiHeev( DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   jacobiHeevBackend<false>( ~A, ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native Jacobi kernel for the eigenvalues and eigenvectors of the given dense Hermitian
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param A The Hermitian matrix to be diagonalized.
+// \param V The resulting matrix of eigenvectors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the eigenvalues and eigenvectors of the given Hermitian (or real
+// symmetric) n-by-n matrix by means of the cyclic Jacobi method. On exit, the diagonal of \a A
+// contains the (unsorted) eigenvalues of the matrix and column \c i of the n-by-n matrix \a V
+// contains the normalized eigenvector of the eigenvalue \c A(i,i).
+*/
+template< typename MT1  // Type of the Hermitian matrix
+        , bool SO1      // Storage order of the Hermitian matrix
+        , typename MT2  // Type of the eigenvector matrix
+        , bool SO2 >    // Storage order of the eigenvector matrix
+void jacobiHeev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& V )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~V).rows() != (~A).rows() || (~V).columns() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   jacobiHeevBackend<true>( ~A, ~V );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the one-sided Jacobi singular value kernels.
+// \ingroup dense_matrix
+//
+// \param A The m-by-n matrix (\f$ m \geq n \f$) to be orthogonalized.
+// \param V The resulting matrix of right singular vectors (only referenced if \a Vectors is \a true).
+// \return void
+//
+// This function implements the one-sided Jacobi method according to Hestenes: The columns of
+// \a A are pairwise orthogonalized by complex Jacobi rotations, which implicitly diagonalize
+// the Gram matrix \f$ A^H A \f$ without ever forming it.
+*/
+template< bool Vectors   // Compute the right singular vectors
+        , typename MT1   // Type of the general matrix
+        , typename MT2 > // Type of the right singular vector matrix
+void jacobiGesvdBackend( MT1& A, MT2& V )
+{
+   typedef ElementType_<MT1>       ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const BT eps( Limits<BT>::epsilon() );
+
+   if( Vectors ) {
+      reset( V );
+      for( size_t i=0UL; i<n; ++i ) {
+         V(i,i) = ET(1);
+      }
+   }
+
+   for( size_t sweep=0UL; sweep<JACOBI_MAX_SWEEPS; ++sweep )
+   {
+      bool rotated( false );
+
+      for( size_t p=0UL; p<n; ++p ) {
+         for( size_t q=p+1UL; q<n; ++q )
+         {
+            BT alpha( 0 ), beta( 0 );
+            ET gamma( 0 );
+
+            for( size_t k=0UL; k<m; ++k ) {
+               alpha += real( A(k,p) * conj( A(k,p) ) );
+               beta  += real( A(k,q) * conj( A(k,q) ) );
+               gamma += conj( A(k,p) ) * A(k,q);
+            }
+
+            const BT r( abs( gamma ) );
+
+            if( !( r > eps * sqrt( alpha*beta ) ) ) {
+               continue;
+            }
+
+            rotated = true;
+
+            const ET d( conj( gamma ) / r );
+
+            BT c, s;
+            jacobiRotation( alpha, beta, r, c, s );
+
+            jacobiRotateColumns( A, p, q, c, s, d, 0UL, m );
+
+            if( Vectors ) {
+               jacobiRotateColumns( V, p, q, c, s, d, 0UL, n );
+            }
+         }
+      }
+
+      if( !rotated ) {
+         break;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native one-sided Jacobi kernel for the singular values of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The m-by-n matrix (\f$ m \geq n \f$) to be orthogonalized.
+// \return void
+// \exception std::invalid_argument Invalid matrix with less rows than columns provided.
+//
+// This function orthogonalizes the columns of the given m-by-n matrix (\f$ m \geq n \f$) by
+// means of the one-sided Jacobi method. On exit, the Euclidean norms of the columns of \a A are
+// the (unsorted) singular values of the matrix and the normalized columns are the according
+// left singular vectors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void jacobiGesvd( DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( (~A).rows() < (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with less rows than columns provided" );
+   }
+
+   jacobiGesvdBackend<false>( ~A, ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native one-sided Jacobi kernel for the singular value decomposition of the given dense
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param A The m-by-n matrix (\f$ m \geq n \f$) to be orthogonalized.
+// \param V The resulting n-by-n matrix of right singular vectors.
+// \return void
+// \exception std::invalid_argument Invalid matrix with less rows than columns provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function orthogonalizes the columns of the given m-by-n matrix (\f$ m \geq n \f$) by
+// means of the one-sided Jacobi method. On exit, the Euclidean norms of the columns of \a A are
+// the (unsorted) singular values of the matrix, the normalized columns are the according left
+// singular vectors and the columns of the unitary n-by-n matrix \a V are the according right
+// singular vectors, i.e. the original matrix is given by \f$ A V^H \f$.
+*/
+template< typename MT1  // Type of the general matrix
+        , bool SO1      // Storage order of the general matrix
+        , typename MT2  // Type of the right singular vector matrix
+        , bool SO2 >    // Storage order of the right singular vector matrix
+void jacobiGesvd( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& V )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   if( (~A).rows() < (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with less rows than columns provided" );
+   }
+
+   if( (~V).rows() != (~A).columns() || (~V).columns() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   jacobiGesvdBackend<true>( ~A, ~V );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
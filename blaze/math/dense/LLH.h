@@ -47,12 +47,14 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/Potrf.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/LAPACK.h>
 
 
 namespace blaze {
@@ -116,7 +118,8 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L );
 // element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a call to this function will result in a linker error.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a L may already have been modified.
@@ -166,7 +169,11 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L )
       }
    }
 
+#if BLAZE_LAPACK_MODE
    potrf( l, 'L' );
+#else
+   blockedPotrf( l, 'L' );
+#endif
 }
 //*************************************************************************************************
 
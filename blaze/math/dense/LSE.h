@@ -0,0 +1,202 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/LSE.h
+//  \brief Header file for the solution of dense linear systems of equations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_LSE_H_
+#define _BLAZE_MATH_DENSE_LSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/Factorization.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LINEAR SYSTEM SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Linear system solve functions */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2 >
+inline void solve( const DenseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+                   const DenseVector<VT2,false>& b );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+inline void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+                   const DenseMatrix<MT3,SO3>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*x=b \f$.
+// \ingroup dense_matrix
+//
+// \param A The system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// This function computes the solution of the linear system of equations \f$ A*x=b \f$ without
+// explicitly forming the inverse of \a A. Compared to the evaluation of <tt>inv( A ) * b</tt>
+// this requires only about a third of the operations and results in a more accurate solution.
+// The algorithm is selected depending on the type of the system matrix (see the Factorization
+// class template for details):
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+   using blaze::SymmetricMatrix;
+
+   DynamicMatrix<double> A( 100UL, 100UL );                  // General matrix
+   LowerMatrix< DynamicMatrix<double> > L( 100UL );          // Lower triangular matrix
+   SymmetricMatrix< DynamicMatrix<double> > S( 100UL );      // Symmetric matrix
+   DynamicVector<double> x, b( 100UL );
+   // ... Initialization
+
+   solve( A, x, b );  // LU decomposition with partial pivoting
+   solve( L, x, b );  // Forward substitution
+   solve( S, x, b );  // Cholesky decomposition (in case S is positive definite)
+   \endcode
+
+// The solution vector \a x is resized to the size of \a b, if possible, and \a x and \a b may
+// refer to the same vector. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of \a b doesn't match the size of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown. In order to solve several linear systems with the
+// same system matrix, the system matrix should be factorized only once (see the factorize()
+// function).
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline void solve( const DenseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+                   const DenseVector<VT2,false>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const Factorization< ResultType_<MT> > F( ~A );
+   F.solve( ~x, ~b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*X=B \f$.
+// \ingroup dense_matrix
+//
+// \param A The system matrix.
+// \param X The resulting matrix of solution vectors.
+// \param B The matrix of right-hand side vectors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// This function computes the solution of the linear system of equations \f$ A*X=B \f$ for all
+// columns of \a B without explicitly forming the inverse of \a A. The system matrix is factorized
+// only once for all right-hand sides. The algorithm is selected depending on the type of the
+// system matrix (see the Factorization class template for details):
+
+   \code
+   using blaze::DynamicMatrix;
+
+   DynamicMatrix<double> A( 100UL, 100UL ), X, B( 100UL, 20UL );
+   // ... Initialization
+
+   solve( A, X, B );  // Solving the linear system for all 20 right-hand sides
+   \endcode
+
+// The solution matrix \a X is resized to the size of \a B, if possible, and \a X and \a B may
+// refer to the same matrix. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the number of rows of \a B doesn't match the size of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a linker error will be created.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the solution matrix
+        , bool SO2      // Storage order of the solution matrix
+        , typename MT3  // Type of the right-hand side matrix
+        , bool SO3 >    // Storage order of the right-hand side matrix
+inline void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+                   const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const Factorization< ResultType_<MT1> > F( ~A );
+   F.solve( ~X, ~B );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
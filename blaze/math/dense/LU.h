@@ -51,12 +51,14 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/Getrf.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/lapack/getrf.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/LAPACK.h>
 
 
 namespace blaze {
@@ -111,7 +113,11 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    int* ipiv  ( helper.get() );
    int* permut( ipiv + mindim );
 
+#if BLAZE_LAPACK_MODE
    getrf( ~A, ipiv );
+#else
+   blockedGetrf( ~A, ipiv );
+#endif
 
    for( size_t i=0UL; i<size; ++i ) {
       permut[i] = i;
@@ -204,7 +210,8 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
 // element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a call to this function will result in a linker error.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
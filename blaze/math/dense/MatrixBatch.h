@@ -0,0 +1,971 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixBatch.h
+//  \brief Header file for the implementation of a batch of small, fixed-size matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Algorithm.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup matrix_batch MatrixBatch
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a batch of small, fixed-size matrices.
+// \ingroup matrix_batch
+//
+// The MatrixBatch class template represents a dynamically sized batch of independent matrices
+// of the fixed size \f$ M \times N \f$. The type of the elements and the number of rows and
+// columns of the matrices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class MatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MatrixBatch can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - M   : specifies the number of rows of each matrix of the batch.
+//  - N   : specifies the number of columns of each matrix of the batch.
+//
+// In contrast to an array of StaticMatrix instances, a MatrixBatch stores its matrices in a
+// structure-of-arrays layout: all elements \f$ (i,j) \f$ of all matrices of the batch are stored
+// contiguously in a single, properly aligned and padded array (the so-called plane of element
+// \f$ (i,j) \f$). Therefore batched operations like batchMult() can process the matrices of the
+// batch in a vectorized fashion, where every SIMD lane processes one matrix of the batch:
+
+   \code
+   using blaze::MatrixBatch;
+   using blaze::StaticMatrix;
+
+   MatrixBatch<double,3UL,3UL> A( 1000UL ), B( 1000UL ), C;
+
+   StaticMatrix<double,3UL,3UL> R;
+   // ... Initialization of R
+
+   for( size_t k=0UL; k<A.size(); ++k ) {
+      A.set( k, R );  // Setting the k-th matrix of the batch
+      B( k, 0UL, 0UL ) = 1.0;  // Direct access to element (0,0) of the k-th matrix
+   }
+
+   batchMult( C, A, B );  // Computing all 1000 products C[k] = A[k] * B[k]
+
+   R = C.get( 5UL );  // Extracting the sixth matrix of the batch
+   \endcode
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+class MatrixBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef MatrixBatch<Type,M,N>            This;         //!< Type of this MatrixBatch instance.
+   typedef StaticMatrix<Type,M,N,rowMajor>  MatrixType;   //!< Type of a single matrix.
+   typedef Type                             ElementType;  //!< Type of the matrix elements.
+   typedef SIMDTrait_<ElementType>          SIMDType;     //!< SIMD type of the matrix elements.
+
+   typedef Type&        Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&  ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*        Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*  ConstPointer;    //!< Pointer to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether batched operations the batch is
+       involved in can be optimized via SIMD operations. In case the element type of the batch
+       is a vectorizable data type, the \a simdEnabled compilation flag is set to \a true,
+       otherwise it is set to \a false. */
+   enum : bool { simdEnabled = IsVectorizable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MatrixBatch() noexcept;
+   explicit inline MatrixBatch( size_t n );
+   explicit inline MatrixBatch( size_t n, const Type& init );
+
+   inline MatrixBatch( const MatrixBatch& b );
+   inline MatrixBatch( MatrixBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MatrixBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i, size_t j ) noexcept;
+   inline ConstPointer   data  ( size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MatrixBatch& operator=( const MatrixBatch& rhs );
+   inline MatrixBatch& operator=( MatrixBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline constexpr size_t rows() const noexcept;
+   inline constexpr size_t columns() const noexcept;
+   inline size_t size() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline MatrixType get( size_t k ) const;
+   template< typename MT, bool SO > inline void set( size_t k, const Matrix<MT,SO>& m );
+   inline void reset();
+   inline void clear();
+          void resize( size_t n, bool preserve=true );
+   inline void swap( MatrixBatch& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+   enum : size_t { PLANES = M*N };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t adjustCapacity( size_t minCapacity ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of matrices of the batch.
+   size_t capacity_;         //!< The number of elements of a single plane.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated planes of the batch.
+                             /*!< The plane of element \f$ (i,j) \f$ starts at index
+                                  \f$ (i*N+j)*capacity\_ \f$. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch() noexcept
+   : size_    ( 0UL )      // The current number of matrices
+   , capacity_( 0UL )      // The number of elements of a single plane
+   , v_       ( nullptr )  // The planes of the batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices. No element initialization is performed!
+//
+// \param n The number of matrices of the batch.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch( size_t n )
+   : size_    ( n )                                   // The current number of matrices
+   , capacity_( adjustCapacity( n ) )                 // The number of elements of a single plane
+   , v_       ( allocate<Type>( PLANES*capacity_ ) )  // The planes of the batch
+{
+   if( IsVectorizable<Type>::value ) {
+      for( size_t p=0UL; p<PLANES; ++p )
+         for( size_t k=size_; k<capacity_; ++k )
+            v_[p*capacity_+k] = Type();
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneously initialized batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+// \param init The initial value of all matrix elements.
+//
+// All matrix elements of all matrices of the batch are initialized with the given value.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch( size_t n, const Type& init )
+   : MatrixBatch( n )
+{
+   for( size_t p=0UL; p<PLANES; ++p )
+      std::fill( v_+p*capacity_, v_+p*capacity_+size_, init );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for MatrixBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch( const MatrixBatch& b )
+   : size_    ( b.size_ )                             // The current number of matrices
+   , capacity_( b.capacity_ )                         // The number of elements of a single plane
+   , v_       ( allocate<Type>( PLANES*capacity_ ) )  // The planes of the batch
+{
+   std::copy( b.v_, b.v_+PLANES*capacity_, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MatrixBatch.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch( MatrixBatch&& b ) noexcept
+   : size_    ( b.size_     )  // The current number of matrices
+   , capacity_( b.capacity_ )  // The number of elements of a single plane
+   , v_       ( b.v_        )  // The planes of the batch
+{
+   b.size_     = 0UL;
+   b.capacity_ = 0UL;
+   b.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::~MatrixBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements of the batch.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::Reference
+   MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[(i*N+j)*capacity_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements of the batch.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::ConstReference
+   MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[(i*N+j)*capacity_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the planes of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The plane of element
+// \f$ (i,j) \f$ starts at the offset \f$ (i*N+j)*spacing() \f$.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::Pointer MatrixBatch<Type,M,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the planes of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The plane of element
+// \f$ (i,j) \f$ starts at the offset \f$ (i*N+j)*spacing() \f$.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::ConstPointer MatrixBatch<Type,M,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to a single plane of the batch.
+//
+// \param i The row index of the plane. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the plane. The index has to be in the range \f$[0..N-1]\f$.
+// \return Pointer to the first element \f$ (i,j) \f$ of the batch.
+//
+// This function returns a pointer to the plane of element \f$ (i,j) \f$, i.e. to the element
+// \f$ (i,j) \f$ of the first matrix of the batch. The element \f$ (i,j) \f$ of the k-th matrix
+// is located at the offset \a k.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::Pointer
+   MatrixBatch<Type,M,N>::data( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N, "Invalid column access index" );
+   return v_+(i*N+j)*capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to a single plane of the batch.
+//
+// \param i The row index of the plane. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the plane. The index has to be in the range \f$[0..N-1]\f$.
+// \return Pointer to the first element \f$ (i,j) \f$ of the batch.
+//
+// This function returns a pointer to the plane of element \f$ (i,j) \f$, i.e. to the element
+// \f$ (i,j) \f$ of the first matrix of the batch. The element \f$ (i,j) \f$ of the k-th matrix
+// is located at the offset \a k.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::ConstPointer
+   MatrixBatch<Type,M,N>::data( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N, "Invalid column access index" );
+   return v_+(i*N+j)*capacity_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MatrixBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+//
+// The batch is resized according to the given batch and initialized as a copy of this batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( const MatrixBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   MatrixBatch tmp( rhs );
+   swap( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MatrixBatch.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( MatrixBatch&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the matrices of the batch.
+//
+// \return The number of rows of the matrices of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline constexpr size_t MatrixBatch<Type,M,N>::rows() const noexcept
+{
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the matrices of the batch.
+//
+// \return The number of columns of the matrices of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline constexpr size_t MatrixBatch<Type,M,N>::columns() const noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t MatrixBatch<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two planes.
+//
+// \return The spacing between the beginning of two planes.
+//
+// This function returns the spacing between the beginning of two planes, i.e. the total number
+// of elements of a plane. The spacing is a multiple of the number of elements of a SIMD vector
+// in case the element type of the batch is vectorizable.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t MatrixBatch<Type,M,N>::spacing() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the k-th matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \return Copy of the k-th matrix of the batch.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::MatrixType MatrixBatch<Type,M,N>::get( size_t k ) const
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   MatrixType m;
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         m(i,j) = v_[(i*N+j)*capacity_+k];
+
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the k-th matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param m The matrix to be assigned to the k-th matrix of the batch.
+// \return void
+// \exception std::out_of_range Invalid matrix access index.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+inline void MatrixBatch<Type,M,N>::set( size_t k, const Matrix<MT,SO>& m )
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   if( (~m).rows() != M || (~m).columns() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         v_[(i*N+j)*capacity_+k] = (~m)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void MatrixBatch<Type,M,N>::reset()
+{
+   using blaze::clear;
+
+   for( size_t p=0UL; p<PLANES; ++p )
+      for( size_t k=0UL; k<size_; ++k )
+         clear( v_[p*capacity_+k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the number of matrices of the batch is 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void MatrixBatch<Type,M,N>::clear()
+{
+   resize( 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \param preserve \a true if the old matrices of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch to \a n matrices. During this operation, new dynamic memory
+// may be allocated in case the capacity of the batch is too small. In order to preserve the old
+// matrices, the \a preserve flag can be set to \a true. However, new matrices are not
+// initialized!
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+void MatrixBatch<Type,M,N>::resize( size_t n, bool preserve )
+{
+   if( n > capacity_ )
+   {
+      // Allocating a new array
+      const size_t newCapacity( adjustCapacity( n ) );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( PLANES*newCapacity );
+
+      // Initializing the new array
+      for( size_t p=0UL; p<PLANES; ++p )
+      {
+         if( preserve ) {
+            transfer( v_+p*capacity_, v_+p*capacity_+size_, tmp+p*newCapacity );
+         }
+
+         if( IsVectorizable<Type>::value ) {
+            for( size_t k=n; k<newCapacity; ++k )
+               tmp[p*newCapacity+k] = Type();
+         }
+      }
+
+      // Replacing the old array
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newCapacity;
+   }
+   else if( IsVectorizable<Type>::value && n < size_ )
+   {
+      for( size_t p=0UL; p<PLANES; ++p )
+         for( size_t k=n; k<size_; ++k )
+            v_[p*capacity_+k] = Type();
+   }
+
+   size_ = n;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void MatrixBatch<Type,M,N>::swap( MatrixBatch& b ) noexcept
+{
+   std::swap( size_, b.size_ );
+   std::swap( capacity_, b.capacity_ );
+   std::swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the number of elements of a plane.
+//
+// \param minCapacity The minimum necessary number of elements.
+// \return The number of elements of a plane.
+//
+// In case the element type is vectorizable, the planes are padded to a multiple of the SIMD
+// width, such that batched operations don't require a scalar remainder loop.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t MatrixBatch<Type,M,N>::adjustCapacity( size_t minCapacity ) const noexcept
+{
+   if( IsVectorizable<Type>::value )
+      return nextMultiple<size_t>( minCapacity, SIMDSIZE );
+   else return minCapacity;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the batch are intact.
+//
+// \return \a true in case the batch's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the batch are intact, i.e. if its state is
+// valid. In case the invariants are intact, the function returns \a true, else it will return
+// \a false.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline bool MatrixBatch<Type,M,N>::isIntact() const noexcept
+{
+   if( size_ > capacity_ )
+      return false;
+
+   if( IsNumeric<Type>::value ) {
+      for( size_t p=0UL; p<PLANES; ++p )
+         for( size_t k=size_; k<capacity_; ++k )
+            if( v_[p*capacity_+k] != Type() )
+               return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIXBATCH OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( MatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void clear( MatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline bool isIntact( const MatrixBatch<Type,M,N>& b ) noexcept;
+
+template< typename Type, size_t M, size_t N >
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup matrix_batch
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void reset( MatrixBatch<Type,M,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch.
+// \ingroup matrix_batch
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void clear( MatrixBatch<Type,M,N>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given batch are intact.
+// \ingroup matrix_batch
+//
+// \param b The batch to be tested.
+// \return \a true in case the given batch's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline bool isIntact( const MatrixBatch<Type,M,N>& b ) noexcept
+{
+   return b.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup matrix_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,349 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedIterator.h
+//  \brief Header file for the PackedIterator class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDITERATOR_H_
+#define _BLAZE_MATH_DENSE_PACKEDITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/Aliases.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a generic iterator for packed matrices.
+// \ingroup packed_matrix
+//
+// The PackedIterator represents a generic random access iterator over the rows (in case of a
+// row-major matrix) or columns (in case of a column-major matrix) of a PackedMatrix. Since the
+// elements of a packed matrix are not stored contiguously per row or column, the iterator is
+// index-based and accesses the elements via the function call operator of the matrix. In case
+// of a non-const packed matrix the iterator therefore returns the same reference type as the
+// matrix itself.
+*/
+template< typename MT  // Type of the packed matrix
+        , bool SO >    // Storage order
+class PackedIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef ElementType_<MT>                 ValueType;         //!< Type of the underlying elements.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   //! Reference return type.
+   typedef If_< IsConst<MT>
+              , ConstReference_< RemoveConst_<MT> >
+              , Reference_<MT> >  ReferenceType;
+
+   typedef ReferenceType  PointerType;  //!< Pointer return type.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Default constructor of the PackedIterator class.
+   */
+   inline PackedIterator() noexcept
+      : matrix_( nullptr )  // Pointer to the packed matrix
+      , row_   ( 0UL )      // The current row index of the iterator
+      , column_( 0UL )      // The current column index of the iterator
+   {}
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Constructor for the PackedIterator class.
+   //
+   // \param matrix The packed matrix.
+   // \param row Initial row index of the iterator.
+   // \param column Initial column index of the iterator.
+   */
+   inline PackedIterator( MT& matrix, size_t row, size_t column ) noexcept
+      : matrix_( &matrix )  // Pointer to the packed matrix
+      , row_   ( row     )  // The current row index of the iterator
+      , column_( column  )  // The current column index of the iterator
+   {}
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Conversion constructor from different PackedIterator instances.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< typename MT2 >
+   inline PackedIterator( const PackedIterator<MT2,SO>& it ) noexcept
+      : matrix_( it.matrix_ )  // Pointer to the packed matrix
+      , row_   ( it.row_    )  // The current row index of the iterator
+      , column_( it.column_ )  // The current column index of the iterator
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return The incremented iterator.
+   */
+   inline PackedIterator& operator+=( size_t inc ) noexcept {
+      ( SO )?( row_ += inc ):( column_ += inc );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return The decremented iterator.
+   */
+   inline PackedIterator& operator-=( size_t dec ) noexcept {
+      ( SO )?( row_ -= dec ):( column_ -= dec );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline PackedIterator& operator++() noexcept {
+      ( SO )?( ++row_ ):( ++column_ );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const PackedIterator operator++( int ) noexcept {
+      const PackedIterator tmp( *this );
+      ++(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline PackedIterator& operator--() noexcept {
+      ( SO )?( --row_ ):( --column_ );
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const PackedIterator operator--( int ) noexcept {
+      const PackedIterator tmp( *this );
+      --(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return The resulting value.
+   */
+   inline ReferenceType operator*() const {
+      return (*matrix_)(row_,column_);
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two PackedIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   friend inline bool operator==( const PackedIterator& lhs, const PackedIterator& rhs ) noexcept {
+      return ( SO )?( lhs.row_ == rhs.row_ ):( lhs.column_ == rhs.column_ );
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two PackedIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   friend inline bool operator!=( const PackedIterator& lhs, const PackedIterator& rhs ) noexcept {
+      return !( lhs == rhs );
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two PackedIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   friend inline bool operator<( const PackedIterator& lhs, const PackedIterator& rhs ) noexcept {
+      return ( SO )?( lhs.row_ < rhs.row_ ):( lhs.column_ < rhs.column_ );
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two PackedIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   friend inline bool operator>( const PackedIterator& lhs, const PackedIterator& rhs ) noexcept {
+      return rhs < lhs;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two PackedIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   friend inline bool operator<=( const PackedIterator& lhs, const PackedIterator& rhs ) noexcept {
+      return !( rhs < lhs );
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two PackedIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   friend inline bool operator>=( const PackedIterator& lhs, const PackedIterator& rhs ) noexcept {
+      return !( lhs < rhs );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   inline DifferenceType operator-( const PackedIterator& rhs ) const noexcept {
+      return ( SO )?( row_ - rhs.row_ ):( column_ - rhs.column_ );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a PackedIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const PackedIterator operator+( const PackedIterator& it, size_t inc ) noexcept {
+      PackedIterator tmp( it );
+      return tmp += inc;
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a PackedIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const PackedIterator operator+( size_t inc, const PackedIterator& it ) noexcept {
+      PackedIterator tmp( it );
+      return tmp += inc;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a PackedIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const PackedIterator operator-( const PackedIterator& it, size_t dec ) noexcept {
+      PackedIterator tmp( it );
+      return tmp -= dec;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MT*    matrix_;  //!< Pointer to the packed matrix.
+   size_t row_;     //!< The current row index of the iterator.
+   size_t column_;  //!< The current column index of the iterator.
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< typename MT2, bool SO2 > friend class PackedIterator;
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
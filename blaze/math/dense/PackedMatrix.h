@@ -0,0 +1,2606 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of a packed storage matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/adaptors/diagonalmatrix/BaseTemplate.h>
+#include <blaze/math/adaptors/hermitianmatrix/BaseTemplate.h>
+#include <blaze/math/adaptors/lowermatrix/BaseTemplate.h>
+#include <blaze/math/adaptors/symmetricmatrix/BaseTemplate.h>
+#include <blaze/math/adaptors/uppermatrix/BaseTemplate.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedIterator.h>
+#include <blaze/math/dense/PackedProxy.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/PackedFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a structured \f$ N \times N \f$ matrix in packed storage.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template is the representation of a square symmetric, Hermitian, lower,
+// upper, or diagonal matrix that only stores the elements that cannot be deduced from the matrix
+// structure. In contrast to the SymmetricMatrix, HermitianMatrix, LowerMatrix, UpperMatrix, and
+// DiagonalMatrix adaptors, which are based on a full \f$ N \times N \f$ matrix, a PackedMatrix
+// requires only \f$ N(N+1)/2 \f$ elements (or \f$ N \f$ elements in case of a diagonal matrix).
+// The type of the elements, the kind of structure, and the storage order of the matrix can be
+// specified via the three template parameters:
+
+   \code
+   template< typename Type, PackedFlag PF, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - PF  : specifies the structure of the matrix (blaze::packedSymmetric, blaze::packedHermitian,
+//          blaze::packedLower, blaze::packedUpper, or blaze::packedDiagonal).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The stored elements of each row (in case of a row-major matrix) or each column (in case of a
+// column-major matrix) are arranged contiguously and the rows/columns are stored one after the
+// other. Symmetric and Hermitian matrices store the lower part in case of a row-major matrix and
+// the upper part in case of a column-major matrix. Thus the column-major layouts are identical
+// to the packed formats of LAPACK: symmetric, Hermitian, and upper matrices correspond to the
+// \c 'U' format and lower matrices correspond to the \c 'L' format.
+//
+// Externally a PackedMatrix behaves like any other dense matrix. Non-stored elements of a
+// symmetric matrix refer to the stored counterpart, non-stored elements of a Hermitian matrix
+// represent the complex conjugate of the stored counterpart, and non-stored elements of lower,
+// upper, and diagonal matrices are restricted to zero. As the adaptors, the packed matrix
+// guarantees that its structure is never violated: Assigning a non-zero value to a restricted
+// element or assigning a matrix that does not fulfill the structural requirements results in a
+// \a std::invalid_argument exception. The result type of all operations is the corresponding
+// adaptor of a DynamicMatrix. The multiplications with a dense vector are evaluated by dedicated
+// kernels that traverse the packed storage contiguously:
+
+   \code
+   using blaze::DynamicVector;
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::columnMajor;
+
+   PackedMatrix<double,packedSymmetric,columnMajor> A( 3UL );
+
+   A(0,0) = 2.0;  //        ( 2 1 0 )
+   A(0,1) = 1.0;  // => A = ( 1 2 1 )
+   A(1,1) = 2.0;  //        ( 0 1 2 )
+   A(2,1) = 1.0;
+   A(2,2) = 2.0;
+
+   PackedMatrix<double,packedLower> L{ { 1.0 }, { 2.0, 3.0 } };
+
+   L(0,1) = 4.0;  // Invalid assignment to restricted element; results in an exception!
+
+   DynamicVector<double> x( 3UL, 1.0 ), y;
+   y = A * x;  // Packed symmetric matrix/dense vector multiplication
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , PackedFlag PF                    // Packed storage flag
+        , bool SO = defaultStorageOrder >  // Storage order
+class PackedMatrix : public DenseMatrix< PackedMatrix<Type,PF,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Adaptor type corresponding to the packed storage flag.
+   template< typename MT, PackedFlag PF2 >
+   struct Adapt {
+      typedef IfTrue_< PF2 == packedSymmetric, SymmetricMatrix<MT>
+            , IfTrue_< PF2 == packedHermitian, HermitianMatrix<MT>
+            , IfTrue_< PF2 == packedLower    , LowerMatrix<MT>
+            , IfTrue_< PF2 == packedUpper    , UpperMatrix<MT>
+            , DiagonalMatrix<MT> > > > >  AdaptorType;
+   };
+
+   //! Packed storage flag of the transpose matrix.
+   enum : int { transposeFlag = ( PF == packedLower )?( packedUpper )
+                              :( ( PF == packedUpper )?( packedLower ):( PF ) ) };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef PackedMatrix<Type,PF,SO>  This;      //!< Type of this PackedMatrix instance.
+   typedef DenseMatrix<This,SO>      BaseType;  //!< Base type of this PackedMatrix instance.
+
+   //! Result type for expression template evaluations.
+   typedef typename Adapt< DynamicMatrix<Type,SO>, PF >::AdaptorType  ResultType;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   typedef typename Adapt< DynamicMatrix<Type,!SO>, PF >::AdaptorType  OppositeType;
+
+   //! Transpose type for expression template evaluations.
+   typedef typename Adapt< DynamicMatrix<Type,!SO>, static_cast<PackedFlag>( transposeFlag ) >::AdaptorType  TransposeType;
+
+   typedef Type         ElementType;    //!< Type of the matrix elements.
+   typedef const This&  CompositeType;  //!< Data type for composite expression templates.
+
+   //! Return type for expression template evaluations.
+   typedef IfTrue_< PF == packedHermitian, const Type, const Type& >  ReturnType;
+
+   //! Reference to a non-constant matrix value.
+   typedef IfTrue_< PF == packedSymmetric, Type&, PackedProxy<This> >  Reference;
+
+   //! Reference to a constant matrix value.
+   typedef IfTrue_< PF == packedHermitian, const Type, const Type& >  ConstReference;
+
+   typedef Type*        Pointer;       //!< Pointer to a non-constant matrix value.
+   typedef const Type*  ConstPointer;  //!< Pointer to a constant matrix value.
+
+   typedef PackedIterator<This,SO>        Iterator;       //!< Iterator over non-constant elements.
+   typedef PackedIterator<const This,SO>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef PackedMatrix<ET,PF,SO>  Other;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements of a packed matrix are not
+       stored in a regular pattern, the \a simdEnabled flag is always set to 0. */
+   enum : bool { simdEnabled = false };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the partitioning of the packed storage does not match the block
+       partitioning of the SMP assignments, the \a smpAssignable flag is always set to 0. */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix() noexcept;
+   explicit inline PackedMatrix( size_t n );
+   explicit inline PackedMatrix( size_t n, const Type& init );
+   explicit inline PackedMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline PackedMatrix( const PackedMatrix& m );
+   inline PackedMatrix( PackedMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO2 > inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedMatrix& operator=( const Type& rhs );
+   inline PackedMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   inline PackedMatrix& operator=( const PackedMatrix& rhs );
+   inline PackedMatrix& operator=( PackedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, PackedMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, PackedMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t n, bool preserve=true );
+   inline void   extend ( size_t n, bool preserve=true );
+   inline void   reserve( size_t elements );
+   inline void   swap( PackedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline Pointer      data   () noexcept;
+   inline ConstPointer data   () const noexcept;
+   inline Pointer      data   ( size_t k ) noexcept;
+   inline ConstPointer data   ( size_t k ) const noexcept;
+   inline size_t       spacing() const noexcept;
+   inline size_t       lineBegin ( size_t k ) const noexcept;
+   inline size_t       lineEnd   ( size_t k ) const noexcept;
+   inline size_t       lineOffset( size_t k ) const noexcept;
+   inline bool         isStored  ( size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void assign   ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Compile time check for matrix types that fulfill the structure of the packed matrix.
+   template< typename MT >
+   struct IsStructured {
+      enum : bool { value = ( PF == packedSymmetric && IsSymmetric<MT>::value ) ||
+                            ( PF == packedHermitian && IsHermitian<MT>::value ) ||
+                            ( PF == packedLower     && IsLower<MT>::value     ) ||
+                            ( PF == packedUpper     && IsUpper<MT>::value     ) ||
+                            ( PF == packedDiagonal  && IsDiagonal<MT>::value  ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Layout of the stored elements of a single row/column.
+   /*! Lines with \a leading layout store the elements \f$ [0..k] \f$ of the \a k-th row/column,
+       lines with \a trailing layout store the elements \f$ [k..N) \f$. Diagonal matrices store
+       a single element per row/column. */
+   enum : bool { leading  = PF == packedSymmetric || PF == packedHermitian ||
+                            ( PF == packedLower && !SO ) || ( PF == packedUpper && SO ) };
+   enum : bool { trailing = ( PF == packedLower && SO ) || ( PF == packedUpper && !SO ) };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Pointer        address  ( size_t i, size_t j ) noexcept;
+   inline size_t         index    ( size_t i, size_t j ) const noexcept;
+   inline Reference      reference( size_t i, size_t j, TrueType  ) noexcept;
+   inline Reference      reference( size_t i, size_t j, FalseType );
+   inline ConstReference mirror   ( size_t i, size_t j, TrueType  ) const;
+   inline ConstReference mirror   ( size_t i, size_t j, FalseType ) const;
+
+   template< typename MT >
+   static inline bool isStructured( const MT& m );
+
+   static inline size_t storageSize( size_t n ) noexcept;
+   static inline size_t lineOffset ( size_t k, size_t n ) noexcept;
+   static inline size_t lineEnd    ( size_t k, size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;         //!< The current number of rows and columns of the matrix.
+   size_t capacity_;  //!< The maximum capacity of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The stored elements of the matrix.
+                             /*!< Access to the matrix elements is gained via the function call
+                                  operator. The arrangement of the stored elements is described
+                                  in the class documentation. */
+
+   static const Type zero_;  //!< Neutral element for accesses to restricted elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class PackedProxy<This>;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, PackedFlag PF, bool SO >
+const Type PackedMatrix<Type,PF,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix() noexcept
+   : n_       ( 0UL )      // The current number of rows and columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The stored elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All matrix elements are initialized to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( size_t n )
+   : n_       ( n )                                // The current number of rows and columns of the matrix
+   , capacity_( storageSize( n ) )                 // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )      // The stored elements of the matrix
+{
+   if( IsBuiltin<Type>::value ) {
+      std::fill( v_, v_+capacity_, Type() );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all stored \f$ N \times N \f$ matrix
+//        elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the stored matrix elements.
+// \exception std::invalid_argument Invalid setup of Hermitian packed matrix.
+//
+// All stored matrix elements are initialized with the specified value, all restricted elements
+// of a lower, upper, or diagonal matrix are zero. In case of a Hermitian matrix the given value
+// has to be real, otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( size_t n, const Type& init )
+   : PackedMatrix( n )  // Delegating to the size constructor
+{
+   if( PF == packedHermitian && !isReal( init ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of Hermitian packed matrix" );
+   }
+
+   std::fill( v_, v_+capacity_, init );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::PackedMatrix<int,blaze::packedLower,rowMajor> A{ { 1 },
+                                                           { 2, 3 },
+                                                           { 4, 5, 6 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are initialized as
+// default. In case the size of the top-level initializer list does not match the size of the
+// nested lists or in case the given values do not fulfill the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( initializer_list< initializer_list<Type> > list )
+   : PackedMatrix()  // Delegating to the default constructor
+{
+   *this = list;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_ )                          // The current number of rows and columns of the matrix
+   , capacity_( storageSize( m.n_ ) )           // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )   // The stored elements of the matrix
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PackedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( PackedMatrix&& m ) noexcept
+   : n_       ( m.n_        )  // The current number of rows and columns of the matrix
+   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
+   , v_       ( m.v_        )  // The stored elements of the matrix
+{
+   m.n_        = 0UL;
+   m.capacity_ = 0UL;
+   m.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// In case the given matrix is not square or does not fulfill the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline PackedMatrix<Type,PF,SO>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : PackedMatrix()  // Delegating to the default constructor
+{
+   *this = ~m;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// In case of a symmetric matrix the function returns a reference to the stored element, in all
+// other cases it returns a PackedProxy that protects the structure of the matrix. Note that this
+// function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast, the
+// at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Reference
+   PackedMatrix<Type,PF,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return reference( i, j, BoolConstant< PF == packedSymmetric >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// Note that this function only performs an index check in case BLAZE_USER_ASSERT() is active.
+// In contrast, the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstReference
+   PackedMatrix<Type,PF,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return v_[index(i,j)];
+   else
+      return mirror( i, j, BoolConstant< PF == packedHermitian >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Reference
+   PackedMatrix<Type,PF,SO>::at( size_t i, size_t j )
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstReference
+   PackedMatrix<Type,PF,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Iterator
+   PackedMatrix<Type,PF,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( Iterator( *this, 0UL, i ) ):( Iterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, 0UL, i ) ):( ConstIterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Iterator
+   PackedMatrix<Type,PF,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( Iterator( *this, n_, i ) ):( Iterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, n_, i ) ):( ConstIterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns a row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstIterator
+   PackedMatrix<Type,PF,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all stored matrix elements.
+//
+// \param rhs Scalar value to be assigned to all stored matrix elements.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to Hermitian packed matrix.
+//
+// In case of a Hermitian matrix the given value has to be real, otherwise a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( const Type& rhs )
+{
+   if( PF == packedHermitian && !isReal( rhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to Hermitian packed matrix" );
+   }
+
+   std::fill( v_, v_+storageSize( n_ ), rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::PackedMatrix<int,blaze::packedSymmetric,rowMajor> A;
+   A = { { 1, 2, 3 },
+         { 2, 4, 5 },
+         { 3, 5, 6 } };
+   \endcode
+
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are initialized as
+// default. In case the size of the top-level initializer list does not match the size of the
+// nested lists or in case the given values do not fulfill the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>&
+   PackedMatrix<Type,PF,SO>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   const DynamicMatrix<Type,SO> tmp( list );
+
+   if( tmp.rows() != list.size() || tmp.columns() > list.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   DynamicMatrix<Type,SO> square( list.size(), list.size(), Type() );
+   submatrix( square, 0UL, 0UL, tmp.rows(), tmp.columns() ) = tmp;
+
+   return *this = square;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+storageSize( n_ ), v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PackedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( PackedMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the given matrix is not square or does not fulfill the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown. The structure is checked at compile time if
+// possible and at runtime otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   if( IsStructured<MT>::value && !(~rhs).canAlias( this ) ) {
+      CompositeType_<MT> tmp( ~rhs );
+      resize( tmp.rows(), false );
+      assign( tmp );
+   }
+   else {
+      const ResultType_<MT> tmp( ~rhs );
+
+      if( !IsStructured<MT>::value && !isStructured( tmp ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+      }
+
+      resize( tmp.rows(), false );
+      assign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix does
+// not fulfill the structure of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( IsStructured<MT>::value && !(~rhs).canAlias( this ) ) {
+      CompositeType_<MT> tmp( ~rhs );
+      addAssign( tmp );
+   }
+   else {
+      const ResultType_<MT> tmp( ~rhs );
+
+      if( !IsStructured<MT>::value && !isStructured( tmp ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+      }
+
+      addAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix does
+// not fulfill the structure of the packed matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( IsStructured<MT>::value && !(~rhs).canAlias( this ) ) {
+      CompositeType_<MT> tmp( ~rhs );
+      subAssign( tmp );
+   }
+   else {
+      const ResultType_<MT> tmp( ~rhs );
+
+      if( !IsStructured<MT>::value && !isStructured( tmp ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+      }
+
+      subAssign( tmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the result of the
+// multiplication does not fulfill the structure of the packed matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PF,SO>& PackedMatrix<Type,PF,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const DynamicMatrix<Type,SO> tmp( *this * ~rhs );
+
+   if( !isStructured( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix" );
+   }
+
+   assign( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedFlag PF     // Packed storage flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, PackedMatrix<Type,PF,SO> >&
+   PackedMatrix<Type,PF,SO>::operator*=( Other rhs )
+{
+   const size_t size( storageSize( n_ ) );
+
+   for( size_t i=0UL; i<size; ++i )
+      v_[i] *= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedFlag PF     // Packed storage flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, PackedMatrix<Type,PF,SO> >&
+   PackedMatrix<Type,PF,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   const size_t size( storageSize( n_ ) );
+
+   for( size_t i=0UL; i<size; ++i )
+      v_[i] /= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// The capacity of a packed matrix corresponds to the maximum number of stored elements.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the matrix.
+//
+// Note that in case of a symmetric or Hermitian matrix each stored non-zero element in the
+// off-diagonal part is counted twice.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t begin( lineBegin( k ) );
+      const size_t end  ( lineEnd( k ) );
+      const Type*  v    ( v_ + lineOffset( k ) );
+      for( size_t l=begin; l<end; ++l, ++v ) {
+         if( !isDefault( *v ) )
+            nonzeros += ( PF <= packedHermitian && l != k )?( 2UL ):( 1UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      if( !isDefault( ( SO )?( (*this)(l,i) ):( (*this)(i,l) ) ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PF,SO>::reset()
+{
+   using blaze::clear;
+
+   const size_t size( storageSize( n_ ) );
+
+   for( size_t i=0UL; i<size; ++i )
+      clear( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to reset.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that in case of a symmetric or Hermitian matrix also the corresponding column/row is
+// reset.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PF,SO>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      Type* const v( ( SO )?( address( l, i ) ):( address( i, l ) ) );
+      if( v != nullptr )
+         clear( *v );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PF,SO>::clear()
+{
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. In contrast to the other dense matrix
+// types, all new and, in case \a preserve is \a false, all old elements are default initialized
+// in order to guarantee the structure of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+void PackedMatrix<Type,PF,SO>::resize( size_t n, bool preserve )
+{
+   if( n == n_ ) return;
+
+   const size_t oldSize( storageSize( n_ ) );
+   const size_t newSize( storageSize( n  ) );
+
+   if( !preserve ) {
+      if( newSize > capacity_ ) {
+         Type* BLAZE_RESTRICT v = allocate<Type>( newSize );
+         std::swap( v_, v );
+         deallocate( v );
+         capacity_ = newSize;
+      }
+      std::fill( v_, v_+newSize, Type() );
+   }
+   else if( !trailing && newSize <= capacity_ ) {
+      if( newSize > oldSize )
+         std::fill( v_+oldSize, v_+newSize, Type() );
+   }
+   else {
+      Type* BLAZE_RESTRICT v = allocate<Type>( std::max( newSize, capacity_ ) );
+      std::fill( v, v+newSize, Type() );
+
+      const size_t lines( std::min( n, n_ ) );
+      for( size_t k=0UL; k<lines; ++k ) {
+         const size_t begin( lineBegin( k ) );
+         const size_t end  ( std::min( lineEnd( k, n_ ), lineEnd( k, n ) ) );
+         std::copy( v_ + lineOffset( k, n_ ), v_ + lineOffset( k, n_ ) + ( end - begin ),
+                    v  + lineOffset( k, n  ) );
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = std::max( newSize, capacity_ );
+   }
+
+   n_ = n;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extending the size of the matrix.
+//
+// \param n Number of additional rows and columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function increases the matrix size by \a n rows and \a n columns. During this operation,
+// new dynamic memory may be allocated in case the capacity of the matrix is too small. All new
+// elements are default initialized.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PF,SO>::extend( size_t n, bool preserve )
+{
+   resize( n_+n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the matrix.
+// \return void
+//
+// This function increases the capacity of the matrix to at least \a elements stored elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PF,SO>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      // Allocating a new array
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+
+      // Initializing the new array
+      std::copy( v_, v_+storageSize( n_ ), tmp );
+
+      if( IsBuiltin<Type>::value ) {
+         std::fill( tmp+storageSize( n_ ), tmp+elements, Type() );
+      }
+
+      // Replacing the old array
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void PackedMatrix<Type,PF,SO>::swap( PackedMatrix& m ) noexcept
+{
+   std::swap( n_       , m.n_        );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_       , m.v_        );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the stored counterpart of the specified element.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Pointer to the stored element or \a nullptr in case of a restricted element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Pointer
+   PackedMatrix<Type,PF,SO>::address( size_t i, size_t j ) noexcept
+{
+   if( isStored( i, j ) )
+      return v_ + index( i, j );
+   else if( PF <= packedHermitian )
+      return v_ + index( j, i );
+   else
+      return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the specified stored element in the packed storage.
+//
+// \param i The row index of the stored element.
+// \param j The column index of the stored element.
+// \return The position of the element in the packed storage.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Access to non-stored element" );
+
+   const size_t k( ( SO )?( j ):( i ) );
+   const size_t l( ( SO )?( i ):( j ) );
+
+   return lineOffset( k ) + l - lineBegin( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Write access to an element of a symmetric matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Reference to the stored counterpart of the element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Reference
+   PackedMatrix<Type,PF,SO>::reference( size_t i, size_t j, TrueType ) noexcept
+{
+   return *address( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Write access to an element of a Hermitian, lower, upper, or diagonal matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Proxy to the accessed element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Reference
+   PackedMatrix<Type,PF,SO>::reference( size_t i, size_t j, FalseType )
+{
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Read access to a non-stored element of a Hermitian matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The complex conjugate of the stored counterpart.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstReference
+   PackedMatrix<Type,PF,SO>::mirror( size_t i, size_t j, TrueType ) const
+{
+   return conj( v_[index(j,i)] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Read access to a non-stored element of a symmetric, lower, upper, or diagonal matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Reference to the stored counterpart or to a zero element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstReference
+   PackedMatrix<Type,PF,SO>::mirror( size_t i, size_t j, FalseType ) const
+{
+   if( PF == packedSymmetric )
+      return v_[index(j,i)];
+   else
+      return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given matrix fulfills the structure of the packed matrix.
+//
+// \param m The matrix to be checked.
+// \return \a true if the matrix fulfills the structure, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the matrix
+inline bool PackedMatrix<Type,PF,SO>::isStructured( const MT& m )
+{
+   switch( PF ) {
+      case packedSymmetric: return isSymmetric( m );
+      case packedHermitian: return isHermitian( m );
+      case packedLower    : return isLower( m );
+      case packedUpper    : return isUpper( m );
+      default             : return isDiagonal( m );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the number of stored elements of a \f$ N \times N \f$ matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The number of stored elements.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::storageSize( size_t n ) noexcept
+{
+   return ( PF == packedDiagonal )?( n ):( n*(n+1UL)/2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the offset of the stored elements of row/column \a k.
+//
+// \param k The index of the row/column.
+// \param n The number of rows and columns of the matrix.
+// \return The offset of the first stored element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::lineOffset( size_t k, size_t n ) noexcept
+{
+   if( leading )
+      return k*(k+1UL)/2UL;
+   else if( trailing )
+      return k*(2UL*n-k+1UL)/2UL;
+   else
+      return k;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the end of the stored elements of row/column \a k.
+//
+// \param k The index of the row/column.
+// \param n The number of rows and columns of the matrix.
+// \return The index one past the last stored element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::lineEnd( size_t k, size_t n ) noexcept
+{
+   return ( trailing )?( n ):( k+1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal packed storage of the matrix. Note that in
+// contrast to the other dense matrices the element \f$ a_{ij} \f$ can NOT be accessed via
+// \a data() + i*spacing() + j! The stored elements of row/column \a k start at data( k ) and
+// cover the indices from lineBegin() to lineEnd().
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Pointer
+   PackedMatrix<Type,PF,SO>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal packed storage of the matrix. Note that in
+// contrast to the other dense matrices the element \f$ a_{ij} \f$ can NOT be accessed via
+// \a data() + i*spacing() + j! The stored elements of row/column \a k start at data( k ) and
+// cover the indices from lineBegin() to lineEnd().
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstPointer
+   PackedMatrix<Type,PF,SO>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a k.
+//
+// \param k The row/column index.
+// \return Pointer to the first stored element of row/column \a k.
+//
+// This function returns a pointer to the first stored element of row/column \a k, i.e. to the
+// element with the column/row index lineBegin( k ). The stored elements of the row/column lie
+// adjacent to each other up to lineEnd( k ).
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::Pointer
+   PackedMatrix<Type,PF,SO>::data( size_t k ) noexcept
+{
+   BLAZE_USER_ASSERT( k < n_, "Invalid dense matrix row/column access index" );
+   return v_ + lineOffset( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of row/column \a k.
+//
+// \param k The row/column index.
+// \return Pointer to the first stored element of row/column \a k.
+//
+// This function returns a pointer to the first stored element of row/column \a k, i.e. to the
+// element with the column/row index lineBegin( k ). The stored elements of the row/column lie
+// adjacent to each other up to lineEnd( k ).
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline typename PackedMatrix<Type,PF,SO>::ConstPointer
+   PackedMatrix<Type,PF,SO>::data( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < n_, "Invalid dense matrix row/column access index" );
+   return v_ + lineOffset( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// Due to the packed storage the rows/columns of the matrix are not strided. For compatibility
+// with the other dense matrices this function returns the number of rows/columns of the matrix.
+// Use data( k ) to access the stored elements of a specific row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::spacing() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first stored element of row/column \a k.
+//
+// \param k The index of the row/column.
+// \return The column/row index of the first stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::lineBegin( size_t k ) const noexcept
+{
+   return ( leading )?( 0UL ):( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last stored element of row/column \a k.
+//
+// \param k The index of the row/column.
+// \return The column/row index one past the last stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::lineEnd( size_t k ) const noexcept
+{
+   return lineEnd( k, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the stored elements of row/column \a k in the packed storage.
+//
+// \param k The index of the row/column.
+// \return The offset of the first stored element of row/column \a k.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline size_t PackedMatrix<Type,PF,SO>::lineOffset( size_t k ) const noexcept
+{
+   return lineOffset( k, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the specified element is explicitly stored.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true if the element is stored, \a false if it is mirrored or restricted.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,PF,SO>::isStored( size_t i, size_t j ) const noexcept
+{
+   const size_t k( ( SO )?( j ):( i ) );
+   const size_t l( ( SO )?( i ):( j ) );
+
+   return lineBegin( k ) <= l && l < lineEnd( k );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the packed matrix are intact.
+//
+// \return \a true in case the packed matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the packed matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,PF,SO>::isIntact() const noexcept
+{
+   if( storageSize( n_ ) > capacity_ )
+      return false;
+
+   if( PF == packedHermitian ) {
+      for( size_t k=0UL; k<n_; ++k ) {
+         if( !isReal( v_[index(k,k)] ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedFlag PF     // Packed storage flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PF,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , PackedFlag PF     // Packed storage flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<Type,PF,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// Since the rows/columns of a packed matrix don't start at aligned addresses, the function
+// always returns \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,PF,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Packed matrices are always assigned serially, therefore the function always returns
+// \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline bool PackedMatrix<Type,PF,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the stored elements are assigned, i.e. the right-hand
+// side matrix is assumed to fulfill the structure of the packed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PF,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t end( lineEnd( k ) );
+      Type* v( v_ + lineOffset( k ) );
+      for( size_t l=lineBegin( k ); l<end; ++l, ++v ) {
+         *v = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the stored elements are assigned, i.e. the right-hand
+// side matrix is assumed to fulfill the structure of the packed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PF,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   reset();
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( isStored( i, j ) )
+            v_[index(i,j)] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the stored elements are updated, i.e. the right-hand
+// side matrix is assumed to fulfill the structure of the packed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PF,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t end( lineEnd( k ) );
+      Type* v( v_ + lineOffset( k ) );
+      for( size_t l=lineBegin( k ); l<end; ++l, ++v ) {
+         *v += ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the stored elements are updated, i.e. the right-hand
+// side matrix is assumed to fulfill the structure of the packed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PF,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( isStored( i, j ) )
+            v_[index(i,j)] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the stored elements are updated, i.e. the right-hand
+// side matrix is assumed to fulfill the structure of the packed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PF,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t end( lineEnd( k ) );
+      Type* v( v_ + lineOffset( k ) );
+      for( size_t l=lineBegin( k ); l<end; ++l, ++v ) {
+         *v -= ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator. Note that only the stored elements are updated, i.e. the right-hand
+// side matrix is assumed to fulfill the structure of the packed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PF,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( ConstIterator_<MT> element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( ( SO2 )?( element->index() ):( k ) );
+         const size_t j( ( SO2 )?( k ):( element->index() ) );
+         if( isStored( i, j ) )
+            v_[index(i,j)] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, PackedFlag PF, bool SO >
+inline void reset( PackedMatrix<Type,PF,SO>& m );
+
+template< typename Type, PackedFlag PF, bool SO >
+inline void reset( PackedMatrix<Type,PF,SO>& m, size_t i );
+
+template< typename Type, PackedFlag PF, bool SO >
+inline void clear( PackedMatrix<Type,PF,SO>& m );
+
+template< typename Type, PackedFlag PF, bool SO >
+inline bool isDefault( const PackedMatrix<Type,PF,SO>& m );
+
+template< typename Type, PackedFlag PF, bool SO >
+inline bool isIntact( const PackedMatrix<Type,PF,SO>& m ) noexcept;
+
+template< typename Type, PackedFlag PF, bool SO >
+inline void swap( PackedMatrix<Type,PF,SO>& a, PackedMatrix<Type,PF,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void reset( PackedMatrix<Type,PF,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row/column of the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given packed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void reset( PackedMatrix<Type,PF,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void clear( PackedMatrix<Type,PF,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the packed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline bool isDefault( const PackedMatrix<Type,PF,SO>& m )
+{
+   return ( m.rows() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given packed matrix are intact.
+// \ingroup packed_matrix
+//
+// \param m The packed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the packed matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline bool isIntact( const PackedMatrix<Type,PF,SO>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , PackedFlag PF  // Packed storage flag
+        , bool SO >      // Storage order
+inline void swap( PackedMatrix<Type,PF,SO>& a, PackedMatrix<Type,PF,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct IsSquare< PackedMatrix<T,PF,SO> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct IsSymmetric< PackedMatrix<T,PF,SO> >
+   : public BoolConstant< PF == packedSymmetric || PF == packedDiagonal ||
+                          ( PF == packedHermitian && IsBuiltin<T>::value ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHERMITIAN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct IsHermitian< PackedMatrix<T,PF,SO> >
+   : public BoolConstant< PF == packedHermitian ||
+                          ( ( PF == packedSymmetric || PF == packedDiagonal ) && IsBuiltin<T>::value ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct IsLower< PackedMatrix<T,PF,SO> >
+   : public BoolConstant< PF == packedLower || PF == packedDiagonal >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct IsUpper< PackedMatrix<T,PF,SO> >
+   : public BoolConstant< PF == packedUpper || PF == packedDiagonal >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESTRICTED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct IsRestricted< PackedMatrix<T,PF,SO> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct IsResizable< PackedMatrix<T,PF,SO> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct SubmatrixTrait< PackedMatrix<T,PF,SO> >
+{
+   using Type = DynamicMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct RowTrait< PackedMatrix<T,PF,SO> >
+{
+   using Type = DynamicVector<T,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedFlag PF, bool SO >
+struct ColumnTrait< PackedMatrix<T,PF,SO> >
+{
+   using Type = DynamicVector<T,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
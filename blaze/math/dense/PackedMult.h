@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMult.h
+//  \brief Header file for the packed matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMULT_H_
+#define _BLAZE_MATH_DENSE_PACKEDMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/PackedFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the PackedMatrix/dense vector multiplication kernels.
+// \ingroup packed_matrix
+//
+// In case the combination of the target vector, the PackedMatrix and the right-hand side vector
+// is suited for a vectorized multiplication kernel, the nested \a value will be set to 1,
+// otherwise it will be 0. Note that both vectors are required to provide contiguous low-level
+// data access and that Hermitian matrices of complex elements are always handled by the default
+// kernel.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the PackedMatrix
+        , PackedFlag PF  // Packed storage flag of the PackedMatrix
+        , typename VT2 > // Type of the right-hand side vector
+struct UseVectorizedPackedKernel
+   : public And< Bool< useOptimizedKernels >
+               , HasMutableDataAccess<VT1>
+               , HasConstDataAccess<VT2>
+               , Bool< VT1::simdEnabled && VT2::simdEnabled >
+               , IsSame< ElementType_<VT1>, Type >
+               , IsSame< ElementType_<VT2>, Type >
+               , HasSIMDAdd<Type,Type>
+               , HasSIMDMult<Type,Type>
+               , Bool< PF != packedHermitian || !IsComplex<Type>::value > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a PackedMatrix with a dense vector.
+// \ingroup packed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The PackedMatrix.
+// \param x The right-hand side dense vector.
+// \param scalar The scaling factor of the product.
+// \return void
+//
+// This kernel adds the scaled product of the given PackedMatrix and the dense vector \a x to
+// the target vector \a y. In case \a RF is set to \a true, each packed row/column of the matrix
+// is reduced by a dot product with \a x (i.e. \f$ \vec{y}+=s*A*\vec{x} \f$ for a row-major matrix
+// or \f$ \vec{y}^T+=s*\vec{x}^T*A \f$ for a column-major matrix), otherwise each packed row/column
+// is scaled by the according element of \a x and added to \a y. The non-stored part of symmetric
+// and Hermitian matrices is handled in the same sweep over the stored elements, such that each
+// element is loaded only once.
+*/
+template< bool RF        // Reduction flag
+        , typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the PackedMatrix
+        , PackedFlag PF  // Packed storage flag of the PackedMatrix
+        , bool SO        // Storage order of the PackedMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename ST >  // Type of the scalar value
+inline DisableIf_< UseVectorizedPackedKernel<VT1,Type,PF,VT2> >
+   packedMultKernel( VT1& y, const PackedMatrix<Type,PF,SO>& A, const VT2& x, ST scalar )
+{
+   typedef MultTrait_< Type, ElementType_<VT2> >  SumType;
+
+   enum : bool { mirror = ( PF == packedSymmetric || PF == packedHermitian ) };
+   enum : bool { conjugate = ( PF == packedHermitian && IsComplex<Type>::value ) };
+
+   const size_t n( A.rows() );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const Type* const p( A.data( k ) );
+      const size_t begin( A.lineBegin( k ) );
+      const size_t end  ( A.lineEnd( k ) );
+
+      if( mirror )
+      {
+         const auto xk( scalar * x[k] );
+         SumType sum = SumType();
+
+         for( size_t l=0UL; l<k; ++l ) {
+            const Type a ( p[l] );
+            const Type ca( conjugate ? conj( a ) : a );
+            sum  += ( RF ? a : ca ) * x[l];
+            y[l] += ( RF ? ca : a ) * xk;
+         }
+
+         y[k] += scalar * ( sum + p[k] * x[k] );
+      }
+      else if( RF )
+      {
+         SumType sum = SumType();
+
+         for( size_t l=begin; l<end; ++l ) {
+            sum += p[l-begin] * x[l];
+         }
+
+         y[k] += scalar * sum;
+      }
+      else
+      {
+         const auto xk( scalar * x[k] );
+
+         for( size_t l=begin; l<end; ++l ) {
+            y[l] += p[l-begin] * xk;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the multiplication of a PackedMatrix with a dense vector.
+// \ingroup packed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The PackedMatrix.
+// \param x The right-hand side dense vector.
+// \param scalar The scaling factor of the product.
+// \return void
+//
+// This kernel adds the scaled product of the given PackedMatrix and the dense vector \a x to
+// the target vector \a y (see the default kernel for the meaning of \a RF). The stored elements
+// of each row/column are streamed via unaligned SIMD loads from the packed storage. In case of
+// a symmetric matrix the dot product with \a x and the update of \a y for the non-stored part
+// are fused into a single loop.
+*/
+template< bool RF        // Reduction flag
+        , typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the PackedMatrix
+        , PackedFlag PF  // Packed storage flag of the PackedMatrix
+        , bool SO        // Storage order of the PackedMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename ST >  // Type of the scalar value
+inline EnableIf_< UseVectorizedPackedKernel<VT1,Type,PF,VT2> >
+   packedMultKernel( VT1& y, const PackedMatrix<Type,PF,SO>& A, const VT2& x, ST scalar )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+   enum : bool { mirror = ( PF == packedSymmetric || PF == packedHermitian ) };
+
+   const size_t n( A.rows() );
+   const Type s( scalar );
+
+   Type* const       py( y.data() );
+   const Type* const px( x.data() );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const Type* const p( A.data( k ) );
+      const size_t begin( A.lineBegin( k ) );
+      const size_t end  ( A.lineEnd( k ) );
+
+      if( mirror || RF )
+      {
+         const size_t last( mirror ? k : end );
+         const Type   xk  ( s * px[k] );
+         const SIMDType xk1( set( xk ) );
+
+         SIMDType xmm1, xmm2;
+         size_t l( begin );
+
+         for( ; (l+2UL*SIMDSIZE) <= last; l+=2UL*SIMDSIZE ) {
+            const SIMDType a1( loadu( p+l-begin ) );
+            const SIMDType a2( loadu( p+l-begin+SIMDSIZE ) );
+            xmm1 = xmm1 + a1 * loadu( px+l );
+            xmm2 = xmm2 + a2 * loadu( px+l+SIMDSIZE );
+            if( mirror ) {
+               storeu( py+l         , loadu( py+l          ) + a1 * xk1 );
+               storeu( py+l+SIMDSIZE, loadu( py+l+SIMDSIZE ) + a2 * xk1 );
+            }
+         }
+         for( ; (l+SIMDSIZE) <= last; l+=SIMDSIZE ) {
+            const SIMDType a1( loadu( p+l-begin ) );
+            xmm1 = xmm1 + a1 * loadu( px+l );
+            if( mirror ) {
+               storeu( py+l, loadu( py+l ) + a1 * xk1 );
+            }
+         }
+
+         Type sum( blaze::sum( xmm1 + xmm2 ) );
+
+         for( ; l<last; ++l ) {
+            sum += p[l-begin] * px[l];
+            if( mirror ) {
+               py[l] += p[l-begin] * xk;
+            }
+         }
+
+         if( mirror ) {
+            sum += p[k] * px[k];
+         }
+
+         py[k] += s * sum;
+      }
+      else
+      {
+         const Type xk( s * px[k] );
+         const SIMDType xk1( set( xk ) );
+
+         size_t l( begin );
+
+         for( ; (l+SIMDSIZE) <= end; l+=SIMDSIZE ) {
+            storeu( py+l, loadu( py+l ) + loadu( p+l-begin ) * xk1 );
+         }
+         for( ; l<end; ++l ) {
+            py[l] += p[l-begin] * xk;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a PackedMatrix with a dense vector (\f$ \vec{y}+=s*A*\vec{x} \f$ or
+//        \f$ \vec{y}^T+=s*\vec{x}^T*A \f$).
+// \ingroup packed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The PackedMatrix.
+// \param x The right-hand side dense vector.
+// \param scalar The scaling factor of the product.
+// \return void
+//
+// This function is used internally by the dense matrix/dense vector multiplication expression
+// templates for the evaluation of products with a PackedMatrix. In case of column vectors the
+// function computes \f$ \vec{y}+=s*A*\vec{x} \f$, in case of row vectors it computes
+// \f$ \vec{y}^T+=s*\vec{x}^T*A \f$. The packed storage of the matrix is traversed exactly once.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF        // Transpose flag of the vectors
+        , typename Type  // Data type of the PackedMatrix
+        , PackedFlag PF  // Packed storage flag of the PackedMatrix
+        , bool SO        // Storage order of the PackedMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename ST >  // Type of the scalar value
+inline void packedMult( DenseVector<VT1,TF>& y, const PackedMatrix<Type,PF,SO>& A,
+                        const DenseVector<VT2,TF>& x, ST scalar )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.rows(), "Invalid vector size" );
+
+   packedMultKernel<SO==TF>( ~y, A, ~x, scalar );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
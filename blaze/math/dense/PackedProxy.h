@@ -0,0 +1,647 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedProxy.h
+//  \brief Header file for the PackedProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+#define _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsNaN.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for packed matrices.
+// \ingroup packed_matrix
+//
+// The PackedProxy provides controlled access to the elements of a non-const PackedMatrix whose
+// elements cannot be represented by a plain reference. It guarantees that the invariant of the
+// packed matrix is not violated:
+//
+//  - In a packed Hermitian matrix the proxy refers to the stored element. Elements of the
+//    non-stored triangular part are read and written as complex conjugates of the stored value
+//    and diagonal elements only accept real values.
+//  - In a packed lower, upper, or diagonal matrix the non-stored elements are restricted to
+//    zero. Reading such an element results in a default value; the assignment of a non-default
+//    value results in a \a std::invalid_argument exception.
+
+   \code
+   // Creating a 3x3 packed lower matrix
+   blaze::PackedMatrix<int,blaze::packedLower> A( 3UL );
+
+   A(0,0) = 1;  //        ( 1 0 0 )
+   A(1,0) = 2;  // => A = ( 2 3 0 )
+   A(1,1) = 3;  //        ( 0 0 4 )
+   A(2,2) = 4;
+
+   A(0,2) = 0;  // Assignment of a zero to an upper element; OK
+   A(0,2) = 5;  // Invalid assignment to upper matrix element; results in an exception!
+   \endcode
+*/
+template< typename MT >  // Type of the packed matrix
+class PackedProxy : public Proxy< PackedProxy<MT>, ElementType_<MT> >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef ElementType_<MT>         RepresentedType;  //!< Type of the represented matrix element.
+   typedef const RepresentedType    ConstReference;   //!< Value of the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedProxy( MT& matrix, size_t row, size_t column );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline PackedProxy& operator= ( const PackedProxy& pp );
+   template< typename T > inline PackedProxy& operator= ( const T& value );
+   template< typename T > inline PackedProxy& operator+=( const T& value );
+   template< typename T > inline PackedProxy& operator-=( const T& value );
+   template< typename T > inline PackedProxy& operator*=( const T& value );
+   template< typename T > inline PackedProxy& operator/=( const T& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void reset() const;
+   inline void clear() const;
+
+   inline ConstReference get()          const noexcept;
+   inline bool           isRestricted() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator ConstReference() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void set( const RepresentedType& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   RepresentedType* value_;  //!< Pointer to the stored matrix element.
+                             /*!< In case the proxy represents a restricted element of a
+                                  packed lower, upper, or diagonal matrix, the pointer is
+                                  \a nullptr. */
+   bool mirror_;             //!< Flag for an element of the non-stored Hermitian part.
+   bool diagonal_;           //!< Flag for diagonal elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE        ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST          ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE       ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a PackedProxy.
+//
+// \param matrix Reference to the packed matrix.
+// \param row The row-index of the accessed matrix element.
+// \param column The column-index of the accessed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedProxy<MT>::PackedProxy( MT& matrix, size_t row, size_t column )
+   : value_   ( matrix.address( row, column ) )                              // Pointer to the stored matrix element
+   , mirror_  ( IsHermitian<MT>::value && !matrix.isStored( row, column ) )  // Flag for an element of the non-stored Hermitian part
+   , diagonal_( row == column )                                              // Flag for diagonal elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a restricted element and the assigned value is not a default
+// value or in case the proxy represents a diagonal element of a Hermitian matrix and the
+// assigned value does not represent a real number, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedProxy<MT>& PackedProxy<MT>::operator=( const PackedProxy& pp )
+{
+   set( pp.get() );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a restricted element and the assigned value is not a default
+// value or in case the proxy represents a diagonal element of a Hermitian matrix and the
+// assigned value does not represent a real number, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<MT>& PackedProxy<MT>::operator=( const T& value )
+{
+   set( value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a restricted element and the resulting value is not a default
+// value or in case the proxy represents a diagonal element of a Hermitian matrix and the
+// resulting value does not represent a real number, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<MT>& PackedProxy<MT>::operator+=( const T& value )
+{
+   set( get() + value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a restricted element and the resulting value is not a default
+// value or in case the proxy represents a diagonal element of a Hermitian matrix and the
+// resulting value does not represent a real number, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<MT>& PackedProxy<MT>::operator-=( const T& value )
+{
+   set( get() - value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a diagonal element of a Hermitian matrix and the resulting value
+// does not represent a real number, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<MT>& PackedProxy<MT>::operator*=( const T& value )
+{
+   set( get() * value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// In case the proxy represents a diagonal element of a Hermitian matrix and the resulting value
+// does not represent a real number, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the packed matrix
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<MT>& PackedProxy<MT>::operator/=( const T& value )
+{
+   set( get() / value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reset the represented element to its default initial value.
+//
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial
+// value. Restricted elements already represent their default value.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::reset() const
+{
+   using blaze::reset;
+
+   if( value_ != nullptr )
+      reset( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+//
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial
+// state. Restricted elements already represent their default state.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::clear() const
+{
+   using blaze::clear;
+
+   if( value_ != nullptr )
+      clear( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return The value of the accessed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline typename PackedProxy<MT>::ConstReference PackedProxy<MT>::get() const noexcept
+{
+   if( value_ == nullptr )
+      return RepresentedType();
+   else if( mirror_ )
+      return conj( *value_ );
+   else
+      return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the proxy represents a restricted matrix element.
+//
+// \return \a true in case access to the matrix element is restricted, \a false if not.
+*/
+template< typename MT >  // Type of the packed matrix
+inline bool PackedProxy<MT>::isRestricted() const noexcept
+{
+   return value_ == nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline void PackedProxy<MT>::set( const RepresentedType& value ) const
+{
+   if( value_ == nullptr ) {
+      if( !isDefault( value ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to restricted matrix element" );
+      }
+      return;
+   }
+
+   if( IsComplex<RepresentedType>::value && IsHermitian<MT>::value && diagonal_ && !isReal( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix element" );
+   }
+
+   *value_ = ( mirror_ )?( conj( value ) ):( value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return The value of the accessed matrix element.
+*/
+template< typename MT >  // Type of the packed matrix
+inline PackedProxy<MT>::operator ConstReference() const noexcept
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedProxy global functions */
+//@{
+template< typename MT >
+inline void reset( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline void clear( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isDefault( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isReal( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isZero( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isOne( const PackedProxy<MT>& proxy );
+
+template< typename MT >
+inline bool isnan( const PackedProxy<MT>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial
+// value.
+*/
+template< typename MT >
+inline void reset( const PackedProxy<MT>& proxy )
+{
+   proxy.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial
+// state.
+*/
+template< typename MT >
+inline void clear( const PackedProxy<MT>& proxy )
+{
+   proxy.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isDefault( const PackedProxy<MT>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix element represents a real number.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the matrix element represents a real number, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy represents the a
+// real number. In case the element is of built-in type, the function returns \a true. In case
+// the element is of complex type, the function returns \a true if the imaginary part is equal
+// to 0. Otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isReal( const PackedProxy<MT>& proxy )
+{
+   using blaze::isReal;
+
+   return isReal( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 0.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 0, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy represents the numeric
+// value 0. In case it is 0, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isZero( const PackedProxy<MT>& proxy )
+{
+   using blaze::isZero;
+
+   return isZero( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 1.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 1, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy represents the numeric
+// value 1. In case it is 1, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isOne( const PackedProxy<MT>& proxy )
+{
+   using blaze::isOne;
+
+   return isOne( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is not a number.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is in not a number, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is not a number (NaN).
+// In case it is not a number, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT >
+inline bool isnan( const PackedProxy<MT>& proxy )
+{
+   using blaze::isnan;
+
+   return isnan( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,296 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Potrf.h
+//  \brief Header file for the native dense matrix Cholesky decomposition and Cholesky-based inversion
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_POTRF_H_
+#define _BLAZE_MATH_DENSE_POTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/Trsm.h>
+#include <blaze/math/dense/Trtri.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransposer.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY DECOMPOSITION FUNCTIONS (POTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native Cholesky decomposition functions (potrf) */
+//@{
+template< typename MT, bool SO >
+void blockedPotrf( DenseMatrix<MT,SO>& A, char uplo );
+
+template< typename MT, bool SO >
+void blockedPotri( DenseMatrix<MT,SO>& A, char uplo );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place Cholesky decomposition of a diagonal block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing the positive definite diagonal block.
+// \param t The index of the first row/column of the diagonal block within \a A.
+// \param n The number of rows/columns of the diagonal block.
+// \return \a true if the block is positive definite, \a false if not.
+//
+// This function overwrites the lower part of the diagonal block of \a A starting at (\a t,\a t)
+// with the lower Cholesky factor \f$ L \f$ of the block. The decomposition is computed by means
+// of the recursive partitioning
+
+                    \f[ L_{11} L_{11}^H = A_{11}, \quad
+                        L_{21} = A_{21} L_{11}^{-H}, \quad
+                        L_{22} L_{22}^H = A_{22} - L_{21} L_{21}^H. \f]
+
+// The upper part of the block is never accessed. In case the block is not positive definite,
+// the decomposition is aborted and the block is left in a partially decomposed state.
+*/
+template< typename MT >  // Type of the dense matrix
+bool potrfLower( MT& A, size_t t, size_t n )
+{
+   typedef ElementType_<MT>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      if( !potrfLower( A, t, n1 ) ) {
+         return false;
+      }
+      trsmRightLowerConj( A, t, n1, A, t+n1, t, n2 );
+      herkLowerSub( A, t+n1, n2, t, n1 );
+      return potrfLower( A, t+n1, n2 );
+   }
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      auto ajj( real( A(t+j,t+j) ) );
+      for( size_t k=0UL; k<j; ++k ) {
+         ajj -= real( A(t+j,t+k) * conj( A(t+j,t+k) ) );
+      }
+
+      if( !( ajj > decltype( ajj )( 0 ) ) ) {
+         return false;
+      }
+
+      ajj = sqrt( ajj );
+      A(t+j,t+j) = ajj;
+
+      for( size_t i=j+1UL; i<n; ++i ) {
+         ET x( A(t+i,t+j) );
+         for( size_t k=0UL; k<j; ++k ) {
+            x -= A(t+i,t+k) * conj( A(t+j,t+k) );
+         }
+         A(t+i,t+j) = x / ajj;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place computation of the product \f$ L^H*L \f$ for a diagonal block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing the lower triangular diagonal block.
+// \param t The index of the first row/column of the diagonal block within \a A.
+// \param n The number of rows/columns of the diagonal block.
+// \return void
+//
+// This function overwrites the lower triangular part of the diagonal block of \a A starting at
+// (\a t,\a t) with the lower part of the Hermitian product \f$ L^H*L \f$. The upper part of the
+// block is never accessed.
+*/
+template< typename MT >  // Type of the dense matrix
+void lauumLower( MT& A, size_t t, size_t n )
+{
+   typedef ElementType_<MT>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      lauumLower( A, t, n1 );
+      herkLowerAddConj( A, t, n1, t+n1, n2 );
+      trmmLeftLowerConj( A, t+n1, n2, A, t+n1, t, n1 );
+      lauumLower( A, t+n1, n2 );
+      return;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         ET x( conj( A(t+i,t+i) ) * A(t+i,t+j) );
+         for( size_t k=i+1UL; k<n; ++k ) {
+            x += conj( A(t+k,t+i) ) * A(t+k,t+j);
+         }
+         A(t+i,t+j) = x;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function is the native counterpart of the LAPACK potrf() function (see blaze::potrf())
+// and computes the same decomposition without requiring a LAPACK library. In case \a uplo is
+// set to \c 'L' the decomposition has the form \f$ A = L L^H \f$ and the lower part of \a A is
+// overwritten with \f$ L \f$. In case \a uplo is set to \c 'U' the decomposition has the form
+// \f$ A = U^H U \f$ and the upper part of \a A is overwritten with \f$ U \f$. The respective
+// other part of the matrix is not referenced. The decomposition is computed recursively, such
+// that the major part of the work is performed (and parallelized) by the Blaze dense matrix
+// multiplication kernels.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotrf( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   bool success( false );
+
+   if( uplo == 'L' ) {
+      success = potrfLower( ~A, 0UL, n );
+   }
+   else {
+      DMatTransposer<MT,!SO> AT( ~A );
+      success = potrfLower( AT, 0UL, n );
+   }
+
+   if( !success ) {
+      BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the inversion of the given Cholesky decomposed dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The Cholesky decomposed matrix to be inverted.
+// \param uplo \c 'L' in case of a lower factor, \c 'U' in case of an upper factor.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK potri() function (see blaze::potri())
+// for matrices that have already been factorized by the blockedPotrf() function. The part of
+// \a A selected by \a uplo is overwritten with the according part of the inverse matrix.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotri( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   if( uplo == 'L' ) {
+      trtriLower<false>( ~A, 0UL, n );
+      lauumLower( ~A, 0UL, n );
+   }
+   else {
+      DMatTransposer<MT,!SO> AT( ~A );
+      trtriLower<false>( AT, 0UL, n );
+      lauumLower( AT, 0UL, n );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/dense/Geqrf.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/Functions.h>
@@ -59,6 +60,7 @@
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/EnableIf.h>
 
 
@@ -95,7 +97,11 @@ template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
    qr_backend( MT1& A, const ElementType_<MT1>* tau )
 {
+#if BLAZE_LAPACK_MODE
    orgqr( A, tau );
+#else
+   blockedOrgqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -117,7 +123,11 @@ template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
    qr_backend( MT1& A, const ElementType_<MT1>* tau )
 {
+#if BLAZE_LAPACK_MODE
    ungqr( A, tau );
+#else
+   blockedOrgqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -169,7 +179,8 @@ inline EnableIf_<IsComplex< ElementType_<MT1> > >
 // element type results in a compile time error!
 //
 // \note This function can only be used if the fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable, unless the LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt>
+// configuration file). Otherwise a call to this function will result in a linker error.
 */
 template< typename MT1  // Type of matrix A
         , bool SO1      // Storage order of matrix A
@@ -212,7 +223,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    if( m < n )
    {
       r = A;
+#if BLAZE_LAPACK_MODE
       geqrf( r, tau.get() );
+#else
+      blockedGeqrf( r, tau.get() );
+#endif
       (~Q) = submatrix( r, 0UL, 0UL, m, m );
       qr_backend( ~Q, tau.get() );
 
@@ -225,7 +240,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    else
    {
       (~Q) = A;
+#if BLAZE_LAPACK_MODE
       geqrf( ~Q, tau.get() );
+#else
+      blockedGeqrf( ~Q, tau.get() );
+#endif
 
       resize( ~R, n, n );
       reset( r );
@@ -0,0 +1,571 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SVD.h
+//  \brief Header file for the dense matrix singular value decomposition (SVD)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SVD_H_
+#define _BLAZE_MATH_DENSE_SVD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Jacobi.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/gesdd.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SINGULAR VALUE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Singular value functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
+void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+          DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the native Jacobi singular value kernel.
+// \ingroup dense_matrix
+//
+// This helper evaluates to \a true in case the singular values of the matrix type \a MT are
+// computed by the native Jacobi kernel, i.e. in case the LAPACK mode is disabled or in case
+// \a MT is a fixed size matrix of at most JACOBI_THRESHOLD rows and columns.
+*/
+template< typename MT >  // Type of the dense matrix
+struct UseJacobiSVD
+   : public BoolConstant< !BLAZE_LAPACK_MODE ||
+                          ( Rows< RemoveAdaptor_< ResultType_<MT> > >::value != 0UL &&
+                            Rows< RemoveAdaptor_< ResultType_<MT> > >::value <= JACOBI_THRESHOLD &&
+                            Columns< RemoveAdaptor_< ResultType_<MT> > >::value != 0UL &&
+                            Columns< RemoveAdaptor_< ResultType_<MT> > >::value <= JACOBI_THRESHOLD ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary type for the column-major temporaries of the native Jacobi SVD kernel.
+// \ingroup dense_matrix
+//
+// The member type \a Type is a max(m,n)-by-min(m,n) matrix that holds the (conjugate transposed)
+// matrix to be orthogonalized, the member type \a Square is the min(m,n)-by-min(m,n) matrix of
+// the accumulated rotations. In case the given matrix type \a MT is a fixed size matrix both are
+// StaticMatrix types, which enables the computation without any dynamic memory allocation.
+*/
+template< typename MT >  // Type of the dense matrix
+struct JacobiSVDTemporary
+{
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   typedef ElementType_<MT>                  ET;
+   typedef RemoveAdaptor_< ResultType_<MT> >  RT;
+
+   enum : size_t { M = Rows<RT>::value
+                 , N = Columns<RT>::value
+                 , K = ( M < N ? M : N )
+                 , L = ( M < N ? N : M ) };
+
+   typedef If_< BoolConstant< M != 0UL && N != 0UL >
+              , StaticMatrix<ET,L,K,columnMajor>
+              , DynamicMatrix<ET,columnMajor> >  Type;
+
+   typedef If_< BoolConstant< M != 0UL && N != 0UL >
+              , StaticMatrix<ET,K,K,columnMajor>
+              , DynamicMatrix<ET,columnMajor> >  Square;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the Jacobi SVD temporary with the given matrix.
+// \ingroup dense_matrix
+//
+// \param A The given m-by-n matrix.
+// \param W The resulting max(m,n)-by-min(m,n) matrix.
+// \return void
+//
+// In case the given matrix has less rows than columns, \a W is initialized with the conjugate
+// transpose of \a A, since the one-sided Jacobi kernel requires at least as many rows as columns.
+*/
+template< typename MT1   // Type of the given matrix
+        , typename MT2 > // Type of the temporary
+void jacobiSVDInit( const MT1& A, MT2& W )
+{
+   if( A.rows() >= A.columns() ) {
+      resize( W, A.rows(), A.columns(), false );
+      W = A;
+   }
+   else {
+      resize( W, A.columns(), A.rows(), false );
+      W = ctrans( A );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the singular values from the orthogonalized Jacobi SVD temporary.
+// \ingroup dense_matrix
+//
+// \param W The orthogonalized max(m,n)-by-min(m,n) matrix.
+// \param X The accumulated rotations (only referenced if \a Vectors is \a true).
+// \param s The resulting vector of singular values.
+// \return void
+//
+// This function computes the singular values as the Euclidean norms of the columns of \a W and
+// sorts them in descending order. In case \a Vectors is \a true, the columns of \a W and \a X
+// are permuted accordingly, the columns of \a W are normalized, and the columns belonging to
+// (numerically) zero singular values are completed to an orthonormal basis.
+*/
+template< bool Vectors  // Compute the singular vectors
+        , typename MT1  // Type of the orthogonalized matrix
+        , typename MT2  // Type of the rotation matrix
+        , typename VT > // Type of the singular value vector
+void jacobiSVDFinalize( MT1& W, MT2& X, VT& s )
+{
+   using std::swap;
+
+   typedef ElementType_<MT1>       ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const size_t m( W.rows() );
+   const size_t k( W.columns() );
+
+   for( size_t j=0UL; j<k; ++j ) {
+      BT sum( 0 );
+      for( size_t i=0UL; i<m; ++i ) {
+         sum += real( W(i,j) * conj( W(i,j) ) );
+      }
+      s[j] = sqrt( sum );
+   }
+
+   for( size_t j=0UL; j<k; ++j )
+   {
+      size_t jmax( j );
+      for( size_t l=j+1UL; l<k; ++l ) {
+         if( s[l] > s[jmax] ) jmax = l;
+      }
+
+      if( jmax == j ) continue;
+
+      swap( s[j], s[jmax] );
+
+      if( Vectors ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            swap( W(i,j), W(i,jmax) );
+         }
+         for( size_t i=0UL; i<k; ++i ) {
+            swap( X(i,j), X(i,jmax) );
+         }
+      }
+   }
+
+   if( !Vectors || k == 0UL ) return;
+
+   const BT tol( Limits<BT>::epsilon() * BT(m) * s[0] );
+
+   for( size_t j=0UL; j<k; ++j )
+   {
+      if( s[j] > tol ) {
+         const BT scale( BT(1) / s[j] );
+         for( size_t i=0UL; i<m; ++i ) {
+            W(i,j) *= scale;
+         }
+         continue;
+      }
+
+      // Completion of the left singular vector of a (numerically) zero singular value by
+      // orthogonalizing the unit vectors against the previous (orthonormal) columns
+      for( size_t e=0UL; e<m; ++e )
+      {
+         for( size_t i=0UL; i<m; ++i ) {
+            W(i,j) = ( i == e ) ? ET(1) : ET(0);
+         }
+
+         for( size_t pass=0UL; pass<2UL; ++pass ) {
+            for( size_t l=0UL; l<j; ++l ) {
+               ET dot( 0 );
+               for( size_t i=0UL; i<m; ++i ) {
+                  dot += conj( W(i,l) ) * W(i,j);
+               }
+               for( size_t i=0UL; i<m; ++i ) {
+                  W(i,j) -= dot * W(i,l);
+               }
+            }
+         }
+
+         BT sum( 0 );
+         for( size_t i=0UL; i<m; ++i ) {
+            sum += real( W(i,j) * conj( W(i,j) ) );
+         }
+
+         if( sum > BT(0.25) ) {
+            const BT scale( BT(1) / sqrt( sum ) );
+            for( size_t i=0UL; i<m; ++i ) {
+               W(i,j) *= scale;
+            }
+            break;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the singular value computation for matrices handled by the Jacobi kernel.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+*/
+template< typename MT  // Type of the general matrix
+        , typename VT >// Type of the singular value vector
+EnableIf_< UseJacobiSVD<MT> > svdBackend( const MT& A, VT& s )
+{
+   typename JacobiSVDTemporary<MT>::Type W;
+
+   jacobiSVDInit( A, W );
+   jacobiGesvd( W );
+
+   resize( s, W.columns(), false );
+
+   jacobiSVDFinalize<false>( W, W, s );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the singular value computation for matrices handled by LAPACK.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+// \exception std::runtime_error Singular value decomposition failed.
+*/
+template< typename MT  // Type of the general matrix
+        , typename VT >// Type of the singular value vector
+DisableIf_< UseJacobiSVD<MT> > svdBackend( const MT& A, VT& s )
+{
+   typedef ElementType_<MT>        ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   DynamicMatrix<ET,columnMajor> tmp( A );
+   DynamicVector<BT,columnVector> stmp;
+
+   gesdd( tmp, stmp );
+
+   resize( s, stmp.size(), false );
+   s = stmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the singular value decomposition for matrices handled by the Jacobi kernel.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of (conjugate transposed) right singular vectors.
+// \return void
+*/
+template< typename MT1   // Type of the general matrix
+        , typename MT2   // Type of the left singular vector matrix
+        , typename VT    // Type of the singular value vector
+        , typename MT3 > // Type of the right singular vector matrix
+EnableIf_< UseJacobiSVD<MT1> > svdBackend( const MT1& A, MT2& U, VT& s, MT3& V )
+{
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const size_t k( m < n ? m : n );
+
+   resize( U, m, k, false );
+   resize( s, k, false );
+   resize( V, k, n, false );
+
+   typename JacobiSVDTemporary<MT1>::Type W;
+   typename JacobiSVDTemporary<MT1>::Square X;
+
+   jacobiSVDInit( A, W );
+   resize( X, k, k, false );
+
+   jacobiGesvd( W, X );
+   jacobiSVDFinalize<true>( W, X, s );
+
+   if( m >= n ) {
+      U = W;
+      V = ctrans( X );
+   }
+   else {
+      U = X;
+      V = ctrans( W );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the singular value decomposition for matrices handled by LAPACK.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of (conjugate transposed) right singular vectors.
+// \return void
+// \exception std::runtime_error Singular value decomposition failed.
+*/
+template< typename MT1   // Type of the general matrix
+        , typename MT2   // Type of the left singular vector matrix
+        , typename VT    // Type of the singular value vector
+        , typename MT3 > // Type of the right singular vector matrix
+DisableIf_< UseJacobiSVD<MT1> > svdBackend( const MT1& A, MT2& U, VT& s, MT3& V )
+{
+   typedef ElementType_<MT1>       ET;
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   DynamicMatrix<ET,columnMajor> tmp( A ), Utmp, Vtmp;
+   DynamicVector<BT,columnVector> stmp;
+
+   gesdd( tmp, Utmp, stmp, Vtmp, 'S' );
+
+   resize( U, Utmp.rows(), Utmp.columns(), false );
+   resize( s, stmp.size(), false );
+   resize( V, Vtmp.rows(), Vtmp.columns(), false );
+
+   U = Utmp;
+   s = stmp;
+   V = Vtmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value computation of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular values of the given general m-by-n matrix. The min(m,n)
+// real and non-negative singular values are returned in descending order in the given vector
+// \a s, which is resized to the correct size (if possible and necessary).
+//
+// The function fails if ...
+//
+//  - ... the given vector \a s is a fixed size vector and the size doesn't match;
+//  - ... the singular value decomposition fails.
+//
+// The first case is reported via a \a std::invalid_argument exception, the second via a
+// \a std::runtime_error exception.
+//
+// Example:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 500UL );
+   blaze::DynamicVector<double,blaze::columnVector> s;
+   // ... Initialization of A
+
+   svd( A, s );  // LAPACK gesdd() based singular value computation
+   \endcode
+
+// Fixed size matrices with at most six rows and columns (e.g. StaticMatrix) are handled by a
+// native one-sided Jacobi kernel that works entirely on the stack. All other matrices are
+// handled by the LAPACK gesdd() function, which uses a divide and conquer algorithm. In case the
+// LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration file) the
+// Jacobi kernel is used for all matrices.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note Unless the matrix is handled by the native Jacobi kernel, this function can only be used
+// if the fitting LAPACK library is available and linked to the executable. Otherwise a call to
+// this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   svdBackend( ~A, ~s );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value decomposition (SVD) of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of (conjugate transposed) right singular vectors.
+// \return void
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the thin singular value decomposition of the given general m-by-n
+// matrix. With \f$ k = min(m,n) \f$ the resulting decomposition has the form
+
+                              \f[ A = U \cdot diag(s) \cdot V, \f]
+
+// where the columns of the m-by-k matrix \a U are the orthonormal left singular vectors, \a s
+// contains the k real and non-negative singular values in descending order, and the rows of the
+// k-by-n matrix \a V are the orthonormal (conjugate transposed) right singular vectors, i.e.
+// \a V contains \f$ V^H \f$ in the usual notation. \a U, \a s, and \a V are resized to the
+// correct dimensions (if possible and necessary). In case of a rank deficient matrix, the left
+// singular vectors of the zero singular values still form an orthonormal basis.
+//
+// The function fails if ...
+//
+//  - ... the given matrices \a U and \a V or the vector \a s are of fixed size and the sizes
+//        don't match;
+//  - ... the singular value decomposition fails.
+//
+// The first case is reported via a \a std::invalid_argument exception, the second via a
+// \a std::runtime_error exception.
+//
+// Example:
+
+   \code
+   // Kabsch algorithm: optimal rotation between two 3D point sets
+   blaze::StaticMatrix<double,3UL,3UL> H, U, V;
+   blaze::StaticVector<double,3UL> s;
+   // ... Initialization of the covariance matrix H
+
+   svd( H, U, s, V );  // Native Jacobi kernel without any dynamic memory allocation
+
+   blaze::StaticMatrix<double,3UL,3UL> R( trans( V ) * trans( U ) );
+   \endcode
+
+// Fixed size matrices with at most six rows and columns (e.g. StaticMatrix) are handled by a
+// native one-sided Jacobi kernel that works entirely on the stack. All other matrices are
+// handled by the LAPACK gesdd() function, which uses a divide and conquer algorithm. In case the
+// LAPACK mode is disabled (see the <tt>./blaze/config/LAPACK.h</tt> configuration file) the
+// Jacobi kernel is used for all matrices.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note Unless the matrix is handled by the native Jacobi kernel, this function can only be used
+// if the fitting LAPACK library is available and linked to the executable. Otherwise a call to
+// this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a U, \a s, and \a V may already have been modified.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of all matrices
+        , typename MT2  // Type of the matrix U
+        , typename VT   // Type of the vector s
+        , bool TF       // Transpose flag of the vector s
+        , typename MT3 >// Type of the matrix V
+void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+          DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   svdBackend( ~A, ~U, ~s, ~V );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,579 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transpose.h
+//  \brief Header file for the dense matrix transposition kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSE_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasSIMDTranspose.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tiling of the dense matrix transposition kernels.
+// \ingroup dense_matrix
+//
+// The TransposeTraits class template specifies the tiling of the transposition kernels for the
+// element type \a T. Each tile consists of \a SIMDSIZE rows and columns and is transposed in
+// SIMD registers. In order to write complete cache lines of 64 bytes to each row of the target
+// matrix, \a NT tiles on top of each other are transposed in a row, i.e. a block of \a IBLOCK
+// rows is processed at once. The out-of-place transposition kernel only pays off in case a
+// single SIMD vector spans at least half a cache line (i.e. for AVX and AVX-512): only then
+// the complete cache lines of large target matrices can be efficiently written by means of
+// non-temporal stores. In this case \a vectorizable is set to \a true.
+*/
+template< typename T >  // Element type
+struct TransposeTraits
+{
+   enum : size_t { SIMDSIZE = HasSIMDTranspose<T>::value ? SIMDTrait<T>::size : 1UL };
+   enum : size_t { NT = ( SIMDSIZE*sizeof(T) < 64UL )?( 64UL / ( SIMDSIZE*sizeof(T) ) ):( 1UL ) };
+   enum : size_t { IBLOCK = HasSIMDTranspose<T>::value ? NT*SIMDSIZE : 1UL };
+   enum : bool   { vectorizable = HasSIMDTranspose<T>::value && SIMDSIZE*sizeof(T) >= 32UL };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSITION OF BLOCKS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single block of elements by means of SIMD operations.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the source block.
+// \param n The number of columns of the source block.
+// \param A Pointer to the first element of the row-wise stored source block.
+// \param lda The spacing between two rows of the source block.
+// \param B Pointer to the first element of the row-wise stored \f$ n \times m \f$ target block.
+// \param ldb The spacing between two rows of the target block.
+// \return void
+//
+// This function transposes the given block in square tiles of SIMD size, which are loaded into
+// SIMD registers, transposed in-register, and stored as complete SIMD vectors. In case \a STREAM
+// is set to \a true, the tiles of complete cache lines are stored by means of non-temporal
+// stores, which requires the target block to be properly aligned. The remaining rows and
+// columns are transposed element by element.
+*/
+template< bool STREAM     // Flag for the use of non-temporal stores
+        , typename T >    // Element type
+EnableIf_< HasSIMDTranspose<T> >
+   transposeBlock( size_t m, size_t n, const T* A, size_t lda, T* B, size_t ldb )
+{
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = TransposeTraits<T>::SIMDSIZE };
+   enum : size_t { NT       = TransposeTraits<T>::NT       };
+   enum : size_t { IBLOCK   = TransposeTraits<T>::IBLOCK   };
+
+   const size_t ipos( m - m % IBLOCK   );
+   const size_t jpos( n - n % SIMDSIZE );
+
+   SIMDType xmm[IBLOCK];
+
+   for( size_t j=0UL; j<jpos; j+=SIMDSIZE ) {
+      for( size_t i=0UL; i<ipos; i+=IBLOCK ) {
+         for( size_t l=0UL; l<NT; ++l ) {
+            for( size_t k=0UL; k<SIMDSIZE; ++k )
+               xmm[l*SIMDSIZE+k] = loadu( A+(i+l*SIMDSIZE+k)*lda+j );
+            transpose( xmm+l*SIMDSIZE );
+         }
+         for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+            for( size_t l=0UL; l<NT; ++l ) {
+               if( STREAM ) stream( B+(j+k)*ldb+i+l*SIMDSIZE, xmm[l*SIMDSIZE+k] );
+               else         storeu( B+(j+k)*ldb+i+l*SIMDSIZE, xmm[l*SIMDSIZE+k] );
+            }
+         }
+      }
+   }
+
+   size_t i( ipos );
+
+   for( ; (i+SIMDSIZE) <= m; i+=SIMDSIZE ) {
+      for( size_t j=0UL; j<jpos; j+=SIMDSIZE ) {
+         for( size_t k=0UL; k<SIMDSIZE; ++k )
+            xmm[k] = loadu( A+(i+k)*lda+j );
+         transpose( xmm );
+         for( size_t k=0UL; k<SIMDSIZE; ++k )
+            storeu( B+(j+k)*ldb+i, xmm[k] );
+      }
+   }
+
+   for( size_t j=jpos; j<n; ++j ) {
+      for( size_t k=0UL; k<i; ++k )
+         B[j*ldb+k] = A[k*lda+j];
+   }
+
+   for( ; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B[j*ldb+i] = A[i*lda+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default transposition of a single block of elements.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the source block.
+// \param n The number of columns of the source block.
+// \param A Pointer to the first element of the row-wise stored source block.
+// \param lda The spacing between two rows of the source block.
+// \param B Pointer to the first element of the row-wise stored \f$ n \times m \f$ target block.
+// \param ldb The spacing between two rows of the target block.
+// \return void
+*/
+template< bool STREAM     // Flag for the use of non-temporal stores
+        , typename T >    // Element type
+DisableIf_< HasSIMDTranspose<T> >
+   transposeBlock( size_t m, size_t n, const T* A, size_t lda, T* B, size_t ldb )
+{
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B[j*ldb+i] = A[i*lda+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a single square diagonal block by means of SIMD operations.
+// \ingroup dense_matrix
+//
+// \param n The number of rows and columns of the block.
+// \param A Pointer to the first element of the row-wise stored block.
+// \param lda The spacing between two rows of the block.
+// \return void
+*/
+template< typename T >  // Element type
+EnableIf_< HasSIMDTranspose<T> >
+   transposeDiagonalBlock( size_t n, T* A, size_t lda )
+{
+   using std::swap;
+
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   const size_t npos( n - n % SIMDSIZE );
+
+   SIMDType xmm[SIMDSIZE];
+   SIMDType ymm[SIMDSIZE];
+
+   for( size_t i=0UL; i<npos; i+=SIMDSIZE )
+   {
+      for( size_t k=0UL; k<SIMDSIZE; ++k )
+         xmm[k] = loadu( A+(i+k)*lda+i );
+      transpose( xmm );
+      for( size_t k=0UL; k<SIMDSIZE; ++k )
+         storeu( A+(i+k)*lda+i, xmm[k] );
+
+      for( size_t j=i+SIMDSIZE; j<npos; j+=SIMDSIZE ) {
+         for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+            xmm[k] = loadu( A+(i+k)*lda+j );
+            ymm[k] = loadu( A+(j+k)*lda+i );
+         }
+         transpose( xmm );
+         transpose( ymm );
+         for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+            storeu( A+(i+k)*lda+j, ymm[k] );
+            storeu( A+(j+k)*lda+i, xmm[k] );
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=( i < npos ? npos : i+1UL ); j<n; ++j ) {
+         swap( A[i*lda+j], A[j*lda+i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default in-place transposition of a single square diagonal block.
+// \ingroup dense_matrix
+//
+// \param n The number of rows and columns of the block.
+// \param A Pointer to the first element of the row-wise stored block.
+// \param lda The spacing between two rows of the block.
+// \return void
+*/
+template< typename T >  // Element type
+DisableIf_< HasSIMDTranspose<T> >
+   transposeDiagonalBlock( size_t n, T* A, size_t lda )
+{
+   using std::swap;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=i+1UL; j<n; ++j ) {
+         swap( A[i*lda+j], A[j*lda+i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Exchange of a block with the transpose of its mirrored block by means of SIMD operations.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the block \a A.
+// \param n The number of columns of the block \a A.
+// \param A Pointer to the first element of the row-wise stored \f$ m \times n \f$ block.
+// \param B Pointer to the first element of the row-wise stored \f$ n \times m \f$ block.
+// \param lda The spacing between two rows of both blocks.
+// \return void
+//
+// This function exchanges the element \f$ A(i,j) \f$ with the element \f$ B(j,i) \f$ for all
+// \f$ i \in [0..m) \f$ and \f$ j \in [0..n) \f$. Both blocks must not overlap.
+*/
+template< typename T >  // Element type
+EnableIf_< HasSIMDTranspose<T> >
+   swapTransposeBlock( size_t m, size_t n, T* A, T* B, size_t lda )
+{
+   using std::swap;
+
+   typedef SIMDTrait_<T>  SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   const size_t ipos( m - m % SIMDSIZE );
+   const size_t jpos( n - n % SIMDSIZE );
+
+   SIMDType xmm[SIMDSIZE];
+   SIMDType ymm[SIMDSIZE];
+
+   for( size_t i=0UL; i<ipos; i+=SIMDSIZE )
+   {
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+            xmm[k] = loadu( A+(i+k)*lda+j );
+            ymm[k] = loadu( B+(j+k)*lda+i );
+         }
+         transpose( xmm );
+         transpose( ymm );
+         for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+            storeu( A+(i+k)*lda+j, ymm[k] );
+            storeu( B+(j+k)*lda+i, xmm[k] );
+         }
+      }
+      for( ; j<n; ++j ) {
+         for( size_t k=0UL; k<SIMDSIZE; ++k )
+            swap( A[(i+k)*lda+j], B[j*lda+i+k] );
+      }
+   }
+
+   for( size_t i=ipos; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         swap( A[i*lda+j], B[j*lda+i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default exchange of a block with the transpose of its mirrored block.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the block \a A.
+// \param n The number of columns of the block \a A.
+// \param A Pointer to the first element of the row-wise stored \f$ m \times n \f$ block.
+// \param B Pointer to the first element of the row-wise stored \f$ n \times m \f$ block.
+// \param lda The spacing between two rows of both blocks.
+// \return void
+*/
+template< typename T >  // Element type
+DisableIf_< HasSIMDTranspose<T> >
+   swapTransposeBlock( size_t m, size_t n, T* A, T* B, size_t lda )
+{
+   using std::swap;
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         swap( A[i*lda+j], B[j*lda+i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSITION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the cache-oblivious out-of-place transposition.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the source matrix.
+// \param n The number of columns of the source matrix.
+// \param A Pointer to the first element of the row-wise stored \f$ m \times n \f$ source matrix.
+// \param lda The spacing between two rows of the source matrix.
+// \param B Pointer to the first element of the row-wise stored \f$ n \times m \f$ target matrix.
+// \param ldb The spacing between two rows of the target matrix.
+// \return void
+//
+// This function recursively splits the larger of the two dimensions in halves until the
+// remaining block fits into a block of \a TRANSPOSE_BLOCK_SIZE rows and columns, which is
+// then transposed in SIMD tiles. The rows of the source matrix are split at multiples of the
+// row block of the tiles, the columns at multiples of the SIMD size, such that all tiles of
+// the recursion are aligned in case the complete matrices are aligned.
+*/
+template< bool STREAM     // Flag for the use of non-temporal stores
+        , typename T >    // Element type
+void transpose_backend( size_t m, size_t n, const T* A, size_t lda, T* B, size_t ldb )
+{
+   enum : size_t { SIMDSIZE = TransposeTraits<T>::SIMDSIZE };
+   enum : size_t { IBLOCK   = TransposeTraits<T>::IBLOCK   };
+
+   if( m <= TRANSPOSE_BLOCK_SIZE && n <= TRANSPOSE_BLOCK_SIZE ) {
+      transposeBlock<STREAM>( m, n, A, lda, B, ldb );
+   }
+   else if( m >= n ) {
+      const size_t m1( nextMultiple<size_t>( m/2UL, IBLOCK ) );
+      BLAZE_INTERNAL_ASSERT( m1 > 0UL && m1 < m, "Invalid split point detected" );
+      transpose_backend<STREAM>( m1  , n, A       , lda, B   , ldb );
+      transpose_backend<STREAM>( m-m1, n, A+m1*lda, lda, B+m1, ldb );
+   }
+   else {
+      const size_t n1( nextMultiple<size_t>( n/2UL, SIMDSIZE ) );
+      BLAZE_INTERNAL_ASSERT( n1 > 0UL && n1 < n, "Invalid split point detected" );
+      transpose_backend<STREAM>( m, n1  , A   , lda, B       , ldb );
+      transpose_backend<STREAM>( m, n-n1, A+n1, lda, B+n1*ldb, ldb );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious out-of-place transposition of a row-wise stored dense matrix.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the source matrix.
+// \param n The number of columns of the source matrix.
+// \param A Pointer to the first element of the row-wise stored \f$ m \times n \f$ source matrix.
+// \param lda The spacing between two rows of the source matrix.
+// \param B Pointer to the first element of the row-wise stored \f$ n \times m \f$ target matrix.
+// \param ldb The spacing between two rows of the target matrix.
+// \return void
+//
+// This function computes \f$ B = A^T \f$ by recursive, cache-oblivious tiling: due to the
+// recursive splitting, both the source and the target block are cache resident on some level
+// of the memory hierarchy without the need to know the size of the caches. In case the target
+// matrix is large compared to the cache and properly aligned, the tiles are stored by means of
+// non-temporal stores. Both matrices must not overlap. Since the function works on column-wise
+// stored matrices in the same way (with \a m and \a n denoting the number of columns and rows,
+// respectively), it can be used for all combinations of storage orders that require an actual
+// transposition.
+*/
+template< typename T >  // Element type
+void transposeKernel( size_t m, size_t n, const T* A, size_t lda, T* B, size_t ldb )
+{
+   enum : size_t { SIMDSIZE = TransposeTraits<T>::SIMDSIZE };
+
+   if( useStreaming && TransposeTraits<T>::vectorizable &&
+       m*n > ( cacheSize / ( sizeof(T) * 3UL ) ) &&
+       ldb % SIMDSIZE == 0UL && checkAlignment( B ) ) {
+      transpose_backend<true>( m, n, A, lda, B, ldb );
+   }
+   else {
+      transpose_backend<false>( m, n, A, lda, B, ldb );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a square, row-wise stored dense matrix.
+// \ingroup dense_matrix
+//
+// \param n The number of rows and columns of the matrix.
+// \param A Pointer to the first element of the row-wise stored \f$ n \times n \f$ matrix.
+// \param lda The spacing between two rows of the matrix.
+// \return void
+//
+// This function transposes the given square matrix in blocks of \a TRANSPOSE_BLOCK_SIZE rows
+// and columns. Each diagonal block is transposed in-place, each pair of mirrored off-diagonal
+// blocks is transposed and exchanged. Within the blocks, SIMD tiles are used if available.
+*/
+template< typename T >  // Element type
+void transposeKernel( size_t n, T* A, size_t lda )
+{
+   const size_t block( TRANSPOSE_BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<n; ii+=block )
+   {
+      const size_t iend( ( n < ii+block )?( n ):( ii+block ) );
+
+      transposeDiagonalBlock( iend-ii, A+ii*lda+ii, lda );
+
+      for( size_t jj=ii+block; jj<n; jj+=block ) {
+         const size_t jend( ( n < jj+block )?( n ):( jj+block ) );
+         swapTransposeBlock( iend-ii, jend-jj, A+ii*lda+jj, A+jj*lda+ii, lda );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a row-wise stored, rectangular dense matrix.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the row-wise stored matrix.
+// \param lda The spacing between the rows of the given matrix (\f$ lda \geq n \f$).
+// \param ldb The spacing between the rows of the transposed matrix (\f$ ldb \geq m \f$).
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function transposes the given \f$ m \times n \f$ matrix into a row-wise stored
+// \f$ n \times m \f$ matrix within the same memory, which has to provide space for at least
+// \f$ \max(m \cdot lda,n \cdot ldb) \f$ elements. The rows are first packed contiguously,
+// then the transposition follows the cycles of the underlying permutation (the element at
+// index \f$ k \f$ moves to index \f$ k \cdot m \bmod (m \cdot n - 1) \f$), and finally the rows
+// are spread to the spacing \a ldb. In order to visit every cycle exactly once, one bit per
+// element is used to mark all elements that have already been moved. Therefore the additional
+// memory requirement is \f$ m \cdot n \f$ bits instead of a second matrix of the same size.
+// The bits are allocated before any element is moved, i.e. in case the allocation fails the
+// matrix remains unchanged. Due to the scattered memory accesses, the transposition is
+// considerably slower than the transposition into a second matrix.
+*/
+template< typename T >  // Element type
+void transposeCycles( size_t m, size_t n, T* A, size_t lda, size_t ldb )
+{
+   if( m == 0UL || n == 0UL ) return;
+
+   std::vector<bool> moved( m*n, false );
+
+   for( size_t i=1UL; i<m && lda != n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A[i*n+j] = std::move( A[i*lda+j] );
+      }
+   }
+
+   const size_t last( m*n - 1UL );
+
+   for( size_t start=1UL; start<last; ++start )
+   {
+      if( moved[start] ) continue;
+
+      T tmp( std::move( A[start] ) );
+      size_t k( start );
+
+      while( true ) {
+         moved[k] = true;
+         const size_t src( ( k % m ) * n + k / m );
+         if( src == start ) break;
+         A[k] = std::move( A[src] );
+         k = src;
+      }
+
+      A[k] = std::move( tmp );
+   }
+
+   for( size_t i=n; i-- > 1UL && ldb != m; ) {
+      for( size_t j=m; j-- > 0UL; ) {
+         A[i*ldb+j] = std::move( A[i*m+j] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
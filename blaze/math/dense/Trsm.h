@@ -0,0 +1,555 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Trsm.h
+//  \brief Header file for the native triangular dense matrix kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRSM_H_
+#define _BLAZE_MATH_DENSE_TRSM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DMatForEachExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TRIANGULAR SOLVE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place solution of the triangular system \f$ L*X=B \f$ for a block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param L The dense matrix containing the lower triangular matrix.
+// \param t The index of the first row/column of the lower triangular matrix within \a L.
+// \param n The number of rows/columns of the lower triangular matrix.
+// \param B The dense matrix containing the right-hand side block.
+// \param row The index of the first row of the right-hand side block within \a B.
+// \param column The index of the first column of the right-hand side block within \a B.
+// \param m The number of columns of the right-hand side block.
+// \return void
+//
+// This function overwrites the \a n-by-\a m block of \a B with the solution \f$ X=L^{-1}*B \f$,
+// where \a L is the lower triangular (or unitriangular in case \a Unit is \a true) part of the
+// diagonal block of \a L starting at (\a t,\a t). The upper part of this block is never accessed.
+// The system is split recursively until the triangular matrix fits into a single block, such
+// that the major part of the work is performed by dense matrix multiplications.
+*/
+template< bool Unit       // Unitriangular flag
+        , typename MT1    // Type of the triangular matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+void trsmLeftLower( const MT1& L, size_t t, size_t n, MT2& B, size_t row, size_t column, size_t m )
+{
+   typedef ElementType_<MT2>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      trsmLeftLower<Unit>( L, t, n1, B, row, column, m );
+      submatrix( B, row+n1, column, n2, m ) -= submatrix( L, t+n1, t, n2, n1 ) *
+                                               submatrix( B, row, column, n1, m );
+      trsmLeftLower<Unit>( L, t+n1, n2, B, row+n1, column, m );
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT2>::value ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t k=0UL; k<i; ++k ) {
+            const ET l( L(t+i,t+k) );
+            for( size_t j=0UL; j<m; ++j ) {
+               B(row+i,column+j) -= l * B(row+k,column+j);
+            }
+         }
+         if( !Unit ) {
+            const ET inv( ET(1) / L(t+i,t+i) );
+            for( size_t j=0UL; j<m; ++j ) {
+               B(row+i,column+j) *= inv;
+            }
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<m; ++j ) {
+         for( size_t k=0UL; k<n; ++k ) {
+            if( !Unit ) {
+               B(row+k,column+j) /= L(t+k,t+k);
+            }
+            const ET x( B(row+k,column+j) );
+            for( size_t i=k+1UL; i<n; ++i ) {
+               B(row+i,column+j) -= L(t+i,t+k) * x;
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place solution of the triangular system \f$ U*X=B \f$ for a block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param U The dense matrix containing the upper triangular matrix.
+// \param t The index of the first row/column of the upper triangular matrix within \a U.
+// \param n The number of rows/columns of the upper triangular matrix.
+// \param B The dense matrix containing the right-hand side block.
+// \param row The index of the first row of the right-hand side block within \a B.
+// \param column The index of the first column of the right-hand side block within \a B.
+// \param m The number of columns of the right-hand side block.
+// \return void
+//
+// This function overwrites the \a n-by-\a m block of \a B with the solution \f$ X=U^{-1}*B \f$,
+// where \a U is the upper triangular (or unitriangular in case \a Unit is \a true) part of the
+// diagonal block of \a U starting at (\a t,\a t). The lower part of this block is never accessed.
+*/
+template< bool Unit       // Unitriangular flag
+        , typename MT1    // Type of the triangular matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+void trsmLeftUpper( const MT1& U, size_t t, size_t n, MT2& B, size_t row, size_t column, size_t m )
+{
+   typedef ElementType_<MT2>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      trsmLeftUpper<Unit>( U, t+n1, n2, B, row+n1, column, m );
+      submatrix( B, row, column, n1, m ) -= submatrix( U, t, t+n1, n1, n2 ) *
+                                            submatrix( B, row+n1, column, n2, m );
+      trsmLeftUpper<Unit>( U, t, n1, B, row, column, m );
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT2>::value ) {
+      for( size_t i=n; i-- > 0UL; ) {
+         for( size_t k=i+1UL; k<n; ++k ) {
+            const ET u( U(t+i,t+k) );
+            for( size_t j=0UL; j<m; ++j ) {
+               B(row+i,column+j) -= u * B(row+k,column+j);
+            }
+         }
+         if( !Unit ) {
+            const ET inv( ET(1) / U(t+i,t+i) );
+            for( size_t j=0UL; j<m; ++j ) {
+               B(row+i,column+j) *= inv;
+            }
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<m; ++j ) {
+         for( size_t k=n; k-- > 0UL; ) {
+            if( !Unit ) {
+               B(row+k,column+j) /= U(t+k,t+k);
+            }
+            const ET x( B(row+k,column+j) );
+            for( size_t i=0UL; i<k; ++i ) {
+               B(row+i,column+j) -= U(t+i,t+k) * x;
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place solution of the triangular system \f$ X*L^H=B \f$ for a block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param L The dense matrix containing the lower triangular matrix.
+// \param t The index of the first row/column of the lower triangular matrix within \a L.
+// \param n The number of rows/columns of the lower triangular matrix.
+// \param B The dense matrix containing the right-hand side block.
+// \param row The index of the first row of the right-hand side block within \a B.
+// \param column The index of the first column of the right-hand side block within \a B.
+// \param m The number of rows of the right-hand side block.
+// \return void
+//
+// This function overwrites the \a m-by-\a n block of \a B with the solution \f$ X=B*L^{-H} \f$,
+// where \a L is the lower triangular part of the diagonal block of \a L starting at (\a t,\a t).
+*/
+template< typename MT1    // Type of the triangular matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+void trsmRightLowerConj( const MT1& L, size_t t, size_t n, MT2& B, size_t row, size_t column, size_t m )
+{
+   typedef ElementType_<MT2>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      trsmRightLowerConj( L, t, n1, B, row, column, m );
+      submatrix( B, row, column+n1, m, n2 ) -= submatrix( B, row, column, m, n1 ) *
+                                               ctrans( submatrix( L, t+n1, t, n2, n1 ) );
+      trsmRightLowerConj( L, t+n1, n2, B, row, column+n1, m );
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT2>::value ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            ET x( B(row+i,column+j) );
+            for( size_t k=0UL; k<j; ++k ) {
+               x -= B(row+i,column+k) * conj( L(t+j,t+k) );
+            }
+            B(row+i,column+j) = x / conj( L(t+j,t+j) );
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<n; ++j ) {
+         for( size_t k=0UL; k<j; ++k ) {
+            const ET l( conj( L(t+j,t+k) ) );
+            for( size_t i=0UL; i<m; ++i ) {
+               B(row+i,column+j) -= B(row+i,column+k) * l;
+            }
+         }
+         const ET inv( ET(1) / conj( L(t+j,t+j) ) );
+         for( size_t i=0UL; i<m; ++i ) {
+            B(row+i,column+j) *= inv;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIANGULAR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place multiplication \f$ B=L*B \f$ of a block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param L The dense matrix containing the lower triangular matrix.
+// \param t The index of the first row/column of the lower triangular matrix within \a L.
+// \param n The number of rows/columns of the lower triangular matrix.
+// \param B The dense matrix containing the block to be multiplied.
+// \param row The index of the first row of the block within \a B.
+// \param column The index of the first column of the block within \a B.
+// \param m The number of columns of the block.
+// \return void
+*/
+template< bool Unit       // Unitriangular flag
+        , typename MT1    // Type of the triangular matrix
+        , typename MT2 >  // Type of the multiplied matrix
+void trmmLeftLower( const MT1& L, size_t t, size_t n, MT2& B, size_t row, size_t column, size_t m )
+{
+   typedef ElementType_<MT2>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      trmmLeftLower<Unit>( L, t+n1, n2, B, row+n1, column, m );
+      submatrix( B, row+n1, column, n2, m ) += submatrix( L, t+n1, t, n2, n1 ) *
+                                               submatrix( B, row, column, n1, m );
+      trmmLeftLower<Unit>( L, t, n1, B, row, column, m );
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT2>::value ) {
+      for( size_t i=n; i-- > 0UL; ) {
+         if( !Unit ) {
+            const ET l( L(t+i,t+i) );
+            for( size_t j=0UL; j<m; ++j ) {
+               B(row+i,column+j) *= l;
+            }
+         }
+         for( size_t k=0UL; k<i; ++k ) {
+            const ET l( L(t+i,t+k) );
+            for( size_t j=0UL; j<m; ++j ) {
+               B(row+i,column+j) += l * B(row+k,column+j);
+            }
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<m; ++j ) {
+         for( size_t k=n; k-- > 0UL; ) {
+            const ET x( B(row+k,column+j) );
+            for( size_t i=k+1UL; i<n; ++i ) {
+               B(row+i,column+j) += L(t+i,t+k) * x;
+            }
+            if( !Unit ) {
+               B(row+k,column+j) *= L(t+k,t+k);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place multiplication \f$ B=L^H*B \f$ of a block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param L The dense matrix containing the lower triangular matrix.
+// \param t The index of the first row/column of the lower triangular matrix within \a L.
+// \param n The number of rows/columns of the lower triangular matrix.
+// \param B The dense matrix containing the block to be multiplied.
+// \param row The index of the first row of the block within \a B.
+// \param column The index of the first column of the block within \a B.
+// \param m The number of columns of the block.
+// \return void
+*/
+template< typename MT1    // Type of the triangular matrix
+        , typename MT2 >  // Type of the multiplied matrix
+void trmmLeftLowerConj( const MT1& L, size_t t, size_t n, MT2& B, size_t row, size_t column, size_t m )
+{
+   typedef ElementType_<MT2>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      trmmLeftLowerConj( L, t, n1, B, row, column, m );
+      submatrix( B, row, column, n1, m ) += ctrans( submatrix( L, t+n1, t, n2, n1 ) ) *
+                                            submatrix( B, row+n1, column, n2, m );
+      trmmLeftLowerConj( L, t+n1, n2, B, row+n1, column, m );
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT2>::value ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         const ET d( conj( L(t+i,t+i) ) );
+         for( size_t j=0UL; j<m; ++j ) {
+            B(row+i,column+j) *= d;
+         }
+         for( size_t k=i+1UL; k<n; ++k ) {
+            const ET l( conj( L(t+k,t+i) ) );
+            for( size_t j=0UL; j<m; ++j ) {
+               B(row+i,column+j) += l * B(row+k,column+j);
+            }
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<m; ++j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            ET x( conj( L(t+i,t+i) ) * B(row+i,column+j) );
+            for( size_t k=i+1UL; k<n; ++k ) {
+               x += conj( L(t+k,t+i) ) * B(row+k,column+j);
+            }
+            B(row+i,column+j) = x;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place multiplication \f$ B=B*L \f$ of a block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param L The dense matrix containing the lower triangular matrix.
+// \param t The index of the first row/column of the lower triangular matrix within \a L.
+// \param n The number of rows/columns of the lower triangular matrix.
+// \param B The dense matrix containing the block to be multiplied.
+// \param row The index of the first row of the block within \a B.
+// \param column The index of the first column of the block within \a B.
+// \param m The number of rows of the block.
+// \return void
+*/
+template< bool Unit       // Unitriangular flag
+        , typename MT1    // Type of the triangular matrix
+        , typename MT2 >  // Type of the multiplied matrix
+void trmmRightLower( const MT1& L, size_t t, size_t n, MT2& B, size_t row, size_t column, size_t m )
+{
+   typedef ElementType_<MT2>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      trmmRightLower<Unit>( L, t, n1, B, row, column, m );
+      submatrix( B, row, column, m, n1 ) += submatrix( B, row, column+n1, m, n2 ) *
+                                            submatrix( L, t+n1, t, n2, n1 );
+      trmmRightLower<Unit>( L, t+n1, n2, B, row, column+n1, m );
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT2>::value ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            ET x( Unit ? B(row+i,column+j) : B(row+i,column+j) * L(t+j,t+j) );
+            for( size_t k=j+1UL; k<n; ++k ) {
+               x += B(row+i,column+k) * L(t+k,t+j);
+            }
+            B(row+i,column+j) = x;
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( !Unit ) {
+            const ET l( L(t+j,t+j) );
+            for( size_t i=0UL; i<m; ++i ) {
+               B(row+i,column+j) *= l;
+            }
+         }
+         for( size_t k=j+1UL; k<n; ++k ) {
+            const ET l( L(t+k,t+j) );
+            for( size_t i=0UL; i<m; ++i ) {
+               B(row+i,column+j) += B(row+i,column+k) * l;
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HERMITIAN RANK-K UPDATE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Hermitian rank-k update \f$ C=C-X*X^H \f$ of the lower part of a diagonal block.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing both the updated block and the factor \a X.
+// \param c The index of the first row/column of the updated diagonal block \a C.
+// \param n The number of rows/columns of the updated diagonal block \a C.
+// \param column The index of the first column of the n-by-k factor \a X (in the rows of \a C).
+// \param k The number of columns of the factor \a X.
+// \return void
+//
+// This function only updates the lower part of \a C. The upper part is never accessed.
+*/
+template< typename MT >  // Type of the dense matrix
+void herkLowerSub( MT& A, size_t c, size_t n, size_t column, size_t k )
+{
+   typedef ElementType_<MT>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      herkLowerSub( A, c, n1, column, k );
+      submatrix( A, c+n1, c, n2, n1 ) -= submatrix( A, c+n1, column, n2, k ) *
+                                         ctrans( submatrix( A, c, column, n1, k ) );
+      herkLowerSub( A, c+n1, n2, column, k );
+      return;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         ET x( A(c+i,c+j) );
+         for( size_t l=0UL; l<k; ++l ) {
+            x -= A(c+i,column+l) * conj( A(c+j,column+l) );
+         }
+         A(c+i,c+j) = x;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Hermitian rank-k update \f$ C=C+X^H*X \f$ of the lower part of a diagonal block.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing both the updated block and the factor \a X.
+// \param c The index of the first row/column of the updated diagonal block \a C.
+// \param n The number of rows/columns of the updated diagonal block \a C.
+// \param row The index of the first row of the k-by-n factor \a X (in the columns of \a C).
+// \param k The number of rows of the factor \a X.
+// \return void
+//
+// This function only updates the lower part of \a C. The upper part is never accessed.
+*/
+template< typename MT >  // Type of the dense matrix
+void herkLowerAddConj( MT& A, size_t c, size_t n, size_t row, size_t k )
+{
+   typedef ElementType_<MT>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      herkLowerAddConj( A, c, n1, row, k );
+      submatrix( A, c+n1, c, n2, n1 ) += ctrans( submatrix( A, row, c+n1, k, n2 ) ) *
+                                         submatrix( A, row, c, k, n1 );
+      herkLowerAddConj( A, c+n1, n2, row, k );
+      return;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         ET x( A(c+i,c+j) );
+         for( size_t l=0UL; l<k; ++l ) {
+            x += conj( A(row+l,c+i) ) * A(row+l,c+j);
+         }
+         A(c+i,c+j) = x;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,197 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Trtri.h
+//  \brief Header file for the native dense matrix triangular inversion
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRTRI_H_
+#define _BLAZE_MATH_DENSE_TRTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/Trsm.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransposer.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIANGULAR INVERSION FUNCTIONS (TRTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native triangular inversion functions (trtri) */
+//@{
+template< typename MT, bool SO >
+void blockedTrtri( DenseMatrix<MT,SO>& A, char uplo, char diag );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a lower triangular diagonal block of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing the lower triangular matrix.
+// \param t The index of the first row/column of the lower triangular matrix within \a A.
+// \param n The number of rows/columns of the lower triangular matrix.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts the lower triangular (or unitriangular in case \a Unit is \a true) part
+// of the diagonal block of \a A starting at (\a t,\a t) by means of the recursive partitioning
+
+                    \f[ \left(\begin{array}{*{2}{c}}
+                        L_{11} & 0      \\
+                        L_{21} & L_{22} \\
+                        \end{array}\right)^{-1} =
+                        \left(\begin{array}{*{2}{c}}
+                        L_{11}^{-1}                     & 0           \\
+                        -L_{22}^{-1} L_{21} L_{11}^{-1} & L_{22}^{-1} \\
+                        \end{array}\right). \f]
+
+// The upper part of the block is never accessed.
+*/
+template< bool Unit     // Unitriangular flag
+        , typename MT >  // Type of the dense matrix
+void trtriLower( MT& A, size_t t, size_t n )
+{
+   typedef ElementType_<MT>  ET;
+
+   if( n > FACTORIZATION_BLOCK_SIZE ) {
+      const size_t n1( n/2UL );
+      const size_t n2( n - n1 );
+      trtriLower<Unit>( A, t, n1 );
+      trmmRightLower<Unit>( A, t, n1, A, t+n1, t, n2 );
+      trsmLeftLower<Unit>( A, t+n1, n2, A, t+n1, t, n1 );
+      submatrix( A, t+n1, t, n2, n1 ) *= ET(-1);
+      trtriLower<Unit>( A, t+n1, n2 );
+      return;
+   }
+
+   for( size_t j=n; j-- > 0UL; )
+   {
+      ET ajj( -1 );
+
+      if( !Unit ) {
+         if( isDefault( A(t+j,t+j) ) ) {
+            BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+         }
+         A(t+j,t+j) = ET(1) / A(t+j,t+j);
+         ajj = -A(t+j,t+j);
+      }
+
+      for( size_t i=n; i-- > j+1UL; ) {
+         ET x( Unit ? A(t+i,t+j) : A(t+i,t+i) * A(t+i,t+j) );
+         for( size_t k=j+1UL; k<i; ++k ) {
+            x += A(t+i,t+k) * A(t+k,t+j);
+         }
+         A(t+i,t+j) = x * ajj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native kernel for the inversion of the given dense triangular matrix.
+// \ingroup dense_matrix
+//
+// \param A The triangular matrix to be inverted.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid diag argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK trtri() function (see blaze::trtri())
+// and computes the same result without requiring a LAPACK library. Only the part of \a A selected
+// by \a uplo is accessed. In contrast to the LAPACK kernel, the function can also be used for
+// dense matrices without data access. In case of an upper matrix, the transpose of \a A is
+// inverted in-place, which avoids any copy of the matrix.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedTrtri( DenseMatrix<MT,SO>& A, char uplo, char diag )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( diag != 'U' && diag != 'N' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid diag argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   if( uplo == 'L' ) {
+      ( diag == 'U' )?( trtriLower<true>( ~A, 0UL, n ) ):( trtriLower<false>( ~A, 0UL, n ) );
+   }
+   else {
+      DMatTransposer<MT,!SO> AT( ~A );
+      ( diag == 'U' )?( trtriLower<true>( AT, 0UL, n ) ):( trtriLower<false>( AT, 0UL, n ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
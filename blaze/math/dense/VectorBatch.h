@@ -0,0 +1,899 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/VectorBatch.h
+//  \brief Header file for the implementation of a batch of small, fixed-size vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_VECTORBATCH_H_
+#define _BLAZE_MATH_DENSE_VECTORBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Algorithm.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup vector_batch VectorBatch
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a batch of small, fixed-size vectors.
+// \ingroup vector_batch
+//
+// The VectorBatch class template represents a dynamically sized batch of independent column
+// vectors of the fixed size \a N. The type of the elements and the number of elements of the
+// vectors can be specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t N >
+   class VectorBatch;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. VectorBatch can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - N   : specifies the number of elements of each vector of the batch.
+//
+// In analogy to the MatrixBatch class template, a VectorBatch stores its vectors in a
+// structure-of-arrays layout: all elements \a i of all vectors of the batch are stored
+// contiguously in a single, properly aligned and padded array (the so-called plane of element
+// \a i). Therefore batched operations like batchMult() can process the vectors of the batch in
+// a vectorized fashion, where every SIMD lane processes one vector of the batch:
+
+   \code
+   using blaze::MatrixBatch;
+   using blaze::VectorBatch;
+   using blaze::StaticVector;
+
+   MatrixBatch<double,3UL,3UL> A( 1000UL );
+   VectorBatch<double,3UL> x( 1000UL ), y;
+
+   StaticVector<double,3UL> v;
+   // ... Initialization of A and v
+
+   for( size_t k=0UL; k<x.size(); ++k ) {
+      x.set( k, v );  // Setting the k-th vector of the batch
+   }
+
+   batchMult( y, A, x );  // Computing all 1000 products y[k] = A[k] * x[k]
+
+   v = y.get( 5UL );  // Extracting the sixth vector of the batch
+   \endcode
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+class VectorBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef VectorBatch<Type,N>                This;         //!< Type of this VectorBatch instance.
+   typedef StaticVector<Type,N,columnVector>  VectorType;   //!< Type of a single vector.
+   typedef Type                               ElementType;  //!< Type of the vector elements.
+   typedef SIMDTrait_<ElementType>            SIMDType;     //!< SIMD type of the vector elements.
+
+   typedef Type&        Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&  ConstReference;  //!< Reference to a constant vector value.
+   typedef Type*        Pointer;         //!< Pointer to a non-constant vector value.
+   typedef const Type*  ConstPointer;    //!< Pointer to a constant vector value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether batched operations the batch is
+       involved in can be optimized via SIMD operations. In case the element type of the batch
+       is a vectorizable data type, the \a simdEnabled compilation flag is set to \a true,
+       otherwise it is set to \a false. */
+   enum : bool { simdEnabled = IsVectorizable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline VectorBatch() noexcept;
+   explicit inline VectorBatch( size_t n );
+   explicit inline VectorBatch( size_t n, const Type& init );
+
+   inline VectorBatch( const VectorBatch& b );
+   inline VectorBatch( VectorBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~VectorBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i ) const noexcept;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline VectorBatch& operator=( const VectorBatch& rhs );
+   inline VectorBatch& operator=( VectorBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline VectorType get( size_t k ) const;
+   template< typename VT, bool TF > inline void set( size_t k, const Vector<VT,TF>& v );
+   inline void reset();
+   inline void clear();
+          void resize( size_t n, bool preserve=true );
+   inline void swap( VectorBatch& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+   enum : size_t { PLANES = N };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t adjustCapacity( size_t minCapacity ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of vectors of the batch.
+   size_t capacity_;         //!< The number of elements of a single plane.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated planes of the batch.
+                             /*!< The plane of element \a i starts at index
+                                  \f$ i*capacity\_ \f$. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for VectorBatch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>::VectorBatch() noexcept
+   : size_    ( 0UL )      // The current number of vectors
+   , capacity_( 0UL )      // The number of elements of a single plane
+   , v_       ( nullptr )  // The planes of the batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n vectors. No element initialization is performed!
+//
+// \param n The number of vectors of the batch.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>::VectorBatch( size_t n )
+   : size_    ( n )                                   // The current number of vectors
+   , capacity_( adjustCapacity( n ) )                 // The number of elements of a single plane
+   , v_       ( allocate<Type>( PLANES*capacity_ ) )  // The planes of the batch
+{
+   if( IsVectorizable<Type>::value ) {
+      for( size_t p=0UL; p<PLANES; ++p )
+         for( size_t k=size_; k<capacity_; ++k )
+            v_[p*capacity_+k] = Type();
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneously initialized batch of \a n vectors.
+//
+// \param n The number of vectors of the batch.
+// \param init The initial value of all vector elements.
+//
+// All vector elements of all vectors of the batch are initialized with the given value.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>::VectorBatch( size_t n, const Type& init )
+   : VectorBatch( n )
+{
+   for( size_t p=0UL; p<PLANES; ++p )
+      std::fill( v_+p*capacity_, v_+p*capacity_+size_, init );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for VectorBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>::VectorBatch( const VectorBatch& b )
+   : size_    ( b.size_ )                             // The current number of vectors
+   , capacity_( b.capacity_ )                         // The number of elements of a single plane
+   , v_       ( allocate<Type>( PLANES*capacity_ ) )  // The planes of the batch
+{
+   std::copy( b.v_, b.v_+PLANES*capacity_, v_ );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for VectorBatch.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>::VectorBatch( VectorBatch&& b ) noexcept
+   : size_    ( b.size_     )  // The current number of vectors
+   , capacity_( b.capacity_ )  // The number of elements of a single plane
+   , v_       ( b.v_        )  // The planes of the batch
+{
+   b.size_     = 0UL;
+   b.capacity_ = 0UL;
+   b.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for VectorBatch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>::~VectorBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the vector elements of the batch.
+//
+// \param k Access index for the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline typename VectorBatch<Type,N>::Reference
+   VectorBatch<Type,N>::operator()( size_t k, size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid vector access index"  );
+   BLAZE_USER_ASSERT( i<N    , "Invalid element access index" );
+   return v_[i*capacity_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the vector elements of the batch.
+//
+// \param k Access index for the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline typename VectorBatch<Type,N>::ConstReference
+   VectorBatch<Type,N>::operator()( size_t k, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid vector access index"  );
+   BLAZE_USER_ASSERT( i<N    , "Invalid element access index" );
+   return v_[i*capacity_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the planes of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The plane of element
+// \a i starts at the offset \f$ i*spacing() \f$.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline typename VectorBatch<Type,N>::Pointer VectorBatch<Type,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the planes of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The plane of element
+// \a i starts at the offset \f$ i*spacing() \f$.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline typename VectorBatch<Type,N>::ConstPointer VectorBatch<Type,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to a single plane of the batch.
+//
+// \param i The index of the plane. The index has to be in the range \f$[0..N-1]\f$.
+// \return Pointer to the first element \a i of the batch.
+//
+// This function returns a pointer to the plane of element \a i, i.e. to the element \a i of
+// the first vector of the batch. The element \a i of the k-th vector is located at the offset
+// \a k.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline typename VectorBatch<Type,N>::Pointer VectorBatch<Type,N>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i<N, "Invalid element access index" );
+   return v_+i*capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to a single plane of the batch.
+//
+// \param i The index of the plane. The index has to be in the range \f$[0..N-1]\f$.
+// \return Pointer to the first element \a i of the batch.
+//
+// This function returns a pointer to the plane of element \a i, i.e. to the element \a i of
+// the first vector of the batch. The element \a i of the k-th vector is located at the offset
+// \a k.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline typename VectorBatch<Type,N>::ConstPointer
+   VectorBatch<Type,N>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<N, "Invalid element access index" );
+   return v_+i*capacity_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for VectorBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+//
+// The batch is resized according to the given batch and initialized as a copy of this batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>& VectorBatch<Type,N>::operator=( const VectorBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   VectorBatch tmp( rhs );
+   swap( tmp );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for VectorBatch.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline VectorBatch<Type,N>& VectorBatch<Type,N>::operator=( VectorBatch&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of vectors of the batch.
+//
+// \return The number of vectors of the batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline size_t VectorBatch<Type,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two planes.
+//
+// \return The spacing between the beginning of two planes.
+//
+// This function returns the spacing between the beginning of two planes, i.e. the total number
+// of elements of a plane. The spacing is a multiple of the number of elements of a SIMD vector
+// in case the element type of the batch is vectorizable.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline size_t VectorBatch<Type,N>::spacing() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the k-th vector of the batch.
+//
+// \param k The index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \return Copy of the k-th vector of the batch.
+// \exception std::out_of_range Invalid vector access index.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline typename VectorBatch<Type,N>::VectorType VectorBatch<Type,N>::get( size_t k ) const
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+
+   VectorType v;
+
+   for( size_t i=0UL; i<N; ++i )
+      v[i] = v_[i*capacity_+k];
+
+   return v;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the k-th vector of the batch.
+//
+// \param k The index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param v The vector to be assigned to the k-th vector of the batch.
+// \return void
+// \exception std::out_of_range Invalid vector access index.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+template< typename VT    // Type of the vector
+        , bool TF >      // Transpose flag of the vector
+inline void VectorBatch<Type,N>::set( size_t k, const Vector<VT,TF>& v )
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+
+   if( (~v).size() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+      v_[i*capacity_+k] = (~v)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline void VectorBatch<Type,N>::reset()
+{
+   using blaze::clear;
+
+   for( size_t p=0UL; p<PLANES; ++p )
+      for( size_t k=0UL; k<size_; ++k )
+         clear( v_[p*capacity_+k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the number of vectors of the batch is 0.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline void VectorBatch<Type,N>::clear()
+{
+   resize( 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of vectors of the batch.
+//
+// \param n The new number of vectors of the batch.
+// \param preserve \a true if the old vectors of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch to \a n vectors. During this operation, new dynamic memory
+// may be allocated in case the capacity of the batch is too small. In order to preserve the old
+// vectors, the \a preserve flag can be set to \a true. However, new vectors are not
+// initialized!
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+void VectorBatch<Type,N>::resize( size_t n, bool preserve )
+{
+   if( n > capacity_ )
+   {
+      // Allocating a new array
+      const size_t newCapacity( adjustCapacity( n ) );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( PLANES*newCapacity );
+
+      // Initializing the new array
+      for( size_t p=0UL; p<PLANES; ++p )
+      {
+         if( preserve ) {
+            transfer( v_+p*capacity_, v_+p*capacity_+size_, tmp+p*newCapacity );
+         }
+
+         if( IsVectorizable<Type>::value ) {
+            for( size_t k=n; k<newCapacity; ++k )
+               tmp[p*newCapacity+k] = Type();
+         }
+      }
+
+      // Replacing the old array
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newCapacity;
+   }
+   else if( IsVectorizable<Type>::value && n < size_ )
+   {
+      for( size_t p=0UL; p<PLANES; ++p )
+         for( size_t k=n; k<size_; ++k )
+            v_[p*capacity_+k] = Type();
+   }
+
+   size_ = n;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline void VectorBatch<Type,N>::swap( VectorBatch& b ) noexcept
+{
+   std::swap( size_, b.size_ );
+   std::swap( capacity_, b.capacity_ );
+   std::swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the number of elements of a plane.
+//
+// \param minCapacity The minimum necessary number of elements.
+// \return The number of elements of a plane.
+//
+// In case the element type is vectorizable, the planes are padded to a multiple of the SIMD
+// width, such that batched operations don't require a scalar remainder loop.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline size_t VectorBatch<Type,N>::adjustCapacity( size_t minCapacity ) const noexcept
+{
+   if( IsVectorizable<Type>::value )
+      return nextMultiple<size_t>( minCapacity, SIMDSIZE );
+   else return minCapacity;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the batch are intact.
+//
+// \return \a true in case the batch's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the batch are intact, i.e. if its state is
+// valid. In case the invariants are intact, the function returns \a true, else it will return
+// \a false.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline bool VectorBatch<Type,N>::isIntact() const noexcept
+{
+   if( size_ > capacity_ )
+      return false;
+
+   if( IsNumeric<Type>::value ) {
+      for( size_t p=0UL; p<PLANES; ++p )
+         for( size_t k=size_; k<capacity_; ++k )
+            if( v_[p*capacity_+k] != Type() )
+               return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIXBATCH OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name VectorBatch operators */
+//@{
+template< typename Type, size_t N >
+inline void reset( VectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+inline void clear( VectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+inline bool isIntact( const VectorBatch<Type,N>& b ) noexcept;
+
+template< typename Type, size_t N >
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup vector_batch
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline void reset( VectorBatch<Type,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch.
+// \ingroup vector_batch
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline void clear( VectorBatch<Type,N>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given batch are intact.
+// \ingroup vector_batch
+//
+// \param b The batch to be tested.
+// \return \a true in case the given batch's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline bool isIntact( const VectorBatch<Type,N>& b ) noexcept
+{
+   return b.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup vector_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -49,6 +49,8 @@
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/Dispatch.h>
+#include <blaze/math/dense/Gemm.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -104,6 +106,7 @@
 #include <blaze/system/Blocking.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -125,6 +128,7 @@
 #include <blaze/util/typetraits/IsComplexFloat.h>
 #include <blaze/util/typetraits/IsDouble.h>
 #include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 
@@ -241,6 +245,47 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all three involved data types are suited for the packed matrix multiplication
+       kernel, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedKernel {
+      enum : bool { value = UseVectorizedDefaultKernel<T1,T2,T3>::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value && HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsFloatingPoint< ElementType_<T1> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all three involved data types are suited for the runtime dispatched matrix
+       multiplication kernel, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchKernel {
+      enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                            IsRowMajorMatrix<T1>::value &&
+                            IsRowMajorMatrix<T2>::value && IsRowMajorMatrix<T3>::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value && HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            !IsTriangular<T2>::value && !IsTriangular<T3>::value &&
+                            T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                            ( IsFloat< ElementType_<T1> >::value ||
+                              IsDouble< ElementType_<T1> >::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDMatMultExpr<MT1,MT2>   This;           //!< Type of this DMatDMatMultExpr instance.
@@ -516,15 +561,69 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT5>::value ) ||
+      if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
-         selectSmallAssignKernel( C, A, B );
+         selectDispatchAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default assignment to dense matrices (small matrices)***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a small dense matrix-dense matrix multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the small kernel of the assignment of a dense matrix-dense matrix
+   // multiplication expression to a dense matrix in case no runtime dispatched kernel can be
+   // used.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< UseDispatchKernel<MT3,MT4,MT5> >
+      selectDispatchAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSmallAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched assignment to dense matrices (small matrices)****************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a small dense matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense matrix multiplication by means of the kernel
+   // for the instruction set selected at runtime.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UseDispatchKernel<MT3,MT4,MT5> >
+      selectDispatchAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef ElementType_<MT3>  ET;
+
+      dispatchGemm( C, A, B, ET(1), ET(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices (general/general)**************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a general dense matrix-general dense matrix multiplication
@@ -1458,12 +1557,62 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline DisableIf_< UseBlasKernel<MT3,MT4,MT5> >
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectPackedAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed-based assignment to dense matrices (default)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a dense matrix-dense matrix multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of a large dense
+   // matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectPackedAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       selectLargeAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed-based assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed assignment of a dense matrix-dense matrix multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense matrix multiplication by means of the native
+   // packed matrix multiplication kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectPackedAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef ElementType_<MT3>  ET;
+
+      packedGemm( C, A, B, ET(1), ET(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices*****************************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
    /*! \cond BLAZE_INTERNAL */
@@ -1634,7 +1783,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT5>::value ) ||
+      if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B );
       else
@@ -2554,12 +2703,64 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline DisableIf_< UseBlasKernel<MT3,MT4,MT5> >
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectPackedAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed-based addition assignment to dense matrices (default)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a dense matrix-dense matrix multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a large
+   // dense matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectPackedAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       selectLargeAddAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed-based addition assignment to dense matrices******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed addition assignment of a dense matrix-dense matrix multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense matrix multiplication by means of the native
+   // packed matrix multiplication kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectPackedAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef ElementType_<MT3>  ET;
+
+      packedGemm( C, A, B, ET(1), ET(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices********************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
    /*! \cond BLAZE_INTERNAL */
@@ -2699,7 +2900,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT5>::value ) ||
+      if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B );
       else
@@ -3619,12 +3820,64 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline DisableIf_< UseBlasKernel<MT3,MT4,MT5> >
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectPackedSubAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed-based subtraction assignment to dense matrices (default)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a dense matrix-dense matrix multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a large
+   // dense matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectPackedSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       selectLargeSubAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed-based subtraction assignment to dense matrices***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed subtraction assignment of a dense matrix-dense matrix multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense matrix multiplication by means of the native
+   // packed matrix multiplication kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5> >
+      selectPackedSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef ElementType_<MT3>  ET;
+
+      packedGemm( C, A, B, ET(-1), ET(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subraction assignment to dense matrices******************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
    /*! \cond BLAZE_INTERNAL */
@@ -4140,6 +4393,23 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all four involved data types are suited for the packed matrix multiplication
+       kernel, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedKernel {
+      enum : bool { value = UseVectorizedDefaultKernel<T1,T2,T3,T4>::value &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value && HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                            IsFloatingPoint< ElementType_<T1> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !IsComplex<T4>::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatScalarMultExpr<MMM,ST,false>  This;           //!< Type of this DMatScalarMultExpr instance.
@@ -4383,7 +4653,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT5>::value ) ||
+      if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B, scalar );
       else
@@ -5325,11 +5595,63 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline DisableIf_< UseBlasKernel<MT3,MT4,MT5,ST2> >
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectPackedAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Packed-based assignment to dense matrices (default)*****************************************
+   /*!\brief Default assignment of a scaled dense matrix-dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of a large scaled
+   // dense matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectPackedAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectLargeAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
+   //**Packed-based assignment to dense matrices***************************************************
+   /*!\brief Packed assignment of a scaled dense matrix-dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense matrix multiplication by means of the
+   // native packed matrix multiplication kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectPackedAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      typedef ElementType_<MT3>  ET;
+
+      packedGemm( C, A, B, ET(scalar), ET(0) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices*****************************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
    /*!\brief BLAS-based assignment of a scaled dense matrix-dense matrix multiplication
@@ -5502,7 +5824,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT5>::value ) ||
+      if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
       else
@@ -6349,11 +6671,63 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline DisableIf_< UseBlasKernel<MT3,MT4,MT5,ST2> >
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectPackedAddAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Packed-based addition assignment to dense matrices (default)********************************
+   /*!\brief Default addition assignment of a scaled dense matrix-dense matrix multiplication
+   //        (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a large
+   // scaled dense matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectPackedAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectLargeAddAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
+   //**Packed-based addition assignment to dense matrices******************************************
+   /*!\brief Packed addition assignment of a scaled dense matrix-dense matrix multiplication
+   //        (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense matrix multiplication by means of the
+   // native packed matrix multiplication kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectPackedAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      typedef ElementType_<MT3>  ET;
+
+      packedGemm( C, A, B, ET(scalar), ET(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices********************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
    /*!\brief BLAS-based addition assignment of a scaled dense matrix-dense matrix multiplication
@@ -6496,7 +6870,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal<MT5>::value ) ||
+      if( ( IsDiagonal<MT4>::value || IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
       else
@@ -7342,11 +7716,63 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline DisableIf_< UseBlasKernel<MT3,MT4,MT5,ST2> >
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectPackedSubAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Packed-based subtraction assignment to dense matrices (default)*****************************
+   /*!\brief Default subtraction assignment of a scaled dense matrix-dense matrix multiplication
+   //        (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a large
+   // scaled dense matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectPackedSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectLargeSubAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
+   //**Packed-based subtraction assignment to dense matrices***************************************
+   /*!\brief Packed subtraction assignment of a scaled dense matrix-dense matrix multiplication
+   //        (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense matrix multiplication by means of the
+   // native packed matrix multiplication kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UsePackedKernel<MT3,MT4,MT5,ST2> >
+      selectPackedSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      typedef ElementType_<MT3>  ET;
+
+      packedGemm( C, A, B, ET(-scalar), ET(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based subraction assignment to dense matrices******************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
    /*!\brief BLAS-based subraction assignment of a scaled dense matrix-dense matrix multiplication
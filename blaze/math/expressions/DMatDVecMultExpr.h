@@ -49,6 +49,8 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/Dispatch.h>
+#include <blaze/math/dense/PackedMult.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -67,6 +69,7 @@
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -74,8 +77,10 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPackedMatrix.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -84,6 +89,7 @@
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -94,6 +100,7 @@
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -182,6 +189,27 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a runtime
+       dispatched kernel, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchKernel {
+      enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value &&
+                            T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                            ( IsFloat< ElementType_<T1> >::value ||
+                              IsDouble< ElementType_<T1> >::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -202,6 +230,23 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type is symmetric and the matrix type and the two involved vector types
+       are suited for a vectorized computation that only reads the lower triangle of the matrix,
+       the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSymmetricKernel {
+      enum : bool { value = UseVectorizedDefaultKernel<T1,T2,T3>::value &&
+                            IsSymmetric<T2>::value && !IsPackedMatrix<T2>::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            HasSIMDSub< ElementType_<T1>, ElementType_<T1> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDVecMultExpr<MT,VT>     This;           //!< Type of this DMatDVecMultExpr instance.
@@ -372,7 +417,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( !BLAZE_BLAS_IS_PARALLEL ||
+      return !IsPackedMatrix<MT>::value &&
+             ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
                ( mat_.rows() * mat_.columns() < DMATDVECMULT_THRESHOLD ) ) &&
              ( size() > SMP_DMATDVECMULT_THRESHOLD );
@@ -440,7 +486,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< Or< IsPackedMatrix<MT1>, UseSymmetricKernel<VT1,MT1,VT2> > >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -452,6 +499,67 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed assignment to dense vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      reset( y );
+      packedMult( y, A, x, ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symmetric assignment to dense vectors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a symmetric dense matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a symmetric dense matrix to the SYMV-style
+   // kernel, which only reads the lower triangle of the matrix. Only in case the matrix is an
+   // unevaluated computation or a parallel BLAS library can be used for a large matrix, the
+   // general kernels are selected.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSymmetricKernel<VT1,MT1,VT2> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      if( IsComputation<MT>::value && !evaluateMatrix )
+         selectSmallAssignKernel( y, A, x );
+      else if( BLAZE_BLAS_IS_PARALLEL && UseBlasKernel<VT1,MT1,VT2>::value &&
+               A.rows() * A.columns() >= DMATDVECMULT_THRESHOLD )
+         selectBlasAssignKernel( y, A, x );
+      else {
+         reset( y );
+         selectSymmetricAddAssignKernel( y, A, x );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense vector multiplication
@@ -1002,7 +1110,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2> >
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAssignKernel( y, A, x );
+      selectDispatchAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1042,6 +1150,60 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors (default)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of a large dense
+   // matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      selectLargeAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(1), ET(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense vector multiplication to a sparse vector
@@ -1123,7 +1285,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< Or< IsPackedMatrix<MT1>, UseSymmetricKernel<VT1,MT1,VT2> > >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1135,6 +1298,115 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      packedMult( y, A, x, ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symmetric addition assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a symmetric dense matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a symmetric dense matrix to the SYMV-style
+   // kernel, which only reads the lower triangle of the matrix. Only in case the matrix is an
+   // unevaluated computation or a parallel BLAS library can be used for a large matrix, the
+   // general kernels are selected.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSymmetricKernel<VT1,MT1,VT2> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      if( IsComputation<MT>::value && !evaluateMatrix )
+         selectSmallAddAssignKernel( y, A, x );
+      else if( BLAZE_BLAS_IS_PARALLEL && UseBlasKernel<VT1,MT1,VT2>::value &&
+               A.rows() * A.columns() >= DMATDVECMULT_THRESHOLD )
+         selectBlasAddAssignKernel( y, A, x );
+      else
+         selectSymmetricAddAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SYMV-style addition assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SYMV-style addition assignment of a symmetric dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for a symmetric dense matrix.
+   // Row \a i of the lower triangle is used both for the dot product with \a x that contributes
+   // to \a y[i] and for the update of \a y[0..i) in place of the upper triangle. Therefore each
+   // element of the lower triangle is read exactly once and the upper triangle is never read.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void selectSymmetricAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      const size_t N( A.rows() );
+
+      for( size_t i=0UL; i<N; ++i )
+      {
+         const size_t jpos( i & size_t(-SIMDSIZE) );
+         BLAZE_INTERNAL_ASSERT( ( i - ( i % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+         const SIMDType xi( set( x[i] ) );
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType a1( A.load(i,j) );
+            xmm1 = xmm1 + a1 * x.load(j);
+            y.store( j, y.load(j) + a1 * xi );
+         }
+
+         ElementType value( sum( xmm1 ) + A(i,i) * x[i] );
+
+         for( ; j<i; ++j ) {
+            value += A(i,j) * x[j];
+            y[j] += A(i,j) * x[i];
+         }
+
+         y[i] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a dense matrix-dense vector multiplication
@@ -1683,7 +1955,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2> >
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAddAssignKernel( y, A, x );
+      selectDispatchAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1724,6 +1996,60 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors (default)***************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a large
+   // dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      selectLargeAddAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched addition assignment to dense vectors*************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a matrix-vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(1), ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -1779,7 +2105,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< Or< IsPackedMatrix<MT1>, UseSymmetricKernel<VT1,MT1,VT2> > >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1791,6 +2118,115 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      packedMult( y, A, x, -ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symmetric subtraction assignment to dense vectors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a symmetric dense matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a symmetric dense matrix to the SYMV-style
+   // kernel, which only reads the lower triangle of the matrix. Only in case the matrix is an
+   // unevaluated computation or a parallel BLAS library can be used for a large matrix, the
+   // general kernels are selected.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSymmetricKernel<VT1,MT1,VT2> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      if( IsComputation<MT>::value && !evaluateMatrix )
+         selectSmallSubAssignKernel( y, A, x );
+      else if( BLAZE_BLAS_IS_PARALLEL && UseBlasKernel<VT1,MT1,VT2>::value &&
+               A.rows() * A.columns() >= DMATDVECMULT_THRESHOLD )
+         selectBlasSubAssignKernel( y, A, x );
+      else
+         selectSymmetricSubAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SYMV-style subtraction assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SYMV-style subtraction assignment of a symmetric dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for a symmetric dense matrix.
+   // Row \a i of the lower triangle is used both for the dot product with \a x that contributes
+   // to \a y[i] and for the update of \a y[0..i) in place of the upper triangle. Therefore each
+   // element of the lower triangle is read exactly once and the upper triangle is never read.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void selectSymmetricSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      const size_t N( A.rows() );
+
+      for( size_t i=0UL; i<N; ++i )
+      {
+         const size_t jpos( i & size_t(-SIMDSIZE) );
+         BLAZE_INTERNAL_ASSERT( ( i - ( i % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+         const SIMDType xi( set( x[i] ) );
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType a1( A.load(i,j) );
+            xmm1 = xmm1 + a1 * x.load(j);
+            y.store( j, y.load(j) - a1 * xi );
+         }
+
+         ElementType value( sum( xmm1 ) + A(i,i) * x[i] );
+
+         for( ; j<i; ++j ) {
+            value += A(i,j) * x[j];
+            y[j] -= A(i,j) * x[i];
+         }
+
+         y[i] -= value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense matrix-dense vector multiplication
@@ -2339,7 +2775,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2> >
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeSubAssignKernel( y, A, x );
+      selectDispatchSubAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2380,6 +2816,60 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors (default)************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a large
+   // dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      selectLargeSubAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched subtraction assignment to dense vectors**********************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a matrix-vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(-1), ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -2783,6 +3273,27 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type, the two involved vector types, and the scalar type are suited
+       for a runtime dispatched kernel, the nested \a value will be set to 1, otherwise it
+       will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseDispatchKernel {
+      enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value &&
+                            T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                            ( IsFloat< ElementType_<T1> >::value ||
+                              IsDouble< ElementType_<T1> >::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! In case the two involved vector types, the matrix type, and the scalar type are suited
@@ -2953,7 +3464,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    */
    inline bool canSMPAssign() const noexcept {
       LeftOperand_<MVM> A( vector_.leftOperand() );
-      return ( !BLAZE_BLAS_IS_PARALLEL ||
+      return !IsPackedMatrix<MT>::value &&
+             ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
                ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) &&
              ( size() > SMP_DMATDVECMULT_THRESHOLD );
@@ -3023,7 +3535,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3034,6 +3547,32 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed assignment to dense vectors**********************************************************
+   /*!\brief Assignment of a scaled packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      reset( y );
+      packedMult( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*!\brief Default assignment of a scaled dense matrix-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3605,7 +4144,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2,ST2> >
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAssignKernel( y, A, x, scalar );
+      selectDispatchAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -3644,6 +4183,60 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors (default)************************************
+   /*!\brief Default assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of a large scaled
+   // dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      selectLargeAssignKernel( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(scalar), ET(0) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a scaled dense matrix-dense vector multiplication to a sparse vector
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3725,7 +4318,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3736,6 +4330,31 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense vectors*************************************************
+   /*!\brief Addition assignment of a scaled packed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      packedMult( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*!\brief Default addition assignment of a scaled dense matrix-dense vector multiplication
    //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
@@ -4285,7 +4904,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2,ST2> >
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAddAssignKernel( y, A, x, scalar );
+      selectDispatchAddAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -4325,6 +4944,60 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors (default)***************************
+   /*!\brief Default addition assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a large
+   // scaled dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      selectLargeAddAssignKernel( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Runtime dispatched addition assignment to dense vectors*************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled matrix-vector multiplication
+   //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(scalar), ET(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -4382,7 +5055,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -4393,6 +5067,31 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense vectors**********************************************
+   /*!\brief Subtraction assignment of a scaled packed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      packedMult( y, A, x, -scalar );
+   }
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*!\brief Default subtraction assignment of a scaled dense matrix-dense vector multiplication
    //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
@@ -4942,7 +5641,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2,ST2> >
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeSubAssignKernel( y, A, x, scalar );
+      selectDispatchSubAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -4982,6 +5681,60 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors (default)************************
+   /*!\brief Default subtraction assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a large
+   // scaled dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      selectLargeSubAssignKernel( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Runtime dispatched subtraction assignment to dense vectors**********************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled matrix-vector multiplication
+   //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(-scalar), ET(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
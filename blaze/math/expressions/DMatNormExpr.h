@@ -0,0 +1,114 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatNormExpr.h
+//  \brief Header file for the dense matrix norm functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATNORMEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATNORMEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatForEachExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the squared Frobenius norm for the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the norm computation.
+// \return The squared Frobenius norm of the given dense matrix.
+//
+// This function computes the squared Frobenius norm (i.e. the sum of the squared absolute values
+// of all elements) of the given dense matrix. The computation is performed by means of a (SIMD
+// vectorized and parallel) reduction. In case the given matrix is an expression (as for instance
+// \c sqrNorm(A-B) ), the expression is fused with the reduction and no temporary matrix is
+// created.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline auto sqrNorm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum( forEach( ~dm, SqrAbs() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Frobenius norm for the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the norm computation.
+// \return The Frobenius norm of the given dense matrix.
+//
+// This function computes the Frobenius norm of the given dense matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   const double dist = frobeniusNorm( A - B );
+   \endcode
+
+// The computation is performed by means of a (SIMD vectorized and parallel) reduction of the
+// squared absolute values of the elements. Element-wise expressions are fused with the reduction,
+// i.e. no temporary matrix is created for \c A-B.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline auto frobeniusNorm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~dm ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,642 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatReduceExpr.h
+//  \brief Header file for the dense matrix reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsConvertible.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense matrix reduction operation.
+// \ingroup dense_matrix
+//
+// The DMatReduceExprHelper class template determines whether the reduction of the dense matrix
+// type \a MT with the reduction operation \a OP can be performed by means of SIMD operations.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DMatReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense matrix expression.
+   typedef RemoveReference_< CompositeType_<MT> >  CT;
+
+   //! Element type of the dense matrix expression.
+   typedef ElementType_<CT>  ET;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   //! Helper structure for the detection of the SIMD capabilities of the given reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+   //**********************************************************************************************
+
+   //**SIMD type detection*************************************************************************
+   //! Helper structure for the detection of the SIMD type of the dense matrix expression.
+   struct UseLoadType {
+      enum : bool { value = IsConvertible< decltype( std::declval<CT>().load( 0UL, 0UL ) )
+                                         , SIMDTrait_<ET> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = If_< Bool<CT::simdEnabled>, UseLoadType, FalseType >::value &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default (i.e. scalar) reduction of the given dense matrix. In
+// case the matrix has either 0 rows or 0 columns, the default value of the element type is
+// returned.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   ET redux( (~dm)(0UL,0UL) );
+
+   if( SO == rowMajor ) {
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, (~dm)(0UL,j) );
+      }
+      for( size_t i=1UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            redux = op( redux, (~dm)(i,j) );
+         }
+      }
+   }
+   else {
+      for( size_t i=1UL; i<M; ++i ) {
+         redux = op( redux, (~dm)(i,0UL) );
+      }
+      for( size_t j=1UL; j<N; ++j ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            redux = op( redux, (~dm)(i,j) );
+         }
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the SIMD optimized reduction of the given row-major dense matrix.
+// In order to hide the latency of the SIMD operations, four independent accumulators are used
+// in the main loop. In case the matrix has either 0 rows or 0 columns, the default value of
+// the element type is returned.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>  ET;
+   typedef SIMDTrait_<ET>    SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   if( N < SIMDSIZE ) {
+      ET redux( (~dm)(0UL,0UL) );
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, (~dm)(0UL,j) );
+      }
+      for( size_t i=1UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            redux = op( redux, (~dm)(i,j) );
+         }
+      }
+      return redux;
+   }
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const bool unroll( jpos >= SIMDSIZE*4UL );
+
+   SIMDType xmm1( (~dm).load(0UL,0UL) ), xmm2, xmm3, xmm4;
+   size_t jbegin( SIMDSIZE );
+
+   if( unroll ) {
+      xmm2 = (~dm).load(0UL,SIMDSIZE    );
+      xmm3 = (~dm).load(0UL,SIMDSIZE*2UL);
+      xmm4 = (~dm).load(0UL,SIMDSIZE*3UL);
+      jbegin = SIMDSIZE*4UL;
+   }
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      size_t j( ( i == 0UL )?( jbegin ):( 0UL ) );
+
+      if( unroll ) {
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            xmm1 = op.load( xmm1, SIMDType( (~dm).load(i,j             ) ) );
+            xmm2 = op.load( xmm2, SIMDType( (~dm).load(i,j+SIMDSIZE    ) ) );
+            xmm3 = op.load( xmm3, SIMDType( (~dm).load(i,j+SIMDSIZE*2UL) ) );
+            xmm4 = op.load( xmm4, SIMDType( (~dm).load(i,j+SIMDSIZE*3UL) ) );
+         }
+      }
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         xmm1 = op.load( xmm1, SIMDType( (~dm).load(i,j) ) );
+      }
+   }
+
+   if( unroll ) {
+      xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+   }
+
+   ET redux( xmm1[0UL] );
+
+   for( size_t k=1UL; k<SIMDSIZE; ++k ) {
+      redux = op( redux, xmm1[k] );
+   }
+
+   if( jpos < N ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jpos; j<N; ++j ) {
+            redux = op( redux, (~dm)(i,j) );
+         }
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the SIMD optimized reduction of the given column-major dense matrix.
+// In order to hide the latency of the SIMD operations, four independent accumulators are used
+// in the main loop. In case the matrix has either 0 rows or 0 columns, the default value of
+// the element type is returned.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   typedef ElementType_<MT>  ET;
+   typedef SIMDTrait_<ET>    SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   if( M < SIMDSIZE ) {
+      ET redux( (~dm)(0UL,0UL) );
+      for( size_t i=1UL; i<M; ++i ) {
+         redux = op( redux, (~dm)(i,0UL) );
+      }
+      for( size_t j=1UL; j<N; ++j ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            redux = op( redux, (~dm)(i,j) );
+         }
+      }
+      return redux;
+   }
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   const bool unroll( ipos >= SIMDSIZE*4UL );
+
+   SIMDType xmm1( (~dm).load(0UL,0UL) ), xmm2, xmm3, xmm4;
+   size_t ibegin( SIMDSIZE );
+
+   if( unroll ) {
+      xmm2 = (~dm).load(SIMDSIZE    ,0UL);
+      xmm3 = (~dm).load(SIMDSIZE*2UL,0UL);
+      xmm4 = (~dm).load(SIMDSIZE*3UL,0UL);
+      ibegin = SIMDSIZE*4UL;
+   }
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      size_t i( ( j == 0UL )?( ibegin ):( 0UL ) );
+
+      if( unroll ) {
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            xmm1 = op.load( xmm1, SIMDType( (~dm).load(i             ,j) ) );
+            xmm2 = op.load( xmm2, SIMDType( (~dm).load(i+SIMDSIZE    ,j) ) );
+            xmm3 = op.load( xmm3, SIMDType( (~dm).load(i+SIMDSIZE*2UL,j) ) );
+            xmm4 = op.load( xmm4, SIMDType( (~dm).load(i+SIMDSIZE*3UL,j) ) );
+         }
+      }
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         xmm1 = op.load( xmm1, SIMDType( (~dm).load(i,j) ) );
+      }
+   }
+
+   if( unroll ) {
+      xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+   }
+
+   ET redux( xmm1[0UL] );
+
+   for( size_t k=1UL; k<SIMDSIZE; ++k ) {
+      redux = op( redux, xmm1[k] );
+   }
+
+   if( ipos < M ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t i=ipos; i<M; ++i ) {
+            redux = op( redux, (~dm)(i,j) );
+         }
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense matrix \a dm by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. In case the callable provides a \a load() function for SIMD vectors (see for
+// instance the blaze::Add, blaze::Mult, blaze::Minimum, and blaze::Maximum functors), the inner
+// loops of the reduction are vectorized. For large matrices the reduction is in addition executed
+// in parallel (see the blaze::SMP_DMATREDUCE_THRESHOLD). The reduction is performed directly on
+// the given matrix expression, i.e. an intermediate temporary is only created in case the given
+// expression requires an intermediate evaluation (as for instance a matrix/matrix multiplication).
+// In case the matrix has either 0 rows or 0 columns, the default value of the element type is
+// returned (e.g. 0 in case of fundamental data types).
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_<MT> tmp( ~dm );  // Evaluation of the dense matrix operand
+
+   return smpReduce( tmp, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense matrix \a dm by means of addition:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalsum = sum( A );  // Results in 10
+   \endcode
+
+// In case the matrix has either 0 rows or 0 columns, the result is 0 (i.e. the default value
+// of the element type).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense matrix \a dm by means of multiplication:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalprod = prod( A );  // Results in 24
+   \endcode
+
+// In case the matrix has either 0 rows or 0 columns, the default value of the element type is
+// returned (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The smallest dense matrix element.
+//
+// This function returns the smallest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The largest dense matrix element.
+//
+// This function returns the largest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ElementType_<MT> max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Maximum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the smallest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The row and column index of the smallest dense matrix element.
+//
+// This function returns the row and column index of the smallest element of the given dense
+// matrix. In case several elements compare equal to the smallest element, the position of the
+// first of these elements in the storage order of the matrix is returned. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned position is (0,0).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline std::pair<size_t,size_t> argmin( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   std::pair<size_t,size_t> index( 0UL, 0UL );
+
+   if( M == 0UL || N == 0UL ) return index;
+
+   ET minimum( A(0UL,0UL) );
+
+   const size_t outer( ( SO == rowMajor )?( M ):( N ) );
+   const size_t inner( ( SO == rowMajor )?( N ):( M ) );
+
+   for( size_t k=0UL; k<outer; ++k ) {
+      for( size_t l=0UL; l<inner; ++l ) {
+         const size_t i( ( SO == rowMajor )?( k ):( l ) );
+         const size_t j( ( SO == rowMajor )?( l ):( k ) );
+         const ET cur( A(i,j) );
+         if( cur < minimum ) {
+            minimum = cur;
+            index   = std::make_pair( i, j );
+         }
+      }
+   }
+
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the largest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The row and column index of the largest dense matrix element.
+//
+// This function returns the row and column index of the largest element of the given dense
+// matrix. In case several elements compare equal to the largest element, the position of the
+// first of these elements in the storage order of the matrix is returned. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned position is (0,0).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline std::pair<size_t,size_t> argmax( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>    ET;
+   typedef CompositeType_<MT>  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   std::pair<size_t,size_t> index( 0UL, 0UL );
+
+   if( M == 0UL || N == 0UL ) return index;
+
+   ET maximum( A(0UL,0UL) );
+
+   const size_t outer( ( SO == rowMajor )?( M ):( N ) );
+   const size_t inner( ( SO == rowMajor )?( N ):( M ) );
+
+   for( size_t k=0UL; k<outer; ++k ) {
+      for( size_t l=0UL; l<inner; ++l ) {
+         const size_t i( ( SO == rowMajor )?( k ):( l ) );
+         const size_t j( ( SO == rowMajor )?( l ):( k ) );
+         const ET cur( A(i,j) );
+         if( maximum < cur ) {
+            maximum = cur;
+            index   = std::make_pair( i, j );
+         }
+      }
+   }
+
+   return index;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -58,6 +59,8 @@
 #include <blaze/math/traits/TDMatTransExprTrait.h>
 #include <blaze/math/traits/TransExprTrait.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -76,6 +79,7 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Reference.h>
 #include <blaze/util/EmptyType.h>
@@ -86,6 +90,7 @@
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -134,6 +139,28 @@ class DMatTransExpr : public DenseMatrix< DMatTransExpr<MT,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Transposition kernel************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense matrix operand does not require an intermediate evaluation, both the
+       operand and the target matrix of type \a MT2 provide low-level data access, the storage
+       order of the target matrix requires an actual transposition of the operand, and both
+       matrices have the same, vectorizable element type, \a value is set to 1 and the assignment
+       is performed by the blocked transposition kernel. Otherwise \a value is set to 0 and the
+       assignment is performed element by element. */
+   template< typename MT2 >
+   struct UseTransposeKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            !useAssign &&
+                            HasConstDataAccess<MT>::value &&
+                            HasMutableDataAccess<MT2>::value &&
+                            IsColumnMajorMatrix<MT2>::value != SO &&
+                            IsSame< ElementType_<MT2>, ElementType_<MT> >::value &&
+                            TransposeTraits< ElementType_<MT> >::vectorizable };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Parallel evaluation strategy****************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -648,6 +675,40 @@ class DMatTransExpr : public DenseMatrix< DMatTransExpr<MT,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense matrices (transposition kernel)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix transposition expression to a dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // transposition expression to a dense matrix with the opposite storage order of the dense
+   // matrix operand. Instead of an element-wise assignment, the operand is transposed by the
+   // cache-oblivious, SIMD-blocked transposition kernel. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case both
+   // the operand and the target matrix provide low-level data access.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseTransposeKernel<MT2> >
+      assign( DenseMatrix<MT2,SO2>& lhs, const DMatTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const size_t m( SO ? rhs.dm_.rows() : rhs.dm_.columns() );
+      const size_t n( SO ? rhs.dm_.columns() : rhs.dm_.rows() );
+
+      transposeKernel( m, n, rhs.dm_.data(), rhs.dm_.spacing(), (~lhs).data(), (~lhs).spacing() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix transposition expression to a sparse matrix.
@@ -0,0 +1,276 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DVecNormExpr.h
+//  \brief Header file for the dense vector norm functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DVECNORMEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DVECNORMEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecForEachExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Pow.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/shims/Pow.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The squared L2 norm of the given dense vector.
+//
+// This function computes the squared L2 norm of the given dense vector:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double norm = sqrNorm( a );
+   \endcode
+
+// The computation is performed by means of a (SIMD vectorized and parallel) reduction of the
+// squared absolute values of the elements. In case the given vector is an expression (as for
+// instance \c sqrNorm(a-b) ), the expression is fused with the reduction and no temporary vector
+// is created.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto sqrNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum( forEach( ~dv, SqrAbs() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The L1 norm of the given dense vector.
+//
+// This function computes the L1 norm (i.e. the sum of the absolute values of all elements) of
+// the given dense vector:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double norm = l1Norm( a );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto l1Norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum( abs( ~dv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The L2 norm of the given dense vector.
+//
+// This function computes the L2 norm (i.e. the Euclidean norm) of the given dense vector:
+
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+   const double dist = l2Norm( a - b );
+   \endcode
+
+// The computation is performed by means of a (SIMD vectorized and parallel) reduction of the
+// squared absolute values of the elements. In case the given vector is an expression (as for
+// instance \c l2Norm(a-b) ), the expression is fused with the reduction and no temporary vector
+// is created.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto l2Norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~dv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the infinity norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The infinity norm of the given dense vector.
+//
+// This function computes the infinity norm (i.e. the largest absolute value of all elements) of
+// the given dense vector:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double norm = linfNorm( a );
+   \endcode
+
+// In case the vector has a size of 0, the result is 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto linfNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return max( abs( ~dv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the Lp norm for the special case \f$ p = 1 \f$.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The L1 norm of the given dense vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm_backend( const DenseVector<VT,TF>& dv, IntegralConstant<size_t,1UL> )
+{
+   return l1Norm( ~dv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the Lp norm for the special case \f$ p = 2 \f$.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The L2 norm of the given dense vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm_backend( const DenseVector<VT,TF>& dv, IntegralConstant<size_t,2UL> )
+{
+   return l2Norm( ~dv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the Lp norm for a general \a P.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The Lp norm of the given dense vector.
+*/
+template< size_t P     // Norm parameter
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm_backend( const DenseVector<VT,TF>& dv, IntegralConstant<size_t,P> )
+{
+   typedef ElementType_< DVecForEachExpr<VT,Abs,TF> >  AT;
+
+   return pow( sum( forEach( abs( ~dv ), Pow<AT>( AT( P ) ) ) ), 1.0 / P );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Lp norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The Lp norm of the given dense vector.
+//
+// This function computes the Lp norm of the given dense vector, where the norm parameter \a P
+// is specified as compile time parameter:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double norm1 = lpNorm<1>( a );  // Equivalent to l1Norm( a )
+   const double norm3 = lpNorm<3>( a );
+   \endcode
+
+// The L1 and L2 norms are forwarded to the l1Norm() and l2Norm() functions, respectively. In
+// case the norm parameter \a P is 0, a compilation error is created.
+*/
+template< size_t P     // Norm parameter
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( P > 0UL, "Invalid norm parameter detected" );
+
+   return lpNorm_backend( ~dv, IntegralConstant<size_t,P>() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,482 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DVecReduceExpr.h
+//  \brief Header file for the dense vector reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Maximum.h>
+#include <blaze/math/functors/Minimum.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsConvertible.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector reduction operation.
+// \ingroup dense_vector
+//
+// The DVecReduceExprHelper class template determines whether the reduction of the dense vector
+// type \a VT with the reduction operation \a OP can be performed by means of SIMD operations.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense vector expression.
+   typedef RemoveReference_< CompositeType_<VT> >  CT;
+
+   //! Element type of the dense vector expression.
+   typedef ElementType_<CT>  ET;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   //! Helper structure for the detection of the SIMD capabilities of the given reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+   //**********************************************************************************************
+
+   //**SIMD type detection*************************************************************************
+   //! Helper structure for the detection of the SIMD type of the dense vector expression.
+   struct UseLoadType {
+      enum : bool { value = IsConvertible< decltype( std::declval<CT>().load( 0UL ) )
+                                         , SIMDTrait_<ET> >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = If_< Bool<CT::simdEnabled>, UseLoadType, FalseType >::value &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default (i.e. scalar) reduction of the given dense vector. In
+// case the vector has a size of 0, the default value of the element type is returned.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef ElementType_<VT>  ET;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   ET redux( (~dv)[0UL] );
+
+   for( size_t i=1UL; i<N; ++i ) {
+      redux = op( redux, (~dv)[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the SIMD optimized reduction of the given dense vector. In order to
+// hide the latency of the SIMD operations, four independent accumulators are used in the main
+// loop. In case the vector has a size of 0, the default value of the element type is returned.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef ElementType_<VT>  ET;
+   typedef SIMDTrait_<ET>    SIMDType;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   if( N < SIMDSIZE ) {
+      ET redux( (~dv)[0UL] );
+      for( size_t i=1UL; i<N; ++i ) {
+         redux = op( redux, (~dv)[i] );
+      }
+      return redux;
+   }
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   SIMDType xmm1( (~dv).load(0UL) );
+   size_t i( SIMDSIZE );
+
+   if( ipos >= SIMDSIZE*4UL )
+   {
+      SIMDType xmm2( (~dv).load(i          ) );
+      SIMDType xmm3( (~dv).load(i+SIMDSIZE ) );
+      SIMDType xmm4( (~dv).load(i+SIMDSIZE*2UL) );
+      i += SIMDSIZE*3UL;
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         xmm1 = op.load( xmm1, SIMDType( (~dv).load(i             ) ) );
+         xmm2 = op.load( xmm2, SIMDType( (~dv).load(i+SIMDSIZE    ) ) );
+         xmm3 = op.load( xmm3, SIMDType( (~dv).load(i+SIMDSIZE*2UL) ) );
+         xmm4 = op.load( xmm4, SIMDType( (~dv).load(i+SIMDSIZE*3UL) ) );
+      }
+
+      xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+   }
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      xmm1 = op.load( xmm1, SIMDType( (~dv).load(i) ) );
+   }
+
+   ET redux( xmm1[0UL] );
+
+   for( size_t k=1UL; k<SIMDSIZE; ++k ) {
+      redux = op( redux, xmm1[k] );
+   }
+
+   for( ; i<N; ++i ) {
+      redux = op( redux, (~dv)[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( a, blaze::Add() );
+   const double totalsum2 = reduce( a, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. In case the callable provides a \a load() function for SIMD vectors (see for
+// instance the blaze::Add, blaze::Mult, blaze::Minimum, and blaze::Maximum functors), the inner
+// loops of the reduction are vectorized. For large vectors the reduction is in addition executed
+// in parallel (see the blaze::SMP_DVECREDUCE_THRESHOLD). The reduction is performed directly on
+// the given vector expression, i.e. an intermediate temporary is only created in case the given
+// expression requires an intermediate evaluation (as for instance a matrix/vector multiplication).
+// In case the vector has a size of 0, the default value of the element type is returned (e.g. 0
+// in case of fundamental data types).
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also, the
+// operation is undefined if the given reduction operation modifies the values.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<VT> reduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_<VT> tmp( ~dv );  // Evaluation of the dense vector operand
+
+   return smpReduce( tmp, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of addition.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of addition:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalsum = sum( a );  // Results in 10
+   \endcode
+
+// In case the vector has a size of 0, the result is 0 (i.e. the default value of the element
+// type).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> sum( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of multiplication.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of multiplication:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalprod = prod( a );  // Results in 24
+   \endcode
+
+// In case the vector has a size of 0, the default value of the element type is returned (e.g.
+// 0 in case of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> prod( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The smallest dense vector element.
+//
+// This function returns the smallest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> min( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Minimum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The largest dense vector element.
+//
+// This function returns the largest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_<VT> max( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Maximum() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The index of the smallest dense vector element.
+//
+// This function returns the index of the smallest element of the given dense vector. In case
+// several elements compare equal to the smallest element, the index of the first of these
+// elements is returned. This function can only be used for element types that support the
+// smaller-than relationship. In case the vector currently has a size of 0, the returned index
+// is 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t argmin( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() < 2UL ) return 0UL;
+
+   size_t index( 0UL );
+   ET minimum( a[0UL] );
+
+   for( size_t i=1UL; i<a.size(); ++i ) {
+      const ET cur( a[i] );
+      if( cur < minimum ) {
+         minimum = cur;
+         index   = i;
+      }
+   }
+
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The index of the largest dense vector element.
+//
+// This function returns the index of the largest element of the given dense vector. In case
+// several elements compare equal to the largest element, the index of the first of these
+// elements is returned. This function can only be used for element types that support the
+// smaller-than relationship. In case the vector currently has a size of 0, the returned index
+// is 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t argmax( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<VT>    ET;
+   typedef CompositeType_<VT>  CT;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() < 2UL ) return 0UL;
+
+   size_t index( 0UL );
+   ET maximum( a[0UL] );
+
+   for( size_t i=1UL; i<a.size(); ++i ) {
+      const ET cur( a[i] );
+      if( maximum < cur ) {
+         maximum = cur;
+         index   = i;
+      }
+   }
+
+   return index;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
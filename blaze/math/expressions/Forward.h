@@ -48,8 +48,10 @@ template< typename, bool > struct DenseMatrix;
 template< typename, bool > struct DenseVector;
 template< typename, typename, bool > class DMatDMatAddExpr;
 template< typename, typename > class DMatDMatMultExpr;
+template< typename, typename, bool > class DMatDMatSolveExpr;
 template< typename, typename, bool > class DMatDMatSubExpr;
 template< typename, typename > class DMatDVecMultExpr;
+template< typename, typename > class DMatDVecSolveExpr;
 template< typename, bool > class DMatEvalExpr;
 template< typename, typename, bool > class DMatForEachExpr;
 template< typename, bool > class DMatInvExpr;
@@ -56,6 +56,7 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/BlockCompressedMult.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/DMatDVecMultExprTrait.h>
 #include <blaze/math/traits/DMatSVecMultExprTrait.h>
@@ -73,6 +74,7 @@
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBlockCompressedMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -96,6 +98,7 @@
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
@@ -153,10 +156,11 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The IsEvaluationRequired struct is a helper struct for the selection of the parallel
        evaluation strategy. In case either of the two matrix operands requires an intermediate
-       evaluation, the nested \value will be set to 1, otherwise it will be 0. */
+       evaluation or the left-hand side operand is a BlockCompressedMatrix, the nested \value
+       will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct IsEvaluationRequired {
-      enum : bool { value = ( evaluateLeft || evaluateRight ) };
+      enum : bool { value = ( evaluateLeft || evaluateRight || IsBlockCompressedMatrix<MT1>::value ) };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -169,6 +173,7 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    template< typename T1, typename T2, typename T3 >
    struct UseVectorizedKernel {
       enum : bool { value = useOptimizedKernels &&
+                            !IsBlockCompressedMatrix<T2>::value &&
                             !IsDiagonal<T3>::value &&
                             T1::simdEnabled && T3::simdEnabled &&
                             IsRowMajorMatrix<T1>::value &&
@@ -191,6 +196,7 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    struct UseOptimizedKernel {
       enum : bool { value = useOptimizedKernels &&
                             !UseVectorizedKernel<T1,T2,T3>::value &&
+                            !IsBlockCompressedMatrix<T2>::value &&
                             !IsDiagonal<T3>::value &&
                             !IsResizable< ElementType_<T1> >::value &&
                             !IsResizable<ET1>::value };
@@ -201,12 +207,14 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case neither a vectorized nor optimized computation is possible, the nested \value will
-       be set to 1, otherwise it will be 0. */
+   /*! In case neither a vectorized nor optimized computation is possible and the left-hand side
+       operand is not a BlockCompressedMatrix, the nested \value will be set to 1, otherwise it
+       will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
       enum : bool { value = !UseVectorizedKernel<T1,T2,T3>::value &&
-                            !UseOptimizedKernel<T1,T2,T3>::value };
+                            !UseOptimizedKernel<T1,T2,T3>::value &&
+                            !IsBlockCompressedMatrix<T2>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -760,6 +768,30 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense matrices (block compressed)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a BlockCompressedMatrix-dense matrix multiplication to dense matrices
+   //        (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the assignment to the block multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT4> >
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      blockMult( C, A, B, BlockAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1136,6 +1168,30 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense matrices (block compressed)***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a BlockCompressedMatrix-dense matrix multiplication to dense matrices
+   //        (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the block multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT4> >
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      blockMult( C, A, B, BlockAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse matrices******************************************************
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1479,6 +1535,30 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense matrices (block compressed)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a BlockCompressedMatrix-dense matrix multiplication to dense matrices
+   //        (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the block multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT4> >
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      blockMult( C, A, B, BlockSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse matrices***************************************************
    // No special implementation for the subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -1526,7 +1606,53 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      smpAssign( ~lhs, A * B );
+      selectSmpAssignKernel( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP assignment of a sparse matrix-dense matrix multiplication to dense
+   //        matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< IsBlockCompressedMatrix<MT4> >
+      selectSmpAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      smpAssign( C, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices (block compressed)********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a BlockCompressedMatrix-dense matrix multiplication to dense matrices
+   //        (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the SMP assignment to the block multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT4> >
+      selectSmpAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      smpBlockMult( C, A, B, BlockAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1607,7 +1733,53 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      smpAddAssign( ~lhs, A * B );
+      selectSmpAddAssignKernel( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP addition assignment to dense matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP addition assignment of a sparse matrix-dense matrix multiplication to dense
+   //        matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< IsBlockCompressedMatrix<MT4> >
+      selectSmpAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      smpAddAssign( C, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices (block compressed)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a BlockCompressedMatrix-dense matrix multiplication to dense matrices
+   //        (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the SMP addition assignment to the block multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT4> >
+      selectSmpAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      smpBlockMult( C, A, B, BlockAddAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1652,7 +1824,53 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      smpSubAssign( ~lhs, A * B );
+      selectSmpSubAssignKernel( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP subtraction assignment to dense matrices*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP subtraction assignment of a sparse matrix-dense matrix multiplication to dense
+   //        matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< IsBlockCompressedMatrix<MT4> >
+      selectSmpSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      smpSubAssign( C, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices (block compressed)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a BlockCompressedMatrix-dense matrix multiplication to dense matrices
+   //        (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the SMP subtraction assignment to the block multiplication kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT4> >
+      selectSmpSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      smpBlockMult( C, A, B, BlockSubAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -54,15 +54,19 @@
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/BlockCompressedMult.h>
+#include <blaze/math/sparse/SellMult.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBlockCompressedMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSellMatrix.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
@@ -74,6 +78,7 @@
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -124,8 +129,11 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
        the vector operand requires an intermediate evaluation or the dense vector expression
        is a compound expression, \a useAssign will be set to \a true and the multiplication
        expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   enum : bool { useAssign = evaluateMatrix || evaluateVector };
+       will be set to \a false and the expression will be evaluated via the subscript operator.
+       Products with a SellMatrix or a BlockCompressedMatrix are always evaluated via the
+       \a assign function family in order to use the according multiplication kernels. */
+   enum : bool { useAssign = evaluateMatrix || evaluateVector ||
+                             IsSellMatrix<MT>::value || IsBlockCompressedMatrix<MT>::value };
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -342,7 +350,77 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      assign( ~lhs, A * x );
+      selectAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< IsSellMatrix<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      assign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (SELL-C-sigma)**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment to the vectorized SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      sellMult( y, A, x, SellAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (block compressed)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      blockMult( y, A, x, BlockAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -417,7 +495,77 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      addAssign( ~lhs, A * x );
+      selectAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< IsSellMatrix<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      addAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (SELL-C-sigma)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the vectorized SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      sellMult( y, A, x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (block compressed)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      blockMult( y, A, x, BlockAddAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -462,7 +610,77 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      subAssign( ~lhs, A * x );
+      selectSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< IsSellMatrix<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      subAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (SELL-C-sigma)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the vectorized SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      sellMult( y, A, x, SellSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (block compressed)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      blockMult( y, A, x, BlockSubAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -583,7 +801,77 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAssign( ~lhs, A * x );
+      selectSmpAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default smp assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< IsSellMatrix<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (SELL-C-sigma)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP assignment to the vectorized SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSellMult( y, A, x, SellAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (block compressed)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpBlockMult( y, A, x, BlockAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -656,7 +944,77 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAddAssign( ~lhs, A * x );
+      selectSmpAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default smp addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP addition assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< IsSellMatrix<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpAddAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (SELL-C-sigma)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP addition assignment to the vectorized SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSellMult( y, A, x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (block compressed)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP addition assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpBlockMult( y, A, x, BlockAddAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -700,7 +1058,77 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpSubAssign( ~lhs, A * x );
+      selectSmpSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default smp subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP subtraction assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< IsSellMatrix<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSubAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (SELL-C-sigma)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP subtraction assignment to the vectorized SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSellMult( y, A, x, SellSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (block compressed)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP subtraction assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpBlockMult( y, A, x, BlockSubAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
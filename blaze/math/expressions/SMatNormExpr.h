@@ -0,0 +1,127 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SMatNormExpr.h
+//  \brief Header file for the sparse matrix norm functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SMATNORMEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SMATNORMEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/SMatForEachExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the squared Frobenius norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The squared Frobenius norm of the given sparse matrix.
+//
+// This function computes the squared Frobenius norm (i.e. the sum of the squared absolute values
+// of all elements) of the given sparse matrix. Only the non-zero elements of the matrix are
+// traversed.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline auto sqrNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef CompositeType_<MT>                             CT;
+   typedef ConstIterator_< RemoveReference_<CT> >         ConstIterator;
+   typedef ElementType_< SMatForEachExpr<MT,SqrAbs,SO> >  RT;
+
+   CT tmp( ~sm );
+
+   const SqrAbs sqrAbs = SqrAbs();
+   const size_t N( SO ? tmp.columns() : tmp.rows() );
+
+   RT norm = RT();
+   for( size_t i=0UL; i<N; ++i ) {
+      const ConstIterator end( tmp.end(i) );
+      for( ConstIterator element=tmp.begin(i); element!=end; ++element )
+         norm += sqrAbs( element->value() );
+   }
+   return norm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Frobenius norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The Frobenius norm of the given sparse matrix.
+//
+// This function computes the Frobenius norm of the given sparse matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+   const double norm = frobeniusNorm( A );
+   \endcode
+
+// Only the non-zero elements of the matrix are traversed.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline auto frobeniusNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~sm ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
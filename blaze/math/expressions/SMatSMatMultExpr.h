@@ -40,8 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
-#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
@@ -53,10 +51,11 @@
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/SpGemm.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -466,7 +465,10 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    // \return void
    //
    // This function implements the performance optimized assignment of a sparse matrix-sparse
-   // matrix multiplication expression to a row-major sparse matrix.
+   // matrix multiplication expression to a row-major sparse matrix. The product is computed by
+   // means of a two-phase (symbolic/numeric) row-wise multiplication, which reserves the exact
+   // number of non-zero elements and requires no scratch memory proportional to the number of
+   // columns for sparse rows (see the spgemm() function).
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline void assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
@@ -476,9 +478,6 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef ConstIterator_< RemoveReference_<CT1> >  LeftIterator;
-      typedef ConstIterator_< RemoveReference_<CT2> >  RightIterator;
-
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -489,91 +488,7 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      // (Over-)Estimating the number of non-zero entries in the resulting matrix
-      size_t nonzeros( 0UL );
-
-      for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
-            nonzeros += B.nonZeros( lelem->index() );
-         }
-      }
-
-      if( nonzeros > (~lhs).rows() * (~lhs).columns() ) {
-         nonzeros = (~lhs).rows() * (~lhs).columns();
-      }
-
-      (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
-
-      // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).columns(), ElementType() );
-      std::vector<byte_t>      valid  ( (~lhs).columns(), 0   );
-      std::vector<size_t>      indices( (~lhs).columns(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
-
-      for( size_t i=0UL; i<(~lhs).rows(); ++i )
-      {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
-         {
-            const RightIterator rend( B.end( lelem->index() ) );
-            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
-            {
-               if( !valid[relem->index()] ) {
-                  values[relem->index()] = lelem->value() * relem->value();
-                  valid [relem->index()] = 1;
-                  indices[nonzeros] = relem->index();
-                  ++nonzeros;
-                  if( relem->index() < minIndex ) minIndex = relem->index();
-                  if( relem->index() > maxIndex ) maxIndex = relem->index();
-               }
-               else {
-                  values[relem->index()] += lelem->value() * relem->value();
-               }
-            }
-         }
-
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).columns(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t j=0UL; j<nonzeros; ++j )
-               {
-                  const size_t index( indices[j] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( i, index, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t j=minIndex; j<=maxIndex; ++j )
-               {
-                  if( !isDefault( values[j] ) ) {
-                     (~lhs).append( i, j, values[j] );
-                     reset( values[j] );
-                  }
-
-                  reset( valid [j] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
-
-         (~lhs).finalize( i );
-      }
+      spgemm( ~lhs, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -907,6 +822,50 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to row-major sparse matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a row-major sparse
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-sparse
+   // matrix multiplication expression to a row-major sparse matrix. In case the target is a
+   // compressed matrix, the rows of the product are computed in parallel by means of the
+   // smpSpgemm() function. Due to the explicit application of the SFINAE principle this function
+   // can only be selected by the compiler in case neither of the two matrix operands requires an
+   // intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline DisableIf_< IsEvaluationRequired<MT,MT1,MT2> >
+      smpAssign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      smpSpgemm( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP assignment to column-major matrices***************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP assignment of a sparse matrix-sparse matrix multiplication to a
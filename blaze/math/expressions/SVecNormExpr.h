@@ -0,0 +1,281 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SVecNormExpr.h
+//  \brief Header file for the sparse vector norm functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SVECNORMEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SVECNORMEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/SVecForEachExpr.h>
+#include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Pow.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The squared L2 norm of the given sparse vector.
+//
+// This function computes the squared L2 norm of the given sparse vector. Only the non-zero
+// elements of the vector are traversed.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto sqrNorm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef CompositeType_<VT>                             CT;
+   typedef ConstIterator_< RemoveReference_<CT> >         ConstIterator;
+   typedef ElementType_< SVecForEachExpr<VT,SqrAbs,TF> >  RT;
+
+   CT tmp( ~sv );
+
+   const SqrAbs sqrAbs = SqrAbs();
+
+   RT norm = RT();
+   for( ConstIterator element=tmp.begin(); element!=tmp.end(); ++element )
+      norm += sqrAbs( element->value() );
+   return norm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The L1 norm of the given sparse vector.
+//
+// This function computes the L1 norm (i.e. the sum of the absolute values of all elements) of
+// the given sparse vector. Only the non-zero elements of the vector are traversed.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto l1Norm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef CompositeType_<VT>                          CT;
+   typedef ConstIterator_< RemoveReference_<CT> >      ConstIterator;
+   typedef ElementType_< SVecForEachExpr<VT,Abs,TF> >  RT;
+
+   CT tmp( ~sv );
+
+   RT norm = RT();
+   for( ConstIterator element=tmp.begin(); element!=tmp.end(); ++element )
+      norm += abs( element->value() );
+   return norm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The L2 norm of the given sparse vector.
+//
+// This function computes the L2 norm (i.e. the Euclidean norm) of the given sparse vector. Only
+// the non-zero elements of the vector are traversed.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto l2Norm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~sv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the infinity norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The infinity norm of the given sparse vector.
+//
+// This function computes the infinity norm (i.e. the largest absolute value of all elements) of
+// the given sparse vector. Only the non-zero elements of the vector are traversed. In case the
+// vector does not contain any non-zero elements, the result is 0.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto linfNorm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef CompositeType_<VT>                          CT;
+   typedef ConstIterator_< RemoveReference_<CT> >      ConstIterator;
+   typedef ElementType_< SVecForEachExpr<VT,Abs,TF> >  RT;
+
+   CT tmp( ~sv );
+
+   RT norm = RT();
+   for( ConstIterator element=tmp.begin(); element!=tmp.end(); ++element ) {
+      const RT value( abs( element->value() ) );
+      if( norm < value ) norm = value;
+   }
+   return norm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the Lp norm for the special case \f$ p = 1 \f$.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The L1 norm of the given sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm_backend( const SparseVector<VT,TF>& sv, IntegralConstant<size_t,1UL> )
+{
+   return l1Norm( ~sv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the Lp norm for the special case \f$ p = 2 \f$.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The L2 norm of the given sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm_backend( const SparseVector<VT,TF>& sv, IntegralConstant<size_t,2UL> )
+{
+   return l2Norm( ~sv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the Lp norm for a general \a P.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The Lp norm of the given sparse vector.
+*/
+template< size_t P     // Norm parameter
+        , typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm_backend( const SparseVector<VT,TF>& sv, IntegralConstant<size_t,P> )
+{
+   typedef CompositeType_<VT>                          CT;
+   typedef ConstIterator_< RemoveReference_<CT> >      ConstIterator;
+   typedef ElementType_< SVecForEachExpr<VT,Abs,TF> >  AT;
+   typedef decltype( pow( AT(), AT() ) )               RT;
+
+   CT tmp( ~sv );
+
+   RT norm = RT();
+   for( ConstIterator element=tmp.begin(); element!=tmp.end(); ++element )
+      norm += pow( abs( element->value() ), AT( P ) );
+   return pow( norm, 1.0 / P );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Lp norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The Lp norm of the given sparse vector.
+//
+// This function computes the Lp norm of the given sparse vector, where the norm parameter \a P
+// is specified as compile time parameter:
+
+   \code
+   blaze::CompressedVector<double> a;
+   // ... Resizing and initialization
+   const double norm3 = lpNorm<3>( a );
+   \endcode
+
+// The L1 and L2 norms are forwarded to the l1Norm() and l2Norm() functions, respectively. In
+// case the norm parameter \a P is 0, a compilation error is created.
+*/
+template< size_t P     // Norm parameter
+        , typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline auto lpNorm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( P > 0UL, "Invalid norm parameter detected" );
+
+   return lpNorm_backend( ~sv, IntegralConstant<size_t,P>() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -48,6 +48,8 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
+#include <blaze/math/dense/Dispatch.h>
+#include <blaze/math/dense/PackedMult.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -74,6 +76,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPackedMatrix.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsTriangular.h>
@@ -84,6 +87,7 @@
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -182,6 +186,27 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a runtime
+       dispatched kernel, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDispatchKernel {
+      enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value &&
+                            T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                            ( IsFloat< ElementType_<T1> >::value ||
+                              IsDouble< ElementType_<T1> >::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -372,7 +397,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( !BLAZE_BLAS_IS_PARALLEL ||
+      return !IsPackedMatrix<MT>::value &&
+             ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
                ( mat_.rows() * mat_.columns() < TDMATDVECMULT_THRESHOLD ) ) &&
              ( size() > SMP_TDMATDVECMULT_THRESHOLD );
@@ -440,7 +466,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -452,6 +479,32 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed assignment to dense vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      reset( y );
+      packedMult( y, A, x, ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense matrix-dense vector multiplication
@@ -920,7 +973,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2> >
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAssignKernel( y, A, x );
+      selectDispatchAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -960,6 +1013,60 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors (default)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of a large transpose
+   // dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      selectLargeAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(1), ET(0) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose dense matrix-dense vector multiplication to a sparse vector
@@ -1041,7 +1148,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1053,6 +1161,31 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      packedMult( y, A, x, ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense matrix-dense vector multiplication
@@ -1514,7 +1647,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2> >
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAddAssignKernel( y, A, x );
+      selectDispatchAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1555,6 +1688,60 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors (default)***************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a large
+   // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      selectLargeAddAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched addition assignment to dense vectors*************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a transpose matrix-vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(1), ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -1610,7 +1797,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1622,6 +1810,31 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      packedMult( y, A, x, -ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense matrix-dense vector multiplication
@@ -2085,7 +2298,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2> >
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeSubAssignKernel( y, A, x );
+      selectDispatchSubAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2126,6 +2339,60 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors (default)************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a large
+   // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      selectLargeSubAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched subtraction assignment to dense vectors**********************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a transpose matrix-vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(-1), ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -2530,6 +2797,27 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type, the two involved vector types, and the scalar type are suited
+       for a runtime dispatched kernel, the nested \a value will be set to 1, otherwise it
+       will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseDispatchKernel {
+      enum : bool { value = BLAZE_RUNTIME_DISPATCH_MODE &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            HasConstDataAccess<T3>::value &&
+                            !IsDiagonal<T2>::value &&
+                            T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                            ( IsFloat< ElementType_<T1> >::value ||
+                              IsDouble< ElementType_<T1> >::value ) &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                            !( IsBuiltin< ElementType_<T1> >::value && IsComplex<T4>::value ) };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! In case the two involved vector types, the matrix type, and the scalar type are suited
@@ -2700,7 +2988,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    */
    inline bool canSMPAssign() const noexcept {
       LeftOperand_<MVM> A( vector_.leftOperand() );
-      return ( !BLAZE_BLAS_IS_PARALLEL ||
+      return !IsPackedMatrix<MT>::value &&
+             ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
                ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) ) &&
              ( size() > SMP_TDMATDVECMULT_THRESHOLD );
@@ -2770,7 +3059,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -2781,6 +3071,32 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed assignment to dense vectors**********************************************************
+   /*!\brief Assignment of a scaled packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      reset( y );
+      packedMult( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*!\brief Default assignment of a scaled transpose dense matrix-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3263,7 +3579,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2,ST2> >
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAssignKernel( y, A, x, scalar );
+      selectDispatchAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -3302,6 +3618,60 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors (default)************************************
+   /*!\brief Default assignment of a scaled transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of a large scaled
+   // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      selectLargeAssignKernel( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled transpose matrix-vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(scalar), ET(0) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a scaled transpose dense matrix-dense vector multiplication to a sparse
    //        vector (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3383,7 +3753,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3394,6 +3765,31 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense vectors*************************************************
+   /*!\brief Addition assignment of a scaled packed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      packedMult( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*!\brief Default addition assignment of a scaled transpose dense matrix-dense vector
    //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
@@ -3819,7 +4215,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2,ST2> >
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAddAssignKernel( y, A, x, scalar );
+      selectDispatchAddAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -3859,6 +4255,60 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors (default)***************************
+   /*!\brief Default addition assignment of a scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a large
+   // scaled transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      selectLargeAddAssignKernel( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Runtime dispatched addition assignment to dense vectors*************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled transpose matrix-vector
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(scalar), ET(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -3916,7 +4366,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3927,6 +4378,31 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense vectors**********************************************
+   /*!\brief Subtraction assignment of a scaled packed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      packedMult( y, A, x, -scalar );
+   }
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*!\brief Default subtraction assignment of a scaled transpose dense matrix-dense vector
    //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
@@ -4352,7 +4828,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline DisableIf_< UseBlasKernel<VT1,MT1,VT2,ST2> >
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeSubAssignKernel( y, A, x, scalar );
+      selectDispatchSubAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -4392,6 +4868,60 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors (default)************************
+   /*!\brief Default subtraction assignment of a scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a large
+   // scaled transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      selectLargeSubAssignKernel( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Runtime dispatched subtraction assignment to dense vectors**********************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled transpose matrix-vector
+   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseDispatchKernel<VT1,MT1,VT2,ST2> >
+      selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      typedef ElementType_<VT1>  ET;
+
+      dispatchGemv( y, A, x, ET(-scalar), ET(1) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
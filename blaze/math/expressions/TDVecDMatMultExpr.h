@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/RowVector.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TVecMatMultExpr.h>
+#include <blaze/math/dense/PackedMult.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -76,6 +77,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPackedMatrix.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsTriangular.h>
@@ -373,7 +375,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( !BLAZE_BLAS_IS_PARALLEL ||
+      return !IsPackedMatrix<MT>::value &&
+             ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
                ( mat_.rows() * mat_.columns() < TDVECDMATMULT_THRESHOLD ) ) &&
              ( size() > SMP_TDVECDMATMULT_THRESHOLD );
@@ -441,7 +444,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -453,6 +457,32 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed assignment to dense vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose dense vector-packed matrix multiplication to a dense vector
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed matrix operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      reset( y );
+      packedMult( y, A, x, ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense vector-dense matrix multiplication
@@ -1043,7 +1073,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1055,6 +1086,31 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose dense vector-packed matrix multiplication
+   //        to a dense vector (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed matrix operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      packedMult( y, A, x, ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense vector-dense matrix multiplication
@@ -1612,7 +1668,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1624,6 +1681,31 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose dense vector-packed matrix multiplication
+   //        to a dense vector (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed matrix operand.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      packedMult( y, A, x, -ElementType_<MT1>( 1 ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense vector-dense matrix multiplication
@@ -2701,7 +2783,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    */
    inline bool canSMPAssign() const noexcept {
       RightOperand_<VMM> A( vector_.rightOperand() );
-      return ( !BLAZE_BLAS_IS_PARALLEL ||
+      return !IsPackedMatrix<MT>::value &&
+             ( !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation<MT>::value && !evaluateMatrix ) ||
                ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) &&
              ( size() > SMP_TDVECDMATMULT_THRESHOLD );
@@ -2771,7 +2854,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -2782,6 +2866,32 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed assignment to dense vectors**********************************************************
+   /*!\brief Assignment of a scaled transpose dense vector-packed matrix multiplication
+   //        to a dense vector (\f$ \vec{y}^T=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      reset( y );
+      packedMult( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*!\brief Default assignment of a scaled transpose dense vector-dense matrix multiplication
    //        (\f$ \vec{y}^T=s*\vec{x}^T*A \f$).
@@ -3382,7 +3492,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3393,6 +3504,31 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense vectors*************************************************
+   /*!\brief Addition assignment of a scaled transpose dense vector-packed matrix multiplication
+   //        to a dense vector (\f$ \vec{y}^T+=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      packedMult( y, A, x, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*!\brief Default addition assignment of a scaled transpose dense vector-dense matrix
    //        multiplication (\f$ \vec{y}^T+=s*\vec{x}^T*A \f$).
@@ -3915,7 +4051,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   static inline DisableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -3926,6 +4063,31 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense vectors**********************************************
+   /*!\brief Subtraction assignment of a scaled transpose dense vector-packed matrix multiplication
+   //        to a dense vector (\f$ \vec{y}^T-=s*\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side packed matrix operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function dispatches the multiplication with a PackedMatrix to the packed kernels,
+   // which traverse the packed storage of the matrix exactly once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< IsPackedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A, ST2 scalar )
+   {
+      packedMult( y, A, x, -scalar );
+   }
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*!\brief Default subtraction assignment of a scaled transpose dense vector-dense matrix
    //        multiplication (\f$ \vec{y}^T-=s*\vec{x}^T*A \f$).
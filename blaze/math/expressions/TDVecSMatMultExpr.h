@@ -56,6 +56,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SellMult.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
@@ -66,6 +67,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSellMatrix.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
@@ -126,10 +128,11 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
        strategy. In case either the vector or the matrix operand requires an intermediate
-       evaluation, the nested \value will be set to 1, otherwise it will be 0. */
+       evaluation or the matrix operand is a SellMatrix, the nested \value will be set to 1,
+       otherwise it will be 0. */
    template< typename T1 >
    struct UseSMPAssign {
-      enum : bool { value = ( evaluateVector || evaluateMatrix ) };
+      enum : bool { value = ( evaluateVector || evaluateMatrix || IsSellMatrix<MT>::value ) };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -354,7 +357,8 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline DisableIf_< IsSellMatrix<MT1> >
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       typedef ConstIterator_< RemoveReference_<MT1> >  ConstIterator;
 
@@ -375,6 +379,31 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (SELL-C-sigma)**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose dense vector-SellMatrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side SellMatrix operand.
+   // \return void
+   //
+   // This function relays the assignment to the SELL-C-sigma kernels. The target vector is
+   // expected to be reset.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      sellTransMult( y, A, x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a transpose dense vector-sparse matrix multiplication to a sparse
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -455,7 +484,8 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline DisableIf_< IsSellMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       typedef ConstIterator_< RemoveReference_<MT1> >  ConstIterator;
 
@@ -472,6 +502,30 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (SELL-C-sigma)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose dense vector-SellMatrix multiplication
+   //        (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side SellMatrix operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      sellTransMult( y, A, x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -528,7 +582,8 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline DisableIf_< IsSellMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       typedef ConstIterator_< RemoveReference_<MT1> >  ConstIterator;
 
@@ -545,6 +600,30 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (SELL-C-sigma)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose dense vector-SellMatrix multiplication
+   //        (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side SellMatrix operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      sellTransMult( y, A, x, SellSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -647,10 +726,56 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
       BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAssign( ~lhs, x * A );
+      selectSmpAssignKernel( ~lhs, x, A );
    }
    //**********************************************************************************************
 
+   //**Default SMP assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP assignment of a transpose dense vector-sparse matrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< IsSellMatrix<MT1> >
+      selectSmpAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      smpAssign( y, x * A );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (SELL-C-sigma)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose dense vector-SellMatrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side SellMatrix operand.
+   // \return void
+   //
+   // This function relays the SMP assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSmpAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      smpSellTransMult( y, A, x, SellAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*!\brief SMP assignment of a transpose dense vector-sparse matrix multiplication to a sparse
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -716,10 +841,56 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
       BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAddAssign( ~lhs, x * A );
+      selectSmpAddAssignKernel( ~lhs, x, A );
    }
    //**********************************************************************************************
 
+   //**Default SMP addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP addition assignment of a transpose dense vector-sparse matrix multiplication
+   //        (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< IsSellMatrix<MT1> >
+      selectSmpAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      smpAddAssign( y, x * A );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (SELL-C-sigma)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a transpose dense vector-SellMatrix multiplication
+   //        (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side SellMatrix operand.
+   // \return void
+   //
+   // This function relays the SMP addition assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSmpAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      smpSellTransMult( y, A, x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -758,8 +929,54 @@ class TDVecSMatMultExpr : public DenseVector< TDVecSMatMultExpr<VT,MT>, true >
       BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).size()     , "Invalid vector size"       );
 
-      smpSubAssign( ~lhs, x * A );
+      selectSmpSubAssignKernel( ~lhs, x, A );
+   }
+   //**********************************************************************************************
+
+   //**Default SMP subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP subtraction assignment of a transpose dense vector-sparse matrix multiplication
+   //        (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_< IsSellMatrix<MT1> >
+      selectSmpSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      smpSubAssign( y, x * A );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (SELL-C-sigma)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a transpose dense vector-SellMatrix multiplication
+   //        (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side SellMatrix operand.
+   // \return void
+   //
+   // This function relays the SMP subtraction assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< IsSellMatrix<MT1> >
+      selectSmpSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      smpSellTransMult( y, A, x, SellSubAssign() );
    }
+   /*! \endcond */
    //**********************************************************************************************
 
    //**SMP subtraction assignment to sparse vectors************************************************
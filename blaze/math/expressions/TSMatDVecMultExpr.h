@@ -56,17 +56,21 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/BlockCompressedMult.h>
+#include <blaze/math/sparse/SellMult.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBlockCompressedMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSellMatrix.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -126,15 +130,33 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    enum : bool { evaluateVector = IsComputation<VT>::value || RequiresEvaluation<VT>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSellKernel struct is a helper struct for the selection of the SELL-C-sigma kernels.
+       In case the given matrix type is the transpose of a SellMatrix, the nested \value will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseSellKernel : public FalseType
+   {};
+
+   template< typename T1 >
+   struct UseSellKernel< SMatTransExpr<T1,true> > : public IsSellMatrix<T1>
+   {};
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
        strategy. In case either the matrix or the vector operand requires an intermediate
-       evaluation, the nested \value will be set to 1, otherwise it will be 0. */
+       evaluation, the matrix operand is the transpose of a SellMatrix, or the matrix operand is
+       a BlockCompressedMatrix, the nested \value will be set to 1, otherwise it will be 0. */
    template< typename T1 >
    struct UseSMPAssign {
-      enum : bool { value = ( evaluateMatrix || evaluateVector ) };
+      enum : bool { value = ( evaluateMatrix || evaluateVector ||
+                              UseSellKernel<MT>::value || IsBlockCompressedMatrix<MT>::value ) };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -364,7 +386,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< Or< UseSellKernel<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef ConstIterator_< RemoveReference_<MT1> >  ConstIterator;
 
@@ -385,6 +408,56 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (SELL-C-sigma)**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A^T*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side transpose SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment to the SELL-C-sigma kernels. The target vector is
+   // expected to be reset.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSellKernel<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      sellTransMult( y, A.operand(), x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (block compressed)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a column-major BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment to the block multiplication kernels. The target vector is
+   // expected to be reset.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      blockMult( y, A, x, BlockAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-dense vector multiplication to a sparse
@@ -467,7 +540,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< Or< UseSellKernel<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef ConstIterator_< RemoveReference_<MT1> >  ConstIterator;
 
@@ -484,6 +558,54 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (SELL-C-sigma)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A^T*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side transpose SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSellKernel<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      sellTransMult( y, A.operand(), x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (block compressed)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a column-major BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      blockMult( y, A, x, BlockAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -540,7 +662,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< Or< UseSellKernel<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef ConstIterator_< RemoveReference_<MT1> >  ConstIterator;
 
@@ -557,6 +680,54 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (SELL-C-sigma)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A^T*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side transpose SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSellKernel<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      sellTransMult( y, A.operand(), x, SellSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (block compressed)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a column-major BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      blockMult( y, A, x, BlockSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -664,7 +835,77 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAssign( ~lhs, A * x );
+      selectSmpAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP assignment of a transpose sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< UseSellKernel<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (SELL-C-sigma)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A^T*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side transpose SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSellKernel<MT1> >
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSellTransMult( y, A.operand(), x, SellAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (block compressed)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a column-major BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSmpAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpBlockMult( y, A, x, BlockAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -735,7 +976,77 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAddAssign( ~lhs, A * x );
+      selectSmpAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP addition assignment of a transpose sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< UseSellKernel<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpAddAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (SELL-C-sigma)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a transpose SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A^T*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side transpose SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP addition assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSellKernel<MT1> >
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSellTransMult( y, A.operand(), x, SellAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors (block compressed)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a column-major BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP addition assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSmpAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpBlockMult( y, A, x, BlockAddAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -777,7 +1088,77 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpSubAssign( ~lhs, A * x );
+      selectSmpSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP subtraction assignment of a transpose sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< Or< UseSellKernel<MT1>, IsBlockCompressedMatrix<MT1> > >
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSubAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (SELL-C-sigma)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a transpose SellMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A^T*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side transpose SellMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP subtraction assignment to the SELL-C-sigma kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseSellKernel<MT1> >
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpSellTransMult( y, A.operand(), x, SellSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors (block compressed)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a column-major BlockCompressedMatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side BlockCompressedMatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the SMP subtraction assignment to the block multiplication kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< IsBlockCompressedMatrix<MT1> >
+      selectSmpSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      smpBlockMult( y, A, x, BlockSubAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
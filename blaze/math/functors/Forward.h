@@ -47,6 +47,7 @@ namespace blaze {
 struct Abs;
 struct Acos;
 struct Acosh;
+struct Add;
 struct Asin;
 struct Asinh;
 struct Atan;
@@ -69,11 +70,15 @@ struct InvCbrt;
 struct InvSqrt;
 struct Log;
 struct Log10;
+struct Maximum;
+struct Minimum;
+struct Mult;
 template< typename > struct Pow;
 struct Real;
 struct Serial;
 struct Sin;
 struct Sinh;
+struct SqrAbs;
 struct Sqrt;
 struct Tan;
 struct Tanh;
@@ -76,4 +76,18 @@
 */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\defgroup lapack_eigenvalues Eigenvalues/Eigenvectors
+// \ingroup lapack
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\defgroup lapack_singular_values Singular Values/Singular Vectors
+// \ingroup lapack
+*/
+//*************************************************************************************************
+
 #endif
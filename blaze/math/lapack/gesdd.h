@@ -0,0 +1,333 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/gesdd.h
+//  \brief Header file for the LAPACK singular value decomposition functions (gesdd)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_GESDD_H_
+#define _BLAZE_MATH_LAPACK_GESDD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/clapack/gesdd.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK SINGULAR VALUE DECOMPOSITION FUNCTIONS (GESDD)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK singular value decomposition functions (gesdd) */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the LAPACK singular value decomposition functions (gesdd).
+// \ingroup lapack_singular_values
+//
+// \param jobz Specifies the computation of the singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param m The number of rows of the column-major matrix.
+// \param n The number of columns of the column-major matrix.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the column-major matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the column-major matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \return void
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function allocates the optimal workspace and performs the singular value decomposition
+// via the according CLAPACK gesdd() function.
+*/
+template< typename ET >  // Element type of the matrices
+inline void gesddBackend( char jobz, int m, int n, ET* A, int lda, UnderlyingBuiltin_<ET>* s,
+                          ET* U, int ldu, ET* VT, int ldvt )
+{
+   using boost::numeric_cast;
+
+   typedef UnderlyingBuiltin_<ET>  BT;
+
+   const int minimum( min( m, n ) );
+   const int maximum( max( m, n ) );
+
+   int info( 0 );
+
+   int lrwork( 0 );
+   if( IsComplex<ET>::value ) {
+      lrwork = ( jobz == 'N' )
+               ?( 7*minimum )
+               :( minimum*max( 5*minimum+7, 2*maximum+2*minimum+1 ) );
+   }
+
+   const std::unique_ptr<BT[]>  rwork( lrwork > 0 ? new BT[lrwork] : nullptr );
+   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+
+   ET wkopt( 0 );
+   gesdd( jobz, m, n, A, lda, s, U, ldu, VT, ldvt, &wkopt, -1, rwork.get(), iwork.get(), &info );
+
+   int lwork( numeric_cast<int>( real( wkopt ) ) );
+   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   gesdd( jobz, m, n, A, lda, s, U, ldu, VT, ldvt, work.get(), lwork, rwork.get(), iwork.get(), &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Singular value decomposition failed" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the singular values of the given dense general matrix.
+// \ingroup lapack_singular_values
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular values of a general m-by-n matrix based on the LAPACK
+// gesdd() functions, which use a divide and conquer algorithm. Note that the function only works
+// for general, non-adapted matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with any adapted matrix or
+// matrices of any other element type results in a compile time error!
+//
+// The min(m,n) singular values are returned in descending order in the given vector \a s, which
+// is resized to the correct size (if possible and necessary). The content of \a A is destroyed.
+// The function fails if ...
+//
+//  - ... the given vector \a s is a fixed size vector and the size doesn't match;
+//  - ... the singular value decomposition fails.
+//
+// The first case is reported via the \c std::invalid_argument exception, the second via the
+// \c std::runtime_error exception.
+//
+// For more information on the gesdd() functions (i.e. sgesdd(), dgesdd(), cgesdd(), and zgesdd())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_< ElementType_<MT> >, ElementType_<VT> );
+
+   const size_t k( min( (~A).rows(), (~A).columns() ) );
+
+   resize( ~s, k, false );
+
+   if( k == 0UL ) {
+      return;
+   }
+
+   int m  ( numeric_cast<int>( SO ? (~A).rows() : (~A).columns() ) );
+   int n  ( numeric_cast<int>( SO ? (~A).columns() : (~A).rows() ) );
+   int lda( numeric_cast<int>( (~A).spacing() ) );
+
+   gesddBackend< ElementType_<MT> >( 'N', m, n, (~A).data(), lda, (~s).data(), nullptr, 1, nullptr, 1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general
+//        matrix.
+// \ingroup lapack_singular_values
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of (conjugate transposed) right singular vectors.
+// \param jobz \c 'A' to compute all singular vectors, \c 'S' to compute the first min(m,n) ones.
+// \return void
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes the singular value decomposition (SVD) of a general m-by-n matrix
+// based on the LAPACK gesdd() functions, which use a divide and conquer algorithm. Note that the
+// function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// any adapted matrix or matrices of any other element type results in a compile time error!
+//
+// The decomposition has the form
+
+                              \f[ A = U \cdot S \cdot V, \f]
+
+// where \c S is zero except for its min(m,n) diagonal elements, which are the singular values of
+// \a A and which are returned in descending order in the given vector \a s. The rows of \a V are
+// the conjugated right singular vectors of \a A (i.e. \a V contains \f$ V^H \f$ in LAPACK
+// notation). In case \a jobz is set to \c 'A', \a U is resized to a m-by-m and \a V to a n-by-n
+// matrix, in case \a jobz is set to \c 'S', \a U is resized to a m-by-min(m,n) and \a V to a
+// min(m,n)-by-n matrix. The content of \a A is destroyed.
+//
+// The function fails if ...
+//
+//  - ... the given \a jobz argument is neither \c 'A' nor \c 'S';
+//  - ... the given matrices \a U or \a V or the vector \a s are of fixed size and the sizes
+//        don't match;
+//  - ... the singular value decomposition fails.
+//
+// The first two cases are reported via the \c std::invalid_argument exception, the last via the
+// \c std::runtime_error exception.
+//
+// For more information on the gesdd() functions (i.e. sgesdd(), dgesdd(), cgesdd(), and zgesdd())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A, \a U, \a s, and \a V may already have been modified.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT3 >  // Type of the matrix V
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT2> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_< ElementType_<MT1> >, ElementType_<VT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT1>, ElementType_<MT3> );
+
+   if( jobz != 'A' && jobz != 'S' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid jobz argument provided" );
+   }
+
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+   const size_t k( min( m, n ) );
+
+   resize( ~U, m, ( jobz == 'A' ? m : k ), false );
+   resize( ~s, k, false );
+   resize( ~V, ( jobz == 'A' ? n : k ), n, false );
+
+   if( k == 0UL ) {
+      return;
+   }
+
+   const int lda( numeric_cast<int>( (~A).spacing() ) );
+   const int ldu( numeric_cast<int>( (~U).spacing() ) );
+   const int ldv( numeric_cast<int>( (~V).spacing() ) );
+
+   if( SO ) {
+      gesddBackend( jobz, numeric_cast<int>( m ), numeric_cast<int>( n ), (~A).data(), lda,
+                    (~s).data(), (~U).data(), ldu, (~V).data(), ldv );
+   }
+   else {
+      gesddBackend( jobz, numeric_cast<int>( n ), numeric_cast<int>( m ), (~A).data(), lda,
+                    (~s).data(), (~V).data(), ldv, (~U).data(), ldu );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,196 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/syevd.h
+//  \brief Header file for the LAPACK symmetric eigenvalue functions (syevd)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_SYEVD_H_
+#define _BLAZE_MATH_LAPACK_SYEVD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <boost/cast.hpp>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/syevd.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/constraints/SameType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK SYMMETRIC EIGENVALUE FUNCTIONS (SYEVD)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK symmetric eigenvalue functions (syevd) */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+inline void syevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense symmetric matrix.
+// \ingroup lapack_eigenvalues
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues and, optionally, all eigenvectors of a symmetric n-by-n
+// matrix based on the LAPACK syevd() functions, which use a divide and conquer algorithm. Note
+// that the function only works for general, non-adapted matrices with \c float or \c double
+// element type. The attempt to call the function with any adapted matrix or matrices of any
+// other element type results in a compile time error!
+//
+// The eigenvalues are returned in ascending order in the given vector \a w, which is resized to
+// the correct size (if possible and necessary). In case \a jobz is set to \c 'V', on exit \a A
+// contains the orthonormal eigenvectors of the matrix: In case \a A is a column-major matrix,
+// column \c i contains the eigenvector of the eigenvalue \c w[i], in case \a A is a row-major
+// matrix, row \c i contains the eigenvector of the eigenvalue \c w[i]. In case \a jobz is set
+// to \c 'N', the part of \a A specified by \a uplo is destroyed.
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A is not a square matrix;
+//  - ... the given vector \a w is a fixed size vector and the size doesn't match;
+//  - ... the given \a jobz argument is neither \c 'V' nor \c 'N';
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U';
+//  - ... the eigenvalue computation fails.
+//
+// The first four functions report failure via the \c std::invalid_argument exception, the last
+// via the \c std::runtime_error exception.
+//
+// For more information on the syevd() functions (i.e. ssyevd() and dsyevd()) see the LAPACK
+// online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if the fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a w may already have been modified.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline void syevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, ElementType_<VT> );
+
+   typedef ElementType_<MT>  ET;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( jobz != 'V' && jobz != 'N' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid jobz argument provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   resize( ~w, (~A).rows(), false );
+
+   int n   ( numeric_cast<int>( (~A).rows()    ) );
+   int lda ( numeric_cast<int>( (~A).spacing() ) );
+   int info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   if( IsRowMajorMatrix<MT>::value ) {
+      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
+   }
+
+   ET  wkopt ( 0 );
+   int iwkopt( 0 );
+
+   syevd( jobz, uplo, n, (~A).data(), lda, (~w).data(), &wkopt, -1, &iwkopt, -1, &info );
+
+   int lwork ( numeric_cast<int>( wkopt ) );
+   int liwork( iwkopt );
+   const std::unique_ptr<ET[]>  work ( new ET[lwork] );
+   const std::unique_ptr<int[]> iwork( new int[liwork] );
+
+   syevd( jobz, uplo, n, (~A).data(), lda, (~w).data(), work.get(), lwork, iwork.get(), liwork, &info );
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Eigenvalue computation failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
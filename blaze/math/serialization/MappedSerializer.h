@@ -0,0 +1,1008 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedSerializer.h
+//  \brief Serialization of dense and sparse matrices and vectors into memory mapped files
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDSERIALIZER_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDSERIALIZER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/ChunkedMatrix.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/MappedCompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/serialization/MappedFile.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializer for memory mapped dense and sparse matrices and dense vectors.
+// \ingroup math_serialization
+//
+// The MappedSerializer implements a binary file format for dense matrices, sparse matrices and
+// dense vectors of numeric element type, which can be loaded by means of a memory mapping of the
+// file without copying the elements (see the saveMapped() and loadMapped() functions). The file
+// consists of a 64-byte header, followed by the elements:
+//
+//  - dense matrices and vectors: each row (row-major) or column (column-major) is stored in a
+//    contiguous array, which is padded with zeros to a multiple of 64 bytes. Therefore the data
+//    is properly aligned and padded for all SIMD instruction sets and can be used by means of an
+//    aligned and padded CustomMatrix or CustomVector.
+//  - sparse matrices: the \f$ M+1 \f$ (row-major) or \f$ N+1 \f$ (column-major) 64-bit offsets
+//    of the rows/columns, followed by the 64-byte aligned array of indices and the 64-byte
+//    aligned array of values. This data can be used by means of a MappedCompressedMatrix.
+//
+// In contrast to the portable format of the MatrixSerializer and VectorSerializer, the mapped
+// format is stored in the byte order of the executing platform. Files written on a platform with
+// a different byte order are rejected.
+*/
+class MappedSerializer
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedSerializer();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename MT, bool SO >
+   void save( const std::string& filename, const DenseMatrix<MT,SO>& mat );
+
+   template< typename IT, typename MT, bool SO >
+   void save( const std::string& filename, const SparseMatrix<MT,SO>& mat );
+
+   template< typename VT, bool TF >
+   void save( const std::string& filename, const DenseVector<VT,TF>& vec );
+
+   template< typename Type, bool AF, bool PF, bool SO >
+   void load( const std::string& filename, CustomMatrix<Type,AF,PF,SO>& mat );
+
+   template< typename Type, bool AF, bool PF, bool TF >
+   void load( const std::string& filename, CustomVector<Type,AF,PF,TF>& vec );
+
+   template< typename Type, bool SO, typename IT >
+   void load( const std::string& filename, MappedCompressedMatrix<Type,SO,IT>& mat );
+
+   template< typename Type >
+   void load( const std::string& filename, ChunkedMatrix<Type>& mat );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The header of a mapped file.
+   struct Header
+   {
+      char     magic[8];     //!< The magic number of the file format.
+      uint16_t version;      //!< The version of the file format.
+      uint8_t  type;         //!< The type of the matrix/vector.
+      uint8_t  elementType;  //!< The type of an element.
+      uint8_t  elementSize;  //!< The size in bytes of a single element.
+      uint8_t  indexSize;    //!< The size in bytes of a single index (sparse matrices only).
+      uint16_t reserved1;    //!< Reserved for future use.
+      uint32_t byteOrder;    //!< Byte order check value.
+      uint32_t reserved2;    //!< Reserved for future use.
+      uint64_t rows;         //!< The number of rows of the matrix/the size of the vector.
+      uint64_t columns;      //!< The number of columns of the matrix.
+      uint64_t spacing;      //!< The number of elements between two rows/columns.
+      uint64_t nonZeros;     //!< The number of stored elements.
+      uint64_t fileSize;     //!< The total size of the file in bytes.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Deleter*************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Deleter for the elements of a memory mapped matrix or vector.
+   //
+   // The MappedDeleter keeps the memory mapping alive for as long as at least one matrix or
+   // vector refers to its elements. The mapping is released together with the last copy of
+   // the deleter.
+   */
+   struct MappedDeleter
+   {
+      template< typename Type >
+      inline void operator()( Type* ) const noexcept {}
+
+      std::shared_ptr<const MappedFile> file;  //!< The memory mapped file.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Enumerations********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   enum : size_t { alignment  = 64UL };  //!< The alignment of all arrays in the file.
+   enum : uint32_t { byteOrder = 0x01020304U };  //!< The byte order check value.
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t align( size_t bytes ) noexcept;
+
+   template< typename Type >
+   static inline size_t spacing( size_t n ) noexcept;
+
+   inline void initHeader( uint8_t type, uint8_t elementType, uint8_t elementSize );
+
+   template< typename Type >
+   inline void writeDense( const std::string& filename, const Type* data, size_t lines,
+                           size_t size, size_t stride );
+
+   inline void writeHeader( std::ofstream& os );
+   inline void writePadding( std::ofstream& os, size_t bytes );
+
+   inline std::shared_ptr<const MappedFile> loadHeader( const std::string& filename );
+
+   template< typename Type >
+   inline void checkHeader( uint8_t type );
+
+   template< typename Type, bool AF, bool TF >
+   inline void bindVector( CustomVector<Type,AF,padded,TF>& vec, Type* data, MappedDeleter d );
+
+   template< typename Type, bool AF, bool TF >
+   inline void bindVector( CustomVector<Type,AF,unpadded,TF>& vec, Type* data, MappedDeleter d );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Header header_;  //!< The header of the current file.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( sizeof( Header ) == 64UL );
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == sizeof( uint64_t ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the MappedSerializer class.
+*/
+inline MappedSerializer::MappedSerializer()
+   : header_()  // The header of the current file
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix into a mapped file.
+//
+// \param filename The name of the file to be written.
+// \param mat The dense matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void MappedSerializer::save( const std::string& filename, const DenseMatrix<MT,SO>& mat )
+{
+   typedef ElementType_<MT>  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> tmp( ~mat );
+
+   initHeader( SO ? 5U : 1U, TypeValueMapping<ET>::value, sizeof( ET ) );
+   header_.rows    = tmp.rows();
+   header_.columns = tmp.columns();
+
+   const size_t lines( SO ? tmp.columns() : tmp.rows() );
+   const size_t size ( SO ? tmp.rows() : tmp.columns() );
+
+   std::vector<ET> line( size );
+   std::ofstream os( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   header_.spacing  = spacing<ET>( size );
+   header_.nonZeros = tmp.rows() * tmp.columns();
+   header_.fileSize = alignment + lines * header_.spacing * sizeof( ET );
+
+   writeHeader( os );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      for( size_t j=0UL; j<size; ++j )
+         line[j] = SO ? tmp(j,i) : tmp(i,j);
+      os.write( reinterpret_cast<const char*>( line.data() ), size*sizeof( ET ) );
+      writePadding( os, ( header_.spacing - size ) * sizeof( ET ) );
+   }
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix into a mapped file.
+//
+// \param filename The name of the file to be written.
+// \param mat The sparse matrix to be written.
+// \return void
+// \exception std::runtime_error Invalid matrix size for the index type.
+// \exception std::runtime_error File could not be written.
+//
+// The indices of the non-zero elements are stored as values of type \a IT.
+*/
+template< typename IT    // Type of the stored indices
+        , typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order
+void MappedSerializer::save( const std::string& filename, const SparseMatrix<MT,SO>& mat )
+{
+   typedef ElementType_<MT>  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE ( ET );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE( IT );
+
+   CompositeType_<MT> tmp( ~mat );
+
+   const size_t lines( SO ? tmp.columns() : tmp.rows() );
+   const size_t size ( SO ? tmp.rows() : tmp.columns() );
+
+   if( size > size_t( std::numeric_limits<IT>::max() ) + 1UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix size for the index type" );
+   }
+
+   initHeader( SO ? 7U : 3U, TypeValueMapping<ET>::value, sizeof( ET ) );
+   header_.indexSize = sizeof( IT );
+   header_.rows      = tmp.rows();
+   header_.columns   = tmp.columns();
+   header_.spacing   = 0UL;
+
+   std::vector<uint64_t> offsets( lines+1UL, 0UL );
+   for( size_t i=0UL; i<lines; ++i ) {
+      offsets[i+1UL] = offsets[i] + tmp.nonZeros( i );
+   }
+
+   const size_t nonzeros     ( offsets[lines] );
+   const size_t indicesOffset( align( alignment + ( lines+1UL ) * sizeof( uint64_t ) ) );
+   const size_t valuesOffset ( align( indicesOffset + nonzeros * sizeof( IT ) ) );
+
+   header_.nonZeros = nonzeros;
+   header_.fileSize = valuesOffset + nonzeros * sizeof( ET );
+
+   std::ofstream os( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   writeHeader( os );
+   os.write( reinterpret_cast<const char*>( offsets.data() ), ( lines+1UL ) * sizeof( uint64_t ) );
+   writePadding( os, indicesOffset - alignment - ( lines+1UL ) * sizeof( uint64_t ) );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      for( auto element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         const IT index( static_cast<IT>( element->index() ) );
+         os.write( reinterpret_cast<const char*>( &index ), sizeof( IT ) );
+      }
+   }
+   writePadding( os, valuesOffset - indicesOffset - nonzeros * sizeof( IT ) );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      for( auto element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         const ET value( element->value() );
+         os.write( reinterpret_cast<const char*>( &value ), sizeof( ET ) );
+      }
+   }
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector into a mapped file.
+//
+// \param filename The name of the file to be written.
+// \param vec The dense vector to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void MappedSerializer::save( const std::string& filename, const DenseVector<VT,TF>& vec )
+{
+   typedef ElementType_<VT>  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<VT> tmp( ~vec );
+   const size_t size( tmp.size() );
+
+   initHeader( 0U, TypeValueMapping<ET>::value, sizeof( ET ) );
+   header_.rows     = size;
+   header_.columns  = 1UL;
+   header_.spacing  = spacing<ET>( size );
+   header_.nonZeros = size;
+   header_.fileSize = alignment + header_.spacing * sizeof( ET );
+
+   std::vector<ET> data( size );
+   for( size_t i=0UL; i<size; ++i )
+      data[i] = tmp[i];
+
+   std::ofstream os( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   writeHeader( os );
+   os.write( reinterpret_cast<const char*>( data.data() ), size*sizeof( ET ) );
+   writePadding( os, ( header_.spacing - size ) * sizeof( ET ) );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the dense matrix stored in the given file into a custom matrix.
+//
+// \param filename The name of the file to be mapped.
+// \param mat The custom matrix to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+void MappedSerializer::load( const std::string& filename, CustomMatrix<Type,AF,PF,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   std::shared_ptr<const MappedFile> file( loadHeader( filename ) );
+   checkHeader<Type>( SO ? 5U : 1U );
+
+   const size_t lines   ( SO ? header_.columns : header_.rows );
+   const size_t size    ( SO ? header_.rows : header_.columns );
+   const size_t capacity( ( file->size() - alignment ) / sizeof( Type ) );
+
+   // Bounding the sizes by the size of the file before multiplying prevents any overflow
+   if( size > capacity || header_.spacing != spacing<Type>( size ) ||
+       ( lines != 0UL && header_.spacing > capacity / lines ) ||
+       header_.nonZeros != header_.rows * header_.columns ||
+       header_.fileSize != alignment + lines * header_.spacing * sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix size detected" );
+   }
+
+   Type* data( reinterpret_cast<Type*>( const_cast<byte_t*>( file->data() ) + alignment ) );
+
+   CustomMatrix<Type,AF,PF,SO> tmp( data, header_.rows, header_.columns, header_.spacing,
+                                    MappedDeleter{ file } );
+   mat.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the dense vector stored in the given file into a custom vector.
+//
+// \param filename The name of the file to be mapped.
+// \param vec The custom vector to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+void MappedSerializer::load( const std::string& filename, CustomVector<Type,AF,PF,TF>& vec )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   std::shared_ptr<const MappedFile> file( loadHeader( filename ) );
+   checkHeader<Type>( 0U );
+
+   const size_t capacity( ( file->size() - alignment ) / sizeof( Type ) );
+
+   if( header_.columns != 1UL || header_.rows > capacity ||
+       header_.spacing != spacing<Type>( header_.rows ) ||
+       header_.nonZeros != header_.rows ||
+       header_.fileSize != alignment + header_.spacing * sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid vector size detected" );
+   }
+
+   Type* data( reinterpret_cast<Type*>( const_cast<byte_t*>( file->data() ) + alignment ) );
+
+   bindVector( vec, data, MappedDeleter{ file } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the sparse matrix stored in the given file into a mapped compressed matrix.
+//
+// \param filename The name of the file to be mapped.
+// \param mat The mapped compressed matrix to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+//
+// This function checks the offsets of the rows/columns, but not the indices of the non-zero
+// elements, since this would require to touch the complete file. The isIntact() function can
+// be used to explicitly validate the indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void MappedSerializer::load( const std::string& filename, MappedCompressedMatrix<Type,SO,IT>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   std::shared_ptr<const MappedFile> file( loadHeader( filename ) );
+   checkHeader<Type>( SO ? 7U : 3U );
+
+   if( header_.indexSize != sizeof( IT ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid index size detected" );
+   }
+
+   const size_t lines   ( SO ? header_.columns : header_.rows );
+   const size_t nonzeros( header_.nonZeros );
+
+   if( lines >= ( file->size() - alignment ) / sizeof( uint64_t ) ||
+       nonzeros > ( file->size() - alignment ) / ( sizeof( IT ) + sizeof( Type ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix size detected" );
+   }
+
+   const size_t indicesOffset( align( alignment + ( lines+1UL ) * sizeof( uint64_t ) ) );
+   const size_t valuesOffset ( align( indicesOffset + nonzeros * sizeof( IT ) ) );
+
+   if( header_.fileSize != valuesOffset + nonzeros * sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const byte_t* data( file->data() );
+   const size_t* offsets( reinterpret_cast<const size_t*>( data + alignment ) );
+
+   if( offsets[0UL] != 0UL || offsets[lines] != nonzeros ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid offsets detected" );
+   }
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      if( offsets[i] > offsets[i+1UL] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid offsets detected" );
+      }
+   }
+
+   MappedCompressedMatrix<Type,SO,IT> tmp( header_.rows, header_.columns, offsets,
+                                           reinterpret_cast<const IT*>( data + indicesOffset ),
+                                           reinterpret_cast<const Type*>( data + valuesOffset ),
+                                           file );
+   mat.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given chunked matrix to the row-major dense matrix stored in the given file.
+//
+// \param filename The name of the file to be mapped.
+// \param mat The chunked matrix to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+*/
+template< typename Type >  // Data type of the matrix
+void MappedSerializer::load( const std::string& filename, ChunkedMatrix<Type>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   std::shared_ptr<const MappedFile> file( loadHeader( filename ) );
+   checkHeader<Type>( 1U );
+
+   const size_t capacity( ( file->size() - alignment ) / sizeof( Type ) );
+
+   if( header_.columns > capacity || header_.spacing != spacing<Type>( header_.columns ) ||
+       ( header_.rows != 0UL && header_.spacing > capacity / header_.rows ) ||
+       header_.nonZeros != header_.rows * header_.columns ||
+       header_.fileSize != alignment + header_.rows * header_.spacing * sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix size detected" );
+   }
+
+   ChunkedMatrix<Type> tmp( file, alignment, header_.rows, header_.columns, header_.spacing );
+   mat.swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Rounds the given number of bytes up to the next multiple of the file alignment.
+//
+// \param bytes The number of bytes.
+// \return The next multiple of the alignment.
+*/
+inline size_t MappedSerializer::align( size_t bytes ) noexcept
+{
+   return ( bytes + alignment - 1UL ) & ~( alignment - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements between two rows/columns of \a n elements.
+//
+// \param n The number of elements per row/column.
+// \return The padded number of elements per row/column.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t MappedSerializer::spacing( size_t n ) noexcept
+{
+   BLAZE_STATIC_ASSERT( alignment % sizeof( Type ) == 0UL );
+   return align( n * sizeof( Type ) ) / sizeof( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the header of the file to be written.
+//
+// \param type The type of the matrix/vector.
+// \param elementType The type of an element.
+// \param elementSize The size in bytes of a single element.
+// \return void
+*/
+inline void MappedSerializer::initHeader( uint8_t type, uint8_t elementType, uint8_t elementSize )
+{
+   header_ = Header();
+   std::memcpy( header_.magic, "BLAZEMAP", 8UL );
+   header_.version     = 1U;
+   header_.type        = type;
+   header_.elementType = elementType;
+   header_.elementSize = elementSize;
+   header_.byteOrder   = byteOrder;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the header of the file.
+//
+// \param os The output file stream.
+// \return void
+// \exception std::runtime_error File header could not be written.
+*/
+inline void MappedSerializer::writeHeader( std::ofstream& os )
+{
+   os.write( reinterpret_cast<const char*>( &header_ ), sizeof( Header ) );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given number of zero bytes into the file.
+//
+// \param os The output file stream.
+// \param bytes The number of zero bytes.
+// \return void
+*/
+inline void MappedSerializer::writePadding( std::ofstream& os, size_t bytes )
+{
+   const char zeros[alignment] = {};
+
+   BLAZE_INTERNAL_ASSERT( bytes < alignment, "Invalid number of padding bytes" );
+
+   os.write( zeros, bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given file and reads its header.
+//
+// \param filename The name of the file to be mapped.
+// \return The memory mapped file.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Corrupt file detected.
+*/
+inline std::shared_ptr<const MappedFile> MappedSerializer::loadHeader( const std::string& filename )
+{
+   std::shared_ptr<const MappedFile> file( std::make_shared<MappedFile>( filename ) );
+
+   if( file->size() < sizeof( Header ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt file detected" );
+   }
+
+   std::memcpy( &header_, file->data(), sizeof( Header ) );
+
+   if( std::memcmp( header_.magic, "BLAZEMAP", 8UL ) != 0 || header_.fileSize != file->size() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt file detected" );
+   }
+
+   return file;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the header of the mapped file against the expected type of matrix/vector.
+//
+// \param type The expected type of the matrix/vector.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+*/
+template< typename Type >  // Data type of the elements
+inline void MappedSerializer::checkHeader( uint8_t type )
+{
+   if( header_.byteOrder != byteOrder ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid byte order detected" );
+   }
+   else if( header_.version != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( header_.type != type ) {
+      BLAZE_THROW_RUNTIME_ERROR( ( type & 1U ) ? "Invalid matrix type detected"
+                                               : "Invalid vector type detected" );
+   }
+   else if( header_.elementType != TypeValueMapping<Type>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( header_.elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given padded custom vector to the mapped elements.
+//
+// \param vec The padded custom vector to be bound.
+// \param data The first mapped element.
+// \param d The deleter holding the mapping.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool TF >      // Transpose flag
+inline void MappedSerializer::bindVector( CustomVector<Type,AF,padded,TF>& vec, Type* data, MappedDeleter d )
+{
+   CustomVector<Type,AF,padded,TF> tmp( data, header_.rows, header_.spacing, d );
+   vec.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given unpadded custom vector to the mapped elements.
+//
+// \param vec The unpadded custom vector to be bound.
+// \param data The first mapped element.
+// \param d The deleter holding the mapping.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool TF >      // Transpose flag
+inline void MappedSerializer::bindVector( CustomVector<Type,AF,unpadded,TF>& vec, Type* data, MappedDeleter d )
+{
+   CustomVector<Type,AF,unpadded,TF> tmp( data, header_.rows, d );
+   vec.swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix into a file suited for memory mapping.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be written.
+// \param mat The dense matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given dense matrix into the given file, which can subsequently be
+// mapped into a CustomMatrix by means of the loadMapped() function:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+   blaze::saveMapped( "matrix.blzm", A );
+
+   using blaze::aligned;
+   using blaze::padded;
+
+   blaze::CustomMatrix<double,aligned,padded,blaze::rowMajor> B;
+   blaze::loadMapped( "matrix.blzm", B );  // No copy of the elements
+   \endcode
+
+// Note that the element type of the matrix must be a numeric type.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void saveMapped( const std::string& filename, const DenseMatrix<MT,SO>& mat )
+{
+   MappedSerializer().save( filename, ~mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix into a file suited for memory mapping.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be written.
+// \param mat The sparse matrix to be written.
+// \return void
+// \exception std::runtime_error Invalid matrix size for the index type.
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given sparse matrix into the given file, which can subsequently be
+// mapped into a MappedCompressedMatrix with matching storage order and index type \a IT (by
+// default \c uint32_t) by means of the loadMapped() function:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+   blaze::saveMapped( "matrix.blzm", A );
+
+   blaze::MappedCompressedMatrix<double,blaze::rowMajor> B;
+   blaze::loadMapped( "matrix.blzm", B );  // No copy of the elements
+   \endcode
+
+// Note that the element type of the matrix must be a numeric type.
+*/
+template< typename IT = uint32_t  // Type of the stored indices
+        , typename MT             // Type of the sparse matrix
+        , bool SO >               // Storage order
+void saveMapped( const std::string& filename, const SparseMatrix<MT,SO>& mat )
+{
+   MappedSerializer().save<IT>( filename, ~mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector into a file suited for memory mapping.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be written.
+// \param vec The dense vector to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given dense vector into the given file, which can subsequently be
+// mapped into a CustomVector by means of the loadMapped() function. Note that the element type
+// of the vector must be a numeric type.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void saveMapped( const std::string& filename, const DenseVector<VT,TF>& vec )
+{
+   MappedSerializer().save( filename, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the dense matrix stored in the given file into the given custom matrix.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be mapped.
+// \param mat The custom matrix to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+//
+// This function maps the dense matrix stored in the given file (see the saveMapped() function)
+// into memory and binds the given custom matrix to the elements of the file. The elements are
+// neither read nor copied until they are accessed. The mapping is private, i.e. modifications
+// of the matrix are not written back to the file. The mapping is released as soon as the last
+// custom matrix bound to the file is destroyed or rebound. Since all rows (or columns) in the
+// file are aligned and padded, the custom matrix can be both aligned and padded. Note however
+// that the storage order and the element type of the custom matrix have to match the stored
+// matrix.
+//
+// Files in the portable format of the MatrixSerializer can be converted by means of an ordinary
+// matrix:
+
+   \code
+   blaze::DynamicMatrix<double> tmp;
+   blaze::Archive<std::ifstream> archive( "matrix.blaze" );
+   archive >> tmp;
+   blaze::saveMapped( "matrix.blzm", tmp );
+   \endcode
+
+// The reverse conversion is possible by serializing the mapped custom matrix into an archive.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+void loadMapped( const std::string& filename, CustomMatrix<Type,AF,PF,SO>& mat )
+{
+   MappedSerializer().load( filename, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the dense vector stored in the given file into the given custom vector.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be mapped.
+// \param vec The custom vector to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+//
+// This function maps the dense vector stored in the given file (see the saveMapped() function)
+// into memory and binds the given custom vector to the elements of the file. The mapping is
+// private, i.e. modifications of the vector are not written back to the file. Note that the
+// element type of the custom vector has to match the stored vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+void loadMapped( const std::string& filename, CustomVector<Type,AF,PF,TF>& vec )
+{
+   MappedSerializer().load( filename, vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the sparse matrix stored in the given file into the given mapped compressed matrix.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be mapped.
+// \param mat The mapped compressed matrix to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+//
+// This function maps the sparse matrix stored in the given file (see the saveMapped() function)
+// into memory and binds the given read-only MappedCompressedMatrix to the elements of the file.
+// The storage order, the element type and the index type of the matrix have to match the stored
+// matrix. Files in the portable format of the MatrixSerializer can be converted by means of a
+// CompressedMatrix:
+
+   \code
+   blaze::CompressedMatrix<double> tmp;
+   blaze::Archive<std::ifstream> archive( "matrix.blaze" );
+   archive >> tmp;
+   blaze::saveMapped( "matrix.blzm", tmp );
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void loadMapped( const std::string& filename, MappedCompressedMatrix<Type,SO,IT>& mat )
+{
+   MappedSerializer().load( filename, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given chunked matrix to the dense matrix stored in the given file.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be mapped.
+// \param mat The chunked matrix to be bound to the file.
+// \return void
+// \exception std::runtime_error Invalid mapped file.
+//
+// This function maps the row-major dense matrix stored in the given file (see the saveMapped()
+// function) into the address space of the process and binds the given ChunkedMatrix to it. In
+// contrast to the other loadMapped() functions, no element of the matrix is read by this
+// function. Instead, the matrix is read panel by panel by the out-of-core kernels (see for
+// instance the chunkedMult() function), which allows to process matrices that are considerably
+// larger than the main memory. Note that the element type of the chunked matrix has to match
+// the stored matrix.
+*/
+template< typename Type >  // Data type of the matrix
+void loadMapped( const std::string& filename, ChunkedMatrix<Type>& mat )
+{
+   MappedSerializer().load( filename, mat );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstring>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
@@ -235,10 +237,20 @@ class MatrixSerializer
    void serializeHeader( Archive& archive, const MT& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+   DisableIf_< IsNumeric< ElementType_<MT> > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_< IsNumeric< ElementType_<MT> > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   DisableIf_< IsNumeric< ElementType_<MT> > >
+      serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+   EnableIf_< IsNumeric< ElementType_<MT> > >
+      serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
    //@}
    //**********************************************************************************************
 
@@ -307,6 +319,18 @@ class MatrixSerializer
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename ET, typename Archive, typename OP >
+   DisableIf_< IsNumeric<ET> > deserializeDenseLine( Archive& archive, size_t n, OP op );
+
+   template< typename ET, typename Archive, typename OP >
+   EnableIf_< IsNumeric<ET> > deserializeDenseLine( Archive& archive, size_t n, OP op );
+
+   template< typename ET, typename Archive, typename OP >
+   DisableIf_< IsNumeric<ET> > deserializeSparseLine( Archive& archive, size_t n, OP op );
+
+   template< typename ET, typename Archive, typename OP >
+   EnableIf_< IsNumeric<ET> > deserializeSparseLine( Archive& archive, size_t n, OP op );
    //@}
    //**********************************************************************************************
 
@@ -320,6 +344,8 @@ class MatrixSerializer
    uint64_t rows_;         //!< The number of rows of the matrix.
    uint64_t columns_;      //!< The number of columns of the matrix.
    uint64_t number_;       //!< The total number of elements contained in the matrix.
+
+   std::vector<byte_t> buffer_;  //!< Buffer for the block-wise (de-)serialization of numeric elements.
    //@}
    //**********************************************************************************************
 };
@@ -345,6 +371,7 @@ MatrixSerializer::MatrixSerializer()
    , rows_       ( 0UL )  // The number of rows of the matrix
    , columns_    ( 0UL )  // The number of columns of the matrix
    , number_     ( 0UL )  // The total number of elements contained in the matrix
+   , buffer_     ()       // Buffer for the block-wise (de-)serialization of numeric elements
 {}
 //*************************************************************************************************
 
@@ -410,7 +437,7 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a dense matrix.
+/*!\brief Serializes the elements of a dense matrix with non-numeric element type.
 //
 // \param archive The archive to be written.
 // \param mat The matrix to be serialized.
@@ -420,7 +447,8 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+DisableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
    if( IsRowMajorMatrix<MT>::value ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
@@ -445,7 +473,46 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a sparse matrix.
+/*!\brief Serializes the elements of a dense matrix with numeric element type.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function gathers each row (or column in case of a column-major matrix) in a buffer and
+// writes it to the archive by means of a single block write.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   typedef ElementType_<MT>  ET;
+
+   const size_t lines( SO ? (~mat).columns() : (~mat).rows() );
+   const size_t size ( SO ? (~mat).rows() : (~mat).columns() );
+
+   buffer_.resize( size*sizeof( ET ) );
+   ET* const line( reinterpret_cast<ET*>( buffer_.data() ) );
+
+   for( size_t i=0UL; i<lines && archive; ++i ) {
+      for( size_t j=0UL; j<size; ++j ) {
+         line[j] = SO ? (~mat)(j,i) : (~mat)(i,j);
+      }
+      archive.write( line, size );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix with non-numeric element type.
 //
 // \param archive The archive to be written.
 // \param mat The matrix to be serialized.
@@ -455,7 +522,8 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+DisableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
 {
    typedef ConstIterator_<MT>  ConstIterator;
 
@@ -483,6 +551,61 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix with numeric element type.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// This function gathers the number of non-zero elements and the index/value pairs of each row
+// (or column in case of a column-major matrix) in a buffer and writes it to the archive by means
+// of a single block write. The resulting representation is identical to the element-wise
+// serialization.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   typedef ElementType_<MT>     ET;
+   typedef ConstIterator_<MT>  ConstIterator;
+
+   const size_t lines( SO ? (~mat).columns() : (~mat).rows() );
+
+   for( size_t i=0UL; i<lines && archive; ++i )
+   {
+      const uint64_t number( (~mat).nonZeros( i ) );
+
+      buffer_.resize( sizeof( uint64_t ) + number*( sizeof( size_t ) + sizeof( ET ) ) );
+      byte_t* ptr( buffer_.data() );
+
+      std::memcpy( ptr, &number, sizeof( uint64_t ) );
+      ptr += sizeof( uint64_t );
+
+      for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+         const size_t index( element->index() );
+         const ET     value( element->value() );
+         std::memcpy( ptr, &index, sizeof( size_t ) );
+         ptr += sizeof( size_t );
+         std::memcpy( ptr, &value, sizeof( ET ) );
+         ptr += sizeof( ET );
+      }
+
+      BLAZE_INTERNAL_ASSERT( ptr == buffer_.data() + buffer_.size(), "Invalid number of non-zero elements" );
+
+      archive.write( buffer_.data(), buffer_.size() );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -684,14 +807,10 @@ void MatrixSerializer::deserializeDenseRowMatrix( Archive& archive, DenseMatrix<
 {
    typedef ElementType_<MT>  ET;
 
-   ET value = ET();
-
-   for( size_t i=0UL; i<rows_; ++i ) {
-      size_t j( 0UL );
-      while( ( j != columns_ ) && ( archive >> value ) ) {
+   for( size_t i=0UL; i<rows_ && archive; ++i ) {
+      deserializeDenseLine<ET>( archive, columns_, [&mat,i]( size_t j, const ET& value ) {
          (~mat)(i,j) = value;
-         ++j;
-      }
+      } );
    }
 
    if( !archive ) {
@@ -823,14 +942,10 @@ void MatrixSerializer::deserializeDenseColumnMatrix( Archive& archive, DenseMatr
 {
    typedef ElementType_<MT>  ET;
 
-   ET value = ET();
-
-   for( size_t j=0UL; j<columns_; ++j ) {
-      size_t i( 0UL );
-      while( ( i != rows_ ) && ( archive >> value ) ) {
+   for( size_t j=0UL; j<columns_ && archive; ++j ) {
+      deserializeDenseLine<ET>( archive, rows_, [&mat,j]( size_t i, const ET& value ) {
          (~mat)(i,j) = value;
-         ++i;
-      }
+      } );
    }
 
    if( !archive ) {
@@ -932,17 +1047,10 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix
 {
    typedef ElementType_<MT>  ET;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
-   for( size_t i=0UL; i<rows_; ++i ) {
-      archive >> number;
-      size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
+   for( size_t i=0UL; i<rows_ && archive; ++i ) {
+      deserializeSparseLine<ET>( archive, columns_, [&mat,i]( size_t index, const ET& value ) {
          (~mat)(i,index) = value;
-         ++j;
-      }
+      } );
    }
 
    if( !archive ) {
@@ -970,19 +1078,11 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatri
 {
    typedef ElementType_<MT>  ET;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
-   for( size_t i=0UL; i<rows_; ++i )
+   for( size_t i=0UL; i<rows_ && archive; ++i )
    {
-      archive >> number;
-
-      size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
+      deserializeSparseLine<ET>( archive, columns_, [&mat,i]( size_t index, const ET& value ) {
          (~mat).append( i, index, value, false );
-         ++j;
-      }
+      } );
 
       (~mat).finalize( i );
    }
@@ -1040,17 +1140,10 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMat
 {
    typedef ElementType_<MT>  ET;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
-   for( size_t j=0UL; j<columns_; ++j ) {
-      archive >> number;
-      size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
+   for( size_t j=0UL; j<columns_ && archive; ++j ) {
+      deserializeSparseLine<ET>( archive, rows_, [&mat,j]( size_t index, const ET& value ) {
          (~mat)(index,j) = value;
-         ++i;
-      }
+      } );
    }
 
    if( !archive ) {
@@ -1105,19 +1198,11 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 {
    typedef ElementType_<MT>  ET;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
-   for( size_t j=0UL; j<columns_; ++j )
+   for( size_t j=0UL; j<columns_ && archive; ++j )
    {
-      archive >> number;
-
-      size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
+      deserializeSparseLine<ET>( archive, rows_, [&mat,j]( size_t index, const ET& value ) {
          (~mat).append( index, j, value, false );
-         ++i;
-      }
+      } );
 
       (~mat).finalize( j );
    }
@@ -1129,6 +1214,150 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a single dense row/column with non-numeric element type.
+//
+// \param archive The archive to be read from.
+// \param n The number of elements of the row/column.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+//
+// This function deserializes the \a n elements of a dense row/column one by one and passes
+// each element together with its index to the given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+DisableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeDenseLine( Archive& archive, size_t n, OP op )
+{
+   ET value = ET();
+
+   size_t j( 0UL );
+   while( ( j != n ) && ( archive >> value ) ) {
+      op( j, value );
+      ++j;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single dense row/column with numeric element type.
+//
+// \param archive The archive to be read from.
+// \param n The number of elements of the row/column.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+//
+// This function reads the \a n elements of a dense row/column by means of a single block read
+// and passes each element together with its index to the given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+EnableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeDenseLine( Archive& archive, size_t n, OP op )
+{
+   buffer_.resize( n*sizeof( ET ) );
+   const ET* const line( reinterpret_cast<const ET*>( buffer_.data() ) );
+
+   if( !archive.read( reinterpret_cast<ET*>( buffer_.data() ), n ) )
+      return;
+
+   for( size_t j=0UL; j<n; ++j ) {
+      op( j, line[j] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single sparse row/column with non-numeric element type.
+//
+// \param archive The archive to be read from.
+// \param n The size of the row/column.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+// \exception std::runtime_error Invalid number of elements detected.
+//
+// This function deserializes the number of non-zero elements of a sparse row/column and the
+// according index/value pairs one by one. Each pair is passed to the given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+DisableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeSparseLine( Archive& archive, size_t n, OP op )
+{
+   uint64_t number( 0UL );
+   size_t   index ( 0UL );
+   ET       value = ET();
+
+   if( !( archive >> number ) )
+      return;
+
+   if( number > n ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   size_t k( 0UL );
+   while( ( k != number ) && ( archive >> index >> value ) ) {
+      op( index, value );
+      ++k;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single sparse row/column with numeric element type.
+//
+// \param archive The archive to be read from.
+// \param n The size of the row/column.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+// \exception std::runtime_error Invalid number of elements detected.
+//
+// This function deserializes the number of non-zero elements of a sparse row/column and reads
+// the according index/value pairs by means of a single block read. Each pair is passed to the
+// given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+EnableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeSparseLine( Archive& archive, size_t n, OP op )
+{
+   uint64_t number( 0UL );
+   size_t   index ( 0UL );
+   ET       value = ET();
+
+   if( !( archive >> number ) )
+      return;
+
+   if( number > n ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   buffer_.resize( number*( sizeof( size_t ) + sizeof( ET ) ) );
+
+   if( !archive.read( buffer_.data(), buffer_.size() ) )
+      return;
+
+   const byte_t* ptr( buffer_.data() );
+
+   for( size_t k=0UL; k<number; ++k ) {
+      std::memcpy( &index, ptr, sizeof( size_t ) );
+      ptr += sizeof( size_t );
+      std::memcpy( &value, ptr, sizeof( ET ) );
+      ptr += sizeof( ET );
+      op( index, value );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
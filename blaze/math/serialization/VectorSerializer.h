@@ -40,12 +40,15 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstring>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Vector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/expressions/Vector.h>
+#include <blaze/math/Functions.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsResizable.h>
@@ -231,10 +234,20 @@ class VectorSerializer
    void serializeHeader( Archive& archive, const VT& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+   DisableIf_< IsNumeric< ElementType_<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+   EnableIf_< IsNumeric< ElementType_<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   DisableIf_< IsNumeric< ElementType_<VT> > >
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   EnableIf_< IsNumeric< ElementType_<VT> > >
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
    //@}
    //**********************************************************************************************
 
@@ -272,9 +285,28 @@ class VectorSerializer
 
    template< typename Archive, typename VT, bool TF >
    void deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
+
+   template< typename ET, typename Archive, typename OP >
+   DisableIf_< IsNumeric<ET> > deserializeDenseElements( Archive& archive, OP op );
+
+   template< typename ET, typename Archive, typename OP >
+   EnableIf_< IsNumeric<ET> > deserializeDenseElements( Archive& archive, OP op );
+
+   template< typename ET, typename Archive, typename OP >
+   DisableIf_< IsNumeric<ET> > deserializeSparseElements( Archive& archive, OP op );
+
+   template< typename ET, typename Archive, typename OP >
+   EnableIf_< IsNumeric<ET> > deserializeSparseElements( Archive& archive, OP op );
    //@}
    //**********************************************************************************************
 
+   //**Block size**********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Number of elements per block of the block-wise (de-)serialization of numeric elements.
+   enum : size_t { blockSize = 4096UL };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -284,6 +316,8 @@ class VectorSerializer
    uint8_t  elementSize_;  //!< The size in bytes of a single element of the vector.
    uint64_t size_;         //!< The size of the vector.
    uint64_t number_;       //!< The total number of elements contained in the vector.
+
+   std::vector<byte_t> buffer_;  //!< Buffer for the block-wise (de-)serialization of numeric elements.
    //@}
    //**********************************************************************************************
 };
@@ -308,6 +342,7 @@ VectorSerializer::VectorSerializer()
    , elementSize_( 0U  )  // The size in bytes of a single element of the vector
    , size_       ( 0UL )  // The size of the vector
    , number_     ( 0UL )  // The total number of elements contained in the vector
+   , buffer_     ()       // Buffer for the block-wise (de-)serialization of numeric elements
 {}
 //*************************************************************************************************
 
@@ -375,7 +410,7 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a dense vector.
+/*!\brief Serializes the elements of a dense vector with non-numeric element type.
 //
 // \param archive The archive to be written.
 // \param vec The vector to be serialized.
@@ -385,7 +420,8 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+DisableIf_< IsNumeric< ElementType_<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
 {
    size_t i( 0UL );
    while( ( i < (~vec).size() ) && ( archive << (~vec)[i] ) ) {
@@ -400,7 +436,46 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a sparse vector.
+/*!\brief Serializes the elements of a dense vector with numeric element type.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+//
+// This function gathers blocks of elements in a buffer and writes each block to the archive
+// by means of a single block write.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_< IsNumeric< ElementType_<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   typedef ElementType_<VT>  ET;
+
+   const size_t size( (~vec).size() );
+
+   buffer_.resize( min( size, size_t( blockSize ) )*sizeof( ET ) );
+   ET* const block( reinterpret_cast<ET*>( buffer_.data() ) );
+
+   for( size_t i=0UL; i<size && archive; i+=blockSize ) {
+      const size_t iend( min( i+blockSize, size ) );
+      for( size_t j=i; j<iend; ++j ) {
+         block[j-i] = (~vec)[j];
+      }
+      archive.write( block, iend-i );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse vector with non-numeric element type.
 //
 // \param archive The archive to be written.
 // \param vec The vector to be serialized.
@@ -410,7 +485,8 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+DisableIf_< IsNumeric< ElementType_<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
 {
    typedef ConstIterator_<VT>  ConstIterator;
 
@@ -427,6 +503,54 @@ void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse vector with numeric element type.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Sparse vector could not be serialized.
+//
+// This function gathers blocks of index/value pairs in a buffer and writes each block to the
+// archive by means of a single block write. The resulting representation is identical to the
+// element-wise serialization.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_< IsNumeric< ElementType_<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+{
+   typedef ElementType_<VT>     ET;
+   typedef ConstIterator_<VT>  ConstIterator;
+
+   buffer_.resize( blockSize*( sizeof( size_t ) + sizeof( ET ) ) );
+
+   ConstIterator element( (~vec).begin() );
+
+   while( element != (~vec).end() && archive )
+   {
+      byte_t* ptr( buffer_.data() );
+
+      for( size_t k=0UL; k<blockSize && element!=(~vec).end(); ++k, ++element ) {
+         const size_t index( element->index() );
+         const ET     value( element->value() );
+         std::memcpy( ptr, &index, sizeof( size_t ) );
+         ptr += sizeof( size_t );
+         std::memcpy( ptr, &value, sizeof( ET ) );
+         ptr += sizeof( ET );
+      }
+
+      archive.write( buffer_.data(), size_t( ptr - buffer_.data() ) );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -598,13 +722,9 @@ typename DisableIfTrue< VT::simdEnabled >::Type
 {
    typedef ElementType_<VT>  ET;
 
-   size_t i( 0UL );
-   ET value = ET();
-
-   while( ( i != size_ ) && ( archive >> value ) ) {
+   deserializeDenseElements<ET>( archive, [&vec]( size_t i, const ET& value ) {
       (~vec)[i] = value;
-      ++i;
-   }
+   } );
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be deserialized" );
@@ -660,13 +780,9 @@ void VectorSerializer::deserializeDenseVector( Archive& archive, SparseVector<VT
 {
    typedef ElementType_<VT>  ET;
 
-   size_t i( 0UL );
-   ET value = ET();
-
-   while( ( i != size_ ) && ( archive >> value ) ) {
+   deserializeDenseElements<ET>( archive, [&vec]( size_t i, const ET& value ) {
       (~vec)[i] = value;
-      ++i;
-   }
+   } );
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be deserialized" );
@@ -694,14 +810,9 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT
 {
    typedef ElementType_<VT>  ET;
 
-   size_t i( 0UL );
-   size_t index( 0UL );
-   ET     value = ET();
-
-   while( ( i != number_ ) && ( archive >> index >> value ) ) {
+   deserializeSparseElements<ET>( archive, [&vec]( size_t index, const ET& value ) {
       (~vec)[index] = value;
-      ++i;
-   }
+   } );
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be deserialized" );
@@ -729,17 +840,145 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 {
    typedef ElementType_<VT>  ET;
 
+   deserializeSparseElements<ET>( archive, [&vec]( size_t index, const ET& value ) {
+      (~vec).append( index, value, false );
+   } );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the elements of a dense vector with non-numeric element type.
+//
+// \param archive The archive to be read from.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+//
+// This function deserializes the elements of a dense vector one by one and passes each element
+// together with its index to the given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+DisableIf_< IsNumeric<ET> >
+   VectorSerializer::deserializeDenseElements( Archive& archive, OP op )
+{
+   ET value = ET();
+
    size_t i( 0UL );
+   while( ( i != size_ ) && ( archive >> value ) ) {
+      op( i, value );
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the elements of a dense vector with numeric element type.
+//
+// \param archive The archive to be read from.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+//
+// This function reads the elements of a dense vector block-wise and passes each element
+// together with its index to the given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+EnableIf_< IsNumeric<ET> >
+   VectorSerializer::deserializeDenseElements( Archive& archive, OP op )
+{
+   buffer_.resize( min( size_t( size_ ), size_t( blockSize ) )*sizeof( ET ) );
+   ET* const block( reinterpret_cast<ET*>( buffer_.data() ) );
+
+   for( size_t i=0UL; i<size_; i+=blockSize )
+   {
+      const size_t iend( min( i+blockSize, size_t( size_ ) ) );
+
+      if( !archive.read( block, iend-i ) )
+         return;
+
+      for( size_t j=i; j<iend; ++j ) {
+         op( j, block[j-i] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the elements of a sparse vector with non-numeric element type.
+//
+// \param archive The archive to be read from.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+//
+// This function deserializes the index/value pairs of a sparse vector one by one and passes
+// each pair to the given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+DisableIf_< IsNumeric<ET> >
+   VectorSerializer::deserializeSparseElements( Archive& archive, OP op )
+{
    size_t index( 0UL );
    ET     value = ET();
 
+   size_t i( 0UL );
    while( ( i != number_ ) && ( archive >> index >> value ) ) {
-      (~vec).append( index, value, false );
+      op( index, value );
       ++i;
    }
+}
+//*************************************************************************************************
 
-   if( !archive ) {
-      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be deserialized" );
+
+//*************************************************************************************************
+/*!\brief Deserializes the elements of a sparse vector with numeric element type.
+//
+// \param archive The archive to be read from.
+// \param op The operation to be applied to each deserialized element.
+// \return void
+//
+// This function reads the index/value pairs of a sparse vector block-wise and passes each pair
+// to the given operation.
+*/
+template< typename ET       // Type of the elements
+        , typename Archive  // Type of the archive
+        , typename OP >     // Type of the operation
+EnableIf_< IsNumeric<ET> >
+   VectorSerializer::deserializeSparseElements( Archive& archive, OP op )
+{
+   const size_t elementSize( sizeof( size_t ) + sizeof( ET ) );
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   buffer_.resize( min( size_t( number_ ), size_t( blockSize ) )*elementSize );
+
+   for( size_t i=0UL; i<number_; i+=blockSize )
+   {
+      const size_t iend( min( i+blockSize, size_t( number_ ) ) );
+
+      if( !archive.read( buffer_.data(), ( iend-i )*elementSize ) )
+         return;
+
+      const byte_t* ptr( buffer_.data() );
+
+      for( size_t j=i; j<iend; ++j ) {
+         std::memcpy( &index, ptr, sizeof( size_t ) );
+         ptr += sizeof( size_t );
+         std::memcpy( &value, ptr, sizeof( ET ) );
+         ptr += sizeof( ET );
+         op( index, value );
+      }
    }
 }
 //*************************************************************************************************
@@ -63,7 +63,11 @@ namespace blaze {
 // This operation is only available for SSSE3, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint8 abs( const SIMDint8& a ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_abs_epi8( a.value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_abs_epi8( a.value );
 }
@@ -95,7 +99,11 @@ BLAZE_ALWAYS_INLINE const SIMDuint8 abs( const SIMDint8& a ) noexcept
 // This operation is only available for SSSE3, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint16 abs( const SIMDint16& a ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_abs_epi16( a.value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_abs_epi16( a.value );
 }
@@ -127,7 +135,11 @@ BLAZE_ALWAYS_INLINE const SIMDuint16 abs( const SIMDint16& a ) noexcept
 // This operation is only available for SSSE3, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint32 abs( const SIMDint32& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_abs_epi32( 0xFFFF, a.value );
+}
+#elif BLAZE_MIC_MODE
 {
    return _mm512_abs_epi32( a.value );
 }
@@ -163,7 +175,11 @@ BLAZE_ALWAYS_INLINE const SIMDuint32 abs( const SIMDint32& a ) noexcept
 // This operation is only available for AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDuint64 abs( const SIMDint64& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_abs_epi64( 0xFF, a.value );
+}
+#elif BLAZE_MIC_MODE
 {
    return _mm512_abs_epi64( a.value );
 }
@@ -172,6 +188,77 @@ BLAZE_ALWAYS_INLINE const SIMDuint64 abs( const SIMDint64& a ) noexcept
 #endif
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Absolute value of a vector of single precision floating point values.
+// \ingroup simd
+//
+// \param a The vector of single precision floating point values.
+// \return The absolute values.
+//
+// This operation is only available for SSE, AVX, and AVX-512.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat abs( const SIMDfloat& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_abs_ps( a.value );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_andnot_ps( _mm256_set1_ps( -0.0F ), a.value );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_andnot_ps( _mm_set1_ps( -0.0F ), a.value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Absolute value of a vector of double precision floating point values.
+// \ingroup simd
+//
+// \param a The vector of double precision floating point values.
+// \return The absolute values.
+//
+// This operation is only available for SSE2, AVX, and AVX-512.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble abs( const SIMDdouble& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_abs_pd( a.value );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a.value );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a.value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -65,10 +65,15 @@ namespace blaze {
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat ceil( const SIMDf32<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_ceil_ps( (~a).eval().value );
 }
+#elif BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_roundscale_ps( 0xFFFF, (~a).eval().value,
+                                      _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC );
+}
 #elif BLAZE_AVX_MODE
 {
    return _mm256_ceil_ps( (~a).eval().value );
@@ -103,10 +108,15 @@ BLAZE_ALWAYS_INLINE const SIMDfloat ceil( const SIMDf32<T>& a ) noexcept
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble ceil( const SIMDf64<T>& a ) noexcept
-#if BLAZE_SVML_MODE && BLAZE_MIC_MODE
+#if BLAZE_SVML_MODE && ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
 {
    return _mm512_ceil_pd( (~a).eval().value );
 }
+#elif BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_roundscale_pd( 0xFF, (~a).eval().value,
+                                      _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC );
+}
 #elif BLAZE_AVX_MODE
 {
    return _mm256_ceil_pd( (~a).eval().value );
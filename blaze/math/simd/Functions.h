@@ -59,12 +59,15 @@
 #include <blaze/math/simd/Exp.h>
 #include <blaze/math/simd/Floor.h>
 #include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Gather.h>
 #include <blaze/math/simd/InvCbrt.h>
 #include <blaze/math/simd/InvSqrt.h>
 #include <blaze/math/simd/Loada.h>
 #include <blaze/math/simd/Loadu.h>
 #include <blaze/math/simd/Log.h>
 #include <blaze/math/simd/Log10.h>
+#include <blaze/math/simd/Max.h>
+#include <blaze/math/simd/Min.h>
 #include <blaze/math/simd/Multiplication.h>
 #include <blaze/math/simd/Pow.h>
 #include <blaze/math/simd/Reduction.h>
@@ -79,5 +82,6 @@
 #include <blaze/math/simd/Subtraction.h>
 #include <blaze/math/simd/Tan.h>
 #include <blaze/math/simd/Tanh.h>
+#include <blaze/math/simd/Transpose.h>
 
 #endif
@@ -0,0 +1,133 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_GATHER_H_
+#define _BLAZE_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values from the given indexed positions.
+// \ingroup simd
+//
+// \param address The base address of the 'float' values to be gathered.
+// \param indices The first of the 32-bit offsets of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function loads the 'float' values \c address[indices[0]], \c address[indices[1]], ...
+// into a single SIMD vector. The array of offsets is not required to be properly aligned. Since
+// the offsets are interpreted as signed 32-bit integers, each offset must be smaller than
+// \f$ 2^{31} \f$. This operation is only available for AVX2 and AVX-512. Note that the masked
+// form of the gather instruction with a zero source vector and a full mask is used in order to
+// avoid the uninitialized source vector of the unmasked intrinsics.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, const uint32_t* indices ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_mask_i32gather_ps( _mm512_setzero_ps(), 0xFFFF,
+                                    _mm512_loadu_si512( indices ), address, 4 );
+}
+#elif BLAZE_AVX2_MODE
+{
+   return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), address,
+                                    _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ),
+                                    _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ), 4 );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values from the given indexed positions.
+// \ingroup simd
+//
+// \param address The base address of the 'double' values to be gathered.
+// \param indices The first of the 32-bit offsets of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function loads the 'double' values \c address[indices[0]], \c address[indices[1]], ...
+// into a single SIMD vector. The array of offsets is not required to be properly aligned. Since
+// the offsets are interpreted as signed 32-bit integers, each offset must be smaller than
+// \f$ 2^{31} \f$. This operation is only available for AVX2 and AVX-512. Note that the masked
+// form of the gather instruction with a zero source vector and a full mask is used in order to
+// avoid the uninitialized source vector of the unmasked intrinsics.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble gather( const double* address, const uint32_t* indices ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_mask_i32gather_pd( _mm512_setzero_pd(), 0xFF,
+                                    _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ),
+                                    address, 8 );
+}
+#elif BLAZE_AVX2_MODE
+{
+   return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), address,
+                                    _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ),
+                                    _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ), 8 );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
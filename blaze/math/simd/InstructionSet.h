@@ -0,0 +1,240 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/InstructionSet.h
+//  \brief Header file for the runtime detection of the SIMD instruction set
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_INSTRUCTIONSET_H_
+#define _BLAZE_MATH_SIMD_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SIMD INSTRUCTION SETS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief SIMD instruction sets of the Blaze library.
+// \ingroup simd
+//
+// The SIMDInstructionSet enumeration lists the instruction sets that can be used by the runtime
+// dispatched kernels of the Blaze library (see the \c BLAZE_USE_RUNTIME_DISPATCH configuration
+// switch). The enumeration values are ordered, i.e. a larger value represents a superset of the
+// instructions of a smaller value.
+*/
+enum SIMDInstructionSet
+{
+   noSIMD = 0,  //!< Scalar execution without SIMD instructions.
+   sse2   = 1,  //!< 128-bit SSE2 instructions.
+   avx2   = 2,  //!< 256-bit AVX2 and FMA instructions.
+   avx512 = 3   //!< 512-bit AVX-512F instructions.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Instruction set functions */
+//@{
+inline SIMDInstructionSet getCompiledInstructionSet() noexcept;
+inline SIMDInstructionSet detectInstructionSet() noexcept;
+inline SIMDInstructionSet getInstructionSet() noexcept;
+inline const char* getInstructionSetName( SIMDInstructionSet set ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the SIMD instruction set the program has been compiled for.
+// \ingroup simd
+//
+// \return The compile time SIMD instruction set.
+//
+// This function returns the instruction set that is enabled by the compiler flags. All kernels
+// of the Blaze library that are not dispatched at runtime use this instruction set.
+*/
+inline SIMDInstructionSet getCompiledInstructionSet() noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return avx512;
+#elif BLAZE_AVX2_MODE && BLAZE_FMA_MODE
+   return avx2;
+#elif BLAZE_SSE2_MODE
+   return sse2;
+#else
+   return noSIMD;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Detects the SIMD instruction set of the executing CPU.
+// \ingroup simd
+//
+// \return The widest SIMD instruction set supported by the executing CPU.
+//
+// This function queries the executing CPU via the \c cpuid instruction (including the check
+// whether the operating system saves the according register state) and returns the widest
+// instruction set available. In case the runtime dispatch mode is not active, the function
+// returns the compile time instruction set.
+*/
+inline SIMDInstructionSet detectInstructionSet() noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) )
+      return avx512;
+   else if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return avx2;
+   else if( __builtin_cpu_supports( "sse2" ) )
+      return sse2;
+   else
+      return noSIMD;
+#else
+   return getCompiledInstructionSet();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the SIMD instruction set for the runtime dispatched kernels.
+// \ingroup simd
+//
+// \return The selected SIMD instruction set.
+//
+// This auxiliary function selects the instruction set for the runtime dispatched kernels. The
+// selection is based on the instruction set of the executing CPU, which can be restricted via
+// the \c BLAZE_INSTRUCTION_SET environment variable (\c "none", \c "sse2", \c "avx2", or
+// \c "avx512"). The selected instruction set is never smaller than the compile time instruction
+// set.
+*/
+inline SIMDInstructionSet selectInstructionSet() noexcept
+{
+   SIMDInstructionSet set( detectInstructionSet() );
+
+   const char* env = std::getenv( "BLAZE_INSTRUCTION_SET" );
+
+   if( env != nullptr ) {
+      SIMDInstructionSet limit( set );
+
+      if     ( std::strcmp( env, "none"   ) == 0 ) limit = noSIMD;
+      else if( std::strcmp( env, "sse2"   ) == 0 ) limit = sse2;
+      else if( std::strcmp( env, "avx2"   ) == 0 ) limit = avx2;
+      else if( std::strcmp( env, "avx512" ) == 0 ) limit = avx512;
+
+      if( limit < set )
+         set = limit;
+   }
+
+   if( set < getCompiledInstructionSet() )
+      set = getCompiledInstructionSet();
+
+   return set;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the SIMD instruction set used by the runtime dispatched kernels.
+// \ingroup simd
+//
+// \return The selected SIMD instruction set.
+//
+// This function returns the instruction set that is used by the runtime dispatched kernels
+// of the Blaze library. The instruction set is selected once, on the first call of the function
+// (which happens at the latest during the first dispatched operation), and remains the same for
+// the lifetime of the program. The following example demonstrates how to log the selection:
+
+   \code
+   const blaze::SIMDInstructionSet set( blaze::getInstructionSet() );
+   std::cout << "Blaze SIMD kernels: " << blaze::getInstructionSetName( set ) << "\n";
+   \endcode
+
+// In case the runtime dispatch mode is not active, the function returns the compile time
+// instruction set.
+*/
+inline SIMDInstructionSet getInstructionSet() noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   static const SIMDInstructionSet set( selectInstructionSet() );
+   return set;
+#else
+   return getCompiledInstructionSet();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given SIMD instruction set.
+// \ingroup simd
+//
+// \param set The SIMD instruction set.
+// \return The name of the instruction set.
+*/
+inline const char* getInstructionSetName( SIMDInstructionSet set ) noexcept
+{
+   switch( set ) {
+      case avx512: return "AVX-512";
+      case avx2  : return "AVX2";
+      case sse2  : return "SSE2";
+      default    : return "none";
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -81,7 +81,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,1UL> >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_load_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -111,7 +113,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,1UL> >
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_load_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -148,7 +152,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,2UL> >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_load_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -178,7 +184,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,2UL> >
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_load_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -215,7 +223,7 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_epi32( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
@@ -247,7 +255,7 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_epi32( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
@@ -286,7 +294,7 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_epi64( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
@@ -318,7 +326,7 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_epi64( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
@@ -354,7 +362,7 @@ BLAZE_ALWAYS_INLINE const SIMDfloat loada( const float* address ) noexcept
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_ps( address );
 #elif BLAZE_AVX_MODE
    return _mm256_load_ps( address );
@@ -383,7 +391,7 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat loada( const complex<float>* address ) noex
    BLAZE_STATIC_ASSERT  ( sizeof( complex<float> ) == 2UL*sizeof( float ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_ps( reinterpret_cast<const float*>( address ) );
 #elif BLAZE_AVX_MODE
    return _mm256_load_ps( reinterpret_cast<const float*>( address ) );
@@ -419,7 +427,7 @@ BLAZE_ALWAYS_INLINE const SIMDdouble loada( const double* address ) noexcept
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_pd( address );
 #elif BLAZE_AVX_MODE
    return _mm256_load_pd( address );
@@ -448,7 +456,7 @@ BLAZE_ALWAYS_INLINE const SIMDcdouble loada( const complex<double>* address ) no
    BLAZE_STATIC_ASSERT  ( sizeof( complex<double> ) == 2UL*sizeof( double ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return _mm512_load_pd( reinterpret_cast<const double*>( address ) );
 #elif BLAZE_AVX_MODE
    return _mm256_load_pd( reinterpret_cast<const double*>( address ) );
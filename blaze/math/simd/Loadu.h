@@ -43,11 +43,13 @@
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasSize.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsSigned.h>
@@ -76,7 +78,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,1UL> >
                                    , If_< IsSigned<T>, SIMDint8, SIMDuint8 > >
    loadu( const T* address ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -104,7 +108,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,1UL> >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -138,7 +144,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,2UL> >
                                    , If_< IsSigned<T>, SIMDint16, SIMDuint16 > >
    loadu( const T* address ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -166,7 +174,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,2UL> >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -200,7 +210,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >
                                    , If_< IsSigned<T>, SIMDint32, SIMDuint32 > >
    loadu( const T* address ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_MIC_MODE
    __m512i v1 = _mm512_setzero_epi32();
    v1 = _mm512_loadunpacklo_epi32( v1, address );
    v1 = _mm512_loadunpackhi_epi32( v1, address+16UL );
@@ -233,7 +245,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_MIC_MODE
    __m512i v1 = _mm512_setzero_epi32();
    v1 = _mm512_loadunpacklo_epi32( v1, address );
    v1 = _mm512_loadunpackhi_epi32( v1, address+8UL );
@@ -272,7 +286,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
                                    , If_< IsSigned<T>, SIMDint64, SIMDuint64 > >
    loadu( const T* address ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_MIC_MODE
    __m512i v1 = _mm512_setzero_epi32();
    v1 = _mm512_loadunpacklo_epi64( v1, address );
    v1 = _mm512_loadunpackhi_epi64( v1, address+8UL );
@@ -305,7 +321,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_MIC_MODE
    __m512i v1 = _mm512_setzero_epi32();
    v1 = _mm512_loadunpacklo_epi64( v1, address );
    v1 = _mm512_loadunpackhi_epi64( v1, address+4UL );
@@ -341,7 +359,9 @@ BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
 */
 BLAZE_ALWAYS_INLINE const SIMDfloat loadu( const float* address ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_ps( address );
+#elif BLAZE_MIC_MODE
    __m512 v1 = _mm512_setzero_ps();
    v1 = _mm512_loadunpacklo_ps( v1, address );
    v1 = _mm512_loadunpackhi_ps( v1, address+16UL );
@@ -371,7 +391,9 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat loadu( const complex<float>* address ) noex
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_ps( reinterpret_cast<const float*>( address ) );
+#elif BLAZE_MIC_MODE
    __m512 v1 = _mm512_setzero_ps();
    v1 = _mm512_loadunpacklo_ps( v1, reinterpret_cast<const float*>( address     ) );
    v1 = _mm512_loadunpackhi_ps( v1, reinterpret_cast<const float*>( address+8UL ) );
@@ -407,7 +429,9 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat loadu( const complex<float>* address ) noex
 */
 BLAZE_ALWAYS_INLINE const SIMDdouble loadu( const double* address ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_pd( address );
+#elif BLAZE_MIC_MODE
    __m512d v1 = _mm512_setzero_pd();
    v1 = _mm512_loadunpacklo_pd( v1, address );
    v1 = _mm512_loadunpackhi_pd( v1, address+8UL );
@@ -437,7 +461,9 @@ BLAZE_ALWAYS_INLINE const SIMDcdouble loadu( const complex<double>* address ) no
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   return _mm512_loadu_pd( reinterpret_cast<const double*>( address ) );
+#elif BLAZE_MIC_MODE
    __m512d v1 = _mm512_setzero_pd();
    v1 = _mm512_loadunpacklo_pd( v1, reinterpret_cast<const double*>( address     ) );
    v1 = _mm512_loadunpackhi_pd( v1, reinterpret_cast<const double*>( address+4UL ) );
@@ -452,6 +478,124 @@ BLAZE_ALWAYS_INLINE const SIMDcdouble loadu( const complex<double>* address ) no
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  MASKED LOADS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The first 4-byte integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMDSIZE)\f$.
+// \return The loaded vector of 4-byte integral values.
+//
+// This function loads the first \a n 4-byte integral values starting at the given address and sets
+// all remaining elements of the vector to zero. No memory beyond the \a n values is accessed,
+// which allows the remainder of an unpadded array to be processed without a scalar loop. The
+// given address is not required to be properly aligned. This operation is only available for
+// AVX-512.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,4UL> >
+                                   , If_< IsSigned<T>, SIMDint32, SIMDuint32 > >
+   loadu( const T* address, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 16UL, "Invalid number of elements" );
+   return _mm512_maskz_loadu_epi32( static_cast<__mmask16>( ( 1U << n ) - 1U ), address );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The first 8-byte integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMDSIZE)\f$.
+// \return The loaded vector of 8-byte integral values.
+//
+// This function loads the first \a n 8-byte integral values starting at the given address and sets
+// all remaining elements of the vector to zero. No memory beyond the \a n values is accessed,
+// which allows the remainder of an unpadded array to be processed without a scalar loop. The
+// given address is not required to be properly aligned. This operation is only available for
+// AVX-512.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_< And< IsIntegral<T>, HasSize<T,8UL> >
+                                   , If_< IsSigned<T>, SIMDint64, SIMDuint64 > >
+   loadu( const T* address, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 8UL, "Invalid number of elements" );
+   return _mm512_maskz_loadu_epi64( static_cast<__mmask8>( ( 1U << n ) - 1U ), address );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'float' values.
+// \ingroup simd
+//
+// \param address The first 'float' value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMDSIZE)\f$.
+// \return The loaded vector of 'float' values.
+//
+// This function loads the first \a n 'float' values starting at the given address and sets
+// all remaining elements of the vector to zero. No memory beyond the \a n values is accessed,
+// which allows the remainder of an unpadded array to be processed without a scalar loop. The
+// given address is not required to be properly aligned. This operation is only available for
+// AVX-512.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loadu( const float* address, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 16UL, "Invalid number of elements" );
+   return _mm512_maskz_loadu_ps( static_cast<__mmask16>( ( 1U << n ) - 1U ), address );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'double' values.
+// \ingroup simd
+//
+// \param address The first 'double' value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMDSIZE)\f$.
+// \return The loaded vector of 'double' values.
+//
+// This function loads the first \a n 'double' values starting at the given address and sets
+// all remaining elements of the vector to zero. No memory beyond the \a n values is accessed,
+// which allows the remainder of an unpadded array to be processed without a scalar loop. The
+// given address is not required to be properly aligned. This operation is only available for
+// AVX-512.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble loadu( const double* address, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 8UL, "Invalid number of elements" );
+   return _mm512_maskz_loadu_pd( static_cast<__mmask8>( ( 1U << n ) - 1U ), address );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -61,12 +61,16 @@ namespace blaze {
 // \param b The right-hand side SIMD operand.
 // \return The result of the multiplication.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 template< typename T >  // Type of both operands
 BLAZE_ALWAYS_INLINE const T
    operator*( const SIMDi16<T>& a, const SIMDi16<T>& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_mullo_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_mullo_epi16( (~a).value, (~b).value );
 }
@@ -88,13 +92,17 @@ BLAZE_ALWAYS_INLINE const T
 // \param b The right-hand side SIMD operand.
 // \return The result of the multiplication.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 template< typename T1    // Type of the left-hand side operand
         , typename T2 >  // Type of the right-hand side operand
 BLAZE_ALWAYS_INLINE const SIMDuint16
    operator*( const SIMDi16<T1>& a, const SIMDi16<T2>& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_mullo_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_mullo_epi16( (~a).value, (~b).value );
 }
@@ -116,11 +124,15 @@ BLAZE_ALWAYS_INLINE const SIMDuint16
 // \param b The right-hand side scalars.
 // \return The result of the scaling operation.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcint16
    operator*( const SIMDcint16& a, const SIMDint16& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_mullo_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_mullo_epi16( (~a).value, (~b).value );
 }
@@ -142,11 +154,15 @@ BLAZE_ALWAYS_INLINE const SIMDcint16
 // \param b The right-hand side scalars.
 // \return The result of the scaling operation.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcuint16
    operator*( const SIMDcuint16& a, const SIMDuint16& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_mullo_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_mullo_epi16( (~a).value, (~b).value );
 }
@@ -168,11 +184,15 @@ BLAZE_ALWAYS_INLINE const SIMDcuint16
 // \param b The right-hand side complex values to be scaled.
 // \return The result of the scaling operation.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcint16
    operator*( const SIMDint16& a, const SIMDcint16& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_mullo_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_mullo_epi16( (~a).value, (~b).value );
 }
@@ -194,11 +214,15 @@ BLAZE_ALWAYS_INLINE const SIMDcint16
 // \param b The right-hand side complex values to be scaled.
 // \return The result of the scaling operation.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcuint16
    operator*( const SIMDuint16& a, const SIMDcuint16& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_mullo_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_AVX2_MODE
 {
    return _mm256_mullo_epi16( (~a).value, (~b).value );
 }
@@ -220,12 +244,29 @@ BLAZE_ALWAYS_INLINE const SIMDcuint16
 // \param b The right-hand side SIMD operand.
 // \return The result of the multiplication.
 //
-// This operation is only available for SSE2 and AVX2.
+// This operation is only available for SSE2, AVX2, and AVX-512.
 */
 template< typename T >  // Type of both operands
 BLAZE_ALWAYS_INLINE const T
    operator*( const SIMDci16<T>& a, const SIMDci16<T>& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+{
+   __m512i x, y, z;
+   const __m512i neg( _mm512_set_epi16( 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+                                        1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1 ) );
+
+   x = _mm512_shufflelo_epi16( (~a).value, 0xA0 );
+   x = _mm512_shufflehi_epi16( x, 0xA0 );
+   z = _mm512_mullo_epi16( x, (~b).value );
+   x = _mm512_shufflelo_epi16( (~a).value, 0xF5 );
+   x = _mm512_shufflehi_epi16( x, 0xF5 );
+   y = _mm512_shufflelo_epi16( (~b).value, 0xB1 );
+   y = _mm512_shufflehi_epi16( y, 0xB1 );
+   y = _mm512_mullo_epi16( x, y );
+   y = _mm512_mullo_epi16( y, neg );
+   return _mm512_add_epi16( z, y );
+}
+#elif BLAZE_AVX2_MODE
 {
    __m256i x, y, z;
    const __m256i neg( _mm256_set_epi16( 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1 ) );
@@ -284,7 +325,7 @@ BLAZE_ALWAYS_INLINE const T
 template< typename T >  // Type of both operands
 BLAZE_ALWAYS_INLINE const T
    operator*( const SIMDi32<T>& a, const SIMDi32<T>& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mullo_epi32( (~a).value, (~b).value );
 }
@@ -316,7 +357,7 @@ template< typename T1    // Type of the left-hand side operand
         , typename T2 >  // Type of the right-hand side operand
 BLAZE_ALWAYS_INLINE const SIMDuint32
    operator*( const SIMDi32<T1>& a, const SIMDi32<T2>& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mullo_epi32( (~a).value, (~b).value );
 }
@@ -346,7 +387,7 @@ BLAZE_ALWAYS_INLINE const SIMDuint32
 */
 BLAZE_ALWAYS_INLINE const SIMDcint32
    operator*( const SIMDcint32& a, const SIMDint32& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mullo_epi32( (~a).value, (~b).value );
 }
@@ -376,7 +417,7 @@ BLAZE_ALWAYS_INLINE const SIMDcint32
 */
 BLAZE_ALWAYS_INLINE const SIMDcuint32
    operator*( const SIMDcuint32& a, const SIMDuint32& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mullo_epi32( (~a).value, (~b).value );
 }
@@ -408,7 +449,7 @@ template< typename T1    // Type of the left-hand side operand
         , typename T2 >  // Type of the right-hand side operand
 BLAZE_ALWAYS_INLINE const SIMDcint32
    operator*( const SIMDint32& a, const SIMDcint32& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mullo_epi32( (~a).value, (~b).value );
 }
@@ -440,7 +481,7 @@ template< typename T1    // Type of the left-hand side operand
         , typename T2 >  // Type of the right-hand side operand
 BLAZE_ALWAYS_INLINE const SIMDcuint32
    operator*( const SIMDuint32& a, const SIMDcuint32& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mullo_epi32( (~a).value, (~b).value );
 }
@@ -471,7 +512,20 @@ BLAZE_ALWAYS_INLINE const SIMDcuint32
 template< typename T >  // Type of both operands
 BLAZE_ALWAYS_INLINE const T
    operator*( const SIMDci32<T>& a, const SIMDci32<T>& b ) noexcept
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512F_MODE
+{
+   __m512i x, y, z;
+   const __m512i neg( _mm512_set_epi32( 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1 ) );
+
+   x = _mm512_maskz_shuffle_epi32( 0xFFFF, (~a).value, static_cast<_MM_PERM_ENUM>( 0xA0 ) );
+   z = _mm512_mullo_epi32( x, (~b).value );
+   x = _mm512_maskz_shuffle_epi32( 0xFFFF, (~a).value, static_cast<_MM_PERM_ENUM>( 0xF5 ) );
+   y = _mm512_maskz_shuffle_epi32( 0xFFFF, (~b).value, static_cast<_MM_PERM_ENUM>( 0xB1 ) );
+   y = _mm512_mullo_epi32( x, y );
+   y = _mm512_mullo_epi32( y, neg );
+   return _mm512_add_epi32( z, y );
+}
+#elif BLAZE_AVX2_MODE
 {
    __m256i x, y, z;
    const __m256i neg( _mm256_set_epi32( 1, -1, 1, -1, 1, -1, 1, -1 ) );
@@ -505,6 +559,155 @@ BLAZE_ALWAYS_INLINE const T
 
 
 
+//=================================================================================================
+//
+//  64-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication of two vectors of 64-bit integral SIMD values of the same type.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The result of the multiplication.
+//
+// This operation is only available for AVX-512DQ.
+*/
+template< typename T >  // Type of both operands
+BLAZE_ALWAYS_INLINE const T
+   operator*( const SIMDi64<T>& a, const SIMDi64<T>& b ) noexcept
+#if BLAZE_AVX512DQ_MODE
+{
+   return _mm512_mullo_epi64( (~a).value, (~b).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two vectors of 64-bit integral SIMD values of different type.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The result of the multiplication.
+//
+// This operation is only available for AVX-512DQ.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE const SIMDuint64
+   operator*( const SIMDi64<T1>& a, const SIMDi64<T2>& b ) noexcept
+#if BLAZE_AVX512DQ_MODE
+{
+   return _mm512_mullo_epi64( (~a).value, (~b).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of a vector of 64-bit signed integral complex SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side complex values to be scaled.
+// \param b The right-hand side scalars.
+// \return The result of the scaling operation.
+//
+// This operation is only available for AVX-512DQ.
+*/
+BLAZE_ALWAYS_INLINE const SIMDcint64
+   operator*( const SIMDcint64& a, const SIMDint64& b ) noexcept
+#if BLAZE_AVX512DQ_MODE
+{
+   return _mm512_mullo_epi64( (~a).value, (~b).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of a vector of 64-bit unsigned integral complex SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side complex values to be scaled.
+// \param b The right-hand side scalars.
+// \return The result of the scaling operation.
+//
+// This operation is only available for AVX-512DQ.
+*/
+BLAZE_ALWAYS_INLINE const SIMDcuint64
+   operator*( const SIMDcuint64& a, const SIMDuint64& b ) noexcept
+#if BLAZE_AVX512DQ_MODE
+{
+   return _mm512_mullo_epi64( (~a).value, (~b).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of a vector of 64-bit signed integral complex SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side scalars.
+// \param b The right-hand side complex values to be scaled.
+// \return The result of the scaling operation.
+//
+// This operation is only available for AVX-512DQ.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE const SIMDcint64
+   operator*( const SIMDint64& a, const SIMDcint64& b ) noexcept
+#if BLAZE_AVX512DQ_MODE
+{
+   return _mm512_mullo_epi64( (~a).value, (~b).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of a vector of 64-bit unsigned integral complex SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side scalars.
+// \param b The right-hand side complex values to be scaled.
+// \return The result of the scaling operation.
+//
+// This operation is only available for AVX-512DQ.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE const SIMDcuint64
+   operator*( const SIMDuint64& a, const SIMDcuint64& b ) noexcept
+#if BLAZE_AVX512DQ_MODE
+{
+   return _mm512_mullo_epi64( (~a).value, (~b).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+
+
 //=================================================================================================
 //
 //  32-BIT FLOATING POINT SIMD TYPES
@@ -545,7 +748,7 @@ struct SIMDf32MultExpr : public SIMDf32< SIMDf32MultExpr<T1,T2> >
    // \return The resulting packed 32-bit floating point value.
    */
    BLAZE_ALWAYS_INLINE const SIMDfloat eval() const noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    {
       return _mm512_mul_ps( a_.eval().value, b_.eval().value );
    }
@@ -602,7 +805,7 @@ BLAZE_ALWAYS_INLINE const SIMDf32MultExpr<T1,T2>
 */
 BLAZE_ALWAYS_INLINE const SIMDcfloat
    operator*( const SIMDcfloat& a, const SIMDfloat& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mul_ps( a.value, b.value );
 }
@@ -632,7 +835,7 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat
 */
 BLAZE_ALWAYS_INLINE const SIMDcfloat
    operator*( const SIMDfloat& a, const SIMDcfloat& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mul_ps( a.value, b.value );
 }
@@ -658,11 +861,21 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat
 // \param b The right-hand side SIMD operand.
 // \return The result of the multiplication.
 //
-// This operation is only available for SSE3 and AVX.
+// This operation is only available for SSE3, AVX, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcfloat
    operator*( const SIMDcfloat& a, const SIMDcfloat& b ) noexcept
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+{
+   __m512 x, y;
+
+   x = _mm512_maskz_shuffle_ps( 0xFFFF, a.value, a.value, 0xF5 );
+   y = _mm512_maskz_shuffle_ps( 0xFFFF, b.value, b.value, 0xB1 );
+   y = _mm512_mul_ps( x, y );
+   x = _mm512_maskz_shuffle_ps( 0xFFFF, a.value, a.value, 0xA0 );
+   return _mm512_fmaddsub_ps( x, b.value, y );
+}
+#elif BLAZE_AVX_MODE
 {
    __m256 x, y, z;
 
@@ -732,7 +945,7 @@ struct SIMDf64MultExpr : public SIMDf64< SIMDf64MultExpr<T1,T2> >
    // \return The resulting packed 64-bit floating point value.
    */
    BLAZE_ALWAYS_INLINE const SIMDdouble eval() const noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    {
       return _mm512_mul_pd( a_.eval().value, b_.eval().value );
    }
@@ -789,7 +1002,7 @@ BLAZE_ALWAYS_INLINE const SIMDf64MultExpr<T1,T2>
 */
 BLAZE_ALWAYS_INLINE const SIMDcdouble
    operator*( const SIMDcdouble& a, const SIMDdouble& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mul_pd( a.value, b.value );
 }
@@ -819,7 +1032,7 @@ BLAZE_ALWAYS_INLINE const SIMDcdouble
 */
 BLAZE_ALWAYS_INLINE const SIMDcdouble
    operator*( const SIMDdouble& a, const SIMDcdouble& b ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
 {
    return _mm512_mul_pd( a.value, b.value );
 }
@@ -845,11 +1058,21 @@ BLAZE_ALWAYS_INLINE const SIMDcdouble
 // \param b The right-hand side SIMD operand.
 // \return The result of the multiplication.
 //
-// This operation is only available for SSE3 and AVX.
+// This operation is only available for SSE3, AVX, and AVX-512.
 */
 BLAZE_ALWAYS_INLINE const SIMDcdouble
    operator*( const SIMDcdouble& a, const SIMDcdouble& b ) noexcept
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE
+{
+   __m512d x, y;
+
+   x = _mm512_maskz_shuffle_pd( 0xFF, a.value, a.value, 0xFF );
+   y = _mm512_maskz_shuffle_pd( 0xFF, b.value, b.value, 0x55 );
+   y = _mm512_mul_pd( x, y );
+   x = _mm512_maskz_shuffle_pd( 0xFF, a.value, a.value, 0x00 );
+   return _mm512_fmaddsub_pd( x, b.value, y );
+}
+#elif BLAZE_AVX_MODE
 {
    __m256d x, y, z;
 
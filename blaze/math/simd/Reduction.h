@@ -62,7 +62,12 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE const complex<int8_t> sum( const SIMDcint8& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return complex<int8_t>( a[ 0] + a[ 1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
+                           a[ 8] + a[ 9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] +
+                           a[16] + a[17] + a[18] + a[19] + a[20] + a[21] + a[22] + a[23] +
+                           a[24] + a[25] + a[26] + a[27] + a[28] + a[29] + a[30] + a[31] );
+#elif BLAZE_AVX2_MODE
    return complex<int8_t>( a[0] + a[1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
                            a[8] + a[9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] );
 #elif BLAZE_SSE2_MODE
@@ -91,7 +96,16 @@ BLAZE_ALWAYS_INLINE const complex<int8_t> sum( const SIMDcint8& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int16_t sum( const SIMDint16& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   const __m256i b( _mm256_add_epi16( _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 1 )
+                                    , _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 0 ) ) );
+   const __m256i c( _mm256_hadd_epi16( b, b ) );
+   const __m256i d( _mm256_hadd_epi16( c, c ) );
+   const __m256i e( _mm256_hadd_epi16( d, d ) );
+   const __m128i f = _mm_add_epi16( _mm256_extracti128_si256( e, 1 )
+                                  , _mm256_castsi256_si128( e ) );
+   return _mm_extract_epi16( f, 0 );
+#elif BLAZE_AVX2_MODE
    const __m256i b( _mm256_hadd_epi16( a.value, a.value ) );
    const __m256i c( _mm256_hadd_epi16( b, b ) );
    const __m256i d( _mm256_hadd_epi16( c, c ) );
@@ -121,7 +135,10 @@ BLAZE_ALWAYS_INLINE int16_t sum( const SIMDint16& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int16_t> sum( const SIMDcint16& a ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return complex<int16_t>( a[0] + a[1] + a[ 2] + a[ 3] + a[ 4] + a[ 5] + a[ 6] + a[ 7] +
+                            a[8] + a[9] + a[10] + a[11] + a[12] + a[13] + a[14] + a[15] );
+#elif BLAZE_AVX2_MODE
    return complex<int16_t>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_SSE2_MODE
    return complex<int16_t>( a[0] + a[1] + a[2] + a[3] );
@@ -149,7 +166,15 @@ BLAZE_ALWAYS_INLINE const complex<int16_t> sum( const SIMDcint16& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int32_t sum( const SIMDint32& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256i b( _mm256_add_epi32( _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 1 )
+                                    , _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 0 ) ) );
+   const __m256i c( _mm256_hadd_epi32( b, b ) );
+   const __m256i d( _mm256_hadd_epi32( c, c ) );
+   const __m128i e = _mm_add_epi32( _mm256_extracti128_si256( d, 1 )
+                                  , _mm256_castsi256_si128( d ) );
+   return _mm_extract_epi32( e, 0 );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
 #elif BLAZE_AVX2_MODE
    const __m256i b( _mm256_hadd_epi32( a.value, a.value ) );
@@ -179,7 +204,7 @@ BLAZE_ALWAYS_INLINE int32_t sum( const SIMDint32& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int32_t> sum( const SIMDcint32& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<int32_t>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX2_MODE
    return complex<int32_t>( a[0] + a[1] + a[2] + a[3] );
@@ -209,7 +234,13 @@ BLAZE_ALWAYS_INLINE const complex<int32_t> sum( const SIMDcint32& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE int64_t sum( const SIMDint64& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256i b( _mm256_add_epi64( _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 1 )
+                                    , _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 0 ) ) );
+   const __m128i c = _mm_add_epi64( _mm256_extracti128_si256( b, 1 )
+                                  , _mm256_castsi256_si128( b ) );
+   return _mm_extract_epi64( c, 0 ) + _mm_extract_epi64( c, 1 );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_epi64( a.value );
 #elif BLAZE_AVX2_MODE
    return a[0] + a[1] + a[2] + a[3];
@@ -231,7 +262,7 @@ BLAZE_ALWAYS_INLINE int64_t sum( const SIMDint64& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<int64_t> sum( const SIMDcint64& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<int64_t>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX2_MODE
    return complex<int64_t>( a[0] + a[1] );
@@ -261,7 +292,15 @@ BLAZE_ALWAYS_INLINE const complex<int64_t> sum( const SIMDcint64& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE float sum( const SIMDfloat& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m512d b( _mm512_castps_pd( a.value ) );
+   const __m256 c( _mm256_add_ps( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, b, 1 ) )
+                                , _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, b, 0 ) ) ) );
+   const __m256 d( _mm256_hadd_ps( c, c ) );
+   const __m256 e( _mm256_hadd_ps( d, d ) );
+   const __m128 f = _mm_add_ps( _mm256_extractf128_ps( e, 1 ), _mm256_castps256_ps128( e ) );
+   return _mm_cvtss_f32( f );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_ps( a.value );
 #elif BLAZE_AVX_MODE
    const __m256 b( _mm256_hadd_ps( a.value, a.value ) );
@@ -290,7 +329,7 @@ BLAZE_ALWAYS_INLINE float sum( const SIMDfloat& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<float> sum( const SIMDcfloat& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] );
@@ -320,7 +359,13 @@ BLAZE_ALWAYS_INLINE const complex<float> sum( const SIMDcfloat& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE double sum( const SIMDdouble& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   const __m256d b( _mm256_add_pd( _mm512_maskz_extractf64x4_pd( 0xF, a.value, 1 )
+                                 , _mm512_maskz_extractf64x4_pd( 0xF, a.value, 0 ) ) );
+   const __m256d c( _mm256_hadd_pd( b, b ) );
+   const __m128d d = _mm_add_pd( _mm256_extractf128_pd( c, 1 ), _mm256_castpd256_pd128( c ) );
+   return _mm_cvtsd_f64( d );
+#elif BLAZE_MIC_MODE
    return _mm512_reduce_add_pd( a.value );
 #elif BLAZE_AVX_MODE
    const __m256d b( _mm256_hadd_pd( a.value, a.value ) );
@@ -347,7 +392,7 @@ BLAZE_ALWAYS_INLINE double sum( const SIMDdouble& a ) noexcept
 */
 BLAZE_ALWAYS_INLINE const complex<double> sum( const SIMDcdouble& a ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    return complex<double>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX_MODE
    return complex<double>( a[0] + a[1] );
@@ -64,7 +64,11 @@ namespace blaze {
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat sqrt( const SIMDf32<T>& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_sqrt_ps( 0xFFFF, (~a).eval().value );
+}
+#elif BLAZE_MIC_MODE
 {
    return _mm512_sqrt_ps( (~a).eval().value );
 }
@@ -101,7 +105,11 @@ BLAZE_ALWAYS_INLINE const SIMDfloat sqrt( const SIMDf32<T>& a ) noexcept
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble sqrt( const SIMDf64<T>& a ) noexcept
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_sqrt_pd( 0xFF, (~a).eval().value );
+}
+#elif BLAZE_MIC_MODE
 {
    return _mm512_sqrt_pd( (~a).eval().value );
 }
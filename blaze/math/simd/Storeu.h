@@ -43,10 +43,12 @@
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasSize.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 
@@ -75,7 +77,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
    storeu( T1* address, const SIMDi8<T2>& value ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -104,7 +108,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,1UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -139,7 +145,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
    storeu( T1* address, const SIMDi16<T2>& value ) noexcept
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -168,7 +176,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,2UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), (~value).value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), (~value).value );
@@ -203,7 +213,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
    storeu( T1* address, const SIMDi32<T2>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi32( address     , (~value).value );
    _mm512_packstorehi_epi32( address+16UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -235,7 +247,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi32( address    , (~value).value );
    _mm512_packstorehi_epi32( address+8UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -273,7 +287,9 @@ template< typename T1    // Type of the integral value
 BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
    storeu( T1* address, const SIMDi64<T2>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi64( address    , (~value).value );
    _mm512_packstorehi_epi64( address+8UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -305,7 +321,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<T1> ) == 2UL*sizeof( T1 ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, (~value).value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_epi64( address    , (~value).value );
    _mm512_packstorehi_epi64( address+4UL, (~value).value );
 #elif BLAZE_AVX2_MODE
@@ -341,7 +359,9 @@ BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE void storeu( float* address, const SIMDf32<T>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_ps( address, (~value).eval().value );
+#elif BLAZE_MIC_MODE
    const SIMDfloat( (~value).eval().value );
    _mm512_packstorelo_ps( address     , tmp );
    _mm512_packstorehi_ps( address+16UL, tmp );
@@ -371,7 +391,9 @@ BLAZE_ALWAYS_INLINE void storeu( complex<float>* address, const SIMDcfloat& valu
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_ps( reinterpret_cast<float*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_ps( reinterpret_cast<float*>( address     ), value.value );
    _mm512_packstorehi_ps( reinterpret_cast<float*>( address+8UL ), value.value );
 #elif BLAZE_AVX_MODE
@@ -407,7 +429,9 @@ BLAZE_ALWAYS_INLINE void storeu( complex<float>* address, const SIMDcfloat& valu
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE void storeu( double* address, const SIMDf64<T>& value ) noexcept
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_pd( address, (~value).eval().value );
+#elif BLAZE_MIC_MODE
    const SIMDdouble tmp( (~value).eval().value );
    _mm512_packstorelo_pd( address    , tmp );
    _mm512_packstorehi_pd( address+8UL, tmp );
@@ -437,7 +461,9 @@ BLAZE_ALWAYS_INLINE void storeu( complex<double>* address, const SIMDcdouble& va
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE
+   _mm512_storeu_pd( reinterpret_cast<double*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_packstorelo_pd( reinterpret_cast<double*>( address     ), value.value );
    _mm512_packstorehi_pd( reinterpret_cast<double*>( address+4UL ), value.value );
 #elif BLAZE_AVX_MODE
@@ -450,6 +476,122 @@ BLAZE_ALWAYS_INLINE void storeu( complex<double>* address, const SIMDcdouble& va
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  MASKED STORES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a partial vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 4-byte integral vector to be stored.
+// \param n The number of values to be stored \f$[0..SIMDSIZE)\f$.
+// \return void
+//
+// This function stores the first \a n 4-byte integral values of the given vector. No memory beyond
+// the \a n values is written. The given address is not required to be properly aligned. This
+// operation is only available for AVX-512.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,4UL> > >
+   storeu( T1* address, const SIMDi32<T2>& value, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 16UL, "Invalid number of elements" );
+   _mm512_mask_storeu_epi32( address, static_cast<__mmask16>( ( 1U << n ) - 1U ), (~value).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a partial vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 8-byte integral vector to be stored.
+// \param n The number of values to be stored \f$[0..SIMDSIZE)\f$.
+// \return void
+//
+// This function stores the first \a n 8-byte integral values of the given vector. No memory beyond
+// the \a n values is written. The given address is not required to be properly aligned. This
+// operation is only available for AVX-512.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_< And< IsIntegral<T1>, HasSize<T1,8UL> > >
+   storeu( T1* address, const SIMDi64<T2>& value, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 8UL, "Invalid number of elements" );
+   _mm512_mask_storeu_epi64( address, static_cast<__mmask8>( ( 1U << n ) - 1U ), (~value).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a partial vector of 'float' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \param n The number of values to be stored \f$[0..SIMDSIZE)\f$.
+// \return void
+//
+// This function stores the first \a n 'float' values of the given vector. No memory beyond
+// the \a n values is written. The given address is not required to be properly aligned. This
+// operation is only available for AVX-512.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storeu( float* address, const SIMDf32<T>& value, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 16UL, "Invalid number of elements" );
+   _mm512_mask_storeu_ps( address, static_cast<__mmask16>( ( 1U << n ) - 1U ), (~value).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked unaligned store of a partial vector of 'double' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'double' vector to be stored.
+// \param n The number of values to be stored \f$[0..SIMDSIZE)\f$.
+// \return void
+//
+// This function stores the first \a n 'double' values of the given vector. No memory beyond
+// the \a n values is written. The given address is not required to be properly aligned. This
+// operation is only available for AVX-512.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storeu( double* address, const SIMDf64<T>& value, size_t n ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   BLAZE_INTERNAL_ASSERT( n < 8UL, "Invalid number of elements" );
+   _mm512_mask_storeu_pd( address, static_cast<__mmask8>( ( 1U << n ) - 1U ), (~value).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,191 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Transpose.h
+//  \brief Header file for the SIMD transposition functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_TRANSPOSE_H_
+#define _BLAZE_MATH_SIMD_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_SSE_MODE
+//*************************************************************************************************
+/*!\brief In-register transposition of a square tile of 'float' values.
+// \ingroup simd
+//
+// \param a The array of \c SIMDfloat::size SIMD vectors forming the rows of the tile.
+// \return void
+//
+// This function transposes the square tile of \c SIMDfloat::size times \c SIMDfloat::size
+// single precision values that is held in the given array of SIMD vectors, i.e. after the
+// transposition the \a i-th element of the \a j-th vector is the former \a j-th element of
+// the \a i-th vector. The transposition is performed by means of unpack and shuffle
+// operations without any access to memory.
+*/
+BLAZE_ALWAYS_INLINE void transpose( SIMDfloat* a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   __m512 t[16];
+   __m512 u[16];
+
+   for( int k=0; k<16; k+=2 ) {
+      t[k  ] = _mm512_maskz_unpacklo_ps( 0xFFFF, a[k].value, a[k+1].value );
+      t[k+1] = _mm512_maskz_unpackhi_ps( 0xFFFF, a[k].value, a[k+1].value );
+   }
+
+   for( int k=0; k<16; k+=4 ) {
+      u[k  ] = _mm512_maskz_shuffle_ps( 0xFFFF, t[k  ], t[k+2], 0x44 );
+      u[k+1] = _mm512_maskz_shuffle_ps( 0xFFFF, t[k  ], t[k+2], 0xEE );
+      u[k+2] = _mm512_maskz_shuffle_ps( 0xFFFF, t[k+1], t[k+3], 0x44 );
+      u[k+3] = _mm512_maskz_shuffle_ps( 0xFFFF, t[k+1], t[k+3], 0xEE );
+   }
+
+   for( int q=0; q<4; ++q ) {
+      const __m512 x0( _mm512_maskz_shuffle_f32x4( 0xFFFF, u[q  ], u[q+4 ], 0x88 ) );
+      const __m512 y0( _mm512_maskz_shuffle_f32x4( 0xFFFF, u[q  ], u[q+4 ], 0xDD ) );
+      const __m512 x1( _mm512_maskz_shuffle_f32x4( 0xFFFF, u[q+8], u[q+12], 0x88 ) );
+      const __m512 y1( _mm512_maskz_shuffle_f32x4( 0xFFFF, u[q+8], u[q+12], 0xDD ) );
+      a[q   ].value = _mm512_maskz_shuffle_f32x4( 0xFFFF, x0, x1, 0x88 );
+      a[q+4 ].value = _mm512_maskz_shuffle_f32x4( 0xFFFF, y0, y1, 0x88 );
+      a[q+8 ].value = _mm512_maskz_shuffle_f32x4( 0xFFFF, x0, x1, 0xDD );
+      a[q+12].value = _mm512_maskz_shuffle_f32x4( 0xFFFF, y0, y1, 0xDD );
+   }
+#elif BLAZE_AVX_MODE
+   __m256 t[8];
+   __m256 u[8];
+
+   for( int k=0; k<8; k+=2 ) {
+      t[k  ] = _mm256_unpacklo_ps( a[k].value, a[k+1].value );
+      t[k+1] = _mm256_unpackhi_ps( a[k].value, a[k+1].value );
+   }
+
+   for( int k=0; k<8; k+=4 ) {
+      u[k  ] = _mm256_shuffle_ps( t[k  ], t[k+2], 0x44 );
+      u[k+1] = _mm256_shuffle_ps( t[k  ], t[k+2], 0xEE );
+      u[k+2] = _mm256_shuffle_ps( t[k+1], t[k+3], 0x44 );
+      u[k+3] = _mm256_shuffle_ps( t[k+1], t[k+3], 0xEE );
+   }
+
+   for( int q=0; q<4; ++q ) {
+      a[q  ].value = _mm256_permute2f128_ps( u[q], u[q+4], 0x20 );
+      a[q+4].value = _mm256_permute2f128_ps( u[q], u[q+4], 0x31 );
+   }
+#elif BLAZE_SSE_MODE
+   _MM_TRANSPOSE4_PS( a[0].value, a[1].value, a[2].value, a[3].value );
+#endif
+}
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+#if BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_SSE2_MODE
+//*************************************************************************************************
+/*!\brief In-register transposition of a square tile of 'double' values.
+// \ingroup simd
+//
+// \param a The array of \c SIMDdouble::size SIMD vectors forming the rows of the tile.
+// \return void
+//
+// This function transposes the square tile of \c SIMDdouble::size times \c SIMDdouble::size
+// double precision values that is held in the given array of SIMD vectors, i.e. after the
+// transposition the \a i-th element of the \a j-th vector is the former \a j-th element of
+// the \a i-th vector. The transposition is performed by means of unpack and shuffle
+// operations without any access to memory.
+*/
+BLAZE_ALWAYS_INLINE void transpose( SIMDdouble* a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   __m512d t[8];
+
+   for( int k=0; k<8; k+=2 ) {
+      t[k  ] = _mm512_maskz_unpacklo_pd( 0xFF, a[k].value, a[k+1].value );
+      t[k+1] = _mm512_maskz_unpackhi_pd( 0xFF, a[k].value, a[k+1].value );
+   }
+
+   for( int q=0; q<2; ++q ) {
+      const __m512d x0( _mm512_maskz_shuffle_f64x2( 0xFF, t[q  ], t[q+2], 0x88 ) );
+      const __m512d y0( _mm512_maskz_shuffle_f64x2( 0xFF, t[q  ], t[q+2], 0xDD ) );
+      const __m512d x1( _mm512_maskz_shuffle_f64x2( 0xFF, t[q+4], t[q+6], 0x88 ) );
+      const __m512d y1( _mm512_maskz_shuffle_f64x2( 0xFF, t[q+4], t[q+6], 0xDD ) );
+      a[q  ].value = _mm512_maskz_shuffle_f64x2( 0xFF, x0, x1, 0x88 );
+      a[q+2].value = _mm512_maskz_shuffle_f64x2( 0xFF, y0, y1, 0x88 );
+      a[q+4].value = _mm512_maskz_shuffle_f64x2( 0xFF, x0, x1, 0xDD );
+      a[q+6].value = _mm512_maskz_shuffle_f64x2( 0xFF, y0, y1, 0xDD );
+   }
+#elif BLAZE_AVX_MODE
+   const __m256d t0( _mm256_unpacklo_pd( a[0].value, a[1].value ) );
+   const __m256d t1( _mm256_unpackhi_pd( a[0].value, a[1].value ) );
+   const __m256d t2( _mm256_unpacklo_pd( a[2].value, a[3].value ) );
+   const __m256d t3( _mm256_unpackhi_pd( a[2].value, a[3].value ) );
+
+   a[0].value = _mm256_permute2f128_pd( t0, t2, 0x20 );
+   a[1].value = _mm256_permute2f128_pd( t1, t3, 0x20 );
+   a[2].value = _mm256_permute2f128_pd( t0, t2, 0x31 );
+   a[3].value = _mm256_permute2f128_pd( t1, t3, 0x31 );
+#elif BLAZE_SSE2_MODE
+   const __m128d t0( _mm_unpacklo_pd( a[0].value, a[1].value ) );
+   const __m128d t1( _mm_unpackhi_pd( a[0].value, a[1].value ) );
+
+   a[0].value = t0;
+   a[1].value = t1;
+#endif
+}
+//*************************************************************************************************
+#endif
+
+} // namespace blaze
+
+#endif
@@ -89,10 +89,13 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active (i.e. the
+                                           currently executed code is inside a parallel
+                                           section), the flag is set to \a true, otherwise
+                                           it is \a false. The flag is maintained per thread
+                                           in order to allow concurrent parallel sections in
+                                           several threads. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +119,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+thread_local bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -40,6 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#include <blaze/math/smp/openmp/SparseVector.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/math/smp/threads/SparseVector.h>
+#else
 #include <blaze/math/smp/default/SparseVector.h>
+#endif
 
 #endif
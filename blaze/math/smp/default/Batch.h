@@ -0,0 +1,148 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Batch.h
+//  \brief Header file for the default batch SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_BATCH_H_
+#define _BLAZE_MATH_SMP_DEFAULT_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batch SMP functions */
+//@{
+template< typename OP >
+inline void smpBatch( size_t n, size_t granularity, OP op );
+
+template< typename OP >
+inline void smpBatch( size_t n, size_t granularity, size_t threshold, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP execution of a batch operation.
+// \ingroup smp
+//
+// \param n The total number of elements of the batch.
+// \param granularity The granularity of the blocks of the batch.
+// \param op The batch operation.
+// \return void
+//
+// This function implements the default SMP execution of a batch operation. Due to the default
+// (serial) setting, the batch operation is applied to all \a n elements of the batch at once.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// batchMult() function.
+*/
+template< typename OP >  // Type of the batch operation
+inline void smpBatch( size_t n, size_t granularity, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   UNUSED_PARAMETER( granularity );
+
+   op( 0UL, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP execution of a batch operation with custom threshold.
+// \ingroup smp
+//
+// \param n The total number of elements of the batch.
+// \param granularity The granularity of the blocks of the batch.
+// \param threshold The minimum number of elements for a parallel execution.
+// \param op The batch operation.
+// \return void
+//
+// This function implements the default SMP execution of a batch operation. Due to the default
+// (serial) setting, the batch operation is applied to all \a n elements of the batch at once.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename OP >  // Type of the batch operation
+inline void smpBatch( size_t n, size_t granularity, size_t threshold, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   UNUSED_PARAMETER( granularity, threshold );
+
+   op( 0UL, n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( !BLAZE_OPENMP_PARALLEL_MODE      );
+BLAZE_STATIC_ASSERT( !BLAZE_CPP_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/system/SMP.h>
@@ -80,6 +82,12 @@ inline EnableIf_< IsDenseVector<VT1> >
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline EnableIf_< IsDenseVector<VT1> >
    smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF, typename OP >
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op );
+
+template< typename VT, bool TF, typename OP >
+inline void smpFirstTouch( DenseVector<VT,TF>& dv, OP op );
 //@}
 //*************************************************************************************************
 
@@ -229,6 +237,58 @@ inline EnableIf_< IsDenseVector<VT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function implements the default first-touch initialization of a dense vector, which
+// calls the initialization operation as \c op(index,n) for the entire vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   op( 0UL, (~dv).size() );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -40,8 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
+#include <vector>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
+#include <blaze/util/Exception.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/Unused.h>
@@ -61,6 +65,10 @@ namespace blaze {
 BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
 BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
 BLAZE_ALWAYS_INLINE void   shutDownThreads();
+
+BLAZE_ALWAYS_INLINE void             setThreadAffinity( const std::vector<int>& cores );
+BLAZE_ALWAYS_INLINE void             setThreadAffinity( const std::string& policy );
+BLAZE_ALWAYS_INLINE std::vector<int> getThreadAffinity();
 //@}
 //*************************************************************************************************
 
@@ -130,6 +138,70 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations to the given cores.
+// \ingroup smp
+//
+// \param cores The cores the threads are pinned to (empty for no pinning).
+// \return void
+// \exception std::invalid_argument Invalid core.
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// cores. In case any of the given cores is not available, a \a std::invalid_argument exception
+// is thrown. Note that in case no parallelization is active, the function has no further effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<int>& cores )
+{
+#if BLAZE_THREAD_PINNING
+   for( int core : cores ) {
+      if( !isAvailableCore( core ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid core" );
+      }
+   }
+#else
+   UNUSED_PARAMETER( cores );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations according to the given policy.
+// \ingroup smp
+//
+// \param policy The affinity policy (\c none, \c compact, \c scatter, or a list of cores).
+// \return void
+// \exception std::invalid_argument Invalid affinity policy.
+//
+// Via this function the threads used for thread parallel operations can be pinned according
+// to the given affinity policy (see the parseAffinity() function). In case an invalid policy
+// is specified, a \a std::invalid_argument exception is thrown. Note that in case no
+// parallelization is active, the function has no further effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& policy )
+{
+   setThreadAffinity( parseAffinity( policy ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current placement of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \return The core each thread is pinned to, or -1 for each thread that is not pinned.
+//
+// Via this function the current placement of the threads used for thread parallel operations
+// can be queried. Note that in case no parallelization is active the function returns the
+// placement of the calling thread.
+*/
+BLAZE_ALWAYS_INLINE std::vector<int> getThreadAffinity()
+{
+   return std::vector<int>( 1UL, getThreadCore( currentThread() ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
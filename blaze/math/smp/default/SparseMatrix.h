@@ -46,6 +46,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -70,6 +71,9 @@ inline EnableIf_< IsSparseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsSparseMatrix<MT1> >
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline bool isParallelSMPAssign( const Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
 //@}
 //*************************************************************************************************
 
@@ -166,6 +170,33 @@ inline EnableIf_< IsSparseMatrix<MT1> >
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the SMP assignment to a sparse matrix is executed in parallel.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return \a false.
+//
+// The default SMP assignment of a matrix to a sparse matrix is always executed serially.
+// Therefore this function always returns \a false.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline bool isParallelSMPAssign( const Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -46,6 +46,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -74,6 +75,9 @@ inline EnableIf_< IsSparseVector<VT1> >
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline EnableIf_< IsSparseVector<VT1> >
    smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+inline bool isParallelSMPAssign( const Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
 //@}
 //*************************************************************************************************
 
@@ -195,6 +199,33 @@ inline EnableIf_< IsSparseVector<VT1> >
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the SMP assignment to a sparse vector is executed in parallel.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return \a false.
+//
+// The default SMP assignment of a vector to a sparse vector is always executed serially.
+// Therefore this function always returns \a false.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline bool isParallelSMPAssign( const Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
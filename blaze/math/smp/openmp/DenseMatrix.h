@@ -40,11 +40,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <omp.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
@@ -57,7 +59,9 @@
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -127,7 +131,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& r
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -198,7 +202,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>&
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -362,7 +366,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -433,7 +437,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -597,7 +601,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -669,7 +673,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -819,6 +823,245 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// matrix. The matrix is split into one SIMD-aligned block per thread, each block is reduced
+// concurrently, and the partial results are combined by means of the reduction operation.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+ElementType_<MT> smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>  ET;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const bool simdEnabled( DMatReduceExprHelper<MT,OP>::value );
+   const bool dmAligned  ( simdEnabled && (~dm).isAligned() );
+
+   const ThreadMapping threads( createThreadMapping( omp_get_max_threads(), ~dm ) );
+
+   const size_t addon1     ( ( ( (~dm).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~dm).rows() / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~dm).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~dm).columns() / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   const size_t rowBlocks( ( (~dm).rows()    - 1UL ) / rowsPerThread + 1UL );
+   const size_t colBlocks( ( (~dm).columns() - 1UL ) / colsPerThread + 1UL );
+
+   std::unique_ptr<ET[]> partials( new ET[rowBlocks*colBlocks] );
+
+#pragma omp parallel for schedule(BLAZE_OPENMP_SCHEDULE) shared( dm, op, partials )
+   for( int k=0; k<int( rowBlocks*colBlocks ); ++k )
+   {
+      const size_t row   ( ( k / colBlocks ) * rowsPerThread );
+      const size_t column( ( k % colBlocks ) * colsPerThread );
+
+      const size_t m( min( rowsPerThread, (~dm).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~dm).columns() - column ) );
+
+      if( dmAligned )
+         partials[k] = dmatreduce( submatrix<aligned>( ~dm, row, column, m, n ), op );
+      else
+         partials[k] = dmatreduce( submatrix<unaligned>( ~dm, row, column, m, n ), op );
+   }
+
+   ET redux( partials[0UL] );
+
+   for( size_t k=1UL; k<rowBlocks*colBlocks; ++k ) {
+      redux = op( redux, partials[k] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the OpenMP-based SMP reduction of a dense matrix. In case the number
+// of elements of the matrix is smaller than the blaze::SMP_DMATREDUCE_THRESHOLD or in case a
+// serial section is active, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>  ET;
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~dm).rows() * (~dm).columns() < SMP_DMATREDUCE_THRESHOLD ) {
+         redux = dmatreduce( ~dm, op );
+      }
+      else {
+         redux = smpReduce_backend( ~dm, op );
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based first-touch initialization
+// of a dense matrix. The matrix is partitioned among the threads in the same way as by the
+// OpenMP-based SMP assignment and the initialization operation is called once for each
+// partition with the row and column index of the first element of the partition and the
+// number of rows and columns of the partition.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch_backend( DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<MT> >::size };
+
+   const bool simdEnabled( MT::simdEnabled );
+
+   const int threads( omp_get_num_threads() );
+   const ThreadMapping threadmap( createThreadMapping( threads, ~dm ) );
+
+   const size_t addon1     ( ( ( (~dm).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~dm).rows() / threadmap.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~dm).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~dm).columns() / threadmap.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
+      const size_t column( ( i % threadmap.second ) * colsPerThread );
+
+      if( row >= (~dm).rows() || column >= (~dm).columns() )
+         continue;
+
+      op( row, column, min( rowsPerThread, (~dm).rows()    - row    )
+                     , min( colsPerThread, (~dm).columns() - column ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function initializes the elements of the given dense matrix by means of the given
+// initialization operation, which is called as \c op(row,column,m,n) for every partition of
+// the matrix. The partitioning of the matrix matches the partitioning of the OpenMP-based
+// SMP assignment. Therefore, on NUMA systems, the memory pages of a partition are placed on
+// the NUMA node of the thread that processes the partition during all subsequent assignments.
+// In case the matrix is too small for an SMP assignment (see the canSMPAssign() function), or
+// in case a serial or parallel section is active, the initialization is performed by the
+// calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !(~dm).canSMPAssign() ) {
+      op( 0UL, 0UL, (~dm).rows(), (~dm).columns() );
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+#pragma omp parallel shared( dm, op )
+         smpFirstTouch_backend( ~dm, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -40,10 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <omp.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
@@ -53,7 +55,9 @@
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Subvector.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -116,7 +120,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -180,7 +184,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -332,7 +336,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -396,7 +400,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -548,7 +552,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -612,7 +616,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -765,7 +769,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -830,7 +834,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -982,7 +986,7 @@ void smpDivAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -1100,6 +1104,228 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// vector. The vector is split into one SIMD-aligned block per thread, each block is reduced
+// concurrently, and the partial results are combined by means of the reduction operation.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+ElementType_<VT> smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<VT>  ET;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const bool simdEnabled( DVecReduceExprHelper<VT,OP>::value );
+   const bool dvAligned  ( simdEnabled && (~dv).isAligned() );
+
+   const int    threads      ( omp_get_max_threads() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t blocks       ( ( (~dv).size() - 1UL ) / sizePerThread + 1UL );
+
+   std::unique_ptr<ET[]> partials( new ET[blocks] );
+
+#pragma omp parallel for schedule(BLAZE_OPENMP_SCHEDULE) shared( dv, op, partials )
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~dv).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~dv).size() - index ) );
+
+      if( dvAligned )
+         partials[i] = dvecreduce( subvector<aligned>( ~dv, index, size ), op );
+      else
+         partials[i] = dvecreduce( subvector<unaligned>( ~dv, index, size ), op );
+   }
+
+   ET redux( partials[0UL] );
+
+   for( size_t i=1UL; i<blocks; ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the OpenMP-based SMP reduction of a dense vector. In case the size
+// of the vector is smaller than the blaze::SMP_DVECREDUCE_THRESHOLD or in case a serial section
+// is active, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<VT>  ET;
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+         redux = dvecreduce( ~dv, op );
+      }
+      else {
+         redux = smpReduce_backend( ~dv, op );
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based first-touch initialization
+// of a dense vector. The vector is partitioned among the threads in the same way as by the
+// OpenMP-based SMP assignment and the initialization operation is called once for each
+// partition with the index of the first element and the size of the partition.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense vectors. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch_backend( DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<VT> >::size };
+
+   const bool simdEnabled( VT::simdEnabled );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~dv).size() )
+         continue;
+
+      op( index, min( sizePerThread, (~dv).size() - index ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function initializes the elements of the given dense vector by means of the given
+// initialization operation, which is called as \c op(index,n) for every partition of the
+// vector. The partitioning of the vector matches the partitioning of the OpenMP-based SMP
+// assignment. Therefore, on NUMA systems, the memory pages of a partition are placed on the
+// NUMA node of the thread that processes the partition during all subsequent assignments.
+// In case the vector is too small for an SMP assignment (see the canSMPAssign() function), or
+// in case a serial or parallel section is active, the initialization is performed by the
+// calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense vectors. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !(~dv).canSMPAssign() ) {
+      op( 0UL, (~dv).size() );
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+#pragma omp parallel shared( dv, op )
+         smpFirstTouch_backend( ~dv, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -40,10 +40,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
+#include <vector>
 #include <omp.h>
 #include <blaze/math/Exception.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -131,6 +134,95 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for OpenMP parallel operations to the given cores.
+// \ingroup smp
+//
+// \param cores The cores the threads are pinned to (empty for no pinning).
+// \return void
+// \exception std::invalid_argument Invalid core.
+//
+// Via this function the threads of the OpenMP thread team can be pinned to specific cores: The
+// thread with thread number i is pinned to the (i%n)-th of the n given cores. Note that this
+// includes the calling thread, which acts as the master thread of the team. In case the given
+// list is empty, the threads are no longer pinned. In case any of the given cores is not
+// available, a \a std::invalid_argument exception is thrown. Also note that the pinning only
+// affects the current team of threads, i.e. the function has to be called after changing the
+// number of threads. Alternatively, the placement of OpenMP threads can be controlled via the
+// \c OMP_PROC_BIND and \c OMP_PLACES environment variables.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<int>& cores )
+{
+#if BLAZE_THREAD_PINNING
+   for( int core : cores ) {
+      if( !isAvailableCore( core ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid core" );
+      }
+   }
+#endif
+
+#pragma omp parallel shared( cores )
+   {
+      const size_t thread( omp_get_thread_num() );
+      pinThread( currentThread(), cores.empty() ? -1 : cores[ thread % cores.size() ] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for OpenMP parallel operations according to the given policy.
+// \ingroup smp
+//
+// \param policy The affinity policy (\c none, \c compact, \c scatter, or a list of cores).
+// \return void
+// \exception std::invalid_argument Invalid affinity policy.
+//
+// Via this function the threads of the OpenMP thread team can be pinned according to the given
+// affinity policy (see the parseAffinity() function). In case an invalid policy is specified,
+// a \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& policy )
+{
+   setThreadAffinity( parseAffinity( policy ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current placement of the threads used for OpenMP parallel operations.
+// \ingroup smp
+//
+// \return The core each thread is pinned to, or -1 for each thread that is not pinned.
+//
+// Via this function the current placement of the threads of the OpenMP thread team can be
+// queried. The i-th element of the returned vector corresponds to the thread with thread
+// number i. The function reflects both the pinning via the setThreadAffinity() function and
+// the binding by the OpenMP runtime system.
+*/
+BLAZE_ALWAYS_INLINE std::vector<int> getThreadAffinity()
+{
+   std::vector<int> cores( omp_get_max_threads(), -1 );
+
+#pragma omp parallel shared( cores )
+   {
+      const size_t thread( omp_get_thread_num() );
+      if( thread < cores.size() ) {
+         cores[thread] = getThreadCore( currentThread() );
+      }
+   }
+
+   return cores;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
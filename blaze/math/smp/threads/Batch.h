@@ -0,0 +1,247 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Batch.h
+//  \brief Header file for the C++11/Boost thread-based batch SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_BATCH_H_
+#define _BLAZE_MATH_SMP_THREADS_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded execution of a batch operation on a block of a batch.
+// \ingroup smp
+//
+// This functor applies the given batch operation to a single block of a batch. Since the blocks
+// of a batch don't overlap, all blocks can be processed concurrently.
+*/
+template< typename OP >  // Type of the batch operation
+struct BatchBlockExecutor
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchBlockExecutor class template.
+   //
+   // \param op The batch operation.
+   // \param index The index of the first element of the block.
+   // \param n The number of elements of the block.
+   */
+   explicit inline BatchBlockExecutor( const OP& op, size_t index, size_t n )
+      : op_   ( op    )  // The batch operation
+      , index_( index )  // The index of the first element of the block
+      , n_    ( n     )  // The number of elements of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Applies the batch operation to the block of the batch.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      op_( index_, n_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   OP           op_;     //!< The batch operation.
+   const size_t index_;  //!< The index of the first element of the block.
+   const size_t n_;      //!< The number of elements of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP execution of a batch operation.
+// \ingroup smp
+//
+// \param n The total number of elements of the batch.
+// \param granularity The granularity of the blocks of the batch.
+// \param op The batch operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP execution
+// of a batch operation. The batch is split into one block per thread, where the size of each
+// block is a multiple of the given granularity, and the batch operation is applied to all
+// blocks in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// batchMult() function.
+*/
+template< typename OP >  // Type of the batch operation
+void smpBatch_backend( size_t n, size_t granularity, const OP& op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid batch granularity" );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( n % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( n / threads + addon );
+   const size_t rest         ( equalShare % granularity );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + granularity ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= n )
+         continue;
+
+      TheThreadBackend::scheduleTask(
+         BatchBlockExecutor<OP>( op, index, min( sizePerThread, n - index ) ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP execution of a batch operation.
+// \ingroup smp
+//
+// \param n The total number of elements of the batch.
+// \param granularity The granularity of the blocks of the batch.
+// \param threshold The minimum number of elements for a parallel execution.
+// \param op The batch operation.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP execution of a batch operation. The batch
+// operation is called with the index of the first element and the number of elements of a
+// block of the batch. In case the batch contains less than \a threshold elements or in case
+// a serial section is active, the operation is applied to the entire batch at once on the
+// calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename OP >  // Type of the batch operation
+inline void smpBatch( size_t n, size_t granularity, size_t threshold, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || n < threshold ) {
+         op( 0UL, n );
+      }
+      else {
+         smpBatch_backend( n, granularity, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP execution of a batch operation.
+// \ingroup smp
+//
+// \param n The total number of elements of the batch.
+// \param granularity The granularity of the blocks of the batch.
+// \param op The batch operation.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP execution of a batch operation. The batch
+// operation is called with the index of the first element and the number of elements of a
+// block of the batch. In case the batch contains less than blaze::SMP_BATCH_THRESHOLD elements
+// or in case a serial section is active, the operation is applied to the entire batch at once
+// on the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of batch operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// batchMult() function.
+*/
+template< typename OP >  // Type of the batch operation
+inline void smpBatch( size_t n, size_t granularity, OP op )
+{
+   smpBatch( n, granularity, SMP_BATCH_THRESHOLD, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
@@ -57,6 +59,7 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -865,6 +868,334 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded reduction of a submatrix of a dense matrix.
+// \ingroup smp
+//
+// This functor reduces a submatrix of the given dense matrix and stores the result of the
+// reduction in a separate element. Since each submatrix is reduced into its own element, all
+// submatrices can be reduced concurrently.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DenseMatrixBlockReducer
+{
+   //**Type definitions****************************************************************************
+   typedef ElementType_<MT>  ET;  //!< Element type of the dense matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DenseMatrixBlockReducer class template.
+   //
+   // \param dm The dense matrix to be reduced.
+   // \param op The reduction operation.
+   // \param row The first row of the submatrix.
+   // \param column The first column of the submatrix.
+   // \param m The number of rows of the submatrix.
+   // \param n The number of columns of the submatrix.
+   // \param aligned \a true in case the submatrix is aligned, \a false if not.
+   // \param result The element to store the result of the reduction in.
+   */
+   explicit inline DenseMatrixBlockReducer( const MT& dm, OP op, size_t row, size_t column,
+                                            size_t m, size_t n, bool aligned, ET& result )
+      : dm_     ( dm      )  // The dense matrix to be reduced
+      , op_     ( op      )  // The reduction operation
+      , row_    ( row     )  // The first row of the submatrix
+      , column_ ( column  )  // The first column of the submatrix
+      , m_      ( m       )  // The number of rows of the submatrix
+      , n_      ( n       )  // The number of columns of the submatrix
+      , aligned_( aligned )  // The alignment flag of the submatrix
+      , result_ ( result  )  // The element to store the result in
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Reduces the submatrix of the dense matrix.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      if( aligned_ )
+         result_ = dmatreduce( submatrix<aligned>( dm_, row_, column_, m_, n_ ), op_ );
+      else
+         result_ = dmatreduce( submatrix<unaligned>( dm_, row_, column_, m_, n_ ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT&    dm_;       //!< The dense matrix to be reduced.
+   OP           op_;       //!< The reduction operation.
+   const size_t row_;      //!< The first row of the submatrix.
+   const size_t column_;   //!< The first column of the submatrix.
+   const size_t m_;        //!< The number of rows of the submatrix.
+   const size_t n_;        //!< The number of columns of the submatrix.
+   const bool   aligned_;  //!< The alignment flag of the submatrix.
+   ET&          result_;   //!< The element to store the result of the reduction in.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense matrix. The matrix is split into one SIMD-aligned block per thread, each block
+// is reduced concurrently, and the partial results are combined by means of the reduction
+// operation.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+ElementType_<MT> smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_<MT>  ET;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const bool simdEnabled( DMatReduceExprHelper<MT,OP>::value );
+   const bool dmAligned  ( simdEnabled && (~dm).isAligned() );
+
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~dm ) );
+
+   const size_t addon1     ( ( ( (~dm).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~dm).rows() / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~dm).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~dm).columns() / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   std::unique_ptr<ET[]> partials( new ET[threads.first*threads.second] );
+   size_t blocks( 0UL );
+
+   for( size_t i=0UL; i<threads.first; ++i )
+   {
+      const size_t row( i*rowsPerThread );
+
+      if( row >= (~dm).rows() )
+         continue;
+
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( j*colsPerThread );
+
+         if( column >= (~dm).columns() )
+            continue;
+
+         const size_t m( min( rowsPerThread, (~dm).rows()    - row    ) );
+         const size_t n( min( colsPerThread, (~dm).columns() - column ) );
+
+         TheThreadBackend::scheduleTask(
+            DenseMatrixBlockReducer<MT,OP>( ~dm, op, row, column, m, n, dmAligned, partials[blocks] ) );
+         ++blocks;
+      }
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+
+   for( size_t i=1UL; i<blocks; ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a dense matrix. In
+// case the number of elements of the matrix is smaller than the blaze::SMP_DMATREDUCE_THRESHOLD
+// or in case a serial section is active, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<MT>  ET;
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~dm).rows() * (~dm).columns() < SMP_DMATREDUCE_THRESHOLD ) {
+         redux = dmatreduce( ~dm, op );
+      }
+      else {
+         redux = smpReduce_backend( ~dm, op );
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based first-touch initialization
+// of a dense matrix. The matrix is partitioned among the threads in the same way as by the
+// C++11/Boost thread-based SMP assignment and the initialization operation is called once for each
+// partition with the row and column index of the first element of the partition and the
+// number of rows and columns of the partition.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch_backend( DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<MT> >::size };
+
+   const bool simdEnabled( MT::simdEnabled );
+
+   const ThreadMapping threadmap( createThreadMapping( TheThreadBackend::size(), ~dm ) );
+
+   const size_t addon1     ( ( ( (~dm).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~dm).rows() / threadmap.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~dm).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~dm).columns() / threadmap.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   for( size_t i=0UL; i<threadmap.first; ++i )
+   {
+      const size_t row( i*rowsPerThread );
+
+      if( row >= (~dm).rows() )
+         continue;
+
+      for( size_t j=0UL; j<threadmap.second; ++j )
+      {
+         const size_t column( j*colsPerThread );
+
+         if( column >= (~dm).columns() )
+            continue;
+
+         const size_t m( min( rowsPerThread, (~dm).rows()    - row    ) );
+         const size_t n( min( colsPerThread, (~dm).columns() - column ) );
+
+         TheThreadBackend::scheduleTask( [=]() { op( row, column, m, n ); } );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function initializes the elements of the given dense matrix by means of the given
+// initialization operation, which is called as \c op(row,column,m,n) for every partition of
+// the matrix. The partitioning of the matrix matches the partitioning of the C++11/Boost thread-based
+// SMP assignment. Therefore, on NUMA systems, the memory pages of a partition are placed on
+// the NUMA node of the thread that processes the partition during all subsequent assignments.
+// In case the matrix is too small for an SMP assignment (see the canSMPAssign() function), or
+// in case a serial or parallel section is active, the initialization is performed by the
+// calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !(~dm).canSMPAssign() ) {
+      op( 0UL, 0UL, (~dm).rows(), (~dm).columns() );
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+         smpFirstTouch_backend( ~dm, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
@@ -54,6 +56,7 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Subvector.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
@@ -1115,6 +1118,296 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded reduction of a subvector of a dense vector.
+// \ingroup smp
+//
+// This functor reduces a subvector of the given dense vector and stores the result of the
+// reduction in a separate element. Since each subvector is reduced into its own element, all
+// subvectors can be reduced concurrently.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DenseVectorBlockReducer
+{
+   //**Type definitions****************************************************************************
+   typedef ElementType_<VT>  ET;  //!< Element type of the dense vector.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DenseVectorBlockReducer class template.
+   //
+   // \param dv The dense vector to be reduced.
+   // \param op The reduction operation.
+   // \param index The first index of the subvector.
+   // \param n The size of the subvector.
+   // \param aligned \a true in case the subvector is aligned, \a false if not.
+   // \param result The element to store the result of the reduction in.
+   */
+   explicit inline DenseVectorBlockReducer( const VT& dv, OP op, size_t index, size_t n,
+                                            bool aligned, ET& result )
+      : dv_     ( dv      )  // The dense vector to be reduced
+      , op_     ( op      )  // The reduction operation
+      , index_  ( index   )  // The first index of the subvector
+      , n_      ( n       )  // The size of the subvector
+      , aligned_( aligned )  // The alignment flag of the subvector
+      , result_ ( result  )  // The element to store the result in
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Reduces the subvector of the dense vector.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      if( aligned_ )
+         result_ = dvecreduce( subvector<aligned>( dv_, index_, n_ ), op_ );
+      else
+         result_ = dvecreduce( subvector<unaligned>( dv_, index_, n_ ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const VT&    dv_;       //!< The dense vector to be reduced.
+   OP           op_;       //!< The reduction operation.
+   const size_t index_;    //!< The first index of the subvector.
+   const size_t n_;        //!< The size of the subvector.
+   const bool   aligned_;  //!< The alignment flag of the subvector.
+   ET&          result_;   //!< The element to store the result of the reduction in.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense vector. The vector is split into one SIMD-aligned block per thread, each block
+// is reduced concurrently, and the partial results are combined by means of the reduction
+// operation.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+ElementType_<VT> smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef ElementType_<VT>  ET;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<ET>::size };
+
+   const bool simdEnabled( DVecReduceExprHelper<VT,OP>::value );
+   const bool dvAligned  ( simdEnabled && (~dv).isAligned() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   std::unique_ptr<ET[]> partials( new ET[threads] );
+   size_t blocks( 0UL );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~dv).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~dv).size() - index ) );
+
+      TheThreadBackend::scheduleTask(
+         DenseVectorBlockReducer<VT,OP>( ~dv, op, index, size, dvAligned, partials[blocks] ) );
+      ++blocks;
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+
+   for( size_t i=1UL; i<blocks; ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a dense vector. In
+// case the size of the vector is smaller than the blaze::SMP_DVECREDUCE_THRESHOLD or in case
+// a serial section is active, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef ElementType_<VT>  ET;
+
+   ET redux = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+         redux = dvecreduce( ~dv, op );
+      }
+      else {
+         redux = smpReduce_backend( ~dv, op );
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based first-touch initialization
+// of a dense vector. The vector is partitioned among the threads in the same way as by the
+// C++11/Boost thread-based SMP assignment and the initialization operation is called once for each
+// partition with the index of the first element and the size of the partition.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense vectors. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch_backend( DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   enum : size_t { SIMDSIZE = SIMDTrait< ElementType_<VT> >::size };
+
+   const bool simdEnabled( VT::simdEnabled );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~dv).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~dv).size() - index ) );
+
+      TheThreadBackend::scheduleTask( [=]() { op( index, size ); } );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be initialized.
+// \param op The initialization operation.
+// \return void
+//
+// This function initializes the elements of the given dense vector by means of the given
+// initialization operation, which is called as \c op(index,n) for every partition of the
+// vector. The partitioning of the vector matches the partitioning of the C++11/Boost thread-based SMP
+// assignment. Therefore, on NUMA systems, the memory pages of a partition are placed on the
+// NUMA node of the thread that processes the partition during all subsequent assignments.
+// In case the vector is too small for an SMP assignment (see the canSMPAssign() function), or
+// in case a serial or parallel section is active, the initialization is performed by the
+// calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense vectors. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the initialization operation
+inline void smpFirstTouch( DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !(~dv).canSMPAssign() ) {
+      op( 0UL, (~dv).size() );
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+         smpFirstTouch_backend( ~dv, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
 
 //=================================================================================================
 //
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
+#include <vector>
 #include <blaze/math/Exception.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
@@ -98,6 +100,68 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations to the given cores.
+// \ingroup smp
+//
+// \param cores The cores the threads are pinned to (empty for no pinning).
+// \return void
+// \exception std::invalid_argument Invalid core.
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// cores: The i-th thread is pinned to the (i%n)-th of the n given cores. In case the given list
+// is empty, the threads are no longer pinned. In case any of the given cores is not available,
+// a \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<int>& cores )
+{
+   TheThreadBackend::setAffinity( cores );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations according to the given policy.
+// \ingroup smp
+//
+// \param policy The affinity policy (\c none, \c compact, \c scatter, or a list of cores).
+// \return void
+// \exception std::invalid_argument Invalid affinity policy.
+//
+// Via this function the threads used for thread parallel operations can be pinned according
+// to the given affinity policy (see the parseAffinity() function). In case an invalid policy
+// is specified, a \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& policy )
+{
+   TheThreadBackend::setAffinity( parseAffinity( policy ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current placement of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \return The core each thread is pinned to, or -1 for each thread that is not pinned.
+//
+// Via this function the current placement of the threads used for thread parallel operations
+// can be queried. The i-th element of the returned vector corresponds to the i-th thread, i.e.
+// the thread processing the i-th partition of a deterministically placed SMP assignment.
+*/
+BLAZE_ALWAYS_INLINE std::vector<int> getThreadAffinity()
+{
+   return TheThreadBackend::placement();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
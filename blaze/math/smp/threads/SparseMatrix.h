@@ -0,0 +1,563 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseMatrix.h
+//  \brief Header file for the C++11/Boost thread-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the SMP assignment to a sparse matrix is executed in parallel.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return \a false.
+//
+// This function returns whether the SMP assignment of the given matrix to the given sparse
+// matrix is executed in parallel. Since at least one of the two matrix types is not SMP
+// assignable, the assignment is always executed serially and the function returns \a false.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< Or< Not< IsSMPAssignable<MT1> >, Not< IsSMPAssignable<MT2> > >, bool >
+   isParallelSMPAssign( const Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the SMP assignment to a sparse matrix is executed in parallel.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return \a true in case the assignment is executed in parallel, \a false if not.
+//
+// This function returns whether the C++11/Boost thread-based SMP assignment of the given matrix
+// to the given sparse matrix is executed in parallel. In this case the assignment to a compressed
+// matrix replaces the storage of the target, i.e. the CompressedMatrix class can skip the
+// allocation of storage prior to the assignment.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSMPAssignable<MT1>, IsSMPAssignable<MT2> >, bool >
+   isParallelSMPAssign( const Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   UNUSED_PARAMETER( lhs );
+
+   return !isParallelSectionActive() && !isSerialSectionActive() && (~rhs).canSMPAssign();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded evaluation of a block of a sparse matrix.
+// \ingroup smp
+//
+// This functor evaluates a block of rows (row-major) or columns (column-major) of the given
+// right-hand side matrix into a separate sparse matrix. Since each block is evaluated into its
+// own matrix, all blocks can be evaluated concurrently. Additionally the evaluation determines
+// the exact number of non-zero elements of each row/column of the block.
+*/
+template< typename MT1    // Type of the sparse matrix block
+        , typename MT2 >  // Type of the right-hand side matrix
+struct SparseMatrixBlockAssigner
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseMatrixBlockAssigner class template.
+   //
+   // \param block The sparse matrix to be assigned to.
+   // \param rhs The right-hand side matrix.
+   // \param row The first row of the block.
+   // \param column The first column of the block.
+   // \param m The number of rows of the block.
+   // \param n The number of columns of the block.
+   */
+   explicit inline SparseMatrixBlockAssigner( MT1& block, const MT2& rhs, size_t row,
+                                              size_t column, size_t m, size_t n )
+      : block_ ( block  )  // The sparse matrix to be assigned to
+      , rhs_   ( rhs    )  // The right-hand side matrix
+      , row_   ( row    )  // The first row of the block
+      , column_( column )  // The first column of the block
+      , m_     ( m      )  // The number of rows of the block
+      , n_     ( n      )  // The number of columns of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Evaluates the block of the right-hand side matrix.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      block_.resize( m_, n_, false );
+      assign( block_, submatrix<unaligned>( rhs_, row_, column_, m_, n_ ) );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT1&         block_;   //!< The sparse matrix to be assigned to.
+   const MT2&   rhs_;     //!< The right-hand side matrix.
+   const size_t row_;     //!< The first row of the block.
+   const size_t column_;  //!< The first column of the block.
+   const size_t m_;       //!< The number of rows of the block.
+   const size_t n_;       //!< The number of columns of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded copy of a sparse matrix block.
+// \ingroup smp
+//
+// This functor appends all non-zero elements of the given block to the according rows (row-major)
+// or columns (column-major) of the target matrix. The target matrix is required to provide the
+// exact capacity for each row/column. Since only the rows/columns of the block are modified, all
+// blocks can be copied concurrently.
+*/
+template< typename MT >  // Type of the sparse matrix
+struct SparseMatrixBlockCopier
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseMatrixBlockCopier class template.
+   //
+   // \param target The target sparse matrix.
+   // \param block The sparse matrix block to be copied.
+   // \param offset The index of the first row/column of the block within the target matrix.
+   */
+   explicit inline SparseMatrixBlockCopier( MT& target, const MT& block, size_t offset )
+      : target_( target )  // The target sparse matrix
+      , block_ ( block  )  // The sparse matrix block to be copied
+      , offset_( offset )  // The index of the first row/column of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Copies the non-zero elements of the block to the target matrix.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      const size_t size( IsRowMajorMatrix<MT>::value ? block_.rows() : block_.columns() );
+      for( size_t k=0UL; k<size; ++k ) {
+         for( ConstIterator_<MT> element=block_.begin(k); element!=block_.end(k); ++element ) {
+            if( IsRowMajorMatrix<MT>::value )
+               target_.append( offset_+k, element->index(), element->value() );
+            else
+               target_.append( element->index(), offset_+k, element->value() );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT&          target_;  //!< The target sparse matrix.
+   const MT&    block_;   //!< The sparse matrix block to be copied.
+   const size_t offset_;  //!< The index of the first row/column of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the default backend implementation of the C++11/Boost thread-based SMP
+// assignment of a matrix to a sparse matrix. Since the sparse matrix does not provide the
+// means for a parallel assignment, the assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a matrix to a compressed
+//        matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
+// of a matrix to a compressed matrix. The assignment is performed in two parallel phases: In
+// the first phase, each thread evaluates a block of rows (row-major) or columns (column-major)
+// of the right-hand side matrix into a separate sparse matrix, which determines the exact number
+// of non-zero elements of each row/column. In the second phase the elements of all blocks are
+// copied in parallel into a compressed matrix, which has been allocated with the exact capacity
+// for each row/column.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO        // Storage order of the left-hand side compressed matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void smpAssign_backend( CompressedMatrix<Type,SO>& lhs, const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<Type,SO>  BlockType;
+
+   const size_t m( (~rhs).rows()    );
+   const size_t n( (~rhs).columns() );
+
+   const size_t size( SO ? n : m );
+   const size_t threads( TheThreadBackend::size() );
+
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( size / threads + addon );
+
+   std::vector<BlockType> blocks( threads );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= size )
+         continue;
+
+      const size_t current( min( sizePerThread, size - index ) );
+
+      const size_t row   ( SO ? 0UL : index );
+      const size_t column( SO ? index : 0UL );
+
+      TheThreadBackend::scheduleTask( SparseMatrixBlockAssigner<BlockType,MT>(
+         blocks[i], ~rhs, row, column, ( SO ? m : current ), ( SO ? current : n ) ) );
+   }
+
+   TheThreadBackend::wait();
+
+   std::vector<size_t> nonzeros( size, 0UL );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= size )
+         continue;
+
+      const size_t current( min( sizePerThread, size - index ) );
+
+      for( size_t k=0UL; k<current; ++k )
+         nonzeros[index+k] = blocks[i].nonZeros( k );
+   }
+
+   BlockType tmp( m, n, nonzeros );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= size )
+         continue;
+
+      TheThreadBackend::scheduleTask( SparseMatrixBlockCopier<BlockType>( tmp, blocks[i], index ) );
+   }
+
+   TheThreadBackend::wait();
+
+   swap( ~lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of
+// both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>
+                     , Or< Not< IsSMPAssignable<MT1> >
+                         , Not< IsSMPAssignable<MT2> > > > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment to a sparse matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable<MT2> > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP addition assignment to a sparse
+// matrix. Since the addition assignment potentially changes the sparsity pattern of all rows
+// and columns, the addition assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP subtraction assignment to a sparse
+// matrix. Since the subtraction assignment potentially changes the sparsity pattern of all rows
+// and columns, the subtraction assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
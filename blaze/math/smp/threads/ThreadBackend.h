@@ -51,9 +51,12 @@
 #endif
 
 #include <cstdlib>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/Affinity.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
@@ -75,7 +78,15 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. The tasks are executed
+// by a work-stealing thread pool. Every thread waits only for the tasks it has scheduled
+// itself, which enables concurrent SMP assignments from several threads as well as nested
+// SMP assignments from within a task. In case the first-touch NUMA policy is selected (see the
+// \c BLAZE_NUMA_POLICY switch in the <tt>./blaze/config/NUMA.h</tt> configuration file), the
+// thread pool places the tasks deterministically, such that the i-th partition of every SMP
+// assignment is processed by the i-th thread of the pool. The threads of the pool can be pinned
+// to specific cores, either via the \c BLAZE_THREAD_AFFINITY environment variable or via the
+// setAffinity() function.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -89,9 +100,11 @@ class ThreadBackend
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t           size       ();
+   static inline void             resize     ( size_t n, bool block=false );
+   static inline void             setAffinity( const std::vector<int>& cores );
+   static inline std::vector<int> placement  ();
+   static inline void             wait       ();
    //@}
    //**********************************************************************************************
 
@@ -112,6 +125,9 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleDivAssign( Target& target, const Source& source );
+
+   template< typename Callable >
+   static inline void scheduleTask( Callable func );
    //@}
    //**********************************************************************************************
 
@@ -324,7 +340,8 @@ class ThreadBackend
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t           initPool();
+   static inline std::vector<int> initAffinity();
    //@}
    //**********************************************************************************************
 
@@ -336,7 +353,16 @@ class ThreadBackend
                                                      specified via the environment variable
                                                      \c BLAZE_NUM_THREADS. However, it can be
                                                      explicitly resized to arbitrary numbers of
-                                                     threads. */
+                                                     threads. In case the first-touch NUMA
+                                                     policy is selected, the tasks are placed
+                                                     deterministically. The threads are pinned
+                                                     according to the environment variable
+                                                     \c BLAZE_THREAD_AFFINITY. */
+
+   static thread_local threadpool::TaskGroup tasks_;  //!< The tasks scheduled by the current thread.
+                                                      /*!< Each thread waits only for its own
+                                                           tasks, which enables concurrent and
+                                                           nested SMP assignments. */
    //@}
    //**********************************************************************************************
 };
@@ -355,7 +381,10 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), BLAZE_NUMA_FIRST_TOUCH, initAffinity() );
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local threadpool::TaskGroup ThreadBackend<TT,MT,LT,CT>::tasks_;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -416,11 +445,56 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Waiting for all scheduled tasks to be completed.
+/*!\brief Pins the threads managed by the thread backend system to the given cores.
 //
+// \param cores The cores the threads are pinned to (empty for no pinning).
 // \return void
+// \exception std::invalid_argument Invalid core.
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function pins the i-th thread of the thread backend system to the (i%n)-th of the n
+// given cores. In case the given list is empty, the threads are no longer pinned. In case any
+// of the given cores is not available, a \a std::invalid_argument exception is thrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( const std::vector<int>& cores )
+{
+   threadpool_.setAffinity( cores );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current placement of the threads managed by the thread backend system.
+//
+// \return The core each thread is pinned to, or -1 for each thread that is not pinned.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<int> ThreadBackend<TT,MT,LT,CT>::placement()
+{
+   return threadpool_.placement();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for all tasks scheduled by the calling thread to be completed.
+//
+// \return void
+//
+// This function blocks until all tasks scheduled by the calling thread have been completed.
+// Tasks scheduled by other threads are not waited for. While waiting, the calling thread
+// helps to execute pending tasks. Therefore it is possible to schedule and wait for tasks
+// from within a task that is executed by the thread backend (nested parallelism).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -428,7 +502,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   threadpool_.wait( tasks_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -461,7 +535,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   threadpool_.schedule( tasks_, Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -486,7 +560,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( tasks_, AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -511,7 +585,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( tasks_, SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -536,7 +610,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( tasks_, MultAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -561,7 +635,33 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleDivAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( DivAssigner<Target,Source>( target, source ) );
+   threadpool_.schedule( tasks_, DivAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an arbitrary task for execution.
+//
+// \param func The callable task to be executed.
+// \return void
+//
+// This function schedules the given task for execution. In contrast to the scheduling functions
+// for (compound) assignments, the task is not restricted to a single assignment, which enables
+// multi-phase SMP algorithms (as for instance the SMP assignment to a sparse matrix). As all
+// other tasks, the task is added to the task group of the calling thread and can be waited for
+// via the wait() function.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the callable task
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleTask( Callable func )
+{
+   threadpool_.schedule( tasks_, func );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -608,6 +708,54 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial list of cores the threads of the thread pool are pinned to.
+//
+// \return The initial list of cores.
+//
+// This function determines the initial thread affinity based on the \c BLAZE_THREAD_AFFINITY
+// environment variable, which accepts the same policies as the parseAffinity() function (i.e.
+// \c none, \c compact, \c scatter, or an explicit list of cores such as \c 0,2,4-7). In case
+// the environment variable is not defined, not set, or contains an invalid policy or a core
+// that is not available, the function returns an empty list, i.e. the threads are not pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<int> ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == nullptr )
+      return std::vector<int>();
+
+   try {
+      const std::vector<int> cores( parseAffinity( env ) );
+
+      for( int core : cores ) {
+         if( !isAvailableCore( core ) )
+            return std::vector<int>();
+      }
+
+      return cores;
+   }
+   catch( ... ) {
+      return std::vector<int>();
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,309 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedElement.h
+//  \brief Header file for the BlockCompressedElement class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDELEMENT_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDELEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for a single element of a block compressed sparse matrix.
+// \ingroup math
+//
+// The BlockCompressedElement class represents a single element of a sparse matrix that stores
+// its non-zero elements in dense blocks (as for instance the BlockCompressedMatrix class
+// template). Since only a single index is stored per block, the index of an element is not
+// stored explicitly but computed from the index of the block and the position of the element
+// within the block. Therefore a BlockCompressedElement refers to a value within a block and
+// holds the computed index by value. It provides the same \c value() and \c index() interface
+// as any other sparse element and thus can be used transparently in all sparse matrix
+// operations. The template parameter \a Type specifies the type of the referenced value and
+// may be \c const qualified in order to provide read-only access.
+*/
+template< typename Type >  // Type of the referenced value
+class BlockCompressedElement : private SparseElement
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef RemoveConst_<Type>             ValueType;       //!< The value type of the element.
+   typedef size_t                         IndexType;       //!< The index type of the element.
+   typedef Type&                          Reference;       //!< Reference return type.
+   typedef const ValueType&               ConstReference;  //!< Reference-to-const return type.
+   typedef const BlockCompressedElement*  Pointer;         //!< Pointer return type.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedElement( Type* value, size_t index ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename T > inline const BlockCompressedElement& operator= ( const T& v ) const;
+   template< typename T > inline const BlockCompressedElement& operator+=( const T& v ) const;
+   template< typename T > inline const BlockCompressedElement& operator-=( const T& v ) const;
+   template< typename T > inline const BlockCompressedElement& operator*=( const T& v ) const;
+   template< typename T > inline const BlockCompressedElement& operator/=( const T& v ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline Pointer operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Reference value() const noexcept;
+   inline IndexType index() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*  value_;  //!< Pointer to the referenced value.
+   size_t index_;  //!< The index of the element.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedElement class.
+//
+// \param value Pointer to the referenced value.
+// \param index The index of the element.
+*/
+template< typename Type >  // Type of the referenced value
+inline BlockCompressedElement<Type>::BlockCompressedElement( Type* value, size_t index ) noexcept
+   : value_( value )  // Pointer to the referenced value
+   , index_( index )  // The index of the element
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment to the value of the block compressed element.
+//
+// \param v The new value of the block compressed element.
+// \return Reference to the assigned block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+template< typename T >     // Type of the right-hand side value
+inline const BlockCompressedElement<Type>&
+   BlockCompressedElement<Type>::operator=( const T& v ) const
+{
+   *value_ = v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the value of the block compressed element.
+//
+// \param v The right-hand side value for the addition.
+// \return Reference to the assigned block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+template< typename T >     // Type of the right-hand side value
+inline const BlockCompressedElement<Type>&
+   BlockCompressedElement<Type>::operator+=( const T& v ) const
+{
+   *value_ += v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the value of the block compressed element.
+//
+// \param v The right-hand side value for the subtraction.
+// \return Reference to the assigned block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+template< typename T >     // Type of the right-hand side value
+inline const BlockCompressedElement<Type>&
+   BlockCompressedElement<Type>::operator-=( const T& v ) const
+{
+   *value_ -= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the value of the block compressed element.
+//
+// \param v The right-hand side value for the multiplication.
+// \return Reference to the assigned block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+template< typename T >     // Type of the right-hand side value
+inline const BlockCompressedElement<Type>&
+   BlockCompressedElement<Type>::operator*=( const T& v ) const
+{
+   *value_ *= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the value of the block compressed element.
+//
+// \param v The right-hand side value for the division.
+// \return Reference to the assigned block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+template< typename T >     // Type of the right-hand side value
+inline const BlockCompressedElement<Type>&
+   BlockCompressedElement<Type>::operator/=( const T& v ) const
+{
+   *value_ /= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the block compressed element.
+//
+// \return Pointer to the block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+inline typename BlockCompressedElement<Type>::Pointer
+   BlockCompressedElement<Type>::operator->() const noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the current value of the block compressed element.
+//
+// \return Reference to the current value of the block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+inline typename BlockCompressedElement<Type>::Reference
+   BlockCompressedElement<Type>::value() const noexcept
+{
+   return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the current index of the block compressed element.
+//
+// \return The current index of the block compressed element.
+*/
+template< typename Type >  // Type of the referenced value
+inline typename BlockCompressedElement<Type>::IndexType
+   BlockCompressedElement<Type>::index() const noexcept
+{
+   return index_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
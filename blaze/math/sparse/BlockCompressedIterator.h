@@ -0,0 +1,402 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedIterator.h
+//  \brief Header file for the BlockCompressedIterator class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDITERATOR_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/BlockCompressedElement.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the elements of a single row/column of a block compressed sparse matrix.
+// \ingroup math
+//
+// The BlockCompressedIterator class template represents a random access iterator over the
+// elements of a single row or column of a sparse matrix that stores its non-zero elements in
+// dense \a B x \a B blocks (as for instance the BlockCompressedMatrix class template). A row
+// (or column) passes through all blocks of its block row (or block column) and contributes
+// \a B consecutive elements per block. The iterator traverses the blocks and the according
+// block indices in lockstep: within a block two consecutive elements are \a stride values
+// apart, two consecutive blocks are \a blockSize values apart. On dereferencing the iterator
+// returns a BlockCompressedElement proxy, which provides access to the current value and the
+// current index. In case the given \a Type is \c const qualified, the iterator provides
+// read-only access to the values.
+*/
+template< typename Type  // Type of the referenced values
+        , size_t B >     // Number of rows and columns of the blocks
+class BlockCompressedIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef BlockCompressedElement<Type>     ValueType;         //!< Type of the underlying elements.
+   typedef ValueType                        PointerType;       //!< Pointer return type.
+   typedef ValueType                        ReferenceType;     //!< Reference return type.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Default constructor*************************************************************************
+   /*!\brief Default constructor for the BlockCompressedIterator class.
+   */
+   inline BlockCompressedIterator() noexcept
+      : value_    ( nullptr )  // Pointer to the first value of the row/column
+      , index_    ( nullptr )  // Pointer to the first block index of the row/column
+      , pos_      ( 0UL )      // The current position within the row/column
+      , stride_   ( 1UL )      // Distance between two consecutive elements within a block
+      , blockSize_( 1UL )      // Distance between two consecutive blocks
+   {}
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockCompressedIterator class.
+   //
+   // \param value Pointer to the first value of the row/column.
+   // \param index Pointer to the first block index of the row/column.
+   // \param pos The initial position within the row/column.
+   // \param stride The distance between two consecutive elements within a block.
+   // \param blockSize The distance between two consecutive blocks.
+   */
+   inline BlockCompressedIterator( Type* value, const size_t* index, size_t pos,
+                                   size_t stride, size_t blockSize ) noexcept
+      : value_    ( value     )  // Pointer to the first value of the row/column
+      , index_    ( index     )  // Pointer to the first block index of the row/column
+      , pos_      ( pos       )  // The current position within the row/column
+      , stride_   ( stride    )  // Distance between two consecutive elements within a block
+      , blockSize_( blockSize )  // Distance between two consecutive blocks
+   {}
+   //**********************************************************************************************
+
+   //**Conversion constructor**********************************************************************
+   /*!\brief Conversion constructor from different BlockCompressedIterator instances.
+   //
+   // \param it The foreign BlockCompressedIterator instance to be copied.
+   */
+   template< typename Other >
+   inline BlockCompressedIterator( const BlockCompressedIterator<Other,B>& it ) noexcept
+      : value_    ( it.value_     )  // Pointer to the first value of the row/column
+      , index_    ( it.index_     )  // Pointer to the first block index of the row/column
+      , pos_      ( it.pos_       )  // The current position within the row/column
+      , stride_   ( it.stride_    )  // Distance between two consecutive elements within a block
+      , blockSize_( it.blockSize_ )  // Distance between two consecutive blocks
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return Reference to the incremented iterator.
+   */
+   inline BlockCompressedIterator& operator+=( ptrdiff_t inc ) noexcept {
+      pos_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return Reference to the decremented iterator.
+   */
+   inline BlockCompressedIterator& operator-=( ptrdiff_t dec ) noexcept {
+      pos_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline BlockCompressedIterator& operator++() noexcept {
+      ++pos_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const BlockCompressedIterator operator++( int ) noexcept {
+      const BlockCompressedIterator tmp( *this );
+      ++(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline BlockCompressedIterator& operator--() noexcept {
+      --pos_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const BlockCompressedIterator operator--( int ) noexcept {
+      const BlockCompressedIterator tmp( *this );
+      --(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the sparse matrix element at the current iterator position.
+   //
+   // \return Proxy to the sparse matrix element at the current iterator position.
+   */
+   inline ReferenceType operator*() const noexcept {
+      return element( pos_ );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the sparse matrix element at the current iterator position.
+   //
+   // \return Proxy to the sparse matrix element at the current iterator position.
+   */
+   inline PointerType operator->() const noexcept {
+      return element( pos_ );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Direct access to the sparse matrix element at the given offset.
+   //
+   // \param offset The offset relative to the current iterator position.
+   // \return Proxy to the sparse matrix element at the given offset.
+   */
+   inline ReferenceType operator[]( ptrdiff_t offset ) const noexcept {
+      return element( pos_ + offset );
+   }
+   //**********************************************************************************************
+
+   //**Base function*******************************************************************************
+   /*!\brief Access to the current position within the value array.
+   //
+   // \return Pointer to the current value.
+   */
+   inline Type* base() const noexcept {
+      return value_ + (pos_/B)*blockSize_ + (pos_%B)*stride_;
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two BlockCompressedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator==( const BlockCompressedIterator<Other,B>& rhs ) const noexcept {
+      return pos_ == rhs.pos_;
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two BlockCompressedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   template< typename Other >
+   inline bool operator!=( const BlockCompressedIterator<Other,B>& rhs ) const noexcept {
+      return pos_ != rhs.pos_;
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two BlockCompressedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator<( const BlockCompressedIterator<Other,B>& rhs ) const noexcept {
+      return pos_ < rhs.pos_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two BlockCompressedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator>( const BlockCompressedIterator<Other,B>& rhs ) const noexcept {
+      return pos_ > rhs.pos_;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two BlockCompressedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator<=( const BlockCompressedIterator<Other,B>& rhs ) const noexcept {
+      return pos_ <= rhs.pos_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two BlockCompressedIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator>=( const BlockCompressedIterator<Other,B>& rhs ) const noexcept {
+      return pos_ >= rhs.pos_;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   template< typename Other >
+   inline DifferenceType operator-( const BlockCompressedIterator<Other,B>& rhs ) const noexcept {
+      return static_cast<DifferenceType>( pos_ ) - static_cast<DifferenceType>( rhs.pos_ );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a BlockCompressedIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const BlockCompressedIterator
+      operator+( const BlockCompressedIterator& it, size_t inc ) noexcept
+   {
+      return BlockCompressedIterator( it.value_, it.index_, it.pos_ + inc, it.stride_, it.blockSize_ );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a BlockCompressedIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const BlockCompressedIterator
+      operator+( size_t inc, const BlockCompressedIterator& it ) noexcept
+   {
+      return BlockCompressedIterator( it.value_, it.index_, it.pos_ + inc, it.stride_, it.blockSize_ );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a BlockCompressedIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const BlockCompressedIterator
+      operator-( const BlockCompressedIterator& it, size_t dec ) noexcept
+   {
+      return BlockCompressedIterator( it.value_, it.index_, it.pos_ - dec, it.stride_, it.blockSize_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Element function****************************************************************************
+   /*!\brief Creates the proxy for the element at the given position.
+   //
+   // \param pos The position within the row/column.
+   // \return Proxy to the sparse matrix element at the given position.
+   */
+   inline ReferenceType element( size_t pos ) const noexcept {
+      return ReferenceType( value_ + (pos/B)*blockSize_ + (pos%B)*stride_, index_[pos/B]*B + pos%B );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*         value_;      //!< Pointer to the first value of the row/column.
+   const size_t* index_;      //!< Pointer to the first block index of the row/column.
+   size_t        pos_;        //!< The current position within the row/column.
+   size_t        stride_;     //!< Distance between two consecutive elements within a block.
+   size_t        blockSize_;  //!< Distance between two consecutive blocks.
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< typename Other, size_t B2 > friend class BlockCompressedIterator;
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
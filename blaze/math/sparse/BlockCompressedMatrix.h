@@ -0,0 +1,1962 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a block compressed sparse matrix with dense square blocks
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/BlockCompressedIterator.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ block compressed sparse matrix.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is a sparse matrix that stores its non-zero elements
+// in dense \f$ B \times B \f$ blocks (BCSR format in case of a row-major matrix, BCSC format in
+// case of a column-major matrix). Only a single index is stored per block, which reduces the
+// amount of index data by a factor of \f$ B^2 \f$ compared to CompressedMatrix and enables
+// register blocked multiplication kernels. The type of the elements, the size of the blocks,
+// and the storage order of the matrix can be specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t B, bool SO >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - B   : specifies the number of rows and columns of the dense blocks.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// Externally a BlockCompressedMatrix behaves like any other sparse matrix of scalar elements:
+// the number of rows and columns, the function call operator, the lookup functions and the
+// iterators refer to individual elements. Internally the blocks of each block row (in case of
+// a row-major matrix) or each block column (in case of a column-major matrix) are stored
+// contiguously as StaticMatrix instances (see the nested \a BlockType) together with their
+// block column (or block row) indices. Independent of the storage order of the matrix the
+// blocks are stored in column-major order, which enables the evaluation of the block product
+// with a segment of a dense vector by means of SIMD operations without horizontal reductions.
+// Note that all elements of a stored block are considered to be non-zero elements, i.e. the
+// nonZeros() function counts \f$ B^2 \f$ elements per stored block. Also note that both the
+// number of rows and the number of columns of the matrix have to be multiples of \a B.
+//
+// A BlockCompressedMatrix can be converted from any other (dense or sparse) matrix or can be
+// filled block by block via the reserve(), append(), and finalize() functions. It can be used
+// as operand in all sparse matrix operations. The result type of all operations involving a
+// BlockCompressedMatrix is a CompressedMatrix. The multiplications with a dense vector and
+// the multiplication of a row-major BlockCompressedMatrix with a dense matrix are evaluated
+// by dedicated block kernels:
+
+   \code
+   using blaze::BlockCompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::StaticMatrix;
+   using blaze::columnMajor;
+
+   BlockCompressedMatrix<double,3UL> A( 6UL, 9UL );
+
+   StaticMatrix<double,3UL,3UL,columnMajor> block{ { 4.0, 1.0, 0.0 },
+                                                   { 1.0, 4.0, 1.0 },
+                                                   { 0.0, 1.0, 4.0 } };
+
+   A.reserve( 3UL );               // Reserving enough capacity for 3 blocks
+   A.append( 0UL, 0UL, block );    // Appending a block in block row 0 and block column 0
+   A.append( 0UL, 2UL, block );    // Appending a block in block row 0 and block column 2
+   A.finalize( 0UL );              // Finalizing block row 0
+   A.append( 1UL, 1UL, block );    // Appending a block in block row 1 and block column 1
+   A.finalize( 1UL );              // Finalizing block row 1
+
+   DynamicVector<double> x( 9UL, 1.0 ), y;
+   y = A * x;  // Block sparse matrix/dense vector multiplication
+
+   DynamicMatrix<double> X( 9UL, 4UL, 1.0 ), Y;
+   Y = A * X;  // Block sparse matrix/dense matrix multiplication
+   \endcode
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , size_t B                         // Number of rows and columns of the blocks
+        , bool SO = defaultStorageOrder >  // Storage order
+class BlockCompressedMatrix : public SparseMatrix< BlockCompressedMatrix<Type,B,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,B,SO>       This;            //!< Type of this BlockCompressedMatrix instance.
+   typedef SparseMatrix<This,SO>                  BaseType;        //!< Base type of this BlockCompressedMatrix instance.
+   typedef CompressedMatrix<Type,SO>              ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>             OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>             TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                   ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                            ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                            CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                            Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                            ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef BlockCompressedIterator<Type,B>        Iterator;        //!< Iterator over non-constant elements.
+   typedef BlockCompressedIterator<const Type,B>  ConstIterator;   //!< Iterator over constant elements.
+   typedef StaticMatrix<Type,B,B,columnMajor>     BlockType;       //!< Type of the dense blocks.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BlockCompressedMatrix<ET,B,SO>  Other;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+
+   //! The number of rows and columns of the dense blocks.
+   enum : size_t { blockSize = B };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix() noexcept;
+   explicit inline BlockCompressedMatrix( size_t m, size_t n );
+   explicit inline BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros );
+
+   template< typename MT, bool SO2 >
+   inline BlockCompressedMatrix( const Matrix<MT,SO2>& m );
+
+   inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+   inline BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   inline BlockCompressedMatrix& operator=( BlockCompressedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline BlockCompressedMatrix& operator=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t blockRows() const noexcept;
+   inline size_t blockColumns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t nonZeroBlocks() const;
+   inline size_t nonZeroBlocks( size_t k ) const;
+   inline void   reset();
+   inline void   clear();
+   inline void   reserve( size_t nonzeros );
+   inline void   swap( BlockCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t I, size_t J, const BlockType& block, bool check=false );
+   inline void finalize( size_t k );
+
+   inline size_t           blockBegin( size_t k ) const noexcept;
+   inline size_t           blockEnd  ( size_t k ) const noexcept;
+   inline BlockType*       blocks() noexcept;
+   inline const BlockType* blocks() const noexcept;
+   inline const size_t*    blockIndices() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void build( const SparseMatrix<MT,SO>& sm );
+
+   template< typename MT, bool SO2 >
+   inline void build( const Matrix<MT,SO2>& m );
+
+   inline size_t        lines() const noexcept;
+   inline size_t        lowerBoundOffset( size_t i, size_t j ) const;
+   inline Iterator      iterator( size_t i, size_t pos ) noexcept;
+   inline ConstIterator iterator( size_t i, size_t pos ) const noexcept;
+
+   static inline Type& element( BlockType& block, size_t l, size_t k ) noexcept;
+   static inline void  checkSize( size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t     m_;         //!< The current number of rows of the sparse matrix.
+   size_t     n_;         //!< The current number of columns of the sparse matrix.
+   size_t     capacity_;  //!< The current capacity of the block array.
+   size_t*    begin_;     //!< Offsets of the first block of each block row/column.
+   size_t*    end_;       //!< Offsets one past the last block of each block row/column.
+   BlockType* blocks_;    //!< The dense blocks of the sparse matrix.
+   size_t*    indices_;   //!< The block column/row indices of the dense blocks.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   BLAZE_STATIC_ASSERT( sizeof( BlockType ) % sizeof( Type ) == 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t B, bool SO >
+const Type BlockCompressedMatrix<Type,B,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>::BlockCompressedMatrix() noexcept
+   : m_       ( 0UL )      // The current number of rows of the sparse matrix
+   , n_       ( 0UL )      // The current number of columns of the sparse matrix
+   , capacity_( 0UL )      // The current capacity of the block array
+   , begin_   ( nullptr )  // Offsets of the first block of each block row/column
+   , end_     ( nullptr )  // Offsets one past the last block of each block row/column
+   , blocks_  ( nullptr )  // The dense blocks of the sparse matrix
+   , indices_ ( nullptr )  // The block column/row indices of the dense blocks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size is not a multiple of the block size.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>::BlockCompressedMatrix( size_t m, size_t n )
+   : BlockCompressedMatrix( m, n, 0UL )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero blocks.
+// \exception std::invalid_argument Matrix size is not a multiple of the block size.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity. Note that
+// the capacity is specified in terms of blocks, not in terms of individual elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>::BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( m )         // The current number of rows of the sparse matrix
+   , n_       ( n )         // The current number of columns of the sparse matrix
+   , capacity_( nonzeros )  // The current capacity of the block array
+   , begin_   ( nullptr )   // Offsets of the first block of each block row/column
+   , end_     ( nullptr )   // Offsets one past the last block of each block row/column
+   , blocks_  ( nullptr )   // The dense blocks of the sparse matrix
+   , indices_ ( nullptr )   // The block column/row indices of the dense blocks
+{
+   checkSize( m, n );
+
+   begin_   = new size_t[2UL*lines()+2UL];
+   end_     = begin_+lines()+1UL;
+   blocks_  = allocate<BlockType>( nonzeros );
+   indices_ = allocate<size_t>( nonzeros );
+
+   std::fill( begin_, begin_+2UL*lines()+1UL, 0UL );
+   end_[lines()] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Matrix size is not a multiple of the block size.
+//
+// This constructor converts the given dense or sparse matrix into the block compressed format.
+// Each block that contains at least one element of a sparse matrix operand (including explicitly
+// stored zero elements) or at least one non-zero element of a dense matrix operand is stored.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,B,SO>::BlockCompressedMatrix( const Matrix<MT,SO2>& m )
+   : BlockCompressedMatrix()
+{
+   build( ~m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization. The capacity of the new matrix matches
+// the number of stored blocks of the given matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : BlockCompressedMatrix( sm.m_, sm.n_, sm.nonZeroBlocks() )
+{
+   const size_t k( lines() );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      end_[i] = begin_[i] + ( sm.end_[i] - sm.begin_[i] );
+      std::copy( sm.blocks_+sm.begin_[i], sm.blocks_+sm.end_[i], blocks_+begin_[i] );
+      std::copy( sm.indices_+sm.begin_[i], sm.indices_+sm.end_[i], indices_+begin_[i] );
+      begin_[i+1UL] = end_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BlockCompressedMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>::BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )         // The current number of columns of the sparse matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the block array
+   , begin_   ( sm.begin_ )     // Offsets of the first block of each block row/column
+   , end_     ( sm.end_ )       // Offsets one past the last block of each block row/column
+   , blocks_  ( sm.blocks_ )    // The dense blocks of the sparse matrix
+   , indices_ ( sm.indices_ )   // The block column/row indices of the dense blocks
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = nullptr;
+   sm.end_      = nullptr;
+   sm.blocks_   = nullptr;
+   sm.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>::~BlockCompressedMatrix()
+{
+   delete[] begin_;
+   deallocate( blocks_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstReference
+   BlockCompressedMatrix<Type,B,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstReference
+   BlockCompressedMatrix<Type,B,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::Iterator
+   BlockCompressedMatrix<Type,B,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid sparse matrix row/column access index" );
+   return iterator( i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid sparse matrix row/column access index" );
+   return iterator( i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid sparse matrix row/column access index" );
+   return iterator( i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::Iterator
+   BlockCompressedMatrix<Type,B,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid sparse matrix row/column access index" );
+   return iterator( i, ( end_[i/B] - begin_[i/B] ) * B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid sparse matrix row/column access index" );
+   return iterator( i, ( end_[i/B] - begin_[i/B] ) * B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid sparse matrix row/column access index" );
+   return iterator( i, ( end_[i/B] - begin_[i/B] ) * B );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>&
+   BlockCompressedMatrix<Type,B,SO>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BlockCompressedMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline BlockCompressedMatrix<Type,B,SO>&
+   BlockCompressedMatrix<Type,B,SO>::operator=( BlockCompressedMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Matrix size is not a multiple of the block size.
+//
+// The given dense or sparse matrix is converted into the block compressed format. In contrast
+// to other matrix types, the size of the matrix is adapted to the size of the right-hand side
+// matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,B,SO>&
+   BlockCompressedMatrix<Type,B,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block rows of the sparse matrix.
+//
+// \return The number of block rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::blockRows() const noexcept
+{
+   return m_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block columns of the sparse matrix.
+//
+// \return The number of block columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::blockColumns() const noexcept
+{
+   return n_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity is given in terms of elements, i.e. each block of the block array accounts for
+// \f$ B^2 \f$ elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::capacity() const noexcept
+{
+   return capacity_ * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid row/column access index" );
+   return ( begin_[i/B+1UL] - begin_[i/B] ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// Note that all \f$ B^2 \f$ elements of each stored block are counted as non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::nonZeros() const
+{
+   return nonZeroBlocks() * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines()*B, "Invalid row/column access index" );
+   return ( end_[i/B] - begin_[i/B] ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored blocks in the sparse matrix.
+//
+// \return The number of stored blocks in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::nonZeroBlocks() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<lines(); ++k )
+      nonzeros += end_[k] - begin_[k];
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored blocks in the specified block row/column.
+//
+// \param k The index of the block row/column.
+// \return The number of stored blocks of block row/column \a k.
+//
+// In case the storage order is set to \a rowMajor the function returns the number of blocks in
+// block row \a k, in case the storage flag is set to \a columnMajor the function returns the
+// number of blocks in block column \a k.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::nonZeroBlocks( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < lines(), "Invalid block row/column access index" );
+   return end_[k] - begin_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all stored blocks. Note that the capacity of the matrix remains
+// unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void BlockCompressedMatrix<Type,B,SO>::reset()
+{
+   for( size_t k=0UL; k<lines(); ++k )
+      end_[k] = begin_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void BlockCompressedMatrix<Type,B,SO>::clear()
+{
+   if( begin_ == nullptr ) return;
+
+   end_[0UL] = end_[lines()];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix in terms of blocks.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros blocks.
+// The current values of the matrix elements and the individual capacities of the block rows
+// (or block columns) are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void BlockCompressedMatrix<Type,B,SO>::reserve( size_t nonzeros )
+{
+   if( nonzeros <= capacity_ ) return;
+
+   BlockType* newBlocks ( allocate<BlockType>( nonzeros ) );
+   size_t*    newIndices( allocate<size_t>( nonzeros ) );
+
+   for( size_t k=0UL; k<lines(); ++k ) {
+      std::copy( blocks_+begin_[k], blocks_+end_[k], newBlocks+begin_[k] );
+      std::copy( indices_+begin_[k], indices_+end_[k], newIndices+begin_[k] );
+   }
+
+   std::swap( blocks_, newBlocks );
+   std::swap( indices_, newIndices );
+   deallocate( newBlocks );
+   deallocate( newIndices );
+
+   capacity_ = nonzeros;
+   end_[lines()] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void BlockCompressedMatrix<Type,B,SO>::swap( BlockCompressedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_, sm.end_ );
+   std::swap( blocks_, sm.blocks_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a sparse matrix with the same storage order into the block format.
+//
+// \param sm The sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Matrix size is not a multiple of the block size.
+//
+// The conversion is performed in two passes over the given matrix: the first pass determines
+// the total number of blocks, the second pass determines the sorted block indices of each block
+// row (or block column) and copies the elements into the zero-initialized blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the sparse matrix
+void BlockCompressedMatrix<Type,B,SO>::build( const SparseMatrix<MT,SO>& sm )
+{
+   typedef ConstIterator_< RemoveReference_< CompositeType_<MT> > >  RhsIterator;
+
+   CompositeType_<MT> A( ~sm );  // Evaluation of the sparse matrix operand
+
+   checkSize( A.rows(), A.columns() );
+
+   const size_t outer( ( SO ? A.columns() : A.rows()    ) / B );
+   const size_t inner( ( SO ? A.rows()    : A.columns() ) / B );
+
+   std::vector<size_t> marker( inner, outer );
+   std::vector<size_t> position( inner );
+   std::vector<size_t> indices;
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<outer; ++k ) {
+      for( size_t i=k*B; i<(k+1UL)*B; ++i ) {
+         for( RhsIterator it=A.begin(i); it!=A.end(i); ++it ) {
+            const size_t J( it->index() / B );
+            if( marker[J] != k ) {
+               marker[J] = k;
+               ++nonzeros;
+            }
+         }
+      }
+   }
+
+   BlockCompressedMatrix tmp( A.rows(), A.columns(), nonzeros );
+
+   std::fill( marker.begin(), marker.end(), outer );
+
+   for( size_t k=0UL; k<outer; ++k )
+   {
+      indices.clear();
+
+      for( size_t i=k*B; i<(k+1UL)*B; ++i ) {
+         for( RhsIterator it=A.begin(i); it!=A.end(i); ++it ) {
+            const size_t J( it->index() / B );
+            if( marker[J] != k ) {
+               marker[J] = k;
+               indices.push_back( J );
+            }
+         }
+      }
+
+      std::sort( indices.begin(), indices.end() );
+
+      for( size_t J : indices ) {
+         position[J] = tmp.end_[k];
+         tmp.indices_[tmp.end_[k]] = J;
+         ++tmp.end_[k];
+      }
+
+      for( size_t i=k*B; i<(k+1UL)*B; ++i ) {
+         for( RhsIterator it=A.begin(i); it!=A.end(i); ++it ) {
+            const size_t j( it->index() );
+            element( tmp.blocks_[position[j/B]], i%B, j%B ) = it->value();
+         }
+      }
+
+      tmp.finalize( k );
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a dense matrix or a sparse matrix with opposite storage order into the
+//        block format.
+//
+// \param m The matrix to be converted.
+// \return void
+// \exception std::invalid_argument Matrix size is not a multiple of the block size.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+template< typename MT    // Type of the matrix
+        , bool SO2 >     // Storage order of the matrix
+inline void BlockCompressedMatrix<Type,B,SO>::build( const Matrix<MT,SO2>& m )
+{
+   checkSize( (~m).rows(), (~m).columns() );
+
+   const CompressedMatrix<Type,SO> tmp( serial( ~m ) );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of block rows/columns of the sparse matrix.
+//
+// \return The number of block rows (row-major) or block columns (column-major).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::lines() const noexcept
+{
+   return ( SO ? n_ : m_ ) / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first element of a row/column with an index not less than
+//        \a j.
+//
+// \param i The index of the row/column.
+// \param j The index of the search element.
+// \return The position of the element within the row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::lowerBoundOffset( size_t i, size_t j ) const
+{
+   const size_t* const first( indices_ + begin_[i/B] );
+   const size_t* const last ( indices_ + end_[i/B]   );
+   const size_t* const pos  ( std::lower_bound( first, last, j/B ) );
+
+   if( pos != last && *pos == j/B )
+      return ( pos - first ) * B + j%B;
+   else
+      return ( pos - first ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given position within a row/column.
+//
+// \param i The index of the row/column.
+// \param pos The position of the element within the row/column.
+// \return Iterator to the element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::Iterator
+   BlockCompressedMatrix<Type,B,SO>::iterator( size_t i, size_t pos ) noexcept
+{
+   const size_t k( i/B );
+
+   if( begin_[k] == end_[k] )
+      return Iterator();
+
+   BlockType& block( blocks_[begin_[k]] );
+
+   return Iterator( block.data() + ( SO ? (i%B)*block.spacing() : i%B ), indices_+begin_[k], pos,
+                    ( SO ? 1UL : block.spacing() ), sizeof( BlockType ) / sizeof( Type ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given position within a row/column.
+//
+// \param i The index of the row/column.
+// \param pos The position of the element within the row/column.
+// \return Iterator to the element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::iterator( size_t i, size_t pos ) const noexcept
+{
+   const size_t k( i/B );
+
+   if( begin_[k] == end_[k] )
+      return ConstIterator();
+
+   const BlockType& block( blocks_[begin_[k]] );
+
+   return ConstIterator( block.data() + ( SO ? (i%B)*block.spacing() : i%B ), indices_+begin_[k], pos,
+                         ( SO ? 1UL : block.spacing() ), sizeof( BlockType ) / sizeof( Type ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to an element of a block via its position within the row/column.
+//
+// \param block The block to be accessed.
+// \param l The index of the row/column within the block.
+// \param k The index of the element within the row/column of the block.
+// \return Reference to the element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline Type& BlockCompressedMatrix<Type,B,SO>::element( BlockType& block, size_t l, size_t k ) noexcept
+{
+   return ( SO ? block(k,l) : block(l,k) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given matrix size is a multiple of the block size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix size is not a multiple of the block size.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void BlockCompressedMatrix<Type,B,SO>::checkSize( size_t m, size_t n )
+{
+   if( m % B != 0UL || n % B != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix size is not a multiple of the block size" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix, i.e. whether it is part of a stored block. In case the element is found, the function
+// returns an row/column iterator to the element. Otherwise an iterator just past the last
+// element of row \a i or column \a j (the end() iterator) is returned. Note that the returned
+// row/column iterator is subject to invalidation due to inserting operations via the append()
+// function or the reserve() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::Iterator
+   BlockCompressedMatrix<Type,B,SO>::find( size_t i, size_t j )
+{
+   return Iterator( const_cast<const This&>( *this ).find( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix, i.e. whether it is part of a stored block. In case the element is found, the function
+// returns an row/column iterator to the element. Otherwise an iterator just past the last
+// element of row \a i or column \a j (the end() iterator) is returned. Note that the returned
+// row/column iterator is subject to invalidation due to inserting operations via the append()
+// function or the reserve() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned iterator is subject
+// to invalidation due to inserting operations via the append() function or the reserve()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::Iterator
+   BlockCompressedMatrix<Type,B,SO>::lowerBound( size_t i, size_t j )
+{
+   return ( SO ? iterator( j, lowerBoundOffset( j, i ) ) : iterator( i, lowerBoundOffset( i, j ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned iterator is subject
+// to invalidation due to inserting operations via the append() function or the reserve()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::lowerBound( size_t i, size_t j ) const
+{
+   return ( SO ? iterator( j, lowerBoundOffset( j, i ) ) : iterator( i, lowerBoundOffset( i, j ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned iterator is subject
+// to invalidation due to inserting operations via the append() function or the reserve()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::Iterator
+   BlockCompressedMatrix<Type,B,SO>::upperBound( size_t i, size_t j )
+{
+   return ( SO ? iterator( j, lowerBoundOffset( j, i+1UL ) ) : iterator( i, lowerBoundOffset( i, j+1UL ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned iterator is subject
+// to invalidation due to inserting operations via the append() function or the reserve()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::ConstIterator
+   BlockCompressedMatrix<Type,B,SO>::upperBound( size_t i, size_t j ) const
+{
+   return ( SO ? iterator( j, lowerBoundOffset( j, i+1UL ) ) : iterator( i, lowerBoundOffset( i, j+1UL ) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending a block to the specified block row/column of the sparse matrix.
+//
+// \param I The block row index of the new block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param J The block column index of the new block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \param block The block to be appended.
+// \param check \a true if the new block should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a block compressed matrix with blocks.
+// It appends a new block to the end of the specified block row (in case of a row-major matrix)
+// or block column (in case of a column-major matrix) without any additional memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new block must be strictly larger than the largest index of the blocks
+//    in the specified block row/column of the sparse matrix
+//  - the current number of blocks in the matrix must be smaller than the capacity of the
+//    matrix (see the reserve() function)
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new block should be tested for a default block. If the new
+// block is a default block (for instance a zero block in case of an integral element type) the
+// block is not appended. Per default the blocks are not tested. In combination with the reserve()
+// and the finalize() function, append() provides the most efficient way to add new blocks to a
+// (newly created) block compressed matrix.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void BlockCompressedMatrix<Type,B,SO>::append( size_t I, size_t J, const BlockType& block, bool check )
+{
+   const size_t k( SO ? J : I );
+   const size_t j( SO ? I : J );
+
+   BLAZE_USER_ASSERT( I < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( J < blockColumns(), "Invalid block column access index" );
+   BLAZE_USER_ASSERT( end_[k] < end_[lines()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || j > indices_[end_[k]-1UL], "Index is not strictly increasing" );
+
+   blocks_[end_[k]] = block;
+
+   if( !check || !isDefault( blocks_[end_[k]] ) ) {
+      indices_[end_[k]] = j;
+      ++end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the block insertion of a block row/column.
+//
+// \param k The index of the block row/column to be finalized \f$[0..M/B-1]\f$ or \f$[0..N/B-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with blocks.
+// After completion of block row/column \a k via the append() function, this function can be
+// called to finalize block row/column \a k and prepare the next block row/column for insertion
+// process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void BlockCompressedMatrix<Type,B,SO>::finalize( size_t k )
+{
+   BLAZE_USER_ASSERT( k < lines(), "Invalid block row/column access index" );
+
+   begin_[k+1UL] = end_[k];
+   if( k != lines()-1UL )
+      end_[k+1UL] = end_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first block of the given block row/column.
+//
+// \param k The index of the block row/column.
+// \return The offset of the first block within the block and index arrays.
+//
+// The blocks of block row/column \a k are stored in the range \f$[blockBegin(k)..blockEnd(k))\f$
+// of the block array (see the blocks() function) and the index array (see the blockIndices()
+// function).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::blockBegin( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < lines(), "Invalid block row/column access index" );
+   return begin_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset one past the last block of the given block row/column.
+//
+// \param k The index of the block row/column.
+// \return The offset one past the last block within the block and index arrays.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline size_t BlockCompressedMatrix<Type,B,SO>::blockEnd( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < lines(), "Invalid block row/column access index" );
+   return end_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the blocks of the sparse matrix.
+//
+// \return Pointer to the array of blocks.
+//
+// The values of the stored blocks can be modified directly via the returned pointer, which for
+// instance enables the efficient accumulation of element contributions in a finite element
+// assembly once the sparsity pattern has been established.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline typename BlockCompressedMatrix<Type,B,SO>::BlockType*
+   BlockCompressedMatrix<Type,B,SO>::blocks() noexcept
+{
+   return blocks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the blocks of the sparse matrix.
+//
+// \return Pointer to the array of blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline const typename BlockCompressedMatrix<Type,B,SO>::BlockType*
+   BlockCompressedMatrix<Type,B,SO>::blocks() const noexcept
+{
+   return blocks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the block indices of the sparse matrix.
+//
+// \return Pointer to the array of block indices.
+//
+// In case of a row-major matrix the array contains the block column index of each block, in
+// case of a column-major matrix the block row index of each block.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline const size_t* BlockCompressedMatrix<Type,B,SO>::blockIndices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B          // Number of rows and columns of the blocks
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B          // Number of rows and columns of the blocks
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline bool BlockCompressedMatrix<Type,B,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t B, bool SO >
+inline void reset( BlockCompressedMatrix<Type,B,SO>& m );
+
+template< typename Type, size_t B, bool SO >
+inline void clear( BlockCompressedMatrix<Type,B,SO>& m );
+
+template< typename Type, size_t B, bool SO >
+inline bool isDefault( const BlockCompressedMatrix<Type,B,SO>& m );
+
+template< typename Type, size_t B, bool SO >
+inline bool isIntact( const BlockCompressedMatrix<Type,B,SO>& m );
+
+template< typename Type, size_t B, bool SO >
+inline void swap( BlockCompressedMatrix<Type,B,SO>& a, BlockCompressedMatrix<Type,B,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void reset( BlockCompressedMatrix<Type,B,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void clear( BlockCompressedMatrix<Type,B,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sparse matrix is in default state.
+// \ingroup block_compressed_matrix
+//
+// \param m The sparse matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+//
+// This function checks whether the sparse matrix is in default state. For instance, in case
+// the matrix is instantiated for a built-in integral or floating point data type, the function
+// returns \a true in case all matrix elements are 0 and \a false in case any matrix element is
+// not 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline bool isDefault( const BlockCompressedMatrix<Type,B,SO>& m )
+{
+   for( size_t k=0UL; k<( SO ? m.blockColumns() : m.blockRows() ); ++k ) {
+      for( size_t pos=m.blockBegin(k); pos!=m.blockEnd(k); ++pos )
+         if( !isDefault( m.blocks()[pos] ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given sparse matrix are intact.
+// \ingroup block_compressed_matrix
+//
+// \param m The sparse matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the sparse matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline bool isIntact( const BlockCompressedMatrix<Type,B,SO>& m )
+{
+   const size_t outer( SO ? m.blockColumns() : m.blockRows() );
+   const size_t inner( SO ? m.blockRows() : m.blockColumns() );
+
+   if( m.rows() % B != 0UL || m.columns() % B != 0UL || m.nonZeros() > m.capacity() )
+      return false;
+
+   for( size_t k=0UL; k<outer; ++k )
+   {
+      if( m.blockBegin(k) > m.blockEnd(k) ||
+          ( k > 0UL && m.blockBegin(k) < m.blockEnd(k-1UL) ) )
+         return false;
+
+      for( size_t pos=m.blockBegin(k); pos!=m.blockEnd(k); ++pos ) {
+         if( m.blockIndices()[pos] >= inner ||
+             ( pos > m.blockBegin(k) && m.blockIndices()[pos] <= m.blockIndices()[pos-1UL] ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B       // Number of rows and columns of the blocks
+        , bool SO >      // Storage order
+inline void swap( BlockCompressedMatrix<Type,B,SO>& a, BlockCompressedMatrix<Type,B,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, bool SO >
+struct SubmatrixTrait< BlockCompressedMatrix<T1,B,SO> >
+{
+   using Type = CompressedMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, bool SO >
+struct RowTrait< BlockCompressedMatrix<T1,B,SO> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, bool SO >
+struct ColumnTrait< BlockCompressedMatrix<T1,B,SO> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
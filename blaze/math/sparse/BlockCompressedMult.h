@@ -0,0 +1,809 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMult.h
+//  \brief Multiplication kernels for the BlockCompressedMatrix class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMULT_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/BlockCompressedMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the result of a BlockCompressedMatrix multiplication kernel.
+// \ingroup block_compressed_matrix
+*/
+struct BlockAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { lhs = rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment of the result of a BlockCompressedMatrix multiplication kernel.
+// \ingroup block_compressed_matrix
+*/
+struct BlockAddAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { lhs += rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment of the result of a BlockCompressedMatrix multiplication kernel.
+// \ingroup block_compressed_matrix
+*/
+struct BlockSubAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { lhs -= rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a range of block rows of a row-major
+//        BlockCompressedMatrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param x The right-hand side dense vector.
+// \param Ibegin The index of the first block row.
+// \param Iend The index one past the last block row.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// The contributions of all blocks of a block row are accumulated in a small static vector by
+// means of the (vectorized) StaticMatrix/StaticVector multiplication before the result is
+// written to the target vector.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT2   // Type of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline DisableIf_< IsDenseMatrix<VT1> >
+   blockMultKernel( VT1& y, const BlockCompressedMatrix<Type,B,false>& A, const VT2& x,
+                    size_t Ibegin, size_t Iend, OP op )
+{
+   typedef typename BlockCompressedMatrix<Type,B,false>::BlockType  BlockType;
+   typedef StaticVector< RemoveConst_< ElementType_<VT2> >, B, false >  XType;
+   typedef MultTrait_<BlockType,XType>  YType;
+
+   const BlockType* const blocks ( A.blocks() );
+   const size_t*    const indices( A.blockIndices() );
+
+   XType xs;
+   YType ys;
+
+   for( size_t I=Ibegin; I<Iend; ++I )
+   {
+      reset( ys );
+
+      for( size_t k=A.blockBegin(I); k!=A.blockEnd(I); ++k ) {
+         const size_t j( indices[k]*B );
+         for( size_t l=0UL; l<B; ++l )
+            xs[l] = x[j+l];
+         ys += blocks[k] * xs;
+      }
+
+      for( size_t l=0UL; l<B; ++l ) {
+         op( y[I*B+l], ys[l] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a range of block columns of a column-major
+//        BlockCompressedMatrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector (or pointer to the first target element).
+// \param A The left-hand side BlockCompressedMatrix.
+// \param x The right-hand side dense vector.
+// \param Jbegin The index of the first block column.
+// \param Jend The index one past the last block column.
+// \param op The update operation for the result values (addition or subtraction assignment).
+// \return void
+//
+// This kernel scatters the product of each block of the given block columns with the according
+// segment of \a x to the according segment of \a y.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT2   // Type of the right-hand side vector
+        , typename OP >  // Type of the update operation
+inline void blockMultKernel( VT1& y, const BlockCompressedMatrix<Type,B,true>& A, const VT2& x,
+                             size_t Jbegin, size_t Jend, OP op )
+{
+   typedef typename BlockCompressedMatrix<Type,B,true>::BlockType  BlockType;
+   typedef StaticVector< RemoveConst_< ElementType_<VT2> >, B, false >  XType;
+   typedef MultTrait_<BlockType,XType>  YType;
+
+   const BlockType* const blocks ( A.blocks() );
+   const size_t*    const indices( A.blockIndices() );
+
+   XType xs;
+   YType ys;
+
+   for( size_t J=Jbegin; J<Jend; ++J )
+   {
+      if( A.blockBegin(J) == A.blockEnd(J) ) continue;
+
+      for( size_t l=0UL; l<B; ++l )
+         xs[l] = x[J*B+l];
+
+      for( size_t k=A.blockBegin(J); k!=A.blockEnd(J); ++k ) {
+         const size_t i( indices[k]*B );
+         ys = blocks[k] * xs;
+         for( size_t l=0UL; l<B; ++l )
+            op( y[i+l], ys[l] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of a range of block rows of a row-major
+//        BlockCompressedMatrix with a dense matrix (\f$ C=A*X \f$).
+// \ingroup block_compressed_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param X The right-hand side dense matrix.
+// \param Ibegin The index of the first block row.
+// \param Iend The index one past the last block row.
+// \param op The update operation for the result values (addition or subtraction assignment).
+// \return void
+//
+// Each block is multiplied with the according \f$ B \times N \f$ row panel of \a X by means of
+// the dense matrix multiplication kernels. The result is accumulated in the according row panel
+// of \a C.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename MT2   // Type of the right-hand side matrix
+        , typename OP >  // Type of the update operation
+inline EnableIf_< IsDenseMatrix<MT1> >
+   blockMultKernel( MT1& C, const BlockCompressedMatrix<Type,B,false>& A, const MT2& X,
+                    size_t Ibegin, size_t Iend, OP op )
+{
+   typedef typename BlockCompressedMatrix<Type,B,false>::BlockType  BlockType;
+
+   const BlockType* const blocks ( A.blocks() );
+   const size_t*    const indices( A.blockIndices() );
+   const size_t N( X.columns() );
+
+   for( size_t I=Ibegin; I<Iend; ++I )
+   {
+      auto Csub( submatrix( C, I*B, 0UL, B, N ) );
+
+      for( size_t k=A.blockBegin(I); k!=A.blockEnd(I); ++k ) {
+         op( Csub, serial( blocks[k] * submatrix( X, indices[k]*B, 0UL, B, N ) ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the multiplication of a range of block rows of a row-major
+//        BlockCompressedMatrix with a dense vector or dense matrix.
+// \ingroup block_compressed_matrix
+//
+// This functor computes the rows of the given range of block rows of the product between a
+// row-major BlockCompressedMatrix and a dense vector or dense matrix. It is used in combination
+// with the smpBatch() function.
+*/
+template< typename T1    // Type of the left-hand side target vector/matrix
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename T2    // Type of the right-hand side vector/matrix
+        , typename OP >  // Type of the assignment operation
+struct BlockMultBatch
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockMultBatch class template.
+   //
+   // \param y The target left-hand side dense vector/matrix.
+   // \param A The left-hand side BlockCompressedMatrix.
+   // \param x The right-hand side dense vector/matrix.
+   // \param op The assignment operation for the result values.
+   */
+   explicit inline BlockMultBatch( T1& y, const BlockCompressedMatrix<Type,B,false>& A,
+                                   const T2& x, OP op )
+      : y_ ( y  )  // The target left-hand side dense vector/matrix
+      , A_ ( A  )  // The left-hand side BlockCompressedMatrix
+      , x_ ( x  )  // The right-hand side dense vector/matrix
+      , op_( op )  // The assignment operation
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the rows of the given range of block rows.
+   //
+   // \param index The index of the first block row.
+   // \param n The number of block rows.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      blockMultKernel( y_, A_, x_, index, index+n, op_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T1&                                       y_;   //!< The target left-hand side dense vector/matrix.
+   const BlockCompressedMatrix<Type,B,false>& A_;   //!< The left-hand side BlockCompressedMatrix.
+   const T2&                                 x_;   //!< The right-hand side dense vector/matrix.
+   OP                                        op_;  //!< The assignment operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the computation of the partial results of the multiplication of a
+//        column-major BlockCompressedMatrix with a dense vector.
+// \ingroup block_compressed_matrix
+//
+// This functor computes the contribution of the b-th of \a parts parts of the block columns to
+// the product between a column-major BlockCompressedMatrix and a dense vector. The partial
+// result of each part is stored in a separate row of the given buffer, such that all parts can
+// be processed concurrently. It is used in combination with the smpBatch() function.
+*/
+template< typename ET    // Element type of the partial results
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT >  // Type of the right-hand side vector
+struct BlockScatterBatch
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockScatterBatch class template.
+   //
+   // \param partial Pointer to the buffer for the partial results.
+   // \param parts The total number of parts.
+   // \param A The left-hand side BlockCompressedMatrix.
+   // \param x The right-hand side dense vector.
+   */
+   explicit inline BlockScatterBatch( ET* partial, size_t parts,
+                                      const BlockCompressedMatrix<Type,B,true>& A, const VT& x )
+      : partial_( partial )  // Pointer to the buffer for the partial results
+      , parts_  ( parts   )  // The total number of parts
+      , A_      ( A       )  // The left-hand side BlockCompressedMatrix
+      , x_      ( x       )  // The right-hand side dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the partial results of the given range of parts.
+   //
+   // \param index The index of the first part.
+   // \param n The number of parts.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const
+   {
+      for( size_t b=index; b<index+n; ++b ) {
+         ET* y( partial_ + b*A_.rows() );
+         const size_t Jbegin( (  b      *A_.blockColumns() ) / parts_ );
+         const size_t Jend  ( ( (b+1UL)*A_.blockColumns() ) / parts_ );
+         blockMultKernel( y, A_, x_, Jbegin, Jend, BlockAddAssign() );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   ET* const                                 partial_;  //!< Pointer to the buffer for the partial results.
+   const size_t                              parts_;    //!< The total number of parts.
+   const BlockCompressedMatrix<Type,B,true>& A_;        //!< The left-hand side BlockCompressedMatrix.
+   const VT&                                 x_;        //!< The right-hand side dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the reduction of the partial results of the multiplication of a
+//        column-major BlockCompressedMatrix with a dense vector.
+// \ingroup block_compressed_matrix
+//
+// This functor accumulates the partial results of all parts for a range of elements of the
+// target vector. It is used in combination with the smpBatch() function.
+*/
+template< typename VT    // Type of the left-hand side target vector
+        , typename ET    // Element type of the partial results
+        , typename OP >  // Type of the assignment operation
+struct BlockScatterReduce
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockScatterReduce class template.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param partial Pointer to the buffer of partial results.
+   // \param parts The total number of parts.
+   // \param op The assignment operation for the result values.
+   */
+   explicit inline BlockScatterReduce( VT& y, const ET* partial, size_t parts, OP op )
+      : y_      ( y       )  // The target left-hand side dense vector
+      , partial_( partial )  // Pointer to the buffer of partial results
+      , parts_  ( parts   )  // The total number of parts
+      , op_     ( op      )  // The assignment operation
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Accumulates the partial results for the given range of elements.
+   //
+   // \param index The index of the first element.
+   // \param n The number of elements.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const
+   {
+      const size_t size( y_.size() );
+
+      for( size_t i=index; i<index+n; ++i ) {
+         ET sum( partial_[i] );
+         for( size_t b=1UL; b<parts_; ++b )
+            sum += partial_[b*size+i];
+         op_( y_[i], sum );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT&          y_;        //!< The target left-hand side dense vector.
+   const ET*    partial_;  //!< Pointer to the buffer of partial results.
+   const size_t parts_;    //!< The total number of parts.
+   OP           op_;       //!< The assignment operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of a row-major BlockCompressedMatrix with a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// This function is used internally by the sparse matrix/dense vector multiplication expression
+// templates for the evaluation of products with a BlockCompressedMatrix.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline void blockMult( DenseVector<VT1,TF1>& y, const BlockCompressedMatrix<Type,B,false>& A,
+                       const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   blockMultKernel( ~y, A, ~x, 0UL, A.blockRows(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of a row-major BlockCompressedMatrix with a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// This function distributes the block rows of the matrix among the available threads. In case
+// the matrix has less rows than specified by the according SMP threshold the multiplication is
+// executed serially.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline void smpBlockMult( DenseVector<VT1,TF1>& y, const BlockCompressedMatrix<Type,B,false>& A,
+                          const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   const size_t threshold( ( SMP_SMATDVECMULT_THRESHOLD + B - 1UL ) / B );
+
+   smpBatch( A.blockRows(), 1UL, threshold,
+             BlockMultBatch<VT1,Type,B,VT2,OP>( ~y, A, ~x, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of a column-major BlockCompressedMatrix with a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param x The right-hand side dense vector.
+// \param op The update operation for the result values (addition or subtraction assignment).
+// \return void
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the update operation
+inline void blockMult( DenseVector<VT1,TF1>& y, const BlockCompressedMatrix<Type,B,true>& A,
+                       const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   blockMultKernel( ~y, A, ~x, 0UL, A.blockColumns(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial assignment of the product of a column-major BlockCompressedMatrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param x The right-hand side dense vector.
+// \return void
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2 >     // Transpose flag of the right-hand side vector
+inline void blockMult( DenseVector<VT1,TF1>& y, const BlockCompressedMatrix<Type,B,true>& A,
+                       const DenseVector<VT2,TF2>& x, BlockAssign )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   reset( ~y );
+   blockMult( ~y, A, ~x, BlockAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of a column-major BlockCompressedMatrix with a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// Since different block columns contribute to the same elements of the target vector, each
+// thread accumulates the contribution of a range of block columns into a private buffer.
+// Afterwards the partial results are reduced in parallel. In case the target vector has less
+// elements than specified by the according SMP threshold or in case only a single thread is
+// available, the multiplication is executed serially.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline void smpBlockMult( DenseVector<VT1,TF1>& y, const BlockCompressedMatrix<Type,B,true>& A,
+                          const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef RemoveConst_< ElementType_<VT1> >  ET;
+
+   const size_t parts( min( getNumThreads(), A.blockColumns() ) );
+
+   if( parts < 2UL || A.rows() < SMP_TSMATDVECMULT_THRESHOLD ) {
+      blockMult( ~y, A, ~x, op );
+      return;
+   }
+
+   std::vector<ET> partial( parts*A.rows() );
+
+   smpBatch( parts, 1UL, 2UL,
+             BlockScatterBatch<ET,Type,B,VT2>( partial.data(), parts, A, ~x ) );
+   smpBatch( A.rows(), SIMDTrait<ET>::size, SMP_TSMATDVECMULT_THRESHOLD,
+             BlockScatterReduce<VT1,ET,OP>( ~y, partial.data(), parts, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of a row-major BlockCompressedMatrix with a dense matrix
+//        (\f$ C=A*X \f$).
+// \ingroup block_compressed_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param X The right-hand side dense matrix.
+// \param op The update operation for the result values (addition or subtraction assignment).
+// \return void
+//
+// This function is used internally by the sparse matrix/dense matrix multiplication expression
+// templates for the evaluation of products with a BlockCompressedMatrix.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the target matrix
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename OP >  // Type of the update operation
+inline void blockMult( DenseMatrix<MT1,SO1>& C, const BlockCompressedMatrix<Type,B,false>& A,
+                       const DenseMatrix<MT2,SO2>& X, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()     , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~X).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~X).rows()    == A.columns()  , "Invalid number of rows"    );
+
+   blockMultKernel( ~C, A, ~X, 0UL, A.blockRows(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial assignment of the product of a row-major BlockCompressedMatrix and a dense matrix
+//        (\f$ C=A*X \f$).
+// \ingroup block_compressed_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param X The right-hand side dense matrix.
+// \return void
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the target matrix
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline void blockMult( DenseMatrix<MT1,SO1>& C, const BlockCompressedMatrix<Type,B,false>& A,
+                       const DenseMatrix<MT2,SO2>& X, BlockAssign )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   reset( ~C );
+   blockMult( ~C, A, ~X, BlockAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of a row-major BlockCompressedMatrix with a dense matrix
+//        (\f$ C=A*X \f$).
+// \ingroup block_compressed_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param X The right-hand side dense matrix.
+// \param op The update operation for the result values (addition or subtraction assignment).
+// \return void
+//
+// This function distributes the block rows of the matrix among the available threads. Since
+// each block row contributes to a distinct row panel of the target matrix, the block rows can
+// be processed concurrently. In case the target matrix has less elements than specified by the
+// according SMP threshold the multiplication is executed serially.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the target matrix
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename OP >  // Type of the update operation
+inline void smpBlockMult( DenseMatrix<MT1,SO1>& C, const BlockCompressedMatrix<Type,B,false>& A,
+                          const DenseMatrix<MT2,SO2>& X, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()     , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~X).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~X).rows()    == A.columns()  , "Invalid number of rows"    );
+
+   const size_t N( (~X).columns() );
+
+   if( N == 0UL ) return;
+
+   const size_t threshold( ( SMP_SMATDMATMULT_THRESHOLD + B*N - 1UL ) / ( B*N ) );
+
+   smpBatch( A.blockRows(), 1UL, threshold,
+             BlockMultBatch<MT1,Type,B,MT2,OP>( ~C, A, ~X, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP assignment of the product of a row-major BlockCompressedMatrix and a dense matrix
+//        (\f$ C=A*X \f$).
+// \ingroup block_compressed_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side BlockCompressedMatrix.
+// \param X The right-hand side dense matrix.
+// \return void
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the target matrix
+        , typename Type  // Data type of the BlockCompressedMatrix
+        , size_t B       // Number of rows and columns of the blocks
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline void smpBlockMult( DenseMatrix<MT1,SO1>& C, const BlockCompressedMatrix<Type,B,false>& A,
+                          const DenseMatrix<MT2,SO2>& X, BlockAssign )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   reset( ~C );
+   smpBlockMult( ~C, A, ~X, BlockAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
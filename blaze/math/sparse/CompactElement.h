@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactElement.h
+//  \brief Header file for the CompactElement class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTELEMENT_H_
+#define _BLAZE_MATH_SPARSE_COMPACTELEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for a single element of a sparse matrix with split value/index storage.
+// \ingroup math
+//
+// The CompactElement class represents a single non-zero element of a sparse matrix that stores
+// its values and indices in two separate arrays (as for instance the CompactMatrix class
+// template). In contrast to ValueIndexPair, which represents an element stored as a unit, a
+// CompactElement merely refers to a value within the value array and to an index within the
+// index array. It provides the same \c value() and \c index() interface as any other sparse
+// element and thus can be used transparently in all sparse matrix operations. The first
+// template parameter \a Type specifies the type of the referenced value and may be \c const
+// qualified in order to provide read-only access, the second template parameter \a IT specifies
+// the type of the stored indices.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+class CompactElement : private SparseElement
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef RemoveConst_<Type>       ValueType;       //!< The value type of the element.
+   typedef size_t                   IndexType;       //!< The index type of the element.
+   typedef Type&                    Reference;       //!< Reference return type.
+   typedef const ValueType&         ConstReference;  //!< Reference-to-const return type.
+   typedef const CompactElement*    Pointer;         //!< Pointer return type.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompactElement( Type* value, const IT* index ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename T > inline const CompactElement& operator= ( const T& v ) const;
+   template< typename T > inline const CompactElement& operator+=( const T& v ) const;
+   template< typename T > inline const CompactElement& operator-=( const T& v ) const;
+   template< typename T > inline const CompactElement& operator*=( const T& v ) const;
+   template< typename T > inline const CompactElement& operator/=( const T& v ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline Pointer operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Reference value() const noexcept;
+   inline IndexType index() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*     value_;  //!< Pointer to the referenced value.
+   const IT* index_;  //!< Pointer to the referenced index.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompactElement class.
+//
+// \param value Pointer to the referenced value.
+// \param index Pointer to the referenced index.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+inline CompactElement<Type,IT>::CompactElement( Type* value, const IT* index ) noexcept
+   : value_( value )  // Pointer to the referenced value
+   , index_( index )  // Pointer to the referenced index
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment to the value of the compact element.
+//
+// \param v The new value of the compact element.
+// \return Reference to the assigned compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+template< typename T >   // Type of the right-hand side value
+inline const CompactElement<Type,IT>& CompactElement<Type,IT>::operator=( const T& v ) const
+{
+   *value_ = v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the value of the compact element.
+//
+// \param v The right-hand side value for the addition.
+// \return Reference to the assigned compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+template< typename T >   // Type of the right-hand side value
+inline const CompactElement<Type,IT>& CompactElement<Type,IT>::operator+=( const T& v ) const
+{
+   *value_ += v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the value of the compact element.
+//
+// \param v The right-hand side value for the subtraction.
+// \return Reference to the assigned compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+template< typename T >   // Type of the right-hand side value
+inline const CompactElement<Type,IT>& CompactElement<Type,IT>::operator-=( const T& v ) const
+{
+   *value_ -= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the value of the compact element.
+//
+// \param v The right-hand side value for the multiplication.
+// \return Reference to the assigned compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+template< typename T >   // Type of the right-hand side value
+inline const CompactElement<Type,IT>& CompactElement<Type,IT>::operator*=( const T& v ) const
+{
+   *value_ *= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the value of the compact element.
+//
+// \param v The right-hand side value for the division.
+// \return Reference to the assigned compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+template< typename T >   // Type of the right-hand side value
+inline const CompactElement<Type,IT>& CompactElement<Type,IT>::operator/=( const T& v ) const
+{
+   *value_ /= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the compact element.
+//
+// \return Pointer to the compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+inline typename CompactElement<Type,IT>::Pointer CompactElement<Type,IT>::operator->() const noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the current value of the compact element.
+//
+// \return Reference to the current value of the compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+inline typename CompactElement<Type,IT>::Reference CompactElement<Type,IT>::value() const noexcept
+{
+   return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the current index of the compact element.
+//
+// \return The current index of the compact element.
+*/
+template< typename Type  // Type of the referenced value
+        , typename IT >  // Type of the stored index
+inline typename CompactElement<Type,IT>::IndexType CompactElement<Type,IT>::index() const noexcept
+{
+   return *index_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,369 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactIterator.h
+//  \brief Header file for the CompactIterator class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTITERATOR_H_
+#define _BLAZE_MATH_SPARSE_COMPACTITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/CompactElement.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the non-zero elements of a sparse matrix with split value/index storage.
+// \ingroup math
+//
+// The CompactIterator class template represents a random access iterator over the non-zero
+// elements of a single row or column of a sparse matrix that stores its values and indices in
+// two separate arrays (as for instance the CompactMatrix class template). The iterator
+// traverses the value array and the index array in lockstep and on dereferencing returns a
+// CompactElement proxy, which provides access to the current value and index. In case the
+// given \a Type is \c const qualified, the iterator provides read-only access to the values.
+*/
+template< typename Type  // Type of the referenced values
+        , typename IT >  // Type of the stored indices
+class CompactIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef CompactElement<Type,IT>          ValueType;         //!< Type of the underlying elements.
+   typedef ValueType                        PointerType;       //!< Pointer return type.
+   typedef ValueType                        ReferenceType;     //!< Reference return type.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Default constructor*************************************************************************
+   /*!\brief Default constructor for the CompactIterator class.
+   */
+   inline CompactIterator() noexcept
+      : value_( nullptr )  // Pointer to the current value
+      , index_( nullptr )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the CompactIterator class.
+   //
+   // \param value Pointer to the initial value.
+   // \param index Pointer to the initial index.
+   */
+   inline CompactIterator( Type* value, const IT* index ) noexcept
+      : value_( value )  // Pointer to the current value
+      , index_( index )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Conversion constructor**********************************************************************
+   /*!\brief Conversion constructor from different CompactIterator instances.
+   //
+   // \param it The foreign CompactIterator instance to be copied.
+   */
+   template< typename Other >
+   inline CompactIterator( const CompactIterator<Other,IT>& it ) noexcept
+      : value_( it.value_ )  // Pointer to the current value
+      , index_( it.index_ )  // Pointer to the current index
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return Reference to the incremented iterator.
+   */
+   inline CompactIterator& operator+=( ptrdiff_t inc ) noexcept {
+      value_ += inc;
+      index_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return Reference to the decremented iterator.
+   */
+   inline CompactIterator& operator-=( ptrdiff_t dec ) noexcept {
+      value_ -= dec;
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline CompactIterator& operator++() noexcept {
+      ++value_;
+      ++index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const CompactIterator operator++( int ) noexcept {
+      const CompactIterator tmp( *this );
+      ++(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline CompactIterator& operator--() noexcept {
+      --value_;
+      --index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const CompactIterator operator--( int ) noexcept {
+      const CompactIterator tmp( *this );
+      --(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the sparse matrix element at the current iterator position.
+   //
+   // \return Proxy to the sparse matrix element at the current iterator position.
+   */
+   inline ReferenceType operator*() const noexcept {
+      return ReferenceType( value_, index_ );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the sparse matrix element at the current iterator position.
+   //
+   // \return Proxy to the sparse matrix element at the current iterator position.
+   */
+   inline PointerType operator->() const noexcept {
+      return PointerType( value_, index_ );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Direct access to the sparse matrix element at the given offset.
+   //
+   // \param offset The offset relative to the current iterator position.
+   // \return Proxy to the sparse matrix element at the given offset.
+   */
+   inline ReferenceType operator[]( ptrdiff_t offset ) const noexcept {
+      return ReferenceType( value_+offset, index_+offset );
+   }
+   //**********************************************************************************************
+
+   //**Base function*******************************************************************************
+   /*!\brief Access to the current position within the value array.
+   //
+   // \return Pointer to the current value.
+   */
+   inline Type* base() const noexcept {
+      return value_;
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two CompactIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator==( const CompactIterator<Other,IT>& rhs ) const noexcept {
+      return value_ == rhs.value_;
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two CompactIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   template< typename Other >
+   inline bool operator!=( const CompactIterator<Other,IT>& rhs ) const noexcept {
+      return value_ != rhs.value_;
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two CompactIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator<( const CompactIterator<Other,IT>& rhs ) const noexcept {
+      return value_ < rhs.value_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two CompactIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator>( const CompactIterator<Other,IT>& rhs ) const noexcept {
+      return value_ > rhs.value_;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two CompactIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator<=( const CompactIterator<Other,IT>& rhs ) const noexcept {
+      return value_ <= rhs.value_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two CompactIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   template< typename Other >
+   inline bool operator>=( const CompactIterator<Other,IT>& rhs ) const noexcept {
+      return value_ >= rhs.value_;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   template< typename Other >
+   inline DifferenceType operator-( const CompactIterator<Other,IT>& rhs ) const noexcept {
+      return value_ - rhs.value_;
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a CompactIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const CompactIterator operator+( const CompactIterator& it, size_t inc ) noexcept {
+      return CompactIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a CompactIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const CompactIterator operator+( size_t inc, const CompactIterator& it ) noexcept {
+      return CompactIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a CompactIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const CompactIterator operator-( const CompactIterator& it, size_t dec ) noexcept {
+      return CompactIterator( it.value_ - dec, it.index_ - dec );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*     value_;  //!< Pointer to the current value.
+   const IT* index_;  //!< Pointer to the current index.
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< typename Other, typename IT2 > friend class CompactIterator;
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
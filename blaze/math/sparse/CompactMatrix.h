@@ -0,0 +1,3482 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactMatrix.h
+//  \brief Implementation of a compact sparse matrix with split value/index storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPACTMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompactIterator.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Algorithm.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_matrix CompactMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Memory efficient implementation of a \f$ M \times N \f$ compressed sparse matrix.
+// \ingroup compact_matrix
+//
+// The CompactMatrix class template is an alternative to the CompressedMatrix class template,
+// which is tuned for the memory bandwidth bound sparse matrix/vector and sparse matrix/matrix
+// multiplications. The type of the elements, the storage order and the type of the stored
+// indices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CompactMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompactMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type used to store the column indices (row-major)
+//          or row indices (column-major) of the non-zero elements. The default is \c uint32_t.
+//
+// Whereas CompressedMatrix stores each non-zero element as a value/index pair with a full
+// \c size_t index (i.e. 16 bytes per \c double element including the padding), CompactMatrix
+// stores the values and the indices of the non-zero elements in two separate, contiguous arrays
+// and uses the (by default 32-bit) index type \a IT for the indices. The start and end of each
+// row (or column in case of a column-major matrix) are stored as offsets into these arrays. For
+// \c double elements this reduces the storage of each non-zero element from 16 to 12 bytes (and
+// for \c float elements from 16 to 8 bytes), which reduces the memory traffic of the sparse
+// kernels accordingly. The number of columns (row-major) or rows (column-major) of the matrix
+// is limited by the range of \a IT; the number of non-zero elements is not.
+//
+// CompactMatrix provides the same interface as CompressedMatrix and can be used in all sparse
+// matrix operations. In contrast to CompressedMatrix, the iterators of CompactMatrix return a
+// proxy object (CompactElement) on dereferencing instead of a reference to a value/index pair.
+// The following example gives an impression of the use of CompactMatrix:
+
+   \code
+   using blaze::CompactMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   CompactMatrix<double,rowMajor> A( 4, 3 );  // Row-major 4x3 compact matrix with 32-bit indices
+
+   A(1,2) = 2.0;             // Insertion via the function call operator
+   A.set( 2, 0, -1.2 );      // Insertion or modification via the set() function
+   A.insert( 2, 1, 3.7 );    // Insertion via the insert() function
+   A.reserve( 3, 2 );        // Reserving space for 2 non-zero elements in row 3
+   A.append( 3, 1, -2.1 );   // Appending the value -2.1 at column index 1 in row 3
+   A.append( 3, 2,  1.4 );   // Appending the value 1.4 at column index 2 in row 3
+
+   for( CompactMatrix<double,rowMajor>::Iterator it=A.begin(1); it!=A.end(1); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+
+   CompressedMatrix<double,rowMajor> B( A );  // Conversion to a compressed matrix
+   DynamicVector<double> x( 3UL, 1.0 );
+   DynamicVector<double> y( A * x );          // Sparse matrix/dense vector multiplication
+   \endcode
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = uint32_t >         // Index type
+class CompactMatrix : public SparseMatrix< CompactMatrix<Type,SO,IT>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompactMatrix<Type,SO,IT>       This;            //!< Type of this CompactMatrix instance.
+   typedef SparseMatrix<This,SO>           BaseType;        //!< Base type of this CompactMatrix instance.
+   typedef This                            ResultType;      //!< Result type for expression template evaluations.
+   typedef CompactMatrix<Type,!SO,IT>      OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompactMatrix<Type,!SO,IT>      TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                            ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                     ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                     CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>         Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                     ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef CompactIterator<Type,IT>        Iterator;        //!< Iterator over non-constant elements.
+   typedef CompactIterator<const Type,IT>  ConstIterator;   //!< Iterator over constant elements.
+   typedef IT                              IndexType;       //!< Type of the stored indices.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompactMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompactMatrix<ET,SO,IT>  Other;  //!< The type of the other CompactMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline CompactMatrix();
+                            explicit inline CompactMatrix( size_t m, size_t n );
+                            explicit inline CompactMatrix( size_t m, size_t n, size_t nonzeros );
+                            explicit        CompactMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                                     inline CompactMatrix( const CompactMatrix& sm );
+                                     inline CompactMatrix( CompactMatrix&& sm ) noexcept;
+   template< typename MT, bool SO2 > inline CompactMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompactMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompactMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompactMatrix& operator=( const CompactMatrix& rhs );
+   inline CompactMatrix& operator=( CompactMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompactMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, CompactMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, CompactMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t         rows() const noexcept;
+                              inline size_t         columns() const noexcept;
+                              inline size_t         capacity() const noexcept;
+                              inline size_t         capacity( size_t i ) const noexcept;
+                              inline size_t         nonZeros() const;
+                              inline size_t         nonZeros( size_t i ) const;
+                              inline void           reset();
+                              inline void           reset( size_t i );
+                              inline void           clear();
+                              inline Iterator       set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator       insert ( size_t i, size_t j, const Type& value );
+                              inline void           erase  ( size_t i, size_t j );
+                              inline Iterator       erase  ( size_t i, Iterator pos );
+                              inline Iterator       erase  ( size_t i, Iterator first, Iterator last );
+                                     void           resize ( size_t m, size_t n, bool preserve=true );
+                              inline void           reserve( size_t nonzeros );
+                                     void           reserve( size_t i, size_t nonzeros );
+                              inline void           trim   ();
+                              inline void           trim   ( size_t i );
+                              inline CompactMatrix& transpose();
+                              inline CompactMatrix& ctranspose();
+   template< typename Other > inline CompactMatrix& scale( const Other& scalar );
+   template< typename Other > inline CompactMatrix& scaleDiagonal( Other scalar );
+                              inline void           swap( CompactMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t        lines() const noexcept;
+   inline size_t        lineSize() const noexcept;
+   inline size_t        lowerBoundOffset( size_t i, size_t j ) const;
+   inline size_t        offset( ConstIterator pos ) const noexcept;
+   inline Iterator      iterator( size_t pos ) noexcept;
+   inline ConstIterator iterator( size_t pos ) const noexcept;
+          Iterator      insert( size_t pos, size_t i, size_t j, const Type& value );
+   inline size_t        extendCapacity() const noexcept;
+          void          reserveElements( size_t nonzeros );
+
+   static inline void checkIndexRange( size_t size );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  capacity_;  //!< The current capacity of the offset arrays.
+   size_t* begin_;     //!< Offsets of the first non-zero element of each row/column.
+   size_t* end_;       //!< Offsets one past the last non-zero element of each row/column.
+   Type*   values_;    //!< The values of the non-zero elements.
+   IT*     indices_;   //!< The column (row-major) or row (column-major) indices of the elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type CompactMatrix<Type,SO,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix()
+   : m_       ( 0UL )      // The current number of rows of the sparse matrix
+   , n_       ( 0UL )      // The current number of columns of the sparse matrix
+   , capacity_( 0UL )      // The current capacity of the offset arrays
+   , begin_   ( nullptr )  // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )  // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( size_t m, size_t n )
+   : m_       ( m )                   // The current number of rows of the sparse matrix
+   , n_       ( n )                   // The current number of columns of the sparse matrix
+   , capacity_( SO ? n : m )          // The current capacity of the offset arrays
+   , begin_   ( nullptr )             // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )             // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )             // The values of the non-zero elements
+   , indices_ ( nullptr )             // The indices of the non-zero elements
+{
+   checkIndexRange( lineSize() );
+
+   begin_ = new size_t[2UL*capacity_+2UL];
+   end_   = begin_+(capacity_+1UL);
+
+   for( size_t i=0UL; i<2UL*capacity_+2UL; ++i )
+      begin_[i] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have at least the capacity for
+// \a nonzeros non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( m )                   // The current number of rows of the sparse matrix
+   , n_       ( n )                   // The current number of columns of the sparse matrix
+   , capacity_( SO ? n : m )          // The current capacity of the offset arrays
+   , begin_   ( nullptr )             // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )             // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )             // The values of the non-zero elements
+   , indices_ ( nullptr )             // The indices of the non-zero elements
+{
+   checkIndexRange( lineSize() );
+
+   begin_ = new size_t[2UL*capacity_+2UL];
+   end_   = begin_+(capacity_+1UL);
+
+   for( size_t i=0UL; i<2UL*capacity_+1UL; ++i )
+      begin_[i] = 0UL;
+   end_[capacity_] = nonzeros;
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompactMatrix<Type,SO,IT>::CompactMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : m_       ( m )                   // The current number of rows of the sparse matrix
+   , n_       ( n )                   // The current number of columns of the sparse matrix
+   , capacity_( SO ? n : m )          // The current capacity of the offset arrays
+   , begin_   ( nullptr )             // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )             // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )             // The values of the non-zero elements
+   , indices_ ( nullptr )             // The indices of the non-zero elements
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == capacity_, "Size of capacity vector and number of rows/columns don't match" );
+
+   checkIndexRange( lineSize() );
+
+   begin_ = new size_t[2UL*capacity_+2UL];
+   end_   = begin_+(capacity_+1UL);
+
+   begin_[0UL] = end_[0UL] = 0UL;
+   for( size_t i=0UL; i<capacity_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+
+   values_  = allocate<Type>( end_[capacity_] );
+   indices_ = allocate<IT>( end_[capacity_] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompactMatrix.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( const CompactMatrix& sm )
+   : m_       ( sm.m_ )                            // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                            // The current number of columns of the sparse matrix
+   , capacity_( sm.lines() )                       // The current capacity of the offset arrays
+   , begin_   ( new size_t[2UL*capacity_+2UL] )    // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(capacity_+1UL) )           // Offsets one past the last non-zero element of each row/column
+   , values_  ( allocate<Type>( sm.nonZeros() ) )  // The values of the non-zero elements
+   , indices_ ( allocate<IT>( sm.nonZeros() ) )    // The indices of the non-zero elements
+{
+   begin_[0UL] = 0UL;
+
+   for( size_t i=0UL; i<capacity_; ++i ) {
+      std::copy( sm.values_+sm.begin_[i], sm.values_+sm.end_[i], values_+begin_[i] );
+      std::copy( sm.indices_+sm.begin_[i], sm.indices_+sm.end_[i], indices_+begin_[i] );
+      begin_[i+1UL] = end_[i] = begin_[i] + sm.nonZeros( i );
+   }
+
+   end_[capacity_] = begin_[capacity_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for CompactMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( CompactMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )         // The current number of columns of the sparse matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the offset arrays
+   , begin_   ( sm.begin_ )     // Offsets of the first non-zero element of each row/column
+   , end_     ( sm.end_ )       // Offsets one past the last non-zero element of each row/column
+   , values_  ( sm.values_ )    // The values of the non-zero elements
+   , indices_ ( sm.indices_ )   // The indices of the non-zero elements
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = nullptr;
+   sm.end_      = nullptr;
+   sm.values_   = nullptr;
+   sm.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( const DenseMatrix<MT,SO2>& dm )
+   : CompactMatrix( (~dm).rows(), (~dm).columns() )
+{
+   smpAssign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline CompactMatrix<Type,SO,IT>::CompactMatrix( const SparseMatrix<MT,SO2>& sm )
+   : CompactMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+{
+   smpAssign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompactMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>::~CompactMatrix()
+{
+   delete[] begin_;
+   deallocate( values_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case
+// the compact matrix does not yet store an element at position (\a i,\a j), a new element is
+// inserted into the compact matrix. Note that this function only performs an index check in
+// case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform
+// a check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Reference
+   CompactMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstReference
+   CompactMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos == end_[line] || indices_[pos] != index )
+      return zero_;
+   else
+      return values_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Reference
+   CompactMatrix<Type,SO,IT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstReference
+   CompactMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor the
+// function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompactMatrix.
+//
+// \param rhs Compact matrix to be copied.
+// \return Reference to the assigned compact matrix.
+//
+// The compact matrix is resized according to the given compact matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( const CompactMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   const size_t lines   ( rhs.lines() );
+   const size_t nonzeros( rhs.nonZeros() );
+
+   if( begin_ == nullptr || lines > capacity_ || nonzeros > capacity() )
+   {
+      CompactMatrix tmp( rhs );
+      swap( tmp );
+   }
+   else
+   {
+      const size_t last( end_[this->lines()] );
+
+      for( size_t i=0UL; i<lines; ++i ) {
+         std::copy( rhs.values_+rhs.begin_[i], rhs.values_+rhs.end_[i], values_+begin_[i] );
+         std::copy( rhs.indices_+rhs.begin_[i], rhs.indices_+rhs.end_[i], indices_+begin_[i] );
+         begin_[i+1UL] = end_[i] = begin_[i] + rhs.nonZeros( i );
+      }
+
+      end_[lines] = last;
+
+      m_ = rhs.m_;
+      n_ = rhs.n_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for CompactMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( CompactMatrix&& rhs ) noexcept
+{
+   delete[] begin_;
+   deallocate( values_ );
+   deallocate( indices_ );
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = nullptr;
+   rhs.end_      = nullptr;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).canAlias( this ) ) {
+      CompactMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).canAlias( this ) ||
+       ( SO ? (~rhs).columns() : (~rhs).rows() ) > capacity_ ||
+       (~rhs).nonZeros() > capacity() ) {
+      CompactMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   addAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   subAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current number of columns of this matrix doesn't match the number of rows of
+// the given matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactMatrix<Type,SO,IT>&
+   CompactMatrix<Type,SO,IT>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompactMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, CompactMatrix<Type,SO,IT> >&
+   CompactMatrix<Type,SO,IT>::operator*=( Other rhs )
+{
+   const size_t lines( this->lines() );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, CompactMatrix<Type,SO,IT> >&
+   CompactMatrix<Type,SO,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef DivTrait_<Type,Other>            DT;
+   typedef If_< IsNumeric<DT>, DT, Other >  Tmp;
+
+   const size_t lines( this->lines() );
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t i=0UL; i<lines; ++i ) {
+         for( size_t k=begin_[i]; k<end_[i]; ++k )
+            values_[k] *= tmp;
+      }
+   }
+   else {
+      for( size_t i=0UL; i<lines; ++i ) {
+         for( size_t k=begin_[i]; k<end_[i]; ++k )
+            values_[k] /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::capacity() const noexcept
+{
+   if( begin_ != nullptr )
+      return end_[lines()] - begin_[0UL];
+   else return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::nonZeros() const
+{
+   const size_t lines( this->lines() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<lines; ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::reset()
+{
+   const size_t lines( this->lines() );
+
+   for( size_t i=0UL; i<lines; ++i )
+      end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be reset.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::clear()
+{
+   if( begin_ != nullptr )
+      end_[0UL] = end_[lines()];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compact matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compact matrix. In case the sparse matrix
+// already contains an element with row index \a i and column index \a j its value is modified,
+// else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos != end_[line] && indices_[pos] == index ) {
+      values_[pos] = value;
+      return iterator( pos );
+   }
+   else return insert( pos, line, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compact matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compact matrix access index.
+//
+// This function inserts a new element into the compact matrix. However, duplicate elements are
+// not allowed. In case the sparse matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos != end_[line] && indices_[pos] == index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, line, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compact matrix.
+//
+// \param pos The offset of the new element within the value and index arrays.
+// \param i The row/column index of the new element.
+// \param j The column/row index of the new element.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::insert( size_t pos, size_t i, size_t j, const Type& value )
+{
+   const size_t lines( this->lines() );
+
+   if( begin_[i+1UL] - end_[i] != 0UL ) {
+      std::move_backward( values_+pos, values_+end_[i], values_+end_[i]+1UL );
+      std::copy_backward( indices_+pos, indices_+end_[i], indices_+end_[i]+1UL );
+      values_ [pos] = value;
+      indices_[pos] = j;
+      ++end_[i];
+
+      return iterator( pos );
+   }
+   else if( end_[lines] - begin_[lines] != 0UL ) {
+      std::move_backward( values_+pos, values_+end_[lines-1UL], values_+end_[lines-1UL]+1UL );
+      std::copy_backward( indices_+pos, indices_+end_[lines-1UL], indices_+end_[lines-1UL]+1UL );
+      values_ [pos] = value;
+      indices_[pos] = j;
+
+      for( size_t k=i+1UL; k<lines+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+
+      return iterator( pos );
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      transfer( values_, values_+pos, newValues );
+      std::copy( indices_, indices_+pos, newIndices );
+      newValues [pos] = value;
+      newIndices[pos] = j;
+      transfer( values_+pos, values_+end_[lines-1UL], newValues+pos+1UL );
+      std::copy( indices_+pos, indices_+end_[lines-1UL], newIndices+pos+1UL );
+
+      for( size_t k=i+1UL; k<lines+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+      end_[lines] = newCapacity;
+
+      std::swap( values_ , newValues  );
+      std::swap( indices_, newIndices );
+      deallocate( newValues  );
+      deallocate( newIndices );
+
+      return iterator( pos );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos != end_[line] && indices_[pos] == index ) {
+      std::move( values_+pos+1UL, values_+end_[line], values_+pos );
+      std::copy( indices_+pos+1UL, indices_+end_[line], indices_+pos );
+      --end_[line];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the sparse matrix. In case the storage order is set to
+// \a rowMajor the function erases an element from row \a i, in case the storage flag is set to
+// \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   const size_t k( offset( pos ) );
+
+   BLAZE_USER_ASSERT( k >= begin_[i] && k <= end_[i], "Invalid compact matrix iterator" );
+
+   if( k != end_[i] ) {
+      std::move( values_+k+1UL, values_+end_[i], values_+k );
+      std::copy( indices_+k+1UL, indices_+end_[i], indices_+k );
+      --end_[i];
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the sparse matrix. In case the storage order
+// is set to \a rowMajor the function erases a range of elements from row \a i, in case the
+// storage flag is set to \a columnMajor the function erases a range of elements from column
+// \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+
+   const size_t k1( offset( first ) );
+   const size_t k2( offset( last  ) );
+
+   BLAZE_USER_ASSERT( k1 >= begin_[i] && k1 <= end_[i], "Invalid compact matrix iterator" );
+   BLAZE_USER_ASSERT( k2 >= begin_[i] && k2 <= end_[i], "Invalid compact matrix iterator" );
+
+   if( k1 != k2 ) {
+      std::move( values_+k2, values_+end_[i], values_+k1 );
+      std::copy( indices_+k2, indices_+end_[i], indices_+k1 );
+      end_[i] -= k2 - k1;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompactMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   if( m == m_ && n == n_ ) return;
+
+   checkIndexRange( SO ? m : n );
+
+   const size_t oldLines( lines() );
+   const size_t newLines( SO ? n : m );
+   const size_t newSize ( SO ? m : n );
+
+   if( begin_ == nullptr )
+   {
+      begin_ = new size_t[2UL*newLines+2UL];
+      end_   = begin_+newLines+1UL;
+
+      for( size_t i=0UL; i<2UL*newLines+2UL; ++i ) {
+         begin_[i] = 0UL;
+      }
+
+      capacity_ = newLines;
+   }
+   else
+   {
+      if( preserve && newSize < lineSize() ) {
+         for( size_t i=0UL; i<min( oldLines, newLines ); ++i )
+            end_[i] = lowerBoundOffset( i, newSize );
+      }
+
+      if( newLines > capacity_ )
+      {
+         size_t* newBegin( new size_t[2UL*newLines+2UL] );
+         size_t* newEnd  ( newBegin+newLines+1UL );
+
+         newBegin[0UL] = begin_[0UL];
+
+         if( preserve ) {
+            for( size_t i=0UL; i<oldLines; ++i ) {
+               newEnd  [i]     = end_  [i];
+               newBegin[i+1UL] = begin_[i+1UL];
+            }
+            for( size_t i=oldLines; i<newLines; ++i ) {
+               newBegin[i+1UL] = newEnd[i] = begin_[oldLines];
+            }
+         }
+         else {
+            for( size_t i=0UL; i<newLines; ++i ) {
+               newBegin[i+1UL] = newEnd[i] = begin_[0UL];
+            }
+         }
+
+         newEnd[newLines] = end_[oldLines];
+
+         std::swap( newBegin, begin_ );
+         delete[] newBegin;
+         end_ = newEnd;
+         capacity_ = newLines;
+      }
+      else if( newLines > oldLines )
+      {
+         end_[newLines] = end_[oldLines];
+
+         if( !preserve ) {
+            for( size_t i=0UL; i<oldLines; ++i )
+               end_[i] = begin_[i];
+         }
+
+         for( size_t i=oldLines; i<newLines; ++i ) {
+            begin_[i+1UL] = end_[i] = begin_[oldLines];
+         }
+      }
+      else
+      {
+         if( !preserve ) {
+            for( size_t i=0UL; i<newLines; ++i )
+               end_[i] = begin_[i];
+         }
+
+         end_[newLines] = end_[oldLines];
+      }
+   }
+
+   m_ = m;
+   n_ = n;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the sparse matrix to at least
+// \a nonzeros elements. The current values of the sparse matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i and the index has to be in the range \f$[0..M-1]\f$.
+// In case the storage order is set to \a columnMajor, the function reserves capacity for column
+// \a i and the index has to be in the range \f$[0..N-1]\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompactMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   const size_t lines( this->lines() );
+
+   BLAZE_USER_ASSERT( i < lines, "Invalid row/column access index" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( end_[lines] - begin_[lines] < additional )
+   {
+      const size_t newCapacity( begin_[lines] - begin_[0UL] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      size_t* newBegin  ( new size_t[2UL*lines+2UL] );
+      size_t* newEnd    ( newBegin+lines+1UL );
+      Type*   newValues ( allocate<Type>( newCapacity ) );
+      IT*     newIndices( allocate<IT>( newCapacity ) );
+
+      newBegin[0UL] = 0UL;
+      newEnd[lines] = newCapacity;
+
+      for( size_t k=0UL; k<lines; ++k ) {
+         transfer( values_+begin_[k], values_+end_[k], newValues+newBegin[k] );
+         std::copy( indices_+begin_[k], indices_+end_[k], newIndices+newBegin[k] );
+         newEnd  [k    ] = newBegin[k] + nonZeros(k);
+         newBegin[k+1UL] = newBegin[k] + ( k == i ? nonzeros : capacity(k) );
+      }
+
+      BLAZE_INTERNAL_ASSERT( newBegin[lines] == newEnd[lines], "Invalid offset calculations" );
+
+      std::swap( newBegin  , begin_   );
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      delete[] newBegin;
+      deallocate( newValues  );
+      deallocate( newIndices );
+      end_ = newEnd;
+      capacity_ = lines;
+   }
+   else
+   {
+      begin_[lines] += additional;
+      for( size_t j=lines-1UL; j>i; --j ) {
+         std::move_backward( values_+begin_[j], values_+end_[j], values_+end_[j]+additional );
+         std::copy_backward( indices_+begin_[j], indices_+end_[j], indices_+end_[j]+additional );
+         begin_[j] += additional;
+         end_  [j] += additional;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column. After a call
+// to trim() the offsets of all rows/columns form a plain row/column pointer array as used
+// by the classic compressed row storage (CRS) format.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::trim()
+{
+   const size_t lines( this->lines() );
+
+   for( size_t i=0UL; i<lines; ++i )
+      trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row (in case of a rowMajor matrix)
+// or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
+// subsequent row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::trim( size_t i )
+{
+   const size_t lines( this->lines() );
+
+   BLAZE_USER_ASSERT( i < lines, "Invalid row/column access index" );
+
+   if( i < ( lines - 1UL ) ) {
+      const size_t nonzeros( nonZeros( i+1UL ) );
+      std::move( values_+begin_[i+1UL], values_+end_[i+1UL], values_+end_[i] );
+      std::copy( indices_+begin_[i+1UL], indices_+end_[i+1UL], indices_+end_[i] );
+      end_[i+1UL] = end_[i] + nonzeros;
+   }
+   begin_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::transpose()
+{
+   CompactMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::ctranspose()
+{
+   CompactMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::scale( const Other& scalar )
+{
+   const size_t lines( this->lines() );
+
+   for( size_t i=0UL; i<lines; ++i )
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the sparse matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompactMatrix<Type,SO,IT>& CompactMatrix<Type,SO,IT>::scaleDiagonal( Other scalar )
+{
+   const size_t size( blaze::min( m_, n_ ) );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      const size_t pos( lowerBoundOffset( i, i ) );
+      if( pos != end_[i] && indices_[pos] == i )
+         values_[pos] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::swap( CompactMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_  , sm.begin_   );
+   std::swap( end_    , sm.end_     );
+   std::swap( values_ , sm.values_  );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::lines() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns (row-major) or rows (column-major) of the matrix.
+//
+// \return The number of columns/rows of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::lineSize() const noexcept
+{
+   return ( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row/column \a i with an index not less
+//        than \a j.
+//
+// \param i The row/column index.
+// \param j The column/row index of the search element.
+// \return Offset of the first element with an index not less than \a j.
+//
+// The binary search is performed on the contiguous index array only, which keeps the search
+// within the minimum number of cache lines.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::lowerBoundOffset( size_t i, size_t j ) const
+{
+   return std::lower_bound( indices_+begin_[i], indices_+end_[i], j ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the element referred to by the given iterator.
+//
+// \param pos Iterator to an element of the matrix.
+// \return Offset of the element within the value and index arrays.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::offset( ConstIterator pos ) const noexcept
+{
+   return pos.base() - values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given offset.
+//
+// \param pos Offset within the value and index arrays.
+// \return Iterator to the element at the given offset.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::iterator( size_t pos ) noexcept
+{
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given offset.
+//
+// \param pos Offset within the value and index arrays.
+// \return Iterator to the element at the given offset.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::iterator( size_t pos ) const noexcept
+{
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new compact matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompactMatrix<Type,SO,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of sparse matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompactMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
+{
+   const size_t lines( this->lines() );
+
+   size_t* newBegin  ( new size_t[2UL*capacity_+2UL] );
+   size_t* newEnd    ( newBegin+capacity_+1UL );
+   Type*   newValues ( allocate<Type>( nonzeros ) );
+   IT*     newIndices( allocate<IT>( nonzeros ) );
+
+   newBegin[0UL] = 0UL;
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row/column offsets" );
+      transfer( values_+begin_[k], values_+end_[k], newValues+newBegin[k] );
+      std::copy( indices_+begin_[k], indices_+end_[k], newIndices+newBegin[k] );
+      newEnd  [k]     = newBegin[k] + ( end_[k] - begin_[k] );
+      newBegin[k+1UL] = newBegin[k] + ( begin_[k+1UL] - begin_[k] );
+   }
+
+   newEnd[lines] = nonzeros;
+
+   std::swap( newBegin  , begin_   );
+   std::swap( newValues , values_  );
+   std::swap( newIndices, indices_ );
+   end_ = newEnd;
+
+   delete[] newBegin;
+   deallocate( newValues  );
+   deallocate( newIndices );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given number of columns/rows fits into the index type.
+//
+// \param size The number of columns (row-major) or rows (column-major) of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::checkIndexRange( size_t size )
+{
+   if( size > 0UL && size-1UL > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix size exceeds the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned compact matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos != end_[line] && indices_[pos] == index )
+      return iterator( pos );
+   else return iterator( end_[line] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos != end_[line] && indices_[pos] == index )
+      return iterator( pos );
+   else return iterator( end_[line] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element
+// with an index not less then the given column index. In case of a column-major matrix, the
+// function returns a column iterator to the first element with an index not less then the
+// given row index. In combination with the upperBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < lines(), "Invalid row/column access index" );
+   return iterator( lowerBoundOffset( SO ? j : i, SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < lines(), "Invalid row/column access index" );
+   return iterator( lowerBoundOffset( SO ? j : i, SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element
+// with an index greater then the given column index. In case of a column-major matrix, the
+// function returns a column iterator to the first element with an index greater then the
+// given row index. In combination with the lowerBound() function this function can be used
+// to create a pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::Iterator
+   CompactMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   BLAZE_USER_ASSERT( line < lines(), "Invalid row/column access index" );
+
+   return iterator( std::upper_bound( indices_+begin_[line], indices_+end_[line], index ) - indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompactMatrix<Type,SO,IT>::ConstIterator
+   CompactMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   BLAZE_USER_ASSERT( line < lines(), "Invalid row/column access index" );
+
+   return iterator( std::upper_bound( indices_+begin_[line], indices_+end_[line], index ) - indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compact matrix with elements. It
+// appends a new element to the end of the specified row/column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested. As in case of CompressedMatrix, the
+// combination of reserve(), append() and finalize() is the most efficient way to fill a
+// (newly created) compact matrix.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   BLAZE_USER_ASSERT( end_[line] < end_[lines()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[line] == end_[line] || index > indices_[end_[line]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[line]] = value;
+
+   if( !check || !isDefault( values_[end_[line]] ) ) {
+      indices_[end_[line]] = index;
+      ++end_[line];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called to
+// finalize row/column \a i and prepare the next row/column for insertion process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompactMatrix<Type,SO,IT>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != lines()-1UL )
+      end_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompactMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   if( m_ == 0UL || n_ == 0UL )
+      return;
+
+   const size_t lines( this->lines() );
+   const size_t size ( lineSize() );
+
+   const bool upper      ( SO ? IsLower<MT>::value : IsUpper<MT>::value );
+   const bool lower      ( SO ? IsUpper<MT>::value : IsLower<MT>::value );
+   const bool strictUpper( SO ? IsStrictlyLower<MT>::value : IsStrictlyUpper<MT>::value );
+   const bool strictLower( SO ? IsStrictlyUpper<MT>::value : IsStrictlyLower<MT>::value );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=1UL; i<=lines; ++i )
+      begin_[i] = end_[i] = end_[lines];
+
+   for( size_t i=0UL; i<lines; ++i )
+   {
+      begin_[i] = end_[i] = nonzeros;
+
+      const size_t jbegin( upper ? ( strictUpper ? i+1UL : i ) : 0UL );
+      const size_t jend  ( lower ? ( strictLower ? i : i+1UL ) : size );
+
+      for( size_t j=jbegin; j<jend; ++j )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+            for( size_t k=i+1UL; k<=lines; ++k )
+               begin_[k] = end_[k] = end_[lines];
+         }
+
+         values_[end_[i]] = ( SO ? (~rhs)(j,i) : (~rhs)(i,j) );
+
+         if( !isDefault( values_[end_[i]] ) ) {
+            indices_[end_[i]] = j;
+            ++end_[i];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[lines] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompactMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef ConstIterator_<MT>  RhsIterator;
+
+   const size_t lines( this->lines() );
+
+   if( lines == 0UL || values_ == nullptr )
+      return;
+
+   size_t pos( 0UL );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element, ++pos ) {
+         values_ [pos] = element->value();
+         indices_[pos] = element->index();
+      }
+      begin_[i+1UL] = end_[i] = pos;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompactMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef ConstIterator_<MT>  RhsIterator;
+
+   const size_t lines( this->lines() );
+   const size_t size ( lineSize() );
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lineLengths( lines, 0UL );
+   for( size_t j=0UL; j<size; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         ++lineLengths[element->index()];
+   }
+
+   // Resizing the sparse matrix
+   for( size_t i=0UL; i<lines; ++i ) {
+      end_[i] = begin_[i];
+      begin_[i+1UL] = begin_[i] + lineLengths[i];
+   }
+
+   // Appending the elements to the rows/columns of the sparse matrix
+   for( size_t j=0UL; j<size; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+         const size_t i( element->index() );
+         values_ [end_[i]] = element->value();
+         indices_[end_[i]] = j;
+         ++end_[i];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompactMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompactMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand sparse matrix
+inline void CompactMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompactMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+inline void reset( CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void reset( CompactMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+inline void clear( CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isIntact( const CompactMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void swap( CompactMatrix<Type,SO,IT>& a, CompactMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compact matrix.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompactMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compact matrix.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given compact matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompactMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compact matrix.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompactMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compact matrix is in default state.
+// \ingroup compact_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compact matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompactMatrix<int> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompactMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compact matrix are intact.
+// \ingroup compact_matrix
+//
+// \param m The compact matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compact matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::CompactMatrix<int> A;
+   // ... Resizing and initialization
+   if( isIntact( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isIntact( const CompactMatrix<Type,SO,IT>& m )
+{
+   return ( m.nonZeros() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compact matrices.
+// \ingroup compact_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompactMatrix<Type,SO,IT>& a, CompactMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompactMatrix<T,SO,IT> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, typename IT >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompactMatrix< AddTrait_<T1,T2>, SO, IT >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompactMatrix< AddTrait_<T1,T2>, false, IT >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO,IT>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompactMatrix<T1,SO1,IT>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, typename IT >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompactMatrix< SubTrait_<T1,T2>, SO, IT >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompactMatrix< SubTrait_<T1,T2>, false, IT >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO,IT>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompactMatrix<T1,SO1,IT>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompactMatrix< MultTrait_<T1,T2>, SO, IT >;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< T1, CompactMatrix<T2,SO,IT>, EnableIf_< IsNumeric<T1> > >
+{
+   using Type = CompactMatrix< MultTrait_<T1,T2>, SO, IT >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, StaticVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, HybridVector<T2,N,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, DynamicVector<T2,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< DynamicVector<T1,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, CustomVector<T2,AF,PF,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, typename T2, bool SO, typename IT >
+struct MultTrait< CustomVector<T1,AF,PF,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO,IT>, CompressedVector<T2,false> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< CompressedVector<T1,true>, CompactMatrix<T2,SO,IT> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CustomMatrix<T1,AF,PF,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompactMatrix< MultTrait_<T1,T2>, SO1, IT >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompactMatrix<T1,SO1,IT>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1>, CompactMatrix<T2,SO2,IT> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT >
+struct DivTrait< CompactMatrix<T1,SO,IT>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompactMatrix< DivTrait_<T1,T2>, SO, IT >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT >
+struct MathTrait< CompactMatrix<T1,SO,IT>, CompactMatrix<T2,SO,IT> >
+{
+   using HighType = CompactMatrix< typename MathTrait<T1,T2>::HighType, SO, IT >;
+   using LowType  = CompactMatrix< typename MathTrait<T1,T2>::LowType , SO, IT >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct SubmatrixTrait< CompactMatrix<T1,SO,IT> >
+{
+   using Type = CompactMatrix<T1,SO,IT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct RowTrait< CompactMatrix<T1,SO,IT> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct ColumnTrait< CompactMatrix<T1,SO,IT> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -606,12 +606,10 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = nullptr;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 //*************************************************************************************************
 
@@ -632,16 +630,20 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
-   const size_t nonzeros( (~sm).nonZeros() );
+   if( isParallelSMPAssign( *this, ~sm ) ) {
+      for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+         begin_[i] = nullptr;
+   }
+   else {
+      const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
-   for( size_t i=0UL; i<m_; ++i )
-      begin_[i+1UL] = end_[i] = begin_[0UL];
-   end_[m_] = begin_[0UL]+nonzeros;
+      begin_[0UL] = allocate<Element>( nonzeros );
+      for( size_t i=0UL; i<m_; ++i )
+         begin_[i+1UL] = end_[i] = begin_[0UL];
+      end_[m_] = begin_[0UL]+nonzeros;
+   }
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -1028,15 +1030,13 @@ template< typename MT    // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1060,8 +1060,6 @@ template< typename MT    // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -1071,7 +1069,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3012,12 +3010,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = nullptr;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3039,16 +3035,20 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
-   const size_t nonzeros( (~sm).nonZeros() );
+   if( isParallelSMPAssign( *this, ~sm ) ) {
+      for( size_t j=0UL; j<2UL*n_+2UL; ++j )
+         begin_[j] = nullptr;
+   }
+   else {
+      const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
-   for( size_t j=0UL; j<n_; ++j )
-      begin_[j+1UL] = end_[j] = begin_[0UL];
-   end_[n_] = begin_[0UL]+nonzeros;
+      begin_[0UL] = allocate<Element>( nonzeros );
+      for( size_t j=0UL; j<n_; ++j )
+         begin_[j+1UL] = end_[j] = begin_[0UL];
+      end_[n_] = begin_[0UL]+nonzeros;
+   }
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3419,15 +3419,13 @@ template< typename MT      // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3452,8 +3450,6 @@ template< typename MT      // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3463,7 +3459,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -518,8 +518,7 @@ inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv
    , begin_   ( nullptr )       // Pointer to the first non-zero element of the compressed vector
    , end_     ( nullptr )       // Pointer to the last non-zero element of the compressed vector
 {
-   using blaze::assign;
-   assign( *this, ~dv );
+   smpAssign( *this, ~dv );
 }
 //*************************************************************************************************
 
@@ -533,13 +532,18 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
-   : size_    ( (~sv).size() )                    // The current size/dimension of the compressed vector
-   , capacity_( (~sv).nonZeros() )                // The maximum capacity of the compressed vector
-   , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
+   : size_    ( (~sv).size() )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL )           // The maximum capacity of the compressed vector
+   , begin_   ( nullptr )       // Pointer to the first non-zero element of the compressed vector
+   , end_     ( nullptr )       // Pointer to the last non-zero element of the compressed vector
 {
-   using blaze::assign;
-   assign( *this, ~sv );
+   if( !isParallelSMPAssign( *this, ~sv ) ) {
+      capacity_ = (~sv).nonZeros();
+      begin_    = allocate<Element>( capacity_ );
+      end_      = begin_;
+   }
+
+   smpAssign( *this, ~sv );
 }
 //*************************************************************************************************
 
@@ -844,8 +848,6 @@ template< typename VT >  // Type of the right-hand side dense vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -853,7 +855,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -876,8 +878,6 @@ template< typename VT >  // Type of the right-hand side sparse vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -885,7 +885,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
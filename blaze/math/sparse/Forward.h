@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,6 +51,10 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, size_t, bool > class BlockCompressedMatrix;
+template< typename, bool, typename > class CompactMatrix;
+template< typename, bool, typename > class MappedCompressedMatrix;
+template< typename, typename > class SellMatrix;
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
 
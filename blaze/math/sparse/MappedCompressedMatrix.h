@@ -0,0 +1,908 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MappedCompressedMatrix.h
+//  \brief Implementation of a read-only compressed sparse matrix on external memory
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MAPPEDCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_MAPPEDCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/sparse/CompactIterator.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_compressed_matrix MappedCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only \f$ M \times N \f$ compressed sparse matrix on external memory.
+// \ingroup mapped_compressed_matrix
+//
+// The MappedCompressedMatrix class template represents a read-only sparse matrix, whose non-zero
+// elements are stored in external memory, as for instance in a memory mapped file (see the
+// loadMapped() functions). The type of the elements, the storage order and the type of the
+// stored indices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class MappedCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedCompressedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type of the stored column indices (row-major) or row
+//          indices (column-major) of the non-zero elements. The default is \c uint32_t.
+//
+// The layout of the external memory is the same as the layout of a CompactMatrix: The values
+// and the indices of the non-zero elements are stored in two separate, contiguous arrays and
+// the \f$ i \f$-th row (or column in case of a column-major matrix) is given by the range
+// \f$ [offsets[i]..offsets[i+1]) \f$ of these arrays. The MappedCompressedMatrix does not copy
+// any of the three arrays, but only refers to them. The lifetime of the external memory can be
+// bound to the lifetime of the matrix (and of all its copies) by means of a shared owner object:
+
+   \code
+   using blaze::MappedCompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   MappedCompressedMatrix<double,rowMajor> A;
+   loadMapped( "matrix.blzm", A );  // Zero-copy mapping of a sparse matrix file
+
+   DynamicVector<double> x( A.columns(), 1.0 );
+   DynamicVector<double> y( A * x );  // Sparse matrix/dense vector multiplication
+   \endcode
+
+// MappedCompressedMatrix can be used on the right-hand side of all sparse matrix operations. Since
+// the matrix is read-only it cannot be assigned to or modified, though. Its result type is the
+// according CompressedMatrix, i.e. the evaluation of the matrix (e.g. for the purpose of a
+// modification) results in a CompressedMatrix.
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = uint32_t >         // Index type
+class MappedCompressedMatrix : public SparseMatrix< MappedCompressedMatrix<Type,SO,IT>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedCompressedMatrix<Type,SO,IT>  This;            //!< Type of this MappedCompressedMatrix instance.
+   typedef SparseMatrix<This,SO>               BaseType;        //!< Base type of this MappedCompressedMatrix instance.
+   typedef CompressedMatrix<Type,SO>           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>          OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>          TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                         ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                         Reference;       //!< Reference to a constant sparse matrix value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef CompactIterator<const Type,IT>      Iterator;        //!< Iterator over constant elements.
+   typedef CompactIterator<const Type,IT>      ConstIterator;   //!< Iterator over constant elements.
+   typedef IT                                  IndexType;       //!< Type of the stored indices.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedCompressedMatrix() noexcept;
+   explicit inline MappedCompressedMatrix( size_t m, size_t n, const size_t* offsets,
+                                           const IT* indices, const Type* values,
+                                           std::shared_ptr<const void> owner = nullptr ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   swap( MappedCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t lines() const noexcept;
+   inline size_t lowerBoundOffset( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t        m_;        //!< The number of rows of the sparse matrix.
+   size_t        n_;        //!< The number of columns of the sparse matrix.
+   const size_t* offsets_;  //!< Offsets of the first non-zero element of each row/column.
+   const IT*     indices_;  //!< The column (row-major) or row (column-major) indices of the elements.
+   const Type*   values_;   //!< The values of the non-zero elements.
+
+   std::shared_ptr<const void> owner_;  //!< Owner of the external memory.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type MappedCompressedMatrix<Type,SO,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MappedCompressedMatrix.
+//
+// The default constructor creates an empty \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline MappedCompressedMatrix<Type,SO,IT>::MappedCompressedMatrix() noexcept
+   : m_      ( 0UL )      // The number of rows of the sparse matrix
+   , n_      ( 0UL )      // The number of columns of the sparse matrix
+   , offsets_( nullptr )  // Offsets of the first non-zero element of each row/column
+   , indices_( nullptr )  // The indices of the non-zero elements
+   , values_ ( nullptr )  // The values of the non-zero elements
+   , owner_  ()           // Owner of the external memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ M \times N \f$ matrix on the given external memory.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param offsets The array of \f$ M+1 \f$ (row-major) or \f$ N+1 \f$ (column-major) offsets.
+// \param indices The array of column (row-major) or row (column-major) indices.
+// \param values The array of values of the non-zero elements.
+// \param owner The optional owner of the external memory.
+//
+// This constructor creates a sparse matrix on the given external arrays. The arrays are neither
+// copied nor released by the matrix; in case an owner is given, the matrix and all its copies
+// share the ownership of this object. The offsets have to be non-decreasing and the indices
+// within each row (or column) have to be strictly increasing.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline MappedCompressedMatrix<Type,SO,IT>::MappedCompressedMatrix( size_t m, size_t n,
+                                                                   const size_t* offsets,
+                                                                   const IT* indices,
+                                                                   const Type* values,
+                                                                   std::shared_ptr<const void> owner ) noexcept
+   : m_      ( m )                   // The number of rows of the sparse matrix
+   , n_      ( n )                   // The number of columns of the sparse matrix
+   , offsets_( offsets )             // Offsets of the first non-zero element of each row/column
+   , indices_( indices )             // The indices of the non-zero elements
+   , values_ ( values )              // The values of the non-zero elements
+   , owner_  ( std::move( owner ) )  // Owner of the external memory
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstReference
+   MappedCompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos == offsets_[line+1UL] || indices_[pos] != index )
+      return zero_;
+   else
+      return values_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstReference
+   MappedCompressedMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+offsets_[i], indices_+offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor the
+// function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+offsets_[i+1UL], indices_+offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// Since the matrix is read-only, the capacity is equal to the number of non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::nonZeros() const noexcept
+{
+   return ( offsets_ != nullptr ) ? ( offsets_[lines()] - offsets_[0UL] ) : 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void MappedCompressedMatrix<Type,SO,IT>::swap( MappedCompressedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( indices_, sm.indices_ );
+   std::swap( values_, sm.values_ );
+   owner_.swap( sm.owner_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::lines() const noexcept
+{
+   return SO ? n_ : m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element with an index not less than the given index.
+//
+// \param i The row/column index.
+// \param j The index of the search element within the row/column.
+// \return Offset of the first element with an index not less than \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t MappedCompressedMatrix<Type,SO,IT>::lowerBoundOffset( size_t i, size_t j ) const
+{
+   return std::lower_bound( indices_+offsets_[i], indices_+offsets_[i+1UL], j ) - indices_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t pos( lowerBoundOffset( line, index ) );
+
+   if( pos != offsets_[line+1UL] && indices_[pos] == index )
+      return ConstIterator( values_+pos, indices_+pos );
+   else return end( line );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < lines(), "Invalid row/column access index" );
+
+   const size_t pos( lowerBoundOffset( SO ? j : i, SO ? i : j ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename MappedCompressedMatrix<Type,SO,IT>::ConstIterator
+   MappedCompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   BLAZE_USER_ASSERT( line < lines(), "Invalid row/column access index" );
+
+   const size_t pos( std::upper_bound( indices_+offsets_[line], indices_+offsets_[line+1UL], index ) - indices_ );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedCompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Since the matrix is read-only, it can never be the target of an SMP assignment.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool MappedCompressedMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MappedCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const MappedCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isIntact( const MappedCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void swap( MappedCompressedMatrix<Type,SO,IT>& a, MappedCompressedMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given mapped compressed matrix is in default state.
+// \ingroup mapped_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is in default state, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const MappedCompressedMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given mapped compressed matrix are intact.
+// \ingroup mapped_compressed_matrix
+//
+// \param m The matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the offsets of the matrix are non-decreasing and whether the
+// indices within each row (or column) are strictly increasing and within the valid range.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isIntact( const MappedCompressedMatrix<Type,SO,IT>& m )
+{
+   const size_t lines( SO ? m.columns() : m.rows() );
+   const size_t size ( SO ? m.rows() : m.columns() );
+
+   for( size_t i=0UL; i<lines; ++i )
+   {
+      size_t next( 0UL );
+
+      for( auto element=m.begin(i); element!=m.end(i); ++element ) {
+         if( element->index() < next || element->index() >= size )
+            return false;
+         next = element->index() + 1UL;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two mapped compressed matrices.
+// \ingroup mapped_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( MappedCompressedMatrix<Type,SO,IT>& a, MappedCompressedMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct SubmatrixTrait< MappedCompressedMatrix<T1,SO,IT> >
+{
+   using Type = CompressedMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct RowTrait< MappedCompressedMatrix<T1,SO,IT> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct ColumnTrait< MappedCompressedMatrix<T1,SO,IT> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
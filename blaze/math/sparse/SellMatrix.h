@@ -0,0 +1,1439 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SellMatrix.h
+//  \brief Implementation of a read-only sparse matrix in SELL-C-sigma format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/SellIterator.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sell_matrix SellMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only implementation of a row-major \f$ M \times N \f$ sparse matrix in SELL-C-sigma
+//        format.
+// \ingroup sell_matrix
+//
+// The SellMatrix class template is a read-optimized sparse matrix that stores its non-zero
+// elements in the SELL-C-sigma format in order to enable vectorized sparse matrix/dense vector
+// multiplications. The type of the elements and the type of the stored column indices can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class SellMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SellMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - IT  : specifies the unsigned integral type used to store the column indices of the non-zero
+//          elements. The default is \c uint32_t, which is the index type required by the SIMD
+//          gather operations.
+//
+// In the SELL-C-sigma format the rows of the matrix are grouped into slices of \a C consecutive
+// rows, where \a C corresponds to the number of values of type \a Type in a single SIMD vector
+// (see the \a sliceHeight member constant). All rows of a slice are padded to the length of the
+// longest row of the slice and the elements of the slice are stored column by column, i.e. the
+// j-th elements of all \a C rows of a slice are stored contiguously. Thus the multiplication with
+// a dense vector can process the \a C rows of a slice simultaneously by means of one aligned load
+// of the values and one SIMD gather of the vector elements per column of the slice. In order to
+// reduce the amount of padding, the rows within each window of \a sigma consecutive rows are
+// sorted by their number of non-zero elements before they are assigned to slices. The value of
+// \a sigma is specified at construction time; the default of 1 preserves the original row order.
+//
+// SellMatrix is built once from any other (dense or sparse) matrix and cannot be modified
+// afterwards. It provides read access via the function call operator, the lookup functions and
+// the iterators over the non-zero elements of each row and can be used as operand in all sparse
+// matrix operations. Since the format cannot be efficiently modified, the result type of all
+// operations involving a SellMatrix is a CompressedMatrix. The multiplications with a dense
+// vector (\f$ \vec{y}=A*\vec{x} \f$, \f$ \vec{y}^T=\vec{x}^T*A \f$, and
+// \f$ \vec{y}=A^T*\vec{x} \f$) are evaluated by dedicated SELL-C-sigma kernels:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::SellMatrix;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization of the compressed matrix
+
+   SellMatrix<double> S( A, 64UL );  // Conversion with a sorting window of 64 rows
+
+   DynamicVector<double> x( 1000UL, 1.0 ), y;
+   y = S * x;           // Vectorized sparse matrix/dense vector multiplication
+   y = trans( S ) * x;  // Sparse matrix/dense vector multiplication with the transpose
+   \endcode
+*/
+template< typename Type            // Data type of the sparse matrix
+        , typename IT = uint32_t >  // Index type
+class SellMatrix : public SparseMatrix< SellMatrix<Type,IT>, false >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef SellMatrix<Type,IT>               This;            //!< Type of this SellMatrix instance.
+   typedef SparseMatrix<This,false>          BaseType;        //!< Base type of this SellMatrix instance.
+   typedef CompressedMatrix<Type,false>      ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>       OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>       TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                              ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                       ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                       CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                       Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                       ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SellIterator<const Type,IT>       Iterator;        //!< Iterator over non-constant elements.
+   typedef SellIterator<const Type,IT>       ConstIterator;   //!< Iterator over constant elements.
+   typedef IT                                IndexType;       //!< Type of the stored indices.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SellMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SellMatrix<ET,IT>  Other;  //!< The type of the other SellMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+
+   //! The number of rows per slice.
+   /*! The \a sliceHeight member constant corresponds to the parameter \a C of the SELL-C-sigma
+       format. It is set to the number of values of type \a Type in a single SIMD vector. */
+   enum : size_t { sliceHeight = SIMDTrait<Type>::size };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SellMatrix() noexcept;
+
+   template< typename MT, bool SO >
+   inline SellMatrix( const Matrix<MT,SO>& m, size_t sigma=1UL );
+
+   inline SellMatrix( const SellMatrix& sm );
+   inline SellMatrix( SellMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SellMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SellMatrix& operator=( const SellMatrix& rhs );
+   inline SellMatrix& operator=( SellMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO > inline SellMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline size_t sigma() const noexcept;
+   inline void   swap( SellMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t      slices() const noexcept;
+   inline size_t      sliceOffset( size_t s ) const noexcept;
+   inline size_t      rowIndex( size_t k ) const noexcept;
+   inline size_t      rowLength( size_t k ) const noexcept;
+   inline const Type* values() const noexcept;
+   inline const IT*   indices() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Comparison of two rows by their number of non-zero elements.
+   struct LongerRow
+   {
+      explicit inline LongerRow( const std::vector<size_t>& lengths ) : lengths_( &lengths ) {}
+      inline bool operator()( size_t i, size_t j ) const { return (*lengths_)[i] > (*lengths_)[j]; }
+      const std::vector<size_t>* lengths_;  //!< The number of non-zero elements of each row.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void build( const SparseMatrix<MT,false>& sm );
+
+   template< typename MT, bool SO >
+   inline void build( const Matrix<MT,SO>& m );
+
+   inline size_t lowerBoundOffset( size_t k, size_t j ) const;
+   inline const ConstIterator iterator( size_t k, size_t pos ) const noexcept;
+
+   static inline void checkIndexRange( size_t size );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  sigma_;     //!< The size of the sorting window.
+   size_t  slices_;    //!< The number of slices.
+   size_t  nonZeros_;  //!< The total number of non-zero elements.
+   size_t* offset_;    //!< Offsets of the first element of each slice.
+   size_t* perm_;      //!< The original row index of each stored row.
+   size_t* position_;  //!< The stored position of each original row.
+   size_t* length_;    //!< The number of non-zero elements of each stored row.
+   Type*   values_;    //!< The values of the (padded) slices.
+   IT*     indices_;   //!< The column indices of the (padded) slices.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, typename IT >
+const Type SellMatrix<Type,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SellMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SellMatrix<Type,IT>::SellMatrix() noexcept
+   : m_       ( 0UL )      // The current number of rows of the sparse matrix
+   , n_       ( 0UL )      // The current number of columns of the sparse matrix
+   , sigma_   ( 1UL )      // The size of the sorting window
+   , slices_  ( 0UL )      // The number of slices
+   , nonZeros_( 0UL )      // The total number of non-zero elements
+   , offset_  ( nullptr )  // Offsets of the first element of each slice
+   , perm_    ( nullptr )  // The original row index of each stored row
+   , position_( nullptr )  // The stored position of each original row
+   , length_  ( nullptr )  // The number of non-zero elements of each stored row
+   , values_  ( nullptr )  // The values of the (padded) slices
+   , indices_ ( nullptr )  // The column indices of the (padded) slices
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted.
+// \param sigma The size of the sorting window (default: 1).
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This constructor converts the given dense or sparse matrix into the SELL-C-sigma format. The
+// rows within each window of \a sigma consecutive rows are sorted by their number of non-zero
+// elements in descending order before they are grouped into slices. A value of 0 or 1 for
+// \a sigma preserves the original row order. Note that all elements of a sparse matrix operand
+// are stored, i.e. also explicitly stored zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SellMatrix<Type,IT>::SellMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : m_       ( 0UL )                  // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                  // The current number of columns of the sparse matrix
+   , sigma_   ( max( sigma, 1UL ) )    // The size of the sorting window
+   , slices_  ( 0UL )                  // The number of slices
+   , nonZeros_( 0UL )                  // The total number of non-zero elements
+   , offset_  ( nullptr )              // Offsets of the first element of each slice
+   , perm_    ( nullptr )              // The original row index of each stored row
+   , position_( nullptr )              // The stored position of each original row
+   , length_  ( nullptr )              // The number of non-zero elements of each stored row
+   , values_  ( nullptr )              // The values of the (padded) slices
+   , indices_ ( nullptr )              // The column indices of the (padded) slices
+{
+   build( ~m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SellMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SellMatrix<Type,IT>::SellMatrix( const SellMatrix& sm )
+   : m_       ( sm.m_ )                                      // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                      // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )                                  // The size of the sorting window
+   , slices_  ( sm.slices_ )                                 // The number of slices
+   , nonZeros_( sm.nonZeros_ )                               // The total number of non-zero elements
+   , offset_  ( new size_t[sm.slices_+1UL] )                 // Offsets of the first element of each slice
+   , perm_    ( new size_t[sm.m_] )                          // The original row index of each stored row
+   , position_( new size_t[sm.m_] )                          // The stored position of each original row
+   , length_  ( new size_t[sm.m_] )                          // The number of non-zero elements of each stored row
+   , values_  ( allocate<Type>( sm.offset_[sm.slices_] ) )  // The values of the (padded) slices
+   , indices_ ( allocate<IT>( sm.offset_[sm.slices_] ) )    // The column indices of the (padded) slices
+{
+   std::copy( sm.offset_, sm.offset_+slices_+1UL, offset_ );
+   std::copy( sm.perm_, sm.perm_+m_, perm_ );
+   std::copy( sm.position_, sm.position_+m_, position_ );
+   std::copy( sm.length_, sm.length_+m_, length_ );
+   std::copy( sm.values_, sm.values_+offset_[slices_], values_ );
+   std::copy( sm.indices_, sm.indices_+offset_[slices_], indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SellMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SellMatrix<Type,IT>::SellMatrix( SellMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )         // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )     // The size of the sorting window
+   , slices_  ( sm.slices_ )    // The number of slices
+   , nonZeros_( sm.nonZeros_ )  // The total number of non-zero elements
+   , offset_  ( sm.offset_ )    // Offsets of the first element of each slice
+   , perm_    ( sm.perm_ )      // The original row index of each stored row
+   , position_( sm.position_ )  // The stored position of each original row
+   , length_  ( sm.length_ )    // The number of non-zero elements of each stored row
+   , values_  ( sm.values_ )    // The values of the (padded) slices
+   , indices_ ( sm.indices_ )   // The column indices of the (padded) slices
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.slices_   = 0UL;
+   sm.nonZeros_ = 0UL;
+   sm.offset_   = nullptr;
+   sm.perm_     = nullptr;
+   sm.position_ = nullptr;
+   sm.length_   = nullptr;
+   sm.values_   = nullptr;
+   sm.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SellMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SellMatrix<Type,IT>::~SellMatrix()
+{
+   delete[] offset_;
+   delete[] perm_;
+   delete[] position_;
+   delete[] length_;
+   deallocate( values_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstReference
+   SellMatrix<Type,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstReference
+   SellMatrix<Type,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return iterator( position_[i], 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return iterator( position_[i], 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( position_[i] );
+   return iterator( k, length_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( position_[i] );
+   return iterator( k, length_[k] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SellMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SellMatrix<Type,IT>& SellMatrix<Type,IT>::operator=( const SellMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SellMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SellMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SellMatrix<Type,IT>& SellMatrix<Type,IT>::operator=( SellMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The given dense or sparse matrix is converted into the SELL-C-sigma format, where the current
+// size of the sorting window is retained. In contrast to other matrix types, the size of the
+// matrix is adapted to the size of the right-hand side matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SellMatrix<Type,IT>& SellMatrix<Type,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SellMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity of a SellMatrix corresponds to the total number of stored elements including
+// the padding elements of all slices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::capacity() const noexcept
+{
+   if( offset_ != nullptr )
+      return offset_[slices_];
+   else return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+//
+// The capacity of a row corresponds to the padded length of the slice the row belongs to.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   const size_t s( position_[i] / sliceHeight );
+   return ( offset_[s+1UL] - offset_[s] ) / sliceHeight;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return length_[position_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the sorting window.
+//
+// \return The number of consecutive rows that are sorted by their number of non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::sigma() const noexcept
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void SellMatrix<Type,IT>::swap( SellMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( slices_, sm.slices_ );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   std::swap( offset_, sm.offset_ );
+   std::swap( perm_, sm.perm_ );
+   std::swap( position_, sm.position_ );
+   std::swap( length_, sm.length_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a row-major sparse matrix into the SELL-C-sigma format.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function assumes that the matrix is empty, i.e. that no memory has been allocated yet.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT >  // Type of the row-major sparse matrix
+void SellMatrix<Type,IT>::build( const SparseMatrix<MT,false>& sm )
+{
+   typedef ConstIterator_< RemoveReference_< CompositeType_<MT> > >  RhsIterator;
+
+   BLAZE_INTERNAL_ASSERT( offset_ == nullptr, "Invalid matrix state detected" );
+
+   checkIndexRange( (~sm).columns() );
+
+   CompositeType_<MT> A( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t m( A.rows() );
+   const size_t slices( ( m + sliceHeight - 1UL ) / sliceHeight );
+
+   std::vector<size_t> lengths( m );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      lengths[i] = A.nonZeros( i );
+      nonzeros  += lengths[i];
+   }
+
+   m_        = m;
+   n_        = A.columns();
+   slices_   = slices;
+   nonZeros_ = nonzeros;
+   offset_   = new size_t[slices+1UL];
+   perm_     = new size_t[m];
+   position_ = new size_t[m];
+   length_   = new size_t[m];
+
+   for( size_t k=0UL; k<m; ++k ) {
+      perm_[k] = k;
+   }
+
+   if( sigma_ > 1UL ) {
+      for( size_t k=0UL; k<m; k+=sigma_ ) {
+         std::stable_sort( perm_+k, perm_+min( k+sigma_, m ), LongerRow( lengths ) );
+      }
+   }
+
+   offset_[0UL] = 0UL;
+
+   for( size_t k=0UL; k<m; ++k ) {
+      position_[perm_[k]] = k;
+      length_[k] = lengths[perm_[k]];
+   }
+
+   for( size_t s=0UL; s<slices; ++s ) {
+      const size_t kend( min( (s+1UL)*sliceHeight, m ) );
+      size_t width( 0UL );
+      for( size_t k=s*sliceHeight; k<kend; ++k ) {
+         width = max( width, length_[k] );
+      }
+      offset_[s+1UL] = offset_[s] + width*sliceHeight;
+   }
+
+   values_  = allocate<Type>( offset_[slices] );
+   indices_ = allocate<IT>( offset_[slices] );
+
+   for( size_t s=0UL; s<slices; ++s )
+   {
+      const size_t width( ( offset_[s+1UL] - offset_[s] ) / sliceHeight );
+
+      for( size_t l=0UL; l<sliceHeight; ++l )
+      {
+         const size_t k( s*sliceHeight + l );
+         Type* value( values_  + offset_[s] + l );
+         IT*   index( indices_ + offset_[s] + l );
+         IT    last ( 0 );
+         size_t j( 0UL );
+
+         if( k < m ) {
+            const RhsIterator end( A.end( perm_[k] ) );
+            for( RhsIterator element=A.begin( perm_[k] ); element!=end; ++element, ++j ) {
+               value[j*sliceHeight] = element->value();
+               index[j*sliceHeight] = last = static_cast<IT>( element->index() );
+            }
+         }
+
+         for( ; j<width; ++j ) {
+            value[j*sliceHeight] = Type();
+            index[j*sliceHeight] = last;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a dense or column-major sparse matrix into the SELL-C-sigma format.
+//
+// \param m The matrix to be converted.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function assumes that the matrix is empty, i.e. that no memory has been allocated yet.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+inline void SellMatrix<Type,IT>::build( const Matrix<MT,SO>& m )
+{
+   const CompressedMatrix<Type,false> tmp( serial( ~m ) );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of a stored row with an index not less than \a j.
+//
+// \param k The stored position of the row.
+// \param j The column index of the search element.
+// \return The offset of the element within the row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::lowerBoundOffset( size_t k, size_t j ) const
+{
+   const IT* const index( indices_ + offset_[k/sliceHeight] + k%sliceHeight );
+
+   size_t first( 0UL );
+   size_t count( length_[k] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( index[(first+step)*sliceHeight] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given offset within a stored row.
+//
+// \param k The stored position of the row.
+// \param pos The offset of the element within the row.
+// \return Iterator to the element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline const typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::iterator( size_t k, size_t pos ) const noexcept
+{
+   const size_t offset( offset_[k/sliceHeight] + k%sliceHeight + pos*sliceHeight );
+   return ConstIterator( values_+offset, indices_+offset, sliceHeight );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given number of columns fits into the index type.
+//
+// \param size The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void SellMatrix<Type,IT>::checkIndexRange( size_t size )
+{
+   if( size > 0UL && size-1UL > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix size exceeds the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. In case the element is found, the function returns an iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i (the end() iterator)
+// is returned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::find( size_t i, size_t j ) const
+{
+   const size_t k  ( position_[i] );
+   const size_t pos( lowerBoundOffset( k, j ) );
+   const ConstIterator element( iterator( k, pos ) );
+
+   if( pos != length_[k] && element->index() == j )
+      return element;
+   else return iterator( k, length_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t k( position_[i] );
+   return iterator( k, lowerBoundOffset( k, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SellMatrix<Type,IT>::ConstIterator
+   SellMatrix<Type,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t k( position_[i] );
+   return iterator( k, lowerBoundOffset( k, j+1UL ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of slices of the sparse matrix.
+//
+// \return The number of slices.
+//
+// Each slice consists of \a sliceHeight consecutive stored rows. Note that the last slice may
+// contain less than \a sliceHeight rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::slices() const noexcept
+{
+   return slices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of the given slice.
+//
+// \param s The index of the slice in the range \f$[0..slices()]\f$.
+// \return The offset of the first element of the slice within the value and index arrays.
+//
+// The elements of slice \a s are stored in the range \f$[sliceOffset(s)..sliceOffset(s+1))\f$
+// of the value and index arrays. The j-th element of the l-th row of the slice is stored at
+// the offset \f$ sliceOffset(s) + j*sliceHeight + l \f$. Since the arrays are properly aligned
+// and all offsets are multiples of \a sliceHeight, all columns of a slice can be loaded via
+// aligned SIMD loads.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::sliceOffset( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s <= slices_, "Invalid slice access index" );
+   return offset_[s];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the original row index of the given stored row.
+//
+// \param k The stored position of the row in the range \f$[0..M-1]\f$.
+// \return The index of the row within the original matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::rowIndex( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < m_, "Invalid row access index" );
+   return perm_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the given stored row.
+//
+// \param k The stored position of the row in the range \f$[0..M-1]\f$.
+// \return The number of non-zero elements (excluding the padding) of the stored row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SellMatrix<Type,IT>::rowLength( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < m_, "Invalid row access index" );
+   return length_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the slices.
+//
+// \return Pointer to the aligned array of values of all slices.
+//
+// The padding elements of the slices are stored as default values (i.e. zeros).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline const Type* SellMatrix<Type,IT>::values() const noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the column indices of the slices.
+//
+// \return Pointer to the aligned array of column indices of all slices.
+//
+// The padding elements of the slices refer to a valid column index of the same row (or to
+// column 0 in case the row is empty).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline const IT* SellMatrix<Type,IT>::indices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline bool SellMatrix<Type,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SELLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SellMatrix operators */
+//@{
+template< typename Type, typename IT >
+inline bool isDefault( const SellMatrix<Type,IT>& m );
+
+template< typename Type, typename IT >
+inline bool isIntact( const SellMatrix<Type,IT>& m ) noexcept;
+
+template< typename Type, typename IT >
+inline void swap( SellMatrix<Type,IT>& a, SellMatrix<Type,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sparse matrix is in default state.
+// \ingroup sell_matrix
+//
+// \param m The sparse matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+//
+// This function checks whether the sparse matrix is in default state. For instance, in case
+// the matrix is instantiated for a built-in integral or floating point data type, the function
+// returns \a true in case all matrix elements are 0 and \a false in case any matrix element is
+// not 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline bool isDefault( const SellMatrix<Type,IT>& m )
+{
+   typedef ConstIterator_< SellMatrix<Type,IT> >  ConstIterator;
+
+   for( size_t i=0UL; i<m.rows(); ++i ) {
+      for( ConstIterator element=m.begin(i); element!=m.end(i); ++element )
+         if( !isDefault( element->value() ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given sparse matrix are intact.
+// \ingroup sell_matrix
+//
+// \param m The sparse matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the sparse matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline bool isIntact( const SellMatrix<Type,IT>& m ) noexcept
+{
+   typedef SellMatrix<Type,IT>  MT;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<m.rows(); ++k ) {
+      const size_t i( m.rowIndex( k ) );
+      if( i >= m.rows() || m.nonZeros( i ) != m.rowLength( k ) || m.nonZeros( i ) > m.capacity( i ) )
+         return false;
+      nonzeros += m.rowLength( k );
+   }
+
+   for( size_t s=0UL; s<m.slices(); ++s ) {
+      if( m.sliceOffset( s+1UL ) < m.sliceOffset( s ) ||
+          ( m.sliceOffset( s+1UL ) - m.sliceOffset( s ) ) % MT::sliceHeight != 0UL )
+         return false;
+   }
+
+   return ( nonzeros == m.nonZeros() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+// \ingroup sell_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void swap( SellMatrix<Type,IT>& a, SellMatrix<Type,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct SubmatrixTrait< SellMatrix<T1,IT> >
+{
+   using Type = CompressedMatrix<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct RowTrait< SellMatrix<T1,IT> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct ColumnTrait< SellMatrix<T1,IT> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,746 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SellMult.h
+//  \brief Multiplication kernels for the SellMatrix class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMULT_H_
+#define _BLAZE_MATH_SPARSE_SELLMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/SellMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of a single result value of a SellMatrix multiplication kernel.
+// \ingroup sell_matrix
+*/
+struct SellAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { lhs = rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment of a single result value of a SellMatrix multiplication kernel.
+// \ingroup sell_matrix
+*/
+struct SellAddAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { lhs += rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment of a single result value of a SellMatrix multiplication kernel.
+// \ingroup sell_matrix
+*/
+struct SellSubAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { lhs -= rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the SellMatrix/dense vector multiplication kernels.
+// \ingroup sell_matrix
+//
+// In case the combination of the target vector, the SellMatrix and the right-hand side vector
+// is suited for a vectorized multiplication kernel based on SIMD gather operations, the nested
+// \a value will be set to 1, otherwise it will be 0. Note that the right-hand side vector is
+// required to provide contiguous low-level data access.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2 > // Type of the right-hand side vector
+struct UseVectorizedSellKernel
+   : public And< Bool< useOptimizedKernels >
+               , HasConstDataAccess<VT2>
+               , Bool< VT2::simdEnabled >
+               , IsSame< ElementType_<VT1>, Type >
+               , IsSame< ElementType_<VT2>, Type >
+               , IsSame< IT, uint32_t >
+               , HasSIMDGather<Type>
+               , HasSIMDAdd<Type,Type>
+               , HasSIMDMult<Type,Type> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a range of slices of a SellMatrix with a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side SellMatrix.
+// \param x The right-hand side dense vector.
+// \param sbegin The index of the first slice.
+// \param send The index one past the last slice.
+// \param op The assignment operation for the result values.
+// \return void
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline DisableIf_< UseVectorizedSellKernel<VT1,Type,IT,VT2> >
+   sellMultKernel( VT1& y, const SellMatrix<Type,IT>& A, const VT2& x,
+                   size_t sbegin, size_t send, OP op )
+{
+   enum : size_t { C = SellMatrix<Type,IT>::sliceHeight };
+
+   const Type* const values ( A.values()  );
+   const IT*   const indices( A.indices() );
+
+   for( size_t s=sbegin; s<send; ++s )
+   {
+      const size_t offset( A.sliceOffset( s ) );
+      const size_t kend  ( min( (s+1UL)*C, A.rows() ) );
+
+      for( size_t k=s*C; k<kend; ++k )
+      {
+         const size_t length( A.rowLength( k ) );
+         const size_t first ( offset + k%C );
+
+         ElementType_<VT1> sum = ElementType_<VT1>();
+
+         for( size_t j=0UL; j<length; ++j ) {
+            sum += values[first+j*C] * x[indices[first+j*C]];
+         }
+
+         op( y[A.rowIndex( k )], sum );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the multiplication of a range of slices of a SellMatrix with a
+//        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side SellMatrix.
+// \param x The right-hand side dense vector.
+// \param sbegin The index of the first slice.
+// \param send The index one past the last slice.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// This kernel processes all rows of a slice simultaneously: each column of a slice is handled
+// by an aligned load of the values and a SIMD gather of the according elements of \a x. The
+// padding elements of the slices are zero and refer to a valid column index and therefore
+// don't have to be treated separately. In case the number of columns of the matrix exceeds
+// the range of the signed 32-bit offsets of the gather operations, the default kernel is used.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline EnableIf_< UseVectorizedSellKernel<VT1,Type,IT,VT2> >
+   sellMultKernel( VT1& y, const SellMatrix<Type,IT>& A, const VT2& x,
+                   size_t sbegin, size_t send, OP op )
+{
+   typedef SIMDTrait_<Type>  SIMDType;
+
+   enum : size_t { C = SellMatrix<Type,IT>::sliceHeight };
+
+   if( A.columns() > size_t( std::numeric_limits<int32_t>::max() ) )
+   {
+      for( size_t s=sbegin; s<send; ++s )
+      {
+         const size_t kend( min( (s+1UL)*C, A.rows() ) );
+
+         for( size_t k=s*C; k<kend; ++k )
+         {
+            const size_t length( A.rowLength( k ) );
+            const size_t first ( A.sliceOffset( s ) + k%C );
+
+            Type sum = Type();
+
+            for( size_t j=0UL; j<length; ++j ) {
+               sum += A.values()[first+j*C] * x[A.indices()[first+j*C]];
+            }
+
+            op( y[A.rowIndex( k )], sum );
+         }
+      }
+
+      return;
+   }
+
+   const Type* const values ( A.values()  );
+   const IT*   const indices( A.indices() );
+   const Type* const data   ( x.data() );
+
+   Type tmp[C];
+
+   for( size_t s=sbegin; s<send; ++s )
+   {
+      const size_t offset( A.sliceOffset( s ) );
+      const size_t width ( ( A.sliceOffset( s+1UL ) - offset ) / C );
+      const size_t lend  ( min( C, A.rows() - s*C ) );
+
+      SIMDType xmm1, xmm2;
+      size_t j( 0UL );
+
+      for( ; (j+2UL) <= width; j+=2UL ) {
+         xmm1 = xmm1 + loada( values+offset+j*C     ) * gather( data, indices+offset+j*C     );
+         xmm2 = xmm2 + loada( values+offset+j*C+C ) * gather( data, indices+offset+j*C+C );
+      }
+      if( j < width ) {
+         xmm1 = xmm1 + loada( values+offset+j*C ) * gather( data, indices+offset+j*C );
+      }
+
+      storeu( tmp, xmm1 + xmm2 );
+
+      for( size_t l=0UL; l<lend; ++l ) {
+         op( y[A.rowIndex( s*C+l )], tmp[l] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of the transpose of a range of slices of a SellMatrix
+//        with a dense vector (\f$ \vec{y}=A^T*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector (or pointer to the first target element).
+// \param A The SellMatrix.
+// \param x The right-hand side dense vector.
+// \param sbegin The index of the first slice.
+// \param send The index one past the last slice.
+// \param op The update operation for the result values (addition or subtraction assignment).
+// \return void
+//
+// This kernel scatters the contribution of each stored element of the given slices to the
+// according element of \a y. The padding elements of the slices are skipped.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename OP >  // Type of the update operation
+inline void sellTransMultKernel( VT1& y, const SellMatrix<Type,IT>& A, const VT2& x,
+                                 size_t sbegin, size_t send, OP op )
+{
+   enum : size_t { C = SellMatrix<Type,IT>::sliceHeight };
+
+   const Type* const values ( A.values()  );
+   const IT*   const indices( A.indices() );
+
+   for( size_t s=sbegin; s<send; ++s )
+   {
+      const size_t offset( A.sliceOffset( s ) );
+      const size_t kend  ( min( (s+1UL)*C, A.rows() ) );
+
+      for( size_t k=s*C; k<kend; ++k )
+      {
+         const size_t length( A.rowLength( k ) );
+         const size_t first ( offset + k%C );
+         const auto   xk    ( x[A.rowIndex( k )] );
+
+         for( size_t j=0UL; j<length; ++j ) {
+            op( y[indices[first+j*C]], values[first+j*C] * xk );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the multiplication of a block of slices of a SellMatrix with a dense
+//        vector.
+// \ingroup sell_matrix
+//
+// This functor computes the rows of the given block of slices of the product between a
+// SellMatrix and a dense vector. It is used in combination with the smpBatch() function.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+struct SellMultBlock
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SellMultBlock class template.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side SellMatrix.
+   // \param x The right-hand side dense vector.
+   // \param op The assignment operation for the result values.
+   */
+   explicit inline SellMultBlock( VT1& y, const SellMatrix<Type,IT>& A, const VT2& x, OP op )
+      : y_ ( y  )  // The target left-hand side dense vector
+      , A_ ( A  )  // The left-hand side SellMatrix
+      , x_ ( x  )  // The right-hand side dense vector
+      , op_( op )  // The assignment operation
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the rows of the given block of slices.
+   //
+   // \param index The index of the first slice of the block.
+   // \param n The number of slices of the block.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      sellMultKernel( y_, A_, x_, index, index+n, op_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1&                       y_;   //!< The target left-hand side dense vector.
+   const SellMatrix<Type,IT>& A_;   //!< The left-hand side SellMatrix.
+   const VT2&                 x_;   //!< The right-hand side dense vector.
+   OP                         op_;  //!< The assignment operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the computation of the partial results of the multiplication of the
+//        transpose of a SellMatrix with a dense vector.
+// \ingroup sell_matrix
+//
+// This functor computes the contribution of the b-th of \a blocks blocks of slices to the
+// product between the transpose of a SellMatrix and a dense vector. The partial result of each
+// block is stored in a separate row of the given buffer, such that all blocks can be processed
+// concurrently. It is used in combination with the smpBatch() function.
+*/
+template< typename ET    // Element type of the partial results
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT >  // Type of the right-hand side vector
+struct SellTransMultBlock
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SellTransMultBlock class template.
+   //
+   // \param partial Pointer to the buffer for the partial results.
+   // \param blocks The total number of blocks.
+   // \param A The SellMatrix.
+   // \param x The right-hand side dense vector.
+   */
+   explicit inline SellTransMultBlock( ET* partial, size_t blocks,
+                                       const SellMatrix<Type,IT>& A, const VT& x )
+      : partial_( partial )  // Pointer to the buffer for the partial results
+      , blocks_ ( blocks  )  // The total number of blocks
+      , A_      ( A       )  // The SellMatrix
+      , x_      ( x       )  // The right-hand side dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the partial results of the given range of blocks.
+   //
+   // \param index The index of the first block.
+   // \param n The number of blocks.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const
+   {
+      for( size_t b=index; b<index+n; ++b ) {
+         ET* y( partial_ + b*A_.columns() );
+         const size_t sbegin( (  b      *A_.slices() ) / blocks_ );
+         const size_t send  ( ( (b+1UL)*A_.slices() ) / blocks_ );
+         sellTransMultKernel( y, A_, x_, sbegin, send, SellAddAssign() );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   ET* const                  partial_;  //!< Pointer to the buffer for the partial results.
+   const size_t               blocks_;   //!< The total number of blocks.
+   const SellMatrix<Type,IT>& A_;        //!< The SellMatrix.
+   const VT&                  x_;        //!< The right-hand side dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the reduction of the partial results of the multiplication of the
+//        transpose of a SellMatrix with a dense vector.
+// \ingroup sell_matrix
+//
+// This functor accumulates the partial results of all blocks for a range of elements of the
+// target vector. It is used in combination with the smpBatch() function.
+*/
+template< typename VT    // Type of the left-hand side target vector
+        , typename ET    // Element type of the partial results
+        , typename OP >  // Type of the assignment operation
+struct SellTransMultReduce
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SellTransMultReduce class template.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param partial Pointer to the buffer of partial results.
+   // \param blocks The total number of blocks.
+   // \param op The assignment operation for the result values.
+   */
+   explicit inline SellTransMultReduce( VT& y, const ET* partial, size_t blocks, OP op )
+      : y_      ( y       )  // The target left-hand side dense vector
+      , partial_( partial )  // Pointer to the buffer of partial results
+      , blocks_ ( blocks  )  // The total number of blocks
+      , op_     ( op      )  // The assignment operation
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Accumulates the partial results for the given range of elements.
+   //
+   // \param index The index of the first element.
+   // \param n The number of elements.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const
+   {
+      const size_t size( y_.size() );
+
+      for( size_t j=index; j<index+n; ++j ) {
+         ET sum( partial_[j] );
+         for( size_t b=1UL; b<blocks_; ++b )
+            sum += partial_[b*size+j];
+         op_( y_[j], sum );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT&          y_;        //!< The target left-hand side dense vector.
+   const ET*    partial_;  //!< Pointer to the buffer of partial results.
+   const size_t blocks_;   //!< The total number of blocks.
+   OP           op_;       //!< The assignment operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of a SellMatrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side SellMatrix.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// This function is used internally by the sparse matrix/dense vector multiplication expression
+// templates for the evaluation of products with a SellMatrix.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline void sellMult( DenseVector<VT1,TF1>& y, const SellMatrix<Type,IT>& A,
+                      const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   if( A.columns() == 0UL ) {
+      for( size_t i=0UL; i<A.rows(); ++i )
+         op( (~y)[i], ElementType_<VT1>() );
+      return;
+   }
+
+   sellMultKernel( ~y, A, ~x, 0UL, A.slices(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of a SellMatrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side SellMatrix.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// This function distributes the slices of the SellMatrix among the available threads. Since
+// each slice contributes to a distinct set of elements of the target vector, the slices can be
+// processed concurrently. In case the matrix has less rows than specified by the according
+// SMP threshold the multiplication is executed serially.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline void smpSellMult( DenseVector<VT1,TF1>& y, const SellMatrix<Type,IT>& A,
+                         const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   enum : size_t { C = SellMatrix<Type,IT>::sliceHeight };
+
+   if( A.columns() == 0UL ) {
+      sellMult( ~y, A, ~x, op );
+      return;
+   }
+
+   const size_t threshold( ( SMP_SMATDVECMULT_THRESHOLD + C - 1UL ) / C );
+
+   smpBatch( A.slices(), 1UL, threshold, SellMultBlock<VT1,Type,IT,VT2,OP>( ~y, A, ~x, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of the transpose of a SellMatrix with a dense vector
+//        (\f$ \vec{y}=A^T*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The SellMatrix.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// This function is used internally by the sparse matrix/dense vector multiplication expression
+// templates for the evaluation of products with the transpose of a SellMatrix.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline void sellTransMult( DenseVector<VT1,TF1>& y, const SellMatrix<Type,IT>& A,
+                           const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.columns(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.rows()   , "Invalid vector size" );
+
+   sellTransMultKernel( ~y, A, ~x, 0UL, A.slices(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial assignment of the product of the transpose of a SellMatrix and a dense vector
+//        (\f$ \vec{y}=A^T*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The SellMatrix.
+// \param x The right-hand side dense vector.
+// \return void
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2 >     // Transpose flag of the right-hand side vector
+inline void sellTransMult( DenseVector<VT1,TF1>& y, const SellMatrix<Type,IT>& A,
+                           const DenseVector<VT2,TF2>& x, SellAssign )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   reset( ~y );
+   sellTransMult( ~y, A, ~x, SellAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of the transpose of a SellMatrix with a dense vector
+//        (\f$ \vec{y}=A^T*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The SellMatrix.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation for the result values.
+// \return void
+//
+// Since different slices of the SellMatrix contribute to the same elements of the target
+// vector, each thread accumulates the contribution of a block of slices into a private buffer.
+// Afterwards the partial results are reduced in parallel. In case the target vector has less
+// elements than specified by the according SMP threshold or in case only a single thread is
+// available, the multiplication is executed serially.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF1       // Transpose flag of the target vector
+        , typename Type  // Data type of the SellMatrix
+        , typename IT    // Index type of the SellMatrix
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP >  // Type of the assignment operation
+inline void smpSellTransMult( DenseVector<VT1,TF1>& y, const SellMatrix<Type,IT>& A,
+                              const DenseVector<VT2,TF2>& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef RemoveConst_< ElementType_<VT1> >  ET;
+
+   const size_t blocks( min( getNumThreads(), A.slices() ) );
+
+   if( blocks < 2UL || A.columns() < SMP_TDVECSMATMULT_THRESHOLD ) {
+      sellTransMult( ~y, A, ~x, op );
+      return;
+   }
+
+   std::vector<ET> partial( blocks*A.columns() );
+
+   smpBatch( blocks, 1UL, 2UL,
+             SellTransMultBlock<ET,Type,IT,VT2>( partial.data(), blocks, A, ~x ) );
+   smpBatch( A.columns(), SIMDTrait<ET>::size, SMP_TDVECSMATMULT_THRESHOLD,
+             SellTransMultReduce<VT1,ET,OP>( ~y, partial.data(), blocks, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,902 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpGemm.h
+//  \brief Sparse matrix/sparse matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPGEMM_H_
+#define _BLAZE_MATH_SPARSE_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Batch.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPGEMMACCUMULATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row accumulator for the sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// The SpGemmAccumulator class computes single rows of the product of two row-major sparse
+// matrices (Gustavson's algorithm). For every row it selects the accumulation strategy
+// according to the number of scalar multiplications (the flops) of the row:
+//
+//  - Rows with at most \a sortLimit flops are accumulated by sorting the products by their
+//    column index and merging duplicates. This avoids any scratch memory proportional to the
+//    number of columns.
+//  - Rows whose flops reach at least 1/\a denseRatio of the number of columns are accumulated
+//    in a dense array of the size of a row, which is allocated on first use only.
+//  - All other rows are accumulated in an open addressing hash table whose size is proportional
+//    to the flops of the row.
+//
+// All scratch memory is owned by the accumulator and reused for all rows, such that a single
+// accumulator per thread is sufficient. The symbolic() function determines the exact number of
+// non-zero elements of a row, the numeric() function computes the sorted elements of the row.
+*/
+template< typename ET >  // Element type of the resulting matrix
+class SpGemmAccumulator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<ET>  ElementType;  //!< Type of the computed elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SpGemmAccumulator( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Accumulation functions**********************************************************************
+   /*!\name Accumulation functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   inline size_t symbolic( const MT1& A, const MT2& B, size_t i, size_t flops );
+
+   template< typename MT1, typename MT2 >
+   inline size_t numeric( const MT1& A, const MT2& B, size_t i, size_t flops );
+
+   inline const ElementType& operator[]( size_t k ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   useSort ( size_t flops ) const noexcept;
+   inline bool   useDense( size_t flops ) const noexcept;
+   inline size_t prepareDense();
+   inline size_t prepareHash( size_t flops );
+   inline size_t slot( size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;         //!< The number of columns of the resulting matrix.
+   size_t mask_;      //!< The bit mask for the slots of the current hash table.
+   size_t shift_;     //!< The shift of the multiplicative hash function.
+
+   std::vector<size_t>      keys_;     //!< The column indices of the hash table slots.
+   std::vector<ET>          entries_;  //!< The values of the hash table slots.
+   std::vector<ET>          values_;   //!< The values of the dense accumulator.
+   std::vector<byte_t>      valid_;    //!< The occupancy flags of the dense accumulator.
+   std::vector<size_t>      indices_;  //!< The column indices touched in the current row.
+   std::vector<ElementType> row_;      //!< The sorted elements of the current row.
+   //@}
+   //**********************************************************************************************
+
+   //**Accumulation constants**********************************************************************
+   /*!\name Accumulation constants */
+   //@{
+   enum : size_t { sortLimit  = 32UL };        //!< Maximum number of flops for sort accumulation.
+   enum : size_t { denseRatio = 16UL };        //!< Minimum columns-to-flops ratio for hashing.
+   enum : size_t { empty      = ~size_t(0) };  //!< Marker for empty hash table slots.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SpGemmAccumulator class template.
+//
+// \param n The number of columns of the resulting matrix.
+//
+// The constructor does not allocate any memory. The scratch memory is acquired on demand and
+// reused for all subsequent rows.
+*/
+template< typename ET >  // Element type of the resulting matrix
+inline SpGemmAccumulator<ET>::SpGemmAccumulator( size_t n )
+   : n_      ( n   )  // The number of columns of the resulting matrix
+   , mask_   ( 0UL )  // The bit mask for the slots of the current hash table
+   , shift_  ( 0UL )  // The shift of the multiplicative hash function
+   , keys_   ()       // The column indices of the hash table slots
+   , entries_()       // The values of the hash table slots
+   , values_ ()       // The values of the dense accumulator
+   , valid_  ()       // The occupancy flags of the dense accumulator
+   , indices_()       // The column indices touched in the current row
+   , row_    ()       // The sorted elements of the current row
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCUMULATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the number of non-zero elements of a row of the product \f$ A*B \f$.
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row.
+// \param flops The number of scalar multiplications of the row.
+// \return The number of (structurally) non-zero elements of row \a i.
+*/
+template< typename ET >  // Element type of the resulting matrix
+template< typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2 > // Type of the right-hand side sparse matrix
+inline size_t SpGemmAccumulator<ET>::symbolic( const MT1& A, const MT2& B, size_t i, size_t flops )
+{
+   typedef ConstIterator_<MT1>  LeftIterator;
+   typedef ConstIterator_<MT2>  RightIterator;
+
+   const LeftIterator lbegin( A.begin(i) );
+   const LeftIterator lend  ( A.end(i)   );
+
+   if( flops == 0UL ) {
+      return 0UL;
+   }
+
+   // A single element in row i of A selects a single row of B, which is free of duplicates
+   if( lend - lbegin == 1L ) {
+      return flops;
+   }
+
+   size_t nonzeros( 0UL );
+
+   // Sort accumulation
+   if( useSort( flops ) )
+   {
+      indices_.clear();
+
+      for( LeftIterator lelem=lbegin; lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+            indices_.push_back( relem->index() );
+      }
+
+      std::sort( indices_.begin(), indices_.end() );
+      nonzeros = std::unique( indices_.begin(), indices_.end() ) - indices_.begin();
+   }
+
+   // Dense accumulation
+   else if( useDense( flops ) )
+   {
+      prepareDense();
+
+      for( LeftIterator lelem=lbegin; lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            if( !valid_[relem->index()] ) {
+               valid_[relem->index()] = 1;
+               indices_.push_back( relem->index() );
+            }
+         }
+      }
+
+      nonzeros = indices_.size();
+
+      for( size_t j : indices_ )
+         valid_[j] = 0;
+   }
+
+   // Hash accumulation
+   else
+   {
+      const size_t capacity( prepareHash( flops ) );
+
+      for( LeftIterator lelem=lbegin; lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+         {
+            size_t pos( slot( relem->index() ) );
+            while( keys_[pos] != empty && keys_[pos] != relem->index() )
+               pos = ( pos + 1UL ) & mask_;
+
+            if( keys_[pos] == empty ) {
+               keys_[pos] = relem->index();
+               ++nonzeros;
+            }
+         }
+      }
+
+      std::fill( keys_.begin(), keys_.begin()+capacity, empty );
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elements of a row of the product \f$ A*B \f$.
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \param i The index of the row.
+// \param flops The number of scalar multiplications of the row.
+// \return The number of computed elements of row \a i.
+//
+// This function computes the elements of row \a i of the product \f$ A*B \f$. The elements
+// are sorted by their column index and can be accessed via the subscript operator until the
+// next call to symbolic() or numeric(). Elements resulting from numerical cancellation are
+// not removed.
+*/
+template< typename ET >  // Element type of the resulting matrix
+template< typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2 > // Type of the right-hand side sparse matrix
+inline size_t SpGemmAccumulator<ET>::numeric( const MT1& A, const MT2& B, size_t i, size_t flops )
+{
+   typedef ConstIterator_<MT1>  LeftIterator;
+   typedef ConstIterator_<MT2>  RightIterator;
+
+   const LeftIterator lbegin( A.begin(i) );
+   const LeftIterator lend  ( A.end(i)   );
+
+   row_.clear();
+
+   if( flops == 0UL ) {
+      return 0UL;
+   }
+
+   // A single element in row i of A scales a single row of B
+   if( lend - lbegin == 1L )
+   {
+      const RightIterator rend( B.end( lbegin->index() ) );
+      for( RightIterator relem=B.begin( lbegin->index() ); relem!=rend; ++relem )
+         row_.push_back( ElementType( lbegin->value() * relem->value(), relem->index() ) );
+   }
+
+   // Sort accumulation
+   else if( useSort( flops ) )
+   {
+      for( LeftIterator lelem=lbegin; lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+            row_.push_back( ElementType( lelem->value() * relem->value(), relem->index() ) );
+      }
+
+      std::sort( row_.begin(), row_.end(),
+                 []( const ElementType& a, const ElementType& b ) { return a.index() < b.index(); } );
+
+      size_t nonzeros( 0UL );
+
+      for( size_t k=1UL; k<row_.size(); ++k ) {
+         if( row_[k].index() == row_[nonzeros].index() )
+            row_[nonzeros].value() += row_[k].value();
+         else
+            row_[++nonzeros] = row_[k];
+      }
+
+      row_.resize( nonzeros+1UL );
+   }
+
+   // Dense accumulation
+   else if( useDense( flops ) )
+   {
+      prepareDense();
+
+      size_t minIndex( n_ ), maxIndex( 0UL );
+
+      for( LeftIterator lelem=lbegin; lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+         {
+            const size_t j( relem->index() );
+
+            if( !valid_[j] ) {
+               values_[j] = lelem->value() * relem->value();
+               valid_ [j] = 1;
+               indices_.push_back( j );
+               minIndex = min( minIndex, j );
+               maxIndex = max( maxIndex, j );
+            }
+            else {
+               values_[j] += lelem->value() * relem->value();
+            }
+         }
+      }
+
+      if( indices_.size() + indices_.size() < maxIndex - minIndex ) {
+         std::sort( indices_.begin(), indices_.end() );
+      }
+      else {
+         indices_.clear();
+         for( size_t j=minIndex; j<=maxIndex; ++j ) {
+            if( valid_[j] ) indices_.push_back( j );
+         }
+      }
+
+      for( size_t j : indices_ ) {
+         row_.push_back( ElementType( values_[j], j ) );
+         reset( values_[j] );
+         valid_[j] = 0;
+      }
+   }
+
+   // Hash accumulation
+   else
+   {
+      const size_t capacity( prepareHash( flops ) );
+
+      for( LeftIterator lelem=lbegin; lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+         {
+            size_t pos( slot( relem->index() ) );
+            while( keys_[pos] != empty && keys_[pos] != relem->index() )
+               pos = ( pos + 1UL ) & mask_;
+
+            if( keys_[pos] == empty ) {
+               keys_   [pos] = relem->index();
+               entries_[pos] = lelem->value() * relem->value();
+            }
+            else {
+               entries_[pos] += lelem->value() * relem->value();
+            }
+         }
+      }
+
+      for( size_t pos=0UL; pos<capacity; ++pos ) {
+         if( keys_[pos] != empty ) {
+            row_.push_back( ElementType( entries_[pos], keys_[pos] ) );
+            keys_[pos] = empty;
+         }
+      }
+
+      std::sort( row_.begin(), row_.end(),
+                 []( const ElementType& a, const ElementType& b ) { return a.index() < b.index(); } );
+   }
+
+   return row_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the computed elements of the current row.
+//
+// \param k The index of the element in the range \f$[0..nonzeros-1]\f$.
+// \return Reference to the \a k-th element of the current row.
+*/
+template< typename ET >  // Element type of the resulting matrix
+inline const typename SpGemmAccumulator<ET>::ElementType&
+   SpGemmAccumulator<ET>::operator[]( size_t k ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( k < row_.size(), "Invalid element access index" );
+   return row_[k];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether a row with the given number of flops is accumulated by sorting.
+//
+// \param flops The number of scalar multiplications of the row.
+// \return \a true in case the row is accumulated by sorting, \a false if not.
+*/
+template< typename ET >  // Element type of the resulting matrix
+inline bool SpGemmAccumulator<ET>::useSort( size_t flops ) const noexcept
+{
+   return flops <= sortLimit;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a row with the given number of flops is accumulated in a dense array.
+//
+// \param flops The number of scalar multiplications of the row.
+// \return \a true in case the row is accumulated in a dense array, \a false if not.
+*/
+template< typename ET >  // Element type of the resulting matrix
+inline bool SpGemmAccumulator<ET>::useDense( size_t flops ) const noexcept
+{
+   return flops * denseRatio >= n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the dense accumulator for the next row.
+//
+// \return The size of the dense accumulator.
+//
+// This function allocates the dense accumulator on first use and resets the list of touched
+// column indices.
+*/
+template< typename ET >  // Element type of the resulting matrix
+inline size_t SpGemmAccumulator<ET>::prepareDense()
+{
+   if( valid_.size() != n_ ) {
+      values_.assign( n_, ET() );
+      valid_.assign( n_, 0 );
+   }
+
+   indices_.clear();
+
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the hash table for a row with the given number of flops.
+//
+// \param flops The number of scalar multiplications of the row.
+// \return The number of slots of the hash table.
+//
+// This function sizes the hash table to the smallest power of two that is at least twice the
+// number of flops, which limits the load factor to 0.5. The table only grows, all slots beyond
+// the current size remain empty.
+*/
+template< typename ET >  // Element type of the resulting matrix
+inline size_t SpGemmAccumulator<ET>::prepareHash( size_t flops )
+{
+   size_t capacity( 2UL );
+   shift_ = sizeof(size_t)*8UL - 1UL;
+
+   while( capacity < 2UL*flops ) {
+      capacity <<= 1;
+      --shift_;
+   }
+
+   if( keys_.size() < capacity ) {
+      keys_.resize( capacity, empty );
+      entries_.resize( capacity );
+   }
+
+   mask_ = capacity - 1UL;
+
+   return capacity;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the home slot of the given column index in the current hash table.
+//
+// \param j The column index.
+// \return The home slot of the column index.
+//
+// This function implements Fibonacci hashing, which spreads consecutive column indices over
+// the entire hash table.
+*/
+template< typename ET >  // Element type of the resulting matrix
+inline size_t SpGemmAccumulator<ET>::slot( size_t j ) const noexcept
+{
+   return static_cast<size_t>( ( static_cast<uint64_t>( j ) * 0x9E3779B97F4A7C15ULL ) >>
+                               ( shift_ + 64UL - sizeof(size_t)*8UL ) ) & mask_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the symbolic phase of the sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// This functor computes the exact number of non-zero elements of all rows of the given range of
+// row partitions of the product \f$ A*B \f$. Each partition is processed with its own
+// accumulator. It is used in combination with the smpBatch() function.
+*/
+template< typename ET     // Element type of the resulting matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+struct SpGemmSymbolicBatch
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGemmSymbolicBatch class template.
+   //
+   // \param nonzeros The number of non-zero elements per row of the product.
+   // \param accs The accumulators of the row partitions.
+   // \param bounds The first row of each row partition.
+   // \param flops The number of scalar multiplications per row of the product.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   */
+   explicit inline SpGemmSymbolicBatch( std::vector<size_t>& nonzeros,
+                                        std::vector< SpGemmAccumulator<ET> >& accs,
+                                        const std::vector<size_t>& bounds,
+                                        const std::vector<size_t>& flops,
+                                        const MT1& A, const MT2& B )
+      : nonzeros_( nonzeros )  // The number of non-zero elements per row
+      , accs_    ( accs     )  // The accumulators of the row partitions
+      , bounds_  ( bounds   )  // The first row of each row partition
+      , flops_   ( flops    )  // The number of scalar multiplications per row
+      , A_       ( A        )  // The left-hand side sparse matrix operand
+      , B_       ( B        )  // The right-hand side sparse matrix operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the number of non-zero elements of the given range of row partitions.
+   //
+   // \param index The index of the first row partition.
+   // \param n The number of row partitions.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      for( size_t p=index; p<index+n; ++p ) {
+         for( size_t i=bounds_[p]; i<bounds_[p+1UL]; ++i )
+            nonzeros_[i] = accs_[p].symbolic( A_, B_, i, flops_[i] );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<size_t>&                  nonzeros_;  //!< The number of non-zero elements per row.
+   std::vector< SpGemmAccumulator<ET> >& accs_;      //!< The accumulators of the row partitions.
+   const std::vector<size_t>&            bounds_;    //!< The first row of each row partition.
+   const std::vector<size_t>&            flops_;     //!< The number of scalar multiplications per row.
+   const MT1&                            A_;         //!< The left-hand side sparse matrix operand.
+   const MT2&                            B_;         //!< The right-hand side sparse matrix operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch operation for the numeric phase of the sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// This functor computes and appends the elements of all rows of the given range of row
+// partitions of the product \f$ A*B \f$ to a CompressedMatrix, whose capacity per row has been
+// determined by the symbolic phase. Since each partition exclusively appends to its own rows,
+// all partitions can be processed concurrently. It is used in combination with the smpBatch()
+// function.
+*/
+template< typename ET     // Element type of the resulting matrix
+        , typename Type   // Data type of the target CompressedMatrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+struct SpGemmNumericBatch
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGemmNumericBatch class template.
+   //
+   // \param C The target CompressedMatrix.
+   // \param accs The accumulators of the row partitions.
+   // \param bounds The first row of each row partition.
+   // \param flops The number of scalar multiplications per row of the product.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   */
+   explicit inline SpGemmNumericBatch( CompressedMatrix<Type,false>& C,
+                                       std::vector< SpGemmAccumulator<ET> >& accs,
+                                       const std::vector<size_t>& bounds,
+                                       const std::vector<size_t>& flops,
+                                       const MT1& A, const MT2& B )
+      : C_     ( C      )  // The target CompressedMatrix
+      , accs_  ( accs   )  // The accumulators of the row partitions
+      , bounds_( bounds )  // The first row of each row partition
+      , flops_ ( flops  )  // The number of scalar multiplications per row
+      , A_     ( A      )  // The left-hand side sparse matrix operand
+      , B_     ( B      )  // The right-hand side sparse matrix operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the elements of the given range of row partitions.
+   //
+   // \param index The index of the first row partition.
+   // \param n The number of row partitions.
+   // \return void
+   */
+   inline void operator()( size_t index, size_t n ) const {
+      for( size_t p=index; p<index+n; ++p ) {
+         SpGemmAccumulator<ET>& acc( accs_[p] );
+         for( size_t i=bounds_[p]; i<bounds_[p+1UL]; ++i ) {
+            const size_t nonzeros( acc.numeric( A_, B_, i, flops_[i] ) );
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               if( !isDefault( acc[k].value() ) )
+                  C_.append( i, acc[k].index(), acc[k].value() );
+            }
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   CompressedMatrix<Type,false>&         C_;       //!< The target CompressedMatrix.
+   std::vector< SpGemmAccumulator<ET> >& accs_;    //!< The accumulators of the row partitions.
+   const std::vector<size_t>&            bounds_;  //!< The first row of each row partition.
+   const std::vector<size_t>&            flops_;   //!< The number of scalar multiplications per row.
+   const MT1&                            A_;       //!< The left-hand side sparse matrix operand.
+   const MT2&                            B_;       //!< The right-hand side sparse matrix operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/SPARSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of scalar multiplications per row of the product \f$ A*B \f$.
+// \ingroup sparse_matrix
+//
+// \param flops The resulting number of scalar multiplications per row.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \return The total number of scalar multiplications.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline size_t spgemmFlops( std::vector<size_t>& flops, const MT1& A, const MT2& B )
+{
+   flops.assign( A.rows(), 0UL );
+
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      const auto end( A.end(i) );
+      for( auto element=A.begin(i); element!=end; ++element )
+         flops[i] += B.nonZeros( element->index() );
+      total += flops[i];
+   }
+
+   return total;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of two row-major sparse matrices (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target left-hand side row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \return void
+//
+// This function computes the product of two row-major sparse matrices in two phases. The
+// symbolic phase determines the exact number of non-zero elements of the result, which is
+// reserved at once. The numeric phase subsequently computes and appends the elements row by
+// row. The target matrix \a C is expected to be reset and to have the size of the product.
+// The memory requirements of the computation are independent of the number of columns unless
+// the rows of the product are comparatively dense (see the SpGemmAccumulator class template).
+*/
+template< typename MT     // Type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void spgemm( SparseMatrix<MT,false>& C, const MT1& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef MultTrait_< ElementType_<MT1>, ElementType_<MT2> >  ET;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()   , "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+
+   std::vector<size_t> flops;
+   spgemmFlops( flops, A, B );
+
+   SpGemmAccumulator<ET> acc( B.columns() );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<A.rows(); ++i )
+      nonzeros += acc.symbolic( A, B, i, flops[i] );
+
+   (~C).reserve( nonzeros );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      const size_t n( acc.numeric( A, B, i, flops[i] ) );
+      for( size_t k=0UL; k<n; ++k ) {
+         if( !isDefault( acc[k].value() ) )
+            (~C).append( i, acc[k].index(), acc[k].value() );
+      }
+      (~C).finalize( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of two row-major sparse matrices (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target left-hand side row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \return void
+//
+// This function is the fallback for all row-major sparse matrices except CompressedMatrix,
+// which do not support the concurrent appending of elements to different rows. The product is
+// computed serially by means of the spgemm() function.
+*/
+template< typename MT     // Type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void smpSpgemm( SparseMatrix<MT,false>& C, const MT1& A, const MT2& B )
+{
+   spgemm( ~C, A, B );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of two row-major sparse matrices (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target left-hand side row-major CompressedMatrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \return void
+//
+// This function computes the product of two row-major sparse matrices in parallel. The rows
+// are split into one partition per thread such that all partitions require approximately the
+// same number of scalar multiplications. Each partition owns an accumulator, which is reused
+// for all of its rows in both the symbolic and the numeric phase. The symbolic phase computes
+// the exact capacity of all rows of the result, which allows the numeric phase to append the
+// elements of all partitions concurrently. In case the multiplication requires less scalar
+// multiplications than specified by the according SMP threshold or in case only a single
+// thread is available, the multiplication is executed serially.
+*/
+template< typename Type   // Data type of the target CompressedMatrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void smpSpgemm( CompressedMatrix<Type,false>& C, const MT1& A, const MT2& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef MultTrait_< ElementType_<MT1>, ElementType_<MT2> >  ET;
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()   , "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( C.rows() == A.rows()      , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( C.columns() == B.columns(), "Invalid number of columns" );
+
+   const size_t m( A.rows() );
+   const size_t parts( min( getNumThreads(), m ) );
+
+   std::vector<size_t> flops;
+   const size_t total( spgemmFlops( flops, A, B ) );
+
+   if( parts < 2UL || total < SMP_SMATSMATMULT_THRESHOLD ) {
+      spgemm( C, A, B );
+      return;
+   }
+
+   std::vector<size_t> bounds( parts+1UL, m );
+   bounds[0] = 0UL;
+
+   size_t sum( 0UL ), p( 1UL );
+   for( size_t i=0UL; i<m && p<parts; ++i ) {
+      sum += flops[i];
+      while( p < parts && sum*parts >= p*total )
+         bounds[p++] = i+1UL;
+   }
+
+   std::vector< SpGemmAccumulator<ET> > accs( parts, SpGemmAccumulator<ET>( B.columns() ) );
+   std::vector<size_t> nonzeros( m );
+
+   smpBatch( parts, 1UL, 2UL,
+             SpGemmSymbolicBatch<ET,MT1,MT2>( nonzeros, accs, bounds, flops, A, B ) );
+
+   CompressedMatrix<Type,false> tmp( m, B.columns(), nonzeros );
+
+   smpBatch( parts, 1UL, 2UL,
+             SpGemmNumericBatch<ET,Type,MT1,MT2>( tmp, accs, bounds, flops, A, B ) );
+
+   swap( C, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -77,9 +77,32 @@ struct HasSIMDAbsHelper
 template< typename T >
 struct HasSIMDAbsHelper< T, EnableIf_< And< IsNumeric<T>, IsIntegral<T>, IsSigned<T> > > >
 {
-   enum : bool { value = ( bool( BLAZE_SSSE3_MODE ) && sizeof(T) <= 4UL ) ||
-                         ( bool( BLAZE_AVX2_MODE  ) && sizeof(T) <= 4UL ) ||
-                         ( bool( BLAZE_MIC_MODE   ) && sizeof(T) >= 4UL ) };
+   enum : bool { value = ( bool( BLAZE_SSSE3_MODE   ) && sizeof(T) <= 4UL ) ||
+                         ( bool( BLAZE_AVX2_MODE    ) && sizeof(T) <= 4UL ) ||
+                         ( bool( BLAZE_AVX512F_MODE ) && sizeof(T) >= 4UL ) ||
+                         ( bool( BLAZE_MIC_MODE     ) && sizeof(T) >= 4UL ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template<>
+struct HasSIMDAbsHelper< float >
+{
+   enum : bool { value = bool( BLAZE_SSE_MODE ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template<>
+struct HasSIMDAbsHelper< double >
+{
+   enum : bool { value = bool( BLAZE_SSE2_MODE ) };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -102,7 +125,7 @@ struct HasSIMDAbsHelper< T, EnableIf_< And< IsNumeric<T>, IsIntegral<T>, IsSigne
    blaze::HasSIMDAbs< short >::Type          // Results in TrueType
    blaze::HasSIMDAbs< int >                  // Is derived from TrueType
    blaze::HasSIMDAbs< unsigned int >::value  // Evaluates to 0
-   blaze::HasSIMDAbs< double >::Type         // Results in FalseType
+   blaze::HasSIMDAbs< double >::Type         // Results in TrueType
    blaze::HasSIMDAbs< complex<int> >         // Is derived from FalseType
    \endcode
 */
@@ -0,0 +1,130 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsBlockCompressedMatrix.h
+//  \brief Header file for the IsBlockCompressedMatrix type trait
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISBLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_TYPETRAITS_ISBLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for block compressed matrices.
+// \ingroup math_type_traits
+//
+// This type trait tests whether or not the given template parameter is an instance of the
+// BlockCompressedMatrix class template. In case the type is a BlockCompressedMatrix, the \a value
+// member constant is set to \a true, the nested type definition \a Type is \a TrueType, and the
+// class derives from \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType,
+// and the class derives from \a FalseType.
+
+   \code
+   blaze::IsBlockCompressedMatrix< BlockCompressedMatrix<double,3UL> >::value              // Evaluates to 1
+   blaze::IsBlockCompressedMatrix< const BlockCompressedMatrix<float,6UL,columnMajor> >::Type  // Results in TrueType
+   blaze::IsBlockCompressedMatrix< volatile BlockCompressedMatrix<int,2UL> >               // Is derived from TrueType
+   blaze::IsBlockCompressedMatrix< CompressedMatrix<double> >::value                       // Evaluates to 0
+   blaze::IsBlockCompressedMatrix< const DynamicMatrix<float> >::Type                      // Results in FalseType
+   blaze::IsBlockCompressedMatrix< volatile SellMatrix<int> >                              // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsBlockCompressedMatrix : public FalseType
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsBlockCompressedMatrix type trait for BlockCompressedMatrix instances.
+// \ingroup math_type_traits
+*/
+template< typename Type, size_t B, bool SO >
+struct IsBlockCompressedMatrix< BlockCompressedMatrix<Type,B,SO> > : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsBlockCompressedMatrix type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsBlockCompressedMatrix< const T > : public IsBlockCompressedMatrix<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsBlockCompressedMatrix type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsBlockCompressedMatrix< volatile T > : public IsBlockCompressedMatrix<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsBlockCompressedMatrix type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsBlockCompressedMatrix< const volatile T > : public IsBlockCompressedMatrix<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
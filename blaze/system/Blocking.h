@@ -64,6 +64,10 @@ constexpr size_t DMATDMATMULT_DEFAULT_KBLOCK_SIZE = 128UL;
 constexpr size_t TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE = 128UL;
 constexpr size_t TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE =  64UL;
 constexpr size_t TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE = 128UL;
+
+constexpr size_t TRANSPOSE_DEFAULT_BLOCK_SIZE = 64UL;
+
+constexpr size_t FACTORIZATION_DEFAULT_BLOCK_SIZE = 32UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -79,6 +83,10 @@ constexpr size_t DMATDMATMULT_DEBUG_KBLOCK_SIZE =  8UL;
 constexpr size_t TDMATTDMATMULT_DEBUG_IBLOCK_SIZE = 64UL;
 constexpr size_t TDMATTDMATMULT_DEBUG_JBLOCK_SIZE =  8UL;
 constexpr size_t TDMATTDMATMULT_DEBUG_KBLOCK_SIZE =  8UL;
+
+constexpr size_t TRANSPOSE_DEBUG_BLOCK_SIZE = 16UL;
+
+constexpr size_t FACTORIZATION_DEBUG_BLOCK_SIZE = 2UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -94,6 +102,10 @@ constexpr size_t DMATDMATMULT_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DE
 constexpr size_t TDMATTDMATMULT_IBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_IBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE );
 constexpr size_t TDMATTDMATMULT_JBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_JBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE );
 constexpr size_t TDMATTDMATMULT_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_KBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE );
+
+constexpr size_t TRANSPOSE_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TRANSPOSE_DEBUG_BLOCK_SIZE : TRANSPOSE_DEFAULT_BLOCK_SIZE );
+
+constexpr size_t FACTORIZATION_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? FACTORIZATION_DEBUG_BLOCK_SIZE : FACTORIZATION_DEFAULT_BLOCK_SIZE );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -122,6 +134,10 @@ BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_IBLOCK_SIZE >= 64UL && blaze::TDMATTD
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_JBLOCK_SIZE >=  4UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_KBLOCK_SIZE >=  4UL );
 
+BLAZE_STATIC_ASSERT( blaze::TRANSPOSE_BLOCK_SIZE >= 16UL && blaze::TRANSPOSE_BLOCK_SIZE % 16UL == 0UL );
+
+BLAZE_STATIC_ASSERT( blaze::FACTORIZATION_BLOCK_SIZE >= 2UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
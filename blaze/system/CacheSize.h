@@ -68,6 +68,8 @@
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::cacheSize > 100000UL && blaze::cacheSize < 100000000UL );
+BLAZE_STATIC_ASSERT( blaze::l1CacheSize >= 4096UL && blaze::l1CacheSize < blaze::l2CacheSize );
+BLAZE_STATIC_ASSERT( blaze::l2CacheSize <= blaze::cacheSize );
 
 }
 /*! \endcond */
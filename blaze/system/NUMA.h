@@ -0,0 +1,136 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/NUMA.h
+//  \brief System settings for the NUMA policy
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_SYSTEM_NUMA_H_
+#define _BLAZE_SYSTEM_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/config/NUMA.h>
+#include <blaze/system/SMP.h>
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH POLICY CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel first-touch initialization.
+// \ingroup system
+//
+// This compilation switch enables/disables the parallel first-touch initialization of dense
+// vectors and matrices. It is enabled in case the first-touch NUMA policy is selected (see the
+// \c BLAZE_NUMA_POLICY switch in the <tt>./blaze/config/NUMA.h</tt> configuration file) and
+// any shared memory parallelization is active.
+*/
+#if BLAZE_NUMA_POLICY == 1 && ( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#define BLAZE_NUMA_FIRST_TOUCH 1
+#else
+#define BLAZE_NUMA_FIRST_TOUCH 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The OpenMP schedule of the SMP assignments.
+// \ingroup system
+//
+// This macro specifies the schedule of the OpenMP loops distributing the partitions of an
+// SMP assignment among the threads of the team. In case the parallel first-touch initialization
+// is enabled, a static schedule is used in order to guarantee that the i-th partition is always
+// processed by the i-th thread. Otherwise the partitions are distributed dynamically.
+*/
+#if BLAZE_NUMA_FIRST_TOUCH
+#define BLAZE_OPENMP_SCHEDULE static,1
+#else
+#define BLAZE_OPENMP_SCHEDULE dynamic,1
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTERLEAVE POLICY CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the interleaved allocation.
+// \ingroup system
+//
+// This compilation switch enables/disables the interleaved allocation of large arrays. It is
+// enabled in case the interleave NUMA policy is selected (see the \c BLAZE_NUMA_POLICY switch
+// in the <tt>./blaze/config/NUMA.h</tt> configuration file) and the system is a Linux system.
+*/
+#if BLAZE_NUMA_POLICY == 2 && defined(__linux__)
+#define BLAZE_NUMA_INTERLEAVE 1
+#else
+#define BLAZE_NUMA_INTERLEAVE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD AFFINITY CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!rief Compilation switch for the pinning of threads to cores.
+// \ingroup system
+//
+// This compilation switch indicates whether threads can be pinned to specific cores (see the
+// pinThread() function). Thread pinning is currently only supported on Linux systems.
+*/
+#if defined(__linux__)
+#define BLAZE_THREAD_PINNING 1
+#else
+#define BLAZE_THREAD_PINNING 0
+#endif
+//*************************************************************************************************
+
+#endif
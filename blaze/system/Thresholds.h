@@ -40,7 +40,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <string>
 #include <blaze/system/Debugging.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -248,18 +254,18 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : DMATDVECMULT_USER_THRESHOLD   );
-constexpr size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : TDMATDVECMULT_USER_THRESHOLD  );
-constexpr size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : TDVECDMATMULT_USER_THRESHOLD  );
-constexpr size_t TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : TDVECTDMATMULT_USER_THRESHOLD );
-constexpr size_t DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : DMATDMATMULT_USER_THRESHOLD   );
-constexpr size_t DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : DMATTDMATMULT_USER_THRESHOLD  );
-constexpr size_t TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : TDMATDMATMULT_USER_THRESHOLD  );
-constexpr size_t TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : TDMATTDMATMULT_USER_THRESHOLD );
-constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : DMATSMATMULT_USER_THRESHOLD   );
-constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : TDMATSMATMULT_USER_THRESHOLD  );
-constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : TSMATDMATMULT_USER_THRESHOLD  );
-constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : TSMATTDMATMULT_USER_THRESHOLD );
+constexpr size_t DMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : DMATDVECMULT_USER_THRESHOLD   );
+constexpr size_t TDMATDVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : TDMATDVECMULT_USER_THRESHOLD  );
+constexpr size_t TDVECDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : TDVECDMATMULT_USER_THRESHOLD  );
+constexpr size_t TDVECTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : TDVECTDMATMULT_USER_THRESHOLD );
+constexpr size_t DMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : DMATDMATMULT_USER_THRESHOLD   );
+constexpr size_t DMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : DMATTDMATMULT_USER_THRESHOLD  );
+constexpr size_t TDMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : TDMATDMATMULT_USER_THRESHOLD  );
+constexpr size_t TDMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : TDMATTDMATMULT_USER_THRESHOLD );
+constexpr size_t DMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : DMATSMATMULT_USER_THRESHOLD   );
+constexpr size_t TDMATSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : TDMATSMATMULT_USER_THRESHOLD  );
+constexpr size_t TSMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : TSMATDMATMULT_USER_THRESHOLD  );
+constexpr size_t TSMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : TSMATTDMATMULT_USER_THRESHOLD );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -908,56 +914,1020 @@ constexpr size_t SMP_DVECTDVECMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DVECREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the reduction of a dense vector can be executed in
+// parallel. In case the number of elements of the dense vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the reduction of a dense matrix can be executed in
+// parallel. In case the number of elements of the dense matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batch operation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_BATCH_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a batched operation on many small matrices and vectors can
+// be executed in parallel. In case the number of matrices or vectors of the batch is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of matrices or
+// vectors is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_BATCH_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t SMP_DVECASSIGN_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : SMP_DVECASSIGN_USER_THRESHOLD     );
+constexpr size_t SMP_DVECDVECADD_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : SMP_DVECDVECADD_USER_THRESHOLD    );
+constexpr size_t SMP_DVECDVECSUB_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : SMP_DVECDVECSUB_USER_THRESHOLD    );
+constexpr size_t SMP_DVECDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : SMP_DVECDVECMULT_USER_THRESHOLD   );
+constexpr size_t SMP_DVECDVECDIV_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : SMP_DVECDVECDIV_USER_THRESHOLD    );
+constexpr size_t SMP_DVECSCALARMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : SMP_DVECSCALARMULT_USER_THRESHOLD );
+constexpr size_t SMP_DMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : SMP_DMATDVECMULT_USER_THRESHOLD   );
+constexpr size_t SMP_TDMATDVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : SMP_TDMATDVECMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDVECDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : SMP_TDVECDMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : SMP_TDVECTDMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_DMATSVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : SMP_DMATSVECMULT_USER_THRESHOLD   );
+constexpr size_t SMP_TDMATSVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : SMP_TDMATSVECMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSVECDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : SMP_TSVECDMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : SMP_TSVECTDMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_SMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : SMP_SMATDVECMULT_USER_THRESHOLD   );
+constexpr size_t SMP_TSMATDVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : SMP_TSMATDVECMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDVECSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : SMP_TDVECSMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : SMP_TDVECTSMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_SMATSVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : SMP_SMATSVECMULT_USER_THRESHOLD   );
+constexpr size_t SMP_TSMATSVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : SMP_TSMATSVECMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSVECSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : SMP_TSVECSMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : SMP_TSVECTSMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_DMATASSIGN_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : SMP_DMATASSIGN_USER_THRESHOLD     );
+constexpr size_t SMP_DMATDMATADD_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : SMP_DMATDMATADD_USER_THRESHOLD    );
+constexpr size_t SMP_DMATTDMATADD_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : SMP_DMATTDMATADD_USER_THRESHOLD   );
+constexpr size_t SMP_DMATDMATSUB_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : SMP_DMATDMATSUB_USER_THRESHOLD    );
+constexpr size_t SMP_DMATTDMATSUB_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : SMP_DMATTDMATSUB_USER_THRESHOLD   );
+constexpr size_t SMP_DMATSCALARMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : SMP_DMATSCALARMULT_USER_THRESHOLD );
+constexpr size_t SMP_DMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : SMP_DMATDMATMULT_USER_THRESHOLD   );
+constexpr size_t SMP_DMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : SMP_DMATTDMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : SMP_TDMATDMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : SMP_TDMATTDMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_DMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : SMP_DMATSMATMULT_USER_THRESHOLD   );
+constexpr size_t SMP_DMATTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : SMP_DMATTSMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDMATSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : SMP_TDMATSMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : SMP_TDMATTSMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_SMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : SMP_SMATDMATMULT_USER_THRESHOLD   );
+constexpr size_t SMP_SMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : SMP_SMATTDMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : SMP_TSMATDMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : SMP_TSMATTDMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_SMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : SMP_SMATSMATMULT_USER_THRESHOLD   );
+constexpr size_t SMP_SMATTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : SMP_SMATTSMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSMATSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : SMP_TSMATSMATMULT_USER_THRESHOLD  );
+constexpr size_t SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : SMP_TSMATTSMATMULT_USER_THRESHOLD );
+constexpr size_t SMP_DVECTDVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMULT_DEBUG_THRESHOLD  : SMP_DVECTDVECMULT_USER_THRESHOLD  );
+constexpr size_t SMP_DVECREDUCE_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : SMP_DVECREDUCE_USER_THRESHOLD     );
+constexpr size_t SMP_DMATREDUCE_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : SMP_DMATREDUCE_USER_THRESHOLD     );
+constexpr size_t SMP_BATCH_DEFAULT_THRESHOLD          = ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD          : SMP_BATCH_USER_THRESHOLD          );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME THRESHOLDS
+//
+//=================================================================================================
+
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t DMATDVECMULT_THRESHOLD       = DMATDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t TDMATDVECMULT_THRESHOLD      = TDMATDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t TDVECDMATMULT_THRESHOLD      = TDVECDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t TDVECTDMATMULT_THRESHOLD     = TDVECTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t DMATDMATMULT_THRESHOLD       = DMATDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t DMATTDMATMULT_THRESHOLD      = DMATTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t TDMATDMATMULT_THRESHOLD      = TDMATDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t TDMATTDMATMULT_THRESHOLD     = TDMATTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t DMATSMATMULT_THRESHOLD       = DMATSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t TDMATSMATMULT_THRESHOLD      = TDMATSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t TSMATDMATMULT_THRESHOLD      = TSMATDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t TSMATTDMATMULT_THRESHOLD     = TSMATTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECASSIGN_THRESHOLD     = SMP_DVECASSIGN_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECDVECADD_THRESHOLD    = SMP_DVECDVECADD_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = SMP_DVECDVECSUB_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = SMP_DVECDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = SMP_DVECDVECDIV_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = SMP_DVECSCALARMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = SMP_DMATDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = SMP_TDMATDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = SMP_TDVECDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = SMP_DMATSVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = SMP_TDMATSVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = SMP_TSVECDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = SMP_SMATDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = SMP_TSMATDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = SMP_TDVECSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = SMP_SMATSVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = SMP_TSMATSVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = SMP_TSVECSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATASSIGN_THRESHOLD     = SMP_DMATASSIGN_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATDMATADD_THRESHOLD    = SMP_DMATDMATADD_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = SMP_DMATTDMATADD_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = SMP_DMATDMATSUB_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = SMP_DMATTDMATSUB_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = SMP_DMATSCALARMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = SMP_DMATDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = SMP_DMATTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = SMP_TDMATDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = SMP_DMATSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = SMP_DMATTSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = SMP_TDMATSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = SMP_SMATDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = SMP_SMATTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = SMP_TSMATDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = SMP_SMATSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = SMP_SMATTSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = SMP_TSMATSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECTDVECMULT_THRESHOLD  = SMP_DVECTDVECMULT_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DVECREDUCE_THRESHOLD     = SMP_DVECREDUCE_DEFAULT_THRESHOLD;
+constexpr size_t SMP_DMATREDUCE_THRESHOLD     = SMP_DMATREDUCE_DEFAULT_THRESHOLD;
+constexpr size_t SMP_BATCH_THRESHOLD          = SMP_BATCH_DEFAULT_THRESHOLD;
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The total number of thresholds in the threshold registry.
+*/
+constexpr size_t THRESHOLD_COUNT = 60UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The number of BLAS thresholds in the threshold registry.
+//
+// The BLAS thresholds occupy the first entries of the threshold registry. In contrast to the
+// SMP thresholds, their value is required to be larger than 0.
+*/
+constexpr size_t BLAS_THRESHOLD_COUNT = 12UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Handle for a runtime threshold of the Blaze library.
+// \ingroup config
+//
+// In case the \c BLAZE_USE_RUNTIME_THRESHOLDS configuration switch is activated, all thresholds
+// of the Blaze library (as for instance the blaze::DMATDVECMULT_THRESHOLD or the
+// blaze::SMP_DVECASSIGN_THRESHOLD) are represented by a Threshold handle, which implicitly
+// converts to the current value of the according threshold. The values of all thresholds are
+// stored in a runtime registry, which is initialized with the compile time settings of the
+// configuration file <tt>./blaze/config/Thresholds.h</tt> (or the according debug values in
+// case the Blaze debug mode is active). These defaults can be adapted to the characteristics
+// of the target platform in the following ways (in increasing order of precedence):
+//
+//  - via a threshold profile, whose name is given by the \c BLAZE_THRESHOLD_PROFILE environment
+//    variable (see the blaze::loadThresholds() function for the format of a profile);
+//  - via environment variables named after the thresholds with an additional \c BLAZE_ prefix
+//    (as for instance \c BLAZE_SMP_DVECASSIGN_THRESHOLD);
+//  - via the blaze::setThreshold() and blaze::loadThresholds() functions.
+//
+// The environment variables are evaluated during the dynamic initialization of the program.
+// Invalid settings in the environment variables or in the profile are ignored. The thresholds
+// can be queried and changed at any time, also while other threads are executing Blaze
+// operations. The following example demonstrates how to query and change the threshold for
+// the parallel dense vector assignment:
+
+   \code
+   const size_t threshold = blaze::SMP_DVECASSIGN_THRESHOLD;  // Query of the current value
+
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 50000UL );  // Change of the threshold
+   \endcode
+
+// A threshold profile for a specific target platform can be generated by means of the
+// \c autotune tool of the Blaze benchmark suite.
+*/
+class Threshold
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit constexpr Threshold( size_t index ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator size_t() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t      value       () const noexcept;
+   inline size_t      defaultValue() const noexcept;
+   inline const char* name        () const noexcept;
+   inline size_t      index       () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t index_;  //!< The index of the threshold in the threshold registry.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the name of the threshold with the given registry index.
+//
+// \param index The index of the threshold in the threshold registry.
+// \return The name of the threshold.
+*/
+inline const char* getThresholdName( size_t index ) noexcept
+{
+   static const char* const names[THRESHOLD_COUNT] = {
+      "DMATDVECMULT_THRESHOLD",
+      "TDMATDVECMULT_THRESHOLD",
+      "TDVECDMATMULT_THRESHOLD",
+      "TDVECTDMATMULT_THRESHOLD",
+      "DMATDMATMULT_THRESHOLD",
+      "DMATTDMATMULT_THRESHOLD",
+      "TDMATDMATMULT_THRESHOLD",
+      "TDMATTDMATMULT_THRESHOLD",
+      "DMATSMATMULT_THRESHOLD",
+      "TDMATSMATMULT_THRESHOLD",
+      "TSMATDMATMULT_THRESHOLD",
+      "TSMATTDMATMULT_THRESHOLD",
+      "SMP_DVECASSIGN_THRESHOLD",
+      "SMP_DVECDVECADD_THRESHOLD",
+      "SMP_DVECDVECSUB_THRESHOLD",
+      "SMP_DVECDVECMULT_THRESHOLD",
+      "SMP_DVECDVECDIV_THRESHOLD",
+      "SMP_DVECSCALARMULT_THRESHOLD",
+      "SMP_DMATDVECMULT_THRESHOLD",
+      "SMP_TDMATDVECMULT_THRESHOLD",
+      "SMP_TDVECDMATMULT_THRESHOLD",
+      "SMP_TDVECTDMATMULT_THRESHOLD",
+      "SMP_DMATSVECMULT_THRESHOLD",
+      "SMP_TDMATSVECMULT_THRESHOLD",
+      "SMP_TSVECDMATMULT_THRESHOLD",
+      "SMP_TSVECTDMATMULT_THRESHOLD",
+      "SMP_SMATDVECMULT_THRESHOLD",
+      "SMP_TSMATDVECMULT_THRESHOLD",
+      "SMP_TDVECSMATMULT_THRESHOLD",
+      "SMP_TDVECTSMATMULT_THRESHOLD",
+      "SMP_SMATSVECMULT_THRESHOLD",
+      "SMP_TSMATSVECMULT_THRESHOLD",
+      "SMP_TSVECSMATMULT_THRESHOLD",
+      "SMP_TSVECTSMATMULT_THRESHOLD",
+      "SMP_DMATASSIGN_THRESHOLD",
+      "SMP_DMATDMATADD_THRESHOLD",
+      "SMP_DMATTDMATADD_THRESHOLD",
+      "SMP_DMATDMATSUB_THRESHOLD",
+      "SMP_DMATTDMATSUB_THRESHOLD",
+      "SMP_DMATSCALARMULT_THRESHOLD",
+      "SMP_DMATDMATMULT_THRESHOLD",
+      "SMP_DMATTDMATMULT_THRESHOLD",
+      "SMP_TDMATDMATMULT_THRESHOLD",
+      "SMP_TDMATTDMATMULT_THRESHOLD",
+      "SMP_DMATSMATMULT_THRESHOLD",
+      "SMP_DMATTSMATMULT_THRESHOLD",
+      "SMP_TDMATSMATMULT_THRESHOLD",
+      "SMP_TDMATTSMATMULT_THRESHOLD",
+      "SMP_SMATDMATMULT_THRESHOLD",
+      "SMP_SMATTDMATMULT_THRESHOLD",
+      "SMP_TSMATDMATMULT_THRESHOLD",
+      "SMP_TSMATTDMATMULT_THRESHOLD",
+      "SMP_SMATSMATMULT_THRESHOLD",
+      "SMP_SMATTSMATMULT_THRESHOLD",
+      "SMP_TSMATSMATMULT_THRESHOLD",
+      "SMP_TSMATTSMATMULT_THRESHOLD",
+      "SMP_DVECTDVECMULT_THRESHOLD",
+      "SMP_DVECREDUCE_THRESHOLD",
+      "SMP_DMATREDUCE_THRESHOLD",
+      "SMP_BATCH_THRESHOLD"
+   };
+
+   BLAZE_INTERNAL_ASSERT( index < THRESHOLD_COUNT, "Invalid threshold index" );
+
+   return names[index];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the compile time default of the threshold with the given registry index.
+//
+// \param index The index of the threshold in the threshold registry.
+// \return The compile time default of the threshold.
+*/
+inline size_t getThresholdDefault( size_t index ) noexcept
+{
+   static constexpr size_t defaults[THRESHOLD_COUNT] = {
+      DMATDVECMULT_DEFAULT_THRESHOLD,
+      TDMATDVECMULT_DEFAULT_THRESHOLD,
+      TDVECDMATMULT_DEFAULT_THRESHOLD,
+      TDVECTDMATMULT_DEFAULT_THRESHOLD,
+      DMATDMATMULT_DEFAULT_THRESHOLD,
+      DMATTDMATMULT_DEFAULT_THRESHOLD,
+      TDMATDMATMULT_DEFAULT_THRESHOLD,
+      TDMATTDMATMULT_DEFAULT_THRESHOLD,
+      DMATSMATMULT_DEFAULT_THRESHOLD,
+      TDMATSMATMULT_DEFAULT_THRESHOLD,
+      TSMATDMATMULT_DEFAULT_THRESHOLD,
+      TSMATTDMATMULT_DEFAULT_THRESHOLD,
+      SMP_DVECASSIGN_DEFAULT_THRESHOLD,
+      SMP_DVECDVECADD_DEFAULT_THRESHOLD,
+      SMP_DVECDVECSUB_DEFAULT_THRESHOLD,
+      SMP_DVECDVECMULT_DEFAULT_THRESHOLD,
+      SMP_DVECDVECDIV_DEFAULT_THRESHOLD,
+      SMP_DVECSCALARMULT_DEFAULT_THRESHOLD,
+      SMP_DMATDVECMULT_DEFAULT_THRESHOLD,
+      SMP_TDMATDVECMULT_DEFAULT_THRESHOLD,
+      SMP_TDVECDMATMULT_DEFAULT_THRESHOLD,
+      SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD,
+      SMP_DMATSVECMULT_DEFAULT_THRESHOLD,
+      SMP_TDMATSVECMULT_DEFAULT_THRESHOLD,
+      SMP_TSVECDMATMULT_DEFAULT_THRESHOLD,
+      SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD,
+      SMP_SMATDVECMULT_DEFAULT_THRESHOLD,
+      SMP_TSMATDVECMULT_DEFAULT_THRESHOLD,
+      SMP_TDVECSMATMULT_DEFAULT_THRESHOLD,
+      SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD,
+      SMP_SMATSVECMULT_DEFAULT_THRESHOLD,
+      SMP_TSMATSVECMULT_DEFAULT_THRESHOLD,
+      SMP_TSVECSMATMULT_DEFAULT_THRESHOLD,
+      SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD,
+      SMP_DMATASSIGN_DEFAULT_THRESHOLD,
+      SMP_DMATDMATADD_DEFAULT_THRESHOLD,
+      SMP_DMATTDMATADD_DEFAULT_THRESHOLD,
+      SMP_DMATDMATSUB_DEFAULT_THRESHOLD,
+      SMP_DMATTDMATSUB_DEFAULT_THRESHOLD,
+      SMP_DMATSCALARMULT_DEFAULT_THRESHOLD,
+      SMP_DMATDMATMULT_DEFAULT_THRESHOLD,
+      SMP_DMATTDMATMULT_DEFAULT_THRESHOLD,
+      SMP_TDMATDMATMULT_DEFAULT_THRESHOLD,
+      SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD,
+      SMP_DMATSMATMULT_DEFAULT_THRESHOLD,
+      SMP_DMATTSMATMULT_DEFAULT_THRESHOLD,
+      SMP_TDMATSMATMULT_DEFAULT_THRESHOLD,
+      SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD,
+      SMP_SMATDMATMULT_DEFAULT_THRESHOLD,
+      SMP_SMATTDMATMULT_DEFAULT_THRESHOLD,
+      SMP_TSMATDMATMULT_DEFAULT_THRESHOLD,
+      SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD,
+      SMP_SMATSMATMULT_DEFAULT_THRESHOLD,
+      SMP_SMATTSMATMULT_DEFAULT_THRESHOLD,
+      SMP_TSMATSMATMULT_DEFAULT_THRESHOLD,
+      SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD,
+      SMP_DVECTDVECMULT_DEFAULT_THRESHOLD,
+      SMP_DVECREDUCE_DEFAULT_THRESHOLD,
+      SMP_DMATREDUCE_DEFAULT_THRESHOLD,
+      SMP_BATCH_DEFAULT_THRESHOLD
+   };
+
+   BLAZE_INTERNAL_ASSERT( index < THRESHOLD_COUNT, "Invalid threshold index" );
+
+   return defaults[index];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the registry index of the threshold with the given name.
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \return The index of the threshold, \c THRESHOLD_COUNT in case the name is unknown.
+*/
+inline size_t findThreshold( const std::string& name ) noexcept
+{
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      if( name == getThresholdName( i ) )
+         return i;
+   }
+
+   return THRESHOLD_COUNT;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given value is a valid setting for the specified threshold.
+//
+// \param index The index of the threshold in the threshold registry.
+// \param value The value to be checked.
+// \return \a true if the value is a valid setting, \a false if not.
+*/
+inline bool isValidThreshold( size_t index, size_t value ) noexcept
+{
+   return ( index >= BLAS_THRESHOLD_COUNT || value > 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of the given string to a value for the specified threshold.
+//
+// \param str The string to be converted.
+// \param index The index of the threshold in the threshold registry.
+// \param value The threshold value to be set.
+// \return \a true in case of a valid setting, \a false if not.
+//
+// This function converts the given string of decimal digits to a value for the specified
+// threshold. In case the string does not represent a valid setting, \a value is not changed.
+*/
+inline bool parseThreshold( const std::string& str, size_t index, size_t& value ) noexcept
+{
+   if( str.empty() || str.find_first_not_of( "0123456789" ) != std::string::npos )
+      return false;
+
+   size_t tmp( 0UL );
+
+   for( char c : str ) {
+      const size_t digit( static_cast<size_t>( c - '0' ) );
+      if( tmp > ( size_t(-1) - digit ) / 10UL )
+         return false;
+      tmp = tmp*10UL + digit;
+   }
+
+   if( !isValidThreshold( index, tmp ) )
+      return false;
+
+   value = tmp;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the threshold settings of the given threshold profile.
+//
+// \param file The name of the threshold profile.
+// \param values The array of threshold values to be updated.
+// \param error The description of the first error in the threshold profile.
+// \return \a true if all settings of the profile are valid, \a false if not.
+//
+// This function updates the given threshold values with all valid settings of the given
+// threshold profile. Invalid settings are skipped, but the first error is reported via
+// \a error.
+*/
+inline bool readThresholds( const std::string& file, size_t* values, std::string& error )
+{
+   std::ifstream in( file.c_str() );
+
+   if( !in ) {
+      error = "Unable to open threshold profile '" + file + "'";
+      return false;
+   }
+
+   std::string line;
+   size_t lineNumber( 0UL );
+   bool valid( true );
+
+   while( std::getline( in, line ) )
+   {
+      ++lineNumber;
+
+      const size_t comment( line.find( '#' ) );
+      if( comment != std::string::npos )
+         line.erase( comment );
+
+      const size_t first( line.find_first_not_of( " \t\r" ) );
+      if( first == std::string::npos )
+         continue;
+
+      const size_t separator( line.find( '=' ) );
+      const size_t nameEnd  ( line.find_last_not_of( " \t\r", separator-1UL ) );
+      const size_t valueBegin( line.find_first_not_of( " \t\r", separator+1UL ) );
+      const size_t valueEnd  ( line.find_last_not_of( " \t\r" ) );
+
+      const size_t index( ( separator != std::string::npos && separator > first )
+                          ?( findThreshold( line.substr( first, nameEnd-first+1UL ) ) )
+                          :( THRESHOLD_COUNT ) );
+
+      if( index == THRESHOLD_COUNT || valueBegin == std::string::npos ||
+          !parseThreshold( line.substr( valueBegin, valueEnd-valueBegin+1UL ),
+                           index, values[index] ) )
+      {
+         if( valid )
+            error = "Invalid setting in line " + std::to_string( lineNumber ) +
+                    " of threshold profile '" + file + "'";
+         valid = false;
+      }
+   }
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registry for the current values of all thresholds.
+//
+// The ThresholdRegistry stores the current values of all thresholds in namespace-scope atomic
+// variables, which are constant-initialized with the compile time defaults. Therefore reading
+// a threshold does not require any initialization check and changing a threshold while other
+// threads are reading it does not result in a data race. The settings of the environment are
+// applied during the dynamic initialization of the program (see initializeThresholds()). Note
+// that the template parameter only serves the purpose to define the static data members within
+// the header file.
+*/
+template< typename T = void >  // Auxiliary type for the definition of the static data members
+struct ThresholdRegistry
+{
+   //**Member variables****************************************************************************
+   static std::atomic<size_t> values_[THRESHOLD_COUNT];  //!< The current values of all thresholds.
+   static const bool initialized_;  //!< Initialization flag for the settings of the environment.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the thresholds with the settings of the environment.
+//
+// \return \a true after the initialization.
+//
+// This function resets all thresholds to their compile time defaults and subsequently applies
+// the settings of the threshold profile given by the \c BLAZE_THRESHOLD_PROFILE environment
+// variable and of the environment variables of the individual thresholds. Invalid settings are
+// ignored. The function is called once during the dynamic initialization of the program.
+*/
+inline bool initializeThresholds()
+{
+   size_t values[THRESHOLD_COUNT];
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i )
+      values[i] = getThresholdDefault( i );
+
+   const char* profile = std::getenv( "BLAZE_THRESHOLD_PROFILE" );
+
+   if( profile != nullptr && *profile != '\0' ) {
+      std::string error;
+      readThresholds( profile, values, error );
+   }
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      const std::string name( std::string( "BLAZE_" ) + getThresholdName( i ) );
+      const char* env = std::getenv( name.c_str() );
+      if( env != nullptr )
+         parseThreshold( env, i, values[i] );
+   }
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i )
+      ThresholdRegistry<>::values_[i].store( values[i], std::memory_order_relaxed );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Definition of the current values of all thresholds.
+*/
+template< typename T >
+std::atomic<size_t> ThresholdRegistry<T>::values_[THRESHOLD_COUNT] = {
+   { DMATDVECMULT_DEFAULT_THRESHOLD },
+   { TDMATDVECMULT_DEFAULT_THRESHOLD },
+   { TDVECDMATMULT_DEFAULT_THRESHOLD },
+   { TDVECTDMATMULT_DEFAULT_THRESHOLD },
+   { DMATDMATMULT_DEFAULT_THRESHOLD },
+   { DMATTDMATMULT_DEFAULT_THRESHOLD },
+   { TDMATDMATMULT_DEFAULT_THRESHOLD },
+   { TDMATTDMATMULT_DEFAULT_THRESHOLD },
+   { DMATSMATMULT_DEFAULT_THRESHOLD },
+   { TDMATSMATMULT_DEFAULT_THRESHOLD },
+   { TSMATDMATMULT_DEFAULT_THRESHOLD },
+   { TSMATTDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_DVECASSIGN_DEFAULT_THRESHOLD },
+   { SMP_DVECDVECADD_DEFAULT_THRESHOLD },
+   { SMP_DVECDVECSUB_DEFAULT_THRESHOLD },
+   { SMP_DVECDVECMULT_DEFAULT_THRESHOLD },
+   { SMP_DVECDVECDIV_DEFAULT_THRESHOLD },
+   { SMP_DVECSCALARMULT_DEFAULT_THRESHOLD },
+   { SMP_DMATDVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TDMATDVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TDVECDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_DMATSVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TDMATSVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TSVECDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_SMATDVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TSMATDVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TDVECSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_SMATSVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TSMATSVECMULT_DEFAULT_THRESHOLD },
+   { SMP_TSVECSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_DMATASSIGN_DEFAULT_THRESHOLD },
+   { SMP_DMATDMATADD_DEFAULT_THRESHOLD },
+   { SMP_DMATTDMATADD_DEFAULT_THRESHOLD },
+   { SMP_DMATDMATSUB_DEFAULT_THRESHOLD },
+   { SMP_DMATTDMATSUB_DEFAULT_THRESHOLD },
+   { SMP_DMATSCALARMULT_DEFAULT_THRESHOLD },
+   { SMP_DMATDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_DMATTDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TDMATDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_DMATSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_DMATTSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TDMATSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_SMATDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_SMATTDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TSMATDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD },
+   { SMP_SMATSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_SMATTSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TSMATSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD },
+   { SMP_DVECTDVECMULT_DEFAULT_THRESHOLD },
+   { SMP_DVECREDUCE_DEFAULT_THRESHOLD },
+   { SMP_DMATREDUCE_DEFAULT_THRESHOLD },
+   { SMP_BATCH_DEFAULT_THRESHOLD }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Definition of the initialization flag for the settings of the environment.
+*/
+template< typename T >
+const bool ThresholdRegistry<T>::initialized_ = initializeThresholds();
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : SMP_DVECASSIGN_USER_THRESHOLD     );
-constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : SMP_DVECDVECADD_USER_THRESHOLD    );
-constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : SMP_DVECDVECSUB_USER_THRESHOLD    );
-constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : SMP_DVECDVECMULT_USER_THRESHOLD   );
-constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : SMP_DVECDVECDIV_USER_THRESHOLD    );
-constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : SMP_DVECSCALARMULT_USER_THRESHOLD );
-constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : SMP_DMATDVECMULT_USER_THRESHOLD   );
-constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : SMP_TDMATDVECMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : SMP_TDVECDMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : SMP_TDVECTDMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : SMP_DMATSVECMULT_USER_THRESHOLD   );
-constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : SMP_TDMATSVECMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : SMP_TSVECDMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : SMP_TSVECTDMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : SMP_SMATDVECMULT_USER_THRESHOLD   );
-constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : SMP_TSMATDVECMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : SMP_TDVECSMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : SMP_TDVECTSMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : SMP_SMATSVECMULT_USER_THRESHOLD   );
-constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : SMP_TSMATSVECMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : SMP_TSVECSMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : SMP_TSVECTSMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : SMP_DMATASSIGN_USER_THRESHOLD     );
-constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : SMP_DMATDMATADD_USER_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : SMP_DMATTDMATADD_USER_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : SMP_DMATDMATSUB_USER_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : SMP_DMATTDMATSUB_USER_THRESHOLD   );
-constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : SMP_DMATSCALARMULT_USER_THRESHOLD );
-constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : SMP_DMATDMATMULT_USER_THRESHOLD   );
-constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : SMP_DMATTDMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : SMP_TDMATDMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : SMP_TDMATTDMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : SMP_DMATSMATMULT_USER_THRESHOLD   );
-constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : SMP_DMATTSMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : SMP_TDMATSMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : SMP_TDMATTSMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : SMP_SMATDMATMULT_USER_THRESHOLD   );
-constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : SMP_SMATTDMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : SMP_TSMATDMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : SMP_TSMATTDMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : SMP_SMATSMATMULT_USER_THRESHOLD   );
-constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : SMP_SMATTSMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : SMP_TSMATSMATMULT_USER_THRESHOLD  );
-constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : SMP_TSMATTSMATMULT_USER_THRESHOLD );
-constexpr size_t SMP_DVECTDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMULT_DEBUG_THRESHOLD  : SMP_DVECTDVECMULT_USER_THRESHOLD  );
+namespace {
+
+//! Instantiation of the initialization of the thresholds with the settings of the environment.
+const bool& thresholdsInitialized = ThresholdRegistry<>::initialized_;
+
+}
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Creates a handle for the threshold with the given registry index.
+//
+// \param index The index of the threshold in the threshold registry.
+*/
+constexpr Threshold::Threshold( size_t index ) noexcept
+   : index_( index )  // The index of the threshold in the threshold registry
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion to the current value of the threshold.
+//
+// \return The current value of the threshold.
+*/
+inline Threshold::operator size_t() const noexcept
+{
+   return value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the threshold.
+//
+// \return The current value of the threshold.
+*/
+inline size_t Threshold::value() const noexcept
+{
+   return ThresholdRegistry<>::values_[index_].load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the compile time default of the threshold.
+//
+// \return The compile time default of the threshold.
+*/
+inline size_t Threshold::defaultValue() const noexcept
+{
+   return getThresholdDefault( index_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the threshold.
+//
+// \return The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+*/
+inline const char* Threshold::name() const noexcept
+{
+   return getThresholdName( index_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the threshold in the threshold registry.
+//
+// \return The index of the threshold.
+*/
+inline size_t Threshold::index() const noexcept
+{
+   return index_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr Threshold DMATDVECMULT_THRESHOLD      (  0UL );
+constexpr Threshold TDMATDVECMULT_THRESHOLD     (  1UL );
+constexpr Threshold TDVECDMATMULT_THRESHOLD     (  2UL );
+constexpr Threshold TDVECTDMATMULT_THRESHOLD    (  3UL );
+constexpr Threshold DMATDMATMULT_THRESHOLD      (  4UL );
+constexpr Threshold DMATTDMATMULT_THRESHOLD     (  5UL );
+constexpr Threshold TDMATDMATMULT_THRESHOLD     (  6UL );
+constexpr Threshold TDMATTDMATMULT_THRESHOLD    (  7UL );
+constexpr Threshold DMATSMATMULT_THRESHOLD      (  8UL );
+constexpr Threshold TDMATSMATMULT_THRESHOLD     (  9UL );
+constexpr Threshold TSMATDMATMULT_THRESHOLD     ( 10UL );
+constexpr Threshold TSMATTDMATMULT_THRESHOLD    ( 11UL );
+constexpr Threshold SMP_DVECASSIGN_THRESHOLD    ( 12UL );
+constexpr Threshold SMP_DVECDVECADD_THRESHOLD   ( 13UL );
+constexpr Threshold SMP_DVECDVECSUB_THRESHOLD   ( 14UL );
+constexpr Threshold SMP_DVECDVECMULT_THRESHOLD  ( 15UL );
+constexpr Threshold SMP_DVECDVECDIV_THRESHOLD   ( 16UL );
+constexpr Threshold SMP_DVECSCALARMULT_THRESHOLD( 17UL );
+constexpr Threshold SMP_DMATDVECMULT_THRESHOLD  ( 18UL );
+constexpr Threshold SMP_TDMATDVECMULT_THRESHOLD ( 19UL );
+constexpr Threshold SMP_TDVECDMATMULT_THRESHOLD ( 20UL );
+constexpr Threshold SMP_TDVECTDMATMULT_THRESHOLD( 21UL );
+constexpr Threshold SMP_DMATSVECMULT_THRESHOLD  ( 22UL );
+constexpr Threshold SMP_TDMATSVECMULT_THRESHOLD ( 23UL );
+constexpr Threshold SMP_TSVECDMATMULT_THRESHOLD ( 24UL );
+constexpr Threshold SMP_TSVECTDMATMULT_THRESHOLD( 25UL );
+constexpr Threshold SMP_SMATDVECMULT_THRESHOLD  ( 26UL );
+constexpr Threshold SMP_TSMATDVECMULT_THRESHOLD ( 27UL );
+constexpr Threshold SMP_TDVECSMATMULT_THRESHOLD ( 28UL );
+constexpr Threshold SMP_TDVECTSMATMULT_THRESHOLD( 29UL );
+constexpr Threshold SMP_SMATSVECMULT_THRESHOLD  ( 30UL );
+constexpr Threshold SMP_TSMATSVECMULT_THRESHOLD ( 31UL );
+constexpr Threshold SMP_TSVECSMATMULT_THRESHOLD ( 32UL );
+constexpr Threshold SMP_TSVECTSMATMULT_THRESHOLD( 33UL );
+constexpr Threshold SMP_DMATASSIGN_THRESHOLD    ( 34UL );
+constexpr Threshold SMP_DMATDMATADD_THRESHOLD   ( 35UL );
+constexpr Threshold SMP_DMATTDMATADD_THRESHOLD  ( 36UL );
+constexpr Threshold SMP_DMATDMATSUB_THRESHOLD   ( 37UL );
+constexpr Threshold SMP_DMATTDMATSUB_THRESHOLD  ( 38UL );
+constexpr Threshold SMP_DMATSCALARMULT_THRESHOLD( 39UL );
+constexpr Threshold SMP_DMATDMATMULT_THRESHOLD  ( 40UL );
+constexpr Threshold SMP_DMATTDMATMULT_THRESHOLD ( 41UL );
+constexpr Threshold SMP_TDMATDMATMULT_THRESHOLD ( 42UL );
+constexpr Threshold SMP_TDMATTDMATMULT_THRESHOLD( 43UL );
+constexpr Threshold SMP_DMATSMATMULT_THRESHOLD  ( 44UL );
+constexpr Threshold SMP_DMATTSMATMULT_THRESHOLD ( 45UL );
+constexpr Threshold SMP_TDMATSMATMULT_THRESHOLD ( 46UL );
+constexpr Threshold SMP_TDMATTSMATMULT_THRESHOLD( 47UL );
+constexpr Threshold SMP_SMATDMATMULT_THRESHOLD  ( 48UL );
+constexpr Threshold SMP_SMATTDMATMULT_THRESHOLD ( 49UL );
+constexpr Threshold SMP_TSMATDMATMULT_THRESHOLD ( 50UL );
+constexpr Threshold SMP_TSMATTDMATMULT_THRESHOLD( 51UL );
+constexpr Threshold SMP_SMATSMATMULT_THRESHOLD  ( 52UL );
+constexpr Threshold SMP_SMATTSMATMULT_THRESHOLD ( 53UL );
+constexpr Threshold SMP_TSMATSMATMULT_THRESHOLD ( 54UL );
+constexpr Threshold SMP_TSMATTSMATMULT_THRESHOLD( 55UL );
+constexpr Threshold SMP_DVECTDVECMULT_THRESHOLD ( 56UL );
+constexpr Threshold SMP_DVECREDUCE_THRESHOLD    ( 57UL );
+constexpr Threshold SMP_DMATREDUCE_THRESHOLD    ( 58UL );
+constexpr Threshold SMP_BATCH_THRESHOLD         ( 59UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Threshold functions */
+//@{
+inline void setThreshold( const Threshold& threshold, size_t value );
+inline void resetThresholds();
+inline void loadThresholds( const std::string& file );
+inline void saveThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the given threshold to the specified value.
+// \ingroup config
+//
+// \param threshold The threshold to be changed.
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function changes the value of the given threshold for all subsequent operations:
+
+   \code
+   blaze::setThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 65536UL );
+   \endcode
+
+// The BLAS thresholds (as for instance the blaze::DMATDVECMULT_THRESHOLD) are required to be
+// larger than 0. In case the given value is 0, a \a std::invalid_argument exception is thrown.
+// Note that operations that are executed concurrently to the change of the threshold may still
+// use the previous value.
+*/
+inline void setThreshold( const Threshold& threshold, size_t value )
+{
+   if( !isValidThreshold( threshold.index(), value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+   }
+
+   ThresholdRegistry<>::values_[threshold.index()].store( value, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all thresholds to their compile time defaults.
+// \ingroup config
+//
+// \return void
+//
+// This function resets all thresholds to the settings of the configuration file
+// <tt>./blaze/config/Thresholds.h</tt> (or the according debug values in case the Blaze debug
+// mode is active), i.e. all settings of the environment variables, of threshold profiles and
+// of previous calls to setThreshold() are discarded.
+*/
+inline void resetThresholds()
+{
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i )
+      ThresholdRegistry<>::values_[i].store( getThresholdDefault( i ), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the threshold settings of the given threshold profile.
+// \ingroup config
+//
+// \param file The name of the threshold profile.
+// \return void
+// \exception std::invalid_argument Invalid threshold profile.
+//
+// This function applies all settings of the given threshold profile. A threshold profile is
+// a text file that specifies one threshold per line. Thresholds that are not specified keep
+// their current value. Empty lines and everything following a \c # character are ignored:
+
+   \code
+   # Threshold profile for the target machine
+   SMP_DVECASSIGN_THRESHOLD = 65536
+   SMP_DMATASSIGN_THRESHOLD = 40000
+   \endcode
+
+// In case the file cannot be opened, or in case it contains unknown thresholds or invalid
+// values, a \a std::invalid_argument exception is thrown and none of the settings is applied.
+// Note that the settings are applied one by one, i.e. operations that are executed concurrently
+// may observe a mix of previous and new threshold values.
+*/
+inline void loadThresholds( const std::string& file )
+{
+   size_t values[THRESHOLD_COUNT];
+   std::string error;
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i )
+      values[i] = ThresholdRegistry<>::values_[i].load( std::memory_order_relaxed );
+
+   if( !readThresholds( file, values, error ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( error );
+   }
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i )
+      ThresholdRegistry<>::values_[i].store( values[i], std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Saves the current values of all thresholds as threshold profile.
+// \ingroup config
+//
+// \param file The name of the threshold profile.
+// \return void
+// \exception std::runtime_error Unable to write the threshold profile.
+//
+// This function writes the current values of all thresholds to the given file. The resulting
+// threshold profile can be loaded via the loadThresholds() function or via the
+// \c BLAZE_THRESHOLD_PROFILE environment variable.
+*/
+inline void saveThresholds( const std::string& file )
+{
+   std::ofstream out( file.c_str() );
+
+   out << "# Blaze threshold profile\n";
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i )
+      out << getThresholdName( i ) << " = "
+          << ThresholdRegistry<>::values_[i].load( std::memory_order_relaxed ) << "\n";
+
+   out.close();
+
+   if( !out ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write threshold profile '" + file + "'" );
+   }
+}
+//*************************************************************************************************
+
+#endif
+
 } // namespace blaze
 
 
@@ -973,59 +1943,62 @@ constexpr size_t SMP_DVECTDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDV
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
-
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_DEFAULT_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_DEFAULT_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_DEFAULT_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_DEFAULT_THRESHOLD > 0UL );
+
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_DEFAULT_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_DEFAULT_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_DEFAULT_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_DEFAULT_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCH_DEFAULT_THRESHOLD          >= 0UL );
 
 }
 /*! \endcond */
@@ -233,6 +233,73 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512F mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512F mode. In case the AVX-512F mode is
+// enabled (i.e. in case AVX-512 foundation functionality is available) the Blaze library
+// attempts to vectorize the linear algebra operations by 512-bit AVX-512 intrinsics. In case
+// the AVX-512F mode is disabled, the Blaze library falls back to AVX2, AVX, or SSE intrinsics
+// or chooses default, non-vectorized functionality for the operations.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512F__)
+#  define BLAZE_AVX512F_MODE 1
+#else
+#  define BLAZE_AVX512F_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512BW mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512BW mode. In case the AVX-512BW mode is
+// enabled (i.e. in case the AVX-512 byte and word instructions are available) the Blaze library
+// uses 512-bit vectors for 8-bit and 16-bit integral data types. In case the AVX-512BW mode is
+// disabled, these data types are vectorized by means of AVX2 or SSE2 intrinsics.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512BW__)
+#  define BLAZE_AVX512BW_MODE 1
+#else
+#  define BLAZE_AVX512BW_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512DQ mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512DQ mode. In case the AVX-512DQ mode is
+// enabled (i.e. in case the AVX-512 doubleword and quadword instructions are available) the
+// Blaze library additionally vectorizes the multiplication of 64-bit integral data types.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512DQ__)
+#  define BLAZE_AVX512DQ_MODE 1
+#else
+#  define BLAZE_AVX512DQ_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512VL mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512VL mode. In case the AVX-512VL mode is
+// enabled (i.e. in case the AVX-512 vector length extensions are available) the Blaze library
+// may use the AVX-512 masking instructions also for 128-bit and 256-bit vectors.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512VL__)
+#  define BLAZE_AVX512VL_MODE 1
+#else
+#  define BLAZE_AVX512VL_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -302,6 +369,32 @@
 
 
 
+//=================================================================================================
+//
+//  RUNTIME DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case the runtime dispatch is requested via the according
+// configuration switch and a GNU compatible compiler for an x86 platform is used) the Blaze
+// library selects the instruction set of several performance critical kernels at runtime.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_RUNTIME_DISPATCH && defined(__GNUC__) && \
+    ( defined(__x86_64__) || defined(__i386__) )
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -312,12 +405,16 @@
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE  || BLAZE_SSE_MODE   );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE  || BLAZE_SSE2_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE     || BLAZE_SSE_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE     || BLAZE_SSE2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE    || BLAZE_SSE3_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE     || BLAZE_SSSE3_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE      || BLAZE_SSE4_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE     || BLAZE_AVX_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || BLAZE_AVX2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512BW_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512VL_MODE || BLAZE_AVX512F_MODE );
 
 }
 /*! \endcond */
@@ -332,7 +429,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
@@ -0,0 +1,486 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Affinity.h
+//  \brief Header file for the thread affinity functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_AFFINITY_H_
+#define _BLAZE_UTIL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <blaze/system/NUMA.h>
+#if BLAZE_THREAD_PINNING
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Native handle of a thread of execution.
+// \ingroup threads
+//
+// This type represents the operating system specific handle of a thread of execution, which
+// is used to pin the thread to a specific core (see the pinThread() function).
+*/
+#if BLAZE_THREAD_PINNING
+typedef pthread_t  NativeThread;
+#else
+typedef int  NativeThread;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKEND TOPOLOGY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the query of a topology property of a core.
+// \ingroup threads
+//
+// \param core The index of the core.
+// \param property The name of the topology property (e.g. "core_id").
+// \return The value of the topology property, or -1 in case it is not available.
+*/
+inline int topology_backend( int core, const char* property )
+{
+   std::ostringstream oss;
+   oss << "/sys/devices/system/cpu/cpu" << core << "/topology/" << property;
+
+   std::ifstream file( oss.str().c_str() );
+   int value( -1 );
+
+   if( !( file >> value ) )
+      return -1;
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary structure for the ordering of cores according to the system topology.
+// \ingroup threads
+*/
+struct CoreInfo
+{
+   int core_;     //!< The index of the core.
+   int package_;  //!< The physical package (socket) of the core.
+   int id_;       //!< The index of the core within its package.
+   int smt_;      //!< The index of the hardware thread within its physical core.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the query of the topology of all available cores.
+// \ingroup threads
+//
+// \param cores The indices of the available cores.
+// \return The topology information of all available cores.
+//
+// This function determines the physical package, the index of the physical core within the
+// package, and the index of the hardware thread within the physical core for all given cores.
+// In case the topology information is not available, each core is treated as a separate
+// physical core of a single package.
+*/
+inline std::vector<CoreInfo> coreInfo_backend( const std::vector<int>& cores )
+{
+   std::vector<CoreInfo> info;
+   info.reserve( cores.size() );
+
+   for( int core : cores ) {
+      const int package( topology_backend( core, "physical_package_id" ) );
+      const int id     ( topology_backend( core, "core_id" ) );
+      CoreInfo ci = { core, std::max( package, 0 ), ( id < 0 )?( core ):( id ), 0 };
+      info.push_back( ci );
+   }
+
+   std::sort( info.begin(), info.end(), []( const CoreInfo& a, const CoreInfo& b ) {
+      if( a.package_ != b.package_ ) return a.package_ < b.package_;
+      if( a.id_      != b.id_      ) return a.id_      < b.id_;
+      return a.core_ < b.core_;
+   } );
+
+   // Numbering the hardware threads of each physical core and the physical cores of each package
+   int rank( -1 );
+
+   for( size_t i=0UL; i<info.size(); ++i )
+   {
+      const bool samePackage( i > 0UL && info[i].package_ == info[i-1UL].package_ );
+      const bool sameCore   ( samePackage && info[i].id_ == info[i-1UL].id_ );
+
+      info[i].smt_ = ( sameCore )?( info[i-1UL].smt_ + 1 ):( 0 );
+
+      if( !samePackage )  rank = 0;
+      else if( !sameCore ) ++rank;
+
+      info[i].id_ = rank;
+   }
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Affinity functions */
+//@{
+inline NativeThread            currentThread() noexcept;
+inline const std::vector<int>& availableCores();
+inline bool                    isAvailableCore( int core );
+inline std::vector<int>        compactCores();
+inline std::vector<int>        scatterCores();
+inline std::vector<int>        parseAffinity( const std::string& policy );
+inline bool                    pinThread( NativeThread thread, int core );
+inline int                     getThreadCore( NativeThread thread ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the native handle of the calling thread.
+// \ingroup threads
+//
+// \return The native handle of the calling thread.
+*/
+inline NativeThread currentThread() noexcept
+{
+#if BLAZE_THREAD_PINNING
+   return pthread_self();
+#else
+   return NativeThread();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the cores available to the process.
+// \ingroup threads
+//
+// \return The ascending indices of all cores available to the process.
+//
+// This function returns the indices of all cores the process is allowed to run on, as determined
+// by the affinity mask at the time of the first call. In case thread pinning is not supported,
+// the function returns an empty vector.
+*/
+inline const std::vector<int>& availableCores()
+{
+   static const std::vector<int> cores( []() {
+      std::vector<int> tmp;
+#if BLAZE_THREAD_PINNING
+      cpu_set_t set;
+      CPU_ZERO( &set );
+      if( sched_getaffinity( 0, sizeof( cpu_set_t ), &set ) == 0 ) {
+         for( int core=0; core<CPU_SETSIZE; ++core ) {
+            if( CPU_ISSET( core, &set ) )
+               tmp.push_back( core );
+         }
+      }
+#endif
+      return tmp;
+   }() );
+
+   return cores;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given core is available to the process.
+// \ingroup threads
+//
+// \param core The index of the core.
+// \return \a true in case the core is available, \a false if not.
+*/
+inline bool isAvailableCore( int core )
+{
+   const std::vector<int>& cores( availableCores() );
+   return std::binary_search( cores.begin(), cores.end(), core );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the available cores in compact order.
+// \ingroup threads
+//
+// \return The available cores in compact order.
+//
+// This function returns the available cores ordered such that consecutive threads are placed
+// as close together as possible: First all hardware threads of a physical core, then all
+// physical cores of a package, and finally all packages. Thus threads that share data also
+// share the largest possible part of the cache hierarchy.
+*/
+inline std::vector<int> compactCores()
+{
+   const std::vector<CoreInfo> info( coreInfo_backend( availableCores() ) );
+
+   std::vector<int> cores;
+   cores.reserve( info.size() );
+
+   for( const CoreInfo& ci : info ) {
+      cores.push_back( ci.core_ );
+   }
+
+   return cores;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the available cores in scatter order.
+// \ingroup threads
+//
+// \return The available cores in scatter order.
+//
+// This function returns the available cores ordered such that consecutive threads are placed
+// as far apart as possible: The threads are distributed round-robin across all packages and
+// all physical cores of a package, and only in case all physical cores are used, additional
+// hardware threads are assigned. Thus every thread has the largest possible share of the
+// memory bandwidth and of the caches.
+*/
+inline std::vector<int> scatterCores()
+{
+   std::vector<CoreInfo> info( coreInfo_backend( availableCores() ) );
+
+   std::stable_sort( info.begin(), info.end(), []( const CoreInfo& a, const CoreInfo& b ) {
+      if( a.smt_ != b.smt_ ) return a.smt_ < b.smt_;
+      if( a.id_  != b.id_  ) return a.id_  < b.id_;
+      return a.package_ < b.package_;
+   } );
+
+   std::vector<int> cores;
+   cores.reserve( info.size() );
+
+   for( const CoreInfo& ci : info ) {
+      cores.push_back( ci.core_ );
+   }
+
+   return cores;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given affinity policy into a list of cores.
+// \ingroup threads
+//
+// \param policy The affinity policy.
+// \return The list of cores according to the given policy.
+// \exception std::invalid_argument Invalid affinity policy.
+//
+// This function converts the given affinity policy into the list of cores the threads of a
+// thread pool are pinned to (the i-th thread is pinned to the (i%n)-th of the n cores). The
+// following policies are supported:
+//
+//  - \c "none" or an empty string: The threads are not pinned (empty list).
+//  - \c "compact": The available cores in compact order (see the compactCores() function).
+//  - \c "scatter": The available cores in scatter order (see the scatterCores() function).
+//  - An explicit, comma-separated list of cores and ranges of cores (e.g. \c "0,2,4-7").
+//
+// In case the given policy cannot be parsed, a \a std::invalid_argument exception is thrown.
+// Note that this function does not check whether the listed cores are available.
+*/
+inline std::vector<int> parseAffinity( const std::string& policy )
+{
+   std::string spec;
+
+   for( char c : policy ) {
+      if( !std::isspace( static_cast<unsigned char>( c ) ) )
+         spec += static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) );
+   }
+
+   if( spec.empty() || spec == "none" )
+      return std::vector<int>();
+   else if( spec == "compact" )
+      return compactCores();
+   else if( spec == "scatter" )
+      return scatterCores();
+
+   if( spec[spec.size()-1UL] == ',' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid affinity policy" );
+   }
+
+   std::vector<int> cores;
+   std::istringstream iss( spec );
+   std::string item;
+
+   while( std::getline( iss, item, ',' ) )
+   {
+      const size_t dash( item.find( '-' ) );
+      const std::string first( item.substr( 0UL, dash ) );
+      const std::string last ( ( dash == std::string::npos )?( first ):( item.substr( dash+1UL ) ) );
+
+      if( first.empty() || last.empty() ||
+          first.find_first_not_of( "0123456789" ) != std::string::npos ||
+          last.find_first_not_of( "0123456789" ) != std::string::npos ||
+          first.size() > 6UL || last.size() > 6UL ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid affinity policy" );
+      }
+
+      const int begin( std::atoi( first.c_str() ) );
+      const int end  ( std::atoi( last.c_str()  ) );
+
+      if( begin > end ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid affinity policy" );
+      }
+
+      for( int core=begin; core<=end; ++core ) {
+         cores.push_back( core );
+      }
+   }
+
+   if( cores.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid affinity policy" );
+   }
+
+   return cores;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the given thread to the given core.
+// \ingroup threads
+//
+// \param thread The native handle of the thread.
+// \param core The index of the core, or -1 to allow the thread to run on all available cores.
+// \return \a true in case the thread was pinned successfully, \a false if not.
+//
+// This function restricts the given thread to the given core. In case \a core is -1, the thread
+// is allowed to run on all available cores again (see the availableCores() function). In case
+// thread pinning is not supported or the core is not available, the function has no effect
+// and returns \a false.
+*/
+inline bool pinThread( NativeThread thread, int core )
+{
+#if BLAZE_THREAD_PINNING
+   if( core >= CPU_SETSIZE || ( core >= 0 && !isAvailableCore( core ) ) )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( core >= 0 ) {
+      CPU_SET( core, &set );
+   }
+   else {
+      for( int c : availableCores() ) {
+         CPU_SET( c, &set );
+      }
+   }
+
+   return pthread_setaffinity_np( thread, sizeof( cpu_set_t ), &set ) == 0;
+#else
+   UNUSED_PARAMETER( thread, core );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the core the given thread is pinned to.
+// \ingroup threads
+//
+// \param thread The native handle of the thread.
+// \return The index of the core the thread is pinned to, or -1 in case it is not pinned.
+//
+// This function queries the current affinity mask of the given thread. In case the thread is
+// restricted to a single core, the function returns the index of this core. Otherwise, or in
+// case thread pinning is not supported, it returns -1.
+*/
+inline int getThreadCore( NativeThread thread ) noexcept
+{
+#if BLAZE_THREAD_PINNING
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( pthread_getaffinity_np( thread, sizeof( cpu_set_t ), &set ) != 0 || CPU_COUNT( &set ) != 1 )
+      return -1;
+
+   for( int core=0; core<CPU_SETSIZE; ++core ) {
+      if( CPU_ISSET( core, &set ) )
+         return core;
+   }
+
+   return -1;
+#else
+   UNUSED_PARAMETER( thread );
+   return -1;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,13 +45,22 @@
 #endif
 #include <cstdlib>
 #include <new>
+#include <blaze/system/NUMA.h>
+#if BLAZE_NUMA_INTERLEAVE
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -62,6 +71,67 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the interleaved placement of an array on all NUMA nodes.
+// \ingroup util
+//
+// \param address The address of the first byte of the array.
+// \param size The number of bytes of the array.
+// \return void
+//
+// In case the interleave NUMA policy is selected (see the \c BLAZE_NUMA_POLICY switch in the
+// <tt>./blaze/config/NUMA.h</tt> configuration file), this function distributes the memory
+// pages of the given array round-robin among all NUMA nodes available to the process. Since
+// a memory policy can only be set for complete pages, only the pages lying completely inside
+// the array are affected. Arrays smaller than 256 KiB are not affected at all. Note that the
+// policy only applies to pages that have not been touched yet. Failures (for instance on
+// systems without NUMA support) are silently ignored, in which case the default placement
+// applies. In all other configurations this function has no effect.
+*/
+inline void interleave_backend( void* address, size_t size ) noexcept
+{
+#if BLAZE_NUMA_INTERLEAVE
+   enum : unsigned long { maxNodes = 1024UL, bits = 8UL*sizeof(unsigned long) };
+
+   struct NodeMask
+   {
+      NodeMask() : nodes( 0UL ), mask() {
+         int mode( 0 );
+         if( syscall( SYS_get_mempolicy, &mode, mask, maxNodes, nullptr, 4 /*MPOL_F_MEMS_ALLOWED*/ ) != 0 )
+            return;
+         for( size_t i=0UL; i<maxNodes; ++i )
+            nodes += ( mask[i/bits] >> (i%bits) ) & 1UL;
+      }
+
+      size_t        nodes;                //!< The number of NUMA nodes available to the process.
+      unsigned long mask[maxNodes/bits];  //!< The bit mask of the available NUMA nodes.
+   };
+
+   if( size < 262144UL )
+      return;
+
+   static const size_t   pagesize( sysconf( _SC_PAGESIZE ) );
+   static const NodeMask allowed;
+
+   if( allowed.nodes < 2UL )
+      return;
+
+   const size_t first( ( reinterpret_cast<size_t>( address ) + pagesize - 1UL ) & ~( pagesize - 1UL ) );
+   const size_t last ( ( reinterpret_cast<size_t>( address ) + size ) & ~( pagesize - 1UL ) );
+
+   if( first < last ) {
+      syscall( SYS_mbind, reinterpret_cast<void*>( first ), last - first,
+               3 /*MPOL_INTERLEAVE*/, allowed.mask, maxNodes, 0U );
+   }
+#else
+   UNUSED_PARAMETER( address, size );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Backend implementation for aligned array allocation.
@@ -74,7 +144,9 @@ namespace blaze {
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions. Additionally, the memory of large arrays is placed according to the selected NUMA
+// policy (see the \c BLAZE_NUMA_POLICY switch in the <tt>./blaze/config/NUMA.h</tt>
+// configuration file).
 */
 inline byte_t* allocate_backend( size_t size, size_t alignment )
 {
@@ -89,6 +161,8 @@ inline byte_t* allocate_backend( size_t size, size_t alignment )
       BLAZE_THROW_BAD_ALLOC;
    }
 
+   interleave_backend( raw, size );
+
    return reinterpret_cast<byte_t*>( raw );
 }
 /*! \endcond */
@@ -118,6 +192,121 @@ inline void deallocate_backend( const void* address ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the aligned array allocation of user-specific class types.
+// \ingroup util
+//
+// \param size The number of elements of the given type to allocate.
+// \return Pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates the array via the aligned allocation backend and default constructs
+// all elements. The number of elements is stored in front of the first element.
+*/
+template< typename T >
+T* allocate_array( size_t size, TrueType )
+{
+   const size_t alignment ( AlignmentOf<T>::value );
+   const size_t headersize( ( sizeof(size_t) < alignment ) ? ( alignment ) : ( sizeof( size_t ) ) );
+
+   BLAZE_INTERNAL_ASSERT( headersize >= alignment      , "Invalid header size detected" );
+   BLAZE_INTERNAL_ASSERT( headersize % alignment == 0UL, "Invalid header size detected" );
+
+   byte_t* const raw( allocate_backend( size*sizeof(T)+headersize, alignment ) );
+
+   *reinterpret_cast<size_t*>( raw ) = size;
+
+   T* const address( reinterpret_cast<T*>( raw + headersize ) );
+   size_t i( 0UL );
+
+   try {
+      for( ; i<size; ++i )
+         ::new (address+i) T();
+   }
+   catch( ... ) {
+      while( i != 0UL )
+         address[--i].~T();
+      deallocate_backend( raw );
+      throw;
+   }
+
+   return address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the array allocation of user-specific class types without
+//        alignment restrictions.
+// \ingroup util
+//
+// \param size The number of elements of the given type to allocate.
+// \return Pointer to the first element of the array.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename T >
+T* allocate_array( size_t size, FalseType )
+{
+   return ::new T[size];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the deallocation of aligned arrays of user-specific class
+//        types.
+// \ingroup util
+//
+// \param address The address of the first element of the array to be deallocated.
+// \return void
+//
+// This function destroys all elements of the given array, which was previously allocated via
+// the allocate() function, and releases the memory via the aligned deallocation backend.
+*/
+template< typename T >
+void deallocate_array( T* address, TrueType )
+{
+   const size_t alignment ( AlignmentOf<T>::value );
+   const size_t headersize( ( sizeof(size_t) < alignment ) ? ( alignment ) : ( sizeof( size_t ) ) );
+
+   BLAZE_INTERNAL_ASSERT( headersize >= alignment      , "Invalid header size detected" );
+   BLAZE_INTERNAL_ASSERT( headersize % alignment == 0UL, "Invalid header size detected" );
+
+   const byte_t* const raw = reinterpret_cast<byte_t*>( address ) - headersize;
+
+   const size_t size( *reinterpret_cast<const size_t*>( raw ) );
+   for( size_t i=0UL; i<size; ++i )
+      address[i].~T();
+
+   deallocate_backend( raw );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the deallocation of arrays of user-specific class types
+//        without alignment restrictions.
+// \ingroup util
+//
+// \param address The address of the first element of the array to be deallocated.
+// \return void
+*/
+template< typename T >
+void deallocate_array( T* address, FalseType )
+{
+   delete[] address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -178,35 +367,7 @@ EnableIf_< IsBuiltin<T>, T* > allocate( size_t size )
 template< typename T >
 DisableIf_< IsBuiltin<T>, T* > allocate( size_t size )
 {
-   const size_t alignment ( AlignmentOf<T>::value );
-   const size_t headersize( ( sizeof(size_t) < alignment ) ? ( alignment ) : ( sizeof( size_t ) ) );
-
-   BLAZE_INTERNAL_ASSERT( headersize >= alignment      , "Invalid header size detected" );
-   BLAZE_INTERNAL_ASSERT( headersize % alignment == 0UL, "Invalid header size detected" );
-
-   if( alignment >= 8UL )
-   {
-      byte_t* const raw( allocate_backend( size*sizeof(T)+headersize, alignment ) );
-
-      *reinterpret_cast<size_t*>( raw ) = size;
-
-      T* const address( reinterpret_cast<T*>( raw + headersize ) );
-      size_t i( 0UL );
-
-      try {
-         for( ; i<size; ++i )
-            ::new (address+i) T();
-      }
-      catch( ... ) {
-         while( i != 0UL )
-            address[--i].~T();
-         deallocate_backend( raw );
-         throw;
-      }
-
-      return address;
-   }
-   else return ::new T[size];
+   return allocate_array<T>( size, BoolConstant< ( AlignmentOf<T>::value >= 8UL ) >() );
 }
 //*************************************************************************************************
 
@@ -253,23 +414,7 @@ DisableIf_< IsBuiltin<T> > deallocate( T* address )
    if( address == nullptr )
       return;
 
-   const size_t alignment ( AlignmentOf<T>::value );
-   const size_t headersize( ( sizeof(size_t) < alignment ) ? ( alignment ) : ( sizeof( size_t ) ) );
-
-   BLAZE_INTERNAL_ASSERT( headersize >= alignment      , "Invalid header size detected" );
-   BLAZE_INTERNAL_ASSERT( headersize % alignment == 0UL, "Invalid header size detected" );
-
-   if( alignment >= 8UL )
-   {
-      const byte_t* const raw = reinterpret_cast<byte_t*>( address ) - headersize;
-
-      const size_t size( *reinterpret_cast<const size_t*>( raw ) );
-      for( size_t i=0UL; i<size; ++i )
-         address[i].~T();
-
-      deallocate_backend( raw );
-   }
-   else delete[] address;
+   deallocate_array( address, BoolConstant< ( AlignmentOf<T>::value >= 8UL ) >() );
 }
 //*************************************************************************************************
 
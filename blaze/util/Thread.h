@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <blaze/util/Assert.h>
@@ -305,12 +306,12 @@ class Thread : private NonCopyable
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile bool   terminated_;  //!< Thread termination flag.
-                                 /*!< This flag value is used by the managing thread
-                                      pool to learn whether the thread has terminated
-                                      its execution. */
-   ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
-   ThreadHandle    thread_;      //!< Handle to the thread of execution.
+   std::atomic<bool> terminated_;  //!< Thread termination flag.
+                                   /*!< This flag value is used by the managing thread
+                                        pool to learn whether the thread has terminated
+                                        its execution. */
+   ThreadPoolType*   pool_;        //!< Handle to the managing thread pool.
+   ThreadHandle      thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
 
@@ -369,8 +370,9 @@ template< typename TT         // Type of the encapsulated thread
 template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 inline Thread<TT,MT,LT,CT>::Thread( Callable func, Args&&... args )
-   : pool_  ( nullptr )  // Handle to the managing thread pool
-   , thread_( nullptr )  // Handle to the thread of execution
+   : terminated_( false   )  // Thread termination flag
+   , pool_      ( nullptr )  // Handle to the managing thread pool
+   , thread_    ( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( func, std::forward<Args>( args )... ) );
 }
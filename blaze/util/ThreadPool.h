@@ -40,7 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/util/Affinity.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
@@ -48,7 +53,8 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
 #include <blaze/util/threadpool/Task.h>
-#include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/threadpool/TaskDeque.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/Types.h>
 
 
@@ -192,6 +198,78 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_scheduling Work stealing and task groups
+//
+// Internally, every thread of the pool owns a separate task deque. Tasks scheduled by one of
+// the threads of the pool (for instance by a task that itself schedules subtasks) are added to
+// the deque of this thread, tasks scheduled by any other thread are distributed round-robin
+// among the deques. Every thread processes its own deque in LIFO order and, if its deque runs
+// empty, steals the oldest task from the deque of another thread. Thus the synchronization is
+// distributed among the deques and there is no single lock that all threads contend for.
+//
+// In order to wait for a specific subset of tasks only, tasks can be scheduled in the context
+// of a task group (see the threadpool::TaskGroup class description). In contrast to the wait()
+// function, which blocks until all tasks of all threads have been completed, waiting for a task
+// group only blocks until the tasks of the group have been completed. Additionally, the waiting
+// thread helps to execute pending tasks instead of blocking idly. Therefore it is possible to
+// wait for a task group from within a task of the same thread pool (nested parallelism):
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   void subtask( size_t i ) { ... }
+
+   void task()
+   {
+      blaze::threadpool::TaskGroup group;
+
+      for( size_t i=0UL; i<8UL; ++i )
+         threadpool.schedule( group, subtask, i );
+
+      threadpool.wait( group );
+   }
+   \endcode
+
+// \section threadpool_deterministic Deterministic task placement
+//
+// By default, tasks scheduled by threads outside the thread pool are distributed round-robin
+// among the deques, starting at an arbitrary deque, and the waiting thread may execute any of
+// the pending tasks. In order to guarantee that repeatedly scheduled series of tasks (as for
+// instance the partitions of a parallel vector or matrix operation) are executed by the same
+// threads, the thread pool can be created in deterministic mode:
+
+   \code
+   StdThreadPool threadpool( 4, true );
+   \endcode
+
+// In deterministic mode, the i-th task scheduled by a thread outside the thread pool since its
+// last call to a wait() function is bound to the i-th thread of the pool, i.e. it cannot be
+// stolen by any other thread, and the waiting thread does not execute any tasks itself. Thus
+// every task of a series is executed by the same thread as the according task of the previous
+// series. This enables for instance the placement of data in the memory local to a thread on
+// NUMA systems. Tasks scheduled by the threads of the pool (i.e. nested tasks) are not bound
+// and remain subject to work stealing.
+//
+// \section threadpool_affinity Thread affinity
+//
+// By default, the operating system is free to migrate the threads of the pool between cores.
+// In order to pin the threads to specific cores, a list of cores can be passed either to the
+// constructor or to the setAffinity() function. The i-th thread of the pool, i.e. the thread
+// owning the i-th deque, is pinned to the (i%n)-th of the n given cores. An empty list of
+// cores removes the pinning. The placement() function returns the core each thread is pinned
+// to (or -1 in case it is not pinned):
+
+   \code
+   StdThreadPool threadpool( 4, true, blaze::compactCores() );
+
+   threadpool.setAffinity( blaze::parseAffinity( "0,2,4,6" ) );
+
+   const std::vector<int> cores( threadpool.placement() );  // Results in ( 0, 2, 4, 6 )
+   \endcode
+
+// Note that thread pinning is currently only supported on Linux systems. On all other systems
+// the list of cores has no effect.
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -313,17 +391,78 @@ class ThreadPool : private NonCopyable
    //**Type definitions****************************************************************************
    typedef Thread<TT,MT,LT,CT>       ManagedThread;  //!< Type of the managed threads.
    typedef PtrVector<ManagedThread>  Threads;        //!< Type of the thread container.
-   typedef threadpool::TaskQueue     TaskQueue;      //!< Type of the task queue.
+   typedef threadpool::TaskDeque     TaskDeque;      //!< Type of the per-thread task deques.
+   typedef threadpool::TaskGroup     TaskGroup;      //!< Type of a group of tasks.
+   typedef TaskDeque::Element        Element;        //!< Type of a task and its task group.
    typedef MT                        Mutex;          //!< Type of the mutex.
    typedef LT                        Lock;           //!< Type of a locking object.
    typedef CT                        Condition;      //!< Condition variable type.
    //**********************************************************************************************
 
+   //**Private class WorkQueue*********************************************************************
+   /*!\brief The task deque of a single thread of the thread pool.
+   */
+   struct WorkQueue : private NonCopyable
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the WorkQueue class.
+      //
+      // \param index The index of the work queue within the thread pool.
+      */
+      explicit inline WorkQueue( size_t index )
+         : index_( index )  // The index of the work queue within the thread pool
+         , size_ ( 0UL   )  // The number of tasks in the work queue
+         , owned_( false )  // Ownership flag
+         , mutex_()         // Synchronization mutex of the work queue
+         , tasks_()         // The tasks of the work queue
+         , bound_()         // The bound tasks of the work queue
+         , owner_()         // The thread owning the work queue
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const size_t        index_;  //!< The index of the work queue within the thread pool.
+      std::atomic<size_t> size_;   //!< The number of tasks in the work queue.
+                                   /*!< In contrast to the task deques, the size can be queried
+                                        without acquiring the lock of the work queue. */
+      bool                owned_;  //!< Ownership flag.
+                                   /*!< This flag is \a true in case the work queue is owned
+                                        by a thread of the pool. It is only modified while
+                                        holding both the mutex of the thread pool and the
+                                        mutex of the work queue. */
+      Mutex               mutex_;  //!< Synchronization mutex of the work queue.
+      TaskDeque           tasks_;  //!< The tasks of the work queue.
+      TaskDeque           bound_;  //!< The bound tasks of the work queue.
+                                   /*!< Bound tasks are only executed by the thread owning
+                                        the work queue (see the deterministic mode). */
+      NativeThread        owner_;  //!< The native handle of the thread owning the work queue.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private struct Context**********************************************************************
+   /*!\brief The thread-local execution context of the threads of the thread pool.
+   */
+   struct Context
+   {
+      const ThreadPool* pool_;   //!< The thread pool the current thread belongs to.
+      WorkQueue*        queue_;  //!< The work queue owned by the current thread.
+      size_t            next_;   //!< Placement counter for the tasks scheduled by the current thread.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef PtrVector<WorkQueue>             Queues;      //!< Type of the work queue container.
+   typedef std::unique_ptr<WorkQueue*[]>    QueueTable;  //!< Lookup table for the work queues.
+   typedef std::vector<QueueTable>          Tables;      //!< Type of the lookup table container.
+   //**********************************************************************************************
+
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, bool deterministic=false,
+                        const std::vector<int>& cores=std::vector<int>() );
    //@}
    //**********************************************************************************************
 
@@ -341,6 +480,8 @@ class ThreadPool : private NonCopyable
    inline size_t size()    const;
    inline size_t active()  const;
    inline size_t ready()   const;
+   inline bool   isDeterministic() const;
+   std::vector<int> placement()    const;
    //@}
    //**********************************************************************************************
 
@@ -349,6 +490,9 @@ class ThreadPool : private NonCopyable
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void schedule( TaskGroup& group, Callable func, Args&&... args );
    //@}
    //**********************************************************************************************
 
@@ -356,7 +500,9 @@ class ThreadPool : private NonCopyable
    /*!\name Utility functions */
    //@{
    void resize( size_t n, bool block=false );
+   void setAffinity( const std::vector<int>& cores );
    void wait();
+   void wait( TaskGroup& group );
    void clear();
    //@}
    //**********************************************************************************************
@@ -370,19 +516,47 @@ class ThreadPool : private NonCopyable
    //@}
    //**********************************************************************************************
 
+   //**Work queue functions************************************************************************
+   /*!\name Work queue functions */
+   //@{
+   void addQueue();
+   void acquireQueue();
+   void releaseQueue();
+   void clearQueues();
+   void push( threadpool::Task task, TaskGroup* group );
+   bool acquireTask( Element& element );
+   void runTask( Element& element );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   const bool deterministic_;  //!< Flag for the deterministic placement of tasks.
    volatile size_t total_;     //!< Total number of threads in the thread pool.
    volatile size_t expected_;  //!< Expected number of threads in the thread pool.
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
    volatile size_t active_;    //!< Number of currently active/busy threads.
    Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
+   Queues queues_;             //!< The work queues of the threads of the thread pool.
+                               /*!< The work queues are never destroyed before the destruction
+                                    of the thread pool. Work queues of terminated threads are
+                                    reused for new threads. */
+   Tables tables_;             //!< All lookup tables for the work queues.
+   std::vector<int> cores_;    //!< The cores the threads of the thread pool are pinned to.
+   std::atomic<WorkQueue**> table_;  //!< The current lookup table for the work queues.
+   std::atomic<size_t> numQueues_;   //!< The number of work queues in the lookup table.
+   std::atomic<size_t> queued_;      //!< Number of tasks contained in the work queues.
+   std::atomic<size_t> bound_;       //!< Number of bound tasks contained in the work queues.
+   std::atomic<size_t> pending_;     //!< Number of scheduled but not yet completed tasks.
+   std::atomic<size_t> idle_;        //!< Number of idle threads waiting for a task.
+   std::atomic<size_t> next_;        //!< Counter for the round-robin distribution of tasks.
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
+
+   static thread_local Context context_;  //!< The execution context of the current thread.
    //@}
    //**********************************************************************************************
 
@@ -397,6 +571,23 @@ class ThreadPool : private NonCopyable
 
 
 
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local typename ThreadPool<TT,MT,LT,CT>::Context
+   ThreadPool<TT,MT,LT,CT>::context_ = { nullptr, nullptr, 0UL };
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  CONSTRUCTOR
@@ -407,25 +598,57 @@ class ThreadPool : private NonCopyable
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param deterministic \a true for a deterministic placement of tasks, \a false if not.
+// \param cores The cores the threads are pinned to (empty for no pinning).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. Via the \a deterministic flag it is possible to
+// enable the deterministic placement of the tasks scheduled by threads outside the thread pool,
+// via the \a cores argument it is possible to pin the threads to specific cores (see the
+// ThreadPool class description for details). In both cases the constructor waits until all
+// threads have started and own (and are pinned according to) their work queue. Otherwise the
+// constructor returns immediately, which for instance allows the creation of a thread pool
+// during the static initialization of a Windows DLL.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
-   : total_   ( 0UL )  // Total number of threads in the thread pool
-   , expected_( 0UL )  // Expected number of threads in the thread pool
-   , active_  ( 0UL )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, bool deterministic, const std::vector<int>& cores )
+   : deterministic_( deterministic )  // Flag for the deterministic placement of tasks
+   , total_   ( 0UL )      // Total number of threads in the thread pool
+   , expected_( 0UL )      // Expected number of threads in the thread pool
+   , active_  ( 0UL )      // Number of currently active/busy threads
+   , threads_      ()      // The threads contained in the thread pool
+   , queues_       ()      // The work queues of the threads of the thread pool
+   , tables_       ()      // All lookup tables for the work queues
+   , cores_   ( cores )    // The cores the threads of the thread pool are pinned to
+   , table_   ( nullptr )  // The current lookup table for the work queues
+   , numQueues_( 0UL )     // The number of work queues in the lookup table
+   , queued_  ( 0UL )      // Number of tasks contained in the work queues
+   , bound_   ( 0UL )      // Number of bound tasks contained in the work queues
+   , pending_ ( 0UL )      // Number of scheduled but not yet completed tasks
+   , idle_    ( 0UL )      // Number of idle threads waiting for a task
+   , next_    ( 0UL )      // Counter for the round-robin distribution of tasks
+   , mutex_        ()      // Synchronization mutex
+   , waitForTask_  ()      // Wait condition for idle threads
+   , waitForThread_()      // Wait condition for the thread management
 {
+   {
+      Lock lock( mutex_ );
+      addQueue();
+   }
+
    resize( n );
+
+   // Waiting for all threads to own (and to be pinned according to) their work queue
+   if( deterministic_ || !cores_.empty() )
+   {
+      Lock lock( mutex_ );
+      while( active_ != 0UL ) {
+         waitForThread_.wait( lock );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -453,7 +676,7 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
    Lock lock( mutex_ );
 
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   clearQueues();
 
    // Setting the expected number of threads
    expected_ = 0UL;
@@ -496,8 +719,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return queued_ == 0UL;
 }
 //*************************************************************************************************
 
@@ -553,6 +775,53 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns whether the tasks are placed deterministically.
+//
+// \return \a true in case the placement of tasks is deterministic, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadPool<TT,MT,LT,CT>::isDeterministic() const
+{
+   return deterministic_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current placement of the threads of the thread pool.
+//
+// \return The core each thread is pinned to, or -1 for each thread that is not pinned.
+//
+// This function queries the current affinity of all threads of the thread pool. The i-th
+// element of the returned vector corresponds to the thread owning the i-th work queue, i.e.
+// the thread executing the i-th of a series of deterministically placed tasks. Note that
+// threads that have not yet started are not contained in the returned vector.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+std::vector<int> ThreadPool<TT,MT,LT,CT>::placement() const
+{
+   Lock lock( mutex_ );
+
+   std::vector<int> cores;
+
+   for( typename Queues::ConstIterator queue=queues_.begin(); queue!=queues_.end(); ++queue ) {
+      if( queue->owned_ ) {
+         cores.push_back( getThreadCore( queue->owner_ ) );
+      }
+   }
+
+   return cores;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -580,9 +849,34 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
-   waitForTask_.notify_one();
+   push( std::bind<void>( func, std::forward<Args>( args )... ), nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution as part of a task group.
+//
+// \param group The task group the scheduled task belongs to.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution in the context of the given
+// task group. The completion of the task can be awaited by means of the wait( TaskGroup& )
+// function. The given function/functor must be copyable, must be callable with the given type
+// and number of arguments and must return \c void.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void ThreadPool<TT,MT,LT,CT>::schedule( TaskGroup& group, Callable func, Args&&... args )
+{
+   group.add();
+   push( std::bind<void>( func, std::forward<Args>( args )... ), &group );
 }
 //*************************************************************************************************
 
@@ -681,12 +975,56 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pins the threads of the thread pool to the given cores.
+//
+// \param cores The cores the threads are pinned to (empty for no pinning).
+// \return void
+// \exception std::invalid_argument Invalid core.
+//
+// This function pins the thread owning the i-th work queue to the (i%n)-th of the n given
+// cores. Threads that are added to the thread pool later on are pinned accordingly. In case
+// the given list is empty, all threads are allowed to run on all available cores again. In
+// case any of the given cores is not available to the process, a \a std::invalid_argument
+// exception is thrown. Note that on systems that don't support thread pinning (see the
+// pinThread() function), this function has no effect.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setAffinity( const std::vector<int>& cores )
+{
+#if BLAZE_THREAD_PINNING
+   for( int core : cores ) {
+      if( !isAvailableCore( core ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid core" );
+      }
+   }
+#endif
+
+   Lock lock( mutex_ );
+
+   cores_ = cores;
+
+   for( typename Queues::Iterator queue=queues_.begin(); queue!=queues_.end(); ++queue ) {
+      if( queue->owned_ ) {
+         pinThread( queue->owner_, cores_.empty() ? -1 : cores_[ queue->index_ % cores_.size() ] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Waiting for all scheduled tasks to be completed.
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed, including the tasks
+// scheduled by other threads. Note that this function must not be called from within a task
+// executed by the thread pool. In order to wait for a specific subset of tasks or to wait
+// from within a task, the wait( TaskGroup& ) function has to be used.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -696,9 +1034,54 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 {
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
+   while( pending_ != 0UL ) {
       waitForThread_.wait( lock );
    }
+
+   context_.next_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks scheduled in the context of the given task group have
+// been completed. While waiting, the calling thread helps to execute pending tasks of the
+// thread pool. Therefore this function can also be called from within a task executed by the
+// thread pool. Note that in deterministic mode threads outside the thread pool do not execute
+// any tasks while waiting.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::wait( TaskGroup& group )
+{
+   const bool help( !deterministic_ || context_.pool_ == this );
+   WorkQueue* const own( ( context_.pool_ == this )?( context_.queue_ ):( nullptr ) );
+
+   Element element;
+
+   while( !group.isDone() )
+   {
+      if( help && acquireTask( element ) ) {
+         runTask( element );
+         continue;
+      }
+
+      Lock lock( mutex_ );
+
+      while( !group.isDone() &&
+             ( !help || ( queued_ == bound_ && ( own == nullptr || own->size_ == 0UL ) ) ) ) {
+         waitForThread_.wait( lock );
+      }
+   }
+
+   context_.next_ = 0UL;
 }
 //*************************************************************************************************
 
@@ -709,7 +1092,8 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 // \return void
 //
 // This function removes all currently scheduled tasks from the thread pool. The total number
-// of threads remains unchanged and all active threads continue completing their tasks.
+// of threads remains unchanged and all active threads continue completing their tasks. Removed
+// tasks that have been scheduled in the context of a task group count as completed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -718,7 +1102,7 @@ template< typename TT    // Type of the encapsulated thread
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
    Lock lock( mutex_ );
-   taskqueue_.clear();
+   clearQueues();
 }
 //*************************************************************************************************
 
@@ -735,6 +1119,8 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// This function must only be called while holding the lock of the thread pool.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -742,6 +1128,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
+   while( queues_.size() <= total_ ) {
+      addQueue();
+   }
+
    threads_.pushBack( new ManagedThread( this ) );
    ++total_;
    ++expected_;
@@ -756,8 +1146,9 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// The thread primarily executes the tasks of its own work queue and steals tasks from other
+// work queues in case its own queue is empty. In case there is no task available at all, the
+// thread blocks and waits for a new task to be scheduled.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -765,19 +1156,28 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 bool ThreadPool<TT,MT,LT,CT>::executeTask()
 {
-   threadpool::Task task;
+   if( context_.pool_ != this ) {
+      acquireQueue();
+   }
+
+   Element element;
 
    // Acquiring a scheduled task
+   while( !acquireTask( element ) )
    {
       Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
+      ++idle_;
+
+      while( queued_ == bound_ && context_.queue_->size_ == 0UL )
       {
          --active_;
          waitForThread_.notify_all();
 
          if( total_ > expected_ ) {
+            --idle_;
             --total_;
+            releaseQueue();
             return false;
          }
 
@@ -785,17 +1185,330 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
          ++active_;
       }
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+      --idle_;
    }
 
    // Executing the task
-   task();
+   runTask( element );
 
    return true;
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  WORK QUEUE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a new work queue to the thread pool.
+//
+// \return void
+//
+// This function adds a new work queue to the thread pool and publishes it to all threads. In
+// case the current lookup table is exhausted, a new lookup table of twice the size is created.
+// Previous lookup tables are kept alive until the destruction of the thread pool since other
+// threads might still access them. This function must only be called while holding the lock
+// of the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::addQueue()
+{
+   const size_t n( queues_.size() );
+
+   if( ( n & ( n - 1UL ) ) == 0UL )
+   {
+      QueueTable table( new WorkQueue*[ n == 0UL ? 1UL : 2UL*n ] );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         table[i] = queues_[i];
+      }
+
+      table_ = table.get();
+      tables_.push_back( std::move( table ) );
+   }
+
+   queues_.pushBack( new WorkQueue( n ) );
+   table_.load()[n] = queues_[n];
+   numQueues_ = n + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assigning an unowned work queue to the calling thread.
+//
+// \return void
+//
+// In case a list of cores has been specified (see the setAffinity() function), the calling
+// thread is pinned to the core corresponding to the index of the acquired work queue.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::acquireQueue()
+{
+   Lock lock( mutex_ );
+
+   for( typename Queues::Iterator queue=queues_.begin(); queue!=queues_.end(); ++queue ) {
+      if( !queue->owned_ ) {
+         Lock queueLock( queue->mutex_ );
+         queue->owned_    = true;
+         queue->owner_    = currentThread();
+         context_.pool_  = this;
+         context_.queue_ = *queue;
+
+         if( !cores_.empty() ) {
+            pinThread( queue->owner_, cores_[ queue->index_ % cores_.size() ] );
+         }
+         return;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( false, "No unowned work queue available" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing the work queue of the calling thread.
+//
+// \return void
+//
+// This function must only be called while holding the lock of the thread pool. The tasks bound
+// to the calling thread are unbound and can subsequently be executed by any thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::releaseQueue()
+{
+   BLAZE_INTERNAL_ASSERT( context_.pool_ == this, "Invalid thread context detected" );
+
+   WorkQueue* const queue( context_.queue_ );
+
+   {
+      Lock lock( queue->mutex_ );
+
+      queue->owned_ = false;
+
+      while( !queue->bound_.isEmpty() ) {
+         Element element( queue->bound_.steal() );
+         queue->tasks_.push( std::move( element.first ), element.second );
+         --bound_;
+      }
+   }
+
+   waitForTask_.notify_all();
+
+   context_.pool_  = nullptr;
+   context_.queue_ = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all tasks from all work queues.
+//
+// \return void
+//
+// This function must only be called while holding the lock of the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::clearQueues()
+{
+   bool notify( false );
+
+   for( typename Queues::Iterator queue=queues_.begin(); queue!=queues_.end(); ++queue )
+   {
+      Lock lock( queue->mutex_ );
+
+      while( !queue->tasks_.isEmpty() || !queue->bound_.isEmpty() )
+      {
+         const bool bound( queue->tasks_.isEmpty() );
+         const Element element( bound ? queue->bound_.steal() : queue->tasks_.steal() );
+         --queue->size_;
+         --queued_;
+         if( bound ) --bound_;
+
+         if( element.second != nullptr && element.second->finish() )
+            notify = true;
+         if( --pending_ == 0UL )
+            notify = true;
+      }
+   }
+
+   if( notify ) {
+      waitForThread_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a task to a work queue of the thread pool.
+//
+// \param task The task to be added.
+// \param group The task group the task belongs to (may be \c nullptr).
+// \return void
+//
+// This function adds the given task to the work queue of the calling thread. In case the
+// calling thread is not a thread of the thread pool, the task is added to one of the work
+// queues in a round-robin fashion. In deterministic mode, the round-robin distribution starts
+// at the first work queue after every call to a wait() function and the task is bound to the
+// thread owning the selected work queue.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::push( threadpool::Task task, TaskGroup* group )
+{
+   WorkQueue* queue( ( context_.pool_ == this )?( context_.queue_ ):( nullptr ) );
+   bool bind( false );
+
+   if( queue == nullptr ) {
+      const size_t n( numQueues_ );
+      queue = table_.load()[ ( deterministic_ ? context_.next_++ : next_++ ) % n ];
+      bind  = deterministic_;
+   }
+
+   // The counters are incremented before the task becomes visible to other threads
+   ++pending_;
+   ++queued_;
+
+   {
+      Lock lock( queue->mutex_ );
+      if( bind && queue->owned_ ) {
+         ++bound_;
+         queue->bound_.push( std::move( task ), group );
+      }
+      else {
+         queue->tasks_.push( std::move( task ), group );
+      }
+      ++queue->size_;
+   }
+
+   // Bound tasks can only be executed by a specific thread, which requires to wake all threads
+   if( idle_ > 0UL ) {
+      Lock lock( mutex_ );
+      if( bind ) waitForTask_.notify_all();
+      else       waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a task from the work queues of the thread pool.
+//
+// \param element The acquired task and its task group.
+// \return \a true in case a task could be acquired, \a false if not.
+//
+// This function acquires the most recently added task from the work queue of the calling
+// thread, followed by the oldest task bound to the calling thread. In case the work queue is
+// empty or the calling thread is not a thread of the thread pool, the oldest unbound task of
+// another work queue is stolen. The function does not block.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::acquireTask( Element& element )
+{
+   WorkQueue* own( ( context_.pool_ == this )?( context_.queue_ ):( nullptr ) );
+
+   // Acquiring a task from the own work queue
+   if( own != nullptr && own->size_ != 0UL )
+   {
+      Lock lock( own->mutex_ );
+
+      if( !own->tasks_.isEmpty() ) {
+         element = own->tasks_.pop();
+         --own->size_;
+         --queued_;
+         return true;
+      }
+
+      if( !own->bound_.isEmpty() ) {
+         element = own->bound_.steal();
+         --own->size_;
+         --bound_;
+         --queued_;
+         return true;
+      }
+   }
+
+   if( queued_ == bound_ )
+      return false;
+
+   // Stealing a task from another work queue
+   const size_t n( numQueues_ );
+   WorkQueue* const* table( table_ );
+   const size_t offset( ( own != nullptr )?( own->index_ + 1UL ):( next_++ ) );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      WorkQueue* const queue( table[ ( offset + i ) % n ] );
+
+      if( queue == own || queue->size_ == 0UL )
+         continue;
+
+      Lock lock( queue->mutex_ );
+
+      if( !queue->tasks_.isEmpty() ) {
+         element = queue->tasks_.steal();
+         --queue->size_;
+         --queued_;
+         return true;
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the given task.
+//
+// \param element The task to be executed and its task group.
+// \return void
+//
+// This function executes the given task and notifies all waiting threads in case either the
+// last task of the according task group or the last task of the thread pool was completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::runTask( Element& element )
+{
+   element.first();
+   element.first = nullptr;
+
+   const bool groupDone( element.second != nullptr && element.second->finish() );
+   const bool poolDone ( --pending_ == 0UL );
+
+   if( groupDone || poolDone ) {
+      Lock lock( mutex_ );
+      waitForThread_.notify_all();
+   }
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
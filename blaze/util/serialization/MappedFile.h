@@ -0,0 +1,361 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/serialization/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SERIALIZATION_MAPPEDFILE_H_
+#define _BLAZE_UTIL_SERIALIZATION_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping of a complete file.
+// \ingroup serialization
+//
+// The MappedFile class maps the complete content of a file into the address space of the process
+// (via \c mmap() on POSIX systems and via \c MapViewOfFile() on Windows). The mapping is created
+// on construction and released on destruction of the MappedFile:
+
+   \code
+   blaze::MappedFile file( "matrix.blzm" );
+
+   const byte_t* data( file.data() );  // Pointer to the first byte of the file
+   const size_t  size( file.size() );  // Total size of the file in bytes
+   \endcode
+
+// The file is opened read-only and the mapping is private (copy-on-write): The pages of the file
+// are loaded on demand by the operating system and are shared with the page cache and with all
+// other processes mapping the same file. Writing to the mapped memory is possible, but creates
+// a private copy of the affected pages only and never modifies the file. The first byte of the
+// mapping is aligned to the page size of the system.
+//
+// For files that are considerably larger than the available main memory, the prefetch() and
+// evict() functions give hints to the operating system about the pages that will be accessed
+// next and about pages that are not required anymore. This allows to stream through the file
+// with a bounded memory footprint while the next part of the file is read in the background:
+
+   \code
+   file.prefetch( offset+bytes, bytes );  // Start reading the next block in the background
+   // ... Processing of the block [offset..offset+bytes) ...
+   file.evict( offset, bytes );           // Release the processed block
+   \endcode
+
+// In case the file cannot be opened or mapped, a \a std::runtime_error exception is thrown.
+*/
+class MappedFile : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedFile( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline byte_t*       data() noexcept;
+   inline const byte_t* data() const noexcept;
+   inline size_t        size() const noexcept;
+   inline void          prefetch( size_t offset, size_t bytes ) const noexcept;
+   inline void          evict   ( size_t offset, size_t bytes ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* data_;  //!< Pointer to the first byte of the mapped file.
+   size_t  size_;  //!< The size of the mapped file in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the complete content of the given file into memory.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+*/
+inline MappedFile::MappedFile( const std::string& filename )
+   : data_( nullptr )  // Pointer to the first byte of the mapped file
+   , size_( 0UL )      // The size of the mapped file in bytes
+{
+#if defined(_WIN32)
+   HANDLE file( CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) );
+
+   if( file == INVALID_HANDLE_VALUE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   LARGE_INTEGER size;
+
+   if( !GetFileSizeEx( file, &size ) || size.QuadPart == 0 ) {
+      CloseHandle( file );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   HANDLE mapping( CreateFileMappingA( file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr ) );
+   CloseHandle( file );
+
+   if( mapping == nullptr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   void* data( MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 ) );
+   CloseHandle( mapping );
+
+   if( data == nullptr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   size_ = static_cast<size_t>( size.QuadPart );
+#else
+   const int fd( ::open( filename.c_str(), O_RDONLY ) );
+
+   if( fd == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   struct stat info;
+
+   if( ::fstat( fd, &info ) != 0 || info.st_size == 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   void* data( ::mmap( nullptr, static_cast<size_t>( info.st_size ), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE, fd, 0 ) );
+   ::close( fd );
+
+   if( data == MAP_FAILED ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   size_ = static_cast<size_t>( info.st_size );
+#endif
+
+   data_ = static_cast<byte_t*>( data );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MappedFile class.
+//
+// The destructor releases the mapping of the file. All pointers to the mapped memory become
+// invalid.
+*/
+inline MappedFile::~MappedFile()
+{
+#if defined(_WIN32)
+   UnmapViewOfFile( data_ );
+#else
+   ::munmap( data_, size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file.
+*/
+inline byte_t* MappedFile::data() noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file.
+*/
+inline const byte_t* MappedFile::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file in bytes.
+//
+// \return The size of the mapped file.
+*/
+inline size_t MappedFile::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requests the asynchronous read of the given range of the mapped file.
+//
+// \param offset The offset of the first byte of the range.
+// \param bytes The number of bytes of the range.
+// \return void
+//
+// This function advises the operating system that the given range of the file will be accessed
+// in the near future. On POSIX systems the pages are read in the background (via \c madvise()),
+// i.e. the function returns immediately and the read overlaps with the computation of the
+// calling thread. The range is clipped to the size of the file. On Windows this function is a
+// no-op.
+*/
+inline void MappedFile::prefetch( size_t offset, size_t bytes ) const noexcept
+{
+#if defined(_WIN32)
+   UNUSED_PARAMETER( offset, bytes );
+#else
+   if( offset >= size_ || bytes == 0UL )
+      return;
+
+   const size_t pagesize( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   const size_t first( offset - offset % pagesize );
+   const size_t last ( ( bytes < size_ - offset )?( offset + bytes ):( size_ ) );
+
+   ::madvise( data_ + first, last - first, MADV_WILLNEED );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the pages of the given range of the mapped file.
+//
+// \param offset The offset of the first byte of the range.
+// \param bytes The number of bytes of the range.
+// \return void
+//
+// This function advises the operating system that the given range of the file will not be
+// accessed in the near future. On POSIX systems the pages that lie completely within the range
+// are removed from the address space of the process (via \c madvise()) and are reloaded from
+// the file on the next access. Note that this discards all modifications of these pages! The
+// range is clipped to the size of the file. On Windows this function is a no-op.
+*/
+inline void MappedFile::evict( size_t offset, size_t bytes ) const noexcept
+{
+#if defined(_WIN32)
+   UNUSED_PARAMETER( offset, bytes );
+#else
+   if( offset >= size_ || bytes == 0UL )
+      return;
+
+   const size_t pagesize( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   const size_t first( ( offset + pagesize - 1UL ) / pagesize * pagesize );
+   const size_t last ( ( bytes < size_ - offset )?( offset + bytes ):( size_ ) );
+
+   if( last == size_ ) {
+      if( first < last )
+         ::madvise( data_ + first, last - first, MADV_DONTNEED );
+   }
+   else if( first < last - last % pagesize ) {
+      ::madvise( data_ + first, last - last % pagesize - first, MADV_DONTNEED );
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
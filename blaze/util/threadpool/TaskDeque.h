@@ -0,0 +1,314 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskDeque.h
+//  \brief Task deque for the work-stealing thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKDEQUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <deque>
+#include <utility>
+#include <blaze/util/Assert.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Task deque for the work-stealing thread pool.
+// \ingroup threads
+//
+// The TaskDeque class represents the per-thread task container of a work-stealing thread pool.
+// The owning thread adds and removes tasks at the back of the deque (LIFO), which keeps the
+// most recently scheduled and therefore cache-hot tasks on the owning thread. Idle threads
+// steal tasks from the front of the deque (FIFO), i.e. they take the oldest and typically
+// largest chunks of work. Every task can optionally be associated with a task group, which
+// is notified about the completion of the task. Note that the TaskDeque class itself is not
+// thread-safe; all accesses have to be synchronized by the managing thread pool.
+*/
+class TaskDeque
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::pair<Task,TaskGroup*>  Element;  //!< Type of a task and its associated group.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef std::deque<Element>  Tasks;  //!< Double-ended container for tasks.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef Tasks::size_type  SizeType;  //!< Size type of the task deque.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskDeque();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline SizeType maxSize()  const;
+   inline SizeType size()     const;
+   inline bool     isEmpty()  const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void    push ( Task task, TaskGroup* group=nullptr );
+   inline Element pop  ();
+   inline Element steal();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void swap( TaskDeque& td ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Tasks tasks_;  //!< Double-ended container for the contained tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for TaskDeque.
+*/
+inline TaskDeque::TaskDeque()
+   : tasks_()  // Double-ended container for the contained tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum possible size of a task deque.
+//
+// \return The maximum possible size.
+*/
+inline TaskDeque::SizeType TaskDeque::maxSize() const
+{
+   return tasks_.max_size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the task deque.
+//
+// \return The current size.
+//
+// This function returns the number of the currently contained tasks.
+*/
+inline TaskDeque::SizeType TaskDeque::size() const
+{
+   return tasks_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns \a true if the task deque has no elements.
+//
+// \return \a true if the task deque is empty, \a false if it is not.
+*/
+inline bool TaskDeque::isEmpty() const
+{
+   return tasks_.empty();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the back of the task deque.
+//
+// \param task The task to be added to the back of the task deque.
+// \param group The task group the task belongs to (optional).
+// \return void
+//
+// This function adds the given task to the back of the task deque. It runs in constant time.
+*/
+inline void TaskDeque::push( Task task, TaskGroup* group )
+{
+   tasks_.emplace_back( std::move( task ), group );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the task from the back of the task deque.
+//
+// \return The most recently added task and its associated task group.
+//
+// This function is used by the owning thread to acquire the next task for execution.
+*/
+inline TaskDeque::Element TaskDeque::pop()
+{
+   BLAZE_INTERNAL_ASSERT( !tasks_.empty(), "Empty task deque detected" );
+   Element element( std::move( tasks_.back() ) );
+   tasks_.pop_back();
+   return element;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the task from the front of the task deque.
+//
+// \return The least recently added task and its associated task group.
+//
+// This function is used by idle threads to steal a task from the deque of another thread.
+*/
+inline TaskDeque::Element TaskDeque::steal()
+{
+   BLAZE_INTERNAL_ASSERT( !tasks_.empty(), "Empty task deque detected" );
+   Element element( std::move( tasks_.front() ) );
+   tasks_.pop_front();
+   return element;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two task deques.
+//
+// \param td The task deque to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void TaskDeque::swap( TaskDeque& td ) noexcept
+{
+   tasks_.swap( td.tasks_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name TaskDeque operators */
+//@{
+inline void swap( TaskDeque& a, TaskDeque& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two task deques.
+//
+// \param a The first task deque to be swapped.
+// \param b The second task deque to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void swap( TaskDeque& a, TaskDeque& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
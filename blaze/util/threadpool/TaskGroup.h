@@ -0,0 +1,246 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskGroup.h
+//  \brief Task group for the thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ::blaze NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+template< typename TT, typename MT, typename LT, typename CT > class ThreadPool;
+
+
+
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Group of tasks scheduled for execution in a thread pool.
+// \ingroup threads
+//
+// The TaskGroup class counts the number of pending tasks that have been scheduled in the context
+// of the group. In contrast to the global wait() function of the ThreadPool class, which blocks
+// until all tasks of all threads have been completed, a task group makes it possible to wait for
+// a specific subset of tasks only:
+
+   \code
+   StdThreadPool threadpool( 4 );
+   blaze::threadpool::TaskGroup group;
+
+   threadpool.schedule( group, function0 );
+   threadpool.schedule( group, Functor2(), 4, 6 );
+
+   // Waiting for the two tasks of the group; tasks scheduled by other threads are not waited for
+   threadpool.wait( group );
+   \endcode
+
+// Note that a task group must outlive all of its scheduled tasks.
+*/
+class TaskGroup : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TaskGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t pending() const;
+   inline bool   isDone()  const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void add();
+   inline bool finish();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> pending_;  //!< The number of scheduled but not yet completed tasks.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename TT, typename MT, typename LT, typename CT > friend class blaze::ThreadPool;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for TaskGroup.
+*/
+inline TaskGroup::TaskGroup()
+   : pending_( 0UL )  // The number of scheduled but not yet completed tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the TaskGroup class.
+*/
+inline TaskGroup::~TaskGroup()
+{
+   BLAZE_INTERNAL_ASSERT( pending_ == 0UL, "Task group destroyed while tasks are pending" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of pending tasks of the task group.
+//
+// \return The number of scheduled but not yet completed tasks.
+*/
+inline size_t TaskGroup::pending() const
+{
+   return pending_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all tasks of the task group have been completed.
+//
+// \return \a true in case no task of the group is pending, \a false otherwise.
+*/
+inline bool TaskGroup::isDone() const
+{
+   return pending_ == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registers a new task in the task group.
+//
+// \return void
+*/
+inline void TaskGroup::add()
+{
+   ++pending_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks a task of the task group as completed.
+//
+// \return \a true in case the last pending task has been completed, \a false if not.
+*/
+inline bool TaskGroup::finish()
+{
+   BLAZE_INTERNAL_ASSERT( pending_ > 0UL, "Invalid number of pending tasks detected" );
+   return --pending_ == 0UL;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
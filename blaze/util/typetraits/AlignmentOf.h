@@ -69,7 +69,7 @@ struct AlignmentOfHelper
 
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = ( IsVectorizable<T>::value )?( 64UL ):( defaultAlignment );
 #elif BLAZE_AVX2_MODE
    static constexpr size_t value = ( IsVectorizable<T>::value )?( 32UL ):( defaultAlignment );
@@ -94,7 +94,7 @@ struct AlignmentOfHelper<float>
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -119,7 +119,7 @@ struct AlignmentOfHelper<double>
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -144,7 +144,7 @@ struct AlignmentOfHelper< complex<float> >
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -169,7 +169,7 @@ struct AlignmentOfHelper< complex<double> >
 {
  public:
    //**********************************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
    static constexpr size_t value = 64UL;
 #elif BLAZE_AVX_MODE
    static constexpr size_t value = 32UL;
@@ -189,18 +189,20 @@ struct AlignmentOfHelper< complex<double> >
 // \ingroup type_traits
 //
 // The AlignmentOf type trait template evaluates the required alignment for the given data type.
-// For instance, for fundamental data types that can be vectorized via SSE or AVX instructions,
-// the proper alignment is 16 or 32 bytes, respectively. For all other data types, a multiple
-// of the alignment chosen by the compiler is returned. The evaluated alignment can be queried
-// via the nested \a value member.
+// For instance, for fundamental data types that can be vectorized via SSE, AVX, or AVX-512
+// instructions, the proper alignment is 16, 32, or 64 bytes, respectively. For all other data
+// types, a multiple of the alignment chosen by the compiler is returned. The evaluated alignment
+// can be queried via the nested \a value member.
 
    \code
-   AlignmentOf<unsigned int>::value  // Evaluates to 32 if AVX2 is available, to 16 if only
-                                     // SSE2 is available, and a multiple of the alignment
-                                     // chosen by the compiler otherwise.
-   AlignmentOf<double>::value        // Evaluates to 32 if AVX is available, to 16 if only
-                                     // SSE is available, and a multiple of the alignment
-                                     // chosen by the compiler otherwise.
+   AlignmentOf<unsigned int>::value  // Evaluates to 64 if AVX-512 is available, to 32 if
+                                     // AVX2 is available, to 16 if only SSE2 is available,
+                                     // and a multiple of the alignment chosen by the
+                                     // compiler otherwise.
+   AlignmentOf<double>::value        // Evaluates to 64 if AVX-512 is available, to 32 if
+                                     // AVX is available, to 16 if only SSE is available,
+                                     // and a multiple of the alignment chosen by the
+                                     // compiler otherwise.
    \endcode
 */
 template< typename T >
@@ -0,0 +1,132 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/Mat3Vec3BatchMult.cpp
+//  \brief Source file for the Blaze 3D batched matrix/vector multiplication kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <vector>
+#include <blaze/math/Batch.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/StaticMatrix.h>
+#include <blazemark/blaze/init/StaticVector.h>
+#include <blazemark/blaze/Mat3Vec3BatchMult.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze 3-dimensional batched matrix/vector multiplication kernel.
+//
+// \param N The number of 3x3 matrices and 3D vectors to be computed.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the 3-dimensional batched matrix/vector multiplication by
+// means of the Blaze functionality. In each step, all \a N matrix/vector products are computed
+// by a single call to the batchMult() function.
+*/
+double mat3vec3batchmult( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+   using ::blaze::columnVector;
+
+   typedef ::blaze::StaticMatrix<element_t,3UL,3UL,rowMajor>  MatrixType;
+   typedef ::blaze::StaticVector<element_t,3UL,columnVector>  VectorType;
+   typedef ::blaze::AlignedAllocator<MatrixType>              MatrixAllocatorType;
+   typedef ::blaze::AlignedAllocator<VectorType>              VectorAllocatorType;
+   typedef ::blaze::MatrixBatch<element_t,3UL,3UL>            MatrixBatchType;
+   typedef ::blaze::VectorBatch<element_t,3UL>                VectorBatchType;
+
+   ::blaze::setSeed( seed );
+
+   ::std::vector< MatrixType, MatrixAllocatorType > tmpA( N );
+   ::std::vector< VectorType, VectorAllocatorType > tmpa( N );
+   MatrixBatchType A( N );
+   VectorBatchType a( N ), b( N );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      init( tmpA[i] );
+      init( tmpa[i] );
+      A.set( i, tmpA[i] );
+      a.set( i, tmpa[i] );
+   }
+
+   batchMult( b, A, a );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         batchMult( b, A, a );
+      }
+      timer.end();
+
+      for( size_t i=0UL; i<N; ++i )
+         if( b(i,0UL) < element_t(0) )
+            std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'mat3vec3batchmult': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
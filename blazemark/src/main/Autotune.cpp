@@ -0,0 +1,685 @@
+//=================================================================================================
+/*!
+//  \file src/main/Autotune.cpp
+//  \brief Source file for the Blaze threshold autotuning tool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/Batch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/blaze/init/StaticMatrix.h>
+#include <blazemark/system/Config.h>
+
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
+#  error "The autotuner requires runtime thresholds (compile with -DBLAZE_USE_RUNTIME_THRESHOLDS=1)"
+#endif
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::element_t;
+using blaze::columnMajor;
+using blaze::rowMajor;
+using blaze::Threshold;
+
+
+
+
+//=================================================================================================
+//
+//  TUNING SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Minimum duration of a single time measurement [s].
+*/
+const double minTime( 0.01 );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Growth factor between two consecutive problem sizes of a size sweep.
+*/
+const double growth( 1.25 );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment of the left-hand side operand.
+*/
+struct AssignOp
+{
+   template< typename T, typename T1, typename T2 >
+   void operator()( T& c, const T1& a, const T2& ) const { c = a; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of the two operands.
+*/
+struct AddOp
+{
+   template< typename T, typename T1, typename T2 >
+   void operator()( T& c, const T1& a, const T2& b ) const { c = a + b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of the two operands.
+*/
+struct SubOp
+{
+   template< typename T, typename T1, typename T2 >
+   void operator()( T& c, const T1& a, const T2& b ) const { c = a - b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the two operands.
+*/
+struct MultOp
+{
+   template< typename T, typename T1, typename T2 >
+   void operator()( T& c, const T1& a, const T2& b ) const { c = a * b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division of the two operands.
+*/
+struct DivOp
+{
+   template< typename T, typename T1, typename T2 >
+   void operator()( T& c, const T1& a, const T2& b ) const { c = a / b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the left-hand side operand.
+*/
+struct ScaleOp
+{
+   template< typename T, typename T1, typename T2 >
+   void operator()( T& c, const T1& a, const T2& ) const { c = a * element_t(2.1); }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel for dense vector operations of the form \f$ \vec{c}=op(\vec{a},\vec{b}) \f$.
+*/
+template< typename OP >  // Type of the operation
+struct DVecDVecKernel
+{
+   void setup( size_t N ) {
+      a_.resize( N, false );
+      b_.resize( N, false );
+      c_.resize( N, false );
+      blazemark::blaze::init( a_ );
+      blazemark::blaze::init( b_ );
+   }
+
+   void run() { op_( c_, a_, b_ ); }
+
+   blaze::DynamicVector<element_t> a_, b_, c_;
+   OP op_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for dense matrix operations of the form \f$ C=op(A,B) \f$.
+*/
+template< typename OP  // Type of the operation
+        , bool SO1     // Storage order of the left-hand side operand and the target matrix
+        , bool SO2 >   // Storage order of the right-hand side operand
+struct DMatDMatKernel
+{
+   void setup( size_t N ) {
+      A_.resize( N, N, false );
+      B_.resize( N, N, false );
+      C_.resize( N, N, false );
+      blazemark::blaze::init( A_ );
+      blazemark::blaze::init( B_ );
+   }
+
+   void run() { op_( C_, A_, B_ ); }
+
+   blaze::DynamicMatrix<element_t,SO1> A_, C_;
+   blaze::DynamicMatrix<element_t,SO2> B_;
+   OP op_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for the dense matrix/dense vector multiplication \f$ \vec{y}=A*\vec{x} \f$.
+*/
+template< bool SO >  // Storage order of the matrix
+struct DMatDVecMultKernel
+{
+   void setup( size_t N ) {
+      A_.resize( N, N, false );
+      x_.resize( N, false );
+      y_.resize( N, false );
+      blazemark::blaze::init( A_ );
+      blazemark::blaze::init( x_ );
+   }
+
+   void run() { y_ = A_ * x_; }
+
+   blaze::DynamicMatrix<element_t,SO> A_;
+   blaze::DynamicVector<element_t,blaze::columnVector> x_, y_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for the dense vector/dense matrix multiplication \f$ \vec{y}^T=\vec{x}^T*A \f$.
+*/
+template< bool SO >  // Storage order of the matrix
+struct TDVecDMatMultKernel
+{
+   void setup( size_t N ) {
+      A_.resize( N, N, false );
+      x_.resize( N, false );
+      y_.resize( N, false );
+      blazemark::blaze::init( A_ );
+      blazemark::blaze::init( x_ );
+   }
+
+   void run() { y_ = x_ * A_; }
+
+   blaze::DynamicMatrix<element_t,SO> A_;
+   blaze::DynamicVector<element_t,blaze::rowVector> x_, y_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for the dense vector outer product \f$ A=\vec{a}*\vec{b}^T \f$.
+*/
+struct DVecTDVecMultKernel
+{
+   void setup( size_t N ) {
+      a_.resize( N, false );
+      b_.resize( N, false );
+      A_.resize( N, N, false );
+      blazemark::blaze::init( a_ );
+      blazemark::blaze::init( b_ );
+   }
+
+   void run() { A_ = a_ * trans( b_ ); }
+
+   blaze::DynamicVector<element_t> a_, b_;
+   blaze::DynamicMatrix<element_t,rowMajor> A_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for the dense vector reduction \f$ s=\sum_i a_i \f$.
+*/
+struct DVecReduceKernel
+{
+   void setup( size_t N ) {
+      a_.resize( N, false );
+      blazemark::blaze::init( a_ );
+   }
+
+   void run() { s_ = reduce( a_, blaze::Add() ); }
+
+   blaze::DynamicVector<element_t> a_;
+   volatile element_t s_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for the dense matrix reduction \f$ s=\sum_{i,j} A_{ij} \f$.
+*/
+struct DMatReduceKernel
+{
+   void setup( size_t N ) {
+      A_.resize( N, N, false );
+      blazemark::blaze::init( A_ );
+   }
+
+   void run() { s_ = reduce( A_, blaze::Add() ); }
+
+   blaze::DynamicMatrix<element_t,rowMajor> A_;
+   volatile element_t s_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for the batched multiplication of \f$ 3 \times 3 \f$ matrices.
+*/
+struct BatchMultKernel
+{
+   typedef blaze::MatrixBatch<element_t,3UL,3UL>  BatchType;
+
+   void setup( size_t N ) {
+      blaze::StaticMatrix<element_t,3UL,3UL,rowMajor> tmp;
+      A_ = BatchType( N );
+      B_ = BatchType( N );
+      C_ = BatchType( N );
+      for( size_t k=0UL; k<N; ++k ) {
+         blazemark::blaze::init( tmp );
+         A_.set( k, tmp );
+         blazemark::blaze::init( tmp );
+         B_.set( k, tmp );
+      }
+   }
+
+   void run() { batchMult( C_, A_, B_ ); }
+
+   BatchType A_, B_, C_;
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD METRICS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Threshold metric of thresholds that are compared to a vector size or a batch size.
+//
+// \param N The problem size of the kernel.
+// \return The value that is compared to the threshold.
+*/
+size_t vectorMetric( size_t N )
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Threshold metric of thresholds that are compared to the number of matrix elements.
+//
+// \param N The problem size of the kernel.
+// \return The value that is compared to the threshold.
+*/
+size_t matrixMetric( size_t N )
+{
+   return N*N;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TUNING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of a single execution of the given kernel.
+//
+// \param kernel The kernel to be measured.
+// \return The minimum runtime of a single kernel execution [s].
+*/
+template< typename Kernel >
+double measure( Kernel& kernel )
+{
+   size_t steps( 1UL );
+
+   kernel.run();
+
+   while( true ) {
+      blaze::timing::WcTimer timer;
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         kernel.run();
+      }
+      timer.end();
+      if( timer.last() >= minTime )
+         break;
+      steps *= 2UL;
+   }
+
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         kernel.run();
+      }
+      timer.end();
+   }
+
+   return timer.min() / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover point of the given threshold.
+//
+// \param threshold The threshold to be tuned.
+// \param metric The threshold metric for a given problem size.
+// \param first The smallest problem size of the size sweep.
+// \param last The largest problem size of the size sweep.
+// \param large The threshold value that enforces the kernel for large problem sizes.
+// \return The tuned value of the threshold.
+//
+// This function runs the given kernel for a geometric sweep of problem sizes, once with the
+// kernel for small problem sizes (i.e. the serial or custom Blaze kernel) and once with the
+// kernel for large problem sizes (i.e. the parallel or BLAS kernel). The tuned threshold lies
+// between the largest problem size for which the small kernel is faster and the next problem
+// size, from which on the large kernel wins for all remaining sizes. In case the large kernel
+// does not win for at least the two largest problem sizes, the default value of the threshold
+// is kept.
+*/
+template< typename Kernel >
+size_t tune( const Threshold& threshold, size_t (*metric)( size_t ),
+             size_t first, size_t last, size_t large )
+{
+   Kernel kernel;
+   std::vector<size_t> metrics;
+   std::vector<bool> wins;
+
+   blaze::setSeed( blazemark::seed );
+
+   std::cout << "\n " << threshold.name() << " (default " << threshold.defaultValue() << ")\n"
+             << "   " << std::setw(12) << "size" << std::setw(14) << "small [s]"
+             << std::setw(14) << "large [s]" << "\n";
+
+   for( size_t N=first; N<=last; N=std::max( N+1UL, size_t( N*growth ) ) )
+   {
+      kernel.setup( N );
+
+      blaze::setThreshold( threshold, size_t(-1) );
+      const double smallTime( measure( kernel ) );
+
+      blaze::setThreshold( threshold, large );
+      const double largeTime( measure( kernel ) );
+
+      metrics.push_back( metric( N ) );
+      wins.push_back( largeTime < smallTime );
+
+      std::cout << "   " << std::setw(12) << metrics.back()
+                << std::setw(14) << std::setprecision(4) << smallTime
+                << std::setw(14) << std::setprecision(4) << largeTime << "\n";
+   }
+
+   size_t i( wins.size() );
+   while( i > 0UL && wins[i-1UL] ) {
+      --i;
+   }
+
+   size_t value( threshold.defaultValue() );
+
+   if( wins.size() - i < std::min<size_t>( 2UL, wins.size() ) )
+      std::cout << "   No crossover within the size sweep, keeping the default value\n";
+   else if( i == 0UL )
+      value = metrics.front();
+   else
+      value = size_t( std::sqrt( double( metrics[i-1UL] ) * double( metrics[i] ) ) );
+
+   blaze::setThreshold( threshold, value );
+
+   std::cout << "   " << threshold.name() << " = " << value << std::endl;
+
+   return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TUNER TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Tuning setup for a single threshold.
+*/
+struct Tuner
+{
+   Threshold threshold;  //!< The threshold to be tuned.
+   size_t (*tune)( const Threshold&, size_t (*)( size_t ), size_t, size_t, size_t );
+                         //!< The tuning function for the threshold.
+   size_t (*metric)( size_t );  //!< The threshold metric.
+   size_t first;         //!< The smallest problem size of the size sweep.
+   size_t last;          //!< The largest problem size of the size sweep.
+   size_t large;         //!< The threshold value that enforces the kernel for large sizes.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the tuning setups of all thresholds that can be tuned in the current setting.
+//
+// \return The tuning setups of all tunable thresholds.
+//
+// The SMP thresholds can only be tuned in case shared memory parallelization is active, the
+// BLAS thresholds can only be tuned in case the BLAS mode is active.
+*/
+std::vector<Tuner> getTuners()
+{
+   std::vector<Tuner> tuners;
+
+   if( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+   {
+      tuners.push_back( { blaze::SMP_DVECASSIGN_THRESHOLD    , &tune< DVecDVecKernel<AssignOp> >, &vectorMetric, 256UL, 4000000UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DVECDVECADD_THRESHOLD   , &tune< DVecDVecKernel<AddOp> >   , &vectorMetric, 256UL, 4000000UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DVECDVECSUB_THRESHOLD   , &tune< DVecDVecKernel<SubOp> >   , &vectorMetric, 256UL, 4000000UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DVECDVECMULT_THRESHOLD  , &tune< DVecDVecKernel<MultOp> >  , &vectorMetric, 256UL, 4000000UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DVECDVECDIV_THRESHOLD   , &tune< DVecDVecKernel<DivOp> >   , &vectorMetric, 256UL, 4000000UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DVECSCALARMULT_THRESHOLD, &tune< DVecDVecKernel<ScaleOp> > , &vectorMetric, 256UL, 4000000UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATDVECMULT_THRESHOLD  , &tune< DMatDVecMultKernel<rowMajor> >   , &vectorMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_TDMATDVECMULT_THRESHOLD , &tune< DMatDVecMultKernel<columnMajor> >, &vectorMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_TDVECDMATMULT_THRESHOLD , &tune< TDVecDMatMultKernel<rowMajor> >   , &vectorMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_TDVECTDMATMULT_THRESHOLD, &tune< TDVecDMatMultKernel<columnMajor> >, &vectorMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATASSIGN_THRESHOLD    , &tune< DMatDMatKernel<AssignOp,rowMajor,rowMajor> >   , &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATDMATADD_THRESHOLD   , &tune< DMatDMatKernel<AddOp,rowMajor,rowMajor> >      , &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATTDMATADD_THRESHOLD  , &tune< DMatDMatKernel<AddOp,rowMajor,columnMajor> >   , &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATDMATSUB_THRESHOLD   , &tune< DMatDMatKernel<SubOp,rowMajor,rowMajor> >      , &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATTDMATSUB_THRESHOLD  , &tune< DMatDMatKernel<SubOp,rowMajor,columnMajor> >   , &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATSCALARMULT_THRESHOLD, &tune< DMatDMatKernel<ScaleOp,rowMajor,rowMajor> >    , &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATDMATMULT_THRESHOLD  , &tune< DMatDMatKernel<MultOp,rowMajor,rowMajor> >      , &matrixMetric, 8UL, 512UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATTDMATMULT_THRESHOLD , &tune< DMatDMatKernel<MultOp,rowMajor,columnMajor> >   , &matrixMetric, 8UL, 512UL, 0UL } );
+      tuners.push_back( { blaze::SMP_TDMATDMATMULT_THRESHOLD , &tune< DMatDMatKernel<MultOp,columnMajor,rowMajor> >   , &matrixMetric, 8UL, 512UL, 0UL } );
+      tuners.push_back( { blaze::SMP_TDMATTDMATMULT_THRESHOLD, &tune< DMatDMatKernel<MultOp,columnMajor,columnMajor> >, &matrixMetric, 8UL, 512UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DVECTDVECMULT_THRESHOLD , &tune< DVecTDVecMultKernel >, &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DVECREDUCE_THRESHOLD    , &tune< DVecReduceKernel >   , &vectorMetric, 256UL, 4000000UL, 0UL } );
+      tuners.push_back( { blaze::SMP_DMATREDUCE_THRESHOLD    , &tune< DMatReduceKernel >   , &matrixMetric, 16UL, 2048UL, 0UL } );
+      tuners.push_back( { blaze::SMP_BATCH_THRESHOLD         , &tune< BatchMultKernel >    , &vectorMetric, 16UL, 65536UL, 0UL } );
+   }
+
+   if( BLAZE_BLAS_MODE )
+   {
+      tuners.push_back( { blaze::DMATDVECMULT_THRESHOLD  , &tune< DMatDVecMultKernel<rowMajor> >   , &matrixMetric, 16UL, 4096UL, 1UL } );
+      tuners.push_back( { blaze::TDMATDVECMULT_THRESHOLD , &tune< DMatDVecMultKernel<columnMajor> >, &matrixMetric, 16UL, 4096UL, 1UL } );
+      tuners.push_back( { blaze::TDVECDMATMULT_THRESHOLD , &tune< TDVecDMatMultKernel<rowMajor> >   , &matrixMetric, 16UL, 4096UL, 1UL } );
+      tuners.push_back( { blaze::TDVECTDMATMULT_THRESHOLD, &tune< TDVecDMatMultKernel<columnMajor> >, &matrixMetric, 16UL, 4096UL, 1UL } );
+      tuners.push_back( { blaze::DMATDMATMULT_THRESHOLD  , &tune< DMatDMatKernel<MultOp,rowMajor,rowMajor> >      , &matrixMetric, 8UL, 512UL, 1UL } );
+      tuners.push_back( { blaze::DMATTDMATMULT_THRESHOLD , &tune< DMatDMatKernel<MultOp,rowMajor,columnMajor> >   , &matrixMetric, 8UL, 512UL, 1UL } );
+      tuners.push_back( { blaze::TDMATDMATMULT_THRESHOLD , &tune< DMatDMatKernel<MultOp,columnMajor,rowMajor> >   , &matrixMetric, 8UL, 512UL, 1UL } );
+      tuners.push_back( { blaze::TDMATTDMATMULT_THRESHOLD, &tune< DMatDMatKernel<MultOp,columnMajor,columnMajor> >, &matrixMetric, 8UL, 512UL, 1UL } );
+   }
+
+   return tuners;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze threshold autotuning tool.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The autotuning tool measures the crossover points between the serial and the parallel
+// execution (in case shared memory parallelization is active) and between the custom Blaze
+// kernels and the BLAS kernels (in case the BLAS mode is active) on the executing machine
+// and writes the according thresholds to a threshold profile:
+
+   \code
+   ./autotune [-o <profile>] [<threshold> ...]
+   \endcode
+
+// By default all tunable thresholds are measured and the profile is written to the file
+// \c thresholds.txt. All thresholds that are not tuned keep their compile time defaults. The
+// profile is used by all Blaze programs that are executed with the \c BLAZE_THRESHOLD_PROFILE
+// environment variable set to the name of the profile. Note that the SMP thresholds depend on
+// the number of threads, which is specified as usual via the \c BLAZE_NUM_THREADS or
+// \c OMP_NUM_THREADS environment variables.
+*/
+int main( int argc, char** argv )
+{
+   std::string profile( "thresholds.txt" );
+   std::vector<std::string> names;
+
+   for( int i=1; i<argc; ++i ) {
+      if( std::string( argv[i] ) == "-o" && i+1 < argc )
+         profile = argv[++i];
+      else if( argv[i][0] == '-' ) {
+         std::cerr << " Invalid use of program 'Autotune'!\n"
+                   << "   Use: ./autotune [-o <profile>] [<threshold> ...]\n" << std::endl;
+         return EXIT_FAILURE;
+      }
+      else names.push_back( argv[i] );
+   }
+
+   const std::vector<Tuner> tuners( getTuners() );
+
+   if( tuners.empty() ) {
+      std::cerr << " No tunable thresholds! Activate the shared memory parallelization and/or\n"
+                << " the BLAS mode in order to tune the according thresholds.\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   for( const std::string& name : names ) {
+      bool found( false );
+      for( const Tuner& tuner : tuners )
+         found = found || ( name == tuner.threshold.name() );
+      if( !found ) {
+         std::cerr << " Unknown or untunable threshold '" << name << "'!\n" << std::endl;
+         return EXIT_FAILURE;
+      }
+   }
+
+   blaze::resetThresholds();
+
+   std::cout << "\n Blaze threshold autotuning\n";
+
+   for( const Tuner& tuner : tuners )
+   {
+      bool selected( names.empty() );
+      for( const std::string& name : names )
+         selected = selected || ( name == tuner.threshold.name() );
+
+      if( selected ) {
+         tuner.tune( tuner.threshold, tuner.metric, tuner.first, tuner.last, tuner.large );
+      }
+   }
+
+   try {
+      blaze::saveThresholds( profile );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n " << ex.what() << "\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Threshold profile written to '" << profile << "'. Use it via\n"
+             << "   export BLAZE_THRESHOLD_PROFILE=" << profile << "\n" << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
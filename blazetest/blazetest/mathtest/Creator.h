@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blazetest/mathtest/creator/Complex.h>
+#include <blazetest/mathtest/creator/CompactMatrix.h>
 #include <blazetest/mathtest/creator/CompressedDiagonal.h>
 #include <blazetest/mathtest/creator/CompressedHermitian.h>
 #include <blazetest/mathtest/creator/CompressedLower.h>
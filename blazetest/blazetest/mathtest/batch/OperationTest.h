@@ -0,0 +1,654 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/batch/OperationTest.h
+//  \brief Header file for the batched matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BATCH_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_BATCH_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/Batch.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/util/AlignedAllocator.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all batched matrix operation tests.
+//
+// This class represents a test suite for the MatrixBatch and VectorBatch class templates and
+// the batchMult(), batchInvert(), batchDet(), and batchSolve() functions. The batched results
+// are compared to the according results of the individual StaticMatrix and StaticVector
+// instances.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMatrixBatch();
+   void testVectorBatch();
+   void testSizeMismatch();
+   void testSingular();
+
+   template< typename Type, size_t M, size_t K, size_t N >
+   void testMatMatMult( size_t n );
+
+   template< typename Type, size_t M, size_t N >
+   void testMatVecMult( size_t n );
+
+   template< typename Type, size_t N >
+   void testInversion( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix/matrix multiplication.
+//
+// \param n The number of matrices in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batchMult() functions for the multiplication of \a n random matrices
+// stored both in MatrixBatch instances and in arrays of StaticMatrix instances. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void OperationTest::testMatMatMult( size_t n )
+{
+   using blaze::equal;
+
+   typedef blaze::StaticMatrix<Type,M,K,blaze::rowMajor>     LMT;
+   typedef blaze::StaticMatrix<Type,K,N,blaze::columnMajor>  RMT;
+   typedef blaze::StaticMatrix<Type,M,N,blaze::rowMajor>     TMT;
+
+   std::vector< LMT, blaze::AlignedAllocator<LMT> > lhs( n );
+   std::vector< RMT, blaze::AlignedAllocator<RMT> > rhs( n );
+   std::vector< TMT, blaze::AlignedAllocator<TMT> > ref( n ), res( n );
+
+   blaze::MatrixBatch<Type,M,K> A( n );
+   blaze::MatrixBatch<Type,K,N> B( n );
+   blaze::MatrixBatch<Type,M,N> C;
+
+   for( size_t l=0UL; l<n; ++l ) {
+      randomize( lhs[l] );
+      randomize( rhs[l] );
+      A.set( l, lhs[l] );
+      B.set( l, rhs[l] );
+      ref[l] = lhs[l] * rhs[l];
+   }
+
+
+   //=====================================================================================
+   // MatrixBatch multiplication
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch multiplication";
+
+      batchMult( C, A, B );
+
+      if( C.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch size\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Size         : " << C.size() << "\n"
+             << "   Expected size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t l=0UL; l<n; ++l ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               if( !equal( C(l,i,j), ref[l](i,j) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Multiplication failed\n"
+                      << " Details:\n"
+                      << "   Element type:\n"
+                      << "     " << typeid( Type ).name() << "\n"
+                      << "   Batch size: " << n << "\n"
+                      << "   Index     : " << l << "\n"
+                      << "   Result:\n" << C.get(l) << "\n"
+                      << "   Expected result:\n" << ref[l] << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      if( !isIntact( C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariant violation detected\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Batch size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // StaticMatrix array multiplication
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrix array multiplication";
+
+      batchMult( res.data(), lhs.data(), rhs.data(), n );
+
+      for( size_t l=0UL; l<n; ++l ) {
+         if( res[l] != ref[l] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size: " << n << "\n"
+                << "   Index     : " << l << "\n"
+                << "   Result:\n" << res[l] << "\n"
+                << "   Expected result:\n" << ref[l] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix/vector multiplication.
+//
+// \param n The number of matrices and vectors in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batchMult() functions for the multiplication of \a n random matrices
+// and vectors stored both in MatrixBatch/VectorBatch instances and in arrays of StaticMatrix
+// and StaticVector instances. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type  // Element type
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+void OperationTest::testMatVecMult( size_t n )
+{
+   using blaze::equal;
+
+   typedef blaze::StaticMatrix<Type,M,N,blaze::columnMajor>  MT;
+   typedef blaze::StaticVector<Type,N,blaze::columnVector>   VT;
+   typedef blaze::StaticVector<Type,M,blaze::columnVector>   TVT;
+
+   std::vector< MT , blaze::AlignedAllocator<MT>  > mat( n );
+   std::vector< VT , blaze::AlignedAllocator<VT>  > vec( n );
+   std::vector< TVT, blaze::AlignedAllocator<TVT> > ref( n ), res( n );
+
+   blaze::MatrixBatch<Type,M,N> A( n );
+   blaze::VectorBatch<Type,N> x( n );
+   blaze::VectorBatch<Type,M> y;
+
+   for( size_t l=0UL; l<n; ++l ) {
+      randomize( mat[l] );
+      randomize( vec[l] );
+      A.set( l, mat[l] );
+      x.set( l, vec[l] );
+      ref[l] = mat[l] * vec[l];
+   }
+
+
+   //=====================================================================================
+   // MatrixBatch/VectorBatch multiplication
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch/VectorBatch multiplication";
+
+      batchMult( y, A, x );
+
+      if( y.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch size\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Size         : " << y.size() << "\n"
+             << "   Expected size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t l=0UL; l<n; ++l ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            if( !equal( y(l,i), ref[l][i] ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Element type:\n"
+                   << "     " << typeid( Type ).name() << "\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Index     : " << l << "\n"
+                   << "   Result:\n" << y.get(l) << "\n"
+                   << "   Expected result:\n" << ref[l] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // StaticMatrix/StaticVector array multiplication
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrix/StaticVector array multiplication";
+
+      batchMult( res.data(), mat.data(), vec.data(), n );
+
+      for( size_t l=0UL; l<n; ++l ) {
+         if( res[l] != ref[l] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size: " << n << "\n"
+                << "   Index     : " << l << "\n"
+                << "   Result:\n" << res[l] << "\n"
+                << "   Expected result:\n" << ref[l] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched inversion, determinant, and solve functions.
+//
+// \param n The number of matrices in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batchInvert(), batchDet(), and batchSolve() functions for \a n random,
+// diagonally dominant matrices stored both in MatrixBatch instances and in arrays of StaticMatrix
+// instances. The results are compared to the results of the invert() and det() functions for
+// the individual matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type  // Element type
+        , size_t N >     // Number of rows and columns of the matrices
+void OperationTest::testInversion( size_t n )
+{
+   using blaze::equal;
+
+   typedef blaze::StaticMatrix<Type,N,N,blaze::rowMajor>  MT;
+   typedef blaze::StaticVector<Type,N,blaze::columnVector>  VT;
+
+   std::vector< MT, blaze::AlignedAllocator<MT> > mat( n ), inv( n ), res( n );
+   std::vector< VT, blaze::AlignedAllocator<VT> > rhs( n ), sol( n ), x( n );
+   std::vector< Type > ref( n ), d( n );
+
+   blaze::MatrixBatch<Type,N,N> A( n ), B;
+   blaze::VectorBatch<Type,N> b( n ), y;
+   blaze::DynamicVector<Type> dets;
+
+   for( size_t l=0UL; l<n; ++l ) {
+      randomize( mat[l] );
+      randomize( rhs[l] );
+      for( size_t i=0UL; i<N; ++i )
+         mat[l](i,i) += Type( 4*N );
+      A.set( l, mat[l] );
+      b.set( l, rhs[l] );
+      inv[l] = blaze::inv( mat[l] );
+      ref[l] = blaze::det( mat[l] );
+      sol[l] = inv[l] * rhs[l];
+   }
+
+
+   //=====================================================================================
+   // MatrixBatch determinant
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch determinant";
+
+      batchDet( dets, A );
+
+      if( dets.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid vector size\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Size         : " << dets.size() << "\n"
+             << "   Expected size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t l=0UL; l<n; ++l ) {
+         if( !equal( dets[l], ref[l] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Determinant computation failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size: " << n << "\n"
+                << "   Index     : " << l << "\n"
+                << "   Result: " << dets[l] << "\n"
+                << "   Expected result: " << ref[l] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // StaticMatrix array determinant
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrix array determinant";
+
+      batchDet( d.data(), mat.data(), n );
+
+      for( size_t l=0UL; l<n; ++l ) {
+         if( !equal( d[l], ref[l] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Determinant computation failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size: " << n << "\n"
+                << "   Index     : " << l << "\n"
+                << "   Result: " << d[l] << "\n"
+                << "   Expected result: " << ref[l] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // MatrixBatch/VectorBatch solve
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch/VectorBatch solve";
+
+      batchSolve( y, A, b );
+
+      if( y.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch size\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Size         : " << y.size() << "\n"
+             << "   Expected size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t l=0UL; l<n; ++l ) {
+         for( size_t i=0UL; i<N; ++i ) {
+            if( !equal( y(l,i), sol[l][i] ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the linear system failed\n"
+                   << " Details:\n"
+                   << "   Element type:\n"
+                   << "     " << typeid( Type ).name() << "\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Index     : " << l << "\n"
+                   << "   Result:\n" << y.get(l) << "\n"
+                   << "   Expected result:\n" << sol[l] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // StaticMatrix/StaticVector array solve
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrix/StaticVector array solve";
+
+      batchSolve( x.data(), mat.data(), rhs.data(), n );
+
+      for( size_t l=0UL; l<n; ++l ) {
+         if( x[l] != sol[l] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the linear system failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size: " << n << "\n"
+                << "   Index     : " << l << "\n"
+                << "   Result:\n" << x[l] << "\n"
+                << "   Expected result:\n" << sol[l] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // MatrixBatch inversion
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch inversion";
+
+      B = A;
+      batchInvert( B );
+
+      for( size_t l=0UL; l<n; ++l ) {
+         for( size_t i=0UL; i<N; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               if( !equal( B(l,i,j), inv[l](i,j) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Inversion failed\n"
+                      << " Details:\n"
+                      << "   Element type:\n"
+                      << "     " << typeid( Type ).name() << "\n"
+                      << "   Batch size: " << n << "\n"
+                      << "   Index     : " << l << "\n"
+                      << "   Result:\n" << B.get(l) << "\n"
+                      << "   Expected result:\n" << inv[l] << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      if( !isIntact( B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariant violation detected\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Batch size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // StaticMatrix array inversion
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrix array inversion";
+
+      res = mat;
+      batchInvert( res.data(), n );
+
+      for( size_t l=0UL; l<n; ++l ) {
+         if( res[l] != inv[l] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size: " << n << "\n"
+                << "   Index     : " << l << "\n"
+                << "   Result:\n" << res[l] << "\n"
+                << "   Expected result:\n" << inv[l] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the batched matrix operations.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the batched matrix operation test.
+*/
+#define RUN_BATCH_OPERATION_TEST \
+   blazetest::mathtest::batch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace batch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
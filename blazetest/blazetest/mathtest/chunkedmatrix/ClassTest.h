@@ -0,0 +1,236 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/chunkedmatrix/ClassTest.h
+//  \brief Header file for the ChunkedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_CHUNKEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_CHUNKEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/constraints/Vector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace chunkedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the ChunkedMatrix class.
+//
+// This class represents a test suite for the blaze::ChunkedMatrix class template and the
+// according out-of-core multiplication kernels. It performs a series of runtime tests with
+// dense matrices, which are written into a file and processed panel by panel.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~ClassTest();
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPanels   ();
+   void testMult     ();
+   void testTransMult();
+   void testGram     ();
+   void testFailures ();
+
+   template< typename MT1, typename MT2 >
+   void compareMatrices( const MT1& src, const MT2& dst );
+
+   template< typename VT1, typename VT2 >
+   void compareVectors( const VT1& src, const VT2& dst );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;      //!< Label of the currently performed test.
+   std::string filename_;  //!< The name of the temporary file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of a source and destination matrix.
+//
+// \param src The source matrix.
+// \param dst The destination matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a comparison between the given source and destination matrix. In
+// case the matrix are not equal, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void ClassTest::compareMatrices( const MT1& src, const MT2& dst )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT2 );
+
+   if( src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   Source matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Destination matrix type:\n"
+          << "     " << typeid( MT2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a source and destination vector.
+//
+// \param src The source vector.
+// \param dst The destination vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a comparison between the given source and destination vector. In
+// case the vectors are not equal, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the source vector
+        , typename VT2 >  // Type of the destination vector
+void ClassTest::compareVectors( const VT1& src, const VT2& dst )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_TYPE( VT2 );
+
+   if( src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector comparison failed\n"
+          << " Details:\n"
+          << "   Source vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Destination vector type:\n"
+          << "     " << typeid( VT2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the ChunkedMatrix class.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the ChunkedMatrix class test.
+*/
+#define RUN_CHUNKEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::chunkedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace chunkedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
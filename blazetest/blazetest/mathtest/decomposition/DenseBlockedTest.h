@@ -0,0 +1,474 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/decomposition/DenseBlockedTest.h
+//  \brief Header file for the native blocked dense matrix decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEBLOCKEDTEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEBLOCKEDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/Geqrf.h>
+#include <blaze/math/dense/Getrf.h>
+#include <blaze/math/dense/Potrf.h>
+#include <blaze/math/dense/Trtri.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all native blocked dense matrix decomposition tests.
+//
+// This class represents a test suite for the native blocked LU, Cholesky and QR decompositions
+// and the according inversion kernels. In contrast to the LAPACK-based decomposition tests, the
+// matrices are chosen large enough to be split into several blocks.
+*/
+class DenseBlockedTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseBlockedTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testLU();
+
+   template< typename Type >
+   void testLLH();
+
+   template< typename Type >
+   void testQR();
+
+   template< typename Type >
+   void testTrtri();
+
+   template< typename Type >
+   void checkResult( const Type& result, const Type& expected, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<float>   cfloat;   //!< Single precision complex test type.
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native blocked LU decomposition and LU-based inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the blockedGetrf() and blockedGetri() functions for a randomly initialized
+// matrix of the given type. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void DenseBlockedTest::testLU()
+{
+   test_ = "Blocked LU decomposition";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   const size_t m( blaze::rand<size_t>( 40UL, 100UL ) );
+   const size_t n( blaze::rand<size_t>( 40UL, 100UL ) );
+   const size_t mindim( blaze::min( m, n ) );
+
+   // Decomposition of a general matrix
+   {
+      Type A( m, n );
+      randomize( A );
+
+      Type LU( A );
+      const std::unique_ptr<int[]> ipiv( new int[mindim] );
+      blaze::blockedGetrf( LU, ipiv.get() );
+
+      const bool rowMajor( blaze::IsRowMajorMatrix<Type>::value );
+
+      Type L( m, mindim, ET(0) );
+      Type U( mindim, n, ET(0) );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<=blaze::min( i, mindim-1UL ); ++j ) {
+            L(i,j) = ( i == j && !rowMajor ) ? ET(1) : LU(i,j);
+         }
+      }
+
+      for( size_t i=0UL; i<mindim; ++i ) {
+         for( size_t j=i; j<n; ++j ) {
+            U(i,j) = ( i == j && rowMajor ) ? ET(1) : LU(i,j);
+         }
+      }
+
+      Type result( L*U );
+
+      for( size_t i=mindim; i-- > 0UL; ) {
+         const size_t p( ipiv[i] - 1 );
+
+         if( rowMajor ) {
+            for( size_t k=0UL; k<m; ++k ) {
+               std::swap( result(k,i), result(k,p) );
+            }
+         }
+         else {
+            for( size_t k=0UL; k<n; ++k ) {
+               std::swap( result(i,k), result(p,k) );
+            }
+         }
+      }
+
+      checkResult( result, A, "LU decomposition failed" );
+   }
+
+   // Inversion of a square matrix
+   {
+      Type A( n, n );
+      randomize( A );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += ET(n);
+      }
+
+      Type B( A );
+      const std::unique_ptr<int[]> ipiv( new int[n] );
+      blaze::blockedGetrf( B, ipiv.get() );
+      blaze::blockedGetri( B, ipiv.get() );
+
+      Type I( n, n, ET(0) );
+      for( size_t i=0UL; i<n; ++i ) {
+         I(i,i) = ET(1);
+      }
+
+      const Type result( B*A );
+      checkResult( result, I, "LU-based inversion failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native blocked Cholesky decomposition and Cholesky-based inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the blockedPotrf() and blockedPotri() functions for a randomly initialized
+// positive definite matrix of the given type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseBlockedTest::testLLH()
+{
+   using blaze::conj;
+
+   test_ = "Blocked LLH decomposition";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   const size_t n( blaze::rand<size_t>( 40UL, 100UL ) );
+
+   Type A( n, n );
+   makePositiveDefinite( A );
+
+   Type I( n, n, ET(0) );
+   for( size_t i=0UL; i<n; ++i ) {
+      I(i,i) = ET(1);
+   }
+
+   for( char uplo : { 'L', 'U' } )
+   {
+      Type B( A );
+      blaze::blockedPotrf( B, uplo );
+
+      Type F( n, n, ET(0) );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( uplo == 'L' ? i >= j : i <= j ) {
+               F(i,j) = B(i,j);
+            }
+         }
+      }
+
+      const Type result( uplo == 'L' ? Type( F * ctrans( F ) ) : Type( ctrans( F ) * F ) );
+      checkResult( result, A, "LLH decomposition failed" );
+
+      blaze::blockedPotri( B, uplo );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            F(i,j) = ( uplo == 'L' ? i >= j : i <= j ) ? B(i,j) : conj( B(j,i) );
+         }
+      }
+
+      const Type inverse( F * A );
+      checkResult( inverse, I, "LLH-based inversion failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native blocked QR decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the blockedGeqrf() and blockedOrgqr() functions for a randomly initialized
+// matrix of the given type. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void DenseBlockedTest::testQR()
+{
+   test_ = "Blocked QR decomposition";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   const size_t m( blaze::rand<size_t>( 40UL, 100UL ) );
+   const size_t n( blaze::rand<size_t>( 40UL, 100UL ) );
+   const size_t mindim( blaze::min( m, n ) );
+
+   Type A( m, n );
+   randomize( A );
+
+   Type B( A );
+   const std::unique_ptr<ET[]> tau( new ET[mindim] );
+   blaze::blockedGeqrf( B, tau.get() );
+
+   Type R( mindim, n, ET(0) );
+   for( size_t i=0UL; i<mindim; ++i ) {
+      for( size_t j=i; j<n; ++j ) {
+         R(i,j) = B(i,j);
+      }
+   }
+
+   Type Q( submatrix( B, 0UL, 0UL, m, mindim ) );
+   blaze::blockedOrgqr( Q, tau.get() );
+
+   const Type result( Q*R );
+   checkResult( result, A, "QR decomposition failed" );
+
+   Type I( mindim, mindim, ET(0) );
+   for( size_t i=0UL; i<mindim; ++i ) {
+      I(i,i) = ET(1);
+   }
+
+   const Type orthogonality( ctrans( Q ) * Q );
+   checkResult( orthogonality, I, "Reconstruction of Q failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native blocked triangular inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the blockedTrtri() function for randomly initialized lower and upper
+// (uni-)triangular matrices of the given type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseBlockedTest::testTrtri()
+{
+   test_ = "Blocked triangular inversion";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   const size_t n( blaze::rand<size_t>( 40UL, 100UL ) );
+
+   Type I( n, n, ET(0) );
+   for( size_t i=0UL; i<n; ++i ) {
+      I(i,i) = ET(1);
+   }
+
+   for( char uplo : { 'L', 'U' } ) {
+      for( char diag : { 'N', 'U' } )
+      {
+         Type T( n, n, ET(0) );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               if( uplo == 'L' ? i > j : i < j ) {
+                  T(i,j) = blaze::rand<ET>() / ET(n);
+               }
+            }
+            T(i,i) = ( diag == 'U' ? ET(1) : blaze::rand<ET>() + ET(2) );
+         }
+
+         Type B( T );
+         blaze::blockedTrtri( B, uplo, diag );
+
+         if( diag == 'U' ) {
+            for( size_t i=0UL; i<n; ++i ) {
+               B(i,i) = ET(1);
+            }
+         }
+
+         const Type result( B*T );
+         checkResult( result, I, "Triangular inversion failed" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a decomposition test.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void DenseBlockedTest::checkResult( const Type& result, const Type& expected,
+                                    const std::string& error ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_<Type> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native blocked dense matrix decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseBlockedTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native blocked dense matrix decomposition test.
+*/
+#define RUN_DENSE_BLOCKED_TEST \
+   blazetest::mathtest::decomposition::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
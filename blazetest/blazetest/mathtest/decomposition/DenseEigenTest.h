@@ -0,0 +1,657 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/decomposition/DenseEigenTest.h
+//  \brief Header file for the dense eigenvalue and singular value decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEEIGENTEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITION_DENSEEIGENTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all dense eigenvalue and singular value decomposition tests.
+//
+// This class represents a test suite for the eigen() and svd() functions. All decompositions
+// are verified by means of the reconstruction of the original matrix, the orthonormality of the
+// computed vectors and the ordering of the computed eigenvalues and singular values.
+*/
+class DenseEigenTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseEigenTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testEigen();
+
+   template< typename Type >
+   void testSVD();
+
+   void testStatic();
+   void testRankDeficient();
+   void testInvalid();
+
+   template< typename MT1, typename VT, typename MT2 >
+   void checkEigen( const MT1& A, const VT& w, const MT2& V ) const;
+
+   template< typename MT1, typename MT2, typename VT, typename MT3 >
+   void checkSVD( const MT1& A, const MT2& U, const VT& s, const MT3& V ) const;
+
+   template< typename MT >
+   void checkUnitary( const MT& Q, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the eigendecomposition of dynamic Hermitian matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the eigen() functions for randomly initialized Hermitian (or symmetric)
+// matrices of the given type. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void DenseEigenTest::testEigen()
+{
+   test_ = "Eigendecomposition of Hermitian matrices";
+
+   typedef blaze::ElementType_<Type>                 ET;
+   typedef blaze::UnderlyingBuiltin_<ET>             BT;
+   typedef blaze::DynamicVector<BT,blaze::columnVector>  VT;
+
+   for( size_t n : { 1UL, 3UL, 8UL, 67UL } )
+   {
+      blaze::HermitianMatrix<Type> H( n );
+      randomize( H );
+
+      // Decomposition of the general matrix
+      {
+         const Type A( H );
+
+         VT w1, w2;
+         Type V;
+
+         eigen( A, w1, V );
+         checkEigen( A, w1, V );
+
+         eigen( A, w2 );
+
+         if( w1 != w2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Eigenvalue computation failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Eigenvalues (with eigenvectors):\n" << w1 << "\n"
+                << "   Eigenvalues (without eigenvectors):\n" << w2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Decomposition of the Hermitian matrix adaptor
+      {
+         VT w;
+         Type V;
+
+         eigen( H, w, V );
+         checkEigen( Type( H ), w, V );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the singular value decomposition of dynamic general matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the svd() functions for randomly initialized general matrices of the
+// given type with more rows than columns, more columns than rows and square matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseEigenTest::testSVD()
+{
+   test_ = "Singular value decomposition of general matrices";
+
+   typedef blaze::ElementType_<Type>                 ET;
+   typedef blaze::UnderlyingBuiltin_<ET>             BT;
+   typedef blaze::DynamicVector<BT,blaze::columnVector>  VT;
+
+   const size_t sizes[][2] = { { 1UL, 1UL }, { 3UL, 5UL }, { 8UL, 3UL }, { 8UL, 8UL },
+                               { 67UL, 40UL }, { 40UL, 67UL } };
+
+   for( const auto& size : sizes )
+   {
+      Type A( size[0], size[1] );
+      randomize( A );
+
+      VT s1, s2;
+      Type U, V;
+
+      svd( A, U, s1, V );
+      checkSVD( A, U, s1, V );
+
+      svd( A, s2 );
+
+      if( s1 != s2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value computation failed\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Singular values (with singular vectors):\n" << s1 << "\n"
+             << "   Singular values (without singular vectors):\n" << s2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the eigendecomposition and SVD of fixed-size matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the eigen() and svd() functions for fixed-size matrices, which are handled
+// by the native Jacobi kernels. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void DenseEigenTest::testStatic()
+{
+   test_ = "Eigendecomposition and SVD of fixed-size matrices";
+
+   // 3x3 real symmetric matrix
+   {
+      blaze::SymmetricMatrix< blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> > S;
+      randomize( S );
+
+      blaze::StaticVector<double,3UL,blaze::columnVector> w;
+      blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> V;
+
+      eigen( S, w, V );
+      checkEigen( blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor>( S ), w, V );
+   }
+
+   // 6x6 complex Hermitian matrix
+   {
+      blaze::HermitianMatrix< blaze::StaticMatrix<cdouble,6UL,6UL,blaze::columnMajor> > H;
+      randomize( H );
+
+      const blaze::StaticMatrix<cdouble,6UL,6UL,blaze::columnMajor> A( H );
+
+      blaze::StaticVector<double,6UL,blaze::columnVector> w;
+      blaze::StaticMatrix<cdouble,6UL,6UL,blaze::columnMajor> V;
+
+      eigen( A, w, V );
+      checkEigen( A, w, V );
+   }
+
+   // 3x3 real general matrix
+   {
+      blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> A, U, V;
+      randomize( A );
+
+      blaze::StaticVector<double,3UL,blaze::columnVector> s;
+
+      svd( A, U, s, V );
+      checkSVD( A, U, s, V );
+   }
+
+   // 4x6 complex general matrix
+   {
+      blaze::StaticMatrix<cdouble,4UL,6UL,blaze::columnMajor> A;
+      randomize( A );
+
+      blaze::StaticMatrix<cdouble,4UL,4UL,blaze::columnMajor> U;
+      blaze::StaticVector<double,4UL,blaze::columnVector> s;
+      blaze::StaticMatrix<cdouble,4UL,6UL,blaze::columnMajor> V;
+
+      svd( A, U, s, V );
+      checkSVD( A, U, s, V );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the singular value decomposition of rank deficient matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the svd() functions for rank deficient fixed-size and dynamic matrices.
+// Even for zero singular values the left singular vectors are expected to be orthonormal. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseEigenTest::testRankDeficient()
+{
+   test_ = "Singular value decomposition of rank deficient matrices";
+
+   // Fixed-size matrix of rank 2
+   {
+      blaze::StaticMatrix<double,5UL,3UL,blaze::rowMajor> A;
+      randomize( A );
+      column( A, 2UL ) = column( A, 0UL ) + column( A, 1UL );
+
+      blaze::StaticMatrix<double,5UL,3UL,blaze::rowMajor> U;
+      blaze::StaticVector<double,3UL,blaze::columnVector> s;
+      blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> V;
+
+      svd( A, U, s, V );
+      checkSVD( A, U, s, V );
+   }
+
+   // Dynamic matrix of rank 9
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> A( 30UL, 10UL );
+      randomize( A );
+      column( A, 9UL ) = column( A, 0UL );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> U, V;
+      blaze::DynamicVector<double,blaze::columnVector> s;
+
+      svd( A, U, s, V );
+      checkSVD( A, U, s, V );
+   }
+
+   // Zero matrix
+   {
+      const blaze::StaticMatrix<cdouble,3UL,3UL,blaze::rowMajor> A( cdouble( 0.0 ) );
+
+      blaze::StaticMatrix<cdouble,3UL,3UL,blaze::rowMajor> U, V;
+      blaze::StaticVector<double,3UL,blaze::columnVector> s;
+
+      svd( A, U, s, V );
+      checkSVD( A, U, s, V );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the eigen() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the eigen() functions detect non-square and non-Hermitian matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseEigenTest::testInvalid()
+{
+   test_ = "Eigendecomposition of invalid matrices";
+
+   // Non-square matrix
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> w;
+
+      bool failed( false );
+      try {
+         eigen( A, w );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigendecomposition of non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Non-symmetric fixed-size matrix
+   {
+      blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> A( 1.0 );
+      A(0,2) = 2.0;
+
+      blaze::StaticVector<double,3UL,blaze::columnVector> w;
+
+      bool failed( false );
+      try {
+         eigen( A, w );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigendecomposition of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Non-Hermitian dynamic matrix
+   {
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> A( 8UL, 8UL, cdouble( 1.0 ) );
+      A(3,3) = cdouble( 1.0, 1.0 );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> V;
+
+      bool failed( false );
+      try {
+         eigen( A, w, V );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigendecomposition of non-Hermitian matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the eigendecomposition of a Hermitian matrix.
+//
+// \param A The decomposed Hermitian matrix.
+// \param w The computed eigenvalues.
+// \param V The computed eigenvectors.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the Hermitian matrix
+        , typename VT     // Type of the eigenvalue vector
+        , typename MT2 >  // Type of the eigenvector matrix
+void DenseEigenTest::checkEigen( const MT1& A, const VT& w, const MT2& V ) const
+{
+   typedef blaze::ElementType_<MT1>  ET;
+
+   const size_t n( A.rows() );
+
+   blaze::DynamicMatrix<ET,blaze::rowMajor> D( n, n, ET(0) );
+   for( size_t i=0UL; i<n; ++i ) {
+      D(i,i) = w[i];
+   }
+
+   for( size_t i=1UL; i<n; ++i ) {
+      if( w[i] < w[i-1UL] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalues are not sorted in ascending order\n"
+             << " Details:\n"
+             << "   Eigenvalues:\n" << w << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkUnitary( V, "Eigenvectors are not orthonormal" );
+
+   const blaze::DynamicMatrix<ET,blaze::rowMajor> R( V * D * ctrans( V ) );
+
+   if( R != A ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reconstruction from the eigendecomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Matrix:\n" << A << "\n"
+          << "   Eigenvalues:\n" << w << "\n"
+          << "   Eigenvectors:\n" << V << "\n"
+          << "   Reconstruction:\n" << R << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the singular value decomposition of a general matrix.
+//
+// \param A The decomposed general matrix.
+// \param U The computed left singular vectors.
+// \param s The computed singular values.
+// \param V The computed (conjugate transposed) right singular vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the general matrix
+        , typename MT2    // Type of the left singular vector matrix
+        , typename VT     // Type of the singular value vector
+        , typename MT3 >  // Type of the right singular vector matrix
+void DenseEigenTest::checkSVD( const MT1& A, const MT2& U, const VT& s, const MT3& V ) const
+{
+   typedef blaze::ElementType_<MT1>  ET;
+
+   const size_t k( s.size() );
+
+   blaze::DynamicMatrix<ET,blaze::rowMajor> S( k, k, ET(0) );
+   for( size_t i=0UL; i<k; ++i ) {
+      S(i,i) = s[i];
+   }
+
+   for( size_t i=0UL; i<k; ++i ) {
+      if( s[i] < 0.0 || ( i > 0UL && s[i] > s[i-1UL] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular values are not non-negative and sorted in descending order\n"
+             << " Details:\n"
+             << "   Singular values:\n" << s << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkUnitary( U, "Left singular vectors are not orthonormal" );
+   checkUnitary( ctrans( V ), "Right singular vectors are not orthonormal" );
+
+   const blaze::DynamicMatrix<ET,blaze::rowMajor> R( U * S * V );
+
+   if( R != A ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reconstruction from the singular value decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Matrix:\n" << A << "\n"
+          << "   Singular values:\n" << s << "\n"
+          << "   Left singular vectors:\n" << U << "\n"
+          << "   Right singular vectors:\n" << V << "\n"
+          << "   Reconstruction:\n" << R << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the columns of the given matrix are orthonormal.
+//
+// \param Q The matrix to be checked.
+// \param error The error message in case the check fails.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void DenseEigenTest::checkUnitary( const MT& Q, const std::string& error ) const
+{
+   typedef blaze::ElementType_<MT>  ET;
+
+   const blaze::DynamicMatrix<ET,blaze::rowMajor> P( ctrans( Q ) * Q );
+
+   for( size_t i=0UL; i<P.rows(); ++i ) {
+      for( size_t j=0UL; j<P.columns(); ++j ) {
+         if( !blaze::equal( P(i,j), ( i == j ) ? ET(1) : ET(0) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << error << "\n"
+                << " Details:\n"
+                << "   Matrix:\n" << Q << "\n"
+                << "   Product with its conjugate transpose:\n" << P << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the eigenvalue and singular value decompositions of dense matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseEigenTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense eigenvalue and singular value decomposition test.
+*/
+#define RUN_DENSE_EIGEN_TEST \
+   blazetest::mathtest::decomposition::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -49,6 +49,7 @@
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/util/Complex.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Random.h>
 #include <blazetest/system/LAPACK.h>
 
@@ -139,7 +140,7 @@ class DenseLUTest
 template< typename Type >
 void DenseLUTest::testRandom()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    test_ = "LU decomposition";
 
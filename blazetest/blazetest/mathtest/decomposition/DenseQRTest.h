@@ -48,6 +48,7 @@
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/util/Complex.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Random.h>
 #include <blazetest/system/LAPACK.h>
 
@@ -138,7 +139,7 @@ class DenseQRTest
 template< typename Type >
 void DenseQRTest::testRandom()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    test_ = "QR decomposition";
 
@@ -0,0 +1,670 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/decomposition/DenseSolveTest.h
+//  \brief Header file for the dense linear system solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DECOMPOSITION_DENSESOLVETEST_H_
+#define _BLAZETEST_MATHTEST_DECOMPOSITION_DENSESOLVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/InversionFlag.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/UniUpperMatrix.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all dense linear system solver tests.
+//
+// This class represents a test suite for the solve() functions and the Factorization class
+// template. For every kind of system matrix the computed solutions are verified by means of the
+// residual of the linear system.
+*/
+class DenseSolveTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseSolveTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testGeneral();
+
+   template< typename Type >
+   void testTriangular();
+
+   template< typename Type >
+   void testSymmetric();
+
+   template< typename Type >
+   void testHermitian();
+
+   void testStatic();
+   void testSingular();
+
+   template< typename MT, typename VT >
+   void checkSystem( const MT& A, const VT& x, const VT& b, const std::string& error ) const;
+
+   template< typename MT >
+   void checkAlgorithm( const MT& A, blaze::InversionFlag expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   void verify( const MT1& A, const MT2& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<float>   cfloat;   //!< Single precision complex test type.
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the solution of linear systems with a general system matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the solve() functions and the Factorization class template for a randomly
+// initialized, general system matrix of the given type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseSolveTest::testGeneral()
+{
+   test_ = "Solution of general linear systems";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   for( size_t n : { 1UL, 3UL, 8UL, 67UL } )
+   {
+      Type A( n, n );
+      randomize( A );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += ET(n);
+      }
+
+      verify( A, A );
+      checkAlgorithm( A, blaze::byLU );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of linear systems with a triangular or diagonal system matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the solve() functions and the Factorization class template for randomly
+// initialized lower, uniupper and diagonal system matrices based on the given matrix type. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseSolveTest::testTriangular()
+{
+   test_ = "Solution of triangular linear systems";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   for( size_t n : { 1UL, 3UL, 8UL, 67UL } )
+   {
+      // Lower system matrix
+      {
+         blaze::LowerMatrix<Type> L( n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<i; ++j ) {
+               L(i,j) = blaze::rand<ET>() / ET(n);
+            }
+            L(i,i) = blaze::rand<ET>() + ET(2);
+         }
+
+         verify( L, Type( L ) );
+         checkAlgorithm( L, blaze::asLower );
+      }
+
+      // Uniupper system matrix
+      {
+         blaze::UniUpperMatrix<Type> U( n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=i+1UL; j<n; ++j ) {
+               U(i,j) = blaze::rand<ET>() / ET(n);
+            }
+         }
+
+         verify( U, Type( U ) );
+         checkAlgorithm( U, blaze::asUniUpper );
+      }
+
+      // Diagonal system matrix
+      {
+         blaze::DiagonalMatrix<Type> D( n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            D(i,i) = blaze::rand<ET>() + ET(1);
+         }
+
+         verify( D, Type( D ) );
+         checkAlgorithm( D, blaze::asDiagonal );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of linear systems with a symmetric system matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the solve() functions and the Factorization class template for randomly
+// initialized symmetric positive definite and symmetric indefinite system matrices based on the
+// given matrix type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseSolveTest::testSymmetric()
+{
+   test_ = "Solution of symmetric linear systems";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   // Complex symmetric matrices are never decomposed by means of a Cholesky decomposition
+   const bool real( blaze::IsBuiltin<ET>::value );
+#if BLAZE_LAPACK_MODE
+   const blaze::InversionFlag indefinite( blaze::byLDLT );
+#else
+   const blaze::InversionFlag indefinite( blaze::byLU );
+#endif
+
+   for( size_t n : { 1UL, 3UL, 8UL, 67UL } )
+   {
+      // Positive definite system matrix
+      {
+         blaze::SymmetricMatrix<Type> S( n );
+         makePositiveDefinite( S );
+
+         verify( S, Type( S ) );
+         checkAlgorithm( S, real ? blaze::byLLH : indefinite );
+      }
+
+      // Indefinite system matrix
+      {
+         blaze::SymmetricMatrix<Type> S( n );
+         randomize( S );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            S(i,i) = ( i % 2UL == 0UL ) ? ET(n) : -ET(n);
+         }
+
+         verify( S, Type( S ) );
+         checkAlgorithm( S, ( real && n == 1UL ) ? blaze::byLLH : indefinite );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of linear systems with a Hermitian system matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the solve() functions and the Factorization class template for randomly
+// initialized Hermitian positive definite and Hermitian indefinite system matrices based on the
+// given matrix type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseSolveTest::testHermitian()
+{
+   test_ = "Solution of Hermitian linear systems";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+#if BLAZE_LAPACK_MODE
+   const blaze::InversionFlag indefinite( blaze::byLDLH );
+#else
+   const blaze::InversionFlag indefinite( blaze::byLU );
+#endif
+
+   for( size_t n : { 1UL, 3UL, 8UL, 67UL } )
+   {
+      // Positive definite system matrix
+      {
+         blaze::HermitianMatrix<Type> H( n );
+         makePositiveDefinite( H );
+
+         verify( H, Type( H ) );
+         checkAlgorithm( H, blaze::byLLH );
+      }
+
+      // Indefinite system matrix
+      {
+         blaze::HermitianMatrix<Type> H( n );
+         randomize( H );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            H(i,i) = ( i % 2UL == 0UL ) ? ET(n) : -ET(n);
+         }
+
+         verify( H, Type( H ) );
+         checkAlgorithm( H, ( n == 1UL ) ? blaze::byLLH : indefinite );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of linear systems with a fixed-size system matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the solve() functions and the Factorization class template for fixed-size
+// system matrices and right-hand side vectors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void DenseSolveTest::testStatic()
+{
+   test_ = "Solution of fixed-size linear systems";
+
+   blaze::StaticMatrix<double,4UL,4UL,blaze::rowMajor> A;
+   randomize( A );
+
+   for( size_t i=0UL; i<4UL; ++i ) {
+      A(i,i) += 4.0;
+   }
+
+   blaze::StaticVector<double,4UL,blaze::columnVector> b, x;
+   randomize( b );
+
+   x = solve( A, b );
+   checkSystem( A, x, b, "Solve expression failed" );
+
+   const blaze::Factorization< blaze::StaticMatrix<double,4UL,4UL,blaze::rowMajor> > F( A );
+   solve( F, x, b );
+   checkSystem( A, x, b, "Solution via factorization failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the solve() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the solve() functions detect non-square and singular system matrices
+// as well as right-hand sides of invalid size. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void DenseSolveTest::testSingular()
+{
+   test_ = "Solution of invalid linear systems";
+
+   // Singular system matrix
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> A( 5UL, 5UL );
+      randomize( A );
+      column( A, 2UL ) = 0.0;
+
+      blaze::DynamicVector<double,blaze::columnVector> b( 5UL ), x;
+      randomize( b );
+
+      bool failed( false );
+      try {
+         x = solve( A, b );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution of singular linear system succeeded\n"
+             << " Details:\n"
+             << "   System matrix:\n" << A << "\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Non-square system matrix
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> b( 4UL, 1.0 );
+
+      bool failed( false );
+      try {
+         solve( A, b );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution of non-square linear system succeeded\n"
+             << " Details:\n"
+             << "   System matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Right-hand side of invalid size
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> b( 4UL, 1.0 );
+
+      bool failed( false );
+      try {
+         solve( A, b );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution of linear system with invalid right-hand side succeeded\n"
+             << " Details:\n"
+             << "   Right-hand side:\n" << b << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Verification of the solution of the linear systems with the given system matrix.
+//
+// \param A The system matrix.
+// \param B The system matrix as general matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves linear systems with the given system matrix for a single right-hand
+// side and for several right-hand sides via the solve() expressions, the solve() functions
+// and a reused factorization and checks all solutions by means of the general matrix \a B.
+*/
+template< typename MT1    // Type of the system matrix
+        , typename MT2 >  // Type of the general matrix
+void DenseSolveTest::verify( const MT1& A, const MT2& B )
+{
+   typedef blaze::ElementType_<MT2>  ET;
+   typedef blaze::DynamicVector<ET,blaze::columnVector>  VT;
+
+   const size_t n( A.rows() );
+
+   // Single right-hand side
+   {
+      VT b( n );
+      randomize( b );
+
+      const VT x1( solve( A, b ) );
+      checkSystem( B, x1, b, "Solve expression failed" );
+
+      VT x2;
+      solve( A, x2, b );
+      checkSystem( B, x2, b, "Solve function failed" );
+
+      VT x3( b );
+      x3 = solve( A, x3 );
+      checkSystem( B, x3, b, "Aliased solve expression failed" );
+
+      VT x4( n, ET(0) );
+      x4 += solve( A, b );
+      checkSystem( B, x4, b, "Solve expression addition assignment failed" );
+
+      VT x5( n, ET(0) );
+      x5 -= solve( A, b );
+      checkSystem( B, VT( -x5 ), b, "Solve expression subtraction assignment failed" );
+   }
+
+   // Several right-hand sides
+   {
+      blaze::DynamicMatrix<ET,blaze::rowMajor> R( n, 5UL );
+      blaze::DynamicMatrix<ET,blaze::columnMajor> C( n, 5UL );
+      randomize( R );
+      C = R;
+
+      const blaze::DynamicMatrix<ET,blaze::rowMajor> X1( solve( A, R ) );
+      const blaze::DynamicMatrix<ET,blaze::columnMajor> X2( solve( A, C ) );
+
+      for( size_t j=0UL; j<R.columns(); ++j ) {
+         checkSystem( B, VT( column( X1, j ) ), VT( column( R, j ) ), "Row-major solve expression failed" );
+         checkSystem( B, VT( column( X2, j ) ), VT( column( C, j ) ), "Column-major solve expression failed" );
+      }
+   }
+
+   // Reuse of a single factorization
+   {
+      const blaze::Factorization<MT1> F( blaze::factorize( A ) );
+
+      for( size_t i=0UL; i<3UL; ++i )
+      {
+         VT b( n ), x;
+         randomize( b );
+
+         solve( F, x, b );
+         checkSystem( B, x, b, "Solution via factorization failed" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a linear system.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param error The error message in case of a mismatch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT    // Type of the system matrix
+        , typename VT >  // Type of the vectors
+void DenseSolveTest::checkSystem( const MT& A, const VT& x, const VT& b,
+                                  const std::string& error ) const
+{
+   const VT residual( A * x );
+
+   if( residual != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   System matrix:\n" << A << "\n"
+          << "   Right-hand side:\n" << b << "\n"
+          << "   Computed solution:\n" << x << "\n"
+          << "   Residual:\n" << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the algorithm selected for the factorization of the given system matrix.
+//
+// \param A The system matrix.
+// \param expected The expected factorization algorithm.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the system matrix
+void DenseSolveTest::checkAlgorithm( const MT& A, blaze::InversionFlag expected ) const
+{
+   const blaze::Factorization<MT> F( A );
+
+   if( F.algorithm() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unexpected factorization algorithm\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Selected algorithm:\n"
+          << "     " << F.algorithm() << "\n"
+          << "   Expected algorithm:\n"
+          << "     " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the solution of dense linear systems.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseSolveTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense linear system solver test.
+*/
+#define RUN_DENSE_SOLVE_TEST \
+   blazetest::mathtest::decomposition::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -103,6 +103,10 @@ class GeneralTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testReduce();
+   void testArgmin();
+   void testArgmax();
+   void testFrobeniusNorm();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
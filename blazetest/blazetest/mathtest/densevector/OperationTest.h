@@ -88,6 +88,10 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testReduce();
+   void testArgmin();
+   void testArgmax();
+   void testNorms();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -0,0 +1,600 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dispatch/KernelTest.h
+//  \brief Header file for the runtime dispatch kernel test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DISPATCH_KERNELTEST_H_
+#define _BLAZETEST_MATHTEST_DISPATCH_KERNELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/dense/Dispatch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/simd/InstructionSet.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime dispatched dense kernels.
+//
+// This class represents a test suite for the runtime dispatch mode of the Blaze library (see
+// the \c BLAZE_USE_RUNTIME_DISPATCH configuration switch). It forces the kernels of each
+// instruction set supported by the executing CPU and compares their results to the results of
+// scalar reference computations. Additionally, it performs the dense vector assignments, the
+// dense matrix/dense vector multiplications, and the small dense matrix/dense matrix
+// multiplication via the instruction set selected at runtime, which can be restricted via the
+// \c BLAZE_INSTRUCTION_SET environment variable. All operands are initialized with small
+// integral values such that all results are exact in both single and double precision.
+*/
+class KernelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KernelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T >
+   void testKernels( blaze::SIMDInstructionSet set );
+
+   template< typename T >
+   void testOperations();
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   static void initialize( blaze::DynamicVector<T>& v, size_t seed );
+
+   template< typename T, bool SO >
+   static void initialize( blaze::DynamicMatrix<T,SO>& A, size_t seed );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//*************************************************************************************************
+/*!\brief Test of the runtime dispatched kernels of the given instruction set.
+//
+// \param set The instruction set of the kernels.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function forces the kernels of the given instruction set and tests the scaled vector
+// addition, the row-major and column-major dense matrix/dense vector multiplication and the
+// dense matrix/dense matrix multiplication kernel for several scaling factors. The sizes of
+// the operands are chosen such that all remainder loops of the kernels are executed. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type
+void KernelTest::testKernels( blaze::SIMDInstructionSet set )
+{
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const blaze::DispatchKernels<T> kernels( blaze::createDispatchKernels<T>( set ) );
+
+   const std::string name( std::string( blaze::getInstructionSetName( set ) ) +
+                           ( sizeof(T) == sizeof(float) ? " (float)" : " (double)" ) );
+
+   const size_t m( 67UL );
+   const size_t n( 43UL );
+   const size_t k( 29UL );
+
+   const T factors[3][2] = { { T(1), T(0) }, { T(1), T(1) }, { T(-2), T(3) } };
+
+   for( size_t f=0UL; f<3UL; ++f )
+   {
+      const T alpha( factors[f][0] );
+      const T beta ( factors[f][1] );
+
+
+      //=====================================================================================
+      // Scaled vector addition
+      //=====================================================================================
+
+      {
+         test_ = name + " scaled vector addition";
+
+         DynamicVector<T> x( m ), y( m );
+         initialize( x, 1UL );
+         initialize( y, 2UL );
+
+         DynamicVector<T> ref( m );
+         for( size_t i=0UL; i<m; ++i ) {
+            ref[i] = alpha * x[i] + beta * y[i];
+         }
+
+         kernels.axpby( m, alpha, x.data(), beta, y.data() );
+
+         checkResult( y, ref );
+      }
+
+
+      //=====================================================================================
+      // Row-major dense matrix/dense vector multiplication
+      //=====================================================================================
+
+      {
+         test_ = name + " row-major dense matrix/dense vector multiplication";
+
+         DynamicMatrix<T,rowMajor> A( m, n );
+         DynamicVector<T> x( n ), y( m );
+         initialize( A, 3UL );
+         initialize( x, 4UL );
+         initialize( y, 5UL );
+
+         DynamicVector<T> ref( m );
+         for( size_t i=0UL; i<m; ++i ) {
+            T tmp( 0 );
+            for( size_t j=0UL; j<n; ++j ) {
+               tmp += A(i,j) * x[j];
+            }
+            ref[i] = alpha * tmp + beta * y[i];
+         }
+
+         kernels.gemv( m, n, alpha, A.data(), A.spacing(), x.data(), beta, y.data() );
+
+         checkResult( y, ref );
+      }
+
+
+      //=====================================================================================
+      // Column-major dense matrix/dense vector multiplication
+      //=====================================================================================
+
+      {
+         test_ = name + " column-major dense matrix/dense vector multiplication";
+
+         DynamicMatrix<T,columnMajor> A( m, n );
+         DynamicVector<T> x( n ), y( m );
+         initialize( A, 6UL );
+         initialize( x, 7UL );
+         initialize( y, 8UL );
+
+         DynamicVector<T> ref( m );
+         for( size_t i=0UL; i<m; ++i ) {
+            T tmp( 0 );
+            for( size_t j=0UL; j<n; ++j ) {
+               tmp += A(i,j) * x[j];
+            }
+            ref[i] = alpha * tmp + beta * y[i];
+         }
+
+         kernels.tgemv( m, n, alpha, A.data(), A.spacing(), x.data(), beta, y.data() );
+
+         checkResult( y, ref );
+      }
+
+
+      //=====================================================================================
+      // Dense matrix/dense matrix multiplication
+      //=====================================================================================
+
+      {
+         test_ = name + " dense matrix/dense matrix multiplication";
+
+         DynamicMatrix<T,rowMajor> A( m, k ), B( k, n ), C( m, n );
+         initialize( A, 9UL );
+         initialize( B, 10UL );
+         initialize( C, 11UL );
+
+         DynamicMatrix<T,rowMajor> ref( m, n );
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               T tmp( 0 );
+               for( size_t l=0UL; l<k; ++l ) {
+                  tmp += A(i,l) * B(l,j);
+               }
+               ref(i,j) = alpha * tmp + beta * C(i,j);
+            }
+         }
+
+         kernels.gemm( m, n, k, alpha, A.data(), A.spacing(), B.data(), B.spacing(),
+                       beta, C.data(), C.spacing() );
+
+         checkResult( C, ref );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the operations based on the runtime dispatched kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs the dense vector assignments, the row-major and column-major dense
+// matrix/dense vector multiplications, and the small row-major dense matrix/dense matrix
+// multiplication via the kernels of the instruction set selected at runtime. The sizes of the
+// operands are chosen based on the according thresholds such that the runtime dispatched
+// kernels are used. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type
+void KernelTest::testOperations()
+{
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const blaze::SIMDInstructionSet set( blaze::getInstructionSet() );
+
+   const std::string name( std::string( blaze::getInstructionSetName( set ) ) +
+                           ( sizeof(T) == sizeof(float) ? " (float)" : " (double)" ) );
+
+
+   //=====================================================================================
+   // Dense vector assignments
+   //=====================================================================================
+
+   {
+      const size_t n( 131UL );
+
+      DynamicVector<T> x( n ), y( n );
+      initialize( x, 1UL );
+      initialize( y, 2UL );
+
+      DynamicVector<T> ref( y );
+
+      test_ = name + " dense vector assignment";
+
+      y = x;
+      for( size_t i=0UL; i<n; ++i ) {
+         ref[i] = x[i];
+      }
+
+      checkResult( y, ref );
+
+      test_ = name + " dense vector addition assignment";
+
+      y += x;
+      for( size_t i=0UL; i<n; ++i ) {
+         ref[i] += x[i];
+      }
+
+      checkResult( y, ref );
+
+      test_ = name + " dense vector subtraction assignment";
+
+      y -= x;
+      y -= x;
+      for( size_t i=0UL; i<n; ++i ) {
+         ref[i] -= T(2) * x[i];
+      }
+
+      checkResult( y, ref );
+   }
+
+
+   //=====================================================================================
+   // Row-major dense matrix/dense vector multiplication
+   //=====================================================================================
+
+   {
+      const size_t n( 67UL );
+      const size_t m( blaze::DMATDVECMULT_THRESHOLD / n + 3UL );
+
+      DynamicMatrix<T,rowMajor> A( m, n );
+      DynamicVector<T> x( n ), y( m );
+      initialize( A, 3UL );
+      initialize( x, 4UL );
+      initialize( y, 5UL );
+
+      DynamicVector<T> ref( m );
+      for( size_t i=0UL; i<m; ++i ) {
+         T tmp( 0 );
+         for( size_t j=0UL; j<n; ++j ) {
+            tmp += A(i,j) * x[j];
+         }
+         ref[i] = tmp;
+      }
+
+      test_ = name + " row-major dense matrix/dense vector multiplication";
+
+      y = A * x;
+
+      checkResult( y, ref );
+
+      test_ = name + " row-major dense matrix/dense vector multiplication (+=)";
+
+      y += A * x;
+
+      checkResult( y, ref + ref );
+
+      test_ = name + " row-major dense matrix/dense vector multiplication (-=)";
+
+      y -= A * x;
+
+      checkResult( y, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major dense matrix/dense vector multiplication
+   //=====================================================================================
+
+   {
+      const size_t n( 67UL );
+      const size_t m( blaze::TDMATDVECMULT_THRESHOLD / n + 3UL );
+
+      DynamicMatrix<T,columnMajor> A( m, n );
+      DynamicVector<T> x( n ), y( m );
+      initialize( A, 6UL );
+      initialize( x, 7UL );
+      initialize( y, 8UL );
+
+      DynamicVector<T> ref( m );
+      for( size_t i=0UL; i<m; ++i ) {
+         T tmp( 0 );
+         for( size_t j=0UL; j<n; ++j ) {
+            tmp += A(i,j) * x[j];
+         }
+         ref[i] = tmp;
+      }
+
+      test_ = name + " column-major dense matrix/dense vector multiplication";
+
+      y = A * x;
+
+      checkResult( y, ref );
+
+      test_ = name + " column-major dense matrix/dense vector multiplication (+=)";
+
+      y += A * x;
+
+      checkResult( y, ref + ref );
+
+      test_ = name + " column-major dense matrix/dense vector multiplication (-=)";
+
+      y -= A * x;
+
+      checkResult( y, ref );
+   }
+
+
+   //=====================================================================================
+   // Small dense matrix/dense matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = name + " small dense matrix/dense matrix multiplication";
+
+      const size_t m( 37UL );
+      const size_t n( 23UL );
+      const size_t k( 29UL );
+
+      DynamicMatrix<T,rowMajor> A( m, k ), B( k, n ), C( m, n );
+      initialize( A, 9UL );
+      initialize( B, 10UL );
+
+      DynamicMatrix<T,rowMajor> ref( m, n );
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            T tmp( 0 );
+            for( size_t l=0UL; l<k; ++l ) {
+               tmp += A(i,l) * B(l,j);
+            }
+            ref(i,j) = tmp;
+         }
+      }
+
+      C = A * B;
+
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+#endif
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed result differs from the expected result, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type1    // Type of the computed result
+        , typename Type2 >  // Type of the expected result
+void KernelTest::checkResult( const Type1& result, const Type2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Selected instruction set: "
+          << blaze::getInstructionSetName( blaze::getInstructionSet() ) << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense vector with small integral values.
+//
+// \param v The dense vector to be initialized.
+// \param seed The seed of the initialization.
+// \return void
+*/
+template< typename T >  // Element type
+void KernelTest::initialize( blaze::DynamicVector<T>& v, size_t seed )
+{
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      v[i] = static_cast<T>( static_cast<int>( ( i*3UL + seed ) % 11UL ) - 5 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense matrix with small integral values.
+//
+// \param A The dense matrix to be initialized.
+// \param seed The seed of the initialization.
+// \return void
+*/
+template< typename T  // Element type
+        , bool SO >   // Storage order
+void KernelTest::initialize( blaze::DynamicMatrix<T,SO>& A, size_t seed )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = static_cast<T>( static_cast<int>( ( i*3UL + j*5UL + seed ) % 11UL ) - 5 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime dispatched dense kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   KernelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime dispatch kernel test.
+*/
+#define RUN_DISPATCH_KERNEL_TEST \
+   blazetest::mathtest::dispatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
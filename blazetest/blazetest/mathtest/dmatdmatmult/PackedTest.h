@@ -0,0 +1,417 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatmult/PackedTest.h
+//  \brief Header file for the packed dense matrix/dense matrix multiplication test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATMULT_PACKEDTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATMULT_PACKEDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/UpperMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the packed dense matrix/dense matrix multiplication test.
+//
+// This class represents a test suite for the packed kernel of the dense matrix/dense matrix
+// multiplication. All operands are sized above the DMATDMATMULT_THRESHOLD with dimensions that
+// are no multiple of the micro kernel size. Products with lower and upper triangular operands
+// additionally span several blocks of the triangular kernel. The results are compared to a
+// naive reference implementation.
+*/
+class PackedTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DMat;   //!< Row-major dense matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  TDMat;  //!< Column-major dense matrix type.
+
+   typedef blaze::LowerMatrix<DMat>   LDMat;   //!< Row-major lower triangular matrix type.
+   typedef blaze::LowerMatrix<TDMat>  LTDMat;  //!< Column-major lower triangular matrix type.
+   typedef blaze::UpperMatrix<DMat>   UDMat;   //!< Row-major upper triangular matrix type.
+   typedef blaze::UpperMatrix<TDMat>  UTDMat;  //!< Column-major upper triangular matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit PackedTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDMatDMatMult  ();
+   void testDMatTDMatMult ();
+   void testTDMatDMatMult ();
+   void testTDMatTDMatMult();
+   void testLowerMult     ();
+   void testUpperMult     ();
+
+   template< typename MT1, typename MT2 >
+   void testMultiplication( const MT1& A, const MT2& B );
+
+   template< typename MT, typename MT1, typename MT2 >
+   void testAssignment( const MT1& A, const MT2& B, const DMat& ref );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   static void initialize( MT& A, size_t seed );
+
+   template< typename MT1, typename MT2 >
+   static const DMat reference( const MT1& A, const MT2& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of the two given dense matrices.
+//
+// \param A The left-hand side dense matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of the
+// product of the two given dense matrices to both row-major and column-major dense matrices
+// and to submatrices of row-major and column-major dense matrices. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+void PackedTest::testMultiplication( const MT1& A, const MT2& B )
+{
+   const DMat ref( reference( A, B ) );
+
+   testAssignment<DMat >( A, B, ref );
+   testAssignment<TDMat>( A, B, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assignment of a dense matrix product to the given target type.
+//
+// \param A The left-hand side dense matrix.
+// \param B The right-hand side dense matrix.
+// \param ref The reference result of the multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT     // Type of the target dense matrix
+        , typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+void PackedTest::testAssignment( const MT1& A, const MT2& B, const DMat& ref )
+{
+   const size_t m( ref.rows()    );
+   const size_t n( ref.columns() );
+
+   DMat init( m, n );
+   initialize( init, 7UL );
+
+   const std::string prefix( test_ );
+
+
+   //=====================================================================================
+   // Dense matrix target
+   //=====================================================================================
+
+   {
+      test_ = prefix + " (assignment)";
+
+      MT C( m, n, 1.0 );
+      C = A * B;
+
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = prefix + " (addition assignment)";
+
+      MT C( init );
+      C += A * B;
+
+      checkResult( C, init + ref );
+   }
+
+   {
+      test_ = prefix + " (subtraction assignment)";
+
+      MT C( init );
+      C -= A * B;
+
+      checkResult( C, init - ref );
+   }
+
+
+   //=====================================================================================
+   // Submatrix target
+   //=====================================================================================
+
+   {
+      test_ = prefix + " (submatrix assignment)";
+
+      MT C( m+5UL, n+3UL, 1.0 );
+      submatrix( C, 3UL, 1UL, m, n ) = A * B;
+
+      DMat expected( m+5UL, n+3UL, 1.0 );
+      submatrix( expected, 3UL, 1UL, m, n ) = ref;
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = prefix + " (submatrix addition assignment)";
+
+      MT C( m+5UL, n+3UL, 1.0 );
+      submatrix( C, 3UL, 1UL, m, n ) = init;
+      submatrix( C, 3UL, 1UL, m, n ) += A * B;
+
+      DMat expected( m+5UL, n+3UL, 1.0 );
+      submatrix( expected, 3UL, 1UL, m, n ) = init + ref;
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = prefix + " (submatrix subtraction assignment)";
+
+      MT C( m+5UL, n+3UL, 1.0 );
+      submatrix( C, 3UL, 1UL, m, n ) = init;
+      submatrix( C, 3UL, 1UL, m, n ) -= A * B;
+
+      DMat expected( m+5UL, n+3UL, 1.0 );
+      submatrix( expected, 3UL, 1UL, m, n ) = init - ref;
+
+      checkResult( C, expected );
+   }
+
+   test_ = prefix;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void PackedTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   for( size_t i=0UL; i<computedResult.rows(); ++i ) {
+      for( size_t j=0UL; j<computedResult.columns(); ++j ) {
+         if( computedResult(i,j) != expectedResult(i,j) ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test : " << test_ << "\n"
+                << " Error: Incorrect result detected\n"
+                << " Details:\n"
+                << "   Position       : (" << i << "," << j << ")\n"
+                << "   Computed value : " << computedResult(i,j) << "\n"
+                << "   Expected value : " << expectedResult(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense matrix.
+//
+// \param A The dense matrix to be initialized.
+// \param seed The seed of the initialization pattern.
+// \return void
+//
+// This function initializes the given dense matrix with small integral values. Therefore all
+// products and sums in the tests are computed exactly. In case the given matrix is a lower or
+// upper triangular matrix, only the elements of the lower or upper part are initialized.
+*/
+template< typename MT >  // Type of the dense matrix
+void PackedTest::initialize( MT& A, size_t seed )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( ( blaze::IsLower<MT>::value && j > i ) || ( blaze::IsUpper<MT>::value && i > j ) )
+            continue;
+         A(i,j) = static_cast<double>( ( i*3UL + j*5UL + seed ) % 11UL ) - 5.0;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computing the reference result of the multiplication of the two given dense matrices.
+//
+// \param A The left-hand side dense matrix.
+// \param B The right-hand side dense matrix.
+// \return The reference result.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+const PackedTest::DMat PackedTest::reference( const MT1& A, const MT2& B )
+{
+   DMat C( A.rows(), B.columns(), 0.0 );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t k=0UL; k<A.columns(); ++k ) {
+         for( size_t j=0UL; j<B.columns(); ++j ) {
+            C(i,j) += A(i,k) * B(k,j);
+         }
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the packed dense matrix/dense matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   PackedTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the packed dense matrix/dense matrix multiplication test.
+*/
+#define RUN_DMATDMATMULT_PACKED_TEST \
+   blazetest::mathtest::dmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -52,6 +52,7 @@
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
 #include <blaze/math/UpperMatrix.h>
@@ -140,6 +141,10 @@ class OperationTest
    template< typename Type > void testUnglq();
    template< typename Type > void testOrmlq();
    template< typename Type > void testUnmlq();
+
+   template< typename Type > void testSyevd();
+   template< typename Type > void testHeevd();
+   template< typename Type > void testGesdd();
    //@}
    //**********************************************************************************************
 
@@ -8237,6 +8242,229 @@ void OperationTest::testUnmlq()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the eigenvalue functions for symmetric matrices (syevd).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the divide and conquer eigenvalue functions for symmetric
+// matrices for various data types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testSyevd()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Symmetric matrix eigenvalue computation";
+
+   {
+      blaze::SymmetricMatrix< blaze::StaticMatrix<Type,5UL,5UL,blaze::rowMajor> > S;
+      randomize( S );
+
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::rowMajor>    A( S );
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::columnMajor> B( S );
+
+      blaze::StaticVector<Type,5UL,blaze::columnVector> wA;
+      blaze::StaticVector<Type,5UL,blaze::columnVector> wB;
+
+      blaze::syevd( A, wA, 'V', 'L' );
+      blaze::syevd( B, wB, 'V', 'U' );
+
+      if( A != trans( B ) || wA != wB ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric matrix eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Row-major eigenvectors:\n" << A << "\n"
+             << "   Row-major eigenvalues:\n" << wA << "\n"
+             << "   Column-major eigenvectors:\n" << B << "\n"
+             << "   Column-major eigenvalues:\n" << wB << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the eigenvalue functions for Hermitian matrices (heevd).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the divide and conquer eigenvalue functions for Hermitian
+// matrices for various data types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testHeevd()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Hermitian matrix eigenvalue computation";
+
+   typedef blaze::UnderlyingBuiltin_<Type>  BT;
+
+   {
+      blaze::HermitianMatrix< blaze::StaticMatrix<Type,5UL,5UL,blaze::rowMajor> > H;
+      randomize( H );
+
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::rowMajor>    A( H );
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::columnMajor> B( H );
+
+      blaze::StaticVector<BT,5UL,blaze::columnVector> wA;
+      blaze::StaticVector<BT,5UL,blaze::columnVector> wB;
+
+      blaze::heevd( A, wA, 'V', 'L' );
+      blaze::heevd( B, wB, 'V', 'U' );
+
+      if( A != ctrans( B ) || wA != wB ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Hermitian matrix eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Row-major eigenvectors:\n" << A << "\n"
+             << "   Row-major eigenvalues:\n" << wA << "\n"
+             << "   Column-major eigenvectors:\n" << B << "\n"
+             << "   Column-major eigenvalues:\n" << wB << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the singular value decomposition functions (gesdd).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the divide and conquer singular value decomposition functions
+// for various data types. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void OperationTest::testGesdd()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   typedef blaze::UnderlyingBuiltin_<Type>  BT;
+
+   {
+      test_ = "Singular value computation";
+
+      blaze::StaticMatrix<Type,3UL,5UL,blaze::rowMajor> A;
+      randomize( A );
+
+      blaze::StaticMatrix<Type,5UL,3UL,blaze::columnMajor> B( trans( A ) );
+
+      blaze::StaticVector<BT,3UL,blaze::columnVector> sA;
+      blaze::StaticVector<BT,3UL,blaze::columnVector> sB;
+
+      blaze::gesdd( A, sA );
+      blaze::gesdd( B, sB );
+
+      if( sA != sB ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value computation failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Row-major singular values:\n" << sA << "\n"
+             << "   Column-major singular values:\n" << sB << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Singular value decomposition ('S')";
+
+      blaze::StaticMatrix<Type,3UL,5UL,blaze::rowMajor> A;
+      randomize( A );
+
+      blaze::StaticMatrix<Type,5UL,3UL,blaze::columnMajor> B( trans( A ) );
+
+      blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor> UA;
+      blaze::StaticMatrix<Type,3UL,5UL,blaze::rowMajor> VA;
+      blaze::StaticVector<BT,3UL,blaze::columnVector> sA;
+
+      blaze::StaticMatrix<Type,5UL,3UL,blaze::columnMajor> UB;
+      blaze::StaticMatrix<Type,3UL,3UL,blaze::columnMajor> VB;
+      blaze::StaticVector<BT,3UL,blaze::columnVector> sB;
+
+      blaze::gesdd( A, UA, sA, VA, 'S' );
+      blaze::gesdd( B, UB, sB, VB, 'S' );
+
+      if( UA != trans( VB ) || sA != sB || VA != trans( UB ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Row-major left singular vectors:\n" << UA << "\n"
+             << "   Row-major singular values:\n" << sA << "\n"
+             << "   Row-major right singular vectors:\n" << VA << "\n"
+             << "   Column-major left singular vectors:\n" << UB << "\n"
+             << "   Column-major singular values:\n" << sB << "\n"
+             << "   Column-major right singular vectors:\n" << VB << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Singular value decomposition ('A')";
+
+      blaze::StaticMatrix<Type,5UL,3UL,blaze::rowMajor> A;
+      randomize( A );
+
+      blaze::StaticMatrix<Type,3UL,5UL,blaze::columnMajor> B( trans( A ) );
+
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::rowMajor> UA;
+      blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor> VA;
+      blaze::StaticVector<BT,3UL,blaze::columnVector> sA;
+
+      blaze::StaticMatrix<Type,3UL,3UL,blaze::columnMajor> UB;
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::columnMajor> VB;
+      blaze::StaticVector<BT,3UL,blaze::columnVector> sB;
+
+      blaze::gesdd( A, UA, sA, VA, 'A' );
+      blaze::gesdd( B, UB, sB, VB, 'A' );
+
+      if( UA != trans( VB ) || sA != sB || VA != trans( UB ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Row-major left singular vectors:\n" << UA << "\n"
+             << "   Row-major singular values:\n" << sA << "\n"
+             << "   Row-major right singular vectors:\n" << VA << "\n"
+             << "   Column-major left singular vectors:\n" << UB << "\n"
+             << "   Column-major singular values:\n" << sB << "\n"
+             << "   Column-major right singular vectors:\n" << VB << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
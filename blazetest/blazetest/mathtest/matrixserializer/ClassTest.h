@@ -47,11 +47,13 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/Submatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/util/Random.h>
 #include <blaze/util/serialization/Archive.h>
+#include <blaze/util/Types.h>
 
 
 namespace blazetest {
@@ -92,9 +94,11 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyMatrices ();
-   void testRandomMatrices();
-   void testFailures      ();
+   void testEmptyMatrices  ();
+   void testRandomMatrices ();
+   void testRepresentation ();
+   void testFailures       ();
+   void testCorruptArchives();
 
    template< size_t M, size_t N, typename MT >
    void runAllTests( const MT& src );
@@ -125,6 +129,27 @@ class ClassTest
 
    template< typename MT1, typename MT2 >
    void compareMatrices( const MT1& src, const MT2& dst );
+
+   template< typename MT >
+   void runRepresentationTest( const MT& src );
+
+   template< typename MT >
+   void runCorruptArchiveTest( bool columnMajor );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   static std::string serializeElementwise( const blaze::DenseMatrix<MT,SO>& mat );
+
+   template< typename MT, bool SO >
+   static std::string serializeElementwise( const blaze::SparseMatrix<MT,SO>& mat );
+
+   template< typename ET, typename Archive >
+   static void serializeHeader( Archive& archive, blaze::uint8_t type, size_t m, size_t n,
+                                size_t number );
    //@}
    //**********************************************************************************************
 
@@ -515,6 +540,218 @@ void ClassTest::compareMatrices( const MT1& src, const MT2& dst )
 
 
 
+//*************************************************************************************************
+/*!\brief Comparison of the serialized representation of the given matrix to the reference.
+//
+// \param src The source matrix to be serialized.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes the given matrix and compares the resulting bytes to the bytes of an
+// element-wise serialization of the matrix (see the serializeElementwise() functions). In case
+// the two representations differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runRepresentationTest( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   std::stringstream stream;
+   blaze::Archive<std::stringstream> archive( stream );
+
+   testSerialization( archive, src );
+
+   const std::string result  ( stream.str() );
+   const std::string expected( serializeElementwise( src ) );
+
+   if( result != expected ) {
+      size_t pos( 0UL );
+      while( pos < result.size() && pos < expected.size() && result[pos] == expected[pos] ) {
+         ++pos;
+      }
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serialized representation differs from the element-wise representation\n"
+          << " Details:\n"
+          << "   Number of bytes          : " << result.size() << "\n"
+          << "   Expected number of bytes : " << expected.size() << "\n"
+          << "   First differing byte     : " << pos << "\n"
+          << "   Source:\n" << src << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserialization test with a sparse archive with a corrupt number of non-zero elements.
+//
+// \param columnMajor \a true for a column-major archive, \a false for a row-major archive.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates an archive of a sparse 3x4 matrix, whose first row (or column in case
+// of a column-major archive) claims more non-zero elements than the row (or column) can hold.
+// The total number of non-zero elements stored in the header is valid. In case the archive is
+// not rejected during the deserialization of a matrix of the given type, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runCorruptArchiveTest( bool columnMajor )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   const size_t m( 3UL );
+   const size_t n( 4UL );
+   const size_t size( columnMajor ? m : n );
+
+   blaze::Archive<std::stringstream> archive;
+
+   serializeHeader<int>( archive, columnMajor ? 7U : 3U, m, n, size+1UL );
+
+   archive << blaze::uint64_t( size+1UL );
+   for( size_t k=0UL; k<=size; ++k ) {
+      archive << ( k < size ? k : size-1UL ) << int( k+1UL );
+   }
+   for( size_t k=1UL; k<( columnMajor ? n : m ); ++k ) {
+      archive << blaze::uint64_t( 0UL );
+   }
+
+   MT dst;
+   bool rejected( false );
+
+   try {
+      archive >> dst;
+   }
+   catch( std::runtime_error& ) {
+      rejected = true;
+   }
+
+   if( !rejected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deserialization of a corrupt " << ( columnMajor ? "column" : "row" )
+          << " succeeded\n"
+          << " Details:\n"
+          << "   Number of non-zero elements : " << size+1UL << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Element-wise serialization of the given dense matrix.
+//
+// \param mat The dense matrix to be serialized.
+// \return The bytes of the serialized matrix.
+//
+// This function serializes the given dense matrix element by element, independent of the
+// MatrixSerializer class. It serves as reference representation of a dense matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+std::string ClassTest::serializeElementwise( const blaze::DenseMatrix<MT,SO>& mat )
+{
+   std::stringstream stream;
+   blaze::Archive<std::stringstream> archive( stream );
+
+   serializeHeader< blaze::ElementType_<MT> >( archive, SO ? 5U : 1U, (~mat).rows(),
+                                               (~mat).columns(), (~mat).rows()*(~mat).columns() );
+
+   if( SO == blaze::rowMajor ) {
+      for( size_t i=0UL; i<(~mat).rows(); ++i ) {
+         for( size_t j=0UL; j<(~mat).columns(); ++j ) {
+            archive << (~mat)(i,j);
+         }
+      }
+   }
+   else {
+      for( size_t j=0UL; j<(~mat).columns(); ++j ) {
+         for( size_t i=0UL; i<(~mat).rows(); ++i ) {
+            archive << (~mat)(i,j);
+         }
+      }
+   }
+
+   return stream.str();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise serialization of the given sparse matrix.
+//
+// \param mat The sparse matrix to be serialized.
+// \return The bytes of the serialized matrix.
+//
+// This function serializes the given sparse matrix element by element, independent of the
+// MatrixSerializer class. Each row (or column in case of a column-major matrix) is stored as
+// its number of non-zero elements, followed by the index/value pairs of all non-zero elements.
+// It serves as reference representation of a sparse matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+std::string ClassTest::serializeElementwise( const blaze::SparseMatrix<MT,SO>& mat )
+{
+   std::stringstream stream;
+   blaze::Archive<std::stringstream> archive( stream );
+
+   serializeHeader< blaze::ElementType_<MT> >( archive, SO ? 7U : 3U, (~mat).rows(),
+                                               (~mat).columns(), (~mat).nonZeros() );
+
+   const size_t lines( SO ? (~mat).columns() : (~mat).rows() );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      archive << blaze::uint64_t( (~mat).nonZeros( i ) );
+      for( auto element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+         archive << element->index() << element->value();
+      }
+   }
+
+   return stream.str();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise serialization of a matrix header.
+//
+// \param archive The archive to be written.
+// \param type The type flag of the matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param number The total number of elements stored in the archive.
+// \return void
+*/
+template< typename ET         // Element type of the matrix
+        , typename Archive >  // Type of the archive
+void ClassTest::serializeHeader( Archive& archive, blaze::uint8_t type, size_t m, size_t n,
+                                 size_t number )
+{
+   archive << blaze::uint8_t( 1U )
+           << type
+           << blaze::uint8_t( blaze::TypeValueMapping<ET>::value )
+           << blaze::uint8_t( sizeof( ET ) )
+           << blaze::uint64_t( m )
+           << blaze::uint64_t( n )
+           << blaze::uint64_t( number );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
@@ -0,0 +1,392 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/numa/FirstTouchTest.h
+//  \brief Header file for the NUMA first-touch initialization test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZETEST_MATHTEST_NUMA_FIRSTTOUCHTEST_H_
+#define _BLAZETEST_MATHTEST_NUMA_FIRSTTOUCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/NUMA.h>
+#include <blaze/system/SMP.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace numa {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the NUMA first-touch initialization.
+//
+// This class represents a test suite for the first-touch initialization of dense vectors and
+// matrices (see the \c BLAZE_NUMA_POLICY switch in the <tt>./blaze/config/NUMA.h</tt>
+// configuration file). All vectors and matrices are sized above the according SMP thresholds,
+// such that the elements are initialized in parallel. Both the elements and the padding
+// elements are checked after every construction, copy and resize operation.
+*/
+class FirstTouchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FirstTouchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDynamicVector();
+   void testResize();
+
+   template< bool SO >
+   void testDynamicMatrix();
+
+   template< typename Type >
+   void checkParallel( const Type& object ) const;
+
+   template< typename Type, bool TF >
+   void checkVector( const blaze::DynamicVector<Type,TF>& vec, const Type& value ) const;
+
+   template< typename Type >
+   void checkMatrix( const blaze::DynamicMatrix<Type,blaze::rowMajor>& mat,
+                     const Type& value ) const;
+
+   template< typename Type >
+   void checkMatrix( const blaze::DynamicMatrix<Type,blaze::columnMajor>& mat,
+                     const Type& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the first-touch initialization of a DynamicMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the first-touch initialization of a row-major or column-major
+// dynamic matrix during the construction, the copy construction and the non-preserving resize
+// operation. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the dynamic matrix
+void FirstTouchTest::testDynamicMatrix()
+{
+   using blaze::DynamicMatrix;
+
+   const size_t M( 257UL );
+   const size_t N( blaze::SMP_DMATASSIGN_THRESHOLD / M + 13UL );
+
+   {
+      test_ = "DynamicMatrix size constructor";
+
+      DynamicMatrix<double,SO> mat( M, N );
+
+      checkParallel( mat );
+      checkMatrix( mat, 0.0 );
+   }
+
+   {
+      test_ = "DynamicMatrix homogeneous initialization constructor";
+
+      DynamicMatrix<double,SO> mat( M, N, 2.0 );
+
+      checkParallel( mat );
+      checkMatrix( mat, 2.0 );
+   }
+
+   {
+      test_ = "DynamicMatrix copy constructor";
+
+      const DynamicMatrix<double,SO> mat1( M, N, 3.0 );
+      const DynamicMatrix<double,SO> mat2( mat1 );
+
+      checkParallel( mat2 );
+      checkMatrix( mat2, 3.0 );
+   }
+
+   {
+      test_ = "DynamicMatrix::resize()";
+
+      DynamicMatrix<double,SO> mat( 3UL, 5UL, 4.0 );
+      mat.resize( M, N, false );
+
+      checkParallel( mat );
+      checkMatrix( mat, 0.0 );
+   }
+
+   {
+      test_ = "DynamicMatrix SMP assignment";
+
+      const DynamicMatrix<double,SO> mat1( M, N, 1.0 );
+      const DynamicMatrix<double,SO> mat2( M, N, 4.0 );
+      DynamicMatrix<double,SO> mat3( M, N );
+
+      mat3 = mat1 + mat2;
+
+      checkMatrix( mat3, 5.0 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking whether the given vector or matrix is initialized in parallel.
+//
+// \param object The dense vector or matrix to be checked.
+// \return void
+// \exception std::runtime_error The initialization is performed serially.
+//
+// This function checks whether the given vector or matrix is large enough to be initialized
+// in parallel and whether the first-touch initialization is enabled. Otherwise a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dense vector or matrix
+void FirstTouchTest::checkParallel( const Type& object ) const
+{
+   if( !BLAZE_NUMA_FIRST_TOUCH || !object.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serial initialization detected\n"
+          << " Details:\n"
+          << "   First-touch initialization: " << BLAZE_NUMA_FIRST_TOUCH << "\n"
+          << "   Number of threads         : " << blaze::getNumThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements and the padding elements of the given dynamic vector.
+//
+// \param vec The dynamic vector to be checked.
+// \param value The expected value of all vector elements.
+// \return void
+// \exception std::runtime_error Incorrect element detected.
+//
+// This function checks whether all elements of the given dynamic vector are equal to the given
+// value and whether all padding elements are zero. In case an incorrect element is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the dynamic vector
+        , bool TF >      // Transpose flag
+void FirstTouchTest::checkVector( const blaze::DynamicVector<Type,TF>& vec,
+                                  const Type& value ) const
+{
+   for( size_t i=0UL; i<vec.capacity(); ++i )
+   {
+      const Type expected( ( i < vec.size() )?( value ):( Type() ) );
+
+      if( vec.data()[i] != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect element detected\n"
+             << " Details:\n"
+             << "   Size     : " << vec.size() << "\n"
+             << "   Capacity : " << vec.capacity() << "\n"
+             << "   Index    : " << i << "\n"
+             << "   Result   : " << vec.data()[i] << "\n"
+             << "   Expected : " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements and the padding elements of the given row-major dynamic matrix.
+//
+// \param mat The row-major dynamic matrix to be checked.
+// \param value The expected value of all matrix elements.
+// \return void
+// \exception std::runtime_error Incorrect element detected.
+//
+// This function checks whether all elements of the given row-major dynamic matrix are equal to
+// the given value and whether all padding elements are zero. In case an incorrect element is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the dynamic matrix
+void FirstTouchTest::checkMatrix( const blaze::DynamicMatrix<Type,blaze::rowMajor>& mat,
+                                  const Type& value ) const
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.spacing(); ++j )
+      {
+         const Type expected( ( j < mat.columns() )?( value ):( Type() ) );
+
+         if( mat.data()[i*mat.spacing()+j] != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect element detected\n"
+                << " Details:\n"
+                << "   Rows     : " << mat.rows() << "\n"
+                << "   Columns  : " << mat.columns() << "\n"
+                << "   Spacing  : " << mat.spacing() << "\n"
+                << "   Position : (" << i << "," << j << ")\n"
+                << "   Result   : " << mat.data()[i*mat.spacing()+j] << "\n"
+                << "   Expected : " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements and the padding elements of the given column-major dynamic matrix.
+//
+// \param mat The column-major dynamic matrix to be checked.
+// \param value The expected value of all matrix elements.
+// \return void
+// \exception std::runtime_error Incorrect element detected.
+//
+// This function checks whether all elements of the given column-major dynamic matrix are equal
+// to the given value and whether all padding elements are zero. In case an incorrect element is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the dynamic matrix
+void FirstTouchTest::checkMatrix( const blaze::DynamicMatrix<Type,blaze::columnMajor>& mat,
+                                  const Type& value ) const
+{
+   for( size_t j=0UL; j<mat.columns(); ++j ) {
+      for( size_t i=0UL; i<mat.spacing(); ++i )
+      {
+         const Type expected( ( i < mat.rows() )?( value ):( Type() ) );
+
+         if( mat.data()[i+j*mat.spacing()] != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect element detected\n"
+                << " Details:\n"
+                << "   Rows     : " << mat.rows() << "\n"
+                << "   Columns  : " << mat.columns() << "\n"
+                << "   Spacing  : " << mat.spacing() << "\n"
+                << "   Position : (" << i << "," << j << ")\n"
+                << "   Result   : " << mat.data()[i+j*mat.spacing()] << "\n"
+                << "   Expected : " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the NUMA first-touch initialization of dense vectors and matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   FirstTouchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the NUMA first-touch initialization test.
+*/
+#define RUN_NUMA_FIRSTTOUCH_TEST \
+   blazetest::mathtest::numa::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace numa
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
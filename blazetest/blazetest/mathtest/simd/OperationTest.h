@@ -40,11 +40,16 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/SIMD.h>
@@ -70,6 +75,7 @@
 #include <blaze/math/typetraits/HasSIMDInvSqrt.h>
 #include <blaze/math/typetraits/HasSIMDLog.h>
 #include <blaze/math/typetraits/HasSIMDLog10.h>
+#include <blaze/math/typetraits/HasSIMDMaskedLoad.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDPow.h>
 #include <blaze/math/typetraits/HasSIMDSin.h>
@@ -143,6 +149,10 @@ class OperationTest : private blaze::NonCopyable
    void testStorea        ();
    void testStream        ();
    void testStoreu        ( size_t offset );
+   void testMaskedLoadu   ( blaze::TrueType  );
+   void testMaskedLoadu   ( blaze::FalseType );
+   void testMaskedStoreu  ( blaze::TrueType  );
+   void testMaskedStoreu  ( blaze::FalseType );
 
    void testAddition      ( blaze::TrueType  );
    void testAddition      ( blaze::FalseType );
@@ -223,6 +233,7 @@ class OperationTest : private blaze::NonCopyable
    /*!\name Error detection functions */
    //@{
    void compare( const T* expected, const T* actual ) const;
+   void compare( const T* expected, const T* actual, size_t n ) const;
    //@}
    //**********************************************************************************************
 
@@ -285,6 +296,9 @@ OperationTest<T>::OperationTest()
       testStoreu( offset );
    }
 
+   testMaskedLoadu   ( typename blaze::HasSIMDMaskedLoad<T>::Type() );
+   testMaskedStoreu  ( typename blaze::HasSIMDMaskedLoad<T>::Type() );
+
    testAddition      ( typename blaze::HasSIMDAdd    <T,T>::Type() );
    testSubtraction   ( typename blaze::HasSIMDSub    <T,T>::Type() );
    testMultiplication( typename blaze::HasSIMDMult   <T,T>::Type() );
@@ -445,6 +459,151 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked unaligned load operation.
+//
+// \return void
+// \exception std::runtime_error Load error detected.
+//
+// This function tests the masked unaligned load operation for all partial sizes in the range
+// \f$ [0..SIMDSIZE) \f$. It checks that the first \a n values are loaded, that all remaining
+// elements of the SIMD vector are zero, and (on POSIX systems) that no value beyond the first
+// \a n values is accessed by loading the values directly in front of an inaccessible memory
+// page. In case any error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskedLoadu( blaze::TrueType )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+#if defined(__unix__) || defined(__APPLE__)
+   const size_t pagesize( sysconf( _SC_PAGESIZE ) );
+   char* const page = static_cast<char*>(
+      mmap( nullptr, 2UL*pagesize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) );
+
+   if( page == MAP_FAILED || mprotect( page+pagesize, pagesize, PROT_NONE ) != 0 ) {
+      throw std::runtime_error( " Test : Masked loadu() operation\n Error: Guard page setup failed\n" );
+   }
+
+   T* const end( reinterpret_cast<T*>( page+pagesize ) );
+#endif
+
+   for( size_t n=0UL; n<SIMDSIZE; ++n )
+   {
+      std::ostringstream oss;
+      oss << "Masked loadu() operation (n=" << n << ")";
+      test_ = oss.str();
+
+      initialize();
+
+      for( size_t i=0UL; i<SIMDSIZE; ++i ) {
+         if( i >= n ) a_[i] = T(1);
+         c_[i] = ( i < n )?( a_[i] ):( T(0) );
+      }
+
+      storeu( b_, loadu( a_, n ) );
+
+      compare( c_, b_, SIMDSIZE );
+
+#if defined(__unix__) || defined(__APPLE__)
+      std::copy( a_, a_+n, end-n );
+
+      storeu( b_, loadu( end-n, n ) );
+
+      compare( c_, b_, SIMDSIZE );
+#endif
+   }
+
+#if defined(__unix__) || defined(__APPLE__)
+   munmap( page, 2UL*pagesize );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the masked unaligned load operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskedLoadu( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the masked unaligned store operation.
+//
+// \return void
+// \exception std::runtime_error Store error detected.
+//
+// This function tests the masked unaligned store operation for all partial sizes in the range
+// \f$ [0..SIMDSIZE) \f$. It checks that the first \a n values are stored, that all following
+// values remain unchanged, and (on POSIX systems) that no value beyond the first \a n values
+// is accessed by storing the values directly in front of an inaccessible memory page. In case
+// any error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskedStoreu( blaze::TrueType )
+{
+   using blaze::loadu;
+   using blaze::storeu;
+
+#if defined(__unix__) || defined(__APPLE__)
+   const size_t pagesize( sysconf( _SC_PAGESIZE ) );
+   char* const page = static_cast<char*>(
+      mmap( nullptr, 2UL*pagesize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) );
+
+   if( page == MAP_FAILED || mprotect( page+pagesize, pagesize, PROT_NONE ) != 0 ) {
+      throw std::runtime_error( " Test : Masked storeu() operation\n Error: Guard page setup failed\n" );
+   }
+
+   T* const end( reinterpret_cast<T*>( page+pagesize ) );
+#endif
+
+   for( size_t n=0UL; n<SIMDSIZE; ++n )
+   {
+      std::ostringstream oss;
+      oss << "Masked storeu() operation (n=" << n << ")";
+      test_ = oss.str();
+
+      initialize();
+
+      for( size_t i=0UL; i<=SIMDSIZE; ++i ) {
+         c_[i] = ( i >= 1UL && i <= n )?( a_[i-1UL] ):( b_[i] );
+      }
+
+      storeu( b_+1UL, loadu( a_ ), n );
+
+      compare( c_, b_, SIMDSIZE+1UL );
+
+#if defined(__unix__) || defined(__APPLE__)
+      storeu( end-n, loadu( a_ ), n );
+
+      compare( a_, end-n, n );
+#endif
+   }
+
+#if defined(__unix__) || defined(__APPLE__)
+   munmap( page, 2UL*pagesize );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the masked unaligned store operation.
+//
+// \return void
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskedStoreu( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the addition operation.
 //
@@ -2037,7 +2196,27 @@ void OperationTest<T>::testReduction()
 template< typename T >  // Data type of the SIMD test
 void OperationTest<T>::compare( const T* expected, const T* actual ) const
 {
-   for( size_t i=0UL; i<N; ++i ) {
+   compare( expected, actual, N );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the first \a n elements of the two given arrays.
+//
+// \param expected The array of expected values.
+// \param actual The array of actual values.
+// \param n The number of elements to be compared.
+// \return void
+// \exception std::runtime_error Value mismatch detected.
+//
+// This function compares the first \a n elements of the two given arrays. In case any value of
+// the two arrays differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::compare( const T* expected, const T* actual, size_t n ) const
+{
+   for( size_t i=0UL; i<n; ++i ) {
       if( !blaze::equal( expected[i], actual[i] ) ) {
          std::ostringstream oss;
          oss.precision( 20 );
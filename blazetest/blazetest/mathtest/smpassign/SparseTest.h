@@ -0,0 +1,276 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smpassign/SparseTest.h
+//  \brief Header file for the sparse SMP assignment test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMPASSIGN_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_SMPASSIGN_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/SMP.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SMP assignment to sparse matrices and vectors.
+//
+// This class represents a test suite for the SMP assignment of sparse operations to compressed
+// matrices and vectors. All operations are sized above the according SMP thresholds and the
+// results are compared to the results of the serial assignment.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testCompressedMatrix();
+   void testCompressedVector();
+
+   template< typename Type, typename Expr >
+   void checkParallel( const Type& target, const Expr& expr ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   static void initialize( blaze::CompressedMatrix<int,SO>& sm );
+
+   static void initialize( blaze::CompressedVector<int>& sv );
+
+   static size_t dimension( size_t threshold );
+   static size_t multiplications( const blaze::CompressedMatrix<int,blaze::rowMajor>& A,
+                                  const blaze::CompressedMatrix<int,blaze::rowMajor>& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Test constants******************************************************************************
+   /*!\name Test constants */
+   //@{
+   static const size_t nonZerosPerRow = 4UL;  //!< The number of non-zero elements per matrix row.
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking whether the assignment of the given expression is executed in parallel.
+//
+// \param target The target of the assignment.
+// \param expr The expression to be assigned.
+// \return void
+// \exception std::runtime_error The assignment is not executed in parallel.
+//
+// This function checks whether the SMP assignment of the given expression to the given target
+// takes the parallel code path. In case the assignment is executed serially although a shared
+// memory parallelization is active, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type    // Type of the target
+        , typename Expr >  // Type of the expression
+void SparseTest::checkParallel( const Type& target, const Expr& expr ) const
+{
+   const bool parallel( BLAZE_OPENMP_PARALLEL_MODE ||
+                        BLAZE_CPP_THREADS_PARALLEL_MODE ||
+                        BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+   if( parallel && !isParallelSMPAssign( target, expr ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serial assignment detected\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed result differs from the expected result, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type1    // Type of the computed result
+        , typename Type2 >  // Type of the expected result
+void SparseTest::checkResult( const Type1& result, const Type2& expected ) const
+{
+   if( result != expected || nonZeros( result ) != nonZeros( expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros of the result  : " << nonZeros( result ) << "\n"
+          << "   Number of non-zeros of the expected: " << nonZeros( expected ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given compressed matrix with a deterministic sparsity pattern.
+//
+// \param sm The compressed matrix to be initialized.
+// \return void
+//
+// This function initializes the given compressed matrix with \a nonZerosPerRow non-zero
+// elements per row.
+*/
+template< bool SO >  // Storage order of the compressed matrix
+void SparseTest::initialize( blaze::CompressedMatrix<int,SO>& sm )
+{
+   sm.reset();
+
+   for( size_t i=0UL; i<sm.rows(); ++i ) {
+      for( size_t k=0UL; k<nonZerosPerRow; ++k ) {
+         sm( i, ( i*7UL + k*13UL + 1UL ) % sm.columns() ) = static_cast<int>( i%5UL + k + 1UL );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment to sparse matrices and vectors.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse SMP assignment test.
+*/
+#define RUN_SMPASSIGN_SPARSE_TEST \
+   blazetest::mathtest::smpassign::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
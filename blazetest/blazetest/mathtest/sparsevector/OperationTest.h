@@ -88,6 +88,7 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testNorms();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -47,11 +47,13 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/constraints/Vector.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/Subvector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/util/Random.h>
 #include <blaze/util/serialization/Archive.h>
+#include <blaze/util/Types.h>
 
 
 namespace blazetest {
@@ -92,9 +94,11 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyVectors ();
-   void testRandomVectors();
-   void testFailures     ();
+   void testEmptyVectors   ();
+   void testRandomVectors  ();
+   void testRepresentation ();
+   void testFailures       ();
+   void testCorruptArchives();
 
    template< size_t N, typename VT >
    void runAllTests( const VT& src );
@@ -125,6 +129,26 @@ class ClassTest
 
    template< typename VT1, typename VT2 >
    void compareVectors( const VT1& src, const VT2& dst );
+
+   template< typename VT >
+   void runRepresentationTest( const VT& src );
+
+   template< typename VT >
+   void runCorruptArchiveTest();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT, bool TF >
+   static std::string serializeElementwise( const blaze::DenseVector<VT,TF>& vec );
+
+   template< typename VT, bool TF >
+   static std::string serializeElementwise( const blaze::SparseVector<VT,TF>& vec );
+
+   template< typename ET, typename Archive >
+   static void serializeHeader( Archive& archive, blaze::uint8_t type, size_t n, size_t number );
    //@}
    //**********************************************************************************************
 
@@ -484,6 +508,186 @@ void ClassTest::compareVectors( const VT1& src, const VT2& dst )
 
 
 
+//*************************************************************************************************
+/*!\brief Comparison of the serialized representation of the given vector to the reference.
+//
+// \param src The source vector to be serialized.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes the given vector and compares the resulting bytes to the bytes of an
+// element-wise serialization of the vector (see the serializeElementwise() functions). In case
+// the two representations differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT >  // Type of the vector
+void ClassTest::runRepresentationTest( const VT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_TYPE( VT );
+
+   std::stringstream stream;
+   blaze::Archive<std::stringstream> archive( stream );
+
+   testSerialization( archive, src );
+
+   const std::string result  ( stream.str() );
+   const std::string expected( serializeElementwise( src ) );
+
+   if( result != expected ) {
+      size_t pos( 0UL );
+      while( pos < result.size() && pos < expected.size() && result[pos] == expected[pos] ) {
+         ++pos;
+      }
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serialized representation differs from the element-wise representation\n"
+          << " Details:\n"
+          << "   Size                     : " << src.size() << "\n"
+          << "   Number of bytes          : " << result.size() << "\n"
+          << "   Expected number of bytes : " << expected.size() << "\n"
+          << "   First differing byte     : " << pos << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserialization test with a sparse archive with a corrupt number of non-zero elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates an archive of a sparse vector of size 4, which claims to contain more
+// non-zero elements than the vector can hold. In case the archive is not rejected during the
+// deserialization of a vector of the given type, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT >  // Type of the vector
+void ClassTest::runCorruptArchiveTest()
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_TYPE( VT );
+
+   const size_t n( 4UL );
+
+   blaze::Archive<std::stringstream> archive;
+
+   serializeHeader<int>( archive, 2U, n, n+1UL );
+
+   for( size_t k=0UL; k<=n; ++k ) {
+      archive << ( k < n ? k : n-1UL ) << int( k+1UL );
+   }
+
+   VT dst;
+   bool rejected( false );
+
+   try {
+      archive >> dst;
+   }
+   catch( std::runtime_error& ) {
+      rejected = true;
+   }
+
+   if( !rejected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deserialization of a corrupt sparse vector succeeded\n"
+          << " Details:\n"
+          << "   Number of non-zero elements : " << n+1UL << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Element-wise serialization of the given dense vector.
+//
+// \param vec The dense vector to be serialized.
+// \return The bytes of the serialized vector.
+//
+// This function serializes the given dense vector element by element, independent of the
+// VectorSerializer class. It serves as reference representation of a dense vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+std::string ClassTest::serializeElementwise( const blaze::DenseVector<VT,TF>& vec )
+{
+   std::stringstream stream;
+   blaze::Archive<std::stringstream> archive( stream );
+
+   serializeHeader< blaze::ElementType_<VT> >( archive, 0U, (~vec).size(), (~vec).size() );
+
+   for( size_t i=0UL; i<(~vec).size(); ++i ) {
+      archive << (~vec)[i];
+   }
+
+   return stream.str();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise serialization of the given sparse vector.
+//
+// \param vec The sparse vector to be serialized.
+// \return The bytes of the serialized vector.
+//
+// This function serializes the given sparse vector element by element, independent of the
+// VectorSerializer class. The non-zero elements are stored as index/value pairs. It serves as
+// reference representation of a sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+std::string ClassTest::serializeElementwise( const blaze::SparseVector<VT,TF>& vec )
+{
+   std::stringstream stream;
+   blaze::Archive<std::stringstream> archive( stream );
+
+   serializeHeader< blaze::ElementType_<VT> >( archive, 2U, (~vec).size(), (~vec).nonZeros() );
+
+   for( auto element=(~vec).begin(); element!=(~vec).end(); ++element ) {
+      archive << element->index() << element->value();
+   }
+
+   return stream.str();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise serialization of a vector header.
+//
+// \param archive The archive to be written.
+// \param type The type flag of the vector.
+// \param n The size of the vector.
+// \param number The total number of elements stored in the archive.
+// \return void
+*/
+template< typename ET         // Element type of the vector
+        , typename Archive >  // Type of the archive
+void ClassTest::serializeHeader( Archive& archive, blaze::uint8_t type, size_t n, size_t number )
+{
+   archive << blaze::uint8_t( 1U )
+           << type
+           << blaze::uint8_t( blaze::TypeValueMapping<ET>::value )
+           << blaze::uint8_t( sizeof( ET ) )
+           << blaze::uint64_t( n )
+           << blaze::uint64_t( number );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
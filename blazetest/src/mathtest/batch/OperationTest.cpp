@@ -0,0 +1,432 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/batch/OperationTest.cpp
+//  \brief Source file for the batched matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/batch/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   typedef blaze::complex<double>  cdouble;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 7UL, 8UL, 15UL, 16UL, 17UL, 33UL, 100UL, 5000UL };
+
+
+   //=====================================================================================
+   // Container tests
+   //=====================================================================================
+
+   testMatrixBatch();
+   testVectorBatch();
+   testSizeMismatch();
+   testSingular();
+
+
+   //=====================================================================================
+   // Batched matrix/matrix multiplication tests
+   //=====================================================================================
+
+   for( size_t n : sizes ) {
+      testMatMatMult<int    ,3UL,3UL,3UL>( n );
+      testMatMatMult<int    ,6UL,6UL,6UL>( n );
+      testMatMatMult<float  ,3UL,3UL,3UL>( n );
+      testMatMatMult<float  ,6UL,6UL,6UL>( n );
+      testMatMatMult<double ,3UL,3UL,3UL>( n );
+      testMatMatMult<double ,6UL,6UL,6UL>( n );
+      testMatMatMult<double ,2UL,4UL,3UL>( n );
+      testMatMatMult<cdouble,3UL,3UL,3UL>( n );
+   }
+
+
+   //=====================================================================================
+   // Batched matrix/vector multiplication tests
+   //=====================================================================================
+
+   for( size_t n : sizes ) {
+      testMatVecMult<int    ,3UL,3UL>( n );
+      testMatVecMult<int    ,6UL,6UL>( n );
+      testMatVecMult<float  ,3UL,3UL>( n );
+      testMatVecMult<float  ,6UL,6UL>( n );
+      testMatVecMult<double ,3UL,3UL>( n );
+      testMatVecMult<double ,6UL,6UL>( n );
+      testMatVecMult<double ,4UL,2UL>( n );
+      testMatVecMult<cdouble,3UL,3UL>( n );
+   }
+
+
+   //=====================================================================================
+   // Batched inversion, determinant, and solve tests
+   //=====================================================================================
+
+   for( size_t n : sizes ) {
+      testInversion<float  ,3UL>( n );
+      testInversion<double ,2UL>( n );
+      testInversion<double ,3UL>( n );
+      testInversion<double ,4UL>( n );
+      testInversion<double ,5UL>( n );
+      testInversion<double ,6UL>( n );
+      testInversion<cdouble,3UL>( n );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access, resize, and swap functionality of the
+// MatrixBatch class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testMatrixBatch()
+{
+   typedef blaze::StaticMatrix<int,2UL,3UL,blaze::rowMajor>  MT;
+
+   test_ = "MatrixBatch element access";
+
+   const MT mat1{ { 1, 2, 3 }, { 4, 5, 6 } };
+   const MT mat2{ { 7, 8, 9 }, { 1, 2, 3 } };
+
+   blaze::MatrixBatch<int,2UL,3UL> A( 5UL, 1 );
+   A.set( 0UL, mat1 );
+   A.set( 3UL, mat2 );
+   A(4UL,1UL,2UL) = -1;
+
+   if( A.size() != 5UL || A.get(0UL) != mat1 || A.get(3UL) != mat2 ||
+       A(4UL,1UL,2UL) != -1 || A(4UL,0UL,0UL) != 1 || !isIntact( A ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element access failed\n"
+          << " Details:\n"
+          << "   Size: " << A.size() << "\n"
+          << "   Matrix 3:\n" << A.get(3UL) << "\n"
+          << "   Matrix 4:\n" << A.get(4UL) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "MatrixBatch resize";
+
+   A.resize( 37UL );
+
+   if( A.size() != 37UL || A.get(3UL) != mat2 || A(4UL,1UL,2UL) != -1 || !isIntact( A ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the batch failed\n"
+          << " Details:\n"
+          << "   Size: " << A.size() << "\n"
+          << "   Expected size: 37\n"
+          << "   Matrix 3:\n" << A.get(3UL) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "MatrixBatch swap";
+
+   blaze::MatrixBatch<int,2UL,3UL> B( 2UL );
+   B.set( 1UL, mat2 );
+   swap( A, B );
+
+   if( A.size() != 2UL || B.size() != 37UL || A.get(1UL) != mat2 || B.get(0UL) != mat1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the batches failed\n"
+          << " Details:\n"
+          << "   Size of first batch : " << A.size() << "\n"
+          << "   Size of second batch: " << B.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "MatrixBatch out-of-bounds access";
+
+   try {
+      const MT mat( A.get( 2UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds access succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the VectorBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access, resize, and reset functionality of the
+// VectorBatch class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testVectorBatch()
+{
+   typedef blaze::StaticVector<double,3UL,blaze::columnVector>  VT;
+
+   test_ = "VectorBatch element access";
+
+   const VT vec1{ 1.0, 2.0, 3.0 };
+   const VT vec2{ 4.0, 5.0, 6.0 };
+
+   blaze::VectorBatch<double,3UL> x( 3UL );
+   x.set( 0UL, vec1 );
+   x.set( 2UL, vec2 );
+
+   if( x.size() != 3UL || x.get(0UL) != vec1 || x.get(1UL) != VT() || x(2UL,1UL) != 5.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element access failed\n"
+          << " Details:\n"
+          << "   Size: " << x.size() << "\n"
+          << "   Vector 0:\n" << x.get(0UL) << "\n"
+          << "   Vector 2:\n" << x.get(2UL) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "VectorBatch resize";
+
+   x.resize( 21UL );
+
+   if( x.size() != 21UL || x.get(2UL) != vec2 || !isIntact( x ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the batch failed\n"
+          << " Details:\n"
+          << "   Size: " << x.size() << "\n"
+          << "   Expected size: 21\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "VectorBatch reset";
+
+   reset( x );
+
+   if( x.size() != 21UL || x.get(2UL) != VT() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the batch failed\n"
+          << " Details:\n"
+          << "   Size: " << x.size() << "\n"
+          << "   Vector 2:\n" << x.get(2UL) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched multiplication with batches of different size.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the batchMult() functions reject batches of different size. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSizeMismatch()
+{
+   test_ = "Batched multiplication with non-matching batch sizes";
+
+   blaze::MatrixBatch<double,3UL,3UL> A( 4UL ), B( 5UL ), C;
+   blaze::VectorBatch<double,3UL> x( 5UL ), y;
+
+   try {
+      batchMult( C, A, B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix/matrix multiplication of non-matching batches succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      batchMult( y, A, x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix/vector multiplication of non-matching batches succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!rief Test of the batched inversion of singular matrices.
+//
+// 
+eturn void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the batchInvert() and batchSolve() functions detect a singular matrix
+// within a batch and that the batchSolve() function detects non-matching batch sizes. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSingular()
+{
+   typedef blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor>  MT;
+
+   test_ = "Batched inversion of singular matrices";
+
+   const MT singular{ { 1.0, 2.0, 3.0 }, { 2.0, 4.0, 6.0 }, { 1.0, 0.0, 1.0 } };
+
+   std::vector< MT, blaze::AlignedAllocator<MT> > mat( 11UL, MT( 0.0 ) );
+   for( size_t l=0UL; l<mat.size(); ++l ) {
+      mat[l](0,0) = mat[l](1,1) = mat[l](2,2) = 2.0;
+   }
+   mat[9UL] = singular;
+
+   blaze::MatrixBatch<double,3UL,3UL> A( mat.size() );
+   for( size_t l=0UL; l<mat.size(); ++l ) {
+      A.set( l, mat[l] );
+   }
+
+   blaze::VectorBatch<double,3UL> b( mat.size(), 1.0 ), x;
+
+   bool failed( false );
+   try {
+      batchInvert( A );
+   }
+   catch( std::runtime_error& ) {
+      failed = true;
+   }
+
+   if( !failed ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of a singular MatrixBatch succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   failed = false;
+   try {
+      batchInvert( mat.data(), mat.size() );
+   }
+   catch( std::runtime_error& ) {
+      failed = true;
+   }
+
+   if( !failed ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of a singular StaticMatrix array succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::VectorBatch<double,3UL> c( 4UL );
+      batchSolve( x, A, c );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with non-matching batches succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace batch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running batched matrix operation test..." << std::endl;
+
+   try
+   {
+      RUN_BATCH_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during batched matrix operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
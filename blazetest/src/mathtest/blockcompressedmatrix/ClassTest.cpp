@@ -0,0 +1,1256 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testAppend();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows         ( mat, 0UL );
+      checkColumns      ( mat, 0UL );
+      checkNonZeroBlocks( mat, 0UL );
+      checkLayout       ( mat );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (6x9)";
+
+      MT mat( 6UL, 9UL );
+
+      checkRows         ( mat, 6UL );
+      checkColumns      ( mat, 9UL );
+      checkNonZeroBlocks( mat, 0UL );
+      checkLayout       ( mat );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (6x9, 4 blocks)";
+
+      OMT mat( 6UL, 9UL, 4UL );
+
+      checkRows         ( mat, 6UL );
+      checkColumns      ( mat, 9UL );
+      checkCapacity     ( mat, 36UL );
+      checkNonZeroBlocks( mat, 0UL );
+      checkLayout       ( mat );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (invalid size)";
+
+      try {
+         MT mat( 5UL, 6UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (0x0)";
+
+      CMT ref;
+      MT mat( ref );
+
+      checkRows         ( mat, 0UL );
+      checkColumns      ( mat, 0UL );
+      checkNonZeroBlocks( mat, 0UL );
+      checkLayout       ( mat );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (row-major CompressedMatrix)";
+
+      CMT ref( 6UL, 9UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(2,1) = 3;
+      ref(0,7) = 4;
+      ref(2,8) = 5;
+      ref(4,4) = 6;
+      ref(5,3) = 7;
+
+      MT mat( ref );
+
+      checkRows         ( mat, 6UL );
+      checkColumns      ( mat, 9UL );
+      checkNonZeroBlocks( mat, 3UL );
+      checkNonZeros     ( mat, 0UL, 6UL );
+      checkNonZeros     ( mat, 2UL, 6UL );
+      checkNonZeros     ( mat, 3UL, 3UL );
+      checkNonZeros     ( mat, 5UL, 3UL );
+      checkLayout       ( mat );
+      checkResult       ( mat, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (column-major CompressedMatrix)";
+
+      OCMT ref( 6UL, 9UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(2,1) = 3;
+      ref(0,7) = 4;
+      ref(2,8) = 5;
+      ref(4,4) = 6;
+      ref(5,3) = 7;
+
+      OMT mat( ref );
+
+      checkRows         ( mat, 6UL );
+      checkColumns      ( mat, 9UL );
+      checkNonZeroBlocks( mat, 3UL );
+      checkNonZeros     ( mat, 0UL, 3UL );
+      checkNonZeros     ( mat, 4UL, 3UL );
+      checkNonZeros     ( mat, 8UL, 3UL );
+      checkLayout       ( mat );
+      checkResult       ( mat, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (DynamicMatrix)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( 6UL, 6UL, 0 );
+      ref(0,0) = 1;
+      ref(3,5) = 2;
+      ref(5,3) = 3;
+
+      MT mat( ref );
+
+      checkRows         ( mat, 6UL );
+      checkColumns      ( mat, 6UL );
+      checkNonZeroBlocks( mat, 2UL );
+      checkLayout       ( mat );
+      checkResult       ( mat, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (large random matrix)";
+
+      CMT ref( 48UL, 33UL );
+      randomize( ref, 150UL );
+
+      MT mat1( ref );
+
+      checkRows   ( mat1, 48UL );
+      checkColumns( mat1, 33UL );
+      checkLayout ( mat1 );
+      checkResult ( mat1, ref );
+
+      OMT mat2( ref );
+
+      checkRows   ( mat2, 48UL );
+      checkColumns( mat2, 33UL );
+      checkLayout ( mat2 );
+      checkResult ( mat2, ref );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy constructor";
+
+      CMT ref( 9UL, 6UL );
+      ref(0,4) = 1;
+      ref(4,1) = 2;
+      ref(8,5) = 3;
+
+      MT mat1( ref );
+      MT mat2( mat1 );
+
+      checkRows         ( mat2, 9UL );
+      checkColumns      ( mat2, 6UL );
+      checkNonZeroBlocks( mat2, 3UL );
+      checkLayout       ( mat2 );
+      checkResult       ( mat2, ref );
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix move constructor";
+
+      CMT ref( 9UL, 6UL );
+      ref(0,4) = 1;
+      ref(4,1) = 2;
+      ref(8,5) = 3;
+
+      MT mat1( ref );
+      MT mat2( std::move( mat1 ) );
+
+      checkRows         ( mat2, 9UL );
+      checkColumns      ( mat2, 6UL );
+      checkNonZeroBlocks( mat2, 3UL );
+      checkLayout       ( mat2 );
+      checkResult       ( mat2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy assignment";
+
+      CMT ref( 6UL, 3UL );
+      ref(0,0) = 1;
+      ref(4,2) = 2;
+
+      MT mat1( ref );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows         ( mat2, 6UL );
+      checkColumns      ( mat2, 3UL );
+      checkNonZeroBlocks( mat2, 2UL );
+      checkLayout       ( mat2 );
+      checkResult       ( mat2, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix copy assignment stress test";
+
+      MT mat1;
+
+      for( size_t i=0UL; i<20UL; ++i )
+      {
+         const size_t rows   ( 3UL*blaze::rand<size_t>( 0UL, 7UL ) );
+         const size_t columns( 3UL*blaze::rand<size_t>( 0UL, 7UL ) );
+
+         CMT ref( rows, columns );
+         randomize( ref, blaze::rand<size_t>( 0UL, rows*columns ) );
+
+         const MT mat2( ref );
+         mat1 = mat2;
+
+         checkLayout( mat1 );
+         checkResult( mat1, ref );
+      }
+   }
+
+
+   //=====================================================================================
+   // Move assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix move assignment";
+
+      CMT ref( 6UL, 3UL );
+      ref(0,0) = 1;
+      ref(4,2) = 2;
+
+      MT mat1( ref );
+      MT mat2( 3UL, 3UL );
+      mat2 = std::move( mat1 );
+
+      checkRows         ( mat2, 6UL );
+      checkColumns      ( mat2, 3UL );
+      checkNonZeroBlocks( mat2, 2UL );
+      checkLayout       ( mat2 );
+      checkResult       ( mat2, ref );
+   }
+
+
+   //=====================================================================================
+   // Matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix matrix assignment";
+
+      CMT ref( 9UL, 9UL );
+      randomize( ref, 30UL );
+
+      OMT mat( 3UL, 3UL );
+      mat = ref;
+
+      checkRows   ( mat, 9UL );
+      checkColumns( mat, 9UL );
+      checkLayout ( mat );
+      checkResult ( mat, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix matrix assignment (expression)";
+
+      CMT A( 6UL, 6UL );
+      randomize( A, 12UL );
+
+      const CMT ref( A * A );
+
+      MT mat;
+      mat = A * A;
+
+      checkLayout( mat );
+      checkResult( mat, ref );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix matrix assignment (invalid size)";
+
+      MT mat;
+
+      try {
+         mat = CMT( 4UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows   ( mat, 0UL );
+      checkColumns( mat, 0UL );
+      checkLayout ( mat );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "BlockCompressedMatrix::operator()";
+
+   CMT ref( 21UL, 15UL );
+   randomize( ref, 40UL );
+
+   const MT  mat1( ref );
+   const OMT mat2( ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j ) {
+         if( mat1(i,j) != ref(i,j) || mat2(i,j) != ref(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position                = (" << i << "," << j << ")\n"
+                << "   Result (row-major)      = " << mat1(i,j) << "\n"
+                << "   Result (column-major)   = " << mat2(i,j) << "\n"
+                << "   Expected value          = " << ref(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c at() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "BlockCompressedMatrix::at()";
+
+   CMT ref( 3UL, 6UL );
+   ref(0,1) = 1;
+   ref(2,5) = 2;
+
+   const MT mat( ref );
+
+   if( mat.at(0,1) != 1 || mat.at(2,5) != 2 || mat.at(1,1) != 0 || mat.at(1,4) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat.at(3,0);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      mat.at(0,6);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::Iterator       Iterator;
+   typedef MT::ConstIterator  ConstIterator;
+
+   CMT ref( 6UL, 9UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(2,1) = 3;
+   ref(0,7) = 4;
+   ref(2,8) = 5;
+   ref(4,4) = 6;
+   ref(5,3) = 7;
+
+   MT mat( ref );
+
+   // Counting the number of elements in each row via Iterator (end-begin)
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t expected[] = { 6UL, 6UL, 6UL, 3UL, 3UL, 3UL };
+
+      for( size_t i=0UL; i<mat.rows(); ++i )
+      {
+         const ptrdiff_t number( mat.end(i) - mat.begin(i) );
+
+         if( number != static_cast<ptrdiff_t>( expected[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Row                        : " << i << "\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: " << expected[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      for( size_t i=0UL; i<mat.rows(); ++i )
+      {
+         size_t last( 0UL );
+
+         for( ConstIterator it=mat.cbegin(i); it!=mat.cend(i); ++it )
+         {
+            if( ( it != mat.cbegin(i) && it->index() <= last ) || it->value() != ref(i,it->index()) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element detected\n"
+                   << " Details:\n"
+                   << "   Row            : " << i << "\n"
+                   << "   Found element  : (" << it->index() << "," << it->value() << ")\n"
+                   << "   Expected value : " << ref(i,it->index()) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            last = it->index();
+         }
+      }
+   }
+
+   // Testing the traversal of the second block row
+   {
+      test_ = "Traversal of a block row";
+
+      ConstIterator it( mat.cbegin(4) );
+
+      if( it == mat.cend(4) || it->index() != 3UL || it->value() != 0 ||
+          ++it == mat.cend(4) || it->index() != 4UL || it->value() != 6 ||
+          ++it == mat.cend(4) || it->index() != 5UL || it->value() != 0 ||
+          ++it != mat.cend(4) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid traversal of row 4\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing the conversion from Iterator to ConstIterator
+   {
+      test_ = "Iterator/ConstIterator conversion";
+
+      for( size_t i=0UL; i<mat.rows(); ++i )
+      {
+         ConstIterator it( mat.begin(i) );
+
+         if( it != mat.cbegin(i) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed iterator conversion detected\n"
+                << " Details:\n"
+                << "   Row: " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Testing the modification of the stored elements via Iterator
+   {
+      test_ = "Modification via Iterator";
+
+      for( Iterator it=mat.begin(3); it!=mat.end(3); ++it ) {
+         it->value() = 10;
+      }
+
+      ref(3,3) = 10;
+      ref(3,4) = 10;
+      ref(3,5) = 10;
+
+      checkNonZeroBlocks( mat, 3UL );
+      checkResult       ( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "BlockCompressedMatrix::nonZeros()";
+
+      CMT ref( 6UL, 9UL );
+      ref(0,1) = 1;
+      ref(0,2) = 2;
+      ref(5,8) = 3;
+
+      const MT mat( ref );
+
+      checkRows         ( mat, 6UL );
+      checkColumns      ( mat, 9UL );
+      checkCapacity     ( mat, 18UL );
+      checkNonZeros     ( mat, 18UL );
+      checkNonZeroBlocks( mat, 2UL );
+      checkNonZeros     ( mat, 0UL, 3UL );
+      checkNonZeros     ( mat, 4UL, 3UL );
+      checkCapacity     ( mat, 0UL, 3UL );
+      checkCapacity     ( mat, 4UL, 3UL );
+
+      if( mat.nonZeroBlocks(0UL) != 1UL || mat.nonZeroBlocks(1UL) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero blocks in a block row\n"
+             << " Details:\n"
+             << "   Blocks in block row 0: " << mat.nonZeroBlocks(0UL) << " (expected 1)\n"
+             << "   Blocks in block row 1: " << mat.nonZeroBlocks(1UL) << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix::nonZeros() (random matrix)";
+
+      CMT ref( 30UL, 18UL );
+      randomize( ref, 60UL );
+
+      const OMT mat( ref );
+
+      size_t blocks( 0UL );
+      for( size_t J=0UL; J<mat.blockColumns(); ++J ) {
+         checkNonZeros( mat, 3UL*J, 3UL*mat.nonZeroBlocks(J) );
+         blocks += mat.nonZeroBlocks(J);
+      }
+
+      checkNonZeroBlocks( mat, blocks );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   typedef MT::BlockType  BT;
+
+   {
+      test_ = "Row-major BlockCompressedMatrix::append()";
+
+      const BT A{ { 1, 0, 2 }, { 0, 3, 0 }, { 4, 0, 5 } };
+      const BT Z;
+
+      MT mat( 9UL, 6UL );
+      mat.reserve( 4UL );
+      mat.append( 0UL, 1UL, A );
+      mat.finalize( 0UL );
+      mat.append( 1UL, 0UL, Z, true );
+      mat.finalize( 1UL );
+      mat.append( 2UL, 0UL, A );
+      mat.append( 2UL, 1UL, 2*A );
+      mat.finalize( 2UL );
+
+      CMT ref( 9UL, 6UL );
+      for( size_t i=0UL; i<3UL; ++i ) {
+         for( size_t j=0UL; j<3UL; ++j ) {
+            if( A(i,j) != 0 ) {
+               ref(i    ,j+3UL) = A(i,j);
+               ref(i+6UL,j    ) = A(i,j);
+               ref(i+6UL,j+3UL) = 2*A(i,j);
+            }
+         }
+      }
+
+      checkRows         ( mat, 9UL );
+      checkColumns      ( mat, 6UL );
+      checkCapacity     ( mat, 36UL );
+      checkNonZeroBlocks( mat, 3UL );
+      checkNonZeros     ( mat, 3UL, 0UL );
+      checkNonZeros     ( mat, 7UL, 6UL );
+      checkLayout       ( mat );
+      checkResult       ( mat, ref );
+
+      if( mat.blockIndices()[mat.blockBegin(2UL)] != 0UL ||
+          mat.blockIndices()[mat.blockBegin(2UL)+1UL] != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block indices\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BlockCompressedMatrix::append()";
+
+      const BT A{ { 1, 2, 0 }, { 0, 0, 3 }, { 4, 0, 0 } };
+
+      OMT mat( 6UL, 6UL, 1UL );
+      mat.append( 1UL, 0UL, A );
+      mat.finalize( 0UL );
+
+      OCMT ref( 6UL, 6UL );
+      ref(3,0) = 1; ref(3,1) = 2; ref(4,2) = 3; ref(5,0) = 4;
+
+      checkNonZeroBlocks( mat, 1UL );
+      checkResult       ( mat, ref );
+
+      mat.reserve( 3UL );
+
+      checkCapacity     ( mat, 27UL );
+      checkNonZeroBlocks( mat, 1UL );
+      checkResult       ( mat, ref );
+
+      mat.append( 0UL, 1UL, A );
+      mat.append( 1UL, 1UL, A );
+      mat.finalize( 1UL );
+
+      ref(0,3) = 1; ref(0,4) = 2; ref(1,5) = 3; ref(2,3) = 4;
+      ref(3,3) = 1; ref(3,4) = 2; ref(4,5) = 3; ref(5,3) = 4;
+
+      checkNonZeroBlocks( mat, 3UL );
+      checkNonZeros     ( mat, 0UL, 3UL );
+      checkNonZeros     ( mat, 5UL, 6UL );
+      checkLayout       ( mat );
+      checkResult       ( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "BlockCompressedMatrix::reset()";
+
+   CMT ref( 6UL, 9UL );
+   randomize( ref, 12UL );
+
+   MT mat( ref );
+   reset( mat );
+
+   checkRows         ( mat, 6UL );
+   checkColumns      ( mat, 9UL );
+   checkNonZeroBlocks( mat, 0UL );
+   checkLayout       ( mat );
+   checkResult       ( mat, CMT( 6UL, 9UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "BlockCompressedMatrix::clear()";
+
+   CMT ref( 6UL, 9UL );
+   randomize( ref, 12UL );
+
+   OMT mat( ref );
+   clear( mat );
+
+   checkRows         ( mat, 0UL );
+   checkColumns      ( mat, 0UL );
+   checkNonZeroBlocks( mat, 0UL );
+   checkLayout       ( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BlockCompressedMatrix swap";
+
+   CMT ref1( 3UL, 6UL );
+   ref1(0,1) = 1;
+   ref1(2,5) = 2;
+
+   CMT ref2( 9UL, 3UL );
+   ref2(1,2) = 3;
+   ref2(8,0) = 4;
+
+   MT mat1( ref1 );
+   MT mat2( ref2 );
+
+   swap( mat1, mat2 );
+
+   checkRows         ( mat1, 9UL );
+   checkColumns      ( mat1, 3UL );
+   checkNonZeroBlocks( mat1, 2UL );
+   checkLayout       ( mat1 );
+   checkResult       ( mat1, ref2 );
+
+   checkRows         ( mat2, 3UL );
+   checkColumns      ( mat2, 6UL );
+   checkNonZeroBlocks( mat2, 2UL );
+   checkLayout       ( mat2 );
+   checkResult       ( mat2, ref1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "BlockCompressedMatrix::find()";
+
+   CMT ref( 24UL, 15UL );
+   randomize( ref, 30UL );
+
+   const MT  mat1( ref );
+   const OMT mat2( ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const MT::ConstIterator  pos1( mat1.find( i, j ) );
+         const OMT::ConstIterator pos2( mat2.find( i, j ) );
+
+         const bool stored( mat1.blockIndices() != nullptr &&
+                            std::find( mat1.blockIndices() + mat1.blockBegin(i/3UL),
+                                       mat1.blockIndices() + mat1.blockEnd(i/3UL), j/3UL )
+                               != mat1.blockIndices() + mat1.blockEnd(i/3UL) );
+
+         if( ( pos1 != mat1.end(i) ) != stored || ( pos2 != mat2.end(j) ) != stored ||
+             ( stored && ( pos1->index() != j || pos1->value() != ref(i,j) ||
+                           pos2->index() != i || pos2->value() != ref(i,j) ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong result of the element search\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "BlockCompressedMatrix::lowerBound()";
+
+   CMT ref( 24UL, 15UL );
+   randomize( ref, 30UL );
+
+   const MT  mat1( ref );
+   const OMT mat2( ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         MT::ConstIterator  ref1( mat1.begin(i) );
+         OMT::ConstIterator ref2( mat2.begin(j) );
+         while( ref1 != mat1.end(i) && ref1->index() < j ) ++ref1;
+         while( ref2 != mat2.end(j) && ref2->index() < i ) ++ref2;
+
+         if( mat1.lowerBound( i, j ) != ref1 || mat2.lowerBound( i, j ) != ref2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong lower bound detected\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "BlockCompressedMatrix::upperBound()";
+
+   CMT ref( 24UL, 15UL );
+   randomize( ref, 30UL );
+
+   const MT  mat1( ref );
+   const OMT mat2( ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         MT::ConstIterator  ref1( mat1.begin(i) );
+         OMT::ConstIterator ref2( mat2.begin(j) );
+         while( ref1 != mat1.end(i) && ref1->index() <= j ) ++ref1;
+         while( ref2 != mat2.end(j) && ref2->index() <= i ) ++ref2;
+
+         if( mat1.upperBound( i, j ) != ref1 || mat2.upperBound( i, j ) != ref2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong upper bound detected\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with default matrix
+   {
+      const MT mat( 3UL, 6UL );
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-default matrix
+   {
+      CMT ref( 3UL, 6UL );
+      ref(1,2) = 1;
+
+      const MT mat( ref );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix/dense vector and dense matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dedicated block kernels for the multiplication of a
+// BlockCompressedMatrix with a dense vector and a dense matrix. The results are compared to
+// the results of the corresponding CompressedMatrix operations. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::BlockCompressedMatrix<double,3UL,blaze::rowMajor>     BMT;
+   typedef blaze::BlockCompressedMatrix<double,3UL,blaze::columnMajor>  OBMT;
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>              RMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>             CVT;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>                 DMT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>              ODMT;
+
+   const size_t sizes[] = { 0UL, 3UL, 9UL, 33UL, 99UL };
+
+   for( size_t m : sizes ) {
+      for( size_t n : sizes )
+      {
+         RMT ref( m, n );
+         randomize( ref, ( m*n ) / 6UL );
+         for( size_t i=0UL; i<m; ++i ) {
+            for( RMT::Iterator element=ref.begin(i); element!=ref.end(i); ++element )
+               element->value() = blaze::rand<int>( -10, 10 );
+         }
+
+         const BMT  mat1( ref );
+         const OBMT mat2( ref );
+
+         CVT x( n );
+         for( size_t j=0UL; j<n; ++j ) x[j] = blaze::rand<int>( -10, 10 );
+
+         DMT X( n, 5UL );
+         for( size_t j=0UL; j<n; ++j ) {
+            for( size_t k=0UL; k<5UL; ++k ) X(j,k) = blaze::rand<int>( -10, 10 );
+         }
+
+         // Row-major matrix/dense vector multiplication
+         {
+            test_ = "Row-major BlockCompressedMatrix/dense vector multiplication";
+
+            CVT y( mat1 * x );
+            checkResult( y, CVT( ref * x ) );
+
+            y += mat1 * x;
+            checkResult( y, CVT( 2.0 * ( ref * x ) ) );
+
+            y -= mat1 * x;
+            checkResult( y, CVT( ref * x ) );
+
+            y = 2.0 * ( mat1 * ( x + x ) );
+            checkResult( y, CVT( 2.0 * ( ref * ( x + x ) ) ) );
+         }
+
+         // Column-major matrix/dense vector multiplication
+         {
+            test_ = "Column-major BlockCompressedMatrix/dense vector multiplication";
+
+            CVT y( mat2 * x );
+            checkResult( y, CVT( ref * x ) );
+
+            y += mat2 * x;
+            checkResult( y, CVT( 2.0 * ( ref * x ) ) );
+
+            y -= mat2 * x;
+            checkResult( y, CVT( ref * x ) );
+
+            if( n > 0UL ) {
+               CVT z( n+1UL, 0.0 );
+               subvector( z, 1UL, n ) = x;
+               y = mat2 * subvector( z, 1UL, n );
+               checkResult( y, CVT( ref * x ) );
+            }
+         }
+
+         // Matrix/dense matrix multiplication
+         {
+            test_ = "BlockCompressedMatrix/dense matrix multiplication";
+
+            DMT Y( mat1 * X );
+            checkResult( Y, DMT( ref * X ) );
+
+            Y += mat1 * X;
+            checkResult( Y, DMT( 2.0 * ( ref * X ) ) );
+
+            Y -= mat1 * X;
+            checkResult( Y, DMT( ref * X ) );
+
+            ODMT Z( mat1 * X );
+            checkResult( Z, DMT( ref * X ) );
+
+            Z = mat2 * X;
+            checkResult( Z, DMT( ref * X ) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
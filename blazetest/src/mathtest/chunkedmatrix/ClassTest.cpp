@@ -0,0 +1,424 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/chunkedmatrix/ClassTest.cpp
+//  \brief Source file for the ChunkedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/ChunkedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/chunkedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace chunkedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ChunkedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_    ()
+   , filename_( "chunkedmatrix.blzm" )
+{
+   testPanels();
+   testMult();
+   testTransMult();
+   testGram();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the ChunkedMatrix class test.
+//
+// The destructor removes the temporary file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the panels of a chunked matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function binds a chunked matrix to a file and checks the panels of the matrix for
+// several different panel sizes. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testPanels()
+{
+   test_ = "Panels";
+
+   blaze::DynamicMatrix<int> src( 37UL, 13UL );
+   randomize( src, -10, 10 );
+   blaze::saveMapped( filename_, src );
+
+   blaze::ChunkedMatrix<int> A;
+   blaze::loadMapped( filename_, A );
+
+   if( A.rows() != 37UL || A.columns() != 13UL || A.panels() != 1UL || A.panelRows() < 37UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n"
+          << " Details:\n"
+          << "   Number of rows       : " << A.rows() << " (expected 37)\n"
+          << "   Number of columns    : " << A.columns() << " (expected 13)\n"
+          << "   Number of panels     : " << A.panels() << " (expected 1)\n"
+          << "   Number of panel rows : " << A.panelRows() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t rows=1UL; rows<=40UL; ++rows )
+   {
+      A.setPanelRows( rows );
+
+      const size_t panels( ( 37UL + rows - 1UL ) / rows );
+
+      if( A.panels() != panels ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of panels detected\n"
+             << " Details:\n"
+             << "   Number of panel rows : " << rows << "\n"
+             << "   Number of panels     : " << A.panels() << "\n"
+             << "   Expected panels      : " << panels << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      size_t next( 0UL );
+
+      A.stream( [&]( size_t row, const blaze::ChunkedMatrix<int>::PanelType& P ) {
+         if( row != next ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid panel row detected\n"
+                << " Details:\n"
+                << "   Number of panel rows : " << rows << "\n"
+                << "   Panel row            : " << row << "\n"
+                << "   Expected panel row   : " << next << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         compareMatrices( submatrix( src, row, 0UL, P.rows(), src.columns() ), P );
+         next += P.rows();
+      } );
+
+      if( next != src.rows() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incomplete stream of panels detected\n"
+             << " Details:\n"
+             << "   Number of panel rows : " << rows << "\n"
+             << "   Streamed rows        : " << next << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      compareMatrices( submatrix( src, 0UL, 0UL, A.panel( 0UL ).rows(), src.columns() ), A.panel( 0UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the out-of-core matrix/vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the chunkedMult() function for several different panel sizes. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   test_ = "Out-of-core matrix/vector multiplication";
+
+   blaze::DynamicMatrix<int> src( 53UL, 21UL );
+   randomize( src, -10, 10 );
+   blaze::saveMapped( filename_, src );
+
+   blaze::ChunkedMatrix<int> A;
+   blaze::loadMapped( filename_, A );
+
+   blaze::DynamicVector<int> x( 21UL );
+   randomize( x, -10, 10 );
+
+   const blaze::DynamicVector<int> ref( src * x );
+
+   for( size_t rows : { 0UL, 1UL, 8UL, 52UL, 53UL, 100UL } )
+   {
+      A.setPanelRows( rows );
+
+      blaze::DynamicVector<int> y( 3UL );
+      chunkedMult( y, A, x );
+      compareVectors( ref, y );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the out-of-core transpose matrix/vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the chunkedTransMult() function for several different panel sizes. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTransMult()
+{
+   test_ = "Out-of-core transpose matrix/vector multiplication";
+
+   blaze::DynamicMatrix<int> src( 53UL, 21UL );
+   randomize( src, -10, 10 );
+   blaze::saveMapped( filename_, src );
+
+   blaze::ChunkedMatrix<int> A;
+   blaze::loadMapped( filename_, A );
+
+   blaze::DynamicVector<int> x( 53UL );
+   randomize( x, -10, 10 );
+
+   const blaze::DynamicVector<int> ref( trans( src ) * x );
+
+   for( size_t rows : { 0UL, 1UL, 8UL, 52UL, 53UL, 100UL } )
+   {
+      A.setPanelRows( rows );
+
+      blaze::DynamicVector<int> y( 3UL, 7 );
+      chunkedTransMult( y, A, x );
+      compareVectors( ref, y );
+
+      blaze::StaticVector<int,21UL> z( 7 );
+      chunkedTransMult( z, A, x );
+      compareVectors( ref, z );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the out-of-core computation of the Gram matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the chunkedGram() function for several different panel sizes and both
+// storage orders of the target matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testGram()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Out-of-core Gram matrix";
+
+   blaze::DynamicMatrix<int> src( 53UL, 21UL );
+   randomize( src, -10, 10 );
+   blaze::saveMapped( filename_, src );
+
+   blaze::ChunkedMatrix<int> A;
+   blaze::loadMapped( filename_, A );
+
+   const blaze::DynamicMatrix<int> ref( trans( src ) * src );
+
+   for( size_t rows : { 0UL, 1UL, 8UL, 52UL, 53UL, 100UL } )
+   {
+      A.setPanelRows( rows );
+
+      blaze::DynamicMatrix<int,rowMajor> G( 2UL, 3UL, 7 );
+      chunkedGram( G, A );
+      compareMatrices( ref, G );
+
+      blaze::DynamicMatrix<int,columnMajor> H( 2UL, 3UL, 7 );
+      chunkedGram( H, A );
+      compareMatrices( ref, H );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the failure handling of chunked matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that invalid files and invalid operand sizes are rejected. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   using blaze::columnMajor;
+
+   test_ = "Chunked matrix failures";
+
+   try {
+      blaze::DynamicMatrix<int,columnMajor> src( 5UL, 4UL );
+      randomize( src );
+      blaze::saveMapped( filename_, src );
+
+      blaze::ChunkedMatrix<int> A;
+      blaze::loadMapped( filename_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of column-major matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   blaze::DynamicMatrix<int> src( 5UL, 4UL );
+   randomize( src );
+   blaze::saveMapped( filename_, src );
+
+   try {
+      blaze::ChunkedMatrix<double> A;
+      blaze::loadMapped( filename_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   blaze::ChunkedMatrix<int> A;
+   blaze::loadMapped( filename_, A );
+
+   try {
+      blaze::DynamicVector<int> x( 5UL ), y;
+      chunkedMult( y, A, x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with invalid vector size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::DynamicVector<int> x( 4UL ), y;
+      chunkedTransMult( y, A, x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Transpose multiplication with invalid vector size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      A.panel( A.panels() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access to invalid panel succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace chunkedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ChunkedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_CHUNKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ChunkedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
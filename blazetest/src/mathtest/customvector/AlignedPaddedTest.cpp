@@ -521,7 +521,7 @@ void AlignedPaddedTest::testAssignment()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,aligned,padded,rowVector>  AlignedPadded;
-      AlignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      AlignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] = 1;
       vec1[1] = 2;
       vec1[2] = 3;
@@ -669,7 +669,7 @@ void AlignedPaddedTest::testAddAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,aligned,padded,rowVector>  AlignedPadded;
-      AlignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      AlignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] =  1;
       vec1[1] =  0;
       vec1[2] = -2;
@@ -841,7 +841,7 @@ void AlignedPaddedTest::testSubAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,aligned,padded,rowVector>  AlignedPadded;
-      AlignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      AlignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] = -1;
       vec1[1] =  0;
       vec1[2] =  2;
@@ -1013,7 +1013,7 @@ void AlignedPaddedTest::testMultAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,aligned,padded,rowVector>  AlignedPadded;
-      AlignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      AlignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] =  1;
       vec1[1] =  0;
       vec1[2] = -2;
@@ -1185,7 +1185,7 @@ void AlignedPaddedTest::testDivAssign()
       using blaze::rowVector;
 
       typedef blaze::CustomVector<short,aligned,padded,rowVector>  AlignedPadded;
-      AlignedPadded vec1( blaze::allocate<short>( 16UL ), 5UL, 16UL, blaze::Deallocate() );
+      AlignedPadded vec1( blaze::allocate<short>( 32UL ), 5UL, 32UL, blaze::Deallocate() );
       vec1[0] =  1;
       vec1[1] =  2;
       vec1[2] = -3;
@@ -0,0 +1,119 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/decomposition/DenseBlockedTest.cpp
+//  \brief Source file for the native blocked dense matrix decomposition test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blazetest/mathtest/decomposition/DenseBlockedTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseBlockedTest test.
+//
+// \exception std::runtime_error Error during the blocked decompositions detected.
+*/
+DenseBlockedTest::DenseBlockedTest()
+{
+   testLU< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testLU< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+   testLU< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testLU< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+
+   testLLH< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testLLH< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+   testLLH< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testLLH< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+
+   testQR< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testQR< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+   testQR< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testQR< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+
+   testTrtri< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testTrtri< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+   testTrtri< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testTrtri< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+}
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running native blocked dense matrix decomposition test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_BLOCKED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during native blocked dense matrix decomposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,122 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/decomposition/DenseSolveTest.cpp
+//  \brief Source file for the dense linear system solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blazetest/mathtest/decomposition/DenseSolveTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace decomposition {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseSolveTest test.
+//
+// \exception std::runtime_error Error during the solution of the linear systems detected.
+*/
+DenseSolveTest::DenseSolveTest()
+{
+   testGeneral< blaze::DynamicMatrix<float,blaze::rowMajor> >();
+   testGeneral< blaze::DynamicMatrix<float,blaze::columnMajor> >();
+   testGeneral< blaze::DynamicMatrix<double,blaze::rowMajor> >();
+   testGeneral< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+   testGeneral< blaze::DynamicMatrix<cdouble,blaze::rowMajor> >();
+   testGeneral< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+
+   testTriangular< blaze::DynamicMatrix<double,blaze::rowMajor> >();
+   testTriangular< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+   testTriangular< blaze::DynamicMatrix<cdouble,blaze::rowMajor> >();
+   testTriangular< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+
+   testSymmetric< blaze::DynamicMatrix<double,blaze::rowMajor> >();
+   testSymmetric< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+   testSymmetric< blaze::DynamicMatrix<cdouble,blaze::rowMajor> >();
+   testSymmetric< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+
+   testHermitian< blaze::DynamicMatrix<cdouble,blaze::rowMajor> >();
+   testHermitian< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+
+   testStatic();
+   testSingular();
+}
+//*************************************************************************************************
+
+} // namespace decomposition
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense linear system solver test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_SOLVE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense linear system solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,8 +37,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blazetest/mathtest/densematrix/GeneralTest.h>
@@ -78,6 +80,10 @@ GeneralTest::GeneralTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testReduce();
+   testArgmin();
+   testArgmax();
+   testFrobeniusNorm();
 }
 //*************************************************************************************************
 
@@ -4553,6 +4559,466 @@ void GeneralTest::testMaximum()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c reduce(), \c sum(), and \c prod() functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce(), \c sum(), and \c prod() functions for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major reduce(), sum(), and prod()";
+
+      // Summation and multiplication of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(0,2) =  3;
+         mat(1,0) = -4;
+         mat(1,1) =  5;
+         mat(1,2) = -6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int totalsum = sum( mat );
+
+         if( totalsum != -3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Summation failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: -3\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const int totalprod = prod( mat );
+
+         if( totalprod != -720 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Result: " << totalprod << "\n"
+                << "   Expected result: -720\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Reduction of a large matrix expression
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> A( 37UL, 53UL ), B( 37UL, 53UL, 1.0 );
+
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               A(i,j) = static_cast<double>( i + j );
+            }
+         }
+
+         const double totalsum = sum( A + B );
+
+         if( totalsum != 88245.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Summation of a matrix expression failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: 88245\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const double custom = reduce( A + B, []( double x, double y ){ return x + y; } );
+
+         if( custom != 88245.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Custom reduction of a matrix expression failed\n"
+                << " Details:\n"
+                << "   Result: " << custom << "\n"
+                << "   Expected result: 88245\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const double minimum = reduce( A - B, blaze::Minimum() );
+
+         if( minimum != -1.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Minimum reduction of a matrix expression failed\n"
+                << " Details:\n"
+                << "   Result: " << minimum << "\n"
+                << "   Expected result: -1\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major reduce(), sum(), and prod()";
+
+      // Summation and multiplication of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(0,2) =  3;
+         mat(1,0) = -4;
+         mat(1,1) =  5;
+         mat(1,2) = -6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int totalsum = sum( mat );
+
+         if( totalsum != -3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Summation failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: -3\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const int totalprod = prod( mat );
+
+         if( totalprod != -720 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Result: " << totalprod << "\n"
+                << "   Expected result: -720\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Reduction of a large matrix expression
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> A( 37UL, 53UL ), B( 37UL, 53UL, 1.0 );
+
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               A(i,j) = static_cast<double>( i + j );
+            }
+         }
+
+         const double totalsum = sum( A + B );
+
+         if( totalsum != 88245.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Summation of a matrix expression failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: 88245\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const double custom = reduce( A + B, []( double x, double y ){ return x + y; } );
+
+         if( custom != 88245.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Custom reduction of a matrix expression failed\n"
+                << " Details:\n"
+                << "   Result: " << custom << "\n"
+                << "   Expected result: 88245\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const double minimum = reduce( A - B, blaze::Minimum() );
+
+         if( minimum != -1.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Minimum reduction of a matrix expression failed\n"
+                << " Details:\n"
+                << "   Result: " << minimum << "\n"
+                << "   Expected result: -1\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmin() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c argmin() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testArgmin()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major argmin()";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 0 );
+      mat(0,0) =  1;
+      mat(0,1) = -4;
+      mat(0,2) =  3;
+      mat(1,0) = -4;
+      mat(1,1) =  5;
+      mat(1,2) =  6;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+
+      const std::pair<size_t,size_t> index = argmin( mat );
+
+      if( index.first != 0UL || index.second != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Computation failed\n"
+             << " Details:\n"
+             << "   Result: (" << index.first << "," << index.second << ")\n"
+             << "   Expected result: (0,1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major argmin()";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 0 );
+      mat(0,0) =  1;
+      mat(0,1) = -4;
+      mat(0,2) =  3;
+      mat(1,0) = -4;
+      mat(1,1) =  5;
+      mat(1,2) =  6;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+
+      const std::pair<size_t,size_t> index = argmin( mat );
+
+      if( index.first != 1UL || index.second != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Computation failed\n"
+             << " Details:\n"
+             << "   Result: (" << index.first << "," << index.second << ")\n"
+             << "   Expected result: (1,0)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmax() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c argmax() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testArgmax()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major argmax()";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 0 );
+      mat(0,0) =  1;
+      mat(0,1) =  6;
+      mat(0,2) =  3;
+      mat(1,0) =  6;
+      mat(1,1) =  5;
+      mat(1,2) = -6;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+
+      const std::pair<size_t,size_t> index = argmax( mat );
+
+      if( index.first != 0UL || index.second != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Computation failed\n"
+             << " Details:\n"
+             << "   Result: (" << index.first << "," << index.second << ")\n"
+             << "   Expected result: (0,1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major argmax()";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 0 );
+      mat(0,0) =  1;
+      mat(0,1) =  6;
+      mat(0,2) =  3;
+      mat(1,0) =  6;
+      mat(1,1) =  5;
+      mat(1,2) = -6;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+
+      const std::pair<size_t,size_t> index = argmax( mat );
+
+      if( index.first != 1UL || index.second != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Computation failed\n"
+             << " Details:\n"
+             << "   Result: (" << index.first << "," << index.second << ")\n"
+             << "   Expected result: (1,0)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the \c frobeniusNorm() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c frobeniusNorm() function for dense matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testFrobeniusNorm()
+{
+   test_ = "frobeniusNorm() function";
+
+   {
+      // Frobenius norm of an empty matrix
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat;
+
+      const double norm = frobeniusNorm( mat );
+
+      if( !blaze::isDefault( norm ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Frobenius norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Frobenius norm of a row-major matrix
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, 0 );
+      mat(0,1) =  1;
+      mat(1,0) = -3;
+      mat(1,3) =  1;
+      mat(2,2) =  5;
+
+      const double norm = frobeniusNorm( mat );
+
+      if( !blaze::equal( norm, 6.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Frobenius norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << "\n"
+             << "   Expected result: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Frobenius norm of a column-major matrix
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 3UL, 4UL, 0 );
+      mat(0,1) =  1;
+      mat(1,0) = -3;
+      mat(1,3) =  1;
+      mat(2,2) =  5;
+
+      const double norm = frobeniusNorm( mat );
+
+      if( !blaze::equal( norm, 6.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Frobenius norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << "\n"
+             << "   Expected result: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Frobenius norm of a matrix expression
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 37UL, 53UL );
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( 37UL, 53UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = static_cast<double>( i + j ) + 2.0;
+            B(i,j) = static_cast<double>( i + j );
+         }
+      }
+
+      const double norm = frobeniusNorm( A - B );
+
+      if( !blaze::equal( norm, std::sqrt( 7844.0 ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Frobenius norm computation of a matrix expression failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << "\n"
+             << "   Expected result: 88.5664\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace densematrix
 
 } // namespace mathtest
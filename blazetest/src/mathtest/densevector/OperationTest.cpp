@@ -37,6 +37,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/dense/DenseVector.h>
@@ -69,6 +70,10 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testReduce();
+   testArgmin();
+   testArgmax();
+   testNorms();
 }
 //*************************************************************************************************
 
@@ -564,6 +569,390 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c reduce(), \c sum(), and \c prod() functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce(), \c sum(), and \c prod() functions for dense
+// vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReduce()
+{
+   test_ = "reduce(), sum(), and prod() functions";
+
+   {
+      // Reduction of an empty vector
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const int totalsum = sum( vec );
+
+      if( totalsum != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation of an empty vector failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Summation and multiplication of a small vector
+      blaze::DynamicVector<int,blaze::rowVector> vec( 5UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+      vec[4] =  5;
+
+      const int totalsum = sum( vec );
+
+      if( totalsum != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const int totalprod = prod( vec );
+
+      if( totalprod != 120 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result: " << totalprod << "\n"
+             << "   Expected result: 120\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Reduction of a large vector expression
+      blaze::DynamicVector<double,blaze::columnVector> a( 1023UL ), b( 1023UL );
+
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = static_cast<double>( i );
+         b[i] = 1.0;
+      }
+
+      const double totalsum = sum( a + b );
+
+      if( totalsum != 523776.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation of a vector expression failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: 523776\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double custom = reduce( a + b, []( double x, double y ){ return x + y; } );
+
+      if( custom != 523776.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Custom reduction of a vector expression failed\n"
+             << " Details:\n"
+             << "   Result: " << custom << "\n"
+             << "   Expected result: 523776\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double maximum = reduce( a - b, blaze::Maximum() );
+
+      if( maximum != 1021.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Maximum reduction of a vector expression failed\n"
+             << " Details:\n"
+             << "   Result: " << maximum << "\n"
+             << "   Expected result: 1021\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmin() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c argmin() function for dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testArgmin()
+{
+   test_ = "argmin() function";
+
+   {
+      // Index of the smallest element of an empty vector
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const size_t index = argmin( vec );
+
+      if( index != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << index << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Index of the smallest element of a vector with duplicate minima
+      blaze::DynamicVector<int,blaze::rowVector> vec( 5UL );
+      vec[0] =  1;
+      vec[1] = -4;
+      vec[2] =  3;
+      vec[3] = -4;
+      vec[4] =  5;
+
+      const size_t index = argmin( vec );
+
+      if( index != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << index << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmax() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c argmax() function for dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testArgmax()
+{
+   test_ = "argmax() function";
+
+   {
+      // Index of the largest element of an empty vector
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const size_t index = argmax( vec );
+
+      if( index != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << index << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Index of the largest element of a vector with duplicate maxima
+      blaze::DynamicVector<int,blaze::rowVector> vec( 5UL );
+      vec[0] =  1;
+      vec[1] =  5;
+      vec[2] =  3;
+      vec[3] = -4;
+      vec[4] =  5;
+
+      const size_t index = argmax( vec );
+
+      if( index != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << index << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the norm functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c l1Norm(), \c l2Norm(), \c linfNorm(), and \c lpNorm()
+// functions for dense vectors. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testNorms()
+{
+   test_ = "l1Norm(), l2Norm(), linfNorm(), and lpNorm() functions";
+
+   {
+      // Norms of an empty vector
+      blaze::DynamicVector<double,blaze::rowVector> vec;
+
+      const double l1 = l1Norm( vec );
+
+      if( !blaze::isDefault( l1 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L1 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l1 << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double l2 = l2Norm( vec );
+
+      if( !blaze::isDefault( l2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L2 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l2 << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double linf = linfNorm( vec );
+
+      if( !blaze::isDefault( linf ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infinity norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << linf << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Norms of a small vector
+      blaze::DynamicVector<int,blaze::rowVector> vec( 5UL );
+      vec[0] =  0;
+      vec[1] =  3;
+      vec[2] =  0;
+      vec[3] = -4;
+      vec[4] =  0;
+
+      const int l1 = l1Norm( vec );
+
+      if( l1 != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L1 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l1 << "\n"
+             << "   Expected result: 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double l2 = l2Norm( vec );
+
+      if( !blaze::equal( l2, 5.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L2 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l2 << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const int linf = linfNorm( vec );
+
+      if( linf != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infinity norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << linf << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double lp = blaze::lpNorm<3>( vec );
+
+      if( !blaze::equal( lp, std::cbrt( 91.0 ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lp norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << lp << "\n"
+             << "   Expected result: 4.4979\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const int l1p = blaze::lpNorm<1>( vec );
+
+      if( l1p != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lp norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l1p << "\n"
+             << "   Expected result: 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // L2 norm of a large vector expression
+      blaze::DynamicVector<double,blaze::columnVector> a( 1024UL ), b( 1024UL );
+
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = static_cast<double>( i ) + 1.0;
+         b[i] = static_cast<double>( i );
+      }
+
+      const double l2 = l2Norm( a - b );
+
+      if( !blaze::equal( l2, 32.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L2 norm computation of a vector expression failed\n"
+             << " Details:\n"
+             << "   Result: " << l2 << "\n"
+             << "   Expected result: 32\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double linf = linfNorm( b - a );
+
+      if( !blaze::equal( linf, 1.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infinity norm computation of a vector expression failed\n"
+             << " Details:\n"
+             << "   Result: " << linf << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace densevector
 
 } // namespace mathtest
@@ -86,6 +86,9 @@ int main()
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 32UL, 32UL ), CMDb(  32UL, 32UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 16UL ) );
       RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 64UL, 32UL ), CMDb(  32UL, 64UL ) );
+
+      // Running tests with matrices above the threshold of the packed kernel
+      RUN_DMATDMATMULT_OPERATION_TEST( CMDb( 101UL, 103UL ), CMDb( 103UL, 107UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during dense matrix/dense matrix multiplication:\n"
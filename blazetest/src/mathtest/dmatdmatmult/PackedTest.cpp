@@ -0,0 +1,284 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dmatdmatmult/PackedTest.cpp
+//  \brief Source file for the packed dense matrix/dense matrix multiplication test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dmatdmatmult/PackedTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the packed multiplication test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+PackedTest::PackedTest()
+{
+   testDMatDMatMult  ();
+   testDMatTDMatMult ();
+   testTDMatDMatMult ();
+   testTDMatTDMatMult();
+   testLowerMult     ();
+   testUpperMult     ();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the packed row-major dense matrix/row-major dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PackedTest::testDMatDMatMult()
+{
+   test_ = "Packed DMatDMatMult";
+
+   DMat A( 101UL, 103UL );
+   DMat B( 103UL, 107UL );
+   initialize( A, 1UL );
+   initialize( B, 2UL );
+
+   testMultiplication( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed row-major dense matrix/column-major dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PackedTest::testDMatTDMatMult()
+{
+   test_ = "Packed DMatTDMatMult";
+
+   DMat  A( 101UL, 103UL );
+   TDMat B( 103UL, 107UL );
+   initialize( A, 1UL );
+   initialize( B, 2UL );
+
+   testMultiplication( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed column-major dense matrix/row-major dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PackedTest::testTDMatDMatMult()
+{
+   test_ = "Packed TDMatDMatMult";
+
+   TDMat A( 101UL, 103UL );
+   DMat  B( 103UL, 107UL );
+   initialize( A, 1UL );
+   initialize( B, 2UL );
+
+   testMultiplication( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed column-major dense matrix/column-major dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void PackedTest::testTDMatTDMatMult()
+{
+   test_ = "Packed TDMatTDMatMult";
+
+   TDMat A( 101UL, 103UL );
+   TDMat B( 103UL, 107UL );
+   initialize( A, 1UL );
+   initialize( B, 2UL );
+
+   testMultiplication( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed dense matrix multiplication with lower triangular operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the triangular kernel of the packed dense matrix multiplication with
+// lower triangular operands on the left-hand side, on the right-hand side, and on both sides.
+// The triangular operands span several blocks of the triangular kernel.
+*/
+void PackedTest::testLowerMult()
+{
+   const size_t n( 301UL );
+
+   LDMat  L1( n );
+   LTDMat L2( n );
+   DMat   A ( n, 107UL );
+   TDMat  B ( 103UL, n );
+   initialize( L1, 1UL );
+   initialize( L2, 3UL );
+   initialize( A , 2UL );
+   initialize( B , 4UL );
+
+   test_ = "Packed lower DMatDMatMult (left-hand side)";
+   testMultiplication( L1, A );
+
+   test_ = "Packed lower TDMatDMatMult (left-hand side)";
+   testMultiplication( L2, A );
+
+   test_ = "Packed lower TDMatDMatMult (right-hand side)";
+   testMultiplication( B, L1 );
+
+   test_ = "Packed lower TDMatTDMatMult (right-hand side)";
+   testMultiplication( B, L2 );
+
+   test_ = "Packed lower DMatTDMatMult (both sides)";
+   testMultiplication( L1, L2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed dense matrix multiplication with upper triangular operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the triangular kernel of the packed dense matrix multiplication with
+// upper triangular operands on the left-hand side, on the right-hand side, and on both sides.
+// The triangular operands span several blocks of the triangular kernel.
+*/
+void PackedTest::testUpperMult()
+{
+   const size_t n( 301UL );
+
+   UDMat  U1( n );
+   UTDMat U2( n );
+   TDMat  A ( n, 107UL );
+   DMat   B ( 103UL, n );
+   initialize( U1, 1UL );
+   initialize( U2, 3UL );
+   initialize( A , 2UL );
+   initialize( B , 4UL );
+
+   test_ = "Packed upper DMatTDMatMult (left-hand side)";
+   testMultiplication( U1, A );
+
+   test_ = "Packed upper TDMatTDMatMult (left-hand side)";
+   testMultiplication( U2, A );
+
+   test_ = "Packed upper DMatDMatMult (right-hand side)";
+   testMultiplication( B, U1 );
+
+   test_ = "Packed upper DMatTDMatMult (right-hand side)";
+   testMultiplication( B, U2 );
+
+   test_ = "Packed upper TDMatDMatMult (both sides)";
+   testMultiplication( U2, U1 );
+
+   test_ = "Packed lower/upper DMatDMatMult";
+   {
+      LDMat L( n );
+      initialize( L, 5UL );
+      testMultiplication( L, U1 );
+      testMultiplication( U1, L );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running packed multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_DMATDMATMULT_PACKED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during packed multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
@@ -8865,8 +8866,9 @@ void ClassTest::testReserve()
 // \exception std::runtime_error Error detected.
 //
 // This function performs a test of the \c transpose() member function of the DynamicMatrix
-// class template. Additionally, it performs a test of self-transpose via the \c trans()
-// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+// class template, both with and without a temporary matrix. Additionally, it performs a test
+// of self-transpose via the \c trans() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
 */
 void ClassTest::testTranspose()
 {
@@ -8940,6 +8942,180 @@ void ClassTest::testTranspose()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // Self-transpose of a 37x37 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 37UL, 37UL );
+         for( size_t i=0UL; i<37UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         transpose( mat );
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 37UL );
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<37UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 13x37 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 13UL, 37UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         transpose( mat );
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 13UL );
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major self-transpose via transpose( true )";
+
+      // In-place self-transpose of a 13x37 matrix with padded element type
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 13UL, 37UL );
+         mat.reserve( 2048UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         const double* const data( mat.data() );
+
+         mat.transpose( true );
+
+         checkRows    ( mat,   37UL );
+         checkColumns ( mat,   13UL );
+         checkCapacity( mat, 2048UL );
+
+         if( mat.data() != data ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation reallocated the matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+
+         for( size_t k=0UL; k<37UL; ++k ) {
+            for( size_t l=13UL; l<mat.spacing(); ++l ) {
+               if( data[k*mat.spacing()+l] != 0.0 ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid padding element detected\n"
+                      << " Details:\n"
+                      << "   Padding element: " << data[k*mat.spacing()+l] << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // In-place self-transpose of a 13x37 matrix with unpadded element type
+      {
+         blaze::DynamicMatrix<std::string,blaze::rowMajor> mat( 13UL, 37UL );
+         mat.reserve( 2048UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = std::to_string( i*37UL + j );
+
+         const std::string* const data( mat.data() );
+
+         mat.transpose( true );
+
+         checkRows    ( mat,   37UL );
+         checkColumns ( mat,   13UL );
+         checkCapacity( mat, 2048UL );
+
+         if( mat.data() != data ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation reallocated the matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != std::to_string( j*37UL + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result: " << mat(i,j) << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 13x37 matrix with insufficient capacity
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 13UL, 37UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         mat.transpose( true );
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 13UL );
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
    }
 
    {
@@ -9103,6 +9279,180 @@ void ClassTest::testTranspose()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // Self-transpose of a 37x37 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 37UL, 37UL );
+         for( size_t i=0UL; i<37UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         transpose( mat );
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 37UL );
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<37UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 13x37 matrix
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 13UL, 37UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         transpose( mat );
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 13UL );
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major self-transpose via transpose( true )";
+
+      // In-place self-transpose of a 13x37 matrix with padded element type
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 13UL, 37UL );
+         mat.reserve( 2048UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         const double* const data( mat.data() );
+
+         mat.transpose( true );
+
+         checkRows    ( mat,   37UL );
+         checkColumns ( mat,   13UL );
+         checkCapacity( mat, 2048UL );
+
+         if( mat.data() != data ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation reallocated the matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+
+         for( size_t k=0UL; k<13UL; ++k ) {
+            for( size_t l=37UL; l<mat.spacing(); ++l ) {
+               if( data[k*mat.spacing()+l] != 0.0 ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid padding element detected\n"
+                      << " Details:\n"
+                      << "   Padding element: " << data[k*mat.spacing()+l] << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // In-place self-transpose of a 13x37 matrix with unpadded element type
+      {
+         blaze::DynamicMatrix<std::string,blaze::columnMajor> mat( 13UL, 37UL );
+         mat.reserve( 2048UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = std::to_string( i*37UL + j );
+
+         const std::string* const data( mat.data() );
+
+         mat.transpose( true );
+
+         checkRows    ( mat,   37UL );
+         checkColumns ( mat,   13UL );
+         checkCapacity( mat, 2048UL );
+
+         if( mat.data() != data ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation reallocated the matrix\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != std::to_string( j*37UL + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result: " << mat(i,j) << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 13x37 matrix with insufficient capacity
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( 13UL, 37UL );
+         for( size_t i=0UL; i<13UL; ++i )
+            for( size_t j=0UL; j<37UL; ++j )
+               mat(i,j) = i*37UL + j;
+
+         mat.transpose( true );
+
+         checkRows   ( mat, 37UL );
+         checkColumns( mat, 13UL );
+
+         for( size_t i=0UL; i<37UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j ) {
+               if( mat(i,j) != j*37UL + i ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Invalid element at (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
    }
 
    {
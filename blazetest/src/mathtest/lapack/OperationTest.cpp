@@ -96,6 +96,8 @@ OperationTest::OperationTest()
    //testGelqf< float >();
    //testOrglq< float >();
    //testOrmlq< float >();
+   //testSyevd< float >();
+   //testGesdd< float >();
 
 
    //=====================================================================================
@@ -129,6 +131,8 @@ OperationTest::OperationTest()
    testGelqf< double >();
    testOrglq< double >();
    testOrmlq< double >();
+   testSyevd< double >();
+   testGesdd< double >();
 
 
    //=====================================================================================
@@ -166,6 +170,8 @@ OperationTest::OperationTest()
    //testGelqf< complex<float> >();
    //testUnglq< complex<float> >();
    //testUnmlq< complex<float> >();
+   //testHeevd< complex<float> >();
+   //testGesdd< complex<float> >();
 
 
    //=====================================================================================
@@ -203,6 +209,8 @@ OperationTest::OperationTest()
    testGelqf< complex<double> >();
    testUnglq< complex<double> >();
    testUnmlq< complex<double> >();
+   testHeevd< complex<double> >();
+   testGesdd< complex<double> >();
 }
 //*************************************************************************************************
 
@@ -0,0 +1,605 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mappedserializer/ClassTest.cpp
+//  \brief Source file for the MappedSerializer class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blaze/math/ChunkedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedCompressedMatrix.h>
+#include <blaze/math/serialization/MappedSerializer.h>
+#include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/serialization/Archive.h>
+#include <blazetest/mathtest/mappedserializer/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedSerializer class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_    ()
+   , filename_( "mappedserializer.blzm" )
+{
+   testDenseMatrices();
+   testDenseVectors();
+   testSparseMatrices();
+   testConversion();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MappedSerializer class test.
+//
+// The destructor removes the temporary file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the mapping of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes dense matrices into a file and maps them back into memory by means of
+// aligned/padded and unaligned/unpadded custom matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseMatrices()
+{
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Dense matrices";
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      blaze::saveMapped( filename_, src );
+
+      blaze::CustomMatrix<double,aligned,padded,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+      compareMatrices( src, dst );
+
+      blaze::CustomMatrix<double,unaligned,unpadded,rowMajor> dst2;
+      blaze::loadMapped( filename_, dst2 );
+      compareMatrices( src, dst2 );
+
+      dst2(0,0) += 1.0;
+      blaze::loadMapped( filename_, dst2 );
+      compareMatrices( src, dst2 );
+
+      const blaze::DynamicMatrix<double,rowMajor> res( dst * blaze::trans( dst ) );
+      compareMatrices( src * blaze::trans( src ), res );
+   }
+
+   {
+      blaze::DynamicMatrix<blaze::complex<float>,columnMajor> src( 13UL, 7UL );
+      randomize( src );
+      blaze::saveMapped( filename_, src );
+
+      blaze::CustomMatrix<blaze::complex<float>,aligned,padded,columnMajor> dst;
+      blaze::loadMapped( filename_, dst );
+      compareMatrices( src, dst );
+   }
+
+   {
+      blaze::DynamicMatrix<int,rowMajor> src;
+      blaze::saveMapped( filename_, src );
+
+      blaze::CustomMatrix<int,aligned,padded,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+      compareMatrices( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mapping of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes dense vectors into a file and maps them back into memory by means of
+// custom vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseVectors()
+{
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   test_ = "Dense vectors";
+
+   {
+      blaze::DynamicVector<float,columnVector> src( 37UL );
+      randomize( src );
+      blaze::saveMapped( filename_, src );
+
+      blaze::CustomVector<float,aligned,padded,columnVector> dst;
+      blaze::loadMapped( filename_, dst );
+      compareVectors( src, dst );
+
+      blaze::CustomVector<float,unaligned,unpadded,rowVector> dst2;
+      blaze::loadMapped( filename_, dst2 );
+      compareVectors( blaze::trans( src ), dst2 );
+   }
+
+   {
+      blaze::DynamicVector<blaze::complex<double>,columnVector> src( 5UL );
+      randomize( src );
+      blaze::saveMapped( filename_, src );
+
+      blaze::CustomVector<blaze::complex<double>,aligned,padded,columnVector> dst;
+      blaze::loadMapped( filename_, dst );
+      compareVectors( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mapping of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes sparse matrices into a file and maps them back into memory by means of
+// mapped compressed matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testSparseMatrices()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Sparse matrices";
+
+   {
+      blaze::CompressedMatrix<double,rowMajor> src( 23UL, 17UL );
+      randomize( src, 60UL );
+      blaze::saveMapped( filename_, src );
+
+      blaze::MappedCompressedMatrix<double,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+      compareMatrices( src, dst );
+
+      if( !isIntact( dst ) || dst.nonZeros() != src.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid mapped compressed matrix\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << dst.nonZeros() << "\n"
+             << "   Expected number of non-zeros: " << src.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicVector<double> x( 17UL );
+      randomize( x );
+      const blaze::DynamicVector<double> y( dst * x );
+      compareVectors( src * x, y );
+   }
+
+   {
+      blaze::CompressedMatrix<int,columnMajor> src( 17UL, 23UL );
+      randomize( src, 60UL, -10, 10 );
+      blaze::saveMapped<unsigned short>( filename_, src );
+
+      blaze::MappedCompressedMatrix<int,columnMajor,unsigned short> dst;
+      blaze::loadMapped( filename_, dst );
+      compareMatrices( src, dst );
+
+      blaze::DynamicVector<int,blaze::rowVector> x( 17UL );
+      randomize( x, -10, 10 );
+      const blaze::DynamicVector<int,blaze::rowVector> y( x * dst );
+      compareVectors( x * src, y );
+   }
+
+   {
+      blaze::CompressedMatrix<float,rowMajor> src( 10UL, 10UL );
+      blaze::saveMapped( filename_, src );
+
+      blaze::MappedCompressedMatrix<float,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+      compareMatrices( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between the archive format and the mapped format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function converts matrices from the portable archive format into the mapped format
+// and back. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConversion()
+{
+   using blaze::aligned;
+   using blaze::padded;
+   using blaze::rowMajor;
+
+   test_ = "Conversion between archive and mapped format";
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> src( 9UL, 11UL );
+      randomize( src );
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+
+      blaze::DynamicMatrix<double,rowMajor> tmp;
+      archive >> tmp;
+      blaze::saveMapped( filename_, tmp );
+
+      blaze::CustomMatrix<double,aligned,padded,rowMajor> mapped;
+      blaze::loadMapped( filename_, mapped );
+
+      blaze::Archive<std::stringstream> archive2;
+      archive2 << mapped;
+
+      blaze::DynamicMatrix<double,rowMajor> dst;
+      archive2 >> dst;
+      compareMatrices( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<double,rowMajor> src( 9UL, 11UL );
+      randomize( src, 30UL );
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+
+      blaze::CompressedMatrix<double,rowMajor> tmp;
+      archive >> tmp;
+      blaze::saveMapped( filename_, tmp );
+
+      blaze::MappedCompressedMatrix<double,rowMajor> mapped;
+      blaze::loadMapped( filename_, mapped );
+
+      blaze::Archive<std::stringstream> archive2;
+      archive2 << mapped;
+
+      blaze::CompressedMatrix<double,rowMajor> dst;
+      archive2 >> dst;
+      compareMatrices( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing mapping attempts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with failing mapping attempts. In case no error is detected,
+// i.e. in case the test is failing, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   using blaze::aligned;
+   using blaze::padded;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   test_ = "Mapping failures";
+
+   try {
+      blaze::CustomMatrix<double,aligned,padded,rowMajor> dst;
+      blaze::loadMapped( "nonexisting.blzm", dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of non-existing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   blaze::DynamicMatrix<double,rowMajor> src( 5UL, 4UL );
+   randomize( src );
+   blaze::saveMapped( filename_, src );
+
+   try {
+      blaze::CustomMatrix<double,aligned,padded,columnMajor> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Storage order difference succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::CustomMatrix<float,aligned,padded,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::CustomVector<double,aligned,padded,columnVector> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix to vector mapping succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::MappedCompressedMatrix<double,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense to sparse mapping succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::CompressedMatrix<double,rowMajor> sparse( 5UL, 4UL );
+      blaze::saveMapped<uint64_t>( filename_, sparse );
+
+      blaze::MappedCompressedMatrix<double,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Index size difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   // The following headers are manipulated such that the size of the file is only matched
+   // due to an overflow of the number of rows times the spacing. The offsets of the header
+   // fields are 24 (rows), 48 (number of non-zeros) and 64 (first row/column offset).
+   const blaze::uint64_t overflow( ( blaze::uint64_t( 1U ) << 61U ) + 5U );
+
+   try {
+      blaze::DynamicMatrix<double,rowMajor> tmp( 5UL, 8UL, 0.0 );
+      blaze::saveMapped( filename_, tmp );
+      patchFile( 24UL, overflow );
+      patchFile( 48UL, 40U );
+
+      blaze::CustomMatrix<double,aligned,unpadded,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Overflowing matrix size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::DynamicMatrix<double,rowMajor> tmp( 5UL, 8UL, 0.0 );
+      blaze::saveMapped( filename_, tmp );
+      patchFile( 24UL, overflow );
+      patchFile( 48UL, 40U );
+
+      blaze::ChunkedMatrix<double> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Overflowing chunked matrix size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::DynamicVector<double,columnVector> tmp( 5UL, 0.0 );
+      blaze::saveMapped( filename_, tmp );
+      patchFile( 24UL, overflow );
+      patchFile( 48UL, overflow );
+
+      blaze::CustomVector<double,aligned,unpadded,columnVector> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Overflowing vector size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::CompressedMatrix<double,rowMajor> tmp( 5UL, 4UL );
+      blaze::saveMapped( filename_, tmp );
+      patchFile( 48UL, blaze::uint64_t( 1U ) << 62U );
+      patchFile( 64UL + 5UL*sizeof( uint64_t ), blaze::uint64_t( 1U ) << 62U );
+
+      blaze::MappedCompressedMatrix<double,rowMajor> dst;
+      blaze::loadMapped( filename_, dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Overflowing number of non-zero elements succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Overwrites a single 64-bit field of the temporary file.
+//
+// \param offset The byte offset of the field within the file.
+// \param value The new value of the field.
+// \return void
+// \exception std::runtime_error The file could not be modified.
+*/
+void ClassTest::patchFile( size_t offset, blaze::uint64_t value )
+{
+   std::fstream file( filename_, std::ios::in | std::ios::out | std::ios::binary );
+   file.seekp( static_cast<std::streamoff>( offset ) );
+   file.write( reinterpret_cast<const char*>( &value ), sizeof( value ) );
+
+   if( !file ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Modification of the temporary file failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace mappedserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedSerializer class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDSERIALIZER_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedSerializer class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -66,7 +66,9 @@ ClassTest::ClassTest()
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testRepresentation();
    testFailures();
+   testCorruptArchives();
 }
 //*************************************************************************************************
 
@@ -315,6 +317,92 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the serialized representation of numeric matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the bytes written by the block-wise serialization of dense and sparse
+// matrices with numeric element type to the bytes of an element-wise serialization. In case
+// an error is detected, i.e. in case the two representations differ, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testRepresentation()
+{
+   test_ = "Serialized representation";
+
+
+   //=====================================================================================
+   // Dense matrices
+   //=====================================================================================
+
+   {
+      blaze::StaticMatrix<int,7UL,13UL,blaze::rowMajor> src;
+      randomize( src );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::StaticMatrix<blaze::complex<float>,13UL,7UL,blaze::columnMajor> src;
+      randomize( src );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 37UL, 53UL );
+      randomize( src );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 37UL, 53UL );
+      randomize( src );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<short,blaze::rowMajor> src( 5UL, 0UL );
+      runRepresentationTest( src );
+   }
+
+
+   //=====================================================================================
+   // Sparse matrices
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 37UL, 53UL );
+      randomize( src, 150UL );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 37UL, 53UL );
+      randomize( src, 150UL );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 64UL, 16UL );
+      randomize( src, 1024UL );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::columnMajor> src( 9UL, 11UL );
+      randomize( src, 20UL );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 5UL, 3UL );
+      runRepresentationTest( src );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -423,6 +511,33 @@ void ClassTest::testFailures()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the deserialization of corrupt archives.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of sparse archives, whose number of non-zero elements
+// of a single row or column exceeds the size of the row or column, into dense and sparse,
+// row-major and column-major matrices. In case a corrupt archive is not rejected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCorruptArchives()
+{
+   test_ = "Corrupt archives";
+
+   runCorruptArchiveTest< blaze::DynamicMatrix<int,blaze::rowMajor> >( false );
+   runCorruptArchiveTest< blaze::DynamicMatrix<int,blaze::columnMajor> >( false );
+   runCorruptArchiveTest< blaze::CompressedMatrix<int,blaze::rowMajor> >( false );
+   runCorruptArchiveTest< blaze::CompressedMatrix<int,blaze::columnMajor> >( false );
+
+   runCorruptArchiveTest< blaze::DynamicMatrix<int,blaze::rowMajor> >( true );
+   runCorruptArchiveTest< blaze::DynamicMatrix<int,blaze::columnMajor> >( true );
+   runCorruptArchiveTest< blaze::CompressedMatrix<int,blaze::rowMajor> >( true );
+   runCorruptArchiveTest< blaze::CompressedMatrix<int,blaze::columnMajor> >( true );
+}
+//*************************************************************************************************
+
 } // namespace matrixserializer
 
 } // namespace mathtest
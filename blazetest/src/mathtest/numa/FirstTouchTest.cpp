@@ -0,0 +1,260 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/numa/FirstTouchTest.cpp
+//  \brief Source file for the NUMA first-touch initialization test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/numa/FirstTouchTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace numa {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the FirstTouchTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+FirstTouchTest::FirstTouchTest()
+{
+   blaze::setNumThreads( 4UL );
+
+   testDynamicVector();
+   testResize();
+   testDynamicMatrix<blaze::rowMajor>();
+   testDynamicMatrix<blaze::columnMajor>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the first-touch initialization of a DynamicVector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the first-touch initialization of a dynamic vector during
+// the construction, the copy construction and the non-preserving resize operation. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void FirstTouchTest::testDynamicVector()
+{
+   using blaze::DynamicVector;
+
+   const size_t N( blaze::SMP_DVECASSIGN_THRESHOLD + 13UL );
+
+   {
+      test_ = "DynamicVector size constructor";
+
+      DynamicVector<double> vec( N );
+
+      checkParallel( vec );
+      checkVector( vec, 0.0 );
+   }
+
+   {
+      test_ = "DynamicVector homogeneous initialization constructor";
+
+      DynamicVector<double> vec( N, 2.0 );
+
+      checkParallel( vec );
+      checkVector( vec, 2.0 );
+   }
+
+   {
+      test_ = "DynamicVector copy constructor";
+
+      const DynamicVector<double> vec1( N, 3.0 );
+      const DynamicVector<double> vec2( vec1 );
+
+      checkParallel( vec2 );
+      checkVector( vec2, 3.0 );
+   }
+
+   {
+      test_ = "DynamicVector::resize()";
+
+      DynamicVector<double> vec( 5UL, 4.0 );
+      vec.resize( N, false );
+
+      checkParallel( vec );
+      checkVector( vec, 0.0 );
+   }
+
+   {
+      test_ = "DynamicVector SMP assignment";
+
+      const DynamicVector<double> vec1( N, 1.0 );
+      const DynamicVector<double> vec2( N, 4.0 );
+      DynamicVector<double> vec3( N );
+
+      vec3 = vec1 + vec2;
+
+      checkVector( vec3, 5.0 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() and \c extend() member functions of the DynamicVector class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of a sequence of non-preserving, preserving and shrinking
+// resize operations, which mixes the parallel first-touch initialization and the serial
+// initialization of the elements of a dynamic vector. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void FirstTouchTest::testResize()
+{
+   using blaze::DynamicVector;
+   using blaze::rowVector;
+
+   const size_t N( blaze::SMP_DVECASSIGN_THRESHOLD + 13UL );
+
+   test_ = "DynamicVector::extend()";
+
+   DynamicVector<int,rowVector> vec;
+
+   vec.extend( 3UL );
+
+   vec[0] = 1;
+   vec[1] = 2;
+   vec[2] = 3;
+
+   vec.extend( 2UL, true );
+
+   if( vec.size() != 5UL || vec[0] != 1 || vec[1] != 2 || vec[2] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Extending the vector failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 1 2 3 x x )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   vec.extend( N, false );
+
+   checkParallel( vec );
+   checkVector( vec, 0 );
+
+   vec[0] = 1;
+   vec[1] = 2;
+   vec[2] = 3;
+
+   vec.resize( 3UL );
+
+   if( vec.size() != 3UL || vec[0] != 1 || vec[1] != 2 || vec[2] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Shrinking the vector failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 1 2 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=3UL; i<vec.capacity(); ++i ) {
+      if( vec.data()[i] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-zero padding element detected\n"
+             << " Details:\n"
+             << "   Index  : " << i << "\n"
+             << "   Result : " << vec.data()[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace numa
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running NUMA first-touch initialization test..." << std::endl;
+
+   try
+   {
+      RUN_NUMA_FIRSTTOUCH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during NUMA first-touch initialization test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
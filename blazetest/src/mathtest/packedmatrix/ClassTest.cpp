@@ -0,0 +1,1081 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testLayout();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix default constructor";
+
+      SMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix size constructor (4x4)";
+
+      SMT mat( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 10UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "PackedMatrix size constructor (4x4, diagonal)";
+
+      DMT mat( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix homogeneous initialization constructor (symmetric)";
+
+      SMT mat( 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 9UL );
+      checkResult  ( mat, RMT( 3UL, 3UL, 2 ) );
+   }
+
+   {
+      test_ = "PackedMatrix homogeneous initialization constructor (lower)";
+
+      LMT mat( 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+      checkResult  ( mat, RMT{ { 2, 0, 0 }, { 2, 2, 0 }, { 2, 2, 2 } } );
+   }
+
+   {
+      test_ = "PackedMatrix homogeneous initialization constructor (Hermitian, non-real value)";
+
+      typedef std::complex<double>  cplx;
+
+      try {
+         blaze::PackedMatrix<cplx,blaze::packedHermitian> mat( 3UL, cplx( 1.0, 1.0 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-Hermitian matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // List initialization
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix initializer list constructor (lower)";
+
+      LMT mat{ { 1 }, { 2, 3 }, { 4, 5, 6 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+      checkResult  ( mat, RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 4, 5, 6 } } );
+   }
+
+   {
+      test_ = "PackedMatrix initializer list constructor (non-symmetric)";
+
+      try {
+         SMT mat{ { 1, 2 }, { 3, 4 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix conversion constructor (SymmetricMatrix)";
+
+      blaze::SymmetricMatrix<RMT> ref( 3UL );
+      ref(0,0) = 1;
+      ref(0,2) = 2;
+      ref(1,1) = 3;
+      ref(2,1) = 4;
+
+      SMT mat1( ref );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkNonZeros( mat1, 6UL );
+      checkResult  ( mat1, ref );
+
+      OSMT mat2( ref );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+      checkResult  ( mat2, ref );
+   }
+
+   {
+      test_ = "PackedMatrix conversion constructor (symmetric DynamicMatrix)";
+
+      const ORMT ref{ { 1, 2, 0 }, { 2, 0, 3 }, { 0, 3, 4 } };
+
+      SMT mat( ref );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+      checkResult  ( mat, ref );
+   }
+
+   {
+      test_ = "PackedMatrix conversion constructor (non-upper DynamicMatrix)";
+
+      const RMT ref{ { 1, 2 }, { 3, 4 } };
+
+      try {
+         OUMT mat( ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-upper matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "PackedMatrix conversion constructor (non-square DynamicMatrix)";
+
+      const RMT ref( 2UL, 3UL, 0 );
+
+      try {
+         DMT mat( ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix copy constructor";
+
+      OUMT mat1{ { 1, 2, 3 }, { 0, 4, 5 }, { 0, 0, 6 } };
+      OUMT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+      checkResult  ( mat2, mat1 );
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix move constructor";
+
+      OUMT mat1{ { 1, 2, 3 }, { 0, 4, 5 }, { 0, 0, 6 } };
+      OUMT mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+      checkResult  ( mat2, RMT{ { 1, 2, 3 }, { 0, 4, 5 }, { 0, 0, 6 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Homogeneous assignment
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix homogeneous assignment";
+
+      OUMT mat( 3UL );
+      mat = 2;
+
+      checkNonZeros( mat, 6UL );
+      checkResult  ( mat, RMT{ { 2, 2, 2 }, { 0, 2, 2 }, { 0, 0, 2 } } );
+   }
+
+
+   //=====================================================================================
+   // Copy and move assignment
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix copy assignment";
+
+      SMT mat1{ { 1, 2 }, { 2, 3 } };
+      SMT mat2( 5UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 4UL );
+      checkResult  ( mat2, mat1 );
+   }
+
+   {
+      test_ = "PackedMatrix move assignment";
+
+      SMT mat1{ { 1, 2 }, { 2, 3 } };
+      SMT mat2( 5UL );
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 4UL );
+      checkResult  ( mat2, RMT{ { 1, 2 }, { 2, 3 } } );
+   }
+
+
+   //=====================================================================================
+   // Matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix assignment (column-major/row-major packed matrix)";
+
+      SMT mat1{ { 1, 2, 0 }, { 2, 0, 3 }, { 0, 3, 4 } };
+      OSMT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+      checkResult  ( mat2, mat1 );
+   }
+
+   {
+      test_ = "PackedMatrix assignment (transpose)";
+
+      LMT mat1{ { 1 }, { 2, 3 }, { 4, 5, 6 } };
+      OUMT mat2;
+      mat2 = trans( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+      checkResult  ( mat2, RMT{ { 1, 2, 4 }, { 0, 3, 5 }, { 0, 0, 6 } } );
+   }
+
+   {
+      test_ = "PackedMatrix assignment (non-lower matrix)";
+
+      LMT mat{ { 1 }, { 2, 3 } };
+
+      try {
+         mat = RMT{ { 1, 2 }, { 3, 4 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-lower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkResult( mat, RMT{ { 1, 0 }, { 2, 3 } } );
+   }
+
+
+   //=====================================================================================
+   // Addition, subtraction, and scaling
+   //=====================================================================================
+
+   {
+      test_ = "PackedMatrix addition assignment";
+
+      SMT mat{ { 1, 2 }, { 2, 3 } };
+      mat += RMT{ { 1, 1 }, { 1, 1 } };
+
+      checkResult( mat, RMT{ { 2, 3 }, { 3, 4 } } );
+   }
+
+   {
+      test_ = "PackedMatrix subtraction assignment";
+
+      DMT mat{ { 1, 0 }, { 0, 3 } };
+      mat -= blaze::DiagonalMatrix<RMT>{ { 1, 0 }, { 0, 1 } };
+
+      checkNonZeros( mat, 1UL );
+      checkResult  ( mat, RMT{ { 0, 0 }, { 0, 2 } } );
+   }
+
+   {
+      test_ = "PackedMatrix addition assignment (non-symmetric matrix)";
+
+      SMT mat{ { 1, 2 }, { 2, 3 } };
+
+      try {
+         mat += RMT{ { 0, 1 }, { 0, 0 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "PackedMatrix scaling";
+
+      LMT mat{ { 1 }, { 2, 3 } };
+      mat *= 2;
+
+      checkResult( mat, RMT{ { 2, 0 }, { 4, 6 } } );
+
+      mat /= 2;
+
+      checkResult( mat, RMT{ { 1, 0 }, { 2, 3 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the PackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "PackedMatrix::operator() (symmetric)";
+
+      OSMT mat( 3UL );
+      mat(0,1) = 1;
+      mat(2,0) = 2;
+      mat(1,1) = 3;
+      mat(1,2) += 4;
+      mat(2,1) *= 2;
+
+      checkNonZeros( mat, 7UL );
+      checkResult  ( mat, RMT{ { 0, 1, 2 }, { 1, 3, 8 }, { 2, 8, 0 } } );
+   }
+
+   {
+      test_ = "PackedMatrix::operator() (Hermitian)";
+
+      typedef std::complex<int>  cplx;
+
+      blaze::PackedMatrix<cplx,blaze::packedHermitian> mat( 2UL );
+      mat(0,1) = cplx( 1, 2 );
+      mat(1,1) = cplx( 3, 0 );
+
+      if( mat(0,1) != cplx( 1, 2 ) || mat(1,0) != cplx( 1, -2 ) || mat(1,1) != cplx( 3, 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( (0,0) (1,2) )\n( (1,-2) (3,0) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat(0,0) = cplx( 1, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-real diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "PackedMatrix::operator() (lower)";
+
+      LMT mat( 3UL );
+      mat(1,0) = 1;
+      mat(2,2) = 2;
+      mat(0,1) = 0;
+
+      checkNonZeros( mat, 2UL );
+      checkResult  ( mat, RMT{ { 0, 0, 0 }, { 1, 0, 0 }, { 0, 0, 2 } } );
+
+      try {
+         mat(0,2) = 3;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to restricted element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "PackedMatrix::at() (diagonal)";
+
+      DMT mat( 3UL );
+      mat.at(1,1) = 2;
+
+      checkResult( mat, RMT{ { 0, 0, 0 }, { 0, 2, 0 }, { 0, 0, 0 } } );
+
+      try {
+         mat.at(3,3) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   {
+      test_ = "PackedMatrix iterator (symmetric)";
+
+      SMT mat{ { 1, 2, 0 }, { 2, 0, 3 }, { 0, 3, 4 } };
+
+      const ptrdiff_t number( end( mat, 1UL ) - begin( mat, 1UL ) );
+
+      if( number != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      int value( 10 );
+      for( SMT::Iterator it=begin( mat, 1UL ); it!=end( mat, 1UL ); ++it ) {
+         *it = value++;
+      }
+
+      checkResult( mat, RMT{ { 1, 10, 0 }, { 10, 11, 12 }, { 0, 12, 4 } } );
+   }
+
+   {
+      test_ = "PackedMatrix iterator (upper)";
+
+      const OUMT mat{ { 1, 2, 3 }, { 0, 4, 5 }, { 0, 0, 6 } };
+
+      int sum( 0 );
+      for( OUMT::ConstIterator it=cbegin( mat, 1UL ); it!=cend( mat, 1UL ); ++it ) {
+         sum += *it;
+      }
+
+      if( sum != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration failed\n"
+             << " Details:\n"
+             << "   Sum of column 1   : " << sum << "\n"
+             << "   Expected sum      : 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "PackedMatrix::nonZeros()";
+
+   {
+      SMT mat{ { 1, 2, 0 }, { 2, 0, 3 }, { 0, 3, 0 } };
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+
+   {
+      OUMT mat{ { 1, 2, 3 }, { 0, 0, 5 }, { 0, 0, 6 } };
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 3UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "PackedMatrix::reset()";
+
+   {
+      SMT mat{ { 1, 2, 0 }, { 2, 5, 3 }, { 0, 3, 4 } };
+
+      reset( mat, 1UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+      checkResult  ( mat, RMT{ { 1, 0, 0 }, { 0, 0, 0 }, { 0, 0, 4 } } );
+
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "PackedMatrix::clear()";
+
+   {
+      LMT mat{ { 1 }, { 2, 3 } };
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+
+      mat.resize( 2UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() and \c extend() member functions of the PackedMatrix class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() and \c extend() member functions of the
+// PackedMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "PackedMatrix::resize() (leading layout)";
+
+      SMT mat{ { 1, 2 }, { 2, 3 } };
+
+      mat.resize( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkResult  ( mat, RMT{ { 1, 2, 0 }, { 2, 3, 0 }, { 0, 0, 0 } } );
+
+      mat.resize( 1UL );
+
+      checkRows  ( mat, 1UL );
+      checkResult( mat, RMT{ { 1 } } );
+
+      mat.extend( 1UL );
+
+      checkRows  ( mat, 2UL );
+      checkResult( mat, RMT{ { 1, 0 }, { 0, 0 } } );
+   }
+
+   {
+      test_ = "PackedMatrix::resize() (trailing layout)";
+
+      OUMT mat3{ { 1, 2, 3 }, { 0, 4, 5 }, { 0, 0, 6 } };
+      LMT  mat4{ { 1 }, { 2, 3 } };
+
+      mat3.resize( 2UL );
+      mat4.resize( 3UL );
+
+      checkResult( mat3, RMT{ { 1, 2 }, { 0, 4 } } );
+      checkResult( mat4, RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 0, 0 } } );
+
+      blaze::PackedMatrix<int,blaze::packedLower,blaze::columnMajor> mat5{ { 1 }, { 2, 3 } };
+
+      mat5.resize( 3UL );
+
+      checkResult( mat5, RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 0, 0 } } );
+
+      mat5.resize( 2UL, false );
+
+      checkNonZeros( mat5, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "PackedMatrix swap";
+
+   DMT mat1{ { 1, 0 }, { 0, 2 } };
+   DMT mat2{ { 3, 0, 0 }, { 0, 4, 0 }, { 0, 0, 5 } };
+
+   swap( mat1, mat2 );
+
+   checkRows  ( mat1, 3UL );
+   checkRows  ( mat2, 2UL );
+   checkResult( mat1, RMT{ { 3, 0, 0 }, { 0, 4, 0 }, { 0, 0, 5 } } );
+   checkResult( mat2, RMT{ { 1, 0 }, { 0, 2 } } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed storage layout of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the column-major packed matrices store their elements in the
+// packed formats of LAPACK (\c 'U' for symmetric and upper matrices, \c 'L' for lower matrices)
+// and that diagonal matrices store a single element per row/column. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLayout()
+{
+   {
+      test_ = "PackedMatrix layout (column-major symmetric, LAPACK 'U')";
+
+      const OSMT mat{ { 1, 2, 4 }, { 2, 3, 5 }, { 4, 5, 6 } };
+
+      const int* const data( mat.data() );
+
+      for( int i=0; i<6; ++i ) {
+         if( data[i] != i+1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid packed layout detected\n"
+                << " Details:\n"
+                << "   Index         : " << i << "\n"
+                << "   Value         : " << data[i] << "\n"
+                << "   Expected value: " << i+1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "PackedMatrix layout (column-major lower, LAPACK 'L')";
+
+      const blaze::PackedMatrix<int,blaze::packedLower,blaze::columnMajor>
+         mat{ { 1, 0, 0 }, { 2, 4, 0 }, { 3, 5, 6 } };
+
+      const int* const data( mat.data() );
+
+      for( int i=0; i<6; ++i ) {
+         if( data[i] != i+1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid packed layout detected\n"
+                << " Details:\n"
+                << "   Index         : " << i << "\n"
+                << "   Value         : " << data[i] << "\n"
+                << "   Expected value: " << i+1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "PackedMatrix layout (diagonal)";
+
+      const DMT mat{ { 1, 0, 0 }, { 0, 2, 0 }, { 0, 0, 3 } };
+
+      if( mat.capacity() != 3UL || mat.data()[0] != 1 || mat.data()[1] != 2 || mat.data()[2] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packed layout detected\n"
+             << " Details:\n"
+             << "   Capacity: " << mat.capacity() << "\n"
+             << "   Expected capacity: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix/dense vector multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of all kinds of PackedMatrix instances
+// with dense column and row vectors, which are evaluated by the packed multiplication kernels.
+// The results are compared to the products with an according DynamicMatrix. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::DynamicVector<int,blaze::columnVector>  CVT;
+   typedef blaze::DynamicVector<int,blaze::rowVector>     RVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 7UL, 16UL, 33UL };
+
+   for( size_t n : sizes )
+   {
+      const CVT x( blaze::rand<CVT>( n, -10, 10 ) );
+      const RVT z( blaze::rand<RVT>( n, -10, 10 ) );
+
+      const SMT  mat1( blaze::rand<SMT> ( n, -10, 10 ) );
+      const OSMT mat2( blaze::rand<OSMT>( n, -10, 10 ) );
+      const LMT  mat3( blaze::rand<LMT> ( n, -10, 10 ) );
+      const OUMT mat4( blaze::rand<OUMT>( n, -10, 10 ) );
+      const DMT  mat5( blaze::rand<DMT> ( n, -10, 10 ) );
+
+      const RMT  ref1( mat1 );
+      const ORMT ref2( mat2 );
+      const RMT  ref3( mat3 );
+      const ORMT ref4( mat4 );
+      const RMT  ref5( mat5 );
+
+      {
+         test_ = "PackedMatrix/dense vector multiplication";
+
+         CVT y( mat1 * x );
+         checkResult( y, CVT( ref1 * x ) );
+
+         y += mat2 * x;
+         checkResult( y, CVT( ref1 * x + ref2 * x ) );
+
+         y -= mat3 * x;
+         checkResult( y, CVT( ref1 * x + ref2 * x - ref3 * x ) );
+
+         y = mat4 * x;
+         checkResult( y, CVT( ref4 * x ) );
+
+         y = mat5 * x;
+         checkResult( y, CVT( ref5 * x ) );
+
+         y = 2 * mat3 * x;
+         checkResult( y, CVT( 2 * ref3 * x ) );
+
+         y -= mat4 * x * 3;
+         checkResult( y, CVT( 2 * ref3 * x - ref4 * x * 3 ) );
+      }
+
+      {
+         test_ = "Dense vector/PackedMatrix multiplication";
+
+         RVT y( z * mat1 );
+         checkResult( y, RVT( z * ref1 ) );
+
+         y += z * mat2;
+         checkResult( y, RVT( z * ref1 + z * ref2 ) );
+
+         y -= z * mat3;
+         checkResult( y, RVT( z * ref1 + z * ref2 - z * ref3 ) );
+
+         y = z * mat4;
+         checkResult( y, RVT( z * ref4 ) );
+
+         y = 2 * z * mat5;
+         checkResult( y, RVT( 2 * z * ref5 ) );
+      }
+
+      if( n > 0UL )
+      {
+         test_ = "PackedMatrix/subvector multiplication";
+
+         CVT w( n+1UL, 0 );
+         subvector( w, 1UL, n ) = x;
+
+         CVT y( mat2 * subvector( w, 1UL, n ) );
+         checkResult( y, CVT( ref2 * x ) );
+      }
+   }
+
+   {
+      test_ = "Hermitian PackedMatrix/dense vector multiplication";
+
+      typedef std::complex<double>  cplx;
+      typedef blaze::PackedMatrix<cplx,blaze::packedHermitian,blaze::rowMajor>     HMT;
+      typedef blaze::PackedMatrix<cplx,blaze::packedHermitian,blaze::columnMajor>  OHMT;
+
+      HMT  mat1( 3UL );
+      mat1(0,0) = cplx( 1, 0 );
+      mat1(0,1) = cplx( 2, 1 );
+      mat1(1,2) = cplx( 0, 3 );
+      mat1(2,2) = cplx( 4, 0 );
+
+      const OHMT mat2( mat1 );
+
+      const blaze::DynamicMatrix<cplx> ref( mat1 );
+      const blaze::DynamicVector<cplx> x{ cplx( 1, 1 ), cplx( 2, 0 ), cplx( 0, -1 ) };
+
+      checkResult( blaze::DynamicVector<cplx>( mat1 * x ), blaze::DynamicVector<cplx>( ref * x ) );
+      checkResult( blaze::DynamicVector<cplx>( mat2 * x ), blaze::DynamicVector<cplx>( ref * x ) );
+      checkResult( blaze::DynamicVector<cplx,blaze::rowVector>( trans( x ) * mat1 ),
+                   blaze::DynamicVector<cplx,blaze::rowVector>( trans( x ) * ref ) );
+      checkResult( blaze::DynamicVector<cplx,blaze::rowVector>( trans( x ) * mat2 ),
+                   blaze::DynamicVector<cplx,blaze::rowVector>( trans( x ) * ref ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1009 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sellmatrix/ClassTest.cpp
+//  \brief Source file for the SellMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/sellmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sellmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SellMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SellMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+      checkLayout  ( mat );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix conversion constructor (0x0)";
+
+      CMT ref;
+      MT mat( ref );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+      checkLayout  ( mat );
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (0x4)";
+
+      CMT ref( 0UL, 4UL );
+      MT mat( ref );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkLayout  ( mat );
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (3x0)";
+
+      CMT ref( 3UL, 0UL );
+      MT mat( ref );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+      checkLayout  ( mat );
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (row-major CompressedMatrix)";
+
+      CMT ref( 5UL, 6UL );
+      ref(0,1) = 1;
+      ref(1,0) = 2;
+      ref(1,3) = 3;
+      ref(1,5) = 4;
+      ref(3,2) = 5;
+      ref(4,4) = 6;
+      ref(4,5) = 7;
+
+      MT mat( ref, 5UL );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 7UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 3UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 1UL );
+      checkNonZeros( mat, 4UL, 2UL );
+      checkLayout  ( mat );
+
+      if( mat != ref || mat.sigma() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Sorting window = " << mat.sigma() << " (expected 5)\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 5UL, 6UL );
+      ref(0,1) = 1;
+      ref(1,0) = 2;
+      ref(1,3) = 3;
+      ref(1,5) = 4;
+      ref(3,2) = 5;
+      ref(4,4) = 6;
+      ref(4,5) = 7;
+
+      MT mat( ref );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 7UL );
+      checkLayout  ( mat );
+      checkResult  ( mat, ref );
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (DynamicMatrix)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( 3UL, 4UL, 0 );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(2,1) = 3;
+      ref(2,3) = 4;
+
+      MT mat( ref, 2UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+      checkLayout  ( mat );
+      checkResult  ( mat, ref );
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (large random matrix)";
+
+      for( size_t sigma=1UL; sigma<=64UL; sigma*=4UL )
+      {
+         CMT ref( 67UL, 45UL );
+         randomize( ref, 300UL );
+
+         MT mat( ref, sigma );
+
+         checkRows    ( mat, 67UL );
+         checkColumns ( mat, 45UL );
+         checkNonZeros( mat, ref.nonZeros() );
+         checkLayout  ( mat );
+         checkResult  ( mat, ref );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix copy constructor";
+
+      CMT ref( 7UL, 5UL );
+      ref(0,4) = 1;
+      ref(2,1) = 2;
+      ref(2,2) = 3;
+      ref(6,0) = 4;
+
+      MT mat1( ref, 4UL );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 7UL );
+      checkColumns ( mat2, 5UL );
+      checkNonZeros( mat2, 4UL );
+      checkLayout  ( mat2 );
+      checkResult  ( mat2, ref );
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix move constructor";
+
+      CMT ref( 7UL, 5UL );
+      ref(0,4) = 1;
+      ref(2,1) = 2;
+      ref(2,2) = 3;
+      ref(6,0) = 4;
+
+      MT mat1( ref, 4UL );
+      MT mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 7UL );
+      checkColumns ( mat2, 5UL );
+      checkNonZeros( mat2, 4UL );
+      checkLayout  ( mat2 );
+      checkResult  ( mat2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix copy assignment";
+
+      CMT ref( 4UL, 3UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(3,1) = 3;
+
+      MT mat1( ref, 4UL );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 4UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkLayout  ( mat2 );
+      checkResult  ( mat2, ref );
+   }
+
+   {
+      test_ = "SellMatrix copy assignment stress test";
+
+      MT mat1;
+
+      for( size_t i=0UL; i<20UL; ++i )
+      {
+         const size_t rows   ( blaze::rand<size_t>( 0UL, 20UL ) );
+         const size_t columns( blaze::rand<size_t>( 0UL, 20UL ) );
+
+         CMT ref( rows, columns );
+         randomize( ref, blaze::rand<size_t>( 0UL, rows*columns ) );
+
+         const MT mat2( ref, blaze::rand<size_t>( 1UL, 8UL ) );
+         mat1 = mat2;
+
+         checkLayout( mat1 );
+         checkResult( mat1, ref );
+      }
+   }
+
+
+   //=====================================================================================
+   // Move assignment
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix move assignment";
+
+      CMT ref( 4UL, 3UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(3,1) = 3;
+
+      MT mat1( ref, 4UL );
+      MT mat2( CMT( 2UL, 2UL ) );
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat2, 4UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkLayout  ( mat2 );
+      checkResult  ( mat2, ref );
+   }
+
+
+   //=====================================================================================
+   // Matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix matrix assignment (preserving the sorting window)";
+
+      CMT ref( 9UL, 9UL );
+      randomize( ref, 30UL );
+
+      MT mat( CMT( 2UL, 2UL ), 4UL );
+      mat = ref;
+
+      checkRows    ( mat, 9UL );
+      checkColumns ( mat, 9UL );
+      checkNonZeros( mat, ref.nonZeros() );
+      checkLayout  ( mat );
+      checkResult  ( mat, ref );
+
+      if( mat.sigma() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sorting window has not been preserved\n"
+             << " Details:\n"
+             << "   Sorting window          : " << mat.sigma() << "\n"
+             << "   Expected sorting window : 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix matrix assignment (expression)";
+
+      CMT A( 6UL, 6UL );
+      randomize( A, 12UL );
+
+      const CMT ref( A * A );
+
+      MT mat;
+      mat = A * A;
+
+      checkLayout( mat );
+      checkResult( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SellMatrix::operator()";
+
+   CMT ref( 20UL, 15UL );
+   randomize( ref, 60UL );
+
+   const MT mat( ref, 8UL );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j ) {
+         if( mat(i,j) != ref(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position       = (" << i << "," << j << ")\n"
+                << "   Result         = " << mat(i,j) << "\n"
+                << "   Expected value = " << ref(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c at() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "SellMatrix::at()";
+
+   CMT ref( 3UL, 4UL );
+   ref(0,1) = 1;
+   ref(2,3) = 2;
+
+   const MT mat( ref );
+
+   if( mat.at(0,1) != 1 || mat.at(2,3) != 2 || mat.at(1,1) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat.at(3,0);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      mat.at(0,4);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::ConstIterator   ConstIterator;
+   typedef CMT::ConstIterator  RefIterator;
+
+   CMT ref( 20UL, 11UL );
+   randomize( ref, 70UL );
+
+   const MT mat( ref, 4UL );
+
+   // Counting the number of elements in each row via ConstIterator (end-begin)
+   {
+      test_ = "Iterator subtraction";
+
+      for( size_t i=0UL; i<ref.rows(); ++i )
+      {
+         const ptrdiff_t number( mat.end(i) - mat.begin(i) );
+
+         if( number != static_cast<ptrdiff_t>( ref.nonZeros(i) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Row                       : " << i << "\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: " << ref.nonZeros(i) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      for( size_t i=0UL; i<ref.rows(); ++i )
+      {
+         RefIterator element( ref.begin(i) );
+
+         for( ConstIterator it=mat.cbegin(i); it!=mat.cend(i); ++it, ++element )
+         {
+            if( it->index() != element->index() || it->value() != element->value() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element detected\n"
+                   << " Details:\n"
+                   << "   Row            : " << i << "\n"
+                   << "   Found element  : (" << it->index() << "," << it->value() << ")\n"
+                   << "   Expected element: (" << element->index() << "," << element->value() << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   // Testing the conversion from Iterator to ConstIterator
+   {
+      test_ = "Iterator/ConstIterator conversion";
+
+      for( size_t i=0UL; i<ref.rows(); ++i )
+      {
+         ConstIterator it( mat.begin(i) );
+
+         if( it != mat.cbegin(i) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed iterator conversion detected\n"
+                << " Details:\n"
+                << "   Row: " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "SellMatrix::nonZeros()";
+
+      CMT ref( 3UL, 4UL );
+      ref(0,1) = 1;
+      ref(0,2) = 2;
+      ref(2,3) = 3;
+
+      const MT mat( ref );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 1UL, 0UL );
+      checkCapacity( mat, 2UL, 1UL );
+   }
+
+   {
+      test_ = "SellMatrix::nonZeros() (random matrix)";
+
+      CMT ref( 33UL, 17UL );
+      randomize( ref, 100UL );
+
+      const MT mat( ref, 16UL );
+
+      checkNonZeros( mat, ref.nonZeros() );
+
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         checkNonZeros( mat, i, ref.nonZeros(i) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SellMatrix swap";
+
+   CMT ref1( 3UL, 2UL );
+   ref1(0,1) = 1;
+   ref1(2,0) = 2;
+
+   CMT ref2( 5UL, 7UL );
+   ref2(1,6) = 3;
+   ref2(4,0) = 4;
+   ref2(4,2) = 5;
+
+   MT mat1( ref1, 2UL );
+   MT mat2( ref2, 4UL );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 5UL );
+   checkColumns ( mat1, 7UL );
+   checkNonZeros( mat1, 3UL );
+   checkLayout  ( mat1 );
+   checkResult  ( mat1, ref2 );
+
+   checkRows    ( mat2, 3UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 2UL );
+   checkLayout  ( mat2 );
+   checkResult  ( mat2, ref1 );
+
+   if( mat1.sigma() != 4UL || mat2.sigma() != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the sorting windows failed\n"
+          << " Details:\n"
+          << "   Sorting window of the first matrix : " << mat1.sigma() << " (expected 4)\n"
+          << "   Sorting window of the second matrix: " << mat2.sigma() << " (expected 2)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SellMatrix::find()";
+
+   CMT ref( 25UL, 13UL );
+   randomize( ref, 80UL );
+
+   const MT mat( ref, 8UL );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const MT::ConstIterator pos( mat.find( i, j ) );
+         const CMT::ConstIterator refpos( ref.find( i, j ) );
+
+         if( ( refpos == ref.end(i) ) != ( pos == mat.end(i) ) ||
+             ( pos != mat.end(i) && ( pos->index() != j || pos->value() != refpos->value() ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong result of the element search\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the SellMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "SellMatrix::lowerBound()";
+
+   CMT ref( 25UL, 13UL );
+   randomize( ref, 80UL );
+
+   const MT mat( ref, 8UL );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const ptrdiff_t pos   ( mat.lowerBound( i, j ) - mat.begin(i) );
+         const ptrdiff_t refpos( ref.lowerBound( i, j ) - ref.begin(i) );
+
+         if( pos != refpos ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong lower bound detected\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Found offset      = " << pos << "\n"
+                << "   Expected offset   = " << refpos << "\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the SellMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "SellMatrix::upperBound()";
+
+   CMT ref( 25UL, 13UL );
+   randomize( ref, 80UL );
+
+   const MT mat( ref, 8UL );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const ptrdiff_t pos   ( mat.upperBound( i, j ) - mat.begin(i) );
+         const ptrdiff_t refpos( ref.upperBound( i, j ) - ref.begin(i) );
+
+         if( pos != refpos ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong upper bound detected\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Found offset      = " << pos << "\n"
+                << "   Expected offset   = " << refpos << "\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with default matrix
+   {
+      const MT mat( CMT( 3UL, 4UL ) );
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-default matrix
+   {
+      CMT ref( 3UL, 4UL );
+      ref(1,2) = 1;
+
+      const MT mat( ref );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix/dense vector multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dedicated SELL-C-sigma kernels for the multiplication
+// of a SellMatrix (or its transpose) with a dense vector. The results are compared to the
+// results of the corresponding CompressedMatrix operations. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::SellMatrix<double>                 SMT;
+   typedef blaze::CompressedMatrix<double,false>     RMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>  CVT;
+   typedef blaze::DynamicVector<double,blaze::rowVector>     RVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 15UL, 33UL, 100UL };
+
+   for( size_t m : sizes ) {
+      for( size_t n : sizes ) {
+         for( size_t sigma=1UL; sigma<=32UL; sigma*=8UL )
+         {
+            RMT ref( m, n );
+            randomize( ref, ( m*n ) / 4UL );
+            for( size_t i=0UL; i<m; ++i ) {
+               for( RMT::Iterator element=ref.begin(i); element!=ref.end(i); ++element )
+                  element->value() = blaze::rand<int>( -10, 10 );
+            }
+
+            const SMT mat( ref, sigma );
+
+            CVT x( n ), u( m );
+            RVT v( m );
+            for( size_t j=0UL; j<n; ++j ) x[j] = blaze::rand<int>( -10, 10 );
+            for( size_t i=0UL; i<m; ++i ) u[i] = v[i] = blaze::rand<int>( -10, 10 );
+
+            // Multiplication assignment
+            {
+               test_ = "SellMatrix/dense vector multiplication";
+
+               CVT y( mat * x );
+               checkResult( y, CVT( ref * x ) );
+
+               y += mat * x;
+               checkResult( y, CVT( 2.0 * ( ref * x ) ) );
+
+               y -= mat * x;
+               checkResult( y, CVT( ref * x ) );
+            }
+
+            // Multiplication with a subvector and as part of an expression
+            {
+               test_ = "SellMatrix/dense vector multiplication (expression)";
+
+               CVT y( 2.0 * ( mat * ( x + x ) ) );
+               checkResult( y, CVT( 2.0 * ( ref * ( x + x ) ) ) );
+
+               if( n > 0UL ) {
+                  CVT z( n+1UL, 0.0 );
+                  subvector( z, 1UL, n ) = x;
+                  y = mat * subvector( z, 1UL, n );
+                  checkResult( y, CVT( ref * x ) );
+               }
+            }
+
+            // Multiplication with the transpose
+            {
+               test_ = "Dense vector/SellMatrix multiplication";
+
+               RVT y( v * mat );
+               checkResult( y, RVT( v * ref ) );
+
+               y += v * mat;
+               checkResult( y, RVT( 2.0 * ( v * ref ) ) );
+
+               y -= v * mat;
+               checkResult( y, RVT( v * ref ) );
+
+               CVT z( trans( mat ) * u );
+               checkResult( z, CVT( trans( ref ) * u ) );
+
+               z += trans( mat ) * u;
+               checkResult( z, CVT( 2.0 * ( trans( ref ) * u ) ) );
+
+               z -= trans( mat ) * u;
+               checkResult( z, CVT( trans( ref ) * u ) );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sellmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SellMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SELLMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SellMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -97,6 +97,10 @@ int main()
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 32UL,  32UL,  8UL ), CMCb(  32UL, 32UL,  8UL ) );
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 64UL,  32UL, 16UL ), CMCb(  32UL, 16UL,  8UL ) );
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 64UL,  32UL, 16UL ), CMCb(  32UL, 64UL, 16UL ) );
+
+      // Running tests with wide, very sparse matrices
+      RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 15UL,   63UL, 180UL ), CMCb(   63UL, 1024UL,  315UL ) );
+      RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 15UL, 1024UL,  30UL ), CMCb( 1024UL, 1024UL, 1024UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during sparse matrix/sparse matrix multiplication:\n"
@@ -0,0 +1,341 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smpassign/SparseTest.cpp
+//  \brief Source file for the sparse SMP assignment test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/smp/SerialSection.h>
+#include <blazetest/mathtest/smpassign/SparseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpassign {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SparseTest::SparseTest()
+{
+   blaze::setNumThreads( 4UL );
+
+   testCompressedMatrix();
+   testCompressedVector();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment to a CompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SMP assignment of a sparse matrix/sparse matrix
+// multiplication to both a row-major and a column-major compressed matrix, both via the
+// conversion constructor and via the assignment operator. Since the parallel multiplication
+// kernel compares the number of scalar multiplications of the product against the SMP
+// threshold, the operands are sized such that both the number of elements of the result and
+// the number of scalar multiplications exceed the threshold. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testCompressedMatrix()
+{
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t N( dimension( blaze::SMP_SMATSMATMULT_THRESHOLD ) );
+
+   CompressedMatrix<int,rowMajor> A( N, N ), B( N, N );
+   initialize( A );
+   initialize( B );
+
+   if( multiplications( A, B ) < blaze::SMP_SMATSMATMULT_THRESHOLD ) {
+      std::ostringstream oss;
+      oss << " Test: Sparse matrix/sparse matrix multiplication setup\n"
+          << " Error: Product below the SMP threshold\n"
+          << " Details:\n"
+          << "   Dimension                 : " << N << "\n"
+          << "   Number of multiplications : " << multiplications( A, B ) << "\n"
+          << "   SMP threshold             : " << blaze::SMP_SMATSMATMULT_THRESHOLD << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   CompressedMatrix<int,rowMajor> ref;
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * B;
+   }
+
+
+   //=====================================================================================
+   // Row-major compressed matrix
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix conversion constructor";
+
+      checkParallel( CompressedMatrix<int,rowMajor>(), A * B );
+
+      CompressedMatrix<int,rowMajor> C( A * B );
+
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = "Row-major CompressedMatrix assignment";
+
+      CompressedMatrix<int,rowMajor> C( 3UL, 5UL, 4UL );
+      C(1,2) = 7;
+
+      C = A * B;
+
+      checkResult( C, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major compressed matrix
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix conversion constructor";
+
+      checkParallel( CompressedMatrix<int,columnMajor>(), A * B );
+
+      CompressedMatrix<int,columnMajor> C( A * B );
+
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = "Column-major CompressedMatrix assignment";
+
+      CompressedMatrix<int,columnMajor> C( 3UL, 5UL, 4UL );
+      C(1,2) = 7;
+
+      C = A * B;
+
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment to a CompressedVector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SMP assignment of a sparse matrix/sparse vector
+// multiplication to a compressed vector, both via the conversion constructor and via the
+// assignment operator. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SparseTest::testCompressedVector()
+{
+   using blaze::CompressedMatrix;
+   using blaze::CompressedVector;
+   using blaze::rowMajor;
+
+   const size_t N( blaze::SMP_SMATSVECMULT_THRESHOLD + 100UL );
+
+   CompressedMatrix<int,rowMajor> A( N, N );
+   initialize( A );
+
+   CompressedVector<int> x( N );
+   initialize( x );
+
+   CompressedVector<int> ref;
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * x;
+   }
+
+   {
+      test_ = "CompressedVector conversion constructor";
+
+      checkParallel( CompressedVector<int>(), A * x );
+
+      CompressedVector<int> y( A * x );
+
+      checkResult( y, ref );
+   }
+
+   {
+      test_ = "CompressedVector assignment";
+
+      CompressedVector<int> y( 5UL, 2UL );
+      y[3] = 7;
+
+      y = A * x;
+
+      checkResult( y, ref );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given compressed vector with a deterministic sparsity pattern.
+//
+// \param sv The compressed vector to be initialized.
+// \return void
+//
+// This function initializes every third element of the given compressed vector.
+*/
+void SparseTest::initialize( blaze::CompressedVector<int>& sv )
+{
+   sv.reset();
+
+   for( size_t i=0UL; i<sv.size(); i+=3UL ) {
+      sv[i] = static_cast<int>( i%7UL + 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the dimension of a square operand whose result exceeds the given threshold.
+//
+// \param threshold The SMP threshold of the operation.
+// \return The dimension of the square operands.
+//
+// This function computes the dimension of square operands with \a nonZerosPerRow non-zero
+// elements per row such that both the number of elements of the result and the number of
+// scalar multiplications of a matrix/matrix multiplication exceed the given threshold.
+*/
+size_t SparseTest::dimension( size_t threshold )
+{
+   size_t n( 16UL );
+
+   while( n*n < threshold + 100UL || n*nonZerosPerRow*nonZerosPerRow < threshold + 100UL ) {
+      n += 16UL;
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of scalar multiplications of the product of the given matrices.
+//
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \return The number of scalar multiplications of the product \f$ A*B \f$.
+*/
+size_t SparseTest::multiplications( const blaze::CompressedMatrix<int,blaze::rowMajor>& A,
+                                    const blaze::CompressedMatrix<int,blaze::rowMajor>& B )
+{
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         total += B.nonZeros( element->index() );
+      }
+   }
+
+   return total;
+}
+//*************************************************************************************************
+
+} // namespace smpassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse SMP assignment test..." << std::endl;
+
+   try
+   {
+      RUN_SMPASSIGN_SPARSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse SMP assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,6 +37,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/sparse/SparseMatrix.h>
@@ -74,6 +75,7 @@ GeneralTest::GeneralTest()
    testIsStrictlyUpper();
    testIsDiagonal();
    testIsIdentity();
+   testFrobeniusNorm();
 }
 //*************************************************************************************************
 
@@ -4621,6 +4623,81 @@ void GeneralTest::testMaximum()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c frobeniusNorm() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c frobeniusNorm() function for sparse matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testFrobeniusNorm()
+{
+   test_ = "frobeniusNorm() function";
+
+   {
+      // Frobenius norm of an empty matrix
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat;
+
+      const double norm = frobeniusNorm( mat );
+
+      if( !blaze::isDefault( norm ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Frobenius norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Frobenius norm of a row-major matrix
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,1) =  1;
+      mat(1,0) = -3;
+      mat(1,3) =  1;
+      mat(2,2) =  5;
+
+      const double norm = frobeniusNorm( mat );
+
+      if( !blaze::equal( norm, 6.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Frobenius norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << "\n"
+             << "   Expected result: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Frobenius norm of a column-major matrix
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+      mat(0,1) =  1;
+      mat(1,0) = -3;
+      mat(1,3) =  1;
+      mat(2,2) =  5;
+
+      const double norm = frobeniusNorm( mat );
+
+      if( !blaze::equal( norm, 6.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Frobenius norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << "\n"
+             << "   Expected result: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace sparsematrix
 
 } // namespace mathtest
@@ -37,6 +37,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/sparse/SparseVector.h>
@@ -69,6 +70,7 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testNorms();
 }
 //*************************************************************************************************
 
@@ -577,6 +579,131 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the norm functions for sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c l1Norm(), \c l2Norm(), \c linfNorm(), and \c lpNorm()
+// functions for sparse vectors. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testNorms()
+{
+   test_ = "l1Norm(), l2Norm(), linfNorm(), and lpNorm() functions";
+
+   {
+      // Norms of an empty vector
+      blaze::CompressedVector<double,blaze::rowVector> vec;
+
+      const double l1 = l1Norm( vec );
+
+      if( !blaze::isDefault( l1 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L1 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l1 << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double l2 = l2Norm( vec );
+
+      if( !blaze::isDefault( l2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L2 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l2 << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double linf = linfNorm( vec );
+
+      if( !blaze::isDefault( linf ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infinity norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << linf << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Norms of a small vector
+      blaze::CompressedVector<int,blaze::rowVector> vec( 5UL );
+      vec[1] =  3;
+      vec[3] = -4;
+
+      const int l1 = l1Norm( vec );
+
+      if( l1 != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L1 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l1 << "\n"
+             << "   Expected result: 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double l2 = l2Norm( vec );
+
+      if( !blaze::equal( l2, 5.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: L2 norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l2 << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const int linf = linfNorm( vec );
+
+      if( linf != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infinity norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << linf << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double lp = blaze::lpNorm<3>( vec );
+
+      if( !blaze::equal( lp, std::cbrt( 91.0 ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lp norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << lp << "\n"
+             << "   Expected result: 4.4979\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const int l1p = blaze::lpNorm<1>( vec );
+
+      if( l1p != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lp norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << l1p << "\n"
+             << "   Expected result: 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace sparsevector
 
 } // namespace mathtest
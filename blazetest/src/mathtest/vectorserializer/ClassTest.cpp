@@ -67,7 +67,9 @@ ClassTest::ClassTest()
 {
    testEmptyVectors();
    testRandomVectors();
+   testRepresentation();
    testFailures();
+   testCorruptArchives();
 }
 //*************************************************************************************************
 
@@ -229,6 +231,81 @@ void ClassTest::testRandomVectors()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the serialized representation of numeric vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the bytes written by the block-wise serialization of dense and sparse
+// vectors with numeric element type to the bytes of an element-wise serialization. The vectors
+// are chosen such that the elements are written in several blocks. In case an error is
+// detected, i.e. in case the two representations differ, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testRepresentation()
+{
+   test_ = "Serialized representation";
+
+
+   //=====================================================================================
+   // Dense vectors
+   //=====================================================================================
+
+   {
+      blaze::StaticVector<int,13UL,blaze::columnVector> src;
+      randomize( src );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> src( 9000UL );
+      randomize( src );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::DynamicVector<blaze::complex<float>,blaze::rowVector> src( 4099UL );
+      randomize( src );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::DynamicVector<short,blaze::columnVector> src;
+      runRepresentationTest( src );
+   }
+
+
+   //=====================================================================================
+   // Sparse vectors
+   //=====================================================================================
+
+   {
+      blaze::CompressedVector<double,blaze::columnVector> src( 20000UL );
+      randomize( src, 9000UL );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::CompressedVector<int,blaze::rowVector> src( 4096UL );
+      randomize( src, 4096UL );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::CompressedVector<blaze::complex<float>,blaze::columnVector> src( 31UL );
+      randomize( src, 7UL );
+      runRepresentationTest( src );
+   }
+
+   {
+      blaze::CompressedVector<int,blaze::columnVector> src( 5UL );
+      runRepresentationTest( src );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -319,6 +396,25 @@ void ClassTest::testFailures()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the deserialization of corrupt archives.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of a sparse archive, which claims to contain more
+// non-zero elements than the size of the vector, into dense and sparse vectors. In case the
+// corrupt archive is not rejected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCorruptArchives()
+{
+   test_ = "Corrupt archives";
+
+   runCorruptArchiveTest< blaze::DynamicVector<int,blaze::columnVector> >();
+   runCorruptArchiveTest< blaze::CompressedVector<int,blaze::columnVector> >();
+}
+//*************************************************************************************************
+
 } // namespace vectorserializer
 
 } // namespace mathtest
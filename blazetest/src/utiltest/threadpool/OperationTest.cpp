@@ -0,0 +1,541 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/OperationTest.cpp
+//  \brief Source file for the thread pool operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <blazetest/utiltest/threadpool/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testSchedule();
+   testTaskGroups();
+   testNestedTasks();
+   testConcurrentGroups();
+   testResize();
+   testClear();
+   testDeterministic();
+   testAffinity();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scheduling of tasks and of the global wait() function.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSchedule()
+{
+   test_ = "Scheduling of tasks";
+
+   std::atomic<size_t> counter( 0UL );
+
+   StdThreadPool threadpool( 4UL );
+
+   for( size_t i=0UL; i<tasks; ++i ) {
+      threadpool.schedule( [&counter]( size_t j ){ counter += j; }, 1UL );
+   }
+
+   threadpool.wait();
+
+   checkCounter( counter, tasks );
+
+   if( !threadpool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty thread pool detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of task groups.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scheduling of tasks in the context of task groups.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testTaskGroups()
+{
+   test_ = "Task groups";
+
+   std::atomic<size_t> counter1( 0UL );
+   std::atomic<size_t> counter2( 0UL );
+
+   StdThreadPool threadpool( 4UL );
+   blaze::threadpool::TaskGroup group1;
+   blaze::threadpool::TaskGroup group2;
+
+   for( size_t i=0UL; i<tasks; ++i ) {
+      threadpool.schedule( group1, [&counter1](){ ++counter1; } );
+      threadpool.schedule( group2, [&counter2](){ ++counter2; } );
+   }
+
+   threadpool.wait( group1 );
+   checkCounter( counter1, tasks );
+
+   threadpool.wait( group2 );
+   checkCounter( counter2, tasks );
+
+   if( !group1.isDone() || !group2.isDone() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Pending tasks detected\n"
+          << " Details:\n"
+          << "   Pending tasks of group 1: " << group1.pending() << "\n"
+          << "   Pending tasks of group 2: " << group2.pending() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of tasks that schedule subtasks and wait for their completion
+// from within the thread pool. Since there are more outer tasks than threads, the test only
+// succeeds if waiting threads help to execute the pending subtasks. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testNestedTasks()
+{
+   test_ = "Nested tasks";
+
+   std::atomic<size_t> counter( 0UL );
+
+   StdThreadPool threadpool( 2UL );
+   blaze::threadpool::TaskGroup outer;
+
+   for( size_t i=0UL; i<10UL; ++i )
+   {
+      threadpool.schedule( outer, [&threadpool,&counter]()
+      {
+         blaze::threadpool::TaskGroup inner;
+
+         for( size_t j=0UL; j<tasks/10UL; ++j ) {
+            threadpool.schedule( inner, [&counter](){ ++counter; } );
+         }
+
+         threadpool.wait( inner );
+      } );
+   }
+
+   threadpool.wait( outer );
+
+   checkCounter( counter, tasks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of task groups used concurrently by several threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of several threads that concurrently schedule tasks to the
+// same thread pool and wait for their own tasks only. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testConcurrentGroups()
+{
+   test_ = "Concurrent task groups";
+
+   std::vector<size_t> counters( 4UL, 0UL );
+   std::vector<std::thread> clients;
+
+   StdThreadPool threadpool( 3UL );
+
+   for( size_t i=0UL; i<counters.size(); ++i )
+   {
+      clients.emplace_back( [&threadpool,&counters,i]()
+      {
+         std::atomic<size_t> counter( 0UL );
+         blaze::threadpool::TaskGroup group;
+
+         for( size_t j=0UL; j<tasks; ++j ) {
+            threadpool.schedule( group, [&counter](){ ++counter; } );
+         }
+
+         threadpool.wait( group );
+         counters[i] = counter;
+      } );
+   }
+
+   for( size_t i=0UL; i<clients.size(); ++i ) {
+      clients[i].join();
+   }
+
+   for( size_t i=0UL; i<counters.size(); ++i ) {
+      checkCounter( counters[i], tasks );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() function of the thread pool. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testResize()
+{
+   test_ = "Resizing the thread pool";
+
+   std::atomic<size_t> counter( 0UL );
+
+   StdThreadPool threadpool( 2UL );
+
+   for( size_t n : { 5UL, 1UL, 3UL } )
+   {
+      threadpool.resize( n, true );
+
+      if( threadpool.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid thread pool size detected\n"
+             << " Details:\n"
+             << "   Size         : " << threadpool.size() << "\n"
+             << "   Expected size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<tasks; ++i ) {
+         threadpool.schedule( [&counter](){ ++counter; } );
+      }
+
+      threadpool.wait();
+   }
+
+   checkCounter( counter, 3UL*tasks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() function of the thread pool. Cleared tasks of
+// a task group are expected to count as completed. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testClear()
+{
+   test_ = "Clearing the thread pool";
+
+   std::mutex mutex;
+   std::atomic<size_t> counter( 0UL );
+
+   StdThreadPool threadpool( 1UL );
+   blaze::threadpool::TaskGroup group;
+
+   {
+      // Blocking the single thread of the pool until all tasks have been scheduled
+      std::unique_lock<std::mutex> lock( mutex );
+
+      for( size_t i=0UL; i<tasks; ++i ) {
+         threadpool.schedule( group, [&mutex,&counter](){ std::unique_lock<std::mutex> l( mutex ); ++counter; } );
+      }
+
+      threadpool.clear();
+   }
+
+   threadpool.wait( group );
+   threadpool.wait();
+
+   if( counter > 1UL || !threadpool.isEmpty() || !group.isDone() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the thread pool failed\n"
+          << " Details:\n"
+          << "   Number of executed tasks: " << counter << "\n"
+          << "   Pending tasks of group  : " << group.pending() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the deterministic placement of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the deterministic mode of the thread pool, i.e. it checks
+// that the i-th task of every series of tasks is executed by the same thread. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDeterministic()
+{
+   test_ = "Deterministic placement of tasks";
+
+   const size_t threads( 4UL );
+
+   StdThreadPool threadpool( threads, true );
+
+   if( !threadpool.isDeterministic() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-deterministic thread pool detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::vector<std::thread::id> first( threads );
+   std::vector<std::thread::id> ids( threads );
+
+   for( size_t series=0UL; series<tasks/threads; ++series )
+   {
+      for( size_t i=0UL; i<threads; ++i ) {
+         threadpool.schedule( [&ids,i](){ ids[i] = std::this_thread::get_id(); } );
+      }
+
+      threadpool.wait();
+
+      if( series == 0UL ) {
+         first = ids;
+      }
+      else if( ids != first ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-deterministic placement of tasks detected\n"
+             << " Details:\n"
+             << "   Series: " << series << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread affinity.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parsing of affinity policies and of the pinning of the
+// threads of the thread pool. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testAffinity()
+{
+   test_ = "Thread affinity";
+
+   // Parsing an explicit list of cores
+   {
+      const std::vector<int> cores( blaze::parseAffinity( " 0,2, 4-6 " ) );
+      const std::vector<int> expected{ 0, 2, 4, 5, 6 };
+
+      if( cores != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing an explicit list of cores failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Parsing the compact and scatter policies
+   {
+      std::vector<int> compact( blaze::parseAffinity( "compact" ) );
+      std::vector<int> scatter( blaze::parseAffinity( "Scatter" ) );
+
+      std::sort( compact.begin(), compact.end() );
+      std::sort( scatter.begin(), scatter.end() );
+
+      if( compact != blaze::availableCores() || scatter != blaze::availableCores() ||
+          !blaze::parseAffinity( "none" ).empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing an affinity policy failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Parsing invalid policies
+   for( const char* policy : { "0,", "3-1", "-2", "close" } )
+   {
+      try {
+         blaze::parseAffinity( policy );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing an invalid affinity policy succeeded\n"
+             << " Details:\n"
+             << "   Policy: \"" << policy << "\"\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Pinning the threads of the thread pool (only on systems supporting thread pinning)
+   if( blaze::availableCores().empty() )
+      return;
+
+   const int core( blaze::availableCores().front() );
+
+   StdThreadPool threadpool( 4UL, true, std::vector<int>( 1UL, core ) );
+
+   if( threadpool.placement() != std::vector<int>( 4UL, core ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Pinning the threads of the thread pool failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   threadpool.setAffinity( std::vector<int>() );
+
+   if( blaze::availableCores().size() > 1UL &&
+       threadpool.placement() != std::vector<int>( 4UL, -1 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unpinning the threads of the thread pool failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the value of a task counter.
+//
+// \param counter The value of the task counter.
+// \param expected The expected value of the task counter.
+// \return void
+// \exception std::runtime_error Invalid counter value detected.
+*/
+void OperationTest::checkCounter( size_t counter, size_t expected ) const
+{
+   if( counter != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Result         : " << counter << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread pool operation test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread pool operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,533 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/thresholds/OperationTest.cpp
+//  \brief Source file for the threshold operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/utiltest/thresholds/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace thresholds {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+   : test_   ()                                   // Label of the currently performed test
+   , profile_( "blazetest_threshold_profile.txt" )  // Name of the temporary threshold profile
+{
+   testDefaults();
+   testSetThreshold();
+   testResetThresholds();
+   testLoadThresholds();
+   testSaveThresholds();
+   testEnvironment();
+
+   std::remove( profile_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the default values of the thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all thresholds are initialized with their compile time defaults.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDefaults()
+{
+   test_ = "Default values of the thresholds";
+
+   blaze::resetThresholds();
+
+   checkDefault( blaze::DMATDVECMULT_THRESHOLD );
+   checkDefault( blaze::SMP_DVECASSIGN_THRESHOLD );
+   checkDefault( blaze::SMP_BATCH_THRESHOLD );
+
+   if( std::string( blaze::SMP_DVECASSIGN_THRESHOLD.name() ) != "SMP_DVECASSIGN_THRESHOLD" ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold name\n"
+          << " Details:\n"
+          << "   Result         : " << blaze::SMP_DVECASSIGN_THRESHOLD.name() << "\n"
+          << "   Expected result: SMP_DVECASSIGN_THRESHOLD\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the setThreshold() function. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSetThreshold()
+{
+   test_ = "setThreshold() function";
+
+   blaze::resetThresholds();
+
+   // Setting an SMP threshold
+   {
+      blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 1234UL );
+      checkThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 1234UL );
+
+      const size_t threshold = blaze::SMP_DVECASSIGN_THRESHOLD;
+      if( threshold != 1234UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid implicit conversion of a threshold\n"
+             << " Details:\n"
+             << "   Result         : " << threshold << "\n"
+             << "   Expected result: 1234\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Setting an SMP threshold to 0
+   {
+      blaze::setThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 0UL );
+      checkThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 0UL );
+   }
+
+   // Setting a BLAS threshold
+   {
+      blaze::setThreshold( blaze::DMATDMATMULT_THRESHOLD, 42UL );
+      checkThreshold( blaze::DMATDMATMULT_THRESHOLD, 42UL );
+   }
+
+   // Setting a BLAS threshold to 0
+   try {
+      blaze::setThreshold( blaze::DMATDMATMULT_THRESHOLD, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting a BLAS threshold to 0 succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkThreshold( blaze::DMATDMATMULT_THRESHOLD, 42UL );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resetThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resetThresholds() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testResetThresholds()
+{
+   test_ = "resetThresholds() function";
+
+   blaze::setThreshold( blaze::TDMATDVECMULT_THRESHOLD, 7UL );
+   blaze::setThreshold( blaze::SMP_DMATREDUCE_THRESHOLD, 7UL );
+
+   blaze::resetThresholds();
+
+   checkDefault( blaze::TDMATDVECMULT_THRESHOLD );
+   checkDefault( blaze::SMP_DMATREDUCE_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the loadThresholds() function. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLoadThresholds()
+{
+   test_ = "loadThresholds() function";
+
+   blaze::resetThresholds();
+
+   // Loading a valid threshold profile
+   {
+      writeProfile( "# Threshold profile\n"
+                    "\n"
+                    "SMP_DVECASSIGN_THRESHOLD = 1111  # Comment\n"
+                    "  DMATDVECMULT_THRESHOLD=2222\n"
+                    "SMP_DMATASSIGN_THRESHOLD\t=\t0\n" );
+
+      blaze::loadThresholds( profile_ );
+
+      checkThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 1111UL );
+      checkThreshold( blaze::DMATDVECMULT_THRESHOLD  , 2222UL );
+      checkThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 0UL );
+      checkDefault( blaze::SMP_BATCH_THRESHOLD );
+   }
+
+   // Loading threshold profiles with invalid settings
+   {
+      const std::string profiles[] = {
+         "SMP_DVECASSIGN_THRESHOLD = 3333\nUNKNOWN_THRESHOLD = 3333\n",
+         "SMP_DVECASSIGN_THRESHOLD = 3333\nDMATDVECMULT_THRESHOLD = 0\n",
+         "SMP_DVECASSIGN_THRESHOLD = 3333\nSMP_DMATASSIGN_THRESHOLD = abc\n",
+         "SMP_DVECASSIGN_THRESHOLD = 3333\nSMP_DMATASSIGN_THRESHOLD = -1\n",
+         "SMP_DVECASSIGN_THRESHOLD = 3333\n"
+         "SMP_DMATASSIGN_THRESHOLD = 99999999999999999999999\n",
+         "SMP_DVECASSIGN_THRESHOLD = 3333\nSMP_DMATASSIGN_THRESHOLD =\n",
+         "SMP_DVECASSIGN_THRESHOLD = 3333\nSMP_DMATASSIGN_THRESHOLD 3333\n"
+      };
+
+      for( const std::string& profile : profiles )
+      {
+         writeProfile( profile );
+
+         try {
+            blaze::loadThresholds( profile_ );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Loading an invalid threshold profile succeeded\n"
+                << " Details:\n"
+                << "   Profile:\n" << profile << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 1111UL );
+         checkThreshold( blaze::DMATDVECMULT_THRESHOLD  , 2222UL );
+         checkThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 0UL );
+      }
+   }
+
+   // Loading a non-existing threshold profile
+   try {
+      blaze::loadThresholds( "blazetest_nonexisting_profile.txt" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a non-existing threshold profile succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the saveThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the saveThresholds() function by saving and reloading the
+// current threshold values. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testSaveThresholds()
+{
+   test_ = "saveThresholds() function";
+
+   blaze::resetThresholds();
+
+   blaze::setThreshold( blaze::TDVECDMATMULT_THRESHOLD, 5555UL );
+   blaze::setThreshold( blaze::SMP_TSMATTSMATMULT_THRESHOLD, 6666UL );
+
+   blaze::saveThresholds( profile_ );
+   blaze::resetThresholds();
+   blaze::loadThresholds( profile_ );
+
+   checkThreshold( blaze::TDVECDMATMULT_THRESHOLD    , 5555UL );
+   checkThreshold( blaze::SMP_TSMATTSMATMULT_THRESHOLD, 6666UL );
+   checkDefault( blaze::SMP_DVECASSIGN_THRESHOLD );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the threshold settings via environment variables.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the evaluation of the \c BLAZE_THRESHOLD_PROFILE environment
+// variable and of the environment variables of the individual thresholds. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testEnvironment()
+{
+   test_ = "Environment variables";
+
+   // Threshold profile and individual thresholds
+   {
+      writeProfile( "SMP_DVECASSIGN_THRESHOLD = 1111\n"
+                    "SMP_DMATASSIGN_THRESHOLD = 2222\n"
+                    "UNKNOWN_THRESHOLD = 3333\n"
+                    "SMP_BATCH_THRESHOLD = 4444\n" );
+
+      setEnvironment( "BLAZE_THRESHOLD_PROFILE", profile_ );
+      setEnvironment( "BLAZE_SMP_DMATASSIGN_THRESHOLD", "777" );
+      setEnvironment( "BLAZE_SMP_DVECDVECMULT_THRESHOLD", "0" );
+      setEnvironment( "BLAZE_DMATDMATMULT_THRESHOLD", "88" );
+
+      blaze::initializeThresholds();
+
+      checkThreshold( blaze::SMP_DVECASSIGN_THRESHOLD  , 1111UL );
+      checkThreshold( blaze::SMP_DMATASSIGN_THRESHOLD  , 777UL );
+      checkThreshold( blaze::SMP_BATCH_THRESHOLD       , 4444UL );
+      checkThreshold( blaze::SMP_DVECDVECMULT_THRESHOLD, 0UL );
+      checkThreshold( blaze::DMATDMATMULT_THRESHOLD    , 88UL );
+   }
+
+   // Invalid settings of the individual thresholds
+   {
+      clearEnvironment( "BLAZE_THRESHOLD_PROFILE" );
+      setEnvironment( "BLAZE_SMP_DMATASSIGN_THRESHOLD", "abc" );
+      setEnvironment( "BLAZE_SMP_DVECDVECMULT_THRESHOLD", "99999999999999999999999" );
+      setEnvironment( "BLAZE_DMATDMATMULT_THRESHOLD", "0" );
+      setEnvironment( "BLAZE_SMP_BATCH_THRESHOLD", "12x" );
+      setEnvironment( "BLAZE_SMP_DVECASSIGN_THRESHOLD", "" );
+
+      blaze::initializeThresholds();
+
+      checkDefault( blaze::SMP_DVECASSIGN_THRESHOLD );
+      checkDefault( blaze::SMP_DMATASSIGN_THRESHOLD );
+      checkDefault( blaze::SMP_BATCH_THRESHOLD );
+      checkDefault( blaze::SMP_DVECDVECMULT_THRESHOLD );
+      checkDefault( blaze::DMATDMATMULT_THRESHOLD );
+   }
+
+   // Non-existing threshold profile
+   {
+      setEnvironment( "BLAZE_THRESHOLD_PROFILE", "blazetest_nonexisting_profile.txt" );
+      setEnvironment( "BLAZE_SMP_DMATASSIGN_THRESHOLD", "999" );
+
+      blaze::initializeThresholds();
+
+      checkDefault( blaze::SMP_DVECASSIGN_THRESHOLD );
+      checkThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 999UL );
+   }
+
+   clearEnvironment( "BLAZE_THRESHOLD_PROFILE" );
+   clearEnvironment( "BLAZE_SMP_DMATASSIGN_THRESHOLD" );
+   clearEnvironment( "BLAZE_SMP_DVECDVECMULT_THRESHOLD" );
+   clearEnvironment( "BLAZE_DMATDMATMULT_THRESHOLD" );
+   clearEnvironment( "BLAZE_SMP_BATCH_THRESHOLD" );
+   clearEnvironment( "BLAZE_SMP_DVECASSIGN_THRESHOLD" );
+
+   blaze::initializeThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the value of the given threshold.
+//
+// \param threshold The threshold to be checked.
+// \param expected The expected value of the threshold.
+// \return void
+// \exception std::runtime_error Invalid threshold value detected.
+*/
+void OperationTest::checkThreshold( const blaze::Threshold& threshold, size_t expected ) const
+{
+   if( threshold.value() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold value detected\n"
+          << " Details:\n"
+          << "   Threshold      : " << threshold.name() << "\n"
+          << "   Result         : " << threshold.value() << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given threshold has its default value.
+//
+// \param threshold The threshold to be checked.
+// \return void
+// \exception std::runtime_error Invalid threshold value detected.
+*/
+void OperationTest::checkDefault( const blaze::Threshold& threshold ) const
+{
+   checkThreshold( threshold, threshold.defaultValue() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing the given content to the temporary threshold profile.
+//
+// \param content The content of the threshold profile.
+// \return void
+// \exception std::runtime_error Unable to write the threshold profile.
+*/
+void OperationTest::writeProfile( const std::string& content ) const
+{
+   std::ofstream out( profile_.c_str() );
+   out << content;
+   out.close();
+
+   if( !out ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unable to write threshold profile '" << profile_ << "'\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the given environment variable.
+//
+// \param name The name of the environment variable.
+// \param value The value of the environment variable.
+// \return void
+*/
+void OperationTest::setEnvironment( const std::string& name, const std::string& value ) const
+{
+#if defined(_WIN32)
+   _putenv_s( name.c_str(), value.c_str() );
+#else
+   setenv( name.c_str(), value.c_str(), 1 );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the given environment variable.
+//
+// \param name The name of the environment variable.
+// \return void
+*/
+void OperationTest::clearEnvironment( const std::string& name ) const
+{
+#if defined(_WIN32)
+   _putenv_s( name.c_str(), "" );
+#else
+   unsetenv( name.c_str() );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace thresholds
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running threshold operation test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDS_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during threshold operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************